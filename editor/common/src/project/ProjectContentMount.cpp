@@ -3,7 +3,9 @@
 #include "project/Project.h"
 
 #include <assets/cook/AssetImporter.h>
+#include <assets/cook/AssetRegistryIndexBuilder.h>
 #include <assets/cook/ImportOnDemand.h>
+#include <assets/cook/TextureBlockCache.h>
 #include <assets/cook/TextureCook.h>
 #include <core/assets/AssetIdMap.h>
 #include <core/assets/AssetRegistry.h>
@@ -30,11 +32,33 @@ void MountProjectContent(const ProjectDescriptor& project,
         // overlay, so a material's asset://...png resolves to its cooked .stex with a
         // bindless slot: the same resolve the runtime uses, which is what makes the
         // Solid viewport WYSIWYG. Editors are cook-enabled; cooked wins over the scan.
+        //
+        // Compressed blocks persist across launches (TextureBlockCache), so an edit
+        // to one corner of a texture recompresses that corner, not the whole chain.
         {
-            PngTextureImporter textureImporter(jobs);
+            const std::filesystem::path blockCachePath =
+                std::filesystem::path(root) / kCookedCacheDirName / kTextureBlockCacheFileName;
+            TextureBlockCache blockCache;
+            std::string blockCacheError;
+            if (!blockCache.LoadFromFile(blockCachePath, &blockCacheError))
+                log.Warn("assets: texture block cache unreadable ({}); starting cold", blockCacheError);
+
+            PngTextureImporter textureImporter(jobs, &blockCache);
             AssetImporterRegistry importers;
             importers.Register(textureImporter);
             (void)ImportAssetsOnDemand(root, importers, assets.Registry, logging);
+
+            const TextureCookStats& cooked = textureImporter.Stats();
+            if (cooked.Textures > 0)
+            {
+                const uint64_t blocks = cooked.BlocksEncoded + cooked.BlocksFromCache;
+                log.Info("assets: cooked {} texture(s), {:.1f} MPix in {:.2f}s ({:.1f} MPix/s, {}% of blocks from cache)",
+                         cooked.Textures, static_cast<double>(cooked.Pixels) / 1.0e6, cooked.Seconds,
+                         cooked.MegapixelsPerSecond(),
+                         blocks > 0 ? cooked.BlocksFromCache * 100 / blocks : 0);
+            }
+            if (blockCache.IsDirty() && !blockCache.SaveToFile(blockCachePath, &blockCacheError))
+                log.Warn("assets: could not save the texture block cache: {}", blockCacheError);
         }
         RegisterCookedAssets(root, assets.Registry);
 
@@ -43,6 +67,15 @@ void MountProjectContent(const ProjectDescriptor& project,
         const std::string idMapPath = (std::filesystem::path(root) / kAssetIdMapFileName).string();
         if (AssetIdMap::LoadFromFile(idMapPath, idMap, &idMapError))
             ApplyAssetIds(idMap, assets.Registry);
+
+        // Everything the root just registered, for a player to map at startup
+        // instead of repeating the walk (AssetRegistryIndex).
+        std::string indexError;
+        if (!WriteAssetRegistryIndex(assets.Registry, root, AssetRegistryIndexPath(root),
+                                     nullptr, &indexError))
+        {
+            log.Warn("assets: could not write the registry index for '{}': {}", root, indexError);
+        }
     }
     log.Info("assets: mounted {} content root(s)", project.ContentRoots.size());
 }
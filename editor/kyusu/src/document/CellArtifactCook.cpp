@@ -7,6 +7,7 @@
 
 #include <assets/cook/BrushGeometryCook.h>
 #include <assets/cook/CollisionShapeCook.h>
+#include <assets/cook/MeshletBuild.h>
 #include <core/assets/AssetRef.h>
 #include <project/CookProfile.h>
 
@@ -107,6 +108,9 @@ bool EmitCellArtifacts(const DocumentCookContext& ctx,
             result.Error = "CookDocument: " + bakeError;
             return false;
         }
+        // A cell spans far more than any view sees of it at once; meshlets
+        // let the passes draw only the parts in front of the camera.
+        BuildMeshlets(geometry);
 
         const std::string cellName = CellName(cell.Coord);
         const std::string meshAssetPath = "asset://levels/" + stemStr + "/" + cellName;
@@ -33,7 +33,7 @@ namespace
             DocumentCookStepIds::LightmapSurfaces, kBrushCellsDependencies, {}, 1, false },
         CookStepDefinition{
             CookStepIds::RenderMeshes, kBrushCellsDependencies,
-            CookOutputFamilies::Structure, 1, true },
+            CookOutputFamilies::Structure, 2, true },
         CookStepDefinition{
             CookStepIds::Collision, kBrushCellsDependencies,
             CookOutputFamilies::Collision, 1, true },
@@ -6,6 +6,7 @@
 #include "CookStepProgress.h"
 #include "DocumentArtifactCatalog.h"
 #include "DocumentCookContext.h"
+#include "DocumentSerialization.h"
 
 #include <assets/cook/SceneCookOutput.h>
 #include <assets/static_mesh/MeshSerializer.h>
@@ -115,7 +116,7 @@ bool WriteCookedSceneArtifacts(const DocumentCookContext& ctx,
     }
     const std::filesystem::path stagedManifest = transaction.Stage(paths.Manifest);
     const std::filesystem::path stagedScene = transaction.Stage(paths.Scene);
-    if (!WriteCookedScene(cooked, catalog.SceneRefs(), physicalPathFor,
+    if (!WriteCookedScene(cooked, EditorSceneSerializers(), catalog.SceneRefs(), physicalPathFor,
             transaction.Stage(idMapPath), stagedManifest, stagedScene, &cookError))
     {
         result.Error = "CookDocument: " + cookError;
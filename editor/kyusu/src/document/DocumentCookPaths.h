@@ -2,6 +2,8 @@
 
 #include "CookStepCache.h"
 
+#include <world/serialization/SceneFormat.h>
+
 #include <cstdint>
 #include <filesystem>
 #include <format>
@@ -33,7 +35,7 @@ struct DocumentCookPaths
         ? std::string(stem)
         : outputNamespace + "/" + std::format("{:016x}", documentHash);
     paths.CookedDir = assetsRoot / ".cooked/levels";
-    paths.Scene = paths.CookedDir / (paths.Stem + ".cooked.json");
+    paths.Scene = paths.CookedDir / (paths.Stem + std::string(CookedSceneSuffix));
     paths.Manifest = paths.CookedDir / (paths.Stem + ".manifest.json");
     paths.Collision = paths.CookedDir / (paths.Stem + ".collision.json");
     paths.Receipt = DocumentCookReceiptPath(assetsRoot, sourceRel);
@@ -13,6 +13,7 @@
 #include <core/json/JsonValue.h>
 #include <core/logging/Logger.h>
 #include <core/logging/LoggingProvider.h>
+#include <core/serialization/BinaryReader.h>
 #include <ecs/World.h>
 #include <graphics/vulkan/TextureCache.h>
 #include <render/MaterialSetCache.h>
@@ -29,13 +30,16 @@
 #include <world/serialization/SceneSerializationContext.h>
 #include <world/serialization/SceneSerializer.h>
 #include <world/transform/TransformComponents.h>
+#include <zone/ZonePackageSceneLoader.h>
 
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <fstream>
 #include <optional>
+#include <span>
 #include <sstream>
+#include <string>
 #include <utility>
 #include "document/DocumentSerialization.h"
 
@@ -298,7 +302,7 @@ void SceneRenderQueueBuilder::SetLightmapPreview(const LightmapPreviewSource& so
 {
     PreviewRegistry.reset();
 
-    std::ifstream file(source.CookedScenePath);
+    std::ifstream file(source.CookedScenePath, std::ios::binary);
     if (!file.is_open())
     {
         Log.Error("lightmap preview: cannot open '{}'",
@@ -307,24 +311,40 @@ void SceneRenderQueueBuilder::SetLightmapPreview(const LightmapPreviewSource& so
     }
     std::ostringstream buffer;
     buffer << file.rdbuf();
-    JsonParseError parseError;
-    const std::optional<JsonValue> json = JsonParse(buffer.str(), &parseError);
-    if (!json)
-    {
-        Log.Error("lightmap preview: parse error in '{}': {}",
-                  source.CookedScenePath.generic_string(), parseError.Message);
-        return;
-    }
+    const std::string contents = std::move(buffer).str();
 
     auto registry = std::make_unique<Registry>();
     InitializeSceneRegistry(*registry, &Meshes, &MaterialSets,
                             nullptr, nullptr, nullptr, Textures);
     SceneSerializationContext context(Logging, &Assets);
     SceneLoadError loadError;
-    if (!LoadSceneJson(*json, *registry, EditorSceneSerializers(), context, &loadError))
+
+    // The cook writes binary; a hand-edited or older cooked scene is still JSON.
+    if (IsBinaryScene(std::as_bytes(std::span(contents.data(), contents.size()))))
     {
-        Log.Error("lightmap preview: scene load error: {}", loadError.Message);
-        return;
+        std::istringstream stream(contents, std::ios::binary);
+        BinaryReader reader(stream);
+        if (!LoadSceneBinary(reader, *registry, EditorSceneSerializers(), context, &loadError))
+        {
+            Log.Error("lightmap preview: scene load error: {}", loadError.Message);
+            return;
+        }
+    }
+    else
+    {
+        JsonParseError parseError;
+        const std::optional<JsonValue> json = JsonParse(contents, &parseError);
+        if (!json)
+        {
+            Log.Error("lightmap preview: parse error in '{}': {}",
+                      source.CookedScenePath.generic_string(), parseError.Message);
+            return;
+        }
+        if (!LoadSceneJson(*json, *registry, EditorSceneSerializers(), context, &loadError))
+        {
+            Log.Error("lightmap preview: scene load error: {}", loadError.Message);
+            return;
+        }
     }
 
     PreviewRegistry = std::move(registry);
@@ -30,8 +30,8 @@ void ZoneBoundsRenderer::DrawViewport(const FrameContext& frame, const EditorVie
     {
         if (viewport.Orientation == ViewportOrientation::Perspective)
         {
-            view.PreviewFocus = ResolveFocusZone(world.Manifest(), viewport.Camera.Position,
-                                                 view.PreviewFocus);
+            view.PreviewFocus = ResolveFocusZone(world.Manifest(), world.Index(),
+                                                 viewport.Camera.Position, view.PreviewFocus);
             view.PreviewFocusPosition = viewport.Camera.Position;
         }
         // A camera outside every zone (the usual editing vantage, floating
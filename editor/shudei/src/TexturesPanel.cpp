@@ -251,6 +251,15 @@ bool TexturesPanel::DrawImportSettings()
     ImGui::SameLine();
     ImGui::Checkbox("Mips", &Draft.GenerateMips);
 
+    ImGui::BeginDisabled(!Draft.GenerateMips);
+    static constexpr const char* kMipKernels[] = { "box", "kaiser" };
+    int mipKernel = static_cast<int>(Draft.MipKernel);
+    ImGui::SetNextItemWidth(120.0f);
+    if (ImGui::Combo("Mip filter", &mipKernel, kMipKernels, 2))
+        Draft.MipKernel = static_cast<TextureMipKernel>(mipKernel);
+    ImGui::SetItemTooltip("kaiser keeps more detail in distant mips; box is the plain 2x2 average");
+    ImGui::EndDisabled();
+
     if (ImGui::Button("Apply"))
         ApplyDraft();
     ImGui::SameLine();
@@ -59,4 +59,5 @@ private:
 
     void OnFree(AnimationClipEntry& entry);
     bool IsEntryLive(const AnimationClipEntry& entry) const;
+    AssetFootprint WarmFootprint(const AnimationClipEntry& entry) const;
 };
@@ -50,4 +50,5 @@ private:
 
     void OnFree(SkeletonEntry& entry);
     bool IsEntryLive(const SkeletonEntry& entry) const;
+    AssetFootprint WarmFootprint(const SkeletonEntry& entry) const;
 };
@@ -14,6 +14,7 @@
 #include <render/ShadowCasterExtractionSystem.h>
 #include <render/ShadowCasterSet.h>
 #include <render/ShadowResidency.h>
+#include <render/TextureResidency.h>
 #include <render/static_mesh/StaticMeshCache.h>
 
 #include <vector>
@@ -79,6 +80,9 @@ private:
     bool CasterRecordsWereBuilt = false;
     std::vector<SpotShadowRequest> ShadowRequests;
     std::vector<PointShadowRequest> PointShadowRequests;
+    // Per-texture screen size gathered by mesh extraction; drives the texture
+    // cache's mip residency once the frame's draws are known.
+    TextureStreamingDemand TextureDemand;
     CameraRenderData Camera;
     StaticMeshCache* Meshes = nullptr;
     MaterialCache* Materials = nullptr;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <app/DefaultRenderPipeline.h>
+#include <net/NetEntropyModelFile.h>
 #include <net/NetSession.h>
 #include <app/EngineSchedule.h>
 #include <core/console/ConsoleStartupScript.h>
@@ -13,6 +14,8 @@
 #include <net/NetStats.h>
 #include <net/NetTickEstimator.h>
 #include <net/PeerCommandRuntime.h>
+#include <net/PredictionRuntime.h>
+#include <net/SnapshotInterpolation.h>
 #include <net/ReplicationRuntime.h>
 #include <profiling/CpuScopeTimings.h>
 #include <profiling/RenderInstrumentation.h>
@@ -28,6 +31,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <span>
 #include <string>
 #include <vector>
@@ -78,7 +82,10 @@ public:
     [[nodiscard]] NetSession* TryNet() { return NetState.get(); }
     [[nodiscard]] const NetSession* TryNet() const { return NetState.get(); }
     // Constructs the session over `transport`, which the caller owns and must
-    // outlive it. Returns null if one already exists.
+    // outlive it. Returns null if one already exists. Applies Config().Net:
+    // the snapshot entropy model is loaded on first use and installed on
+    // Replication(), and a configured snapshot capture is opened. A model
+    // that fails to load is logged and snapshots go raw.
     [[nodiscard]] NetSession* CreateNetSession(INetTransport& transport);
     void DestroyNetSession();
 
@@ -104,6 +111,14 @@ public:
     // on an authority, which is the machine defining it.
     [[nodiscard]] NetTickEstimator& NetClock() { return NetClockState; }
     [[nodiscard]] const NetTickEstimator& NetClock() const { return NetClockState; }
+    // A client's record of what it predicted for the pawns it owns, and the
+    // rollback that corrects it. Inert on an authority, which predicts nothing.
+    [[nodiscard]] PredictionRuntime& Prediction() { return PredictionState; }
+    [[nodiscard]] const PredictionRuntime& Prediction() const { return PredictionState; }
+    // Where a client draws what other machines drive: a little behind the
+    // newest snapshot, blended. Inert on an authority, which draws its own.
+    [[nodiscard]] SnapshotInterpolation& Interpolation() { return InterpolationState; }
+    [[nodiscard]] const SnapshotInterpolation& Interpolation() const { return InterpolationState; }
 
     // What a replicated entity becomes on this machine. Registered by the game
     // and outlives any one session, because it describes content rather than a
@@ -272,6 +287,9 @@ private:
     // was recorded on. Called once graphics exist, before any frame runs.
     void PublishCaptureEnvironment();
 
+    // CreateNetSession's share of Config().Net: model and capture.
+    void ApplyNetConfig();
+
     void RegisterEngineConsoleBuiltins(ConsoleService& console, DebugService& debug);
     // Adds the default debug overlay to the main renderer. Called by Run after
     // the game's startup hooks so the overlay's MainColor draw follows every
@@ -296,11 +314,18 @@ private:
     WorldComponentSchema RuntimeComponentSchemaState;
     ReplicationLayout ReplicationLayoutState;
     ReplicationRuntime ReplicationState;
+    // Loaded from Config().Net on the first session and kept for later ones:
+    // it is shipped content, not session state.
+    std::optional<NetEntropyModel> EntropyModelState;
+    bool EntropyModelLoaded = false;
+    NetSnapshotCapture SnapshotCaptureState;
     std::vector<NetSession::Delivery> PendingNetDeliveries;
     NetCVarPublisher CVarPublisherState;
     PeerCommandRuntime PeerCommandState;
     NetStats NetStatsState;
     NetTickEstimator NetClockState;
+    PredictionRuntime PredictionState;
+    SnapshotInterpolation InterpolationState;
     NetSpawnRecipes SpawnRecipeState;
     std::unique_ptr<RuntimeWorld> RuntimeWorldState;
     RuntimeFrameLoop RuntimeLoop;
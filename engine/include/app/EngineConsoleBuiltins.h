@@ -2,15 +2,19 @@
 
 #include <core/config/ConsoleConfig.h>
 #include <core/config/RuntimeConfig.h>
+#include <core/assets/AssetStore.h>
 #include <core/console/ConsoleTypes.h>
 #include <profiling/RenderInstrumentation.h>
 #include <render/ShadowResidency.h>
+#include <render/TextureResidency.h>
+#include <render/static_mesh/MeshLod.h>
 
 #include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
 
+class AssetSystem;
 class ConsoleRegistry;
 class ConsoleService;
 class DebugService;
@@ -54,6 +58,27 @@ namespace EngineConsoleBuiltins
     [[nodiscard]] ShadowResidencyBudgets ReadShadowResidencyBudgets(
         const ConsoleRegistry* registry);
 
+    // render.texture.budget_mib and render.texture.upload_mib_per_frame in
+    // bytes. A null registry yields the registered defaults.
+    [[nodiscard]] TextureStreamingBudgets ReadTextureStreamingBudgets(
+        const ConsoleRegistry* registry);
+
+    // render.mesh_lod.pixel_error and render.mesh_lod.hysteresis with their
+    // registration clamps applied. A null registry yields the registered
+    // defaults.
+    [[nodiscard]] MeshLodPolicy ReadMeshLodPolicy(const ConsoleRegistry* registry);
+
+    // asset.warm_cache.cpu_mib / gpu_mib, applied to `assets` as they change
+    // (and once now), plus asset.warm_cache.stats. Registered by whoever owns
+    // the AssetSystem, under owner "assets"; unregister that owner before the
+    // system is destroyed.
+    void RegisterAssetCVars(ConsoleRegistry& registry, AssetSystem& assets);
+
+    // The asset.warm_cache.* budget in bytes. A null registry, or one the
+    // cvars are not registered in, yields the registered defaults.
+    [[nodiscard]] AssetWarmCacheBudget ReadAssetWarmCacheBudget(
+        const ConsoleRegistry* registry);
+
     // render.profile.mode: writes the parsed mode into `pendingMode`; the
     // engine's frame latch applies it at the top of the next extract phase.
     // Registered only when render profiling is compiled in.
@@ -3,6 +3,7 @@
 #include <app/GameContexts.h>
 
 #include <cassert>
+#include <concepts>
 #include <queue>
 #include <typeindex>
 #include <unordered_map>
@@ -44,6 +45,15 @@ concept HasAudio = requires(T& t, AudioContext& ctx) { t.Audio(ctx); };
 template<typename T>
 concept HasEndFrame = requires(T& t, EndFrameContext& ctx) { t.EndFrame(ctx); };
 
+// Opt-in to resimulated ticks: `static constexpr bool Resimulated = true;`.
+// When a client replays ticks after a correction, RunFixedLogic and RunPhysics
+// dispatch only the systems that declare it. See FixedLogicContext for what a
+// system takes on by declaring it.
+template<typename T>
+concept IsResimulated = requires {
+    { T::Resimulated } -> std::convertible_to<bool>;
+} && T::Resimulated;
+
 template<typename T>
 concept IsScheduledSystem =
     HasZoneResidency<T> || HasPreSimulate<T> || HasFixedLogic<T> || HasPhysics<T>
@@ -100,6 +110,7 @@ private:
         void* Ptr = nullptr;
         void (*Fn)(void*, TContext&) = nullptr;
         std::vector<std::type_index> DependsOn;
+        bool Resimulated = false;
     };
 
     struct SystemRecord
@@ -114,6 +125,11 @@ private:
     template<typename TContext>
     static void Run(const std::vector<DispatchEntry<TContext>>& entries, TContext& ctx);
 
+    // A resimulated tick's dispatch: the opted-in entries, in the same order.
+    template<typename TContext>
+    static void RunResimulated(const std::vector<DispatchEntry<TContext>>& entries,
+                               TContext& ctx);
+
     template<typename TContext>
     static void TopoSort(std::vector<DispatchEntry<TContext>>& entries);
 
@@ -169,10 +185,12 @@ T& EngineSchedule::Register(Args&&... args)
             [](void* p, PreSimulateContext& ctx) { static_cast<T*>(p)->PreSimulate(ctx); }, {} });
     if constexpr (HasFixedLogic<T>)
         FixedLogicEntries.push_back({ std::type_index(typeid(T)), raw,
-            [](void* p, FixedLogicContext& ctx) { static_cast<T*>(p)->FixedLogic(ctx); }, {} });
+            [](void* p, FixedLogicContext& ctx) { static_cast<T*>(p)->FixedLogic(ctx); }, {},
+            IsResimulated<T> });
     if constexpr (HasPhysics<T>)
         PhysicsEntries.push_back({ std::type_index(typeid(T)), raw,
-            [](void* p, PhysicsContext& ctx) { static_cast<T*>(p)->Physics(ctx); }, {} });
+            [](void* p, PhysicsContext& ctx) { static_cast<T*>(p)->Physics(ctx); }, {},
+            IsResimulated<T> });
     if constexpr (HasPostFixed<T>)
         PostFixedEntries.push_back({ std::type_index(typeid(T)), raw,
             [](void* p, PostFixedContext& ctx) { static_cast<T*>(p)->PostFixed(ctx); }, {} });
@@ -228,6 +246,15 @@ void EngineSchedule::Run(const std::vector<DispatchEntry<TContext>>& entries, TC
         entry.Fn(entry.Ptr, ctx);
 }
 
+template<typename TContext>
+void EngineSchedule::RunResimulated(const std::vector<DispatchEntry<TContext>>& entries,
+                                    TContext& ctx)
+{
+    for (const auto& entry : entries)
+        if (entry.Resimulated)
+            entry.Fn(entry.Ptr, ctx);
+}
+
 template<typename TContext>
 void EngineSchedule::AddDependency(std::vector<DispatchEntry<TContext>>& entries,
                                    std::type_index tid,
@@ -102,6 +102,22 @@ struct PreSimulateContext
 // No InputFrame: simulation reads resolved actions from InputActionState, which
 // the mapper filled during PreSimulate. A fixed tick that read devices directly
 // would have no defined answer on a frame that ran several ticks.
+//
+// Resimulating marks a tick a client is running again after the authority
+// corrected its prediction: the tick already happened once, and its input is
+// the recorded one rather than anything a device says now. Only what is
+// predicted is rewound, so a resimulated tick dispatches only the systems that
+// declare `static constexpr bool Resimulated = true;` (EngineSchedule enforces
+// it); everything else ran once for the tick and does not run again.
+//
+// Declaring it is a promise about state nobody predicts: a replay leaves it as
+// the first run did. Deriving this tick's outputs afresh from inputs keeps it;
+// accumulating, spending, or starting something does not, and such work either
+// confines itself to Predicted or checks Resimulating and skips.
+//
+// Predicted names the entities the replay is for. Physics state is not rewound,
+// so stepping the whole scene again would hand every body nobody predicts extra
+// time; physics re-steps these and nothing else.
 struct FixedLogicContext
 {
     EngineConfig& Config;
@@ -109,6 +125,8 @@ struct FixedLogicContext
     FixedSimTime Time;
     World& Entities;
     const StoragePartitionSet& Partitions;
+    bool Resimulating = false;
+    std::span<const EntityId> Predicted{};
 };
 
 struct PhysicsContext
@@ -118,6 +136,8 @@ struct PhysicsContext
     FixedSimTime Time;
     World& Entities;
     const StoragePartitionSet& Partitions;
+    bool Resimulating = false;
+    std::span<const EntityId> Predicted{};
 };
 
 struct PostFixedContext
@@ -21,7 +21,10 @@
 // Contract, mirroring IAssetStager's stage half (Decision C):
 //   - Import is pure with respect to engine state: bytes in, artifacts out
 //     through the writer seam. No caches, no services, no logging — errors
-//     travel in ImportResult::Error and the driver logs them.
+//     travel in ImportResult::Error and the driver logs them. (A host may
+//     hand an importer a memo whose presence cannot change the output, as
+//     the texture importer's block cache; that is a throughput knob, not
+//     state the import depends on.)
 //   - Every artifact's FileRelPath must live under .cooked/; the driver
 //     rejects imports that write anywhere else.
 //   - One source may produce many artifacts (Decision B keys the cooked
@@ -92,6 +95,20 @@ public:
 
     [[nodiscard]] virtual ImportResult Import(const ImportInput& input,
                                               ICookOutputWriter& output) = 0;
+
+    // Imports several sources at once, one result per input in input order.
+    // The driver hands each importer its stale sources in batches so an
+    // importer whose work parallelizes across sources (texture compression)
+    // can split it over the whole batch; the default is one Import each.
+    [[nodiscard]] virtual std::vector<ImportResult> ImportBatch(std::span<const ImportInput> inputs,
+                                                                ICookOutputWriter& output)
+    {
+        std::vector<ImportResult> results;
+        results.reserve(inputs.size());
+        for (const ImportInput& input : inputs)
+            results.push_back(Import(input, output));
+        return results;
+    }
 };
 
 //=============================================================================
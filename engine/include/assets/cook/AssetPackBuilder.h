@@ -0,0 +1,93 @@
+#pragma once
+
+#include <core/assets/AssetPackFormat.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class AssetRegistry;
+class IAssetSource;
+
+//=============================================================================
+// .spak builder (docs/assets/pipeline.md, Decision I). Dev-only
+// (SENCHA_ENABLE_COOK).
+//
+// AssetPackWriter streams entries into the file as they are added -- a pack
+// of every asset in a project is never held in memory at once -- and writes
+// the table of contents and path strings on Finish, then patches the header
+// it reserved on Open. Entries land on Alignment boundaries so a raw one can
+// be read in place out of the mapping.
+//
+// Compression is per entry and kept only where it paid: below
+// MinCompressionSaving the raw bytes are stored instead, which is what keeps
+// already-compressed payloads (BC blocks, Ogg) viewable without a decode.
+//=============================================================================
+
+struct AssetPackBuildOptions
+{
+    uint32_t Alignment = kSpakDefaultAlignment;
+    bool Compress = true;
+
+    // Fraction of an entry's size compression has to save for the
+    // compressed form to be kept.
+    double MinCompressionSaving = 0.125;
+};
+
+struct AssetPackBuildStats
+{
+    std::size_t Entries = 0;
+    std::size_t Compressed = 0;
+    std::size_t Skipped = 0;
+    uint64_t RawBytes = 0;
+    uint64_t StoredBytes = 0;
+    uint64_t FileBytes = 0;
+};
+
+class AssetPackWriter
+{
+public:
+    explicit AssetPackWriter(AssetPackBuildOptions options = {});
+
+    AssetPackWriter(const AssetPackWriter&) = delete;
+    AssetPackWriter& operator=(const AssetPackWriter&) = delete;
+
+    [[nodiscard]] bool Open(const std::filesystem::path& packPath, std::string* error = nullptr);
+
+    // Appends one entry. A path added twice is rejected at Finish, where the
+    // sorted table makes duplicates adjacent.
+    [[nodiscard]] bool Add(std::string_view virtualPath, AssetType type,
+                           std::span<const std::byte> bytes, std::string* error = nullptr);
+
+    [[nodiscard]] bool Finish(std::string* error = nullptr);
+
+    [[nodiscard]] const AssetPackBuildStats& Stats() const { return BuildStats; }
+
+private:
+    [[nodiscard]] bool PadTo(uint64_t alignment);
+
+    AssetPackBuildOptions Options;
+    AssetPackBuildStats BuildStats;
+
+    std::ofstream Out;
+    uint64_t Cursor = 0;
+    std::vector<SpakEntry> Toc;
+    std::string Strings;
+    std::vector<std::byte> Scratch;
+};
+
+// Packs every file-backed record of `registry`, reading each through
+// `source` exactly as a loader would (ReadAssetBytes), keyed by virtual path.
+// Procedural records have no bytes and are left out; an unreadable record
+// fails the build rather than shipping a pack that silently lacks it.
+[[nodiscard]] bool BuildAssetPack(const AssetRegistry& registry,
+                                  IAssetSource& source,
+                                  const std::filesystem::path& packPath,
+                                  const AssetPackBuildOptions& options = {},
+                                  AssetPackBuildStats* stats = nullptr,
+                                  std::string* error = nullptr);
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <core/assets/AssetRegistryIndex.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+class AssetRegistry;
+
+//=============================================================================
+// .sreg builder (docs/assets/pipeline.md, Decision I). Dev-only
+// (SENCHA_ENABLE_COOK).
+//
+// Snapshots what a registry holds for one assets root -- after both scans,
+// RegisterCookedAssets, and ApplyAssetIds -- so the next start of a player
+// on that root can map it instead of repeating them. Only file-backed
+// records whose file lies under the root are written: a registry mounted
+// over several roots yields one index per root, and procedural records are
+// registered by code at every start anyway.
+//
+// The file is written beside the target and renamed over it, so a player
+// that maps the old index while the cook rewrites it keeps a whole file.
+//=============================================================================
+
+struct AssetRegistryIndexBuildStats
+{
+    std::size_t Entries = 0;
+    std::size_t WithIds = 0;
+    std::size_t Skipped = 0; // procedural, or under another root
+    uint64_t FileBytes = 0;
+};
+
+[[nodiscard]] bool WriteAssetRegistryIndex(const AssetRegistry& registry,
+                                           std::string_view assetsRoot,
+                                           const std::filesystem::path& indexPath,
+                                           AssetRegistryIndexBuildStats* stats = nullptr,
+                                           std::string* error = nullptr);
@@ -81,10 +81,12 @@ struct CookedSourceEntry
 // (lightmap UVs replaced the baked-direct vertex channel; per-zone atlas
 // artifacts). Version 6: lightmap atlases moved from RGBM RGBA8 to RGB9E5
 // (texels decode before filtering; the shader no longer applies a
-// multiplier, so older atlases would render wrong). A per-importer cook
-// version is the finer-grained eventual replacement if bumps become
-// frequent.
-inline constexpr uint32_t kCookedCacheIndexVersion = 7;
+// multiplier, so older atlases would render wrong). Version 8: .smesh moved
+// to v6 and the glTF cook writes GPU-ordered, quantized meshes. Version 9:
+// .smesh moved to v7; the glTF cook writes LOD chains. Version 10: .smesh
+// moved to v8; the glTF cook writes meshlets. A per-importer cook version is
+// the finer-grained eventual replacement if bumps become frequent.
+inline constexpr uint32_t kCookedCacheIndexVersion = 10;
 
 class CookedCacheIndex
 {
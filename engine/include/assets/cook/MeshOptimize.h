@@ -0,0 +1,47 @@
+#pragma once
+
+#include <render/skinned_mesh/SkinnedMeshData.h>
+#include <render/static_mesh/MeshGeometry.h>
+
+#include <cstdint>
+#include <span>
+
+//=============================================================================
+// GPU-order mesh optimization (docs/assets/pipeline.md, Decision M). Dev-only
+// (SENCHA_ENABLE_COOK), pure.
+//
+// Three passes, each within one section so material slots, index ranges and
+// vertex ranges stay where they were. The first two run over each LOD range
+// of the section as well as its base range:
+//   1. Vertex-cache order: Tom Forsyth's linear-speed greedy ordering, so a
+//      post-transform cache re-uses shaded vertices instead of re-running
+//      the vertex shader for them.
+//   2. Overdraw order: the cache-ordered triangles are cut into clusters at
+//      points that cost the cache little, and clusters facing away from the
+//      section's centre are drawn first (Sander, Nehab and Barczak) -- the
+//      outer shell early, so depth rejects what it hides.
+//   3. Vertex-fetch order: vertices renumbered in first-use order, so the
+//      base index stream walks the vertex buffer forwards. Skipped when
+//      sections share vertices, since renumbering one would scramble the
+//      other.
+//
+// Skinning influences follow their vertices. Geometry is unchanged: the same
+// triangles, winding included, over the same vertices.
+//=============================================================================
+
+struct MeshOptimizeStats
+{
+    // Average vertex-shader invocations per triangle through a 16-entry FIFO
+    // cache (ComputeVertexCacheAcmr), over the whole index stream.
+    double AcmrBefore = 0.0;
+    double AcmrAfter = 0.0;
+    bool FetchReordered = false;
+};
+
+MeshOptimizeStats OptimizeMeshForGpu(MeshGeometry& mesh, MeshSkinning* skinning = nullptr);
+
+// Average cache miss ratio of a triangle list through a FIFO cache of
+// `cacheSize` entries: 3.0 is no reuse at all, 0.5 the limit of a regular
+// grid.
+[[nodiscard]] double ComputeVertexCacheAcmr(std::span<const uint32_t> indices,
+                                            uint32_t cacheSize = 16);
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <render/static_mesh/MeshGeometry.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+//=============================================================================
+// Mesh LOD generation (docs/assets/pipeline.md, Decision M). Dev-only
+// (SENCHA_ENABLE_COOK), pure.
+//
+// Quadric-error edge collapse (Garland and Heckbert), restricted to
+// half-edge collapses: a vertex only ever moves onto one of its neighbours,
+// so every level indexes the section's existing vertices and adds none.
+// Each vertex carries the area-weighted plane quadric of the triangles
+// around it; a collapse costs the mean squared distance its quadric
+// measures at the destination, and the square root of the worst collapse
+// taken is the level's error.
+//
+// What must not move stays put:
+//   - positions shared by several vertices (UV or normal seams), since one
+//     wedge cannot follow another's attributes;
+//   - positions shared with another section, so sections drawn at
+//     different levels never open cracks between them;
+//   - non-manifold corners.
+// Open borders only collapse along themselves, held by border planes.
+// Collapses that would flip a triangle or pinch the surface are refused.
+//=============================================================================
+
+struct MeshLodSettings
+{
+    // Coarser levels per section, at most kMaxMeshLods.
+    uint32_t MaxLods = 4;
+    // Each level aims for this fraction of the level before it.
+    float TriangleRatio = 0.5f;
+    // Error budget as a fraction of the section's bounds diagonal: no
+    // collapse beyond it is taken, so the chain ends where it runs out.
+    float MaxRelativeError = 0.02f;
+    // A level must drop at least this fraction of the level before it;
+    // one that cannot is not worth its index bytes and ends the chain.
+    float MinReduction = 0.15f;
+    // Sections with fewer triangles get no chain.
+    uint32_t MinTriangles = 32;
+};
+
+// Simplifies the triangles `indices` over `vertices` toward
+// `targetIndexCount` indices without exceeding `maxError` (mesh units).
+// Returns the surviving triangles; `outError`, when non-null, receives the
+// error actually introduced.
+[[nodiscard]] std::vector<uint32_t> SimplifyTriangles(std::span<const StaticMeshVertex> vertices,
+                                                      std::span<const uint32_t> indices,
+                                                      std::size_t targetIndexCount,
+                                                      float maxError,
+                                                      float* outError = nullptr);
+
+// Builds each section's LOD chain: successive levels at TriangleRatio of
+// the one before, each simplified further from the last, appended after the
+// existing index data and recorded in StaticMeshSection::Lods. Sections
+// that already carry a chain are left alone. Returns the levels built.
+uint32_t GenerateMeshLods(MeshGeometry& mesh, const MeshLodSettings& settings = {});
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <render/static_mesh/MeshGeometry.h>
+
+#include <cstdint>
+
+//=============================================================================
+// Meshlet build (docs/assets/pipeline.md, Decision M). Dev-only
+// (SENCHA_ENABLE_COOK), pure.
+//
+// Cuts each section's base triangles into meshlets of at most MaxVertices
+// distinct vertices and MaxTriangles triangles, reorders the base range so
+// every meshlet is a contiguous slice of it, and records the slices with
+// their bounds in StaticMeshSection::Meshlets for the per-view culling in
+// MeshletCulling.h.
+//
+// Greedy growth: a meshlet starts at the first unclaimed triangle in the
+// section's current order and takes, one at a time, the unclaimed triangle
+// touching it that adds the fewest new vertices, breaking ties toward the
+// meshlet's centre and its average facing. Triangles touch when they share
+// a position, so UV and normal seams do not split a meshlet. Seeding in the
+// existing order keeps most of the vertex-cache ordering OptimizeMeshForGpu
+// produced; the build runs after it.
+//
+// Each meshlet's sphere is centred on its vertices' box. Its cone holds the
+// geometric normals of its triangles, wound as the rasterizer sees them;
+// degenerate triangles face nowhere and are left out. A meshlet whose
+// normals spread past a hemisphere records no cone.
+//
+// Only the base range is clustered: LOD ranges draw whole. Sections that
+// already carry meshlets are left alone. The same triangles, winding
+// included, stay in the same section.
+//=============================================================================
+
+struct MeshletLimits
+{
+    // 64 vertices and 124 triangles: the sizes mesh-shading hardware favours,
+    // and small enough that a meshlet's cone stays usefully narrow.
+    uint32_t MaxVertices = 64;
+    uint32_t MaxTriangles = 124;
+};
+
+// Returns the meshlets built across all sections.
+uint32_t BuildMeshlets(MeshGeometry& mesh, const MeshletLimits& limits = {});
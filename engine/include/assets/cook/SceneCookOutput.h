@@ -2,11 +2,14 @@
 
 #include <filesystem>
 #include <functional>
+#include <optional>
 #include <span>
 #include <string>
 #include <string_view>
 
-class JsonValue;
+#include <core/json/JsonValue.h>
+
+class ComponentSerializerRegistry;
 
 //=============================================================================
 // Shared cooked-scene output (docs/assets/pipeline.md Decisions A/D;
@@ -23,7 +26,11 @@ class JsonValue;
 //   2. Maintains the persisted AssetIdMap: first-sight mint, rename inheritance
 //      by content hash. A broken existing map is an error, never a silent
 //      re-mint (that would lose rename history).
-//   3. Writes the manifest and the id-stamped cooked scene.
+//   3. Writes the manifest and the cooked scene. The scene is binary
+//      (TranscodeSceneJsonToBinary through `serializers`), each ref carrying
+//      the id the map gives it. Callers name it with CookedSceneSuffix
+//      (.cooked.sscn); runtime loaders still tell the forms apart with
+//      IsBinaryScene.
 //
 // asset:// -> physical resolution is a caller seam (`physicalPathFor`): the
 // CubeDemo maps asset://x to root/x, but the level cook's Generated meshes live
@@ -32,9 +39,19 @@ class JsonValue;
 //=============================================================================
 [[nodiscard]] bool WriteCookedScene(
     const JsonValue& cookedScene,
+    const ComponentSerializerRegistry& serializers,
     std::span<const std::string> extraRefs,
     const std::function<std::filesystem::path(std::string_view)>& physicalPathFor,
     const std::filesystem::path& idMapPath,
     const std::filesystem::path& manifestPath,
     const std::filesystem::path& cookedScenePath,
     std::string* error = nullptr);
+
+// A cooked scene read back as the JSON the cook assembled, whichever form is on
+// disk: binary goes through TranscodeSceneBinaryToJson, a JSON file (an older
+// cook, or a hand edit) is parsed. For tools and tests that inspect a cook's
+// output; runtime loaders build zone packages from the binary directly.
+[[nodiscard]] std::optional<JsonValue> ReadCookedSceneJson(
+    const std::filesystem::path& cookedScenePath,
+    const ComponentSerializerRegistry& serializers,
+    std::string* error = nullptr);
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+//=============================================================================
+// TextureBlockCache. Dev-only, compiled under SENCHA_ENABLE_COOK.
+//
+// Content-addressed memo of compressed texture blocks: the key is a hash of
+// one gathered 4x4 RGBA block (seeded by the encoder and its settings), the
+// value the block's compressed bytes. An edited texture recooks every mip
+// level, but an edit is local: the blocks it did not touch hash the same as
+// last time at every level and skip the encoder. Identical blocks across
+// textures (flat fills, tiled trims) share one entry.
+//
+// Only the slow encoder's output is worth remembering (BC7; the rgbcx BC4/BC5
+// encoders run about as fast as the hash), so the cook consults the cache for
+// BC7 blocks alone.
+//
+// A memo, not a source of truth: the cooked bytes are identical with or
+// without it, and deleting the file at any time is safe. Bounded: past
+// MaxBlocks, the oldest entries are overwritten first.
+//
+// Find is safe to call concurrently (the cook's block jobs do); Insert,
+// Load and Save are owner-thread and must not overlap a Find.
+//=============================================================================
+
+// "<assets-root>/.cooked/texture_blocks.cache". Under .cooked so the source
+// scan never walks it; an extension no asset kind claims so the cooked scan
+// never registers it.
+inline constexpr std::string_view kTextureBlockCacheFileName = "texture_blocks.cache";
+
+class TextureBlockCache
+{
+public:
+    // Compressed bytes per block: the BC7/BC5 size. BC4's 8-byte blocks
+    // would fit with padding, but BC4 never reaches the cache.
+    static constexpr std::size_t kBlockBytes = 16;
+
+    // About 4M blocks: a 4K texture's full chain is 1.4M, so a handful of
+    // 4K sets stay warm. 96 MiB on disk at the cap.
+    static constexpr std::size_t kDefaultMaxBlocks = std::size_t(1) << 22;
+
+    explicit TextureBlockCache(std::size_t maxBlocks = kDefaultMaxBlocks);
+
+    // Copies the bytes stored under `key` into `out` (kBlockBytes). False,
+    // leaving `out` untouched, when the key is absent.
+    [[nodiscard]] bool Find(uint64_t key, std::span<uint8_t, kBlockBytes> out) const;
+
+    // Stores or refreshes `key`. Past MaxBlocks, evicts the oldest entry.
+    void Insert(uint64_t key, std::span<const uint8_t, kBlockBytes> block);
+
+    [[nodiscard]] std::size_t Size() const { return Index.size(); }
+    [[nodiscard]] std::size_t MaxBlocks() const { return Capacity; }
+
+    // True once an Insert happened since the last Load or Save.
+    [[nodiscard]] bool IsDirty() const { return Dirty; }
+
+    // A missing file is an empty cache, not an error; a malformed one is an
+    // error (and leaves the cache empty) so a caller can log and carry on cold.
+    [[nodiscard]] bool LoadFromFile(const std::filesystem::path& path, std::string* error = nullptr);
+
+    // Writes oldest to newest through a sibling temp and a rename.
+    [[nodiscard]] bool SaveToFile(const std::filesystem::path& path, std::string* error = nullptr);
+
+private:
+    struct Entry
+    {
+        uint64_t Key = 0;
+        uint8_t Bytes[kBlockBytes]{};
+    };
+
+    std::size_t Capacity = 0;
+    // Ring of entries once full: Oldest is the next slot to overwrite.
+    std::vector<Entry> Entries;
+    std::size_t Oldest = 0;
+    std::unordered_map<uint64_t, uint32_t> Index;
+    bool Dirty = false;
+};
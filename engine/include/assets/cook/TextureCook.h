@@ -1,14 +1,18 @@
 #pragma once
 
 #include <assets/cook/AssetImporter.h>
+#include <assets/cook/TextureImportSettings.h>
 #include <render/TextureData.h>
 
+#include <cstdint>
+#include <span>
 #include <string>
 #include <string_view>
 
 struct Image;
 class JobSystem;
 class LoggingProvider;
+class TextureBlockCache;
 
 //=============================================================================
 // Texture cook (docs/assets/pipeline.md, Decisions B, E, L). Dev-only —
@@ -24,6 +28,13 @@ class LoggingProvider;
 // LinearData also cooks to BC7 for now: PNG decode always yields RGBA, so
 // the "BC4 by channel count" half of the table waits for a source format
 // that actually carries channel count.
+//
+// Compression is the cost. A batch (CookTexturesBatch) filters every
+// texture's chain first, then splits the blocks of every level of every
+// texture into one flat list of equal-sized jobs, so a 4K base level and a
+// texture set's 1x1 tails keep the whole pool busy together instead of one
+// image, one level at a time. A TextureBlockCache, when supplied, skips the
+// encoder for any block it has seen before.
 //=============================================================================
 
 // Usage from the source file's stem suffix, the cook-side authoring
@@ -41,11 +52,13 @@ class LoggingProvider;
 // Pure; errors travel in `error`. `jobs` forks the per-row work when given;
 // rows write disjoint output, so the pooled result is byte-identical to
 // serial (null runs serial).
+// `kernel` picks the downsampling filter (TextureMipKernel).
 [[nodiscard]] bool BuildTextureMipChainRgba8(const Image& image,
                                              TextureUsage usage,
                                              TextureData& out,
                                              std::string* error = nullptr,
-                                             JobSystem* jobs = nullptr);
+                                             JobSystem* jobs = nullptr,
+                                             TextureMipKernel kernel = TextureMipKernel::Box);
 
 // Decoded image + usage → full mip chain TextureData, BC-compressed per
 // CookedFormatForUsage. Pure; errors travel in `error`.
@@ -65,17 +78,69 @@ struct TextureCookParams
     TextureFilter Filter = TextureFilter::Linear;
     bool Compress = true;
     bool GenerateMips = true;
+    TextureMipKernel MipKernel = TextureMipKernel::Box;
 
     // Optional pool for the per-row filter and block-compression loops.
     // Rows and blocks write disjoint output, so the cooked bytes are
     // identical with or without it; null runs serial.
     JobSystem* Jobs = nullptr;
+
+    // Optional memo of compressed blocks (TextureBlockCache). Like Jobs, a
+    // pure throughput knob: the cooked bytes do not depend on it.
+    TextureBlockCache* BlockCache = nullptr;
 };
 [[nodiscard]] bool CookImageToTexture(const Image& image,
                                       const TextureCookParams& params,
                                       TextureData& out,
                                       std::string* error = nullptr);
 
+// Throughput of one or more batches. Pixels counts every cooked mip level
+// (a full chain is ~4/3 of its base), so MegapixelsPerSecond compares
+// directly across textures of different shapes.
+struct TextureCookStats
+{
+    uint32_t Textures = 0;
+    uint64_t Pixels = 0;
+    uint64_t BlocksEncoded = 0;
+    uint64_t BlocksFromCache = 0;
+    double Seconds = 0.0;
+
+    [[nodiscard]] double MegapixelsPerSecond() const
+    {
+        return Seconds > 0.0 ? static_cast<double>(Pixels) / 1.0e6 / Seconds : 0.0;
+    }
+
+    void Accumulate(const TextureCookStats& other)
+    {
+        Textures += other.Textures;
+        Pixels += other.Pixels;
+        BlocksEncoded += other.BlocksEncoded;
+        BlocksFromCache += other.BlocksFromCache;
+        Seconds += other.Seconds;
+    }
+};
+
+// One texture of a batch: the source and its params in, the cooked texture
+// or an error out. Params.Jobs and Params.BlockCache are ignored; the batch
+// supplies its own.
+struct TextureCookBatchEntry
+{
+    const Image* Source = nullptr;
+    TextureCookParams Params{};
+
+    TextureData Result{};
+    std::string Error{};
+};
+
+// Cooks every entry, with one block-level job split across all of them.
+// Each entry's Result is byte-identical to CookImageToTexture on its own.
+// Returns false when any entry failed; the others still cook. `stats`, when
+// given, accumulates this batch.
+[[nodiscard]] bool CookTexturesBatch(std::span<TextureCookBatchEntry> entries,
+                                     JobSystem* jobs = nullptr,
+                                     TextureBlockCache* blockCache = nullptr,
+                                     TextureCookStats* stats = nullptr);
+
 //=============================================================================
 // PngTextureImporter — .png → cooked .stex.
 //
@@ -87,10 +152,13 @@ struct TextureCookParams
 class PngTextureImporter final : public IAssetImporter
 {
 public:
-    // `jobs` rides into every cook this importer performs (see
-    // TextureCookParams::Jobs); null cooks serial.
-    explicit PngTextureImporter(JobSystem* jobs = nullptr)
+    // `jobs` and `blockCache` ride into every cook this importer performs
+    // (see TextureCookParams); null cooks serial and uncached. The host owns
+    // the cache and decides when to persist it.
+    explicit PngTextureImporter(JobSystem* jobs = nullptr,
+                                TextureBlockCache* blockCache = nullptr)
         : Jobs(jobs)
+        , BlockCache(blockCache)
     {
     }
 
@@ -98,6 +166,15 @@ public:
     [[nodiscard]] ImportResult Import(const ImportInput& input,
                                       ICookOutputWriter& output) override;
 
+    // Decodes every source, then cooks them as one CookTexturesBatch.
+    [[nodiscard]] std::vector<ImportResult> ImportBatch(std::span<const ImportInput> inputs,
+                                                        ICookOutputWriter& output) override;
+
+    // Everything this importer has cooked so far, for the host to report.
+    [[nodiscard]] const TextureCookStats& Stats() const { return CookStats; }
+
 private:
     JobSystem* Jobs = nullptr;
+    TextureBlockCache* BlockCache = nullptr;
+    TextureCookStats CookStats;
 };
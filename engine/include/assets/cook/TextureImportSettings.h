@@ -4,6 +4,7 @@
 #include <render/TextureData.h>
 
 #include <cstddef>
+#include <cstdint>
 #include <span>
 #include <string>
 #include <string_view>
@@ -23,10 +24,20 @@
 //     "usage": "base_color" | "normal" | "orm" | "emissive" | "linear_data",
 //     "filter": "linear" | "nearest",
 //     "compress": true | false,
-//     "mips": true | false
+//     "mips": true | false,
+//     "mip_filter": "box" | "kaiser"
 //   }
 //=============================================================================
 
+// Downsampling kernel for generated mips. Box is the 2x2 average; Kaiser is
+// a windowed sinc over six destination texels that keeps detail the box
+// blurs away, at the cost of slight ringing on hard edges.
+enum class TextureMipKernel : uint8_t
+{
+    Box,
+    Kaiser,
+};
+
 struct TextureImportSettings
 {
     // Unknown = infer from the filename suffix convention
@@ -37,6 +48,7 @@ struct TextureImportSettings
     // crisp texels, which point sampling then faithfully magnifies).
     bool Compress = true;
     bool GenerateMips = true;
+    TextureMipKernel MipKernel = TextureMipKernel::Box;
 
     bool operator==(const TextureImportSettings&) const = default;
 };
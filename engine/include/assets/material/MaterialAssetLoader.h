@@ -37,6 +37,10 @@ public:
 
     [[nodiscard]] AssetStaging LoadStaged(const AssetRecord& record,
                                           IAssetSource& source) override;
+    [[nodiscard]] bool DecodesFromView() const override { return true; }
+    [[nodiscard]] AssetStaging DecodeStaged(const AssetRecord& record,
+                                            const AssetBytes& bytes,
+                                            std::stop_token stop) override;
 
     // Owner-thread commit returning the typed handle (refcount 1, owned by
     // the caller). The virtual Commit wraps this for heterogeneous drivers.
@@ -2,9 +2,12 @@
 
 #include <assets/material/MaterialFormat.h>
 
+#include <cstddef>
+#include <span>
 #include <string>
 #include <string_view>
 
+class IAssetSource;
 class JsonValue;
 
 struct MaterialParseError
@@ -26,6 +29,19 @@ struct MaterialParseError
                                      MaterialDescription& out,
                                      MaterialParseError* error = nullptr);
 
+// Parse .smat bytes as read from an asset source. The JSON is parsed in
+// place; the bytes are not copied into a string first.
+[[nodiscard]] bool ParseMaterialBytes(std::span<const std::byte> bytes,
+                                      MaterialDescription& out,
+                                      MaterialParseError* error = nullptr);
+
+// Read + parse a .smat file through `source` (ReadView, so a pack-backed
+// source hands back its mapping rather than a copy).
+[[nodiscard]] bool LoadMaterialFromSource(IAssetSource& source,
+                                          std::string_view path,
+                                          MaterialDescription& out,
+                                          MaterialParseError* error = nullptr);
+
 // Read + parse a .smat file from disk.
 [[nodiscard]] bool LoadMaterialFromFile(std::string_view path,
                                         MaterialDescription& out,
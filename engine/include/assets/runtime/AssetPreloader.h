@@ -5,19 +5,22 @@
 #include <core/assets/AssetRegistry.h>
 #include <core/assets/AssetStager.h>
 #include <core/logging/Logger.h>
+#include <jobs/AsyncTaskQueue.h>
 
+#include <chrono>
 #include <cstdint>
 #include <functional>
 #include <memory>
 #include <span>
+#include <stop_token>
 #include <string>
 #include <string_view>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
+class AssetPreloader;
 class AssetSystem;
-class AsyncTaskQueue;
 class LoggingProvider;
 
 //=============================================================================
@@ -37,6 +40,18 @@ class LoggingProvider;
 // Failures are advisory: a failed asset still counts toward completion, and
 // the consumer's synchronous fallback (resolve-on-attach) covers the gap.
 // Preload is an optimization; correctness never depends on it.
+//
+// Every load the preload starts shares its priority cell, so SetPriority
+// reorders the ones still waiting for a task thread: the zone that just
+// became the focus overtakes the neighbors that were speculative a moment
+// ago. A load another preload already started keeps that preload's priority.
+// The deadline cell is shared the same way; the zone loader sets it from the
+// zone's demand (AsyncZoneLoader::SetLoadDeadline).
+//
+// Cancel also stops the loads nobody else wants any more: a load whose every
+// interested preload is cancelled has its stop requested, and a decode still
+// running returns at its next check instead of finishing work that would be
+// released on commit.
 //=============================================================================
 class AssetPreload
 {
@@ -54,6 +69,15 @@ public:
     {
         return static_cast<uint32_t>(HeldAssets.size());
     }
+    [[nodiscard]] AsyncTaskPriority GetPriority() const { return Priority->load(); }
+
+    void SetPriority(AsyncTaskPriority priority) { Priority->store(priority); }
+
+    [[nodiscard]] std::chrono::steady_clock::time_point GetDeadline() const
+    {
+        return Deadline->load();
+    }
+    void SetDeadline(std::chrono::steady_clock::time_point deadline) { Deadline->store(deadline); }
 
     // Runs once, on the owner thread, when the last pending asset commits —
     // or immediately, if the preload is already complete. One slot; the zone
@@ -65,8 +89,9 @@ public:
 
     // Stops collecting: held leases release now, later commits release their
     // reference immediately instead of storing it, OnComplete is dropped.
-    // Pending bookkeeping continues so the preloader's accounting stays
-    // consistent.
+    // Loads only this preload wanted are stopped; they still commit (as
+    // failures), so pending bookkeeping continues and the preloader's
+    // accounting stays consistent.
     void Cancel();
 
 private:
@@ -85,6 +110,11 @@ private:
     uint32_t Pending = 0;
     uint32_t Failures = 0;
     bool Cancelled = false;
+    // Set by Begin; reached only while loads are pending, which the
+    // preloader outlives.
+    AssetPreloader* Owner = nullptr;
+    AsyncTaskPriorityCell Priority = MakeAsyncTaskPriority(AsyncTaskPriority::Normal);
+    AsyncTaskDeadlineCell Deadline = MakeAsyncTaskDeadline();
     std::function<void()> OnComplete;
     std::vector<AssetLease> HeldAssets;
 };
@@ -97,6 +127,11 @@ private:
 // coalesce against loads already in flight, LoadStaged on task threads,
 // commit at the drain point.
 //
+// A stager that decodes from a read view is submitted split: the read on the
+// queue's I/O pool, DecodeStaged on its compute pool (see AsyncTaskQueue), so
+// a manifest's reads and decodes overlap across as many threads as the queue
+// has. Any other stager runs LoadStaged whole on the compute pool.
+//
 // Commit order follows AssetStaging::Dependencies. A staged payload whose
 // dependencies are not resident waits; its dependencies are requested through
 // this same path and it commits once they land — so a material's commit finds
@@ -108,6 +143,13 @@ private:
 // Dependency edges are checked for cycles before they are recorded, so a
 // mutually-referencing pair fails both loads instead of deadlocking.
 //
+// Every submitted load carries a stop token. The preloader requests the stop
+// once no live preload wants the load, directly or through a parent waiting
+// on it; the queue task still runs, so the failed staging commits through
+// the usual path and coalesced waiters are never stranded. A preload that
+// joins a load already stopped gets a failure, which its sync fallback
+// covers.
+//
 // Owner-thread only. The preloader must outlive any preload it has in
 // flight (same contract as AsyncZoneLoader).
 //=============================================================================
@@ -122,7 +164,9 @@ public:
     // Begins async residency for `paths` (typically a manifest). Unknown
     // paths and unsupported types count as failures, not errors — the
     // consumer's sync fallback covers them. Never returns null.
-    [[nodiscard]] std::shared_ptr<AssetPreload> Begin(std::span<const std::string> paths);
+    [[nodiscard]] std::shared_ptr<AssetPreload> Begin(
+        std::span<const std::string> paths,
+        AsyncTaskPriority priority = AsyncTaskPriority::Normal);
 
 private:
     // Who is waiting on one in-flight load: a preload directly, or a parent
@@ -135,6 +179,18 @@ private:
         [[nodiscard]] bool IsDependency() const { return !ParentPath.empty(); }
     };
 
+    // The stop of one submitted load and who still wants it. Pointers are
+    // non-owning: each is also a waiter in InFlight until the load completes,
+    // which is when this entry goes.
+    struct LoadStop
+    {
+        std::stop_source Source;
+        std::vector<const AssetPreload*> Preloads;
+        std::vector<std::string> Parents;
+        // A waiter with neither a preload nor a parent; never stopped.
+        bool Pinned = false;
+    };
+
     // A staged payload held back until its declared dependencies are resident.
     // The leases keep those dependencies alive across the gap between their
     // commit and this one.
@@ -142,6 +198,9 @@ private:
     {
         AssetType Type = AssetType::Unknown;
         AssetStaging Staging;
+        // Inherited by the dependency loads this commit waits on.
+        AsyncTaskPriorityCell Priority;
+        AsyncTaskDeadlineCell Deadline;
         std::vector<AssetLease> DependencyLeases;
         uint32_t PendingDependencies = 0;
         bool DependencyFailed = false;
@@ -149,9 +208,19 @@ private:
 
     [[nodiscard]] bool CanStage(const AssetRecord& record) const;
 
+    [[nodiscard]] AsyncTaskPriorityCell PriorityFor(const LoadWaiter& waiter) const;
+    [[nodiscard]] AsyncTaskDeadlineCell DeadlineFor(const LoadWaiter& waiter) const;
+
     void RequestLoad(const AssetRecord& record, LoadWaiter waiter);
-    void SubmitStagedLoad(const AssetRecord& record);
-    void OnAssetStaged(AssetType type, const std::string& path, AssetStaging&& staging);
+    void SubmitStagedLoad(const AssetRecord& record,
+                          AsyncTaskPriorityCell priority,
+                          AsyncTaskDeadlineCell deadline,
+                          std::stop_token stop);
+    void OnAssetStaged(AssetType type,
+                       const std::string& path,
+                       AssetStaging&& staging,
+                       AsyncTaskPriorityCell priority,
+                       AsyncTaskDeadlineCell deadline);
     void OnDependencyFinished(const std::string& parentPath,
                               AssetLease dependency,
                               bool failed);
@@ -162,6 +231,11 @@ private:
                  const std::string& path,
                  bool failed);
 
+    friend class AssetPreload;
+    void OnPreloadCancelled();
+    [[nodiscard]] bool IsWanted(const std::string& path,
+                                std::unordered_set<std::string>& visited) const;
+
     [[nodiscard]] bool WouldCreateCycle(std::string_view parent,
                                         std::string_view dependency) const;
     [[nodiscard]] bool Reaches(std::string_view from,
@@ -175,6 +249,7 @@ private:
     AssetInFlightTable<LoadWaiter> InFlight;
     std::unordered_map<std::string, PendingCommit> PendingCommits;
     std::unordered_map<std::string, std::vector<std::string>> DependencyEdges;
+    std::unordered_map<std::string, LoadStop> Stops;
 
     // Preloads whose last pending asset landed during the drain currently
     // running. Completion callbacks fire after the delivery walk finishes, so
@@ -139,11 +139,29 @@ public:
     void ReleaseSkeleton(SkeletonHandle handle);
     void ReleaseAnimationClip(AnimationClipHandle handle);
 
+    // Another reference to a handle the caller already holds, paired with the
+    // Release above. The binary scene load hands each field its own reference
+    // to an asset its SceneAssetTable resolved once.
+    void RetainStaticMesh(StaticMeshHandle handle);
+    void RetainMaterial(MaterialHandle handle);
+    void RetainTexture(TextureHandle handle);
+    void RetainAudioClip(AudioClipHandle handle);
+
     // Type-erased residency, for drivers that hold a reference without naming
     // the handle type. Invalid lease when the kind is unregistered or the
     // asset is not resident; never loads.
     [[nodiscard]] AssetLease TryAcquireLease(std::string_view path, AssetType type);
 
+    // Applies `budget` to the warm cache of every registered kind's store;
+    // each kind parks up to the full budget on its own. A kind registered
+    // later starts without one until this is called again.
+    void SetWarmCacheBudget(const AssetWarmCacheBudget& budget);
+    [[nodiscard]] const AssetWarmCacheBudget& GetWarmCacheBudget() const { return WarmBudget; }
+
+    // Empty stats for an unregistered kind or one whose store keeps no warm
+    // cache.
+    [[nodiscard]] AssetWarmCacheStats GetWarmCacheStats(AssetType type) const;
+
     // Owner-thread commit of a staged payload, dispatched through the kind's
     // registered Commit. Returns the creation reference.
     [[nodiscard]] AssetLease Commit(AssetStaging&& staged);
@@ -152,7 +170,15 @@ public:
     // preloader runs LoaderFor(type)->LoadStaged on a task thread against
     // DefaultSource(), and commits at the drain point.
     [[nodiscard]] IAssetStager* LoaderFor(AssetType type);
-    [[nodiscard]] IAssetSource& DefaultSource() { return Source; }
+    [[nodiscard]] IAssetSource& DefaultSource() { return Mounted != nullptr ? *Mounted : Source; }
+
+    // Routes every load through `source` instead of loose files -- a mounted
+    // .spak, typically, with FileSource() as its fallback. Null restores the
+    // file source. Not owned; it must outlive the system or be unmounted.
+    // Mount before the first load: a preload in flight keeps whichever source
+    // it started with.
+    void MountSource(IAssetSource* source) { Mounted = source; }
+    [[nodiscard]] IAssetSource& FileSource() { return Source; }
 
     // The registered outer kinds. Scanning, preload, and hot reload read this
     // instead of carrying their own switch over AssetType. Mutable so a game
@@ -185,6 +211,8 @@ private:
     SkinnedMeshCache* SkinnedMeshes = nullptr;
 
     FileAssetSource Source;
+    IAssetSource* Mounted = nullptr;
+    AssetWarmCacheBudget WarmBudget;
     StaticMeshAssetLoader MeshLoader;
     TextureAssetLoader TexLoader;
     MaterialAssetLoader MatLoader;
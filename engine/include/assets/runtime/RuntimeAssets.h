@@ -9,7 +9,9 @@
 #include <core/metadata/DataSchema.h>
 #include <input/InputProfileData.h>
 #include <movement/MovementProfileData.h>
+#include <core/assets/AssetPackSource.h>
 #include <core/assets/AssetRegistry.h>
+#include <core/assets/AssetRegistryIndex.h>
 #include <assets/runtime/AssetSystem.h>
 #include <graphics/vulkan/TextureCache.h>
 #include <render/MaterialCache.h>
@@ -30,6 +32,10 @@ class VulkanSamplerCache;
 //   Skeletons is declared before all three, destroyed after them, Stage 5).
 struct RuntimeAssets
 {
+    // The cook's .sreg, when the game opens one and mounts it on Registry in
+    // place of walking the assets root. Declared first so it outlives the
+    // registry that reads from it.
+    AssetRegistryIndex RegistryIndex;
     AssetRegistry Registry;
     TextureCache Textures;
     MaterialCache Materials;
@@ -52,12 +58,18 @@ struct RuntimeAssets
 
     AssetSystem Assets;
 
+    // The shipping build's .spak, when the game opens one and mounts it on
+    // Assets; loose files stay reachable through the fallback. Declared
+    // after Assets because it borrows Assets' file source.
+    AssetPackSource Pack;
+
     RuntimeAssets(LoggingProvider& logging,
                   VulkanBufferService& buffers,
                   VulkanImageService& images,
                   VulkanDescriptorCache& descriptors,
                   VulkanSamplerCache& samplers)
-        : Registry(logging)
+        : RegistryIndex()
+        , Registry(logging)
         , Textures(logging, images, descriptors, samplers)
         , Materials()
         , MaterialSets(&Materials)
@@ -72,6 +84,7 @@ struct RuntimeAssets
         , DataLoader(logging, &DataTypes, &DataSchemas, &DataAssets)
         , Assets(logging, Registry, StaticMeshes, Materials, Textures, AudioClips,
                  Skeletons, AnimationClips, SkinnedMeshes, MaterialSets)
+        , Pack(&Assets.FileSource())
     {
         // Unregistering a subtype with values still resident would leave the
         // cache holding a value nothing can interpret.
@@ -22,6 +22,10 @@ public:
 
     [[nodiscard]] AssetStaging LoadStaged(const AssetRecord& record,
                                           IAssetSource& source) override;
+    [[nodiscard]] bool DecodesFromView() const override { return true; }
+    [[nodiscard]] AssetStaging DecodeStaged(const AssetRecord& record,
+                                            const AssetBytes& bytes,
+                                            std::stop_token stop) override;
 
     [[nodiscard]] SkeletonHandle CommitTyped(AssetStaging&& staged);
 
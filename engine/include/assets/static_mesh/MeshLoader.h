@@ -5,6 +5,7 @@
 
 #include <cstddef>
 #include <span>
+#include <stop_token>
 #include <string_view>
 
 class BinaryReader;
@@ -19,6 +20,10 @@ class Logger;
 // file whose skinned flag is set, and the skinned loads require it — a
 // caller can never accidentally read a skinned mesh as static geometry or
 // vice versa, even though both share one binary format.
+//
+// The byte loads take the staged load's stop token and check it between
+// streams and sections; a stopped load returns false without logging and
+// leaves the output empty.
 //=============================================================================
 class MeshLoader
 {
@@ -27,11 +32,15 @@ public:
 
     // Static geometry: rejects a file with the skinned flag set.
     [[nodiscard]] bool LoadFromFile(std::string_view path, MeshGeometry& out);
-    [[nodiscard]] bool LoadFromBytes(std::span<const std::byte> bytes, MeshGeometry& out);
+    [[nodiscard]] bool LoadFromBytes(std::span<const std::byte> bytes,
+                                     MeshGeometry& out,
+                                     std::stop_token stop = {});
 
     // Skinned mesh: requires the skinned flag; fills geometry + skinning.
     [[nodiscard]] bool LoadSkinnedFromFile(std::string_view path, SkinnedMeshData& out);
-    [[nodiscard]] bool LoadSkinnedFromBytes(std::span<const std::byte> bytes, SkinnedMeshData& out);
+    [[nodiscard]] bool LoadSkinnedFromBytes(std::span<const std::byte> bytes,
+                                            SkinnedMeshData& out,
+                                            std::stop_token stop = {});
 
 private:
     // Shared reader. `outSkinning` is null for the static path (skinned files
@@ -41,11 +50,13 @@ private:
                                       size_t fileSize,
                                       std::string_view sourceName,
                                       MeshGeometry& outGeometry,
-                                      MeshSkinning* outSkinning);
+                                      MeshSkinning* outSkinning,
+                                      const std::stop_token& stop);
     [[nodiscard]] bool LoadFromBytesImpl(std::span<const std::byte> bytes,
                                          std::string_view sourceName,
                                          MeshGeometry& outGeometry,
-                                         MeshSkinning* outSkinning);
+                                         MeshSkinning* outSkinning,
+                                         const std::stop_token& stop);
     [[nodiscard]] bool LoadFromFileImpl(std::string_view path,
                                         MeshGeometry& outGeometry,
                                         MeshSkinning* outSkinning);
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <assets/static_mesh/StaticMeshFormat.h>
+#include <render/static_mesh/MeshGeometry.h>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+//=============================================================================
+// .smesh quantized layout (StaticMeshFormat.h, version 6)
+//
+// The encode and decode halves of kSmeshFlagQuantized, shared by
+// MeshSerializer and MeshLoader so both sides agree on which box a vertex
+// decodes against. Lossy by design: positions land within half a box step,
+// normals and tangents within the octahedral snorm16 grid, UVs within half
+// a half-float ulp (the probe format's round-to-nearest-even FloatToHalf).
+// Everything the runtime validates exactly — tangent w, lightmap UVs,
+// indices — survives unchanged.
+//=============================================================================
+
+// No section's vertex range holds the vertex.
+inline constexpr uint32_t kSmeshNoOwner = UINT32_MAX;
+
+// Largest |uv| the half-float Uv0 keeps within 1/2048 of its source.
+inline constexpr float kSmeshQuantizedUvLimit = 2.0f;
+
+// A zero vector encodes as +Z; every other direction decodes unit length.
+void EncodeOctahedral(const Vec3d& direction, int16_t (&out)[2]);
+[[nodiscard]] Vec3d DecodeOctahedral(const int16_t (&encoded)[2]);
+
+// The section each vertex belongs to: the first whose vertex range holds
+// it, or kSmeshNoOwner.
+[[nodiscard]] std::vector<uint32_t> AssignQuantOwners(std::span<const StaticMeshSection> sections,
+                                                      std::size_t vertexCount);
+
+// Whether the quantized layout can carry the mesh: every vertex owned by
+// a section, every UV within kSmeshQuantizedUvLimit.
+[[nodiscard]] bool CanQuantizeMesh(const MeshGeometry& mesh, std::span<const uint32_t> owners);
+
+// Section-relative UInt16 indices fit when the sections' index ranges, LOD
+// ranges included, partition the index stream (so every index has one base
+// to add back) and no section spans more than 65536 vertices.
+[[nodiscard]] bool SectionsFitUInt16Indices(std::span<const StaticMeshSection> sections,
+                                            std::size_t indexCount);
+
+// One box per section, spanning the positions of the vertices it owns.
+[[nodiscard]] std::vector<SmeshQuantBox> ComputeQuantBoxes(const MeshGeometry& mesh,
+                                                           std::span<const uint32_t> owners);
+
+[[nodiscard]] SmeshQuantizedVertex QuantizeVertex(const StaticMeshVertex& vertex,
+                                                  const SmeshQuantBox& box);
+[[nodiscard]] StaticMeshVertex DequantizeVertex(const SmeshQuantizedVertex& vertex,
+                                                const SmeshQuantBox& box);
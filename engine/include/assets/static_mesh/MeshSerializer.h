@@ -21,26 +21,42 @@ class Logger;
 // types (Decisions J, M). Static meshes write a `.smesh`; skinned meshes
 // write a `.skmesh` (same magic, skinned flag set) so the kind is known from
 // the path without reading the payload.
+//
+// The vertex layout is the writer's choice per call: Full writes
+// StaticMeshVertex as is; Quantized asks for the compressed v6 layout
+// (MeshQuantization.h) and quietly falls back to Full for a mesh it cannot
+// carry. Either reads back through the same MeshLoader entry points.
 //=============================================================================
+enum class SmeshVertexLayout
+{
+    Full,
+    Quantized,
+};
+
 class MeshSerializer
 {
 public:
     explicit MeshSerializer(LoggingProvider& logging);
 
     // Static geometry — `.smesh`, skinned flag clear, no skinning chunk.
-    [[nodiscard]] bool WriteToFile(std::string_view path, const MeshGeometry& mesh);
-    [[nodiscard]] bool WriteToBytes(const MeshGeometry& mesh, std::vector<std::byte>& out);
+    [[nodiscard]] bool WriteToFile(std::string_view path, const MeshGeometry& mesh,
+                                   SmeshVertexLayout layout = SmeshVertexLayout::Full);
+    [[nodiscard]] bool WriteToBytes(const MeshGeometry& mesh, std::vector<std::byte>& out,
+                                    SmeshVertexLayout layout = SmeshVertexLayout::Full);
 
     // Skinned mesh — `.skmesh`, skinned flag set, geometry + skinning chunk.
-    [[nodiscard]] bool WriteSkinnedToFile(std::string_view path, const SkinnedMeshData& mesh);
-    [[nodiscard]] bool WriteSkinnedToBytes(const SkinnedMeshData& mesh, std::vector<std::byte>& out);
+    [[nodiscard]] bool WriteSkinnedToFile(std::string_view path, const SkinnedMeshData& mesh,
+                                          SmeshVertexLayout layout = SmeshVertexLayout::Full);
+    [[nodiscard]] bool WriteSkinnedToBytes(const SkinnedMeshData& mesh, std::vector<std::byte>& out,
+                                           SmeshVertexLayout layout = SmeshVertexLayout::Full);
 
 private:
     // Shared geometry-writing core; `skinning` is null for static meshes and
     // appended as the trailing chunk when present.
     [[nodiscard]] bool WriteToWriter(BinaryWriter& writer,
                                      const MeshGeometry& geometry,
-                                     const MeshSkinning* skinning);
+                                     const MeshSkinning* skinning,
+                                     SmeshVertexLayout layout);
 
     Logger& Log;
 };
@@ -22,15 +22,38 @@
 // meshes alike. The kSmeshFlagLightmapUv header bit records whether the cook
 // wrote meaningful UVs (tooling hint only; the runtime always reads the
 // channel). Single version live: v4 files must recook (cooked-index bump).
-inline constexpr uint32_t kSmeshFormatVersion = 5;
+// Version 6: an optional quantized layout (kSmeshFlagQuantized) — a
+// 24-byte SmeshQuantizedVertex in place of the 52-byte StaticMeshVertex,
+// a per-section quantization box table after the section table, and
+// section-relative UInt16 indices when every section fits. The loader
+// decodes to StaticMeshVertex, so the GPU vertex format is unchanged.
+// Unquantized files are byte-identical to v5 apart from the version
+// (migrate_smesh_v5_to_v6.py); cooked meshes recook (cooked-index bump).
+// Version 7: per-section LOD chains. The section record's reserved field
+// became LodCount, and a table of SmeshLodRecord follows the section table
+// (after the quantization boxes, when present). LOD index ranges live in
+// the same index stream, after the base ranges. A v6 file wrote the field
+// as zero, so it is a LOD-free v7 file once its version says so
+// (migrate_smesh_v6_to_v7.py); cooked meshes recook (cooked-index bump).
+// Version 8: per-section meshlets. The section record grew MeshletCount
+// (and a reserved word) to 56 bytes, and a table of SmeshMeshletRecord
+// follows the LOD table. Meshlets are slices of the base range, so the
+// index stream is unchanged. migrate_smesh_v7_to_v8.py widens the records;
+// cooked meshes recook (cooked-index bump).
+inline constexpr uint32_t kSmeshFormatVersion = 8;
 
 // SmeshFileHeader::Flags bits.
 inline constexpr uint32_t kSmeshFlagSkinned = 1u << 0;
 inline constexpr uint32_t kSmeshFlagLightmapUv = 1u << 1;
+inline constexpr uint32_t kSmeshFlagQuantized = 1u << 2;
 
+// UInt16 is written by the quantized layout only, and its indices are
+// relative to their section's VertexOffset: a section fits when its
+// VertexCount is at most 65536.
 enum class SmeshIndexFormat : uint32_t
 {
     UInt32 = 0,
+    UInt16 = 1,
 };
 
 enum class SmeshTopology : uint32_t
@@ -80,12 +103,75 @@ struct SmeshSectionRecord
     uint32_t VertexCount = 0;
 
     uint32_t MaterialSlot = 0;
-    uint32_t Reserved0 = 0;
+    // Records this section owns in the LOD table, at most kMaxMeshLods.
+    uint32_t LodCount = 0;
 
     float BoundsMin[3]{};
     float BoundsMax[3]{};
+
+    // Records this section owns in the meshlet table.
+    uint32_t MeshletCount = 0;
+    uint32_t Reserved0 = 0;
+};
+
+// One coarser level of a section (StaticMeshLod). The table holds every
+// section's LodCount records back to back, in section order and finest
+// first, between the section region and the vertex data. With UInt16
+// indices a LOD's range is relative to its section's VertexOffset like the
+// section's own, and the base and LOD ranges together partition the index
+// stream.
+struct SmeshLodRecord
+{
+    uint32_t IndexOffset = 0;
+    uint32_t IndexCount = 0;
+    float Error = 0.0f;
+    uint32_t Reserved0 = 0;
+};
+
+// One cluster of a section's base range (StaticMeshMeshlet). The table holds
+// every section's MeshletCount records back to back, in section order, after
+// the LOD table. A section's records tile its base range in order.
+struct SmeshMeshletRecord
+{
+    uint32_t IndexOffset = 0;
+    uint32_t IndexCount = 0;
+    float Center[3]{};
+    float Radius = 0.0f;
+    float ConeAxis[3]{};
+    float ConeCutoff = 0.0f;
+};
+
+// Quantized layout (kSmeshFlagQuantized) only: one per section, in section
+// order, between the section table and the vertex data. A vertex belongs to
+// the first section whose vertex range holds it and decodes as
+// Origin + Position * Step; the writer requires every vertex to belong to
+// some section.
+struct SmeshQuantBox
+{
+    float Origin[3]{};
+    float Step[3]{};
+};
+
+// The quantized vertex. Normal and tangent are octahedral-encoded snorm16
+// pairs (decoded unit length); the tangent's handedness is bit 0 of
+// TangentSign (set: w = -1). Uv0 is two IEEE half floats, which is why the
+// writer keeps the full layout for meshes whose UVs leave [-2, 2]. The
+// lightmap UVs are the v5 unorm16 pair, unchanged.
+struct SmeshQuantizedVertex
+{
+    uint16_t Position[3]{};
+    uint16_t TangentSign = 0;
+    int16_t Normal[2]{};
+    int16_t Tangent[2]{};
+    uint16_t Uv0[2]{};
+    uint16_t LightmapU = 0;
+    uint16_t LightmapV = 0;
 };
 
 static_assert(sizeof(SmeshFileHeader) == 88);
-static_assert(sizeof(SmeshSectionRecord) == 48);
+static_assert(sizeof(SmeshSectionRecord) == 56);
+static_assert(sizeof(SmeshLodRecord) == 16);
+static_assert(sizeof(SmeshMeshletRecord) == 40);
+static_assert(sizeof(SmeshQuantBox) == 24);
+static_assert(sizeof(SmeshQuantizedVertex) == 24);
 static_assert(sizeof(StaticMeshVertex) == 52);
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <core/assets/AssetBytes.h>
 #include <render/TextureData.h>
 
 #include <cstddef>
@@ -17,3 +18,10 @@
 [[nodiscard]] bool LoadStexFromBytes(std::span<const std::byte> bytes,
                                      TextureData& out,
                                      std::string* error = nullptr);
+
+// The same read without copying the pixels: the result borrows its mip chain
+// from `bytes` (TextureData::BorrowedBlob) and holds a reference on them, so
+// the upload copies straight out of wherever the source put the file.
+[[nodiscard]] bool LoadStexFromView(const AssetBytes& bytes,
+                                    TextureData& out,
+                                    std::string* error = nullptr);
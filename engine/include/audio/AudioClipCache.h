@@ -79,6 +79,7 @@ private:
     // AssetCache CRTP hooks.
     void OnFree(AudioClipEntry& entry);
     bool IsEntryLive(const AudioClipEntry& entry) const;
+    AssetFootprint WarmFootprint(const AudioClipEntry& entry) const;
 
     Logger& Log;
 };
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <vector>
+
+//=============================================================================
+// AssetBytes
+//
+// An immutable, reference-counted view of an asset's bytes: the result of
+// IAssetSource::ReadView. What backs it is the source's business -- pages of
+// a mapped pack, or a buffer drawn from a shared pool -- and the owner keeps
+// that alive for as long as any copy of the view (or a Slice of it) does. A
+// staged payload can therefore hold a span into the file it was loaded from
+// until the owner thread commits it, and the bytes are never copied just to
+// change hands.
+//
+// Copying one is a reference-count bump. Safe to hand between threads; the
+// bytes themselves are never written once the view exists.
+//=============================================================================
+class AssetBytes
+{
+public:
+    AssetBytes() = default;
+    AssetBytes(std::shared_ptr<const void> owner, std::span<const std::byte> bytes)
+        : Owner(std::move(owner))
+        , View(bytes)
+    {
+    }
+
+    // Takes ownership of an existing buffer; for sources with nothing to
+    // map and tests.
+    [[nodiscard]] static AssetBytes Adopt(std::vector<std::byte>&& bytes);
+
+    [[nodiscard]] std::span<const std::byte> Bytes() const { return View; }
+    [[nodiscard]] const std::byte* data() const { return View.data(); }
+    [[nodiscard]] std::size_t size() const { return View.size(); }
+    [[nodiscard]] bool empty() const { return View.empty(); }
+
+    // A sub-range sharing this view's owner. Clamped to the view.
+    [[nodiscard]] AssetBytes Slice(std::size_t offset, std::size_t count) const;
+
+    // What keeps the bytes alive, for a consumer that keeps a raw span into
+    // them past the lifetime of this object.
+    [[nodiscard]] const std::shared_ptr<const void>& Keepalive() const { return Owner; }
+
+private:
+    std::shared_ptr<const void> Owner;
+    std::span<const std::byte> View;
+};
+
+//=============================================================================
+// PooledAssetBuffer
+//
+// A writable buffer drawn from a process-wide pool, for a source that has to
+// produce bytes (read a loose file, decompress a pack entry) rather than
+// point at them. Fill Bytes(), then Seal() it into AssetBytes; when the last
+// view of it is released the buffer goes back to the pool with its capacity
+// intact, so a preload of a hundred textures reuses a few allocations instead
+// of faulting in a hundred fresh ones. The pool keeps a bounded number of
+// bytes: a buffer past the budget is freed instead.
+//=============================================================================
+class PooledAssetBuffer
+{
+public:
+    PooledAssetBuffer();
+    ~PooledAssetBuffer();
+
+    PooledAssetBuffer(const PooledAssetBuffer&) = delete;
+    PooledAssetBuffer& operator=(const PooledAssetBuffer&) = delete;
+
+    [[nodiscard]] std::vector<std::byte>& Bytes() { return Buffer; }
+    [[nodiscard]] AssetBytes Seal() &&;
+
+private:
+    std::vector<std::byte> Buffer;
+    bool Sealed = false;
+};
@@ -5,6 +5,7 @@
 #include <core/handle/Owned.h>
 
 #include <cassert>
+#include <concepts>
 #include <cstdint>
 #include <string>
 #include <string_view>
@@ -20,6 +21,7 @@
 //   - Acquire / Release / AcquireOwned public interface
 //   - ILifetimeOwner integration (Attach / Detach for RAII handles)
 //   - the IAssetStore residency seam, keyed on TAssetType
+//   - an optional warm cache for released entries (below)
 //
 // TAssetType is the kind this cache stores. Naming it is what lets generic
 // orchestration hold a reference without knowing THandle: the lease carries
@@ -44,6 +46,24 @@
 //   // that point at a freed-but-not-yet-reused slot.
 //   bool IsEntryLive(const TEntry& entry) const;
 //
+// A third hook is optional:
+//
+//   // What `entry` holds, measured when it is released. Implementing it
+//   // opts the cache into parking released named entries (warm cache).
+//   AssetFootprint WarmFootprint(const TEntry& entry) const;
+//
+// Warm cache: with a nonzero budget (SetWarmCacheBudget), a named entry whose
+// refcount reaches zero is not freed but parked, still registered under its
+// path, in a least-recently-released list. Anything that takes a reference
+// by path or handle -- Acquire, TryAcquireLease, Retain, an Owned attach --
+// takes a parked entry straight back, so a preload or a synchronous load
+// that finds it never reaches the loader. Parked bytes are held to the
+// budget on the CPU and GPU sides separately; the oldest entry holding bytes
+// on a side that is over is freed first. Unnamed entries cannot be found
+// again and always free on release, as does every entry of a cache without
+// the hook: a parked material would pin its textures outside the texture
+// budget, so MaterialCache deliberately leaves it out.
+//
 // THandle requirements (satisfied by every Handle<Tag>):
 //   - bool IsValid() const
 //   - uint32_t Index / Generation fields, aggregate-initializable as
@@ -76,7 +96,7 @@ public:
 
         THandle handle = it->second;
         if (TEntry* entry = Resolve(handle))
-            ++entry->RefCount;
+            AddRef(handle, *entry);
         return handle;
     }
 
@@ -95,11 +115,12 @@ public:
     void Retain(THandle handle)
     {
         if (TEntry* entry = Resolve(handle))
-            ++entry->RefCount;
+            AddRef(handle, *entry);
     }
 
-    // Decrement the refcount. Frees resources and returns the slot to the pool
-    // when the count reaches zero. Calling Release on an invalid handle is a no-op.
+    // Decrement the refcount. When the count reaches zero the entry parks in
+    // the warm cache if it can, and otherwise frees its resources and returns
+    // the slot to the pool. Calling Release on an invalid handle is a no-op.
     void Release(THandle handle)
     {
         TEntry* entry = Resolve(handle);
@@ -111,7 +132,9 @@ public:
         --entry->RefCount;
         if (entry->RefCount > 0) return;
 
-        FreeEntry(HandleIndex(handle), *entry);
+        const uint32_t index = HandleIndex(handle);
+        if (!Park(index, *entry))
+            FreeEntry(index, *entry);
     }
 
     // -- IAssetStore ----------------------------------------------------------
@@ -146,6 +169,16 @@ public:
         return GetRegisteredPath(THandle::FromToken(token));
     }
 
+    // Lowering the budget evicts down to it now; zero on both sides frees
+    // every parked entry and stops parking.
+    void SetWarmCacheBudget(const AssetWarmCacheBudget& budget) override
+    {
+        WarmBudget = budget;
+        TrimWarmCache();
+    }
+
+    [[nodiscard]] AssetWarmCacheStats GetWarmCacheStats() const override { return WarmStats; }
+
 protected:
     [[nodiscard]] THandle FindRegisteredHandle(std::string_view path, bool addRef = false)
     {
@@ -158,7 +191,7 @@ protected:
         if (TEntry* entry = Resolve(handle))
         {
             if (addRef)
-                ++entry->RefCount;
+                AddRef(handle, *entry);
             return handle;
         }
 
@@ -196,6 +229,7 @@ protected:
         {
             Resolve(handle)->PathKey = key;
             PathLookup.emplace(key, handle);
+            ++WarmStats.Misses;
         }
         return handle;
     }
@@ -209,6 +243,11 @@ protected:
             if (Derived().IsEntryLive(entry))
                 Derived().OnFree(entry);
         }
+
+        WarmLinks.clear();
+        WarmStats.ParkedEntries = 0;
+        WarmStats.ParkedCpuBytes = 0;
+        WarmStats.ParkedGpuBytes = 0;
     }
 
     // AllocHandle is protected so derived classes can use it for non-path
@@ -271,11 +310,134 @@ protected:
     }
 
 private:
+    // One slot's place in the warm list. Slot 0 is the list's sentinel: its
+    // Next is the most recently released entry and its Prev the oldest.
+    struct WarmLink
+    {
+        uint32_t Prev = 0;
+        uint32_t Next = 0;
+        bool Parked = false;
+        AssetFootprint Footprint;
+    };
+
+    [[nodiscard]] static constexpr bool CanPark()
+    {
+        return requires(const TDerived& cache, const TEntry& entry) {
+            { cache.WarmFootprint(entry) } -> std::same_as<AssetFootprint>;
+        };
+    }
+
+    [[nodiscard]] bool WarmCacheEnabled() const
+    {
+        return WarmBudget.CpuBytes > 0 || WarmBudget.GpuBytes > 0;
+    }
+
+    [[nodiscard]] bool IsParked(uint32_t index) const
+    {
+        return index < WarmLinks.size() && WarmLinks[index].Parked;
+    }
+
+    // Every reference taken on an existing entry comes through here, so a
+    // parked entry leaves the warm list the moment anything wants it again.
+    void AddRef(THandle handle, TEntry& entry)
+    {
+        const uint32_t index = HandleIndex(handle);
+        if (entry.RefCount == 0 && IsParked(index))
+        {
+            Unpark(index);
+            ++WarmStats.Hits;
+        }
+        ++entry.RefCount;
+    }
+
+    // Returns false when the entry must be freed instead.
+    [[nodiscard]] bool Park(uint32_t index, TEntry& entry)
+    {
+        if constexpr (!CanPark())
+        {
+            (void)index;
+            (void)entry;
+            return false;
+        }
+        else
+        {
+            if (entry.PathKey.empty() || !WarmCacheEnabled())
+                return false;
+
+            const AssetFootprint footprint = Derived().WarmFootprint(entry);
+            if (footprint.CpuBytes > WarmBudget.CpuBytes || footprint.GpuBytes > WarmBudget.GpuBytes)
+            {
+                ++WarmStats.Evictions;
+                return false;
+            }
+
+            if (WarmLinks.size() < Entries.size())
+                WarmLinks.resize(Entries.size());
+
+            WarmLink& link = WarmLinks[index];
+            link.Parked = true;
+            link.Footprint = footprint;
+            link.Prev = 0;
+            link.Next = WarmLinks[0].Next;
+            WarmLinks[link.Next].Prev = index;
+            WarmLinks[0].Next = index;
+
+            ++WarmStats.ParkedEntries;
+            WarmStats.ParkedCpuBytes += footprint.CpuBytes;
+            WarmStats.ParkedGpuBytes += footprint.GpuBytes;
+
+            TrimWarmCache();
+            return true;
+        }
+    }
+
+    void Unpark(uint32_t index)
+    {
+        WarmLink& link = WarmLinks[index];
+        WarmLinks[link.Prev].Next = link.Next;
+        WarmLinks[link.Next].Prev = link.Prev;
+
+        --WarmStats.ParkedEntries;
+        WarmStats.ParkedCpuBytes -= link.Footprint.CpuBytes;
+        WarmStats.ParkedGpuBytes -= link.Footprint.GpuBytes;
+        link = WarmLink{};
+    }
+
+    void TrimWarmCache()
+    {
+        while (WarmStats.ParkedEntries > 0)
+        {
+            const bool drain = !WarmCacheEnabled();
+            const bool cpuOver = WarmStats.ParkedCpuBytes > WarmBudget.CpuBytes;
+            const bool gpuOver = WarmStats.ParkedGpuBytes > WarmBudget.GpuBytes;
+            if (!drain && !cpuOver && !gpuOver)
+                return;
+
+            // Oldest first, passing over entries that hold nothing on the
+            // side that is over budget.
+            uint32_t victim = WarmLinks[0].Prev;
+            while (victim != 0 && !drain)
+            {
+                const AssetFootprint& footprint = WarmLinks[victim].Footprint;
+                if ((cpuOver && footprint.CpuBytes > 0) || (gpuOver && footprint.GpuBytes > 0))
+                    break;
+                victim = WarmLinks[victim].Prev;
+            }
+            if (victim == 0)
+                return;
+
+            Unpark(victim);
+            ++WarmStats.Evictions;
+            FreeEntry(victim, Entries[victim]);
+        }
+    }
+
     // ILifetimeOwner -- called by Owned on construction / destruction.
     void Attach(uint64_t token) override
     {
-        if (TEntry* entry = Resolve(THandle::FromToken(token)))
-            ++entry->RefCount;
+        const THandle handle = THandle::FromToken(token);
+        if (TEntry* entry = Resolve(handle))
+            AddRef(handle, *entry);
     }
 
     void Detach(uint64_t token) override
@@ -312,4 +474,9 @@ private:
     std::vector<TEntry>                          Entries;
     std::vector<uint32_t>                        FreeSlots;
     std::unordered_map<std::string, THandle>     PathLookup;
+
+    // Parallel to Entries, grown on first park.
+    std::vector<WarmLink>                        WarmLinks;
+    AssetWarmCacheBudget                         WarmBudget;
+    AssetWarmCacheStats                          WarmStats;
 };
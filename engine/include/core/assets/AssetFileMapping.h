@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+
+//=============================================================================
+// AssetFileMapping
+//
+// A whole file mapped read-only into memory, for the cooked containers a
+// runtime reads in place rather than parses: a .spak pack and the .sreg
+// registry index. Only shared ownership is handed out, so a view into the
+// pages (AssetBytes, with the mapping as its keepalive) can outlive whoever
+// opened it; the file is unmapped when the last reference goes.
+//
+// An empty file is an error rather than an empty mapping: neither container
+// has a valid zero-byte form, and mmap refuses a zero length anyway.
+//=============================================================================
+class AssetFileMapping
+{
+public:
+    [[nodiscard]] static std::shared_ptr<const AssetFileMapping> Open(
+        std::string_view path, std::string* error = nullptr);
+
+    ~AssetFileMapping();
+
+    AssetFileMapping(const AssetFileMapping&) = delete;
+    AssetFileMapping& operator=(const AssetFileMapping&) = delete;
+
+    [[nodiscard]] const std::byte* Data() const { return Base; }
+    [[nodiscard]] std::size_t Size() const { return Length; }
+    [[nodiscard]] std::span<const std::byte> Bytes() const { return { Base, Length }; }
+
+private:
+    AssetFileMapping() = default;
+
+    const std::byte* Base = nullptr;
+    std::size_t Length = 0;
+#if defined(_WIN32)
+    void* File = nullptr;
+    void* View = nullptr;
+#endif
+};
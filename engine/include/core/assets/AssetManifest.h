@@ -51,6 +51,14 @@ inline constexpr uint32_t kAssetManifestVersion = 2;
 // code knowing the component exists (the Decision O discipline).
 [[nodiscard]] std::vector<std::string> CollectAssetPaths(const JsonValue& root);
 
+// The same collection read straight from JSON text through JsonReader, with
+// no DOM built: for a document opened only for its refs, like the .smat files
+// behind a cooked scene. `out` is replaced on success; false with the parse
+// error otherwise.
+[[nodiscard]] bool CollectAssetPathsFromText(std::string_view jsonText,
+                                             std::vector<std::string>& out,
+                                             std::string* error = nullptr);
+
 // Id-first resolution to the path list the preloader consumes: an id the
 // registry knows yields the record's current path (rename-proof); anything
 // else falls back to the manifest's stamped path. Run after import + scan
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+//=============================================================================
+// .spak entry compression
+//
+// A byte-oriented LZ77 in the LZ4 block layout: a token byte splitting into a
+// literal run and a match length, the literals, a two-byte little-endian back
+// offset, and 255-run extensions for either length that overflows its nibble.
+// The final sequence is literals only. Chosen because decoding it is a copy
+// loop -- a player pays for decompression on a task thread at load time, and
+// a format that decodes near memcpy speed keeps a compressed entry from being
+// the slow part of a load.
+//
+// In-tree rather than a dependency: the pack is the only consumer, the whole
+// codec is a page of code, and the decoder has to be bounds-checked against
+// a file the player may have damaged, which is easier to promise for code
+// that lives here.
+//=============================================================================
+
+// The most output one input byte can stand for: a length-extension byte adds
+// at most 255 to a run, and every other byte of a sequence buys less. A stream
+// of n bytes therefore never decodes to more than n * kSpakMaxExpansion, which
+// lets a reader reject an entry claiming more before allocating for it.
+inline constexpr std::uint64_t kSpakMaxExpansion = 255;
+
+// Appends the compressed form of `input` to `out`, which is cleared first.
+void SpakCompress(std::span<const std::byte> input, std::vector<std::byte>& out);
+
+// Decompresses `input` into exactly `out.size()` bytes. False on anything
+// malformed -- a truncated sequence, an offset reaching before the output, a
+// run overflowing the output, or input that ends short of filling it.
+[[nodiscard]] bool SpakDecompress(std::span<const std::byte> input, std::span<std::byte> out);
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <core/assets/AssetRef.h>
+
+#include <cstdint>
+#include <string_view>
+
+//=============================================================================
+// .spak container (docs/assets/pipeline.md, Decision I)
+//
+// Every runtime asset of a shipping build in one file, so a player opens one
+// thing instead of thousands and reads assets straight out of a mapping of it.
+//
+// Layout: SpakFileHeader, then each entry's bytes at an offset aligned to
+// Alignment, then EntryCount SpakEntry records sorted by PathHash, then the
+// path string table. The table of contents sits at the end so the writer can
+// stream entries without knowing their sizes up front; a reader maps the
+// whole file anyway, so where it sits costs nothing.
+//
+// An entry is stored raw or compressed (kSpakEntryCompressed). A raw entry
+// is what a loader can be handed as a span into the mapping; compressing one
+// trades that for size, which is why the builder only keeps a compressed
+// form that actually saved something.
+//=============================================================================
+
+inline constexpr char kSpakMagic[4] = { 'S', 'P', 'A', 'K' };
+inline constexpr uint32_t kSpakVersion = 1;
+
+// Entry data alignment unless the builder asks for another power of two. A
+// cache line: enough for any vertex or pixel type a loader reads in place,
+// and small enough that padding stays noise beside the assets.
+inline constexpr uint32_t kSpakDefaultAlignment = 64;
+
+// Largest decoded size a compressed entry may claim. A reader allocates that
+// much before decoding, so it is capped rather than taken on the file's word;
+// nothing a loader reads comes near it, and a builder stores anything larger
+// raw.
+inline constexpr uint64_t kSpakMaxDecodedEntryBytes = 1ull << 30;
+
+// Entry flag bits.
+inline constexpr uint16_t kSpakEntryCompressed = 1u << 0;
+
+struct SpakFileHeader
+{
+    char Magic[4];
+    uint32_t Version = 0;
+
+    uint32_t Flags = 0;
+    uint32_t Alignment = 0;
+
+    uint32_t EntryCount = 0;
+    uint32_t Reserved0 = 0;
+
+    uint64_t TocOffset = 0;
+    uint64_t StringsOffset = 0;
+    uint64_t StringsSize = 0;
+};
+
+struct SpakEntry
+{
+    // HashSpakPath of the virtual path; ties are broken by the path itself.
+    uint64_t PathHash = 0;
+    uint32_t PathOffset = 0; // into the string table
+    uint32_t PathLength = 0;
+
+    uint64_t DataOffset = 0; // from the start of the file
+    uint64_t StoredSize = 0; // bytes in the file
+    uint64_t Size = 0;       // bytes once decompressed; StoredSize when raw
+
+    // HashBytes64 of the uncompressed bytes: what the registry would have
+    // recorded for the loose file, so cooked-cache and hot-reload checks read
+    // the same number either way.
+    uint64_t ContentHash = 0;
+
+    AssetType Type = AssetType::Unknown;
+    uint16_t Flags = 0;
+    uint32_t Reserved0 = 0;
+};
+
+static_assert(sizeof(SpakFileHeader) == 48);
+static_assert(sizeof(SpakEntry) == 56);
+
+[[nodiscard]] uint64_t HashSpakPath(std::string_view virtualPath);
+
+[[nodiscard]] inline bool LooksLikeSpak(const void* bytes, uint64_t size)
+{
+    if (size < sizeof(SpakFileHeader))
+        return false;
+    const char* p = static_cast<const char*>(bytes);
+    return p[0] == kSpakMagic[0] && p[1] == kSpakMagic[1]
+        && p[2] == kSpakMagic[2] && p[3] == kSpakMagic[3];
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <core/assets/AssetPackFormat.h>
+#include <core/assets/AssetSource.h>
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class AssetFileMapping;
+class AssetRegistry;
+
+//=============================================================================
+// AssetPackSource
+//
+// IAssetSource over a .spak file mapped read-only into memory. A lookup is a
+// binary search of the table of contents by path hash; a read is a copy out
+// of the mapping, or a decompression for an entry stored compressed; a view
+// of a raw entry is no copy at all, and holds a reference on the mapping, so
+// it stays valid past Close. Nothing is opened or stat'd per asset, which on
+// a shipping build with thousands of them is most of what loose files cost.
+//
+// The mapping is validated once, when opened: every entry's range and path
+// must lie inside the file, and the table must be sorted. After that a lookup
+// trusts it, and a damaged pack fails to open rather than failing later on a
+// task thread.
+//
+// Paths the pack does not hold go to the fallback source, when there is one,
+// so a development build can mount a pack and still load a loose file it was
+// built without. A pack is immutable while open; everything here is safe to
+// call from task threads once Open has returned.
+//=============================================================================
+class AssetPackSource final : public IAssetSource
+{
+public:
+    explicit AssetPackSource(IAssetSource* fallback = nullptr);
+    ~AssetPackSource() override;
+
+    AssetPackSource(const AssetPackSource&) = delete;
+    AssetPackSource& operator=(const AssetPackSource&) = delete;
+
+    // Maps and validates the pack at `packPath`, closing whatever was open.
+    // On failure nothing is mapped and `error` says why.
+    [[nodiscard]] bool Open(std::string_view packPath, std::string* error = nullptr);
+    void Close();
+    [[nodiscard]] bool IsOpen() const { return Base != nullptr; }
+
+    [[nodiscard]] bool ReadBytes(std::string_view filePath,
+                                 std::vector<std::byte>& out) override;
+    [[nodiscard]] bool ReadView(std::string_view filePath, AssetBytes& out) override;
+    // The entry's offset in the pack. Paths served by the fallback report
+    // zero: their position is in another file.
+    [[nodiscard]] uint64_t ReadOrder(std::string_view filePath) const override;
+
+    [[nodiscard]] const SpakEntry* Find(std::string_view virtualPath) const;
+    [[nodiscard]] std::span<const SpakEntry> Entries() const { return Toc; }
+    [[nodiscard]] std::string_view PathOf(const SpakEntry& entry) const;
+    [[nodiscard]] std::size_t MappedBytes() const { return Size; }
+
+private:
+    [[nodiscard]] bool Validate(std::string* error);
+
+    IAssetSource* Fallback = nullptr;
+
+    // Shared with every view handed out; unmapped when the last one goes.
+    std::shared_ptr<const AssetFileMapping> Mapped;
+    const std::byte* Base = nullptr;
+    std::size_t Size = 0;
+    std::span<const SpakEntry> Toc;
+    std::string_view Strings;
+};
+
+// Registers every entry of an open pack under its virtual path, in place of
+// walking directories: the records a scan would have produced, read from the
+// table of contents. Records carry no FilePath, so ReadAssetBytes resolves
+// them by virtual path, which is the key the pack is searched by. Skips paths
+// already registered, as RegisterCookedAssets does. Returns the count newly
+// registered.
+int RegisterPackedAssets(const AssetPackSource& pack, AssetRegistry& registry);
@@ -10,8 +10,10 @@
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <unordered_set>
 
 class AssetKindRegistry;
+class AssetRegistryIndex;
 
 struct AssetRecord
 {
@@ -52,22 +54,43 @@ public:
     [[nodiscard]] const AssetRecord* FindById(AssetId id) const;
     [[nodiscard]] bool Contains(std::string_view path) const;
 
+    // Serves lookups from a cooked registry index in place of registering its
+    // records: FindByPath, FindById, and Contains consult `index` for paths
+    // not registered here, and a record is built from it the first time one
+    // is asked for. Everything registered directly still wins. Registering a
+    // path the index holds is a duplicate, as if the index had been walked.
+    // The index must stay open while mounted; null unmounts it, and records
+    // already built stay registered. Owner thread
+    // only, like every other call here: a const lookup may insert.
+    void MountIndex(const AssetRegistryIndex* index);
+    [[nodiscard]] const AssetRegistryIndex* MountedIndex() const { return Index; }
+
     // Read-only enumeration of every registered record (keyed by virtual path).
     // Lets tooling list assets of a kind (e.g. the editor's material picker)
-    // without a parallel asset-discovery path. (04-§3)
-    [[nodiscard]] const std::unordered_map<std::string, AssetRecord>& Records() const
-    {
-        return RecordsByPath;
-    }
+    // without a parallel asset-discovery path. (04-§3) With an index mounted
+    // this builds every record it holds first, which is exactly the cost the
+    // index exists to avoid -- tooling only.
+    [[nodiscard]] const std::unordered_map<std::string, AssetRecord>& Records() const;
 
 private:
     friend bool ScanAssetsDirectory(std::string_view rootDirectory,
                                     AssetRegistry& registry,
                                     const AssetKindRegistry& kinds);
 
+    // The mounted index's record for `path`, built into the maps on first
+    // use. Null when nothing is mounted, the index lacks the path, or the
+    // path was unregistered.
+    const AssetRecord* Materialize(std::string_view path) const;
+    [[nodiscard]] bool IsWithdrawn(std::string_view path) const;
+
     Logger& Log;
-    std::unordered_map<std::string, AssetRecord> RecordsByPath;
-    std::unordered_map<AssetId, const AssetRecord*> RecordsById;
+    const AssetRegistryIndex* Index = nullptr;
+    // Mutable because lookups build index records on demand.
+    mutable std::unordered_map<std::string, AssetRecord> RecordsByPath;
+    mutable std::unordered_map<AssetId, const AssetRecord*> RecordsById;
+    // Index paths an editor unregistered, so a lookup does not rebuild them.
+    std::unordered_set<std::string> Withdrawn;
+    mutable bool IndexMaterialized = false;
 };
 
 // IsValidAssetPath lives in <core/assets/AssetPath.h> (included above) so
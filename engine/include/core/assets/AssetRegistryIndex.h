@@ -0,0 +1,179 @@
+#pragma once
+
+#include <core/assets/AssetId.h>
+#include <core/assets/AssetRef.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class AssetFileMapping;
+class AssetKindRegistry;
+class LoggingProvider;
+struct AssetRecord;
+
+//=============================================================================
+// .sreg registry index (docs/assets/pipeline.md, Decision I)
+//
+// The records a directory walk of one assets root would register -- both
+// scans and the cooked index.json -- written once by the cook, so a player
+// maps one file at startup instead of walking, hashing, and parsing its way
+// to the same answer. Sized for tens of thousands of assets: nothing is
+// decoded up front, and a record becomes an AssetRecord only when something
+// looks it up (AssetRegistry::MountIndex).
+//
+// Layout: SregFileHeader, then EntryCount SregEntry records sorted by
+// PathHash (ties broken by the path), then IdCount SregIdEntry records
+// sorted by id, then the string table holding every virtual path and every
+// root-relative file path. Hashing is .spak's (HashSpakPath), so the two
+// tables of contents agree on a path's key.
+//
+// A file path is stored relative to the assets root and joined with the
+// root the index is opened against; that is what lets a cooked tree move
+// with its root and still resolve.
+//=============================================================================
+
+inline constexpr char kSregMagic[4] = { 'S', 'R', 'E', 'G' };
+inline constexpr uint32_t kSregVersion = 1;
+
+// Name of the index inside an assets root's cooked cache directory.
+inline constexpr std::string_view kAssetRegistryIndexFileName = "registry.sreg";
+
+struct SregFileHeader
+{
+    char Magic[4];
+    uint32_t Version = 0;
+
+    uint32_t EntryCount = 0;
+    uint32_t IdCount = 0;
+
+    uint64_t EntriesOffset = 0;
+    uint64_t IdsOffset = 0;
+    uint64_t StringsOffset = 0;
+    uint64_t StringsSize = 0;
+};
+
+struct SregEntry
+{
+    uint64_t PathHash = 0;
+    uint64_t ContentHash = 0;
+    uint64_t Id = 0; // AssetId value; 0 = none
+
+    uint32_t PathOffset = 0; // into the string table
+    uint32_t PathLength = 0;
+    uint32_t FileOffset = 0; // root-relative; FileLength 0 = no file
+    uint32_t FileLength = 0;
+
+    uint32_t Version = 1;
+    AssetType Type = AssetType::Unknown;
+    AssetSourceKind SourceKind = AssetSourceKind::Unknown;
+};
+
+// FindById's table: one row per entry that carries an id.
+struct SregIdEntry
+{
+    uint64_t Id = 0;
+    uint32_t Entry = 0; // index into the entry table
+    uint32_t Reserved0 = 0;
+};
+
+static_assert(sizeof(SregFileHeader) == 48);
+static_assert(sizeof(SregEntry) == 48);
+static_assert(sizeof(SregIdEntry) == 16);
+
+// <assetsRoot>/.cooked/registry.sreg
+[[nodiscard]] std::string AssetRegistryIndexPath(std::string_view assetsRoot);
+
+[[nodiscard]] inline bool LooksLikeSreg(const void* bytes, uint64_t size)
+{
+    if (size < sizeof(SregFileHeader))
+        return false;
+    const char* p = static_cast<const char*>(bytes);
+    return p[0] == kSregMagic[0] && p[1] == kSregMagic[1]
+        && p[2] == kSregMagic[2] && p[3] == kSregMagic[3];
+}
+
+//=============================================================================
+// AssetRegistryIndex
+//
+// A mapped, validated .sreg. Validation runs once in Open -- ranges, sort
+// order, path hashes, and that each id row points back at an entry holding
+// that id -- so a lookup afterwards is a binary search with no checks, and a
+// damaged index fails to open instead of resolving some paths wrong.
+// Immutable while open.
+//=============================================================================
+class AssetRegistryIndex
+{
+public:
+    AssetRegistryIndex();
+    ~AssetRegistryIndex();
+
+    AssetRegistryIndex(const AssetRegistryIndex&) = delete;
+    AssetRegistryIndex& operator=(const AssetRegistryIndex&) = delete;
+
+    // Maps and validates the index at `indexPath`, whose file paths are
+    // relative to `assetsRoot`. On failure nothing is mapped and `error`
+    // says why.
+    [[nodiscard]] bool Open(std::string_view indexPath,
+                            std::string_view assetsRoot,
+                            std::string* error = nullptr);
+    void Close();
+    [[nodiscard]] bool IsOpen() const { return Mapped != nullptr; }
+
+    [[nodiscard]] const SregEntry* Find(std::string_view virtualPath) const;
+    [[nodiscard]] const SregEntry* FindById(AssetId id) const;
+
+    [[nodiscard]] std::span<const SregEntry> Entries() const { return Table; }
+    [[nodiscard]] std::string_view PathOf(const SregEntry& entry) const;
+    [[nodiscard]] std::string_view FileOf(const SregEntry& entry) const;
+
+    // The record a walk of the root would have registered for `entry`, its
+    // file path joined onto the root, with the id the cook bound to it.
+    [[nodiscard]] AssetRecord MakeRecord(const SregEntry& entry) const;
+
+    [[nodiscard]] std::string_view AssetsRoot() const { return Root; }
+    [[nodiscard]] std::size_t MappedBytes() const;
+
+private:
+    [[nodiscard]] bool Validate(std::string* error);
+
+    std::shared_ptr<const AssetFileMapping> Mapped;
+    std::string Root;
+    std::span<const SregEntry> Table;
+    std::span<const SregIdEntry> Ids;
+    std::string_view Strings;
+};
+
+//=============================================================================
+// Debug check against the walk
+//
+// An index is a cache of a walk, and a cache can go stale: a file added
+// after the last cook, or a cook that ran against a different root. This
+// runs the walk anyway -- ScanAssetsDirectory over the root and its cooked
+// directory, then RegisterCookedAssets, exactly what a player without an
+// index does -- into a scratch registry and compares record by record. Ids
+// are not compared; a walk has none until ApplyAssetIds. For debug builds
+// and tests: it costs the whole walk the index exists to skip.
+//=============================================================================
+
+struct AssetRegistryIndexCheck
+{
+    std::size_t Walked = 0;
+    std::vector<std::string> Missing; // the walk found it; the index lacks it
+    std::vector<std::string> Stale;   // both have it, with different records
+    std::vector<std::string> Extra;   // the index has it; the walk did not find it
+
+    [[nodiscard]] bool Matches() const
+    {
+        return Missing.empty() && Stale.empty() && Extra.empty();
+    }
+};
+
+[[nodiscard]] AssetRegistryIndexCheck CheckAssetRegistryIndex(
+    const AssetRegistryIndex& index,
+    const AssetKindRegistry& kinds,
+    LoggingProvider& logging);
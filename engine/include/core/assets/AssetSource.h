@@ -1,8 +1,10 @@
 #pragma once
 
+#include <core/assets/AssetBytes.h>
 #include <core/assets/AssetRegistry.h>
 
 #include <cstddef>
+#include <cstdint>
 #include <string_view>
 #include <vector>
 
@@ -10,9 +12,9 @@
 // IAssetSource
 //
 // The byte-source seam (docs/assets/pipeline.md, Decision I): loaders
-// receive bytes, not paths. v1 has exactly one implementation — open file,
-// read bytes — but the seam is what a pack-file reader plugs into later
-// with no loader changes.
+// receive bytes, not paths. Two implementations: open file, read bytes; and
+// AssetPackSource, which serves a shipping build's assets out of one mapped
+// .spak file with no loader changes.
 //
 // Implementations must be pure with respect to engine state: ReadBytes is
 // called from asset-loader work stages, which may run on task threads.
@@ -26,6 +28,20 @@ public:
     // failure (missing file, read error); `out` is left unspecified.
     [[nodiscard]] virtual bool ReadBytes(std::string_view filePath,
                                          std::vector<std::byte>& out) = 0;
+
+    // The bytes behind `filePath` as a shared view rather than an owned copy
+    // (Decision I, zero-copy half). A source that holds the bytes somewhere
+    // already -- a mapped pack entry stored raw -- hands out a view of them;
+    // the default reads through ReadBytes into a pooled buffer, which a
+    // loader can then keep without copying it again. Staged loaders prefer
+    // this over ReadBytes; the view may outlive the call, and the source.
+    [[nodiscard]] virtual bool ReadView(std::string_view filePath, AssetBytes& out);
+
+    // Where the bytes behind `filePath` sit in the source's backing store,
+    // for issuing reads in storage order (AsyncTaskOptions::ReadOrder). Zero
+    // when the source cannot say, which is the default and every loose file.
+    // Safe from task threads under the same rule as ReadBytes.
+    [[nodiscard]] virtual uint64_t ReadOrder(std::string_view filePath) const;
 };
 
 class FileAssetSource final : public IAssetSource
@@ -41,3 +57,12 @@ public:
 [[nodiscard]] bool ReadAssetBytes(IAssetSource& source,
                                   const AssetRecord& record,
                                   std::vector<std::byte>& out);
+
+// ReadAssetBytes's view counterpart: the same path resolution, through
+// IAssetSource::ReadView.
+[[nodiscard]] bool ReadAssetView(IAssetSource& source,
+                                 const AssetRecord& record,
+                                 AssetBytes& out);
+
+// IAssetSource::ReadOrder under the same path resolution.
+[[nodiscard]] uint64_t AssetReadOrder(const IAssetSource& source, const AssetRecord& record);
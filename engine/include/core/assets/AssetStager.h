@@ -4,6 +4,8 @@
 #include <core/assets/AssetSource.h>
 
 #include <any>
+#include <format>
+#include <stop_token>
 #include <string>
 #include <vector>
 
@@ -59,6 +61,16 @@ struct AssetStaging
     [[nodiscard]] bool IsValid() const { return Error.empty() && Payload.has_value(); }
 };
 
+// What a decode returns once its stop has been requested: a failed staging,
+// committed like any other failure, so the driver's bookkeeping still runs.
+[[nodiscard]] inline AssetStaging StoppedStaging(const AssetRecord& record)
+{
+    AssetStaging staging;
+    staging.Record = record;
+    staging.Error = std::format("staging of '{}' was stopped", record.Path);
+    return staging;
+}
+
 class IAssetStager
 {
 public:
@@ -67,4 +79,25 @@ public:
     // Task-thread half. `source` is the byte seam (Decision I).
     [[nodiscard]] virtual AssetStaging LoadStaged(const AssetRecord& record,
                                                   IAssetSource& source) = 0;
+
+    // LoadStaged split at the read, for a driver that reads on an I/O pool
+    // and decodes on a compute pool (AsyncTaskQueue::SubmitStaged). A stager
+    // whose LoadStaged is ReadAssetView followed by a pure decode of those
+    // bytes returns true and overrides DecodeStaged with the decode; one that
+    // reads anything else is staged whole.
+    //
+    // `stop` is the load's cancellation. A decode with several pieces of work
+    // (a mesh's sections, an image decode after its header) checks it between
+    // them and returns StoppedStaging once it is requested; a decode with one
+    // cheap step may ignore it. LoadStaged passes a token that never stops.
+    [[nodiscard]] virtual bool DecodesFromView() const { return false; }
+    [[nodiscard]] virtual AssetStaging DecodeStaged(const AssetRecord& record,
+                                                    [[maybe_unused]] const AssetBytes& bytes,
+                                                    [[maybe_unused]] std::stop_token stop)
+    {
+        AssetStaging staging;
+        staging.Record = record;
+        staging.Error = "stager does not decode from a read view";
+        return staging;
+    }
 };
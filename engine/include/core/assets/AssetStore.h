@@ -5,6 +5,38 @@
 #include <cstdint>
 #include <string_view>
 
+// What one resident entry holds, split by where it lives. A warm cache
+// budgets the two separately: host memory and device memory run out
+// independently.
+struct AssetFootprint
+{
+    uint64_t CpuBytes = 0;
+    uint64_t GpuBytes = 0;
+};
+
+// Bytes a store may keep parked after their last reference is released.
+// Zero on both sides turns parking off; an entry parks only when it fits on
+// both.
+struct AssetWarmCacheBudget
+{
+    uint64_t CpuBytes = 0;
+    uint64_t GpuBytes = 0;
+};
+
+struct AssetWarmCacheStats
+{
+    // A hit is a parked entry taken back into use; a miss is a named entry
+    // created from a fresh load. Lookups that find a live entry are neither.
+    uint64_t Hits = 0;
+    uint64_t Misses = 0;
+    // Parked entries freed to fit the budget, including releases too large
+    // to park at all.
+    uint64_t Evictions = 0;
+    uint32_t ParkedEntries = 0;
+    uint64_t ParkedCpuBytes = 0;
+    uint64_t ParkedGpuBytes = 0;
+};
+
 //=============================================================================
 // IAssetStore
 //
@@ -16,6 +48,11 @@
 //
 // This exists so preload and hot reload stop carrying one branch per asset
 // kind. Both are driven by a registry record, not by a switch over AssetType.
+//
+// A store may keep released entries warm (see AssetCache). Parked entries are
+// resident as far as this seam is concerned: TryAcquireLease takes them back
+// without a load, and hot reload refreshes them like any other. A store with
+// no warm cache ignores the budget and reports empty stats.
 //=============================================================================
 class IAssetStore
 {
@@ -30,4 +67,7 @@ public:
     [[nodiscard]] virtual AssetLease TryAcquireLease(std::string_view path) = 0;
 
     [[nodiscard]] virtual std::string_view GetPath(uint64_t token) const = 0;
+
+    virtual void SetWarmCacheBudget(const AssetWarmCacheBudget& /*budget*/) {}
+    [[nodiscard]] virtual AssetWarmCacheStats GetWarmCacheStats() const { return {}; }
 };
@@ -6,6 +6,7 @@
 #include <core/config/ConsoleConfig.h>
 #include <core/config/DebugConfig.h>
 #include <core/config/GraphicsConfig.h>
+#include <core/config/NetConfig.h>
 #include <core/config/RuntimeConfig.h>
 #include <core/config/WindowConfig.h>
 
@@ -39,6 +40,7 @@ struct EngineConfig
     EngineConsoleConfig Console;
     EngineAudioConfig Audio;
     EngineCaptionConfig Captions;
+    EngineNetConfig Net;
 };
 
 //=============================================================================
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <core/json/JsonValue.h>
+
+#include <optional>
+#include <string>
+
+//=============================================================================
+// EngineNetConfig
+//
+// Session-setup settings for networking. Read once; CreateNetSession applies
+// them to every session the engine opens, host or client alike, which is what
+// keeps two ends launched from the same engine.json in agreement.
+//
+// EntropyModelPath names a trained snapshot model (the 512-byte table
+// scripts/train_net_entropy_model.py writes). Empty sends snapshots raw. A
+// host and its clients must name the same table; a client holding a
+// different one refuses coded snapshots rather than misreading them.
+//
+// SnapshotCapturePath, when set, makes a host record every snapshot it
+// publishes, before coding, as training input for that script.
+//=============================================================================
+struct EngineNetConfig
+{
+    std::string EntropyModelPath;
+    std::string SnapshotCapturePath;
+};
+
+//=============================================================================
+// NetConfigError
+//=============================================================================
+struct NetConfigError
+{
+    std::string Message;
+};
+
+// Deserialize EngineNetConfig from the "net" section of the engine config.
+std::optional<EngineNetConfig> DeserializeNetConfig(
+    const JsonValue& root,
+    NetConfigError* error = nullptr);
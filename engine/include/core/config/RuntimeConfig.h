@@ -40,6 +40,11 @@ struct EngineRuntimeConfig
     // engine never pumps work inline, so zero threads would strand every load.
     int AsyncTaskThreadCount = 1;
 
+    // Async-lane I/O threads: the read half of staged asset loads, kept off
+    // the task threads above so a thread blocked on the disk never holds a
+    // core a decode could use. 0 runs reads on the task threads.
+    int AsyncIoThreadCount = 1;
+
     // World partition streaming policy (WorldPartitionRuntime). HopCount is the
     // neighbor graph distance kept resident around the focus zone; LingerSeconds is
     // how long an undemanded zone stays attached before DestroyZone; ResidentZoneCap
@@ -54,6 +59,10 @@ struct EngineRuntimeConfig
     bool   StreamingNeighborVisible = true;
     bool   StreamingNeighborPhysics = true;
     double StreamingRadius = 0.0;
+    // Prefetch horizon in seconds: zones the focus is predicted to reach that
+    // soon, by its velocity and the routes it has taken, load dormant ahead of
+    // demand (0 = no prediction).
+    double StreamingPredictSeconds = 0.0;
 
     // Rebuild the transform propagation order every sweep instead of only when
     // the hierarchy changes. Off by default and never a fast path: it exists so a
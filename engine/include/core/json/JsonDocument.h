@@ -0,0 +1,135 @@
+#pragma once
+
+#include <core/json/JsonParser.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+class JsonDocument;
+
+enum class JsonNodeType : uint8_t
+{
+	Null,
+	Bool,
+	Number,
+	String,
+	Array,
+	Object,
+};
+
+//=============================================================================
+// JsonNode
+//
+// A read-only handle to one value in a JsonDocument: a document pointer and a
+// node index, cheap to copy. A default or missing node (Find on an absent key,
+// say) is invalid and answers false to every Is* query, so lookups chain
+// without a null check at each step. As* on the wrong type answers false, 0
+// or an empty view rather than throwing.
+//
+// Handles stay valid while the document lives where it was when they were
+// taken; moving the document invalidates them.
+//=============================================================================
+class JsonNode
+{
+public:
+	JsonNode() = default;
+
+	[[nodiscard]] bool IsValid() const { return Document != nullptr; }
+	explicit operator bool() const { return IsValid(); }
+
+	[[nodiscard]] bool IsNull() const;
+	[[nodiscard]] bool IsBool() const;
+	[[nodiscard]] bool IsNumber() const;
+	[[nodiscard]] bool IsString() const;
+	[[nodiscard]] bool IsArray() const;
+	[[nodiscard]] bool IsObject() const;
+
+	[[nodiscard]] bool AsBool() const;
+	[[nodiscard]] double AsNumber() const;
+	[[nodiscard]] std::string_view AsString() const;
+
+	// Elements of an array, members of an object; 0 for anything else.
+	[[nodiscard]] std::size_t Size() const;
+
+	// The index-th element of an array or member value of an object, in
+	// document order.
+	[[nodiscard]] JsonNode operator[](std::size_t index) const;
+
+	// The key of an object's index-th member.
+	[[nodiscard]] std::string_view KeyAt(std::size_t index) const;
+
+	// The first member with this key. Objects of kJsonHashedObjectMembers or
+	// more members are hashed at parse time; smaller ones are scanned.
+	[[nodiscard]] JsonNode Find(std::string_view key) const;
+
+private:
+	friend class JsonDocument;
+
+	JsonNode(const JsonDocument* document, uint32_t index) : Document(document), Index(index) {}
+
+	const JsonDocument* Document = nullptr;
+	uint32_t Index = 0;
+};
+
+// Member count at which an object gets a hash index; below it a linear scan
+// over adjacent keys is faster than hashing the probe.
+inline constexpr std::size_t kJsonHashedObjectMembers = 16;
+
+//=============================================================================
+// JsonDocument
+//
+// Read-only JSON DOM for large documents. Where JsonValue gives every key and
+// string its own std::string and every container its own vector, a document
+// holds three flat arrays: nodes, the child lists of containers, and the hash
+// buckets of large objects. Keys and strings are string_views into the input
+// when they have no escapes; the rest are decoded into an arena the document
+// owns.
+//
+// The input must outlive the document. Parse with JsonParse instead when the
+// tree is to be edited or kept past its source.
+//=============================================================================
+class JsonDocument
+{
+public:
+	[[nodiscard]] static std::optional<JsonDocument> Parse(std::string_view input,
+	                                                       JsonParseError* error = nullptr);
+
+	[[nodiscard]] JsonNode Root() const { return JsonNode(this, 0); }
+	[[nodiscard]] std::size_t NodeCount() const { return Nodes.size(); }
+
+private:
+	friend class JsonNode;
+
+	struct Node
+	{
+		std::string_view Key;   // member key, for a direct child of an object
+		std::string_view Text;  // String
+		double Number = 0.0;    // Number
+		uint32_t First = 0;     // Array/Object: offset into Children
+		uint32_t Count = 0;     // Array/Object: element or member count
+		uint32_t Buckets = 0;   // hashed Object: offset into Buckets
+		uint32_t BucketMask = 0; // hashed Object: bucket count - 1, else 0
+		JsonNodeType Type = JsonNodeType::Null;
+		bool Bool = false;
+	};
+
+	JsonDocument() = default;
+
+	std::string_view StoreText(std::string_view text);
+	void CloseContainer(uint32_t node, std::vector<uint32_t>& pending, std::size_t firstPending);
+	void HashMembers(Node& object);
+
+	std::vector<Node> Nodes;
+	std::vector<uint32_t> Children;
+	std::vector<uint32_t> Buckets;
+
+	// Decoded strings. Blocks never move once allocated, so views into them
+	// survive the document being moved.
+	std::vector<std::unique_ptr<char[]>> ArenaBlocks;
+	std::size_t ArenaUsed = 0;
+	std::size_t ArenaCapacity = 0;
+};
@@ -8,11 +8,14 @@
 //=============================================================================
 // JsonParse
 //
-// Recursive descent JSON parser. Accepts a string_view and returns a
-// JsonValue on success, or std::nullopt with error details on failure.
+// Builds a JsonValue DOM from a string_view, or returns std::nullopt with
+// error details on failure. The grammar lives in JsonReader; this is one of
+// its consumers, and nesting depth is bounded by memory, not call stack.
 //
-// This is a load-time utility â€” not optimized for streaming or
-// incremental parsing. Intended for config files, not runtime data.
+// Every key and string becomes its own std::string, which suits config and
+// documents that are edited and written back. A large document that is only
+// read wants JsonDocument (string views into the input, hashed lookup in big
+// objects) or JsonReader directly.
 //=============================================================================
 
 struct JsonParseError
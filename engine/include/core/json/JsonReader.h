@@ -0,0 +1,106 @@
+#pragma once
+
+#include <core/json/JsonParser.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+//=============================================================================
+// JsonReader
+//
+// Pull parser over a JSON text: each Next() consumes one token and reports
+// what it was, without building anything. JsonParse and JsonDocument are both
+// built on it, and a reader that wants a handful of values out of a large
+// document (CollectAssetPaths over a cooked scene, say) can walk it directly
+// and keep nothing it does not need.
+//
+// String() is the unescaped text of the current Key or String token. A string
+// with no escapes is a view straight into the input, which is the common case;
+// one with escapes is decoded into a scratch buffer that the next Next()
+// reuses. StringInInput() tells the two apart for a caller that keeps views.
+//
+// Containers are tracked on an explicit stack rather than by recursion, so
+// nesting depth costs memory, not call stack. The first error stops the
+// reader: Next() returns Error from then on, and Error() holds the message
+// and byte offset in JsonParse's wording.
+//
+// The input must outlive the reader, and every view it hands out.
+//=============================================================================
+
+enum class JsonToken : uint8_t
+{
+	BeginObject,
+	EndObject,
+	BeginArray,
+	EndArray,
+	Key,
+	String,
+	Number,
+	Bool,
+	Null,
+	End,
+	Error,
+};
+
+class JsonReader
+{
+public:
+	explicit JsonReader(std::string_view input) : Input(input) {}
+
+	[[nodiscard]] JsonToken Next();
+
+	// Consumes the rest of the container the last BeginObject/BeginArray
+	// opened, through its closing token. After any other token it does
+	// nothing. False if the container is malformed.
+	bool SkipContainer();
+
+	[[nodiscard]] std::string_view String() const { return Text; }
+	[[nodiscard]] bool StringInInput() const { return TextInInput; }
+	[[nodiscard]] double Number() const { return NumberValue; }
+	[[nodiscard]] bool Bool() const { return BoolValue; }
+
+	// Containers currently open; 0 at the top level.
+	[[nodiscard]] std::size_t Depth() const { return Stack.size(); }
+
+	[[nodiscard]] bool Failed() const { return State == Expect::Failed; }
+	[[nodiscard]] const JsonParseError& Error() const { return ErrorInfo; }
+
+private:
+	enum class Expect : uint8_t
+	{
+		Value,
+		ValueOrEnd,
+		Key,
+		KeyOrEnd,
+		CommaOrEnd,
+		Done,
+		Failed,
+	};
+
+	JsonToken ReadValue();
+	JsonToken ReadKey();
+	JsonToken Close(char closer);
+	JsonToken Fail(std::string message);
+	bool ReadString();
+	bool ReadEscaped(std::size_t start, std::size_t special);
+	bool ReadNumber();
+	bool ConsumeDigits();
+	bool Match(std::string_view literal);
+	void SkipWhitespace();
+
+	std::string_view Input;
+	std::size_t Pos = 0;
+	Expect State = Expect::Value;
+	std::vector<char> Stack;
+
+	std::string_view Text;
+	bool TextInInput = true;
+	std::string Scratch;
+	double NumberValue = 0.0;
+	bool BoolValue = false;
+
+	JsonParseError ErrorInfo;
+};
@@ -15,7 +15,8 @@
 //
 // Object is stored as std::vector<pair<string, JsonValue>> to preserve
 // insertion order. Field lookup is linear â€” fine for config parsing,
-// not intended for hot-path use.
+// not intended for hot-path use. A large document that is only read
+// belongs in JsonDocument, which hashes big objects.
 //
 // This is a load-time / tooling type. Runtime systems should compile
 // JSON config into typed structs and numeric lookup tables.
@@ -21,6 +21,7 @@
 //   MakeField("mesh",   &Actor::Mesh).AsAsset(AssetType::StaticMesh)
 //   MakeField("mats",   &Actor::Mats).AsAsset(AssetType::Material, AssetArity::List)
 //   MakeField("pos",    &Actor::Pos).Quantize(-4096.0f, 4096.0f, 20)
+//   MakeField("rot",    &Actor::Rot).QuantizeRotation(12)
 //   MakeField("cooldown", &Actor::Cooldown).OwnerOnly()
 //   MakeField("blend",  &Actor::Blend).LocalOnly()
 //=============================================================================
@@ -31,16 +32,29 @@
 // Lossy fixed-point encoding for a float leaf: Bits bits spanning [Min, Max].
 // Bits == 0 means the leaf is carried at its natural width.
 //
+// SmallestThree is the unit-quaternion form: the largest of the four
+// components is dropped (it is implied by the other three and the unit
+// length), its index travels in two bits, and the remaining three take Bits
+// each over [-1/sqrt(2), 1/sqrt(2)] -- the only range a non-largest component
+// of a unit quaternion can occupy. It applies to a four-float leaf only.
+//
 // This is a property of the data, not of any one consumer: it states the range
 // the value actually occupies and the precision it is meaningful to. A wire
 // codec reads it to pack; an editor could read the same range to bound a
 // slider.
 //=============================================================================
+enum class FieldQuantizationKind : std::uint8_t
+{
+    Range,
+    SmallestThree,
+};
+
 struct FieldQuantization
 {
     float Min = 0.0f;
     float Max = 0.0f;
     std::uint8_t Bits = 0;
+    FieldQuantizationKind Kind = FieldQuantizationKind::Range;
 
     [[nodiscard]] constexpr bool IsQuantized() const { return Bits > 0; }
     bool operator==(const FieldQuantization&) const = default;
@@ -119,6 +133,16 @@ struct Field
         return *this;
     }
 
+    // A unit quaternion, carried as its smallest three components at `bits`
+    // each. Ten bits holds orientation to about a tenth of a degree.
+    Field& QuantizeRotation(std::uint8_t bits)
+    {
+        constexpr float kSqrtHalf = 0.70710678f;
+        Quantization = FieldQuantization{ -kSqrtHalf, kSqrtHalf, bits,
+                                          FieldQuantizationKind::SmallestThree };
+        return *this;
+    }
+
     Field& OwnerOnly()
     {
         IsOwnerOnly = true;
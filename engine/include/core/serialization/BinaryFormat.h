@@ -51,8 +51,8 @@ struct ChunkHeader
 // ChunkWriter
 //
 // Helper for writing a chunk whose payload size is not known upfront.
-// Call Begin() before writing the payload, then End() afterwards to seek
-// back and patch the size field. Requires a seekable output stream.
+// Call Begin() before writing the payload, then End() afterwards to patch
+// the size field. Requires a GrowableWriter or a seekable output stream.
 //
 // Usage:
 //   ChunkWriter chunk;
@@ -67,8 +67,8 @@ public:
     [[nodiscard]] bool End(BinaryWriter& writer);
 
 private:
-    std::streampos SizeFieldPos    = -1;
-    std::streampos PayloadStartPos = -1;
+    std::streamoff SizeFieldPos    = -1;
+    std::streamoff PayloadStartPos = -1;
 };
 
 //=============================================================================
@@ -79,6 +79,10 @@ private:
 // (useful for forward-compatible readers that encounter unknown chunk
 // versions with extra trailing fields).
 //
+// Over memory, ReadHeader rejects a chunk whose Size runs past the end of the
+// bytes, so the payload reads inside it are checked against a range already
+// known to exist.
+//
 // Usage:
 //   ChunkReader chunk;
 //   chunk.ReadHeader(reader);
@@ -95,5 +99,5 @@ public:
 
 private:
     ChunkHeader Header{};
-    std::streampos PayloadStartPos = -1;
+    std::streamoff PayloadStartPos = -1;
 };
@@ -1,35 +1,85 @@
 #pragma once
 
+#include <core/serialization/SpanReader.h>
+
+#include <cassert>
+#include <cstddef>
 #include <istream>
 #include <type_traits>
+#include <vector>
 
 //=============================================================================
 // BinaryReader
 //
-// Utility for reading binary data from a stream.
+// Utility for reading binary data from a stream or from memory.
 // Intended for low-level deserialization of trivial binary values and raw bytes.
 // Higher-level formats should build on top of this rather than storing runtime
 // object graphs directly.
+//
+// Over a SpanReader every read is the SpanReader's inlined bounds check and
+// memcpy; over a std::istream it is a streambuf call. Formats read through
+// BinaryReader either way, so a caller holding the bytes in memory (a mapped
+// file, a cooked package, a buffer it just wrote) should hand it a SpanReader.
+// Tell/Seek/AtEnd work on both; GetStream is for stream-only callers.
 //=============================================================================
 class BinaryReader
 {
 public:
-    explicit BinaryReader(std::istream& stream) : Stream(stream) {}
+    explicit BinaryReader(std::istream& stream) : Stream(&stream) {}
+    explicit BinaryReader(SpanReader& memory) : Memory(&memory) {}
 
     template<typename T>
     [[nodiscard]]
     bool Read(T& value)
     {
         static_assert(std::is_trivially_copyable_v<T>);
-        return ReadBytes(reinterpret_cast<char*>(&value), sizeof(T));
+        if (Memory != nullptr)
+            return Memory->Read(value);
+        return ReadFromStream(reinterpret_cast<char*>(&value), sizeof(T));
     }
 
     [[nodiscard]]
-    bool ReadBytes(char* buffer, std::streamsize count);
+    bool ReadBytes(char* buffer, std::streamsize count)
+    {
+        if (count < 0) return false;
+        if (Memory != nullptr)
+            return Memory->ReadBytes(buffer, static_cast<std::size_t>(count));
+        return ReadFromStream(buffer, count);
+    }
 
-    // Direct stream access for seekable operations (e.g. chunk skipping).
-    std::istream& GetStream() { return Stream; }
+    // Replaces `out` with the next `count` values of T in one bulk copy. A
+    // memory source rejects a count its remaining bytes cannot hold before
+    // allocating; a stream source cannot know, so callers bound `count`.
+    template<typename T>
+    [[nodiscard]]
+    bool ReadArray(std::vector<T>& out, std::size_t count)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        if (Memory != nullptr)
+            return Memory->ReadArray(out, count);
+        out.resize(count);
+        return ReadFromStream(reinterpret_cast<char*>(out.data()),
+                              static_cast<std::streamsize>(count * sizeof(T)));
+    }
+
+    // Absolute read position, or -1 when the source cannot report one.
+    [[nodiscard]] std::streamoff Tell();
+    [[nodiscard]] bool Seek(std::streamoff position);
+    [[nodiscard]] bool AtEnd();
+
+    // The memory source, or null for a stream reader.
+    [[nodiscard]] SpanReader* MemorySource() const { return Memory; }
+
+    // Direct stream access for stream-only operations. Not valid over memory.
+    std::istream& GetStream()
+    {
+        assert(Stream != nullptr && "BinaryReader::GetStream on a memory reader");
+        return *Stream;
+    }
 
 private:
-    std::istream& Stream;
+    [[nodiscard]] bool ReadFromStream(char* buffer, std::streamsize count);
+
+    std::istream* Stream = nullptr;
+    SpanReader* Memory = nullptr;
 };
@@ -1,35 +1,91 @@
 #pragma once
 
+#include <core/serialization/GrowableWriter.h>
+
+#include <cassert>
+#include <cstddef>
 #include <ostream>
 #include <type_traits>
 
 //=============================================================================
 // BinaryWriter
 //
-// Utility for writing binary data to a stream.
+// Utility for writing binary data to a stream or to memory.
 // Intended for low-level serialization of trivial binary values and raw bytes.
 // Higher-level formats should build on top of this rather than storing runtime
 // object graphs directly.
+//
+// Over a GrowableWriter every write is an append to its vector; over a
+// std::ostream it is a streambuf call. A caller that wants the bytes in memory
+// should hand it a GrowableWriter rather than an ostringstream. Tell/WriteAt
+// work on both; GetStream is for stream-only callers.
 //=============================================================================
 class BinaryWriter
 {
 public:
-    explicit BinaryWriter(std::ostream& stream) : Stream(stream) {}
+    explicit BinaryWriter(std::ostream& stream) : Stream(&stream) {}
+    explicit BinaryWriter(GrowableWriter& memory) : Memory(&memory) {}
 
     template<typename T>
     [[nodiscard]]
     bool Write(const T& value)
     {
         static_assert(std::is_trivially_copyable_v<T>);
-        return WriteBytes(reinterpret_cast<const char*>(&value), sizeof(T));
+        if (Memory != nullptr)
+        {
+            Memory->Write(value);
+            return true;
+        }
+        return WriteToStream(reinterpret_cast<const char*>(&value), sizeof(T));
     }
 
     [[nodiscard]]
-    bool WriteBytes(const char* buffer, std::streamsize count);
+    bool WriteBytes(const char* buffer, std::streamsize count)
+    {
+        if (count < 0) return false;
+        if (Memory != nullptr)
+        {
+            Memory->WriteBytes(buffer, static_cast<std::size_t>(count));
+            return true;
+        }
+        return WriteToStream(buffer, count);
+    }
 
-    // Direct stream access for seekable operations (e.g. chunk size patching).
-    std::ostream& GetStream() { return Stream; }
+    // Absolute write position, or -1 when the sink cannot report one.
+    [[nodiscard]] std::streamoff Tell();
+
+    // Overwrites bytes already written at `position` and leaves the write
+    // position at the end (e.g. chunk size patching).
+    template<typename T>
+    [[nodiscard]]
+    bool WriteAt(std::streamoff position, const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        if (position < 0) return false;
+        if (Memory != nullptr)
+        {
+            if (static_cast<std::size_t>(position) + sizeof(T) > Memory->Size())
+                return false;
+            Memory->PatchAt(static_cast<std::size_t>(position), value);
+            return true;
+        }
+        return WriteToStreamAt(position, reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    // The memory sink, or null for a stream writer.
+    [[nodiscard]] GrowableWriter* MemorySink() const { return Memory; }
+
+    // Direct stream access for stream-only operations. Not valid over memory.
+    std::ostream& GetStream()
+    {
+        assert(Stream != nullptr && "BinaryWriter::GetStream on a memory writer");
+        return *Stream;
+    }
 
 private:
-    std::ostream& Stream;
-};
\ No newline at end of file
+    [[nodiscard]] bool WriteToStream(const char* buffer, std::streamsize count);
+    [[nodiscard]] bool WriteToStreamAt(std::streamoff position, const char* buffer, std::streamsize count);
+
+    std::ostream* Stream = nullptr;
+    GrowableWriter* Memory = nullptr;
+};
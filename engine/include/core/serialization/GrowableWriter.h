@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+//=============================================================================
+// GrowableWriter
+//
+// Appends trivially copyable values to a byte vector it owns: the memory
+// counterpart of writing to a std::ostringstream, without the stream, its
+// virtual calls, or the copy out of str() at the end. Take() moves the bytes
+// out.
+//
+// Writes cannot fail short of allocation. PatchAt overwrites bytes already
+// written, which is how a chunk's size field is filled in once its payload is
+// known.
+//
+// The vector is grown ahead of the write cursor and Used marks the end of the
+// written bytes, so an append is a compare and a memcpy rather than a
+// vector::resize that zero-fills each value it appends.
+//=============================================================================
+class GrowableWriter
+{
+public:
+    GrowableWriter() = default;
+    explicit GrowableWriter(std::size_t reserveBytes) { Buffer.resize(reserveBytes); }
+
+    template<typename T>
+    void Write(const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        WriteBytes(&value, sizeof(T));
+    }
+
+    void WriteBytes(const void* data, std::size_t count)
+    {
+        if (count == 0)
+            return;
+        if (Buffer.size() - Used < count)
+            Grow(count);
+        std::memcpy(Buffer.data() + Used, data, count);
+        Used += count;
+    }
+
+    template<typename T>
+    void WriteArray(std::span<const T> values)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        WriteBytes(values.data(), values.size_bytes());
+    }
+
+    template<typename T>
+    void PatchAt(std::size_t offset, const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        assert(offset + sizeof(T) <= Used && "GrowableWriter: patch past the written bytes");
+        std::memcpy(Buffer.data() + offset, &value, sizeof(T));
+    }
+
+    void Reserve(std::size_t bytes)
+    {
+        if (Buffer.size() < bytes)
+            Buffer.resize(bytes);
+    }
+
+    void Clear() { Used = 0; }
+
+    [[nodiscard]] std::size_t Size() const { return Used; }
+    [[nodiscard]] bool Empty() const { return Used == 0; }
+    [[nodiscard]] std::span<const std::byte> Bytes() const { return std::span(Buffer).first(Used); }
+
+    [[nodiscard]] std::vector<std::byte> Take()
+    {
+        Buffer.resize(Used);
+        Used = 0;
+        return std::exchange(Buffer, {});
+    }
+
+private:
+    void Grow(std::size_t count)
+    {
+        std::size_t capacity = Buffer.size() < 256 ? 256 : Buffer.size();
+        while (capacity - Used < count)
+            capacity *= 2;
+        Buffer.resize(capacity);
+    }
+
+    std::vector<std::byte> Buffer;
+    std::size_t Used = 0;
+};
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+//=============================================================================
+// SpanReader
+//
+// Reads trivially copyable values out of contiguous memory: a cursor over a
+// std::span, no stream and no virtual call per read. Every read is one
+// compare against the end and a memcpy, inlined.
+//
+// Bounds are checked per read; TakeSubspan checks a whole chunk once and
+// hands back a reader confined to it, so a payload whose fields overrun the
+// chunk fails there instead of reading into the next one. ReadArray checks a
+// column of T once and copies it in one memcpy.
+//
+// A failed read leaves the cursor where it was and latches Ok() false.
+//=============================================================================
+class SpanReader
+{
+public:
+    SpanReader() = default;
+    explicit SpanReader(std::span<const std::byte> bytes) : Bytes(bytes) {}
+
+    template<typename T>
+    [[nodiscard]]
+    bool Read(T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        if (Remaining() < sizeof(T))
+            return Fail();
+        std::memcpy(&value, Bytes.data() + Cursor, sizeof(T));
+        Cursor += sizeof(T);
+        return true;
+    }
+
+    [[nodiscard]]
+    bool ReadBytes(void* buffer, std::size_t count)
+    {
+        if (Remaining() < count)
+            return Fail();
+        if (count > 0)
+            std::memcpy(buffer, Bytes.data() + Cursor, count);
+        Cursor += count;
+        return true;
+    }
+
+    // Replaces `out` with the next `count` values of T.
+    template<typename T>
+    [[nodiscard]]
+    bool ReadArray(std::vector<T>& out, std::size_t count)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        if (count > Remaining() / sizeof(T))
+            return Fail();
+        out.resize(count);
+        return ReadBytes(out.data(), count * sizeof(T));
+    }
+
+    // The next `size` bytes as their own reader; this one moves past them.
+    [[nodiscard]]
+    bool TakeSubspan(std::size_t size, SpanReader& out)
+    {
+        if (Remaining() < size)
+            return Fail();
+        out = SpanReader(Bytes.subspan(Cursor, size));
+        Cursor += size;
+        return true;
+    }
+
+    [[nodiscard]]
+    bool Skip(std::size_t count)
+    {
+        if (Remaining() < count)
+            return Fail();
+        Cursor += count;
+        return true;
+    }
+
+    // Absolute position; the end itself is a valid target.
+    [[nodiscard]]
+    bool Seek(std::size_t offset)
+    {
+        if (offset > Bytes.size())
+            return Fail();
+        Cursor = offset;
+        return true;
+    }
+
+    [[nodiscard]] std::size_t Position() const { return Cursor; }
+    [[nodiscard]] std::size_t Size() const { return Bytes.size(); }
+    [[nodiscard]] std::size_t Remaining() const { return Bytes.size() - Cursor; }
+    [[nodiscard]] bool AtEnd() const { return Cursor == Bytes.size(); }
+    [[nodiscard]] bool Ok() const { return IsOk; }
+
+    // The unread remainder, for a decoder that wants the bytes in place.
+    [[nodiscard]] std::span<const std::byte> Unread() const { return Bytes.subspan(Cursor); }
+
+private:
+    bool Fail()
+    {
+        IsOk = false;
+        return false;
+    }
+
+    std::span<const std::byte> Bytes;
+    std::size_t Cursor = 0;
+    bool IsOk = true;
+};
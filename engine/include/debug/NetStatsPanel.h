@@ -9,13 +9,17 @@ class NetSession;
 class NetStats;
 class NetTickEstimator;
 class PeerCommandRuntime;
+class PredictionRuntime;
+class SnapshotInterpolation;
 
 //=============================================================================
 // NetStatsPanel
 //
 // Debug-overlay window over a live session: role and identity, traffic rates by
 // payload kind, and one row per peer with the round trip, the strike count, and
-// how deep that peer's input is buffered.
+// how deep that peer's input is buffered. On a client, how often its prediction
+// disagreed with the authority and what putting that right cost, and how far
+// behind the newest snapshot other players' entities are being drawn.
 //
 // Buffer depth earns its place next to the round trip because the two are the
 // same measurement from opposite ends. A peer whose ping is fine and whose
@@ -34,6 +38,8 @@ public:
                   const NetStats& traffic,
                   const NetTickEstimator& clock,
                   PeerCommandRuntime& commands,
+                  const PredictionRuntime& prediction,
+                  const SnapshotInterpolation& interpolation,
                   ConsoleRegistry& console);
 
     void Draw() override;
@@ -43,5 +49,7 @@ private:
     const NetStats& Traffic;
     const NetTickEstimator& Clock;
     PeerCommandRuntime& Commands;
+    const PredictionRuntime& Prediction;
+    const SnapshotInterpolation& Interpolation;
     ConsoleRegistry& Console;
 };
@@ -11,8 +11,8 @@ class ConsoleRegistry;
 //
 // Debug-overlay window over the renderer counter history: the active
 // render.profile.mode, the last completed frame's RenderStats grouped by
-// producer (forward pass, lights, shadow residency, frame services), and the
-// shadow cache hit rate. Reads the engine-owned mode and ring by reference;
+// producer (forward pass, lights, shadow residency, texture streaming, frame
+// services), and the shadow cache hit rate. Reads the engine-owned mode and ring by reference;
 // draws a hint instead of numbers while the mode is Off.
 //=============================================================================
 class RenderStatsPanel : public IDebugPanel
@@ -6,11 +6,13 @@
 #include <ecs/EntityId.h>
 #include <ecs/StoragePartitionId.h>
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <memory>
+#include <span>
 #include <unordered_map>
 #include <vector>
 
@@ -105,15 +107,7 @@ struct Archetype
         }
         else
         {
-            auto chunk = std::make_unique<Chunk>();
-            chunk->RowCount           = 0;
-            chunk->RowCapacity        = RowsPerChunk;
-            chunk->Partition          = partition;
-            chunk->Columns            = Columns.data();
-            chunk->ColumnCount        = static_cast<uint32_t>(Columns.size());
-            chunk->LastWrittenFrames.assign(Columns.size(), 0);
-            chunk->EntityColumnOffset = EntityColumnOffset_;
-            Chunks.push_back(std::move(chunk));
+            Chunks.push_back(NewChunk(partition));
             index = static_cast<uint32_t>(Chunks.size()) - 1;
         }
 
@@ -162,6 +156,44 @@ struct Archetype
         return { ci, ri };
     }
 
+    // A run of rows AddRows appended to one chunk.
+    struct RowRun
+    {
+        uint32_t ChunkIndex = 0;
+        uint32_t FirstRow   = 0;
+        uint32_t Count      = 0;
+    };
+
+    // Bulk AddRow: appends as many of `entityIndices` as the partition's current
+    // chunk has room for (allocating one when it is full) and stamps the chunk
+    // once. Callers loop until every index has landed; a run never spans chunks,
+    // so each one is a contiguous slice of every column.
+    RowRun AddRows(
+        std::span<const EntityIndex> entityIndices,
+        StoragePartitionId partition = StoragePartitionId::Default(),
+        uint32_t frame = 0)
+    {
+        assert(!entityIndices.empty());
+        Chunk* chunk = GetOrAllocChunkWithSpace(partition);
+        const uint32_t ci = LastChunkByPartition_[partition.Value];
+        const uint32_t space = chunk->RowCapacity - chunk->RowCount;
+        const uint32_t count = static_cast<uint32_t>(
+            std::min<size_t>(space, entityIndices.size()));
+
+        const uint32_t first = chunk->RowCount;
+        std::memcpy(chunk->EntityIndices() + first, entityIndices.data(),
+                    count * sizeof(EntityIndex));
+        chunk->RowCount += count;
+
+        for (uint32_t col = 0; col < chunk->ColumnCount; ++col)
+        {
+            if (chunk->ColumnLastWrittenFrame(col) != frame)
+                chunk->BumpColumnVersion(col, frame);
+        }
+
+        return { ci, first, count };
+    }
+
     // Swap-and-pop remove. Returns the EntityIndex of the row that was moved
     // into the vacated slot (InvalidEntityIndex if the removed row was already last).
     // The caller must update EntityRegistry location for the moved entity.
@@ -238,11 +270,39 @@ struct Archetype
         }
     }
 
+    // Hands one slab to the caller whole, rows and all, for a partition leaving
+    // the World (World::DetachPartition). The slot keeps its index and gets a
+    // fresh empty slab on the free list, so no live row is renumbered. The
+    // detached chunk's Columns still point into this archetype; the caller
+    // repoints them before the slab leaves the owner thread, and owns the
+    // entity bookkeeping for every row it carried.
+    std::unique_ptr<Chunk> DetachChunk(uint32_t chunkIdx)
+    {
+        assert(chunkIdx < Chunks.size());
+        std::unique_ptr<Chunk> detached = std::move(Chunks[chunkIdx]);
+        Chunks[chunkIdx] = NewChunk(detached->Partition);
+        ReleaseChunk(chunkIdx);
+        return detached;
+    }
+
     // Slabs held but holding nothing: the reclamation signal. Diagnostics and
     // tests only.
     size_t FreeChunkCount() const { return FreeChunks_.size(); }
 
 private:
+    std::unique_ptr<Chunk> NewChunk(StoragePartitionId partition) const
+    {
+        auto chunk = std::make_unique<Chunk>();
+        chunk->RowCount           = 0;
+        chunk->RowCapacity        = RowsPerChunk;
+        chunk->Partition          = partition;
+        chunk->Columns            = Columns.data();
+        chunk->ColumnCount        = static_cast<uint32_t>(Columns.size());
+        chunk->LastWrittenFrames.assign(Columns.size(), 0);
+        chunk->EntityColumnOffset = EntityColumnOffset_;
+        return chunk;
+    }
+
     void ReleaseChunk(uint32_t chunkIdx)
     {
         Chunk& chunk = *Chunks[chunkIdx];
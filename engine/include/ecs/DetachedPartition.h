@@ -0,0 +1,57 @@
+#pragma once
+
+#include <ecs/ArchetypeSignature.h>
+#include <ecs/Chunk.h>
+#include <ecs/StoragePartitionId.h>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// The rows of one archetype that a detached partition held: the partition's
+// chunk slabs of that archetype, moved out whole, and a private copy of the
+// column layout they are read through.
+//
+// Each chunk's Columns pointer is repointed at this block's Columns before the
+// partition leaves World::DetachPartition. A std::vector keeps its buffer when
+// it is moved, so blocks move freely; they are not copyable.
+struct DetachedArchetype
+{
+    ArchetypeSignature Signature;
+    std::vector<ColumnDescriptor> Columns;
+    std::vector<std::unique_ptr<Chunk>> Chunks;
+};
+
+// DetachedPartition: a storage partition after World::DetachPartition. The
+// World has already fired every remove hook and released every entity id, and
+// nothing in it points into these slabs, so the package is plain data that any
+// one thread may read — the component values exactly as they stood at detach.
+//
+// EntityIndices in the slabs name entities that no longer exist; they order
+// rows and nothing more. ComponentIds in the column layout are the detaching
+// World's, so a reader resolves the ones it needs on the owner thread first.
+// See docs/ecs/parallelization.md (zone detach).
+struct DetachedPartition
+{
+    StoragePartitionId Partition = StoragePartitionId::Default();
+    std::vector<DetachedArchetype> Archetypes;
+
+    size_t RowCount() const
+    {
+        size_t count = 0;
+        for (const DetachedArchetype& archetype : Archetypes)
+            for (const auto& chunk : archetype.Chunks)
+                count += chunk->RowCount;
+        return count;
+    }
+
+    size_t ChunkCount() const
+    {
+        size_t count = 0;
+        for (const DetachedArchetype& archetype : Archetypes)
+            count += archetype.Chunks.size();
+        return count;
+    }
+
+    bool IsEmpty() const { return Archetypes.empty(); }
+};
@@ -9,6 +9,7 @@
 #include <ecs/CommandBuffer.h>
 #include <ecs/ComponentId.h>
 #include <ecs/ComponentTraits.h>
+#include <ecs/DetachedPartition.h>
 #include <ecs/EntityId.h>
 #include <ecs/EntityRegistry.h>
 #include <ecs/Query.h>
@@ -5,6 +5,7 @@
 #include <ecs/ComponentId.h>
 #include <ecs/ComponentTraits.h>
 #include <ecs/ComponentTypeId.h>
+#include <ecs/DetachedPartition.h>
 #include <ecs/EntityId.h>
 #include <ecs/EntityRegistry.h>
 #include <ecs/StoragePartitionId.h>
@@ -43,6 +44,11 @@ struct ComponentMeta
     // destruction and World teardown. Typed remove paths dispatch the trait
     // directly. Null when T has no OnRemove hook or is a tag.
     void (*OnRemoveHook)(const void* component, World& world, EntityId entity) = nullptr;
+
+    // The OnAdd counterpart, for rows whose columns were filled as bytes rather
+    // than through a typed write: CreateEntitiesWithSignature. Null when T has
+    // no OnAdd hook or is a tag.
+    void (*OnAddHook)(void* component, World& world, EntityId entity) = nullptr;
 };
 
 struct ComponentBatchItem
@@ -159,6 +165,12 @@ public:
                 ComponentTraits<T>::OnRemove(*static_cast<const T*>(ptr), w, e);
             };
         }
+        if constexpr (!std::is_empty_v<T> && ComponentHasOnAdd<T>)
+        {
+            meta.OnAddHook = [](void* ptr, World& w, EntityId e) {
+                ComponentTraits<T>::OnAdd(*static_cast<T*>(ptr), w, e);
+            };
+        }
         ComponentMetas.push_back(meta);
 
         return id;
@@ -277,6 +289,72 @@ public:
         }
     }
 
+    // Bulk CreateEntityWithSignature for rows whose column bytes already exist
+    // in the chunk layout (a baked zone chunk image). Creates out.size()
+    // entities at `sig` in `partition` and hands each run of rows that landed in
+    // one chunk to write(chunk, firstRow, firstEntity, count), which must fill
+    // every data column for rows [firstRow, firstRow + count) from entities
+    // [firstEntity, firstEntity + count). OnAdd then fires for hooked columns,
+    // row by row, exactly as InitializeComponent would have.
+    //
+    // One structural bump and one column stamp per chunk rather than per entity:
+    // the run is what a column memcpy covers, so nothing finer is observable.
+    template <typename WriteRun>
+    void CreateEntitiesWithSignature(
+        StoragePartitionId partition,
+        const ArchetypeSignature& sig,
+        std::span<EntityId> out,
+        WriteRun&& write)
+    {
+        assert(QueryDepth == 0 && LifecycleHookDepth == 0
+               && "CreateEntitiesWithSignature called while a query/lifecycle hook is active.");
+        if (out.empty())
+            return;
+
+        EntityCreated = true;
+        BumpStructural(partition);
+        Archetype* arch = GetOrCreateArchetype(sig);
+
+        std::vector<EntityIndex> indices(out.size());
+        for (size_t i = 0; i < out.size(); ++i)
+        {
+            out[i] = Entities.Create();
+            indices[i] = out[i].Index;
+        }
+
+        size_t placed = 0;
+        while (placed < out.size())
+        {
+            const Archetype::RowRun run = arch->AddRows(
+                std::span<const EntityIndex>(indices).subspan(placed),
+                partition,
+                FrameCounter);
+            Chunk& chunk = *arch->Chunks[run.ChunkIndex];
+            for (uint32_t row = 0; row < run.Count; ++row)
+            {
+                Entities.SetLocation(out[placed + row], EntityLocation{
+                    arch->Id, run.ChunkIndex, run.FirstRow + row, partition });
+            }
+
+            write(chunk, run.FirstRow, placed, run.Count);
+
+            for (uint32_t col = 0; col < chunk.ColumnCount; ++col)
+            {
+                const auto hook = ComponentMetas[chunk.Columns[col].Id].OnAddHook;
+                if (hook == nullptr)
+                    continue;
+                const size_t stride = chunk.Columns[col].Stride;
+                ScopedLifecycleHook hookScope(*this);
+                for (uint32_t row = 0; row < run.Count; ++row)
+                {
+                    hook(chunk.ColumnData(col) + (run.FirstRow + row) * stride,
+                         *this, out[placed + row]);
+                }
+            }
+            placed += run.Count;
+        }
+    }
+
     void DestroyEntity(EntityId entity)
     {
         assert(QueryDepth == 0 && LifecycleHookDepth == 0
@@ -384,6 +462,72 @@ public:
         return entities.size();
     }
 
+    // Removes a partition's rows by moving its chunk slabs out of the World
+    // rather than destroying them row by row. Remove hooks fire for every row
+    // first, while the whole partition is still alive, then the ids are
+    // released and each slab leaves whole: no swap-remove, no column copy. The
+    // returned package holds the component values as they stood, for readers
+    // that run off the owner thread (see DetachedPartition).
+    //
+    // Each archetype keeps a fresh empty slab in every slot it gave up, so the
+    // World's chunk indices never move.
+    DetachedPartition DetachPartition(StoragePartitionId partition)
+    {
+        assert(QueryDepth == 0 && LifecycleHookDepth == 0
+               && "DetachPartition called while a query/lifecycle hook is active.");
+
+        DetachedPartition detached;
+        detached.Partition = partition;
+
+        for (const auto& archetype : ArchetypeList)
+        {
+            for (uint32_t ci = 0; ci < archetype->Chunks.size(); ++ci)
+            {
+                const Chunk& chunk = *archetype->Chunks[ci];
+                if (chunk.Partition != partition || chunk.IsEmpty())
+                    continue;
+                for (uint32_t row = 0; row < chunk.RowCount; ++row)
+                {
+                    const EntityIndex index = chunk.EntityIndices()[row];
+                    FireRemoveHooks(
+                        EntityId{ index, Entities.GenerationForIndex(index) },
+                        EntityLocation{ archetype->Id, ci, row, partition });
+                }
+            }
+        }
+
+        for (const auto& archetype : ArchetypeList)
+        {
+            DetachedArchetype* block = nullptr;
+            for (uint32_t ci = 0; ci < archetype->Chunks.size(); ++ci)
+            {
+                const Chunk& chunk = *archetype->Chunks[ci];
+                if (chunk.Partition != partition || chunk.IsEmpty())
+                    continue;
+
+                for (uint32_t row = 0; row < chunk.RowCount; ++row)
+                {
+                    const EntityIndex index = chunk.EntityIndices()[row];
+                    Entities.Destroy(EntityId{ index, Entities.GenerationForIndex(index) });
+                }
+
+                if (block == nullptr)
+                {
+                    block = &detached.Archetypes.emplace_back();
+                    block->Signature = archetype->Signature;
+                    block->Columns = archetype->Columns;
+                }
+                std::unique_ptr<Chunk> slab = archetype->DetachChunk(ci);
+                slab->Columns = block->Columns.data();
+                block->Chunks.push_back(std::move(slab));
+            }
+        }
+
+        if (!detached.IsEmpty())
+            BumpStructural(partition);
+        return detached;
+    }
+
     std::span<const EntityPartitionMove> PendingPartitionMoves() const
     {
         return { PartitionMoves.data(), PartitionMoves.size() };
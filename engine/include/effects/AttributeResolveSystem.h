@@ -14,5 +14,7 @@ struct FixedLogicContext;
 class AttributeResolveSystem
 {
 public:
+    static constexpr bool Resimulated = true;
+
     void FixedLogic(FixedLogicContext& ctx);
 };
@@ -9,11 +9,14 @@
 #include <graphics/vulkan/VulkanImageService.h>
 #include <graphics/vulkan/VulkanSamplerCache.h>
 #include <render/TextureHandle.h>
+#include <render/TextureResidency.h>
 
 #include <cstdint>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 
 //=============================================================================
 // TextureEntry
@@ -30,6 +33,14 @@ struct TextureEntry
     // (Stage 6) can repoint the same bindless slot at the new image with the
     // original sampler.
     SamplerDesc        Sampler{};
+    // Mip streaming: the cooked texture the entry streams from, retained so
+    // levels can be rebuilt without another read, and the top level the GPU
+    // image currently holds. Null source means the whole chain is resident
+    // and the entry does not stream.
+    std::shared_ptr<const TextureData> StreamSource;
+    uint32_t           ResidentTopMip = 0;
+    // Bytes of pixel data the GPU image holds, for the warm cache.
+    uint64_t           GpuBytes = 0;
     uint32_t           Generation = 0;
     uint32_t           RefCount   = 0;
     std::string        PathKey;
@@ -48,6 +59,8 @@ struct TextureEntry
 //   - CreateFromImage(): upload from a caller-supplied CPU Image (no dedup)
 //   - GetBindlessIndex(): descriptor index for use in per-instance draw data
 //   - GetExtent(): pixel dimensions of the uploaded image
+//   - Mip streaming: cooked textures commit their mip tail only and grow
+//     toward on-screen demand under a resident budget (TextureResidency)
 //=============================================================================
 class TextureCache : public AssetCache<TextureCache, TextureHandle, TextureEntry, AssetType::Texture>
 {
@@ -93,6 +106,14 @@ public:
                                                       const TextureData& texture,
                                                       const SamplerDesc& sampler = {});
 
+    // Consuming variant, the loader's commit path. With mip streaming on, a
+    // named texture whose chain reaches above the mip tail uploads only the
+    // tail and keeps `texture` (a borrowed view keeps its owner alive) to
+    // stream the upper levels from; otherwise identical to the above.
+    [[nodiscard]] TextureHandle CreateFromTextureData(std::string_view name,
+                                                      TextureData&& texture,
+                                                      const SamplerDesc& sampler = {});
+
     // Returns the handle registered under `name` without affecting refcounts,
     // or an invalid handle if none exists.
     [[nodiscard]] TextureHandle Find(std::string_view name) const;
@@ -108,18 +129,48 @@ public:
     // the old image through the deletion queue. The handle, slot, generation,
     // and refcount are all preserved — zero handle invalidation. Returns
     // false if `path` has no live entry (nothing to reload).
+    // A streamed entry keeps streaming: the reload retains a copy of the new
+    // texture and rebuilds at the levels the entry held, clamped to the new
+    // tail.
     [[nodiscard]] bool ReloadInPlace(std::string_view path, const TextureData& texture);
     [[nodiscard]] bool ReloadInPlace(std::string_view path, const Image& image);
 
+    // -- Mip streaming ----------------------------------------------------------
+    //
+    // Off until a render pipeline that feeds demand turns it on; a cache
+    // nobody drives keeps uploading whole chains, since a streamed texture
+    // with no demand would sit at its tail forever. Enabling affects only
+    // textures committed afterwards.
+    void EnableMipStreaming() { MipStreaming = true; }
+    [[nodiscard]] bool IsMipStreaming() const { return MipStreaming; }
+
+    // Owner-thread, once per frame after extraction: decides this frame's
+    // promotions and evictions and applies them. Each one builds an image
+    // holding the new levels from the retained source and repoints the
+    // entry's bindless slot, exactly as a hot reload does, so materials never
+    // see a change. A failed rebuild leaves the entry as it was.
+    void UpdateMipStreaming(const TextureStreamingDemand& demand,
+                            const TextureStreamingBudgets& budgets,
+                            double nowMs);
+
+    [[nodiscard]] const TextureStreamingFrameStats& GetMipStreamingStats() const
+    {
+        return Residency.FrameStats();
+    }
+
+    // The largest level the entry's GPU image holds; 0 for whole-chain
+    // entries.
+    [[nodiscard]] uint32_t GetResidentTopMip(TextureHandle handle) const;
+
     // -- Accessors ------------------------------------------------------------
 
     [[nodiscard]] BindlessImageIndex GetBindlessIndex(TextureHandle handle) const;
     [[nodiscard]] VkExtent2D         GetExtent(TextureHandle handle) const;
 
-    // The entry's current GPU image. Not stable across hot reloads: a reload
-    // swaps the entry's image in place, so a caller holding a view or
-    // descriptor built from it must compare against this each frame and
-    // rebuild when it changes.
+    // The entry's current GPU image. Not stable across hot reloads or mip
+    // streaming: both swap the entry's image in place, so a caller holding a
+    // view or descriptor built from it must compare against this each frame
+    // and rebuild when it changes.
     [[nodiscard]] ImageHandle        GetGpuImage(TextureHandle handle) const;
 
     // The sampler a cooked texture asks for (the TextureData -> Vulkan mapping
@@ -134,6 +185,7 @@ private:
     // AssetCache CRTP hooks.
     void OnFree(TextureEntry& entry);
     bool IsEntryLive(const TextureEntry& entry) const;
+    AssetFootprint WarmFootprint(const TextureEntry& entry) const;
 
     // Uploads `image` to the GPU and populates `out` with the resulting GPU
     // handles. Does not allocate a cache slot. Used by the CreateFromImage
@@ -145,20 +197,36 @@ private:
     // cache entry. Invalid handle on failure. Shared by the create and reload
     // paths so the upload logic lives in one place.
     [[nodiscard]] ImageHandle UploadGpuImage(const Image& image, const char* debugName);
-    [[nodiscard]] ImageHandle UploadGpuImage(const TextureData& texture, std::string_view name);
-
-    // Reload body: swaps `newImage` into the resident entry for `path`,
-    // repointing its bindless slot and deferring the old image. Destroys
+    // `topMip` skips the levels above it: the image is created at that
+    // level's extent holding it and everything below.
+    [[nodiscard]] ImageHandle UploadGpuImage(const TextureData& texture, std::string_view name,
+                                             uint32_t topMip = 0);
+
+    // Reload body: swaps `newImage` (`gpuBytes` of pixel data) into the
+    // resident entry for `path`, repointing its bindless slot and deferring
+    // the old image. Destroys
     // `newImage` and returns false if `path` is not resident. A non-null
     // `newSampler` replaces the entry's sampler in the same descriptor write
     // (a recook may change the authored filter).
     [[nodiscard]] bool ReloadEntryImage(std::string_view path, ImageHandle newImage,
-                                        VkExtent2D extent,
+                                        VkExtent2D extent, uint64_t gpuBytes,
                                         const SamplerDesc* newSampler = nullptr);
 
+    // Repoints `entry`'s bindless slot at `newImage` and retires the old
+    // image through the deletion queue. Shared by reload and streaming.
+    void SwapEntryImage(TextureEntry& entry, ImageHandle newImage, uint64_t gpuBytes);
+
+    // Rebuilds a streamed entry's image holding `topMip` and below.
+    [[nodiscard]] bool ApplyResidentTopMip(TextureHandle handle, uint32_t topMip);
+
     Logger&                Log;
     VulkanImageService*    Images      = nullptr;
     VulkanDescriptorCache* Descriptors = nullptr;
     VulkanSamplerCache*    Samplers    = nullptr;
     bool                   Valid       = false;
+
+    bool MipStreaming = false;
+    TextureResidency Residency;
+    // Streamed entries by bindless index, the key residency and demand use.
+    std::unordered_map<uint32_t, TextureHandle> StreamedTextures;
 };
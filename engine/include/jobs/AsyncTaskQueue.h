@@ -9,6 +9,7 @@
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <stop_token>
 #include <thread>
 #include <vector>
 
@@ -17,9 +18,16 @@
 //
 // A handle observes one submitted task. State advances strictly:
 //   Pending -> Running -> AwaitingCommit -> Committed
-// Cancel diverts Pending or AwaitingCommit to Cancelled; a Running task
+// Cancel diverts Pending or AwaitingCommit to Cancelled. A Running task
 // cannot be cancelled (its work is already executing) — callers may retry
-// after it reaches AwaitingCommit.
+// after it reaches AwaitingCommit — unless it was submitted with a stop
+// source (AsyncTaskOptions::Stop): then Cancel diverts Running as well and
+// requests stop, the work may poll its token and return early, and whatever
+// it returns is dropped rather than committed.
+//
+// A sliced commit (SubmitCommitSlices) stays AwaitingCommit between its
+// slices. Cancel then drops the slices still to run; undoing what the earlier
+// ones did is the submitter's business.
 //=============================================================================
 enum class AsyncTaskState : uint8_t
 {
@@ -38,13 +46,16 @@ public:
 
 private:
     friend class AsyncTaskQueue;
-    explicit AsyncTaskHandle(
-        std::shared_ptr<std::atomic<AsyncTaskState>> state)
+    AsyncTaskHandle(
+        std::shared_ptr<std::atomic<AsyncTaskState>> state,
+        std::stop_source stop)
         : State(std::move(state))
+        , Stop(std::move(stop))
     {
     }
 
     std::shared_ptr<std::atomic<AsyncTaskState>> State;
+    std::stop_source Stop{ std::nostopstate };
 };
 
 //=============================================================================
@@ -56,8 +67,10 @@ private:
 //
 //   MaxTime — soft wall-time cap for frame pacing. The first ready commit
 //   always runs, and no further commit starts once elapsed time exceeds the
-//   budget. A budget cannot split a commit, so large payloads must be shaped as
-//   multiple chunked tasks. The budget then meters between chunks.
+//   budget. A budget cannot split a commit callback, so a commit too large for
+//   one frame is submitted as slices (SubmitCommitSlices); the budget meters
+//   between slices exactly as between commits, and an unfinished commit
+//   takes its next turn after the commits already waiting.
 //=============================================================================
 struct AsyncDrainBudget
 {
@@ -69,6 +82,95 @@ struct AsyncDrainBudget
         std::chrono::steady_clock::duration::max();
 };
 
+//=============================================================================
+// AsyncTaskPriority
+//
+// Order among pending tasks: a task thread takes the highest-priority task
+// waiting on its lane, then the earliest deadline, then (for reads) the next
+// in file order, then the oldest (AsyncTaskOptions). Tasks that share a priority
+// cell can be reordered after submission -- a speculative zone's preload that
+// becomes the focus zone's -- by storing into the cell; the change is seen the
+// next time a task thread picks. Work already running is never preempted.
+// A task submitted without a cell runs at Normal. Commits drain in completion
+// order; priority only orders sliced commits among themselves.
+//=============================================================================
+enum class AsyncTaskPriority : uint8_t
+{
+    Low,
+    Normal,
+    High,
+};
+
+using AsyncTaskPriorityCell = std::shared_ptr<std::atomic<AsyncTaskPriority>>;
+
+[[nodiscard]] inline AsyncTaskPriorityCell MakeAsyncTaskPriority(
+    AsyncTaskPriority priority)
+{
+    return std::make_shared<std::atomic<AsyncTaskPriority>>(priority);
+}
+
+// A deadline shared the same way: the tasks one request submitted follow it
+// together, and a store moves them all. A zone's build and its asset loads
+// share one, so a neighbour that becomes the focus is wanted sooner.
+using AsyncTaskDeadlineCell =
+    std::shared_ptr<std::atomic<std::chrono::steady_clock::time_point>>;
+
+[[nodiscard]] inline AsyncTaskDeadlineCell MakeAsyncTaskDeadline(
+    std::chrono::steady_clock::time_point deadline =
+        std::chrono::steady_clock::time_point::max())
+{
+    return std::make_shared<std::atomic<std::chrono::steady_clock::time_point>>(deadline);
+}
+
+//=============================================================================
+// AsyncTaskOptions
+//
+// How one task is scheduled, beyond its priority cell. Among pending tasks of
+// equal priority the earlier deadline goes first; a task without one goes
+// after every task that has one. The deadline is Deadline, or what
+// SharedDeadline holds when it is set. Among reads still tied after that, the I/O
+// pool sweeps ReadOrder upward from the last read it started and wraps, so a
+// source that can place its bytes (an asset pack's entry offset) has its
+// reads issued in file order rather than submission order. Zero means the
+// source cannot place them; such reads keep submission order.
+//
+// Stop makes a Running task cancellable (see AsyncTaskHandle). The work
+// captures stop.get_token() and checks it between its own stages; a staged
+// task is also checked between read and decode, so a cancelled read is never
+// decoded.
+//
+// Label names the task in latency samples and must outlive the queue; a
+// string literal is the expected argument.
+//=============================================================================
+struct AsyncTaskOptions
+{
+    AsyncTaskPriorityCell Priority = nullptr;
+    std::chrono::steady_clock::time_point Deadline =
+        std::chrono::steady_clock::time_point::max();
+    AsyncTaskDeadlineCell SharedDeadline = nullptr;
+    uint64_t ReadOrder = 0;
+    std::stop_source Stop{ std::nostopstate };
+    const char* Label = nullptr;
+};
+
+//=============================================================================
+// AsyncTaskLatency
+//
+// One finished task, as seen by the queue while latency tracing is on: how
+// long it waited for a thread and how long its stages took from the first
+// one starting to the last one finishing, a staged task's wait between read
+// and decode included. Recorded for cancelled tasks too, when their work ran.
+//=============================================================================
+struct AsyncTaskLatency
+{
+    const char* Label = nullptr;
+    AsyncTaskPriority Priority = AsyncTaskPriority::Normal;
+    std::chrono::steady_clock::duration Queued{};
+    std::chrono::steady_clock::duration Service{};
+    bool MissedDeadline = false;
+    bool Cancelled = false;
+};
+
 //=============================================================================
 // AsyncTaskQueue
 //
@@ -77,12 +179,31 @@ struct AsyncDrainBudget
 // owner-thread commit callbacks at the frame drain point. Until commit runs,
 // payloads are plain data no other thread can observe.
 //
+// Two pools. Work submitted with Submit runs on the `workerCount` compute
+// threads. SubmitStaged splits a task into a read stage and a decode stage:
+// with `ioWorkerCount` > 0 the read runs on a separate pool of I/O threads,
+// so a thread blocked on the disk never holds a core a decode could use, and
+// the decode continues on the compute threads without a trip through the
+// owner. The I/O pool stops starting reads while more than a bounded number
+// of read results wait for a compute thread, so a fast disk cannot fill
+// memory ahead of a slow decode. With no I/O threads both stages run on the
+// compute pool.
+//
+// The queue is the streaming scheduler beneath AsyncZoneLoader and
+// AssetPreloader: priority classes (focus, neighbour, speculative map to
+// High, Normal, Low), deadlines, read ordering, and cooperative cancellation
+// all come in through AsyncTaskOptions, so both loaders share one order.
+//
 // Threading contract:
-//   - Submit, Cancel, DrainCompletions, and PumpWork are owner-thread-only.
+//   - Submit, SubmitCommitSlices, Cancel, DrainCompletions, and PumpWork are
+//     owner-thread-only.
 //   - work callbacks must not touch ambient engine state.
 //   - work and commit callbacks must not throw.
 //   - AsyncTaskQueue(0) is deterministic test mode; PumpWork is illegal when
-//     worker threads exist.
+//     worker threads exist, and runs both stages of a staged task as one.
+//   - a staged task is Running from the start of its read to the end of its
+//     decode, so only one submitted with a stop source can be cancelled
+//     between the two.
 //   - destruction joins workers and drops unstarted or undrained work.
 //=============================================================================
 class AsyncTaskQueue
@@ -91,39 +212,117 @@ public:
     static constexpr std::size_t NoLimit =
         AsyncDrainBudget::NoLimit;
 
-    explicit AsyncTaskQueue(uint32_t workerCount);
+    explicit AsyncTaskQueue(uint32_t workerCount, uint32_t ioWorkerCount = 0);
     ~AsyncTaskQueue();
 
     AsyncTaskQueue(const AsyncTaskQueue&) = delete;
     AsyncTaskQueue& operator=(const AsyncTaskQueue&) = delete;
 
-    [[nodiscard]] uint32_t WorkerCount() const
+    // Compute threads; the I/O pool is counted separately.
+    [[nodiscard]] uint32_t WorkerCount() const { return ComputeWorkerCount; }
+    [[nodiscard]] uint32_t IoWorkerCount() const { return IoWorkers; }
+
+    template <typename TPayload>
+    AsyncTaskHandle Submit(
+        std::function<TPayload()> work,
+        std::function<void(TPayload)> commit,
+        AsyncTaskPriorityCell priority = nullptr)
     {
-        return static_cast<uint32_t>(Workers.size());
+        return Submit<TPayload>(
+            std::move(work),
+            std::move(commit),
+            AsyncTaskOptions{ .Priority = std::move(priority) });
     }
 
     template <typename TPayload>
     AsyncTaskHandle Submit(
         std::function<TPayload()> work,
-        std::function<void(TPayload)> commit)
+        std::function<void(TPayload)> commit,
+        AsyncTaskOptions options)
     {
         assert(work
                && "AsyncTaskQueue::Submit: work must not be empty");
         assert(commit
                && "AsyncTaskQueue::Submit: commit must not be empty");
         return SubmitErased(
+            {},
             [work = std::move(work),
              commit = std::move(commit)]()
-                -> std::function<void()>
+                -> ErasedCommit
             {
                 auto payload = std::make_shared<TPayload>(work());
                 return [commit, payload]
                 {
                     commit(std::move(*payload));
+                    return true;
                 };
-            });
+            },
+            std::move(options));
+    }
+
+    // read runs on the I/O pool, decode on the compute pool with read's
+    // result, commit on the owner thread with decode's.
+    template <typename TRead, typename TPayload>
+    AsyncTaskHandle SubmitStaged(
+        std::function<TRead()> read,
+        std::function<TPayload(TRead)> decode,
+        std::function<void(TPayload)> commit,
+        AsyncTaskPriorityCell priority = nullptr)
+    {
+        return SubmitStaged<TRead, TPayload>(
+            std::move(read),
+            std::move(decode),
+            std::move(commit),
+            AsyncTaskOptions{ .Priority = std::move(priority) });
     }
 
+    template <typename TRead, typename TPayload>
+    AsyncTaskHandle SubmitStaged(
+        std::function<TRead()> read,
+        std::function<TPayload(TRead)> decode,
+        std::function<void(TPayload)> commit,
+        AsyncTaskOptions options)
+    {
+        assert(read
+               && "AsyncTaskQueue::SubmitStaged: read must not be empty");
+        assert(decode
+               && "AsyncTaskQueue::SubmitStaged: decode must not be empty");
+        assert(commit
+               && "AsyncTaskQueue::SubmitStaged: commit must not be empty");
+        return SubmitErased(
+            [read = std::move(read),
+             decode = std::move(decode),
+             commit = std::move(commit)]()
+                -> ErasedWork
+            {
+                auto bytes = std::make_shared<TRead>(read());
+                return [decode, commit, bytes]()
+                    -> ErasedCommit
+                {
+                    auto payload = std::make_shared<TPayload>(
+                        decode(std::move(*bytes)));
+                    return [commit, payload]
+                    {
+                        commit(std::move(*payload));
+                        return true;
+                    };
+                };
+            },
+            {},
+            std::move(options));
+    }
+
+    // An owner-thread commit with no work stage, for one too large to run
+    // inside a frame's drain budget. The task is ready at once. slice runs
+    // once per turn and returns true when the commit is finished; after each
+    // turn, and on submission, the task queues behind every waiting commit
+    // except sliced ones of lower priority (options.Priority, read at each
+    // requeue), so other completions run between its slices. The drain counts
+    // it once, when it finishes.
+    AsyncTaskHandle SubmitCommitSlices(
+        std::function<bool()> slice,
+        AsyncTaskOptions options = {});
+
     [[nodiscard]] AsyncTaskState GetState(
         const AsyncTaskHandle& handle) const
     {
@@ -148,26 +347,77 @@ public:
     std::size_t PumpWork(
         std::size_t maxTasks = NoLimit);
 
+    // Latency tracing, off by default: while on, every task that finishes its
+    // work leaves an AsyncTaskLatency, which TakeLatencySamples hands to the
+    // owner thread in completion order. For perf investigation; samples
+    // accumulate until taken. scripts/bench_preload_lanes.sh reports them.
+    void SetLatencyTracing(bool enabled);
+    [[nodiscard]] std::vector<AsyncTaskLatency> TakeLatencySamples();
+
 private:
+    // Returns true once the commit is finished; only sliced commits ever
+    // return false.
+    using ErasedCommit =
+        std::function<bool()>;
     using ErasedWork =
-        std::function<std::function<void()>()>;
+        std::function<ErasedCommit()>;
+    using ErasedRead =
+        std::function<ErasedWork()>;
+
+    enum class Lane : uint8_t
+    {
+        Io,
+        Compute,
+        Pump,
+    };
 
     struct Task
     {
         std::shared_ptr<std::atomic<AsyncTaskState>> State;
+        AsyncTaskPriorityCell Priority;
+        std::chrono::steady_clock::time_point Deadline =
+            std::chrono::steady_clock::time_point::max();
+        AsyncTaskDeadlineCell SharedDeadline;
+        uint64_t ReadOrder = 0;
+        const char* Label = nullptr;
+        ErasedRead Read;
         ErasedWork Work;
-        std::function<void()> Commit;
+        ErasedCommit Commit;
+        // Decode stage of a staged task whose read has run: already claimed.
+        bool Decoding = false;
+        // Submitted with SubmitCommitSlices: its commit may take several turns.
+        bool Sliced = false;
+        std::chrono::steady_clock::time_point SubmittedAt{};
+        std::chrono::steady_clock::time_point StartedAt{};
     };
 
-    AsyncTaskHandle SubmitErased(ErasedWork work);
-    bool RunOnePendingTask();
-    void WorkerMain();
+    AsyncTaskHandle SubmitErased(ErasedRead read,
+                                 ErasedWork work,
+                                 AsyncTaskOptions options);
+    [[nodiscard]] bool RunsBefore(const Task& candidate, const Task& best) const;
+    void QueueSliceLocked(Task&& task);
+    void FinishLocked(Task& task, bool cancelled);
+    [[nodiscard]] bool HasWorkLocked(Lane lane) const;
+    [[nodiscard]] bool TakeLocked(Lane lane, Task& out);
+    bool RunOnePendingTask(Lane lane);
+    void WorkerMain(Lane lane);
 
     std::vector<std::thread> Workers;
+    // Fixed before the first thread starts; workers read them unlocked.
+    uint32_t ComputeWorkerCount = 0;
+    uint32_t IoWorkers = 0;
+    std::size_t MaxDecodeBacklog = 0;
     mutable std::mutex Mutex;
     std::condition_variable WorkSignal;
+    std::condition_variable IoSignal;
+    std::deque<Task> PendingReads;
     std::deque<Task> PendingTasks;
     std::deque<Task> CompletedTasks;
+    std::size_t DecodeBacklog = 0;
+    // ReadOrder of the last read a thread took; the next sweeps up from it.
+    uint64_t ReadCursor = 0;
+    bool TraceLatency = false;
+    std::vector<AsyncTaskLatency> LatencySamples;
     bool ShutdownRequested = false;
     std::thread::id OwnerThread;
 };
@@ -18,6 +18,8 @@ struct MovementIntent;
 class FreeLocomotionSystem
 {
 public:
+    static constexpr bool Resimulated = true;
+
     explicit FreeLocomotionSystem(Vec3d gravity = Vec3d(0.0f, -9.81f, 0.0f),
                                   Vec3d upAxis = Vec3d(0.0f, 1.0f, 0.0f))
         : Gravity(gravity)
@@ -22,6 +22,8 @@ class World;
 class JumpExecutionSystem
 {
 public:
+    static constexpr bool Resimulated = true;
+
     void FixedLogic(FixedLogicContext& ctx);
     void Step(World& world);
 
@@ -30,6 +30,8 @@ struct SupportState;
 class MotionCompositionSystem
 {
 public:
+    static constexpr bool Resimulated = true;
+
     void FixedLogic(FixedLogicContext& ctx);
 
     // Whole-world overload for tests; the scheduled path visits only the
@@ -21,6 +21,8 @@ struct FixedLogicContext;
 class ModeRequestCollectionSystem
 {
 public:
+    static constexpr bool Resimulated = true;
+
     void FixedLogic(FixedLogicContext& ctx);
     void Step(World& world);
 
@@ -34,6 +36,8 @@ private:
 class LocomotionModeTransitionSystem
 {
 public:
+    static constexpr bool Resimulated = true;
+
     void FixedLogic(FixedLogicContext& ctx);
     void Step(World& world);
 
@@ -46,6 +50,8 @@ private:
 class SupportTagProjectionSystem
 {
 public:
+    static constexpr bool Resimulated = true;
+
     void FixedLogic(FixedLogicContext& ctx);
     void Step(World& world);
 
@@ -8,6 +8,8 @@ struct FixedLogicContext;
 class MovementTuningResolutionSystem
 {
 public:
+    static constexpr bool Resimulated = true;
+
     explicit MovementTuningResolutionSystem(DataAssetCache& dataAssets)
         : DataAssets(&dataAssets)
     {
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+//=============================================================================
+// NetEntropyCoder
+//
+// A static-model rANS coder over bytes, for payloads whose byte distribution is
+// known in advance. Snapshots are the consumer: their field masks are mostly
+// zeros, their deltas are mostly small, and the same shapes repeat every tick
+// for every peer, so a model trained once from recorded sessions compresses
+// them without either end adapting anything at runtime.
+//
+// Static rather than adaptive on purpose. An adaptive model has to be in step
+// on both ends, and an unreliable channel drops exactly the packets that would
+// have kept it there; a static one makes every datagram decodable on its own,
+// which is the property the snapshot channel already depends on.
+//
+// Pure and allocation-free on the encode and decode paths, like the codec it
+// sits behind. Every symbol has a nonzero frequency, so any input encodes --
+// an input the model did not anticipate simply costs more, and the caller
+// keeps the raw form when it would not have shrunk.
+//=============================================================================
+
+// Frequencies sum to 2^kNetEntropyScaleBits. Twelve bits keeps the decode table
+// at four kilobytes and costs under a hundredth of a bit per symbol against an
+// exact model.
+inline constexpr std::uint32_t kNetEntropyScaleBits = 12;
+inline constexpr std::uint32_t kNetEntropyScale = 1u << kNetEntropyScaleBits;
+
+// A coded stream opens with the decoded length (two bytes) and the final coder
+// state (four bytes). Six bytes is why tiny payloads are never worth coding.
+inline constexpr std::size_t kNetEntropyHeaderBytes = 6;
+
+class NetEntropyModel
+{
+public:
+    // The flat model: every byte equally likely. Codes to slightly larger than
+    // its input, and exists so a default-constructed model is a valid one.
+    NetEntropyModel();
+
+    // From raw symbol counts, as a trainer produces them. Counts are scaled to
+    // the fixed total with every symbol kept at one or more, so a byte the
+    // training never saw is expensive rather than unencodable.
+    [[nodiscard]] static NetEntropyModel FromCounts(
+        std::span<const std::uint64_t, 256> counts);
+
+    // The shipped form: 256 little-endian 16-bit frequencies. Deserialize
+    // refuses a table that does not sum to the scale or gives any symbol zero,
+    // because either would make some input undecodable.
+    [[nodiscard]] std::vector<std::byte> Serialize() const;
+    [[nodiscard]] static std::optional<NetEntropyModel> Deserialize(
+        std::span<const std::byte> bytes);
+
+    // Folds the frequency table into one value. Two ends that disagree on it
+    // would decode each other's payloads into confident garbage, so a coded
+    // payload carries the low byte and a receiver compares before decoding.
+    [[nodiscard]] std::uint32_t Hash() const { return TableHash; }
+
+    [[nodiscard]] std::uint32_t Frequency(std::uint8_t symbol) const
+    {
+        return Frequencies[symbol];
+    }
+    [[nodiscard]] std::uint32_t Start(std::uint8_t symbol) const { return Starts[symbol]; }
+    [[nodiscard]] std::uint8_t SymbolAt(std::uint32_t slot) const { return Lookup[slot]; }
+
+private:
+    void Build();
+
+    std::array<std::uint16_t, 256> Frequencies{};
+    std::array<std::uint16_t, 256> Starts{};
+    std::array<std::uint8_t, kNetEntropyScale> Lookup{};
+    std::uint32_t TableHash = 0;
+};
+
+// Accumulates byte counts across sample payloads -- a recorded session's
+// snapshots, fed one at a time -- and produces the model they imply.
+class NetEntropyTrainer
+{
+public:
+    void Observe(std::span<const std::byte> payload);
+    [[nodiscard]] NetEntropyModel Build() const;
+    [[nodiscard]] std::uint64_t SymbolsObserved() const { return Total; }
+
+private:
+    std::array<std::uint64_t, 256> Counts{};
+    std::uint64_t Total = 0;
+};
+
+// Encodes `input` into `out` and returns the bytes written, or nothing when it
+// did not fit. Inputs longer than 65535 bytes are refused: the length prefix
+// is two bytes, and nothing that rides one datagram comes close.
+[[nodiscard]] std::optional<std::size_t> NetEntropyEncode(
+    const NetEntropyModel& model,
+    std::span<const std::byte> input,
+    std::span<std::byte> out);
+
+// Decodes a stream NetEntropyEncode produced and returns the bytes written.
+// Fails on a stream that is truncated, that claims more output than `out`
+// holds, or that does not end in exactly the state an encoder starts from --
+// which is the coder's own integrity check, and catches a corrupt stream or a
+// mismatched model far more often than not.
+[[nodiscard]] std::optional<std::size_t> NetEntropyDecode(
+    const NetEntropyModel& model,
+    std::span<const std::byte> input,
+    std::span<std::byte> out);
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <net/NetEntropyCoder.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <span>
+#include <string>
+
+//=============================================================================
+// NetEntropyModelFile
+//
+// The on-disk half of the snapshot entropy model: loading the shipped table at
+// session setup, and recording the traffic a table is trained from.
+//
+// The model file is exactly NetEntropyModel::Serialize's 512 bytes, nothing
+// around it, so scripts/train_net_entropy_model.py can write one without
+// linking the engine.
+//
+// A capture is a 4-byte "SNCP" magic and a little-endian u32 version, then one
+// record per snapshot: a little-endian u16 length and the snapshot bytes as
+// the writer produced them, before any coding. A snapshot always fits one
+// datagram, so the length never needs more than two bytes.
+//=============================================================================
+
+inline constexpr std::uint32_t kNetSnapshotCaptureVersion = 1;
+
+// Refuses a file that is missing, the wrong size, or a table Deserialize
+// refuses. `error`, when given, says which.
+[[nodiscard]] std::optional<NetEntropyModel> LoadNetEntropyModel(
+    const std::filesystem::path& path,
+    std::string* error = nullptr);
+
+[[nodiscard]] bool SaveNetEntropyModel(const std::filesystem::path& path,
+                                       const NetEntropyModel& model);
+
+// Appends published snapshots to a capture file. A development tool: the
+// authority only writes through one when engine.json asks it to.
+class NetSnapshotCapture
+{
+public:
+    // Truncates `path` and writes the header. False when it cannot be created.
+    [[nodiscard]] bool Open(const std::filesystem::path& path);
+    void Close();
+    [[nodiscard]] bool IsOpen() const { return File.is_open(); }
+
+    void Append(std::span<const std::byte> snapshot);
+    [[nodiscard]] std::uint64_t SnapshotsWritten() const { return Written; }
+
+private:
+    std::ofstream File;
+    std::uint64_t Written = 0;
+};
+
+// Feeds every snapshot in the capture at `path` to `trainer` and returns how
+// many there were. Fails on a file that is not a capture. A torn final record
+// -- a host killed mid-write -- ends the read instead of failing it, so a
+// session that crashed still trains.
+[[nodiscard]] std::optional<std::uint64_t> ReadNetSnapshotCapture(
+    const std::filesystem::path& path,
+    NetEntropyTrainer& trainer);
@@ -35,7 +35,7 @@
 // Bumped on any wire change. There are no cross-version sessions: the handshake
 // refuses a mismatch with a reason rather than trying to negotiate, which is
 // the only honest posture while the format is still moving.
-inline constexpr std::uint16_t kNetProtocolVersion = 1;
+inline constexpr std::uint16_t kNetProtocolVersion = 2;
 
 // Every message begins with this so a decoder can dispatch before it trusts
 // anything else. Values are explicit because they are wire format: reordering
@@ -75,6 +75,10 @@ enum class NetPayloadKind : std::uint8_t
     // reliable channel, because unlike a snapshot there is no next one to
     // supersede a lost update.
     CVar = 3,
+    // Authority to client: a snapshot entropy-coded against the session's
+    // static model. One tag byte (the model hash's low byte) follows the kind,
+    // then the coded stream. Sent only when it is smaller than the raw form.
+    SnapshotCoded = 4,
 };
 
 // What a decode can go wrong as. A peer's strike count keys on these, so they
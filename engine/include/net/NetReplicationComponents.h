@@ -1,9 +1,13 @@
 #pragma once
 
 #include <core/identity/StrongId.h>
+#include <core/metadata/Field.h>
+#include <core/metadata/TypeSchema.h>
 #include <ecs/ComponentTypeId.h>
 
 #include <cstdint>
+#include <string_view>
+#include <tuple>
 #include <type_traits>
 
 //=============================================================================
@@ -194,6 +194,14 @@ public:
     [[nodiscard]] const NetAddress& Authority() const { return AuthorityAddress; }
     [[nodiscard]] std::uint64_t RoundTripMicroseconds() const { return RttMicroseconds; }
 
+    // What the transport has cost to drive since it opened, for the stats
+    // surface. Read through the session because the session is what the frame
+    // holds; the transport belongs to whoever created it.
+    [[nodiscard]] NetTransportCounters TransportCounters() const
+    {
+        return Transport.Counters();
+    }
+
     // Diagnostics for the status command.
     [[nodiscard]] std::uint64_t StrikesIssued() const { return TotalStrikes; }
     [[nodiscard]] std::uint64_t Refusals() const { return TotalRefusals; }
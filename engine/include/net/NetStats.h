@@ -1,6 +1,7 @@
 #pragma once
 
 #include <net/NetProtocol.h>
+#include <net/NetTransport.h>
 
 #include <array>
 #include <cstddef>
@@ -51,6 +52,22 @@ struct NetTrafficRate
     double Bytes = 0.0;
 };
 
+// What driving the transport cost over the last closed window. Calls beside
+// datagrams, because their ratio is what batching buys and is invisible in
+// either alone; pump time because a call that is cheap per datagram can still
+// be the frame's most expensive line.
+struct NetTransportRate
+{
+    double ReceiveCalls = 0.0;
+    double SendCalls = 0.0;
+    double DatagramsIn = 0.0;
+    double DatagramsOut = 0.0;
+    // Per frame that pumped: the average and the worst in the window.
+    double PumpMilliseconds = 0.0;
+    double PumpMillisecondsPeak = 0.0;
+    double FlushMilliseconds = 0.0;
+};
+
 class NetStats
 {
 public:
@@ -64,6 +81,15 @@ public:
     void RecordOut(NetTrafficKind kind, std::size_t bytes,
                    std::uint32_t messages = 1);
 
+    // Takes the transport's own lifetime counters and accounts the difference
+    // since the last call. A transport reopened underneath (counters that went
+    // backwards) is counted from zero rather than as a negative rate.
+    void RecordTransport(const NetTransportCounters& counters);
+    // Wall time one frame spent pumping (receive and decode) and flushing
+    // (drain and transmit).
+    void RecordPumpSeconds(double seconds);
+    void RecordFlushSeconds(double seconds);
+
     // Closes the accounting window if one has elapsed, and reports rates over
     // however long it actually was rather than over the nominal second -- a
     // frame that hitched past the window would otherwise read as a traffic
@@ -77,6 +103,7 @@ public:
     [[nodiscard]] NetTrafficRate Out(NetTrafficKind kind) const;
     [[nodiscard]] NetTrafficRate TotalIn() const;
     [[nodiscard]] NetTrafficRate TotalOut() const;
+    [[nodiscard]] const NetTransportRate& Transport() const { return TransportRate; }
 
     [[nodiscard]] std::uint64_t LifetimeBytesIn() const { return LifetimeIn; }
     [[nodiscard]] std::uint64_t LifetimeBytesOut() const { return LifetimeOut; }
@@ -103,6 +130,15 @@ private:
     std::array<NetTrafficRate, kNetTrafficKinds> RatesIn{};
     std::array<NetTrafficRate, kNetTrafficKinds> RatesOut{};
 
+    NetTransportCounters LastCounters;
+    NetTransportCounters WindowCounters;
+    double WindowPumpSeconds = 0.0;
+    double WindowPumpPeak = 0.0;
+    std::uint32_t WindowPumps = 0;
+    double WindowFlushSeconds = 0.0;
+    std::uint32_t WindowFlushes = 0;
+    NetTransportRate TransportRate;
+
     // Oldest first, so a plot can take them as they are. Shifted rather than
     // ringed: sixty floats once a second is not worth an index to reason about.
     std::array<float, kHistory> SeriesIn{};
@@ -71,6 +71,13 @@ public:
     [[nodiscard]] std::uint32_t FlightTicks() const { return Flight; }
     [[nodiscard]] std::int64_t Offset() const { return Delta; }
 
+    // How unevenly the authority's word arrives, in ticks: the smoothed mean
+    // deviation of each sample's transit from the one before, which is how
+    // far a snapshot lands from where its predecessor said the next would.
+    // The offset above slews through this; a playout buffer has to hold
+    // enough to ride it out.
+    [[nodiscard]] double JitterTicks() const { return Jitter; }
+
     void Reset();
 
 private:
@@ -79,5 +86,9 @@ private:
     std::int64_t Delta = 0;
     std::uint32_t Flight = 0;
     std::uint32_t Slack = 0;
+    // Local tick minus authority tick at the last sample, for the next one's
+    // jitter: only the change between two matters, not which machine leads.
+    std::int64_t LastTransit = 0;
+    double Jitter = 0.0;
     bool Observed = false;
 };
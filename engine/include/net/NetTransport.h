@@ -3,6 +3,7 @@
 #include <net/NetAddress.h>
 
 #include <cstddef>
+#include <cstdint>
 #include <span>
 
 //=============================================================================
@@ -38,6 +39,21 @@ struct NetDatagram
     std::span<const std::byte> Payload;
 };
 
+// What driving a transport has cost since it was opened. Calls are counted
+// separately from datagrams because the gap between them is the whole point of
+// batching: one recvmmsg that drains forty datagrams is one call, and a rate
+// that only counted datagrams could not tell it from forty recvfroms.
+//
+// In-process transports make no system calls and report zeros, which is the
+// honest answer rather than a missing one.
+struct NetTransportCounters
+{
+    std::uint64_t ReceiveCalls = 0;
+    std::uint64_t SendCalls = 0;
+    std::uint64_t DatagramsReceived = 0;
+    std::uint64_t DatagramsSent = 0;
+};
+
 class INetTransport
 {
 public:
@@ -59,6 +75,25 @@ public:
     [[nodiscard]] virtual bool Send(const NetAddress& to,
                                     std::span<const std::byte> payload) = 0;
 
+    // Queues a datagram for the next FlushSends rather than transmitting it
+    // now, so a pump that produces a datagram per peer can hand the platform
+    // all of them at once. The payload is copied; the caller's buffer is free
+    // the moment this returns. Refuses exactly what Send refuses.
+    //
+    // The default is Send itself: a transport with nothing to batch loses
+    // nothing by transmitting immediately, and its ordering is unchanged.
+    [[nodiscard]] virtual bool Queue(const NetAddress& to,
+                                     std::span<const std::byte> payload)
+    {
+        return Send(to, payload);
+    }
+
+    // Transmits everything queued, in queue order. Close does this first, so a
+    // disconnect notice queued on the way out still leaves.
+    virtual void FlushSends() {}
+
+    [[nodiscard]] virtual NetTransportCounters Counters() const { return {}; }
+
     // Drains everything currently readable and returns a view of it. Never
     // blocks. The returned span and every payload in it are invalidated by the
     // next call on this transport.
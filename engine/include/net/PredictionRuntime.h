@@ -0,0 +1,230 @@
+#pragma once
+
+#include <ecs/EntityId.h>
+#include <input/InputActionState.h>
+#include <net/NetPlayerCommand.h>
+#include <net/NetSession.h>
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <vector>
+
+class NetTickEstimator;
+class ReplicationLayout;
+class World;
+
+//=============================================================================
+// PredictionRuntime
+//
+// Client-side prediction for the entities this peer owns, and the rollback that
+// keeps it honest.
+//
+// Without it a client's own pawn moves when the authority says so, which is a
+// round trip after the player asked. With it the client simulates its own
+// input immediately through the same fixed-tick systems the authority runs, and
+// treats every snapshot as a check on that guess rather than as the state to
+// show: the authority's word about tick T is compared with what this machine
+// predicted for T, and only a disagreement costs anything. Then the predicted
+// state is thrown away, the authority's is put in its place, and the ticks
+// between T and now are simulated again from the input recorded for them.
+//
+// What is predicted is what is replicated: the layout's components on every
+// entity whose NetOwner names this peer. Comparison is at wire precision, so a
+// quantized field agreeing to within its step agrees, and owner-local fields --
+// which the authority never sends the owner -- are not compared at all.
+//
+// A snapshot is a delta against what the authority believes this client holds,
+// and that is the authoritative state, not the prediction that has overwritten
+// it since. So the owned entities are rewound to their last authoritative state
+// before a snapshot applies and the result is kept aside, leaving the delta to
+// land on the bytes it was written against.
+//
+// Which predicted tick a snapshot speaks for is the estimator's: a command sent
+// on local tick t was stamped for t plus the command offset, the authority
+// consumed it on that tick, and its snapshot carries the stamp. Each recorded
+// tick keeps the stamp it was sent under, so a slewing estimate does not shift
+// the comparison by a tick.
+//
+// The ring is sized once, on the first capture of a session, from the layout.
+// After that neither recording nor rolling back allocates.
+//=============================================================================
+class PredictionRuntime
+{
+public:
+    // Ticks of prediction kept. Beyond this a snapshot speaks for a tick this
+    // machine no longer remembers and cannot be checked -- a second of round
+    // trip at sixty ticks, which is a connection already failing other ways.
+    static constexpr std::size_t kCapacityTicks = 64;
+
+    // Owned entities predicted at once. A player drives one pawn; the headroom
+    // is for a pawn plus what it carries.
+    static constexpr std::size_t kMaxPredictedEntities = 4;
+
+    // Ticks a single correction may resimulate before it is refused. The
+    // default covers a round trip of a quarter second at sixty ticks.
+    static constexpr std::uint32_t kDefaultResimBudget = 16;
+
+    struct Counters
+    {
+        // Snapshots compared against a prediction.
+        std::uint64_t Reconciled = 0;
+        // Of those, the ones that disagreed.
+        std::uint64_t Mispredicted = 0;
+        // Disagreements whose window exceeded the budget. Too long to replay,
+        // so the pawn snaps to the authority instead; a budget below the round
+        // trip turns every correction into one of these.
+        std::uint64_t OverBudget = 0;
+        // Snapshots for a tick no longer in the ring, or never predicted.
+        // Nothing to compare, so the pawn snaps to the authority.
+        std::uint64_t Unverified = 0;
+        // Snapshots that replaced the prediction outright rather than
+        // replaying onto it: every OverBudget and Unverified one.
+        std::uint64_t Snapped = 0;
+        std::uint64_t ResimulatedTicks = 0;
+
+        std::uint32_t LastResimTicks = 0;
+        double LastResimMilliseconds = 0.0;
+        double PeakResimMilliseconds = 0.0;
+    };
+
+    // Runs one tick of simulation. The caller owns the schedule and the frame
+    // view, which is everything resimulating needs that this does not have.
+    using ResimulateTick = std::function<void(std::uint64_t tick)>;
+
+    // Runs after a snap with the entities it moved. Whatever keeps its own copy
+    // of their pose -- a character mover -- is put back with them here, or the
+    // next tick carries on from where the prediction had it.
+    using ReseatEntities = std::function<void(std::span<const EntityId> entities)>;
+
+    // End of each fixed tick on a client. Records the owned entities' state
+    // and the input `tick` consumed, stamped as the authority will name it.
+    // Nothing is recorded before the estimator has a name for the authority's
+    // clock: a prediction that cannot be matched to a snapshot checks nothing.
+    void Capture(const World& world, const ReplicationLayout& layout,
+                 PeerId localPeer, std::uint64_t tick,
+                 const NetTickEstimator& clock);
+
+    // Around each snapshot applied. Begin puts the owned entities back to their
+    // last authoritative state; End keeps what the snapshot left there and
+    // queues it for Reconcile. A snapshot that failed to apply restores the
+    // prediction and queues nothing.
+    void BeginAuthoritative(World& world, const ReplicationLayout& layout);
+    void EndAuthoritative(World& world, const ReplicationLayout& layout,
+                          PeerId localPeer, std::uint64_t authorityTick,
+                          bool applied);
+
+    // Once per frame, before its ticks. Compares the newest authoritative state
+    // with the prediction for its tick, and either restores the prediction or
+    // resimulates from the authority's state to the newest recorded tick.
+    // `resimulate` runs with the recorded input standing in as the world's
+    // resolved actions.
+    //
+    // A snapshot that cannot be replayed onto -- its tick is not in the ring,
+    // or the window is over budget -- snaps the owned entities to the
+    // authority's state and makes that the newest record. The pawn then shows
+    // the authority's word, a round trip late, until the round trip fits again.
+    void Reconcile(World& world, const ReplicationLayout& layout,
+                   const ResimulateTick& resimulate,
+                   const ReseatEntities& reseat = {});
+
+    // Off is input-delay mode: the pawn shows what the authority said, a round
+    // trip late, and nothing here runs. Turning it off drops what the ring
+    // held, since it stops describing the pawn the moment a snapshot lands
+    // unchecked.
+    void SetEnabled(bool enabled);
+    [[nodiscard]] bool IsEnabled() const { return Enabled; }
+
+    void SetResimBudget(std::uint32_t ticks) { Budget = ticks; }
+    [[nodiscard]] std::uint32_t ResimBudget() const { return Budget; }
+
+    [[nodiscard]] const Counters& Stats() const { return Totals; }
+    [[nodiscard]] std::size_t RecordedTicks() const { return Recorded; }
+    [[nodiscard]] std::size_t PredictedEntities() const;
+    // Which entities those are, as of the newest recorded tick: the set a
+    // resimulated tick re-steps physics for.
+    [[nodiscard]] std::span<const EntityId> PredictedEntityIds() const;
+    // Bytes the ring holds. Fixed from the first capture on.
+    [[nodiscard]] std::size_t StorageBytes() const { return Storage.size(); }
+
+    // Session over. Keeps the storage: the next session has the same layout.
+    void Reset();
+
+private:
+    struct Frame
+    {
+        // The local tick whose result this is, and the authority's name for
+        // the input it consumed.
+        std::uint64_t Tick = 0;
+        std::uint64_t AuthorityTick = 0;
+        NetCommandRecord Input{};
+        std::array<EntityId, kMaxPredictedEntities> Entities{};
+        std::uint8_t EntityCount = 0;
+        // Recorded on a run a snap has since thrown away. Its state is not what
+        // this machine now predicts for its tick, so it checks nothing: a
+        // snapshot for it is a misprediction without comparing.
+        bool Abandoned = false;
+    };
+
+    void Configure(const ReplicationLayout& layout);
+    [[nodiscard]] bool IsConfiguredFor(const ReplicationLayout& layout) const;
+
+    // Frame slots are the ring's kCapacityTicks plus one more holding the last
+    // authoritative state.
+    [[nodiscard]] std::span<std::byte> EntityBytes(std::size_t frame, std::size_t slot);
+    [[nodiscard]] std::span<const std::byte> EntityBytes(std::size_t frame,
+                                                         std::size_t slot) const;
+    [[nodiscard]] std::uint8_t* Presence(std::size_t frame, std::size_t slot);
+    [[nodiscard]] const std::uint8_t* Presence(std::size_t frame, std::size_t slot) const;
+
+    void CollectOwned(const World& world, PeerId localPeer, Frame& frame) const;
+    void Store(const World& world, const ReplicationLayout& layout, std::size_t index,
+               const Frame& frame);
+    // Which fields a restore writes. Owner-local fields are this machine's to
+    // decide and move on the presentation clock, between ticks; nothing the
+    // ring or the authority holds is newer than what the world has, so every
+    // restore but a replayed tick's leaves them alone.
+    enum class RestoreFields : std::uint8_t
+    {
+        Authoritative,
+        OwnerLocal,
+    };
+
+    void Restore(World& world, const ReplicationLayout& layout, std::size_t index,
+                 const Frame& frame, RestoreFields fields);
+    [[nodiscard]] bool Agrees(const ReplicationLayout& layout, std::size_t predicted,
+                              std::size_t authoritative);
+    void Snap(World& world, const ReplicationLayout& layout, const ReseatEntities& reseat);
+    [[nodiscard]] const Frame* Find(std::uint64_t tick, std::size_t& index) const;
+    [[nodiscard]] std::size_t NewestIndex() const;
+
+    std::array<Frame, kCapacityTicks + 1> Frames{};
+    std::size_t Head = 0;
+    std::size_t Recorded = 0;
+    static constexpr std::size_t kShadow = kCapacityTicks;
+
+    // Every frame's entity slots laid end to end, each slot every layout
+    // component laid end to end at the offsets below. Presence says which of
+    // them the entity actually carried.
+    std::vector<std::byte> Storage;
+    std::vector<std::uint8_t> PresenceFlags;
+    std::vector<std::size_t> ComponentOffsets;
+    std::size_t SlotBytes = 0;
+    std::uint64_t LayoutHash = 0;
+    // One component, snapped to wire precision for comparison.
+    std::vector<std::byte> CompareScratch;
+
+    bool HasShadow = false;
+    bool Pending = false;
+    std::uint64_t PendingTick = 0;
+
+    // Swapped in as the world's resolved actions while resimulating, so the
+    // ticks replayed see the input they saw the first time and the live history
+    // a command is built from is left alone.
+    InputActionState Replay;
+
+    bool Enabled = false;
+    std::uint32_t Budget = kDefaultResimBudget;
+    Counters Totals;
+};
@@ -97,6 +97,11 @@ private:
 // failure: a wrapped value would put an entity somewhere it has never been,
 // while a clamped one pins it at the edge of the range someone declared, which
 // is visible and traceable to the declaration.
+//
+// A SmallestThree field is a rotation rather than four ranged floats: it is
+// normalized, its largest component is dropped and rebuilt from unit length on
+// decode, and the other three go through these same functions over the range
+// its declaration states.
 //-----------------------------------------------------------------------------
 [[nodiscard]] std::uint32_t ReplicationQuantize(float value,
                                                 const FieldQuantization& range);
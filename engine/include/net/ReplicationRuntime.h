@@ -1,5 +1,6 @@
 #pragma once
 
+#include <net/NetEntropyCoder.h>
 #include <net/NetSession.h>
 #include <net/NetSpawnRecipe.h>
 #include <net/ReplicationSnapshot.h>
@@ -8,6 +9,7 @@
 #include <unordered_map>
 #include <vector>
 
+class NetSnapshotCapture;
 class World;
 class WorldComponentSchema;
 
@@ -43,6 +45,8 @@ public:
     // Client side. `payload` is one channel message, still carrying its kind
     // byte. Returns what happened; a payload that is not a snapshot is ignored
     // rather than treated as an error, because other kinds share this channel.
+    // A coded snapshot is decoded first, and refused when this end holds no
+    // model or a different one.
     SnapshotApplyResult Apply(std::span<const std::byte> payload, World& world,
                               const WorldComponentSchema& schema,
                               const ReplicationLayout& layout,
@@ -55,6 +59,18 @@ public:
     // Session over. Identity and baselines are session-transient by definition.
     void Reset();
 
+    // The static model snapshots are entropy-coded against, or null to send
+    // them raw. Both ends must hold the same one; the coded form carries a tag
+    // so a mismatch is refused rather than decoded into garbage. Not owned, and
+    // not cleared by Reset: it is shipped content, not session state.
+    void SetEntropyModel(const NetEntropyModel* model) { EntropyModel = model; }
+    [[nodiscard]] const NetEntropyModel* GetEntropyModel() const { return EntropyModel; }
+
+    // Where the authority records each snapshot it writes, before coding, for
+    // training a model; null records nothing. Not owned, and like the model
+    // not cleared by Reset.
+    void SetSnapshotCapture(NetSnapshotCapture* capture) { Capture = capture; }
+
     [[nodiscard]] std::size_t TrackedPeers() const { return Peers.size(); }
     [[nodiscard]] const ReplicationClientIdentity& ClientEntities() const
     {
@@ -68,4 +84,9 @@ private:
     // Reused across peers and frames. Sized once to the largest datagram a
     // channel will fragment for us, so publishing allocates nothing per frame.
     std::vector<std::byte> Scratch;
+    // The coded form on the authority, the decoded one on a client. Same sizing
+    // rule as Scratch.
+    std::vector<std::byte> CodedScratch;
+    const NetEntropyModel* EntropyModel = nullptr;
+    NetSnapshotCapture* Capture = nullptr;
 };
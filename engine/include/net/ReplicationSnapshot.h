@@ -198,6 +198,9 @@ enum class SnapshotApplyError : std::uint8_t
     // A component arrived for an entity that does not carry it and could not be
     // given it.
     ComponentAddFailed,
+    // An entropy-coded snapshot that this end has no model for, whose model tag
+    // does not match ours, or whose stream failed the coder's integrity check.
+    EntropyModelMismatch,
 };
 
 [[nodiscard]] std::string_view SnapshotApplyErrorToString(SnapshotApplyError error);
@@ -44,6 +44,8 @@ public:
     [[nodiscard]] bool Send(const NetAddress& to,
                             std::span<const std::byte> payload) override;
     [[nodiscard]] std::span<const NetDatagram> Receive() override;
+    // The wrapped transport's, since it is the one making the calls.
+    [[nodiscard]] NetTransportCounters Counters() const override;
 
     // What the schedule actually did, so a test asserts against the impairment
     // it got rather than the one it asked for.
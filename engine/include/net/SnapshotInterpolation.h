@@ -0,0 +1,153 @@
+#pragma once
+
+#include <math/geometry/3d/Transform3d.h>
+#include <net/NetSession.h>
+#include <net/ReplicationSnapshot.h>
+
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+
+class NetTickEstimator;
+class World;
+
+//=============================================================================
+// SnapshotInterpolation
+//
+// Where a client draws the entities other machines drive.
+//
+// Snapshots land at network rate, on whatever frame the datagram happened to
+// arrive, and applying one moves an entity straight to its new pose. Drawn
+// as it stands that is a pop every snapshot and a stutter whenever two arrive
+// together after a gap. So the pose each snapshot carries is kept, stamped
+// with the authority tick it speaks for, and the entity is drawn a little in
+// the past -- far enough back that the snapshots either side of the moment
+// drawn have usually both arrived, and the blend between them is smooth.
+//
+// How far back is the playout delay, and it follows the jitter the tick
+// estimator measures: a steady connection is drawn two ticks behind the
+// newest word, a ragged one further. The render clock is steered toward that
+// target by at most a tenth of its own rate rather than stepped, so a change
+// in delay -- or the estimator slewing its offset by a tick -- shows as
+// motion running briefly faster or slower, never as a jump.
+//
+// When the moment drawn runs past the newest snapshot, a loss or a late one,
+// the entity carries on along its last two samples for a few ticks and then
+// stops there. Snapping back when the snapshot does land is the price of not
+// freezing on every lost packet; holding the extrapolation short keeps it
+// small.
+//
+// The blend reaches rendering through WorldTransformHistory, the same path
+// tick interpolation takes, so mesh and shadow extraction and the camera rig
+// see one pose and none of them know where it came from. Simulation keeps the
+// applied state; this only moves what is drawn.
+//
+// Only unparented entities are drawn this way: the pose kept is the local
+// one, which is the world pose only at the root. Entities this peer owns are
+// left alone -- they are predicted, or shown as the authority says, but never
+// delayed on purpose.
+//=============================================================================
+class SnapshotInterpolation
+{
+public:
+    // Poses kept per entity. At one snapshot a tick that is a quarter second,
+    // several times the longest playout delay allowed.
+    static constexpr std::size_t kSamplesPerEntity = 16;
+
+    // Playout delay, in ticks: the floor every connection gets, what each tick
+    // of measured jitter adds, and the ceiling past which the world would be
+    // drawn so late that interacting with it stops working.
+    static constexpr double kMinDelayTicks = 2.0;
+    static constexpr double kJitterScale = 2.0;
+    static constexpr double kMaxDelayTicks = 12.0;
+
+    // How far past the newest snapshot an entity is carried on before it
+    // stops, in ticks.
+    static constexpr double kMaxExtrapolationTicks = 6.0;
+
+    struct Counters
+    {
+        // Entities drawn last frame between two snapshots, past the newest,
+        // and stopped at the extrapolation limit or before the oldest.
+        std::uint32_t Interpolated = 0;
+        std::uint32_t Extrapolated = 0;
+        std::uint32_t Held = 0;
+
+        // Snapshots recorded, and the ones no newer than one already recorded
+        // -- reordered on the way, and of no use to a buffer that only moves
+        // forward.
+        std::uint64_t Recorded = 0;
+        std::uint64_t Stale = 0;
+
+        // The delay the render clock is steering toward and the one it is at.
+        double TargetDelayTicks = kMinDelayTicks;
+        double DelayTicks = kMinDelayTicks;
+    };
+
+    // After each snapshot applies on a client. Keeps the pose of every entity
+    // the authority has told this client about, stamped `authorityTick`, and
+    // forgets the ones it has stopped mentioning. Attaches the history an
+    // entity is drawn through, so this must run where structural change is
+    // legal.
+    void Record(World& world, const ReplicationClientIdentity& identity,
+                PeerId localPeer, std::uint64_t authorityTick);
+
+    // Once per presented frame, before anything reads a presentation pose.
+    // `localTick` and `alpha` place the frame on this machine's clock, and
+    // `elapsedTicks` is the frame's length in ticks.
+    void Present(World& world, const NetTickEstimator& clock,
+                 std::uint64_t localTick, double alpha, double elapsedTicks);
+
+    // Off draws remote entities at the tick rate like anything else. Turning
+    // it off drops what was kept; the histories stay and go back to being
+    // filled from the simulation.
+    void SetEnabled(bool enabled);
+    [[nodiscard]] bool IsEnabled() const { return Enabled; }
+
+    [[nodiscard]] const Counters& Stats() const { return Totals; }
+    [[nodiscard]] std::size_t TrackedEntities() const { return Tracks.size(); }
+    // Authority tick being drawn, fractional.
+    [[nodiscard]] double RenderTick() const { return Clock; }
+
+    void Reset();
+
+private:
+    struct Sample
+    {
+        std::uint64_t Tick = 0;
+        Transform3f Pose;
+    };
+
+    // Oldest to newest, ending at Head - 1, wrapping.
+    struct Track
+    {
+        EntityId Entity;
+        std::array<Sample, kSamplesPerEntity> Samples{};
+        std::size_t Head = 0;
+        std::size_t Count = 0;
+        // Which Record last mentioned it; anything older has been destroyed.
+        std::uint64_t Seen = 0;
+
+        [[nodiscard]] const Sample& At(std::size_t age) const;
+        [[nodiscard]] const Sample& Newest() const { return At(0); }
+    };
+
+    enum class Placement : std::uint8_t
+    {
+        Interpolated,
+        Extrapolated,
+        Held,
+    };
+
+    [[nodiscard]] static Placement Place(const Track& track, double tick, Transform3f& pose);
+
+    std::unordered_map<NetEntityId, Track> Tracks;
+    std::uint64_t Generation = 0;
+    std::uint64_t NewestTick = 0;
+
+    double Clock = 0.0;
+    bool Clocked = false;
+
+    bool Enabled = true;
+    Counters Totals;
+};
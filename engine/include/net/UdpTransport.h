@@ -18,6 +18,12 @@
 // jitter buffer, and a socket thread would buy nothing but a synchronization
 // problem. The recorded trigger for revisiting is profiling that shows the pump
 // exceeding its frame budget in a real session.
+//
+// Batched on Linux: Receive drains with recvmmsg and FlushSends hands every
+// queued datagram to one sendmmsg, so a host with a datagram per peer per tick
+// pays a call per pump rather than a call per peer. Elsewhere the same queue
+// drains through one recvfrom/sendto per datagram; the behaviour is identical
+// and only the call count differs, which Counters reports either way.
 //=============================================================================
 class UdpTransport final : public INetTransport
 {
@@ -35,6 +41,10 @@ public:
     [[nodiscard]] bool Send(const NetAddress& to,
                             std::span<const std::byte> payload) override;
     [[nodiscard]] std::span<const NetDatagram> Receive() override;
+    [[nodiscard]] bool Queue(const NetAddress& to,
+                             std::span<const std::byte> payload) override;
+    void FlushSends() override;
+    [[nodiscard]] NetTransportCounters Counters() const override { return Calls; }
 
     // Bounds one pump so a flood cannot hold the frame open indefinitely; the
     // rest waits in the socket buffer for the next frame or is dropped by the
@@ -46,6 +56,10 @@ public:
     // the session layer counts that against it.
     [[nodiscard]] std::uint64_t OversizedDropped() const { return Oversized; }
 
+    // Queued datagrams the platform refused at flush. Queue already accepted
+    // them, so this is the only place such a refusal is visible.
+    [[nodiscard]] std::uint64_t SendFailures() const { return Failed; }
+
 private:
     struct Pending
     {
@@ -54,14 +68,34 @@ private:
         std::size_t Length = 0;
     };
 
+    struct Outgoing
+    {
+        NetAddress To;
+        std::size_t Length = 0;
+    };
+
+    using Slot = std::array<std::byte, kNetMaxDatagramBytes>;
+
+    void ReceiveEach();
+    void ReceiveBatched();
+    void FlushEach();
+    void FlushBatched();
+
     int Socket = -1;
     NetAddress Local;
     std::size_t MaxPerReceive = 256;
     std::uint64_t Oversized = 0;
+    std::uint64_t Failed = 0;
+    NetTransportCounters Calls;
 
     // One slab of fixed-size slots rather than a vector per datagram: the pump
     // runs every frame and must not allocate in steady state.
-    std::vector<std::array<std::byte, kNetMaxDatagramBytes>> Slots;
+    std::vector<Slot> Slots;
     std::vector<Pending> Pendings;
     std::vector<NetDatagram> Received;
+
+    // The send queue, on the same terms: slots grow to the high-water mark of
+    // one flush and are reused from then on.
+    std::vector<Slot> SendSlots;
+    std::vector<Outgoing> Outbox;
 };
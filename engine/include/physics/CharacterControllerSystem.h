@@ -9,9 +9,14 @@ class PhysicsStepSystem;
 // owned by PhysicsStepSystem. The physics-domain partition set selects which
 // movers reconcile and advance; dormant partitions retain component state but
 // have no CharacterVirtual backend object.
+//
+// On a resimulated tick only the context's predicted entities are driven, each
+// from the transform rollback restored.
 class CharacterControllerSystem
 {
 public:
+    static constexpr bool Resimulated = true;
+
     explicit CharacterControllerSystem(PhysicsStepSystem& step);
 
     void Physics(PhysicsContext& ctx);
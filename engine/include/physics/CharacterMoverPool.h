@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <span>
 
 #include <ecs/EntityId.h>
 #include <ecs/StoragePartitionId.h>
@@ -31,6 +32,16 @@ public:
         const StoragePartitionSet& partitions,
         float dt,
         const Vec3d& gravity);
+    // Advances only `entities`' movers, each first placed at its entity's
+    // LocalTransform. The resimulation path: rollback rewrote the predicted
+    // transforms, and a mover keeps its own position, so the replay has to
+    // start it from the restored one rather than from the prediction. Entities
+    // without a bound mover are skipped.
+    void DriveEntities(
+        World& world,
+        std::span<const EntityId> entities,
+        float dt,
+        const Vec3d& gravity);
 
     void EvictPartition(
         World& world,
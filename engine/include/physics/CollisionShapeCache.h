@@ -6,8 +6,40 @@
 
 #include <physics/CollisionShape.h>
 
+struct CollisionShapeBatchImpl;
 struct CollisionShapeCacheImpl;
 
+//=============================================================================
+// CollisionShapeBatch
+//
+// Shapes restored from pre-baked blobs away from any cache. Restoring touches
+// nothing shared, so a zone's collision is restored on the async lane; the
+// batch then moves into the cache on the owner thread with
+// CollisionShapeCache::Adopt, which is a handful of pointer copies.
+//=============================================================================
+class CollisionShapeBatch
+{
+public:
+    CollisionShapeBatch();
+    ~CollisionShapeBatch();
+
+    CollisionShapeBatch(CollisionShapeBatch&&) noexcept;
+    CollisionShapeBatch& operator=(CollisionShapeBatch&&) noexcept;
+    CollisionShapeBatch(const CollisionShapeBatch&) = delete;
+    CollisionShapeBatch& operator=(const CollisionShapeBatch&) = delete;
+
+    // Appends the restored shape and returns true; a malformed blob appends
+    // nothing.
+    [[nodiscard]] bool Restore(std::span<const std::byte> blob);
+
+    [[nodiscard]] std::size_t Count() const;
+
+    [[nodiscard]] CollisionShapeBatchImpl& Internal() { return *Impl; }
+
+private:
+    std::unique_ptr<CollisionShapeBatchImpl> Impl;
+};
+
 //=============================================================================
 // CollisionShapeCache
 //
@@ -35,6 +67,10 @@ public:
     // handle if the blob is malformed.
     [[nodiscard]] CollisionShapeHandle LoadBlob(std::span<const std::byte> blob);
 
+    // Takes every shape in the batch, in order, and returns the handle of the
+    // first; the rest follow it consecutively. Invalid for an empty batch.
+    [[nodiscard]] CollisionShapeHandle Adopt(CollisionShapeBatch&& batch);
+
     [[nodiscard]] bool Has(CollisionShapeHandle handle) const;
     [[nodiscard]] std::size_t Count() const;
 
@@ -11,6 +11,10 @@ struct ZoneResidencyContext;
 // Owns the single retained physics scene for one simulation. Rigid bodies and
 // character movers are simulation-wide backend records keyed by ordinary
 // EntityId; storage partitions only control residency inside that scene.
+//
+// Deliberately not Resimulated: nothing rewinds the scene, so stepping it on a
+// replayed tick would advance every body the client does not predict once per
+// replay. Predicted movers are re-stepped by CharacterControllerSystem.
 class PhysicsStepSystem
 {
 public:
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <span>
 
 #include <math/Quat.h>
 #include <math/Vec.h>
@@ -30,6 +32,11 @@ struct PhysicsWorldConfig
     // an immediate tunneling request.
     float MaxDriveClosingSpeed = 50.0f;
     float MaxDriveClosingAngularSpeed = 30.0f;
+
+    // Smallest AddBodies batch that owes a full broadphase rebuild. A zone
+    // attach lands well above it; a handful of spawns stays with the
+    // incremental insert and the rebalancing Step already does.
+    uint32_t BroadPhaseOptimizeBatch = 128;
 };
 
 struct BodyDesc
@@ -68,6 +75,20 @@ public:
     [[nodiscard]] PhysicsBodyId AddBody(const BodyDesc& desc);
     void RemoveBody(PhysicsBodyId id);
 
+    // AddBody for a whole batch: every body is created detached, then the lot
+    // enters the broadphase in one bulk insertion rather than one tree insert
+    // each. ids[i] receives descs[i]'s body, invalid where AddBody would have
+    // returned invalid; returns how many were added.
+    size_t AddBodies(std::span<const BodyDesc> descs, std::span<PhysicsBodyId> ids);
+
+    // A bulk insertion leaves the broadphase unbalanced. Step rebalances it a
+    // little at a time; OptimizeBroadPhase does all of it at once, a cost
+    // worth paying on a frame that has time to spare (PhysicsStepSystem waits
+    // for one that attached nothing). Only a batch of at least
+    // PhysicsWorldConfig::BroadPhaseOptimizeBatch bodies leaves it pending.
+    void OptimizeBroadPhase();
+    [[nodiscard]] bool BroadPhaseOptimizePending() const;
+
     [[nodiscard]] BodyTransform GetBodyTransform(PhysicsBodyId id) const;
     void SetBodyTransform(PhysicsBodyId id, const Vec3d& position, const Quatf& rotation);
 
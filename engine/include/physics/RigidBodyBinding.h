@@ -58,6 +58,12 @@ public:
     {
         return ReconcileCount;
     }
+    // Bodies the last SyncToPhysics added; zero on a frame that attached
+    // nothing.
+    [[nodiscard]] size_t AttachedLastSync() const
+    {
+        return AttachedCount;
+    }
 
 private:
     struct BodyRecord
@@ -83,4 +89,5 @@ private:
     std::unique_ptr<SceneState> State;
     uint64_t LastStructuralVersion = 0;
     uint64_t ReconcileCount = 0;
+    size_t AttachedCount = 0;
 };
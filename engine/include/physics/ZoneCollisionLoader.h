@@ -1,16 +1,42 @@
 #pragma once
 
 #include <ecs/StoragePartitionId.h>
+#include <math/Vec.h>
+#include <physics/CollisionShapeCache.h>
 
 #include <string>
+#include <vector>
 
-class CollisionShapeCache;
 class World;
 
-// Loads cooked brush collision into the requested storage partition. Zone
-// import passes its hidden partition so collision becomes visible atomically
-// with the rest of the zone. Partition zero remains the explicit default for
+// A zone's cooked brush collision read from disk and restored into shapes, with
+// nothing yet in a cache or a World. RestoreZoneCollision touches no shared
+// state, so a zone load does it on the async lane (in its build) and keeps the
+// owner thread's share to InstallZoneCollision.
+struct RestoredZoneCollision
+{
+    CollisionShapeBatch Shapes;
+    // One per restored shape, in the batch's order.
+    std::vector<Vec3d> Origins;
+};
+
+[[nodiscard]] RestoredZoneCollision RestoreZoneCollision(
+    const std::string& sidecarPath,
+    const std::string& cookedRoot);
+
+// Moves the restored shapes into the cache and spawns one static collider per
+// shape into the requested storage partition; returns how many. Zone import
+// passes its hidden partition so collision becomes visible atomically with the
+// rest of the zone. Partition zero remains the explicit default for
 // world-lifetime collision.
+int InstallZoneCollision(
+    World& world,
+    CollisionShapeCache& cache,
+    RestoredZoneCollision&& collision,
+    StoragePartitionId partition = StoragePartitionId::Default());
+
+// RestoreZoneCollision and InstallZoneCollision in one call, all on the
+// calling thread.
 int LoadZoneCollision(
     World& world,
     CollisionShapeCache& cache,
@@ -27,6 +27,8 @@ enum class CpuScope : std::uint8_t
     ShadowGather,
     // Resolving shadow slot residency and stamping the grants onto the lights.
     ShadowResidency,
+    // Deciding texture mip residency and rebuilding the images that changed.
+    TextureResidency,
     // Recording shadow depth views: per-view culling and draw submission.
     ShadowRecord,
     // Recording the forward opaque pass.
@@ -27,6 +27,17 @@ struct RenderStats
     // geometry it was asked to render.
     std::uint32_t InstancesDropped = 0;
 
+    // Mesh LOD selection, published by extraction. Items emitted below full
+    // detail, and the triangles the emitted items would have cost at full
+    // detail: SubmittedTriangles against that is what the LODs saved.
+    std::uint32_t LodReducedItems = 0;
+    std::uint32_t FullDetailTriangles = 0;
+
+    // Meshlet culling in the forward pass: meshlets tested against the
+    // camera, and those the frustum or a back-face cone rejected.
+    std::uint32_t MeshletsTested = 0;
+    std::uint32_t MeshletsCulled = 0;
+
     // Light extraction.
     std::uint32_t LightsVisible = 0;
     std::uint32_t LightsDroppedAtCap = 0;
@@ -47,6 +58,8 @@ struct RenderStats
     // Instanced shadow draws. Compared against ShadowCasterDraws this says
     // whether batching is collapsing casters or drawing them one at a time.
     std::uint32_t ShadowInstanceRuns = 0;
+    // Meshlets of lone casters outside a shadow view, summed over views.
+    std::uint32_t ShadowMeshletsCulled = 0;
     std::uint32_t ShadowSlotsHeld = 0;
     std::uint32_t ShadowCacheHits = 0;
     std::uint32_t ShadowRequestsDenied = 0;
@@ -62,6 +75,23 @@ struct RenderStats
     // an unload is a leak.
     std::uint32_t ProbeVolumesResident = 0;
 
+    // Texture mip streaming. Resident bytes are the streamed textures' GPU
+    // images against the budget they are held to; requested and resident
+    // mips are level counts summed across those textures, and the gap
+    // between them is demand the budget or the upload clamp is holding back.
+    // Latency is the most recent request's wait from wanting levels to
+    // holding them, in microseconds.
+    std::uint32_t TexturesStreamed = 0;
+    std::uint64_t TextureResidentBytes = 0;
+    std::uint64_t TextureBudgetBytes = 0;
+    std::uint32_t TextureMipsRequested = 0;
+    std::uint32_t TextureMipsResident = 0;
+    std::uint32_t TexturesPending = 0;
+    std::uint32_t TexturePromotions = 0;
+    std::uint32_t TextureEvictions = 0;
+    std::uint64_t TextureUploadBytes = 0;
+    std::uint64_t TextureStreamLatencyUs = 0;
+
     // Frame services. HighWater is the largest slice use ever reached, for
     // sizing the budget; UsedBytes is this frame alone. AllocFailures counts
     // the requests the slice could not serve and PassesSkipped the passes
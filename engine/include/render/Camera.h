@@ -26,6 +26,10 @@ struct CameraRenderData
     Mat4 ViewProjection = Mat4::Identity();
     Vec3d Position;
     Frustum ViewFrustum;
+    // Target height in pixels, for turning world sizes into screen sizes.
+    // Zero when the producer has no target, which keeps mesh LODs at full
+    // detail.
+    float ViewportHeight = 0.0f;
 
     // Mesh extraction skips this entity for this camera. It is derived per frame
     // from the camera's rig, never authored and never simulation state: which
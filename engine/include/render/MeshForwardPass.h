@@ -13,6 +13,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <optional>
+#include <vector>
 
 struct GpuSpotShadow
 {
@@ -126,6 +127,10 @@ public:
         // a frame that dropped its scene cannot read as a cheap frame.
         bool Skipped = false;
         uint32_t InstancesDropped = 0;
+        // Meshlets of single-instance, full-detail draws tested against the
+        // camera, and those rejected by the frustum or their back-face cone.
+        uint32_t MeshletsTested = 0;
+        uint32_t MeshletsCulled = 0;
     };
     [[nodiscard]] DrawStats GetLastDrawStats() const { return LastStats; }
 
@@ -143,10 +148,17 @@ private:
                                              const RenderQueue& queue);
     void BindFrameState(const FrameContext& frame, VkDeviceSize uniformOffset);
     // Draws are clipped to `streamedInstances`: a run past the stream has no
-    // instance data to read.
-    void DrawRuns(const FrameContext& frame, const RenderQueue& queue,
-                  StaticMeshCache& meshes, MaterialCache& materials, Vec4 tint,
-                  uint32_t streamedInstances);
+    // instance data to read. A run of one instance at full detail whose
+    // section carries meshlets draws only the meshlets `camera` can see.
+    void DrawRuns(const FrameContext& frame, const CameraRenderData& camera,
+                  const RenderQueue& queue, StaticMeshCache& meshes,
+                  MaterialCache& materials, Vec4 tint, uint32_t streamedInstances);
+    // Fills VisibleRanges with what `item`'s run draws. False when every
+    // meshlet was rejected and the run draws nothing.
+    [[nodiscard]] bool CollectVisibleRanges(const CameraRenderData& camera,
+                                            const RenderQueueItem& item,
+                                            const StaticMeshSection& section,
+                                            uint32_t drawCount);
 
     VulkanBufferService* Buffers = nullptr;
     VulkanDescriptorCache* Descriptors = nullptr;
@@ -175,4 +187,7 @@ private:
     VkFormat CachedColorFormat = VK_FORMAT_UNDEFINED;
     VkFormat CachedDepthFormat = VK_FORMAT_UNDEFINED;
     DrawStats LastStats;
+    // Index ranges of the run being drawn. Held across frames so the run
+    // walk does not allocate.
+    std::vector<MeshIndexRange> VisibleRanges;
 };
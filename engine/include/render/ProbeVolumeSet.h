@@ -101,7 +101,7 @@ struct ZoneProbeResidency
 };
 
 // Reads the probe payload cooked beside a scene: for
-// `<dir>/<stem>.cooked.json` the cook writes `<dir>/<stem>/probes.sprobe`.
+// `<dir>/<stem>.cooked.sscn` the cook writes `<dir>/<stem>/probes.sprobe`.
 // A missing file is the no-authored-volumes case, not an error (returns
 // false with `out` empty). Pure file IO, safe on a zone build task thread.
 bool ReadZoneProbeFile(const std::string& cookedScenePath, ProbeVolumeFile& out);
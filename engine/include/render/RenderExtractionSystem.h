@@ -9,10 +9,13 @@
 #include <render/RenderQueue.h>
 #include <render/StaticMeshComponent.h>
 #include <render/TextureHandle.h>
+#include <render/TextureResidency.h>
+#include <render/static_mesh/MeshLod.h>
 #include <render/static_mesh/StaticMeshCache.h>
 #include <world/transform/TransformComponents.h>
 #include <world/transform/TransformHistory.h>
 
+#include <cstddef>
 #include <cstdint>
 #include <optional>
 #include <span>
@@ -66,7 +69,9 @@ void BuildZoneLightmapTable(
 //
 // Walks visible-partition StaticMeshComponents and emits one RenderQueueItem
 // per enabled section into the RenderQueue. World-space bounds are computed
-// here for use by the subsequent culling pass.
+// here for use by the subsequent culling pass, and each entity's mesh LOD is
+// selected here (MeshLod.h) against the level it drew last frame in the same
+// view.
 //
 // The query is cached per instance to avoid rebuild-from-scratch every frame;
 // a World* sentinel detects world changes.
@@ -82,6 +87,10 @@ public:
     // simulation tick (PresentationTime::Alpha). Entities carrying
     // WorldTransformHistory render the blend at that point; everything else
     // renders its live WorldTransform.
+    // `textureDemand`, when non-null, receives each emitted section's
+    // projected size against every texture its material samples; the caller
+    // has already begun the demand's frame.
+    // `lodPolicy` sets the screen-space error mesh LODs are chosen against.
     void Extract(
         const World& world,
         const StoragePartitionSet& partitions,
@@ -91,9 +100,48 @@ public:
         const CameraRenderData& camera,
         RenderQueue& queue,
         const TextureCache* textures = nullptr,
-        double interpolationAlpha = 1.0);
+        double interpolationAlpha = 1.0,
+        TextureStreamingDemand* textureDemand = nullptr,
+        const MeshLodPolicy& lodPolicy = MeshLodPolicy{});
+
+    // LOD outcome of the last Extract: items emitted below full detail, and
+    // the triangles every emitted item would have cost at full detail.
+    // Against the forward pass's submitted triangles, the second says what
+    // LOD selection saved.
+    struct LodStats
+    {
+        uint32_t ReducedItems = 0;
+        uint32_t FullDetailTriangles = 0;
+    };
+    [[nodiscard]] LodStats GetLastLodStats() const { return LastLodStats; }
 
 private:
+    // The level an entity drew last, indexed by entity index; a generation
+    // mismatch means the slot belongs to an earlier entity and starts fresh.
+    struct LodState
+    {
+        uint32_t Generation = 0;
+        uint32_t Level = kNoMeshLod;
+    };
+
+    // One view's LodStates, keyed by its camera entity. Each view projects an
+    // entity to its own size, so a table shared between two views would flip
+    // between their levels on every extract and hold no hysteresis at all.
+    struct ViewLodStates
+    {
+        EntityId Camera;
+        uint64_t LastExtract = 0;
+        // Grows with the highest entity index seen and is never cleared, so
+        // the hysteresis survives an entity leaving and re-entering the
+        // frustum.
+        std::vector<LodState> States;
+    };
+
+    // Views past this many recycle the one extracted least recently.
+    static constexpr std::size_t kMaxLodViews = 8;
+
+    [[nodiscard]] std::vector<LodState>& LodStatesFor(EntityId camera);
+
     const World* LastWorld = nullptr;
     std::optional<Query<Read<WorldTransform>,
                         Read<StaticMeshComponent>,
@@ -105,4 +153,7 @@ private:
     std::vector<ZoneLightmapBinding> LightmapBindings;
     std::vector<std::pair<StoragePartitionId, ZoneLightmapIndices>> ResolvedLightmaps;
     std::vector<ZoneLightmapIndices> LightmapTable;
+    std::vector<ViewLodStates> LodViews;
+    uint64_t ExtractCount = 0;
+    LodStats LastLodStats;
 };
@@ -40,6 +40,10 @@ struct RenderQueueItem
     StaticMeshHandle Mesh;
     MaterialHandle Material;
     uint32_t SectionIndex = 0;
+    // Detail level the section draws at: 0 is the section's own range, n its
+    // nth StaticMeshLod. Extraction clamps it to the section's chain, so
+    // equal levels always mean equal index ranges (run-merge identity).
+    uint32_t Lod = 0;
     Mat4 WorldMatrix = Mat4::Identity();
     Aabb3d WorldBounds = Aabb3d::Empty();
     float CameraDepth = 0.0f;
@@ -63,7 +67,7 @@ struct RenderQueueItem
 [[nodiscard]] uint64_t BuildOpaqueSortKey(const RenderQueueItem& item);
 
 // A run of consecutive OpaqueOrder() entries that share pipeline, mesh, section,
-// and material: one instanced draw call. Built by SortOpaque() from the actual
+// LOD, and material: one instanced draw call. Built by SortOpaque() from the actual
 // item fields, so truncated sort-key bits cannot compromise correctness.
 struct RenderQueueRun
 {
@@ -58,6 +58,9 @@ public:
         // section collapse into one, so this scales with distinct draws times
         // views rather than with caster count.
         std::uint32_t InstanceRuns = 0;
+        // Meshlets of single-caster draws rejected by a view's frustum,
+        // summed over views.
+        std::uint32_t MeshletsCulled = 0;
         // Set when the pass had views to render and abandoned all of them
         // (missing pipelines, or a frame-scratch request it could not serve).
         bool Skipped = false;
@@ -114,6 +117,8 @@ private:
     // Per-view visible set, in draw-run order. Held across frames so a view
     // walk does not allocate.
     std::vector<std::uint32_t> VisibleCasters;
+    // Index ranges of the run being drawn, likewise held.
+    std::vector<MeshIndexRange> VisibleRanges;
 
     // Bind-state dedup within one view.
     VkPipeline LastPipeline = VK_NULL_HANDLE;
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
+#include <span>
 #include <vector>
 
 //=============================================================================
@@ -59,7 +61,7 @@ struct TextureMipLevel
     uint32_t Width = 0;
     uint32_t Height = 0;
 
-    // Byte range within TextureData::Blob.
+    // Byte range within TextureData::Pixels().
     uint64_t Offset = 0;
     uint64_t ByteSize = 0;
 };
@@ -74,14 +76,25 @@ struct TextureData
     uint32_t Width = 0;
     uint32_t Height = 0;
 
-    // Tightly packed mip payloads, largest first.
+    // Tightly packed mip payloads, largest first. Owned in Blob, or -- for a
+    // texture staged from a view of its file -- borrowed in BorrowedBlob,
+    // which BlobOwner keeps alive. Borrowing is what lets a cooked mip chain
+    // go from the page cache to upload staging memory in one copy. Readers
+    // go through Pixels(); producers fill Blob.
     std::vector<TextureMipLevel> Mips;
     std::vector<uint8_t> Blob;
+    std::span<const uint8_t> BorrowedBlob;
+    std::shared_ptr<const void> BlobOwner;
+
+    [[nodiscard]] std::span<const uint8_t> Pixels() const
+    {
+        return BorrowedBlob.empty() ? std::span<const uint8_t>(Blob) : BorrowedBlob;
+    }
 
     [[nodiscard]] bool IsValid() const
     {
         return Format != TexturePixelFormat::Unknown && Width > 0 && Height > 0
-            && !Mips.empty() && !Blob.empty();
+            && !Mips.empty() && !Pixels().empty();
     }
 };
 
@@ -0,0 +1,201 @@
+#pragma once
+
+#include <math/Mat.h>
+#include <render/TextureData.h>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// Levels at or below this extent (largest side, in texels) form a streamed
+// texture's mip tail: the part a commit uploads before anything has asked for
+// the texture. A 128-texel BC7 level is 16 KiB (about 21 KiB with its chain),
+// so every resident texture costs a known small floor whether or not it is
+// ever looked at.
+inline constexpr std::uint32_t kTextureMipTailExtent = 128;
+
+// Index of the first level in `mips` (largest first) whose larger side fits in
+// `tailExtent`, or the last level when none does. Zero means the whole texture
+// is tail and there is nothing to stream.
+[[nodiscard]] std::uint32_t TextureMipTailTopMip(std::span<const TextureMipLevel> mips,
+                                                 std::uint32_t tailExtent = kTextureMipTailExtent);
+
+// The largest level a texture drawn `screenPixels` tall needs: the smallest
+// mip index whose larger side still covers the projected size, so sampling
+// stays at or above one texel per pixel. Clamped to the chain; a texture not
+// on screen wants its last level.
+[[nodiscard]] std::uint32_t TextureDesiredTopMip(std::uint32_t width,
+                                                 std::uint32_t height,
+                                                 std::uint32_t mipCount,
+                                                 float screenPixels);
+
+//=============================================================================
+// TextureStreamingDemand
+//
+// One frame's screen-space texel demand, keyed by bindless image index (what
+// materials carry). Extraction notes each drawn section's projected size
+// against every texture its material samples; a texture keeps the largest
+// size any draw asked of it. Retains its storage across frames, so a
+// steady-state frame allocates nothing.
+//
+// Sizes come from the draw's world bounds, not from cooked UV density: a
+// texture is assumed to span its mesh once. Tiled or atlased UVs want more
+// texels than this estimates, which the residency budget absorbs as a slower
+// climb rather than a wrong answer.
+//=============================================================================
+class TextureStreamingDemand
+{
+public:
+    // Clears last frame's notes and latches this frame's projection: pixels
+    // per world unit at unit depth for perspective, per world unit outright
+    // for orthographic.
+    void BeginFrame(const Mat4& projection, float viewportHeight);
+
+    // Projected height in pixels of something `worldDiameter` across seen at
+    // `cameraDepth` under the latched projection.
+    [[nodiscard]] float ProjectedPixels(float worldDiameter, float cameraDepth) const;
+
+    // Records that `texture` is drawn `screenPixels` tall. Invalid indices
+    // (UINT32_MAX, the material's "no texture") are ignored.
+    void Note(std::uint32_t texture, float screenPixels);
+
+    // Largest size noted for `texture` this frame; zero when nothing drew it.
+    [[nodiscard]] float ScreenPixels(std::uint32_t texture) const;
+
+    [[nodiscard]] std::span<const std::uint32_t> NotedTextures() const { return Noted; }
+
+private:
+    std::vector<float> Pixels;
+    std::vector<std::uint32_t> Noted;
+    float PixelScale = 0.0f;
+    bool Orthographic = false;
+};
+
+struct TextureStreamingBudgets
+{
+    // Bytes held across every streamed texture's GPU image. Zero removes
+    // the clamp.
+    std::uint64_t ResidentBytes = 512ull * 1024 * 1024;
+    // Bytes uploaded per frame by promotions. A frame always serves at least
+    // one, so a texture larger than the clamp still streams. Zero removes
+    // the clamp.
+    std::uint64_t UploadBytesPerFrame = 16ull * 1024 * 1024;
+};
+
+// One residency move: the texture's GPU image is rebuilt holding levels
+// ToTopMip and below. Lower than FromTopMip is a promotion, higher is an
+// eviction.
+struct TextureMipChange
+{
+    std::uint32_t Texture = UINT32_MAX;
+    std::uint32_t FromTopMip = 0;
+    std::uint32_t ToTopMip = 0;
+};
+
+struct TextureStreamingFrameStats
+{
+    std::uint32_t StreamedTextures = 0;
+    // Mip levels summed across streamed textures: what this frame's demand
+    // asked for, and what the GPU images hold after this frame's changes.
+    // Requested above resident means the budget or the upload clamp is
+    // holding textures back.
+    std::uint32_t RequestedMips = 0;
+    std::uint32_t ResidentMips = 0;
+    std::uint32_t PendingTextures = 0;
+    std::uint32_t Promotions = 0;
+    std::uint32_t Evictions = 0;
+    std::uint64_t ResidentBytes = 0;
+    std::uint64_t BudgetBytes = 0;
+    // Chains rebuilt this frame; evictions rebuild too and count here,
+    // though only promotions are held to the upload clamp.
+    std::uint64_t UploadedBytes = 0;
+    // Time from a texture first wanting more than it held to holding it, for
+    // the most recent request that completed; not reset per frame.
+    double LastLatencyMs = 0.0;
+};
+
+//=============================================================================
+// TextureResidency
+//
+// Decides how many mip levels each streamed texture holds on the GPU.
+// Deterministic and CPU-only: identical demand and budgets produce identical
+// changes, and applying them is the caller's job (TextureCache rebuilds the
+// image and repoints the bindless slot).
+//
+// A tracked texture never drops below its mip tail. Each frame it wants the
+// level its largest on-screen draw needs; unseen textures want their tail.
+// Promotions are served largest deficit first (levels short of the want),
+// then by screen size, within the per-frame upload clamp. When a promotion
+// would exceed the resident budget, textures holding more than they want
+// shed their top level one at a time, longest unseen first; a promotion that
+// still does not fit is trimmed to the levels that do, and waits otherwise.
+// A budget lowered under the resident total sheds the same way before any
+// promotion runs.
+//=============================================================================
+class TextureResidency
+{
+public:
+    // Starts tracking `texture` holding levels `residentTopMip` and below.
+    // Re-tracking replaces the previous record (a hot reload may change the
+    // chain).
+    void Track(std::uint32_t texture, std::span<const TextureMipLevel> mips,
+               std::uint32_t residentTopMip, std::uint32_t tailTopMip);
+    void Untrack(std::uint32_t texture);
+
+    [[nodiscard]] bool IsTracked(std::uint32_t texture) const;
+    [[nodiscard]] std::uint32_t ResidentTopMip(std::uint32_t texture) const;
+
+    // `nowMs` is any monotonic clock; it only feeds the latency statistic.
+    void Update(const TextureStreamingDemand& demand,
+                const TextureStreamingBudgets& budgets,
+                double nowMs);
+
+    [[nodiscard]] std::span<const TextureMipChange> Changes() const { return FrameChanges; }
+
+    // A change the caller could not apply (image creation or upload failed):
+    // the texture returns to what it held before, and a promotion retries on
+    // a later frame.
+    void MarkChangeFailed(std::uint32_t texture);
+
+    [[nodiscard]] const TextureStreamingFrameStats& FrameStats() const { return Stats; }
+
+    void Reset();
+
+private:
+    struct Entry
+    {
+        bool Live = false;
+        std::uint32_t Width = 0;
+        std::uint32_t Height = 0;
+        // Bytes of each level, largest first.
+        std::vector<std::uint64_t> LevelBytes;
+        std::uint32_t TailTopMip = 0;
+        std::uint32_t ResidentTopMip = 0;
+        std::uint32_t WantedTopMip = 0;
+        float ScreenPixels = 0.0f;
+        std::uint32_t LastSeenFrame = 0;
+        // Set when the want first moved above what is held; cleared when a
+        // promotion catches up.
+        bool Waiting = false;
+        double WaitingSinceMs = 0.0;
+
+        // Per-frame transient: where the texture started this frame, so a
+        // failed change can restore it.
+        std::uint32_t FrameStartTopMip = 0;
+    };
+
+    [[nodiscard]] static std::uint64_t ChainBytes(const Entry& entry, std::uint32_t topMip);
+    [[nodiscard]] std::uint64_t ShedSurplus(std::uint64_t bytesNeeded, std::uint32_t protect);
+    void RecordChange(std::uint32_t texture);
+    void BuildStats(std::uint64_t budgetBytes);
+
+    std::vector<Entry> Entries;
+    std::vector<TextureMipChange> FrameChanges;
+    std::vector<std::uint32_t> Candidates;
+    std::vector<std::uint32_t> Victims;
+    TextureStreamingFrameStats Stats;
+    std::uint64_t ResidentBytes = 0;
+    std::uint64_t UploadedBytes = 0;
+    std::uint32_t FrameNumber = 0;
+    double LastLatencyMs = 0.0;
+};
@@ -71,6 +71,7 @@ private:
 
     void OnFree(SkinnedMeshEntry& entry);
     bool IsEntryLive(const SkinnedMeshEntry& entry) const;
+    AssetFootprint WarmFootprint(const SkinnedMeshEntry& entry) const;
 
     Logger& Log;
     VulkanBufferService* Buffers = nullptr;
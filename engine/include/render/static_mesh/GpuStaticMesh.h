@@ -24,6 +24,10 @@ struct GpuStaticMesh
     Aabb3d LocalBounds = Aabb3d::Empty();
 
     std::vector<StaticMeshSection> Sections;
+
+    // ComputeMeshLodErrors over Sections, taken once at upload so extraction
+    // selects a level without walking the chains per entity.
+    std::vector<float> LodErrors;
 };
 
 // Validates and uploads `geometry` into GPU buffers, filling `out`. Returns
@@ -37,3 +41,7 @@ struct GpuStaticMesh
 // Destroys the GPU buffers `mesh` holds and clears them. Safe on an
 // already-empty mesh.
 void DestroyGpuMesh(VulkanBufferService& buffers, GpuStaticMesh& mesh);
+
+// Bytes the vertex and index buffers occupy, as UploadMeshGeometryToGpu
+// sized them.
+[[nodiscard]] uint64_t GpuMeshByteSize(const GpuStaticMesh& mesh);
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <render/static_mesh/StaticMeshSection.h>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+//=============================================================================
+// Mesh LOD selection
+//
+// The cook simplifies each section into a chain of coarser index ranges
+// (StaticMeshSection::Lods), each with the geometric error it introduces.
+// Extraction picks one level per entity from that error as it would appear
+// on screen: the coarsest level whose error projects under
+// MeshLodPolicy::PixelError. Every section of the entity draws at that
+// level, or at its own coarsest when its chain is shorter.
+//
+// Hysteresis: a level is kept while its error stays under the budget, and
+// an entity only coarsens once the next level projects under the budget
+// shrunk by Hysteresis. An entity sitting on a boundary therefore does not
+// swap levels every frame as it or the camera jitters.
+//
+// Pure: no GPU state, testable without a device.
+//=============================================================================
+
+struct MeshLodPolicy
+{
+    // Largest error, in pixels, a drawn level may show. Zero draws full
+    // detail.
+    float PixelError = 1.0f;
+    // Fraction of PixelError a coarser level must clear before the entity
+    // drops to it. 0 disables the band.
+    float Hysteresis = 0.25f;
+};
+
+// No level chosen yet: selection starts fresh, without the hysteresis band.
+inline constexpr uint32_t kNoMeshLod = UINT32_MAX;
+
+// Error per level of a whole mesh. Level 0 is exact; level n is the largest
+// error any section shows there (a section with a shorter chain shows its
+// coarsest). A mesh without LODs yields one entry.
+[[nodiscard]] std::vector<float> ComputeMeshLodErrors(std::span<const StaticMeshSection> sections);
+
+// `level` clamped to the levels `section` carries.
+[[nodiscard]] uint32_t ClampSectionLod(const StaticMeshSection& section, uint32_t level);
+
+// The index range `section` draws at `level` (clamped).
+[[nodiscard]] MeshIndexRange SectionLodRange(const StaticMeshSection& section, uint32_t level);
+
+// The level to draw given the mesh's per-level errors, how many pixels one
+// mesh unit spans where the entity sits, and the level it drew last
+// (kNoMeshLod for none). Zero or negative `pixelsPerUnit` means the
+// projection is unknown and draws full detail.
+[[nodiscard]] uint32_t SelectMeshLod(std::span<const float> levelErrors,
+                                     float pixelsPerUnit,
+                                     uint32_t current,
+                                     const MeshLodPolicy& policy);
@@ -24,7 +24,11 @@ struct MeshValidationResult
 
 // Geometry invariants every producer must meet (the runtime never fixes
 // data): non-empty vertex/index/section streams, finite attributes, tangent
-// w of ±1, in-range indices, sections within their buffers.
+// w of ±1, in-range indices, sections within their buffers, and each
+// section's LODs within the index buffer and its vertex range, whole
+// triangles, at most kMaxMeshLods of them, errors non-decreasing; its
+// meshlets, when present, tile its base range in whole triangles with finite
+// bounds.
 [[nodiscard]] MeshValidationResult ValidateMeshGeometry(const MeshGeometry& mesh);
 
 // Geometry plus the skinning invariants: a valid skeleton path, joint count
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <math/Mat.h>
+#include <math/Vec.h>
+#include <math/geometry/3d/Frustum.h>
+#include <render/static_mesh/StaticMeshSection.h>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+//=============================================================================
+// Meshlet culling
+//
+// The cook cuts each section's base range into meshlets
+// (StaticMeshSection::Meshlets), each with a bounding sphere and a cone
+// holding its triangle normals. Per view, a pass rejects the meshlets whose
+// sphere lies outside the frustum or whose cone faces wholly away from the
+// eye, and draws what is left as index ranges, adjacent survivors merged
+// into one draw.
+//
+// Everything happens in the mesh's local space: the frustum is taken from
+// the view-projection times the world matrix, and the eye is carried back
+// through the world matrix's inverse. Which side of a triangle faces a
+// point survives any invertible affine map, so the cone test stays exact
+// under non-uniform scale; a mirroring transform flips winding, and the
+// view built for it does not cull back faces at all.
+//
+// Pure: no GPU state, testable without a device.
+//=============================================================================
+
+struct MeshletCullView
+{
+    // The view frustum in the mesh's local space.
+    Frustum LocalFrustum;
+    // Reject meshlets facing wholly away from the eye. Off for views that
+    // only need coverage (shadow depth), double-sided materials, and
+    // mirroring transforms.
+    bool CullBackfaces = false;
+    // An orthographic view looks along Forward from everywhere; a
+    // perspective one from Eye. Both in local space.
+    bool Orthographic = false;
+    Vec3d Eye{};
+    Vec3d Forward{};
+};
+
+// Frustum only, for views that skip the cone test (shadow depth).
+[[nodiscard]] MeshletCullView MakeMeshletCullView(const Mat4& viewProjection,
+                                                  const Mat4& worldMatrix);
+
+// Frustum and back-face cones, from a camera's view and projection.
+[[nodiscard]] MeshletCullView MakeMeshletCullView(const Mat4& view,
+                                                  const Mat4& projection,
+                                                  const Mat4& worldMatrix);
+
+[[nodiscard]] bool IsMeshletVisible(const StaticMeshMeshlet& meshlet,
+                                    const MeshletCullView& view);
+
+// Appends the index ranges of the meshlets `view` can see to `out`, in
+// meshlet order, merging neighbours that touch. Returns the meshlets
+// rejected.
+uint32_t CullMeshlets(std::span<const StaticMeshMeshlet> meshlets,
+                      const MeshletCullView& view,
+                      std::vector<MeshIndexRange>& out);
@@ -61,6 +61,7 @@ private:
 
     void OnFree(StaticMeshEntry& entry);
     bool IsEntryLive(const StaticMeshEntry& entry) const;
+    AssetFootprint WarmFootprint(const StaticMeshEntry& entry) const;
 
     bool UploadMesh(const MeshGeometry& data, StaticMeshEntry& out);
 
@@ -1,8 +1,52 @@
 #pragma once
 
+#include <math/Vec.h>
 #include <math/geometry/3d/Aabb3d.h>
 
+#include <cstddef>
 #include <cstdint>
+#include <vector>
+
+// Coarser levels a section may carry beyond its own range. The opaque sort
+// key spends three bits on the drawn level, base included (RenderQueue.cpp).
+inline constexpr std::size_t kMaxMeshLods = 7;
+
+// One coarser stand-in for a section: a range of the same index buffer, over
+// the section's own vertex range, that extraction draws in its place once the
+// level's error projects small enough on screen (MeshLod.h).
+struct StaticMeshLod
+{
+    uint32_t IndexOffset = 0;
+    uint32_t IndexCount = 0;
+
+    // How far the level's surface may stray from the section's, in mesh
+    // units. Non-decreasing along a section's chain.
+    float Error = 0.0f;
+};
+
+// A cluster of a section's base triangles: a contiguous slice of its index
+// range, small enough that culling it on its own pays (MeshletCulling.h).
+// Center and Radius bound its vertices; every triangle's geometric normal
+// lies within acos(ConeCutoff) of ConeAxis. ConeCutoff <= 0 means no
+// useful cone, and the meshlet is never rejected as back-facing.
+struct StaticMeshMeshlet
+{
+    uint32_t IndexOffset = 0;
+    uint32_t IndexCount = 0;
+
+    Vec3d Center{};
+    float Radius = 0.0f;
+
+    Vec3d ConeAxis{};
+    float ConeCutoff = -1.0f;
+};
+
+// A range of the index buffer to draw.
+struct MeshIndexRange
+{
+    uint32_t IndexOffset = 0;
+    uint32_t IndexCount = 0;
+};
 
 struct StaticMeshSection
 {
@@ -15,4 +59,11 @@ struct StaticMeshSection
     uint32_t MaterialSlot = 0;
 
     Aabb3d LocalBounds = Aabb3d::Empty();
+
+    // Finest first; empty for a section drawn at full detail only.
+    std::vector<StaticMeshLod> Lods{};
+
+    // In index order, partitioning the base range; empty for a section that
+    // always draws whole. LOD ranges are not clustered.
+    std::vector<StaticMeshMeshlet> Meshlets{};
 };
@@ -14,6 +14,7 @@
 #include <unordered_map>
 #include <vector>
 
+class AsyncTaskQueue;
 class WorldComponentSchema;
 
 // Runtime partition zero is reserved for entities whose lifetime is the whole
@@ -136,7 +137,27 @@ public:
     // brackets one frame of writes for Changed<T>.
     void EndFrameView();
 
+    // Where zone detach captures run. FinalizeResidencyProcessing moves a
+    // detaching zone's chunk slabs out of the World on the owner thread; with a
+    // lane, the ZoneStateStore diff over them runs on the queue's compute
+    // threads and commits at its drain. Without one it runs inline, before
+    // FinalizeResidencyProcessing returns. The queue must outlive any capture
+    // it is handed or be destroyed first; a capture the queue drops is lost.
+    void SetDetachCaptureLane(AsyncTaskQueue* tasks) { DetachCaptureLane_ = tasks; }
+
+    // Commits every capture still in flight for the zone, running the diff on
+    // this thread if no worker has started it. BeginZoneImport calls this, so
+    // a re-import never reads the store before the previous detach landed.
+    void CompleteDetachCaptures(ZoneId zone);
+
+    [[nodiscard]] std::size_t PendingDetachCaptureCount() const
+    {
+        return PendingCaptures_.size();
+    }
+
 private:
+    struct PendingDetachCapture;
+
     struct ParticipationRequest
     {
         ZoneId Zone;
@@ -155,6 +176,8 @@ private:
     void RecordDetaching(
         const RuntimeZoneRecord& record,
         ZoneParticipation previous);
+    void CaptureDetachedZone(ZoneId zone, DetachedPartition rows);
+    void CommitDetachCapture(const std::shared_ptr<PendingDetachCapture>& job);
 
     World Entities_;
 
@@ -174,4 +197,7 @@ private:
     FrameZoneView FrameViewScratch_;
     bool ResidencyProcessing_ = false;
     bool FrameViewLive_ = false;
+
+    AsyncTaskQueue* DetachCaptureLane_ = nullptr;
+    std::vector<std::shared_ptr<PendingDetachCapture>> PendingCaptures_;
 };
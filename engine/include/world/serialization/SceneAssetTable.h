@@ -0,0 +1,132 @@
+#pragma once
+
+#include <audio/AudioClipCache.h>
+#include <core/assets/AssetId.h>
+#include <core/assets/AssetRef.h>
+#include <render/Material.h>
+#include <render/static_mesh/StaticMeshHandle.h>
+#include <render/TextureHandle.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+class AssetSystem;
+class BinaryReader;
+class BinaryWriter;
+
+//=============================================================================
+// SceneAssetTable
+//
+// The asset references of one binary scene, one entry per distinct
+// (type, path). Handle fields in the binary path write an index into this
+// table instead of a path, so a mesh placed on a thousand entities carries
+// its path once. An entry can also carry the AssetId a cook stamped on the
+// ref; as in the text form, the id wins at load when the registry knows it.
+//
+// Save: the field codecs Intern as the component chunks are written, and
+// SaveSceneBinary writes the table in its own chunk ahead of them.
+//
+// Load: LoadSceneBinary reads that chunk and calls Resolve before any
+// component decodes, which loads every entry in one pass. A field load is
+// then an index and a refcount bump (Acquire*), and hands the field its own
+// reference exactly as the text path's Load* would. The table keeps one
+// reference per resolved entry until ReleaseAll, so an asset shared by many
+// fields stays resident between them.
+//=============================================================================
+class SceneAssetTable
+{
+public:
+    struct Entry
+    {
+        AssetType Type = AssetType::Unknown;
+        std::string Path;
+        AssetId Id{};
+    };
+
+    // The index a binary handle field holds for a null handle: no ref, so
+    // nothing to intern or resolve.
+    static constexpr std::uint32_t NoEntry = 0xFFFFFFFFu;
+
+    SceneAssetTable() = default;
+    SceneAssetTable(const SceneAssetTable&) = delete;
+    SceneAssetTable& operator=(const SceneAssetTable&) = delete;
+
+    // Index of the (type, path) entry, appended on first use. A valid id is
+    // kept on the entry if it has none yet.
+    [[nodiscard]] std::uint32_t Intern(AssetType type, std::string_view path, AssetId id = {});
+
+    [[nodiscard]] std::span<const Entry> Entries() const { return Table; }
+    [[nodiscard]] bool Empty() const { return Table.empty(); }
+
+    // Wire layout: uint32 count, then per entry uint16 AssetType, a
+    // length-prefixed path and (chunk version 2) the uint64 AssetId, zero for
+    // none. Read takes the chunk's version, replaces the table's entries and
+    // drops any resolution; call it before Resolve, never between Resolve and
+    // ReleaseAll.
+    [[nodiscard]] bool Write(BinaryWriter& writer) const;
+    [[nodiscard]] bool Read(BinaryReader& reader, std::uint32_t version);
+
+    // The entry at `index`; null when out of range.
+    [[nodiscard]] const Entry* At(std::uint32_t index) const;
+
+    // Loads every entry once. An entry that fails to load (or whose type has
+    // no scene codec) stays unresolved, and only a field that references it
+    // fails. Returns the number of entries left unresolved.
+    std::size_t Resolve(AssetSystem& assets);
+
+    // A new reference to a resolved entry for one field; invalid when the
+    // index is out of range, unresolved, or of another type.
+    [[nodiscard]] StaticMeshHandle AcquireStaticMesh(std::uint32_t index, AssetSystem& assets) const;
+    [[nodiscard]] MaterialHandle AcquireMaterial(std::uint32_t index, AssetSystem& assets) const;
+    [[nodiscard]] TextureHandle AcquireTexture(std::uint32_t index, AssetSystem& assets) const;
+    [[nodiscard]] AudioClipHandle AcquireAudioClip(std::uint32_t index, AssetSystem& assets) const;
+
+    // The path an entry names, for diagnostics. Empty when out of range.
+    [[nodiscard]] std::string_view PathAt(std::uint32_t index) const;
+
+    // Drops the references Resolve took. Idempotent.
+    void ReleaseAll(AssetSystem& assets);
+
+private:
+    [[nodiscard]] std::uint64_t ResolvedToken(std::uint32_t index, AssetType type) const;
+
+    std::vector<Entry> Table;
+
+    // Handle::ToToken of each entry's resolved handle, parallel to Table;
+    // 0 when unresolved. Empty until Resolve.
+    std::vector<std::uint64_t> Resolved;
+
+    // Intern's dedup, keyed by type then path.
+    std::unordered_map<std::string, std::uint32_t> IndexByKey;
+};
+
+//=============================================================================
+// SceneRefTranscode
+//
+// Stands in for the AssetSystem while a scene changes form without being
+// loaded (TranscodeSceneJsonToBinary / TranscodeSceneBinaryToJson). A handle
+// field's load interns its ref here and holds the returned token instead of a
+// live handle; its save reads the ref back through that token. Material sets
+// keep their member tokens. Tokens are only meaningful to the transcode that
+// minted them and never reach an asset cache.
+//=============================================================================
+class SceneRefTranscode
+{
+public:
+    [[nodiscard]] std::uint64_t Intern(AssetType type, std::string_view path, AssetId id);
+
+    // The ref behind a token Intern returned; null for any other token.
+    [[nodiscard]] const SceneAssetTable::Entry* Find(std::uint64_t token) const;
+
+    [[nodiscard]] std::uint64_t InternMaterialSet(std::vector<MaterialHandle> members);
+    [[nodiscard]] const std::vector<MaterialHandle>* FindMaterialSet(std::uint64_t token) const;
+
+private:
+    SceneAssetTable Refs;
+    std::vector<std::vector<MaterialHandle>> MaterialSets;
+};
@@ -3,10 +3,27 @@
 #include <core/serialization/FourCC.h>
 
 #include <cstdint>
+#include <string_view>
 
 constexpr std::uint32_t SceneMagic = MakeFourCC('S', 'C', 'N', 'E');
 constexpr std::uint32_t SceneVersion = 1;
 
+// Version of the binary component chunks. Version 2 frames every record with
+// its payload size after the owner index, so a chunk splits into per-entity
+// payloads without decoding them (BuildZonePackageFromSceneBinary does that on
+// a worker). Version 1 chunks, unframed, still load through LoadSceneBinary.
+constexpr std::uint32_t SceneComponentChunkVersion = 2;
+
+// Version of the asset table chunk. Version 2 adds each entry's AssetId, so a
+// cooked binary scene keeps the ids the cook stamped on its refs.
+constexpr std::uint32_t SceneAssetTableVersion = 2;
+
+// File suffix of a cooked scene, which the cook writes in binary form:
+// "<stem>.cooked.sscn", with its asset manifest beside it as
+// "<stem>.manifest.json" and per-zone payloads under "<stem>/". Loaders still
+// sniff the bytes (IsBinaryScene), so a JSON scene under this name loads too.
+constexpr std::string_view CookedSceneSuffix = ".cooked.sscn";
+
 //=============================================================================
 // SceneChunk
 //
@@ -21,4 +38,8 @@ namespace SceneChunk
 {
     constexpr std::uint32_t Registry = MakeFourCC('R', 'E', 'G', 'V');
     constexpr std::uint32_t Hierarchy = MakeFourCC('H', 'I', 'E', 'R');
+
+    // SceneAssetTable: the asset refs binary handle fields index into. Written
+    // ahead of the component chunks so a load resolves it before any decode.
+    constexpr std::uint32_t AssetTable = MakeFourCC('A', 'S', 'T', 'B');
 }
@@ -4,12 +4,21 @@
 
 class AssetSystem;
 class LoggingProvider;
+class SceneAssetTable;
+class SceneRefTranscode;
 
 //=============================================================================
 // SceneSerializationContext
 //
 // Explicit dependencies used by scene field codecs to convert stable persisted
 // references into runtime handles, and runtime handles back into stable refs.
+//
+// AssetTable is set by SaveSceneBinary/LoadSceneBinary for the duration of a
+// binary save or load; binary handle fields are indices into it. Text paths
+// leave it null.
+//
+// Transcode is set only while a scene changes form without being loaded; handle
+// fields then hold its tokens rather than live handles, and Assets is null.
 //=============================================================================
 struct SceneSerializationContext
 {
@@ -22,4 +31,6 @@ struct SceneSerializationContext
 
     AssetSystem* Assets = nullptr;
     LoggingProvider* Logging = nullptr;
+    SceneAssetTable* AssetTable = nullptr;
+    SceneRefTranscode* Transcode = nullptr;
 };
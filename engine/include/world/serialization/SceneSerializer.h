@@ -86,3 +86,19 @@ void RegisterEngineSceneSerializers(ComponentSerializerRegistry& serializers);
     const ComponentSerializerRegistry& serializers,
     SceneSerializationContext& context,
     SceneLoadError* error = nullptr);
+
+// A scene changing form without being loaded: handle fields carry their refs
+// (and any stamped AssetId) through a SceneRefTranscode, so no AssetSystem is
+// needed and nothing is resolved. The JSON-to-binary direction is how a cook
+// writes a binary scene from the JSON it assembled; it fails on a component
+// the serializers do not know rather than dropping it. The reverse reads a
+// binary scene back as the JSON a cook would have written, for inspection.
+[[nodiscard]] bool TranscodeSceneJsonToBinary(const JsonValue& root,
+    const ComponentSerializerRegistry& serializers,
+    BinaryWriter& writer,
+    LoggingProvider& logging,
+    SceneSaveError* error = nullptr);
+[[nodiscard]] JsonValue TranscodeSceneBinaryToJson(BinaryReader& reader,
+    const ComponentSerializerRegistry& serializers,
+    LoggingProvider& logging,
+    SceneLoadError* error = nullptr);
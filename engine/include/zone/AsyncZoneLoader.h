@@ -7,6 +7,8 @@
 #include <zone/ZoneLoadPackage.h>
 #include <zone/ZoneParticipation.h>
 
+#include <chrono>
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <span>
@@ -17,6 +19,7 @@ class ComponentSerializerRegistry;
 class RuntimeFrameLoop;
 class RuntimeWorld;
 struct RuntimeZoneRecord;
+struct ZoneDemandRecord;
 struct SceneSerializationContext;
 class WorldComponentSchema;
 
@@ -24,10 +27,18 @@ class WorldComponentSchema;
 // AsyncZoneLoader
 //
 // Loads zones without blocking the frame. BeginLoad submits an async task whose
-// work stage builds detached plain CPU package data. The commit stage imports
+// work stage builds detached plain CPU package data and bakes what it can into
+// the package's chunk image (BakeZoneChunkImage). The commit stage imports
 // that package into a hidden RuntimeWorld partition, runs the owner-thread
 // finalize callback, and publishes the zone atomically at the drain point.
 //
+// The import runs in slices of ImportSliceRows rows (ZonePackageImport). The
+// first runs in the build's own commit, so a zone that fits in one publishes
+// there; the rest continue as a sliced commit (SubmitCommitSlices), one slice
+// per turn of the drain budget, so a large zone spreads over as many frames
+// as the budget asks. The partition stays hidden until the last slice, which
+// runs finalize and publishes.
+//
 // Build callbacks must not touch live Worlds, caches, services, or backend
 // objects. Finalize runs while the imported partition is still hidden and
 // returns false to cancel the whole import before publication.
@@ -70,10 +81,47 @@ public:
         ZoneParticipation participation,
         std::shared_ptr<AssetPreload> assets);
 
+    // True from BeginLoad until the zone publishes or the load fails or is
+    // cancelled, the frames its import slices span included.
     [[nodiscard]] bool IsLoading(ZoneId zone) const;
 
-    // Best effort, like AsyncTaskQueue::Cancel: fails only while the build is
-    // actively executing on the task thread.
+    // Rows one import slice builds; at least one. Smaller slices meter more
+    // finely against the drain budget and take more frames.
+    static constexpr std::size_t DefaultImportSliceRows = 1024;
+    void SetImportSliceRows(std::size_t rows) { ImportSliceRows_ = rows; }
+    [[nodiscard]] std::size_t ImportSliceRows() const { return ImportSliceRows_; }
+
+    // Reorders an in-flight load's build among the task queue's waiting work,
+    // and its sliced import among other zones' imports. Loads start at Normal;
+    // the streaming policy lowers the speculative ones.
+    // False when the zone has no load in flight.
+    bool SetLoadPriority(ZoneId zone, AsyncTaskPriority priority);
+
+    // How long after it is demanded a zone is wanted, by the most urgent of
+    // its reasons: the focus within a few frames, a neighbour or a named zone
+    // before the focus can reach it, a zone only predicted by the end of the
+    // prediction horizon.
+    static constexpr std::chrono::milliseconds FocusLeadTime{ 100 };
+    static constexpr std::chrono::milliseconds NeighborLeadTime{ 500 };
+    static constexpr std::chrono::milliseconds PredictedLeadTime{ 2000 };
+    [[nodiscard]] static std::chrono::steady_clock::duration LoadLeadTime(
+        const ZoneDemandRecord& record);
+
+    // Sets when an in-flight load is wanted by. Shared by its build, its
+    // import slices and its asset preload's loads: among equal priorities the
+    // earlier deadline goes first, and latency samples mark the ones that ran
+    // past it. Only ever moves the deadline earlier, so demand reissued each
+    // update does not push its own deadline back. False when the zone has no
+    // load in flight.
+    bool SetLoadDeadline(ZoneId zone, std::chrono::steady_clock::time_point deadline);
+
+    // Succeeds at any point before the build's commit, a build executing on a
+    // task thread included: builds are submitted with a stop source, the bake
+    // is skipped once stop is requested, and the package is dropped on the
+    // task thread. Succeeds between import slices too: the hidden partition
+    // and the rows already built are destroyed. Fails once the commit has run
+    // and the load waits only on its assets. A cancelled load's asset preload is cancelled with it, so
+    // its held leases release now rather than at the next commit.
     bool CancelLoad(ZoneId zone);
 
     // Requests final detach at the next commit drain. Destruction itself occurs
@@ -94,20 +142,30 @@ public:
     void ClearFailures() { Failures_.clear(); }
 
 private:
+    // A load whose package has begun importing. Shared between the in-flight
+    // record and the sliced commit that steps it.
+    struct ZoneImport;
+
     struct InFlightLoad
     {
         ZoneId Zone;
+        // The build task, then the import's sliced commit once it has one.
         AsyncTaskHandle Handle;
         std::shared_ptr<AssetPreload> Assets;
+        AsyncTaskPriorityCell Priority;
+        AsyncTaskDeadlineCell Deadline;
+        std::shared_ptr<ZoneImport> Import;
     };
 
     void RemoveInFlight(ZoneId zone);
-    void ImportAndFinalize(
+    void StartImport(
         ZoneId zone,
         std::unique_ptr<ZoneLoadPackage> package,
-        FinalizeFn& finalize,
+        FinalizeFn finalize,
         ZoneParticipation participation,
-        const std::shared_ptr<AssetPreload>& assets);
+        std::shared_ptr<AssetPreload> assets);
+    // One slice; true once the import has published or failed.
+    bool StepImport(ZoneImport& import);
     // Coalesces to one record per zone and logs once per recorded failure, not
     // once per attempt.
     void RecordFailure(ZoneId zone, ZoneLoadStage stage, std::string message);
@@ -121,4 +179,5 @@ private:
     Logger Log;
     std::vector<InFlightLoad> InFlight;
     std::vector<ZoneLoadFailure> Failures_;
+    std::size_t ImportSliceRows_ = DefaultImportSliceRows;
 };
@@ -4,15 +4,30 @@
 #include <span>
 #include <vector>
 
+#include <math/geometry/3d/Aabb3d.h>
 #include <zone/WorldPartitionManifest.h>
 
+// Squared distance from a point to the closest point of a box; 0 inside it.
+// Shared by the spatial queries below and the brute-force paths in ZoneDemand
+// so both measure proximity the same way.
+[[nodiscard]] double ZoneBoundsDistanceSq(const Aabb3d& bounds, Vec3d point);
+
 // Derived adjacency over a parsed manifest. Cooked dock and link endpoints are
 // indexed by owning zone. Legacy transition indices remain only for editor
 // migration diagnostics and are refused by the cooked runtime. Deterministic:
 // zones and edge lists are ordered by ascending id value.
+//
+// The index also carries each zone's header position and graph, so policy code
+// resolves a zone id by binary search instead of walking manifest.Zones, and a
+// median-split BVH over zone Bounds for the proximity and containment queries
+// demand and focus resolution make every frame. It is derived at Build, like
+// the adjacency, rather than cooked into the manifest: a cooked copy would be
+// one more thing validation had to prove still matched the bounds it indexed.
 class WorldPartitionIndex
 {
 public:
+    static constexpr uint32_t kNoZone = UINT32_MAX;
+
     static WorldPartitionIndex Build(const WorldPartitionManifest& manifest);
 
     // Indices into manifest.Transitions, sorted by TransitionId value.
@@ -24,12 +39,33 @@ public:
 
     [[nodiscard]] bool ContainsZone(ZoneId zone) const;
 
+    // Position of the zone's header in manifest.Zones (the first, should the
+    // manifest repeat an id), or kNoZone. Graph is that header's; invalid for
+    // an unknown zone.
+    [[nodiscard]] uint32_t HeaderIndexOf(ZoneId zone) const;
+    [[nodiscard]] GraphId GraphOf(ZoneId zone) const;
+
+    // Spatial queries over every header with valid Bounds. Each appends header
+    // positions in manifest.Zones to `out` in no particular order.
+    //
+    // ZonesWithin: bounds whose closest point lies within radius of point.
+    // ZonesContaining: bounds that contain point.
+    void ZonesWithin(Vec3d point, double radius, std::vector<uint32_t>& out) const;
+    void ZonesContaining(Vec3d point, std::vector<uint32_t>& out) const;
+
+    // The header whose bounds lie nearest point: closest-point distance, then
+    // smaller volume, then smaller id, as ResolveZoneAt ranks them. kNoZone
+    // when no header has valid bounds.
+    [[nodiscard]] uint32_t NearestZone(Vec3d point) const;
+
 private:
     // Sorted zone id array plus offset tables into one shared index buffer;
     // O(zones + endpoints + legacy transitions) memory. Indices_ holds every
     // zone's outgoing run followed by every zone's incoming run; the offset
     // tables hold absolute positions with one trailing end entry each.
     std::vector<uint64_t> ZoneIds_;
+    std::vector<uint32_t> HeaderIndices_;
+    std::vector<GraphId> Graphs_;
     std::vector<uint32_t> OutgoingOffsets_;
     std::vector<uint32_t> IncomingOffsets_;
     std::vector<uint32_t> Indices_;
@@ -38,5 +74,28 @@ private:
     std::vector<DockEndpoint> Docks_;
     std::vector<LinkEndpoint> Links_;
 
+    // One indexed header, kept beside the tree so a query never reads the
+    // manifest.
+    struct SpatialZone
+    {
+        Aabb3d Bounds;
+        double Volume = 0.0;
+        uint64_t Id = 0;
+        uint32_t Header = 0;
+    };
+
+    struct SpatialNode
+    {
+        Aabb3d Bounds = Aabb3d::Empty();
+        uint32_t Start = 0;  // first entry in SpatialZones_ (leaf only)
+        uint32_t Count = 0;  // zone count (0 => internal node)
+        uint32_t Left = 0;
+        uint32_t Right = 0;
+    };
+
+    std::vector<SpatialZone> SpatialZones_;
+    std::vector<SpatialNode> SpatialNodes_;
+
     [[nodiscard]] size_t FindSlot(ZoneId zone) const;
+    uint32_t BuildSpatialRange(uint32_t start, uint32_t count);
 };
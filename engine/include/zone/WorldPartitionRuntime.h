@@ -82,6 +82,21 @@ public:
         return LastTraversal_;
     }
     [[nodiscard]] uint64_t LateTraversalCount() const { return LateTraversalCount_; }
+    // Zones that became resident while already demanded visible: each one
+    // appeared in view late rather than being there when it was wanted. The
+    // prefetch's figure of merit, beside LateTraversalCount's hitches.
+    [[nodiscard]] uint64_t VisiblePopCount() const { return VisiblePopCount_; }
+
+    // Smoothed focus velocity from the positions Update has seen, in units per
+    // second; zero after a relocation. Prediction extrapolates along it.
+    [[nodiscard]] Vec3d FocusVelocity() const { return FocusVelocity_; }
+    // Every focus change Update has observed since the manifest loaded, as
+    // counts per (from, to) pair in first-seen order. Relocations are not
+    // traversals and are not recorded.
+    [[nodiscard]] std::span<const ZoneTraversalCount> TraversalHistory() const
+    {
+        return TraversalHistory_;
+    }
 
     // Authored/scripted long-lived floor. Existing semantics remain last-writer-
     // wins because this API names one pin per zone.
@@ -149,6 +164,10 @@ private:
     };
 
     [[nodiscard]] const ZoneHeader* FindHeader(ZoneId zone) const;
+    // Counts a focus change into the traversal history and folds this update's
+    // focus position into the velocity estimate.
+    void RecordFocusMotion(double deltaSeconds);
+    void CountVisiblePops(std::span<const ZoneDemandRecord> demand, const RuntimeWorld& world);
     // Adopts refusals the loader recorded, and lifts suppression for zones whose
     // content changed or which left the manifest.
     void ReconcileFailedLoads(AsyncZoneLoader& loader);
@@ -169,8 +188,22 @@ private:
     DockId SuppressedDock_;
     DockTraversalResult LastTraversal_;
     uint64_t LateTraversalCount_ = 0;
+    uint64_t VisiblePopCount_ = 0;
+    // Zones demanded visible but not yet resident at the last Update.
+    std::vector<ZoneId> AwaitingVisible_;
+    Vec3d FocusVelocity_{};
+    Vec3d MotionSample_{};
+    bool HasMotionSample_ = false;
+    // The focus the last Update saw, so the next one can tell it changed.
+    ZoneId HistoryFocus_;
+    std::vector<ZoneTraversalCount> TraversalHistory_;
     LingerState TraversalGrace_;
     std::vector<ZonePin> Pins_;
+    // Hop ranks of the last focus, reused until the focus zone or its graph's
+    // HopCount changes.
+    std::vector<ZoneHopRank> FocusRanks_;
+    ZoneId FocusRanksZone_;
+    int32_t FocusRanksHopCount_ = -1;
     std::vector<ParticipationLeaseSlot> LeaseSlots_;
     std::vector<uint32_t> FreeLeaseSlots_;
     std::size_t ActiveLeaseCount_ = 0;
@@ -178,6 +211,14 @@ private:
     // until it runs, so Update must not re-request them.
     std::vector<ZoneId> PendingDestroys_;
     std::vector<ZoneId> Issued_;
+    // Asset preloads of issued zones, reprioritized every Update as the focus
+    // moves. Weak: the loader owns them until publication.
+    struct IssuedPreload
+    {
+        ZoneId Zone;
+        std::weak_ptr<AssetPreload> Preload;
+    };
+    std::vector<IssuedPreload> IssuedPreloads_;
     std::vector<LingerState> Lingering_;
     std::vector<ZoneDemandRecord> Records_;
     std::vector<FailedLoad> FailedLoads_;
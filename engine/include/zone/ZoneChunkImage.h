@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstddef>
+
+class WorldComponentSchema;
+class ZoneLoadPackage;
+
+//=============================================================================
+// BakeZoneChunkImage
+//
+// Moves the package's bakeable entities into its ZoneChunkImage: one column
+// block per distinct component set, rows in package order. Runs on a worker
+// (AsyncZoneLoader calls it right after the build callback), so the owner
+// thread's import of those entities is a memcpy per column per chunk instead
+// of a row build and a decode per component.
+//
+// An entity bakes when every component is runtime bytes of the size the schema
+// registers and its persistent_id metadata agrees with its component. The rest
+// stay per-entity and import exactly as before: serialized JSON in particular,
+// whose decoders resolve assets and so must run on the owner thread.
+//
+// The derived WorldTransform is baked from LocalTransform, and a Parent{} column
+// reserved for parented entities, so the image carries the entity's final
+// signature just as the per-entity path builds it. A schema without the
+// transform pair or Parent bakes neither, matching a world that has neither.
+//
+// Returns the number of entities baked. Safe to call again; already baked
+// entities are skipped.
+//=============================================================================
+std::size_t BakeZoneChunkImage(ZoneLoadPackage& package, const WorldComponentSchema& schema);
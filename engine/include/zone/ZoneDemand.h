@@ -20,6 +20,7 @@ enum class ZoneDemandReason : uint8_t
     Gameplay,
     TraversalGrace,
     Linger,
+    Predicted,
 };
 
 struct ZoneDemandReasonRecord
@@ -79,6 +80,10 @@ struct WorldPartitionStreamingConfig
     // Proximity demand: zones whose bounds lie within this distance of the
     // focus position join the demand set. 0 = graph hops only.
     double  Radius = 0.0;
+    // Prefetch horizon: zones the focus is predicted to reach within this many
+    // seconds, by its velocity and traversal history, load dormant ahead of
+    // demand. 0 = no prediction.
+    double  PredictSeconds = 0.0;
 
     friend bool operator==(const WorldPartitionStreamingConfig&,
                            const WorldPartitionStreamingConfig&) = default;
@@ -137,6 +142,17 @@ struct ZoneContainmentResult
 [[nodiscard]] ZoneId ResolveFocusZone(const WorldPartitionManifest& manifest,
                                       Vec3d position, ZoneId previous);
 
+// The same resolution through the index's bounds BVH, for callers that resolve
+// every frame: identical results, without visiting every zone in the manifest.
+// The index must have been built from this manifest.
+[[nodiscard]] ZoneContainmentResult ResolveZoneAt(
+    const WorldPartitionManifest& manifest, const WorldPartitionIndex& index,
+    Vec3d position, ZoneId preferred);
+
+[[nodiscard]] ZoneId ResolveFocusZone(const WorldPartitionManifest& manifest,
+                                      const WorldPartitionIndex& index,
+                                      Vec3d position, ZoneId previous);
+
 // Pure. The demand set for one focus: the focus zone at full participation,
 // its graph neighbors within HopCount hops at the config's preload
 // participation, zones within Radius of the focus position likewise (when a
@@ -150,3 +166,53 @@ ComputeZoneDemand(const WorldPartitionManifest& manifest,
                   std::span<const ZonePin> pins,
                   const WorldPartitionStreamingConfig& config,
                   const Vec3d* focusPosition = nullptr);
+
+// ComputeZoneDemand with the focus's hop ranks supplied: ranks depend only on
+// the focus zone and its graph's HopCount, so a caller whose focus stays in one
+// zone computes them once and re-runs only the spatial part as the position
+// moves. `ranks` must be ComputeZoneHopRanks for this focus and its graph's
+// resolved HopCount; the result is then identical to ComputeZoneDemand.
+[[nodiscard]] std::vector<ZoneDemandRecord>
+ComputeZoneDemandFromRanks(const WorldPartitionManifest& manifest,
+                           const WorldPartitionIndex& index,
+                           ZoneId focus,
+                           std::span<const ZoneHopRank> ranks,
+                           std::span<const ZonePin> pins,
+                           const WorldPartitionStreamingConfig& config,
+                           const Vec3d* focusPosition = nullptr);
+
+// How often the focus has left one zone for another. Runtime state, recorded by
+// WorldPartitionRuntime on every focus change; prediction reads it as the
+// destinations a zone is usually left for.
+struct ZoneTraversalCount
+{
+    ZoneId   From;
+    ZoneId   To;
+    uint32_t Count = 0;
+
+    friend bool operator==(const ZoneTraversalCount&, const ZoneTraversalCount&) = default;
+};
+
+// Pure. Speculative demand ahead of a moving focus, within config.PredictSeconds.
+//
+// The focus position is extrapolated along velocity and swept through the focus
+// zone's outgoing docks: the first dock plane the ray reaches in time, within
+// the dock's extents plus a slack that grows with distance travelled, names the
+// next zone, and the sweep continues through that zone's docks for one more
+// step. Each outgoing dock and link of the focus zone also scores by its share
+// of the zone's recorded departures (`history`, any order), so a route taken
+// every time is predicted before the focus turns toward it, and a link, which
+// has no plane to sweep, is predicted from history alone.
+//
+// Records carry Predicted reasons (Source is the zone the endpoint leaves, Rank
+// the step along the path, Cost the seconds until the plane is reached; no cost
+// for history alone) and an empty Desired: a prediction is a dormant load, never
+// participation. The focus zone is never predicted. At most three zones, sorted
+// by id; empty when PredictSeconds is 0 or the focus is unknown.
+[[nodiscard]] std::vector<ZoneDemandRecord>
+PredictZoneDemand(const WorldPartitionIndex& index,
+                  ZoneId focus,
+                  Vec3d position,
+                  Vec3d velocity,
+                  std::span<const ZoneTraversalCount> history,
+                  const WorldPartitionStreamingConfig& config);
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <ecs/ComponentId.h>
+#include <ecs/ComponentTypeId.h>
+#include <zone/ZoneStateStore.h>
+
+#include <vector>
+
+struct DetachedPartition;
+class World;
+
+// The detaching World's ComponentIds for everything CaptureZoneDetach reads,
+// resolved on the owner thread so the capture never touches the World.
+struct ZoneDetachColumns
+{
+    struct Tracked
+    {
+        ComponentTypeId Type;
+        ComponentId Id = InvalidComponentId;
+    };
+
+    ComponentId PersistentId = InvalidComponentId;
+    std::vector<Tracked> Components;
+};
+
+// PersistentId stays InvalidComponentId in a world that never registered the
+// identity component (minimal fixtures); such a world imports no authored ids,
+// so it never has a baseline to diff.
+[[nodiscard]] ZoneDetachColumns ResolveZoneDetachColumns(
+    const World& world,
+    const ZoneStateStore& store);
+
+//=============================================================================
+// CaptureZoneDetach
+//
+// Diffs a zone's baseline against the rows World::DetachPartition moved out of
+// it: authored ids with no live row become Destroyed, and each tracked
+// component of a live authored row whose bytes differ from the authored ones
+// becomes a Modified record. A row with a value already on record gets an
+// empty record when it matches again, so the commit can drop it.
+//
+// Reads only its arguments, which the caller owns outright once the partition
+// is detached, so it runs on any thread without a lock. The result goes to
+// ZoneStateStore::CommitDetachCapture on the owner thread.
+//=============================================================================
+[[nodiscard]] ZoneDetachCapture CaptureZoneDetach(
+    const ZoneStateBaseline& baseline,
+    const DetachedPartition& detached,
+    const ZoneDetachColumns& columns);
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <core/assets/AssetId.h>
+#include <core/assets/AssetRef.h>
 #include <core/identity/Id.h>
 #include <core/json/JsonValue.h>
 #include <ecs/ComponentTypeId.h>
@@ -12,6 +14,7 @@
 #include <limits>
 #include <optional>
 #include <span>
+#include <string>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -36,13 +39,17 @@ struct ZonePackageComponent
     // Exactly one payload form is populated. RuntimeBytes are useful for
     // generated/package-native content. SerializedJson is parsed on a worker but
     // decoded on the owner thread, where asset resolution and other explicit
-    // SceneSerializationContext dependencies are legal.
+    // SceneSerializationContext dependencies are legal. SerializedBinary is one
+    // record of a binary scene's component chunk, split out on a worker and
+    // decoded on the owner thread the same way; its handle fields index the
+    // package's AssetRefs.
     std::vector<std::byte> RuntimeBytes;
     std::optional<JsonValue> SerializedJson;
+    std::optional<std::vector<std::byte>> SerializedBinary;
 
     [[nodiscard]] bool HasRuntimeBytes() const
     {
-        return !SerializedJson.has_value();
+        return !SerializedJson.has_value() && !SerializedBinary.has_value();
     }
 };
 
@@ -56,6 +63,21 @@ struct ZonePackageEntity
     // The persistent_id component still travels in Components; this field is
     // import metadata, not a second source of truth.
     PersistentEntityId PersistentId;
+
+    // Set when the entity's payload moved into the package's chunk image
+    // (BakeZoneChunkImage). Its Components are then empty; the image row is
+    // the only copy.
+    bool InChunkImage = false;
+};
+
+// One entry of a binary package's asset table: what a SerializedBinary handle
+// field's index names. Plain paths, plus the id a cook stamped when there is
+// one; the owner-thread import resolves them.
+struct ZonePackageAssetRef
+{
+    AssetType Type = AssetType::Unknown;
+    std::string Path;
+    AssetId Id{};
 };
 
 struct ZonePackageParent
@@ -64,6 +86,46 @@ struct ZonePackageParent
     ZoneLocalEntityId Parent;
 };
 
+// One column of a chunk-image block: every row's value back to back, exactly
+// as a chunk column stores them, so a run of rows imports with one memcpy.
+struct ZoneChunkImageColumn
+{
+    ComponentTypeId Type;
+    std::size_t Stride = 0;
+    std::vector<std::byte> Bytes;
+};
+
+// Every baked entity that shares one component set, i.e. one archetype. The
+// set is world-independent (types, not ComponentIds); only the column order
+// inside a chunk depends on the destination World, and columns are copied
+// one at a time, so that order never matters here.
+struct ZoneChunkImageBlock
+{
+    std::vector<ZoneChunkImageColumn> Columns;
+    std::vector<ComponentTypeId> Tags;
+    // Which package entity each row is, in row order.
+    std::vector<ZoneLocalEntityId> Rows;
+};
+
+// The memcpy form of a package: per-archetype column blocks built on a worker,
+// imported on the owner thread a chunk at a time. Parent columns are baked as
+// Parent{} and fixed up from ZoneLoadPackage::Parents() once every row has a
+// live id; OnAdd hooks (asset retains, identity registration) still fire per
+// row at import.
+struct ZoneChunkImage
+{
+    std::vector<ZoneChunkImageBlock> Blocks;
+
+    [[nodiscard]] bool Empty() const { return Blocks.empty(); }
+    [[nodiscard]] std::size_t RowCount() const
+    {
+        std::size_t rows = 0;
+        for (const ZoneChunkImageBlock& block : Blocks)
+            rows += block.Rows.size();
+        return rows;
+    }
+};
+
 // Detached, plain CPU representation of one streamed zone. It owns no live
 // World, Registry, backend handle, service pointer, or module callback. Workers
 // may build and discard it freely; publication happens later on the owner thread.
@@ -138,6 +200,67 @@ public:
         return true;
     }
 
+    bool AddSerializedBinary(
+        ZoneLocalEntityId entity,
+        ComponentTypeId type,
+        std::span<const std::byte> bytes)
+    {
+        ZonePackageEntity* target = FindInsertTarget(entity, type);
+        if (target == nullptr)
+            return false;
+
+        ZonePackageComponent component;
+        component.Type = type;
+        component.SerializedBinary.emplace(bytes.begin(), bytes.end());
+        target->Components.push_back(std::move(component));
+        return true;
+    }
+
+    // The binary scene's asset table, in table order. Replaces any earlier one.
+    void SetAssetRefs(std::vector<ZonePackageAssetRef> refs)
+    {
+        AssetRefs_ = std::move(refs);
+    }
+
+    [[nodiscard]] std::span<const ZonePackageAssetRef> AssetRefs() const
+    {
+        return { AssetRefs_.data(), AssetRefs_.size() };
+    }
+
+    // Takes the image's rows over from the per-entity form: each listed entity
+    // is marked InChunkImage and its Components are released. False, leaving
+    // the package untouched, when a row names an unknown or already baked
+    // entity or appears twice.
+    bool AdoptChunkImage(ZoneChunkImage image)
+    {
+        std::vector<bool> listed(Entities_.size(), false);
+        for (const ZoneChunkImageBlock& block : image.Blocks)
+        {
+            for (const ZoneLocalEntityId row : block.Rows)
+            {
+                if (!ContainsEntity(row) || Entities_[row.Value].InChunkImage
+                    || listed[row.Value])
+                    return false;
+                listed[row.Value] = true;
+            }
+        }
+
+        for (const ZoneChunkImageBlock& block : image.Blocks)
+        {
+            for (const ZoneLocalEntityId row : block.Rows)
+            {
+                ZonePackageEntity& entity = Entities_[row.Value];
+                entity.InChunkImage = true;
+                entity.Components = {};
+            }
+        }
+        for (ZoneChunkImageBlock& block : image.Blocks)
+            ChunkImage_.Blocks.push_back(std::move(block));
+        return true;
+    }
+
+    [[nodiscard]] const ZoneChunkImage& ChunkImage() const { return ChunkImage_; }
+
     bool SetPersistentId(ZoneLocalEntityId entity, PersistentEntityId id)
     {
         if (!ContainsEntity(entity))
@@ -191,6 +314,8 @@ private:
             return nullptr;
 
         ZonePackageEntity& target = Entities_[entity.Value];
+        if (target.InChunkImage)
+            return nullptr;
         const bool duplicate = std::any_of(
             target.Components.begin(),
             target.Components.end(),
@@ -203,4 +328,6 @@ private:
     ZoneId Zone_;
     std::vector<ZonePackageEntity> Entities_;
     std::vector<ZonePackageParent> Parents_;
+    std::vector<ZonePackageAssetRef> AssetRefs_;
+    ZoneChunkImage ChunkImage_;
 };
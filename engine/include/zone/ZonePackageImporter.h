@@ -3,6 +3,9 @@
 #include <ecs/StoragePartitionId.h>
 #include <zone/ZoneParticipation.h>
 
+#include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <string>
 
 class ComponentSerializerRegistry;
@@ -20,6 +23,8 @@ struct ZoneImportError
 // Imports detached package entities into an existing storage partition. On
 // failure, only entities created by this call are destroyed. This is the common
 // semantic kernel for persistent world-scene import and hidden zone import.
+// The package's chunk image, when it has one, imports first and a chunk at a
+// time; the remaining entities import one row each.
 [[nodiscard]] bool ImportPackageIntoPartition(
     World& world,
     const WorldComponentSchema& schema,
@@ -53,6 +58,69 @@ struct ZoneImportError
     SceneSerializationContext& sceneContext,
     ZoneImportError* error = nullptr);
 
+// A hidden zone import run in slices, for an owner thread that cannot afford a
+// whole package inside one frame. The first Step allocates the hidden
+// partition (with ImportZonePackageHidden's checks); each Step then builds at
+// most maxRows rows, in the one-shot import's order, and reports Imported
+// once the partition holds the whole package. Publishing, or cancelling, is
+// then the caller's. A failed Step cancels the import itself.
+//
+// Between steps the rows built so far are live in the World but, like any
+// importing zone, outside every frame domain and residency batch. The package
+// must outlive the import. An import abandoned midway needs Cancel; simply
+// destroying it leaves the hidden partition behind.
+class ZonePackageImport
+{
+public:
+    enum class Status : std::uint8_t
+    {
+        Importing,
+        Imported,
+        Failed,
+    };
+
+    static constexpr std::size_t NoLimit = static_cast<std::size_t>(-1);
+
+    ZonePackageImport(
+        RuntimeWorld& runtime,
+        const WorldComponentSchema& schema,
+        const ZoneLoadPackage& package);
+
+    ZonePackageImport(
+        RuntimeWorld& runtime,
+        const WorldComponentSchema& schema,
+        const ZoneLoadPackage& package,
+        const ComponentSerializerRegistry& serializers,
+        SceneSerializationContext& sceneContext);
+
+    ~ZonePackageImport();
+
+    ZonePackageImport(const ZonePackageImport&) = delete;
+    ZonePackageImport& operator=(const ZonePackageImport&) = delete;
+
+    // At least one row per call. Once Imported or Failed, further calls
+    // return the same status and do nothing.
+    [[nodiscard]] Status Step(std::size_t maxRows, ZoneImportError* error = nullptr);
+
+    // Destroys the hidden partition and every row in it, leaving the import
+    // Failed. No effect once the import is no longer Importing.
+    void Cancel();
+
+    [[nodiscard]] Status GetStatus() const { return Status_; }
+    [[nodiscard]] std::size_t ImportedRows() const;
+
+private:
+    struct State;
+
+    RuntimeWorld& Runtime_;
+    const WorldComponentSchema& Schema_;
+    const ZoneLoadPackage& Package_;
+    const ComponentSerializerRegistry* Serializers_ = nullptr;
+    SceneSerializationContext* SceneContext_ = nullptr;
+    std::unique_ptr<State> S_;
+    Status Status_ = Status::Importing;
+};
+
 [[nodiscard]] bool ImportZonePackage(
     RuntimeWorld& runtime,
     const WorldComponentSchema& schema,
@@ -3,6 +3,9 @@
 #include <core/json/JsonValue.h>
 #include <world/serialization/SceneSerializer.h>
 
+#include <cstddef>
+#include <span>
+
 class ComponentSerializerRegistry;
 class ZoneLoadPackage;
 
@@ -14,3 +17,18 @@ class ZoneLoadPackage;
     const ComponentSerializerRegistry& serializers,
     ZoneLoadPackage& package,
     SceneLoadError* error = nullptr);
+
+// The same conversion from a binary scene (SaveSceneBinary output). Component
+// chunks split into per-entity SerializedBinary payloads by their record
+// frames, without decoding them, so they must be SceneComponentChunkVersion 2
+// or later; the scene's asset table travels as the package's AssetRefs. Same
+// worker contract as the JSON form.
+[[nodiscard]] bool BuildZonePackageFromSceneBinary(
+    std::span<const std::byte> bytes,
+    const ComponentSerializerRegistry& serializers,
+    ZoneLoadPackage& package,
+    SceneLoadError* error = nullptr);
+
+// True when `bytes` start with the binary scene magic. A cooked scene file is
+// either that or JSON text, so a loader dispatches on this.
+[[nodiscard]] bool IsBinaryScene(std::span<const std::byte> bytes);
@@ -1,12 +1,53 @@
 #pragma once
 
 #include <core/identity/Id.h>
+#include <ecs/ComponentTypeId.h>
 #include <zone/ZoneId.h>
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <span>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
+#include <vector>
+
+// One component's bytes on one persistent entity. In a capture, empty Bytes
+// means the value is back to what the cooked scene authored.
+struct ZoneComponentRecord
+{
+    ComponentTypeId Type;
+    std::vector<std::byte> Bytes;
+};
+
+using ZoneComponentRecords =
+    std::unordered_map<std::uint64_t, std::vector<ZoneComponentRecord>>;
+
+// What one residency's import said the cooked scene holds: the persistent ids
+// it authored and, for each tracked component, the bytes it authored. Handed
+// out whole by BeginDetachCapture so the diff can run on another thread.
+struct ZoneStateBaseline
+{
+    std::unordered_set<std::uint64_t> Authored;
+    ZoneComponentRecords AuthoredComponents;
+    // Ids that already hold a recorded value. Only these need an empty record
+    // when their value turns out authored again.
+    std::unordered_set<std::uint64_t> Recorded;
+};
+
+// A detach's deviation, computed from a baseline and the zone's detached rows
+// (CaptureZoneDetach) and applied by CommitDetachCapture.
+struct ZoneDetachCapture
+{
+    // False when the zone had no baseline; committing it changes nothing.
+    bool HasBaseline = false;
+    std::unordered_set<std::uint64_t> Destroyed;
+    // Tracked components of live authored rows: the bytes where they differ
+    // from the authored value, an empty record where a previously recorded
+    // value is authored again.
+    ZoneComponentRecords Modified;
+};
 
 //=============================================================================
 // ZoneStateStore
@@ -23,9 +64,21 @@
 // restates it from the cooked artifact. Retained memory therefore tracks how
 // much state has actually changed, not how much of the world has been visited.
 //
+// Tracked components extend the deviation from "which entities are gone" to
+// "what the survivors hold". The import records each tracked component's
+// authored bytes beside the id set and overlays recorded values on the rows it
+// builds; the detach diff keeps a record only where a live value differs from
+// the authored one. Tracked components must be hook-free, because the overlay
+// writes them in place (WorldComponentSchema::SetComponentBytes).
+//
+// The detach diff runs off the owner thread: BeginDetachCapture hands out the
+// baseline, CaptureZoneDetach (zone/ZoneDetachCapture.h) diffs it against the
+// zone's detached chunk slabs anywhere, and only CommitDetachCapture touches
+// the store again. Until the commit the zone reads as having no deviation, so
+// a re-import must commit any pending capture first (RuntimeWorld does).
+//
 // This is the runtime half of the zone state overlay. Serializing records for
-// save files and capturing changed component fields extend this store; they do
-// not replace it.
+// save files extends this store; it does not replace it.
 //=============================================================================
 class ZoneStateStore
 {
@@ -35,46 +88,126 @@ public:
     // artifact, so re-recording on each import is idempotent while staying
     // correct across a recook that added or removed entities.
     void RecordAuthoredSet(ZoneId zone, std::span<const PersistentEntityId> authored)
+    {
+        BeginAuthoredSet(zone, authored.size());
+        AddAuthored(zone, authored);
+    }
+
+    // RecordAuthoredSet in pieces, for an import that runs in slices: Begin
+    // drops the previous residency's set and sizes for `expected` ids, and
+    // each Add inserts a run of them.
+    void BeginAuthoredSet(ZoneId zone, std::size_t expected)
     {
         ZoneStateRecord& record = Zones_[zone];
         record.Authored.clear();
-        record.Authored.reserve(authored.size());
+        record.AuthoredComponents.clear();
+        record.Authored.reserve(expected);
+    }
+
+    void AddAuthored(ZoneId zone, std::span<const PersistentEntityId> authored)
+    {
+        ZoneStateRecord& record = Zones_[zone];
         for (const PersistentEntityId id : authored)
             if (id.IsValid())
                 record.Authored.insert(id.Value);
     }
 
-    // Called at detach while the zone's entities are still alive. Destroyed is
-    // recomputed as authored-minus-live: entities suppressed on import are not
-    // live either, so accumulated destruction survives any number of
-    // unload/reload cycles without a union step.
+    // Called after RecordAuthoredSet, once per tracked component of each
+    // authored entity the import built: the value the cooked scene holds.
+    void RecordAuthoredComponent(
+        ZoneId zone,
+        PersistentEntityId id,
+        ComponentTypeId type,
+        std::span<const std::byte> bytes)
+    {
+        if (!id.IsValid())
+            return;
+        Zones_[zone].AuthoredComponents[id.Value].push_back(
+            ZoneComponentRecord{ type, { bytes.begin(), bytes.end() } });
+    }
+
+    // The owner-thread synchronous capture, for callers that hold the live id
+    // set rather than detached rows. Destroyed is recomputed as
+    // authored-minus-live: entities suppressed on import are not live either,
+    // so accumulated destruction survives any number of unload/reload cycles
+    // without a union step. Component values are not captured.
     void RecordDetachCapture(ZoneId zone, std::span<const PersistentEntityId> live)
+    {
+        const ZoneStateBaseline baseline = BeginDetachCapture(zone);
+
+        std::unordered_set<std::uint64_t> liveSet;
+        liveSet.reserve(live.size());
+        for (const PersistentEntityId id : live)
+            liveSet.insert(id.Value);
+
+        ZoneDetachCapture capture;
+        capture.HasBaseline = !baseline.Authored.empty();
+        for (const std::uint64_t authored : baseline.Authored)
+            if (!liveSet.contains(authored))
+                capture.Destroyed.insert(authored);
+        CommitDetachCapture(zone, std::move(capture));
+    }
+
+    // Moves the zone's baseline out for an off-thread diff.
+    //
+    // The baseline is a property of the cooked artifact, restated by every
+    // import, so holding it between residencies would make this store grow
+    // with zones visited rather than with state that actually deviates.
+    [[nodiscard]] ZoneStateBaseline BeginDetachCapture(ZoneId zone)
     {
         const auto it = Zones_.find(zone);
         if (it == Zones_.end())
-            return;
+            return {};
+
+        ZoneStateBaseline baseline;
+        baseline.Authored = std::exchange(it->second.Authored, {});
+        baseline.AuthoredComponents = std::exchange(it->second.AuthoredComponents, {});
+        baseline.Recorded.reserve(it->second.Modified.size());
+        for (const auto& [id, records] : it->second.Modified)
+            baseline.Recorded.insert(id);
+        return baseline;
+    }
 
-        ZoneStateRecord& record = it->second;
+    void CommitDetachCapture(ZoneId zone, ZoneDetachCapture capture)
+    {
         // Without a baseline there is nothing to diff against, and recomputing
         // from an empty one would read as "everything survived" and erase the
         // deviation already recorded. Only an import can supply a baseline.
-        if (record.Authored.empty())
+        if (!capture.HasBaseline)
             return;
 
-        std::unordered_set<std::uint64_t> liveSet;
-        liveSet.reserve(live.size());
-        for (const PersistentEntityId id : live)
-            liveSet.insert(id.Value);
+        ZoneStateRecord& record = Zones_[zone];
+        record.Destroyed = std::move(capture.Destroyed);
 
-        record.Destroyed.clear();
-        for (const std::uint64_t authored : record.Authored)
-            if (!liveSet.contains(authored))
-                record.Destroyed.insert(authored);
+        for (auto& [id, changes] : capture.Modified)
+        {
+            std::vector<ZoneComponentRecord>& kept = record.Modified[id];
+            for (ZoneComponentRecord& change : changes)
+            {
+                const auto existing = std::find_if(
+                    kept.begin(), kept.end(),
+                    [&](const ZoneComponentRecord& r) { return r.Type == change.Type; });
+                if (change.Bytes.empty())
+                {
+                    if (existing != kept.end())
+                        kept.erase(existing);
+                }
+                else if (existing != kept.end())
+                {
+                    existing->Bytes = std::move(change.Bytes);
+                }
+                else
+                {
+                    kept.push_back(std::move(change));
+                }
+            }
+            if (kept.empty())
+                record.Modified.erase(id);
+        }
 
-        // The baseline is a property of the cooked artifact, restated by every
-        // import, so holding it between residencies would make this store grow
-        // with zones visited rather than with state that actually deviates.
-        record.Authored.clear();
+        // Destruction outranks any value the entity held before it.
+        for (const std::uint64_t destroyed : record.Destroyed)
+            record.Modified.erase(destroyed);
     }
 
     [[nodiscard]] bool IsRecordedDestroyed(ZoneId zone, PersistentEntityId id) const
@@ -89,16 +222,60 @@ public:
         return it != Zones_.end() ? it->second.Destroyed.size() : 0;
     }
 
+    // Recorded values of one entity's tracked components; empty when it holds
+    // what the cooked scene authored.
+    [[nodiscard]] std::span<const ZoneComponentRecord> RecordedComponents(
+        ZoneId zone,
+        PersistentEntityId id) const
+    {
+        const auto it = Zones_.find(zone);
+        if (it == Zones_.end())
+            return {};
+        const auto found = it->second.Modified.find(id.Value);
+        return found != it->second.Modified.end()
+            ? std::span<const ZoneComponentRecord>(found->second)
+            : std::span<const ZoneComponentRecord>();
+    }
+
+    [[nodiscard]] std::size_t RecordedModifiedCount(ZoneId zone) const
+    {
+        const auto it = Zones_.find(zone);
+        return it != Zones_.end() ? it->second.Modified.size() : 0;
+    }
+
+    // Opts a component into value capture. Registration happens before any
+    // zone imports; a component tracked mid-session is captured from its
+    // next import on.
+    void TrackComponent(ComponentTypeId type)
+    {
+        if (std::find(Tracked_.begin(), Tracked_.end(), type) == Tracked_.end())
+            Tracked_.push_back(type);
+    }
+
+    template <typename T>
+    void TrackComponent()
+    {
+        TrackComponent(ResolveComponentTypeId<T>());
+    }
+
+    [[nodiscard]] std::span<const ComponentTypeId> TrackedComponents() const
+    {
+        return Tracked_;
+    }
+
     // Reset-to-authored: the next import of every zone replays the cooked
-    // scene unmodified.
+    // scene unmodified. Tracking is configuration and survives.
     void Clear() { Zones_.clear(); }
 
 private:
     struct ZoneStateRecord
     {
         std::unordered_set<std::uint64_t> Authored;
+        ZoneComponentRecords AuthoredComponents;
         std::unordered_set<std::uint64_t> Destroyed;
+        ZoneComponentRecords Modified;
     };
 
     std::unordered_map<ZoneId, ZoneStateRecord> Zones_;
+    std::vector<ComponentTypeId> Tracked_;
 };
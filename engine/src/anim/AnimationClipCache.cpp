@@ -69,3 +69,11 @@ bool AnimationClipCache::IsEntryLive(const AnimationClipEntry& entry) const
 {
     return entry.Alive;
 }
+
+AssetFootprint AnimationClipCache::WarmFootprint(const AnimationClipEntry& entry) const
+{
+    uint64_t bytes = 0;
+    for (const AnimationJointTrack& track : entry.Value.Tracks)
+        bytes += sizeof(float) * (track.TimesSeconds.size() + track.Values.size());
+    return { .CpuBytes = bytes, .GpuBytes = 0 };
+}
@@ -63,3 +63,8 @@ bool SkeletonCache::IsEntryLive(const SkeletonEntry& entry) const
 {
     return entry.Alive;
 }
+
+AssetFootprint SkeletonCache::WarmFootprint(const SkeletonEntry& entry) const
+{
+    return { .CpuBytes = sizeof(SkeletonJoint) * entry.Value.Joints.size(), .GpuBytes = 0 };
+}
@@ -2,6 +2,7 @@
 
 #include <app/EngineConsoleBuiltins.h>
 #include <core/console/ConsoleRegistry.h>
+#include <graphics/vulkan/TextureCache.h>
 #include <profiling/CpuScopeTimings.h>
 #include <profiling/RenderStats.h>
 #include <world/transform/TransformComponents.h>
@@ -15,6 +16,7 @@
 #endif
 
 #include <algorithm>
+#include <chrono>
 #include <memory>
 #include <variant>
 
@@ -116,6 +118,11 @@ void DefaultRenderPipeline::SetAssetStores(StaticMeshCache& meshes,
     Materials = &materials;
     MaterialSets = &materialSets;
     Textures = textures;
+
+    // This pipeline feeds texel demand every frame, which is what makes it
+    // safe for the cache to commit mip tails and stream the rest.
+    if (Textures != nullptr)
+        Textures->EnableMipStreaming();
 }
 
 bool DefaultRenderPipeline::AddMeshRenderFeature(GraphicsServices& graphics)
@@ -157,9 +164,29 @@ void DefaultRenderPipeline::PublishExtractionStats(
         ShadowRequests.size() + PointShadowRequests.size());
     stats.CasterDiffEvents = static_cast<std::uint32_t>(CasterEvents.size());
 
+    const RenderExtractionSystem::LodStats lods = RenderExtractor.GetLastLodStats();
+    stats.LodReducedItems = lods.ReducedItems;
+    stats.FullDetailTriangles = lods.FullDetailTriangles;
+
     stats.ProbeVolumesResident =
         static_cast<std::uint32_t>(ProbeVolumes.ResidentVolumeCount());
 
+    if (Textures != nullptr)
+    {
+        const TextureStreamingFrameStats& textures = Textures->GetMipStreamingStats();
+        stats.TexturesStreamed = textures.StreamedTextures;
+        stats.TextureResidentBytes = textures.ResidentBytes;
+        stats.TextureBudgetBytes = textures.BudgetBytes;
+        stats.TextureMipsRequested = textures.RequestedMips;
+        stats.TextureMipsResident = textures.ResidentMips;
+        stats.TexturesPending = textures.PendingTextures;
+        stats.TexturePromotions = textures.Promotions;
+        stats.TextureEvictions = textures.Evictions;
+        stats.TextureUploadBytes = textures.UploadedBytes;
+        stats.TextureStreamLatencyUs =
+            static_cast<std::uint64_t>(std::max(textures.LastLatencyMs, 0.0) * 1000.0);
+    }
+
     const ShadowFrameStats& shadow = Residency.FrameStats();
     stats.ShadowSlotsHeld = shadow.Spot.HeldRequests + shadow.Point.HeldRequests;
     stats.ShadowCacheHits = shadow.Spot.CachedSlots + shadow.Point.CachedSlots;
@@ -224,14 +251,28 @@ void DefaultRenderPipeline::ExtractRender(RenderExtractContext& ctx)
     CpuScopeTimings* scopes =
         Instrumentation != nullptr ? Instrumentation->CpuScopes : nullptr;
 
+    const bool streamTextures = Textures != nullptr && Textures->IsMipStreaming();
     {
         CpuScopeTimer timer(scopes, CpuScope::Extraction);
+        if (streamTextures)
+            TextureDemand.BeginFrame(Camera.Projection, static_cast<float>(extent.height));
         RenderExtractor.Extract(
             world, ctx.Partitions, *Meshes, *Materials, *MaterialSets, Camera,
-            Queue, Textures, ctx.Presentation.Alpha);
+            Queue, Textures, ctx.Presentation.Alpha,
+            streamTextures ? &TextureDemand : nullptr,
+            EngineConsoleBuiltins::ReadMeshLodPolicy(Console));
         Queue.SortOpaque();
     }
 
+    if (streamTextures)
+    {
+        CpuScopeTimer timer(scopes, CpuScope::TextureResidency);
+        const double nowMs = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+        Textures->UpdateMipStreaming(
+            TextureDemand, EngineConsoleBuiltins::ReadTextureStreamingBudgets(Console), nowMs);
+    }
+
     LightExtractionCounts lightCounts;
     {
         CpuScopeTimer timer(scopes, CpuScope::LightSelection);
@@ -113,7 +113,8 @@ bool Engine::Initialize()
     RuntimeLoop.SetMaxFrameWallDeltaSeconds(Configuration.Runtime.MaxFrameWallDeltaSeconds);
 
     TaskQueueInstance = std::make_unique<AsyncTaskQueue>(
-        static_cast<uint32_t>(Configuration.Runtime.AsyncTaskThreadCount));
+        static_cast<uint32_t>(Configuration.Runtime.AsyncTaskThreadCount),
+        static_cast<uint32_t>(Configuration.Runtime.AsyncIoThreadCount));
 
     const int configuredWorkers = Configuration.Runtime.JobWorkerCount;
     FramePoolInstance = std::make_unique<JobSystem>(
@@ -220,6 +221,10 @@ void Engine::Shutdown()
     // reaches into memory that is gone.
     SpawnRecipeState.Clear();
     FrameDriverInstance.reset();
+    // Captures the queue has not drained die with it; the world must not keep
+    // submitting to it.
+    if (RuntimeWorldState != nullptr)
+        RuntimeWorldState->SetDetachCaptureLane(nullptr);
     TaskQueueInstance.reset();
     FramePoolInstance.reset();
     RuntimeWorldState.reset();
@@ -396,21 +401,55 @@ NetSession* Engine::CreateNetSession(INetTransport& transport)
         return nullptr;
     NetState = std::make_unique<NetSession>(transport);
     ReplicationState.Reset();
+    ApplyNetConfig();
     CVarPublisherState.Reset();
     PeerCommandState.Reset();
     NetStatsState.Reset();
     NetClockState.Reset();
+    PredictionState.Reset();
+    InterpolationState.Reset();
     return NetState.get();
 }
 
 void Engine::DestroyNetSession()
 {
     NetState.reset();
+    SnapshotCaptureState.Close();
+    ReplicationState.SetSnapshotCapture(nullptr);
     ReplicationState.Reset();
     CVarPublisherState.Reset();
     PeerCommandState.Reset();
     NetStatsState.Reset();
     NetClockState.Reset();
+    PredictionState.Reset();
+    InterpolationState.Reset();
+}
+
+void Engine::ApplyNetConfig()
+{
+    const EngineNetConfig& net = Configuration.Net;
+    const Logger& log = LoggingState.GetLogger<Engine>();
+
+    if (!EntropyModelLoaded && !net.EntropyModelPath.empty())
+    {
+        EntropyModelLoaded = true;
+        std::string error;
+        EntropyModelState = LoadNetEntropyModel(net.EntropyModelPath, &error);
+        if (EntropyModelState)
+            log.Info("snapshot entropy model '{}' loaded (hash {:08x})",
+                     net.EntropyModelPath, EntropyModelState->Hash());
+        else
+            log.Error("snapshot entropy model not loaded, sending snapshots raw: {}", error);
+    }
+    ReplicationState.SetEntropyModel(EntropyModelState ? &*EntropyModelState : nullptr);
+
+    if (!net.SnapshotCapturePath.empty())
+    {
+        if (SnapshotCaptureState.Open(net.SnapshotCapturePath))
+            ReplicationState.SetSnapshotCapture(&SnapshotCaptureState);
+        else
+            log.Error("cannot open snapshot capture '{}'", net.SnapshotCapturePath);
+    }
 }
 
 DefaultRenderPipeline* Engine::GetRenderPipeline()
@@ -503,6 +542,9 @@ int Engine::Run(Game& game)
     assert(!RuntimeWorldState && "Engine::Run called with a live runtime world");
     RuntimeWorldState =
         std::make_unique<RuntimeWorld>(RuntimeComponentSchemaState);
+    // Zone detach hands its state capture to the async lane; only the commit
+    // returns to this thread, at the task drain.
+    RuntimeWorldState->SetDetachCaptureLane(&Tasks());
 
     ConsoleService& console = Console();
     console.AdvancePhase(ConsolePhase::EngineReady);
@@ -678,7 +720,8 @@ void Engine::CreateDebugOverlay()
     overlay->AddPanel<TimingPanel>(TimingData);
     // Registered once for the process; the session it reads comes and goes.
     overlay->AddPanel<NetStatsPanel>(NetState, NetStatsState, NetClockState,
-                                     PeerCommandState, ConsoleState->Registry());
+                                     PeerCommandState, PredictionState,
+                                     InterpolationState, ConsoleState->Registry());
 #ifdef SENCHA_ENABLE_RENDER_PROFILING
     overlay->AddPanel<RenderStatsPanel>(
         ActiveProfileMode, RenderStatsRing, ConsoleState->Registry());
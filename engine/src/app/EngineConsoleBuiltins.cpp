@@ -1,6 +1,7 @@
 #include <app/EngineConsoleBuiltins.h>
 
 #include <app/DefaultRenderPipeline.h>
+#include <assets/runtime/AssetSystem.h>
 #include <core/console/ConsoleRegistry.h>
 #include <core/console/ConsoleService.h>
 #include <debug/DebugService.h>
@@ -15,12 +16,24 @@
 #endif
 
 #include <algorithm>
+#include <format>
 #include <span>
 #include <string_view>
 #include <variant>
 
 namespace EngineConsoleBuiltins
 {
+    namespace
+    {
+        constexpr double kWarmCacheCpuMib = 64.0;
+        constexpr double kWarmCacheGpuMib = 256.0;
+
+        std::uint64_t MibToBytes(double mib)
+        {
+            return static_cast<std::uint64_t>(std::max(mib, 0.0) * 1024.0 * 1024.0);
+        }
+    }
+
     void RegisterConsoleCVars(ConsoleRegistry& registry,
                               DebugService& debug,
                               const EngineConsoleConfig& config)
@@ -137,6 +150,18 @@ namespace EngineConsoleBuiltins
                              0.0);
         registerRenderDouble("render.shadow.min_invalidated_views_per_frame", 1.0,
                              "Views reserved per frame for invalidated cached shadows.", 0.0);
+        registerRenderDouble("render.texture.budget_mib", 512.0,
+                             "Resident budget for streamed texture mips, in MiB. Zero removes the clamp.",
+                             0.0);
+        registerRenderDouble("render.texture.upload_mib_per_frame", 16.0,
+                             "Texture mip bytes uploaded per frame, in MiB. Zero removes the clamp.",
+                             0.0);
+        registerRenderDouble("render.mesh_lod.pixel_error", 1.0,
+                             "Largest mesh LOD error shown on screen, in pixels. Zero keeps full detail.",
+                             0.0);
+        registerRenderDouble("render.mesh_lod.hysteresis", 0.25,
+                             "Fraction of the pixel error a coarser mesh LOD must clear before it is taken.",
+                             0.0, 1.0);
 
         registry.RegisterCVar({
             .Name = "render.tonemap",
@@ -572,6 +597,132 @@ namespace EngineConsoleBuiltins
         return budgets;
     }
 
+    TextureStreamingBudgets ReadTextureStreamingBudgets(const ConsoleRegistry* registry)
+    {
+        const auto readMib = [registry](std::string_view name, double fallback)
+        {
+            double mib = fallback;
+            if (registry != nullptr)
+            {
+                if (const CVarMetadata* metadata = registry->FindCVar(name))
+                {
+                    if (const double* value = std::get_if<double>(&metadata->CurrentValue))
+                        mib = *value;
+                }
+            }
+            return static_cast<std::uint64_t>(std::max(mib, 0.0) * 1024.0 * 1024.0);
+        };
+
+        TextureStreamingBudgets budgets;
+        budgets.ResidentBytes = readMib("render.texture.budget_mib", 512.0);
+        budgets.UploadBytesPerFrame = readMib("render.texture.upload_mib_per_frame", 16.0);
+        return budgets;
+    }
+
+    MeshLodPolicy ReadMeshLodPolicy(const ConsoleRegistry* registry)
+    {
+        const auto readDouble = [registry](std::string_view name, double fallback)
+        {
+            if (registry == nullptr)
+                return fallback;
+            const CVarMetadata* metadata = registry->FindCVar(name);
+            if (metadata == nullptr)
+                return fallback;
+            const double* value = std::get_if<double>(&metadata->CurrentValue);
+            return value != nullptr ? *value : fallback;
+        };
+
+        MeshLodPolicy policy;
+        policy.PixelError = static_cast<float>(std::max(
+            readDouble("render.mesh_lod.pixel_error", 1.0), 0.0));
+        policy.Hysteresis = static_cast<float>(std::clamp(
+            readDouble("render.mesh_lod.hysteresis", 0.25), 0.0, 1.0));
+        return policy;
+    }
+
+    void RegisterAssetCVars(ConsoleRegistry& registry, AssetSystem& assets)
+    {
+        const auto registerWarmMib = [&registry, &assets](const char* name,
+                                                          double defaultValue,
+                                                          const char* help,
+                                                          std::uint64_t AssetWarmCacheBudget::*side) {
+            registry.RegisterCVar({
+                .Name = name,
+                .Owner = "assets",
+                .Type = CVarType::Double,
+                .DefaultValue = defaultValue,
+                .CurrentValue = defaultValue,
+                .Flags = CVarFlags::Archive,
+                .Help = help,
+                .Source = { "asset defaults" },
+                .Min = 0.0,
+                .OnChange = [&assets, side](const CVarChangeContext& ctx) {
+                    AssetWarmCacheBudget budget = assets.GetWarmCacheBudget();
+                    budget.*side = MibToBytes(std::get<double>(ctx.NewValue));
+                    assets.SetWarmCacheBudget(budget);
+                },
+            });
+        };
+
+        registerWarmMib("asset.warm_cache.cpu_mib", kWarmCacheCpuMib,
+                        "Host memory each asset kind may keep in released, still-loaded "
+                        "entries, in MiB. Zero on both sides frees them on release.",
+                        &AssetWarmCacheBudget::CpuBytes);
+        registerWarmMib("asset.warm_cache.gpu_mib", kWarmCacheGpuMib,
+                        "Device memory each asset kind may keep in released, still-loaded "
+                        "entries, in MiB. Zero on both sides frees them on release.",
+                        &AssetWarmCacheBudget::GpuBytes);
+
+        registry.RegisterCommand({
+            .Name = "asset.warm_cache.stats",
+            .Owner = "assets",
+            .Usage = "asset.warm_cache.stats",
+            .Help = "Print warm cache hits, misses, evictions, and parked bytes per asset kind.",
+            .Callback = [&assets](ConsoleExecutionContext&,
+                                  std::span<const std::string>) {
+                ConsoleResult result;
+                for (const AssetKindRegistration& kind : assets.Kinds().Entries())
+                {
+                    if (kind.Store == nullptr)
+                        continue;
+                    const AssetWarmCacheStats stats = kind.Store->GetWarmCacheStats();
+                    result.Info(std::format(
+                        "{}: {} hits, {} misses, {} evictions, {} parked ({} KiB cpu, {} KiB gpu)",
+                        kind.Name, stats.Hits, stats.Misses, stats.Evictions,
+                        stats.ParkedEntries, stats.ParkedCpuBytes / 1024,
+                        stats.ParkedGpuBytes / 1024));
+                }
+                return result;
+            },
+        });
+
+        // The cvars may already carry archived or config values by the time
+        // the owner registers them; apply whatever they hold now.
+        assets.SetWarmCacheBudget(ReadAssetWarmCacheBudget(&registry));
+    }
+
+    AssetWarmCacheBudget ReadAssetWarmCacheBudget(const ConsoleRegistry* registry)
+    {
+        const auto readMib = [registry](std::string_view name, double fallback)
+        {
+            double mib = fallback;
+            if (registry != nullptr)
+            {
+                if (const CVarMetadata* metadata = registry->FindCVar(name))
+                {
+                    if (const double* value = std::get_if<double>(&metadata->CurrentValue))
+                        mib = *value;
+                }
+            }
+            return MibToBytes(mib);
+        };
+
+        return AssetWarmCacheBudget{
+            .CpuBytes = readMib("asset.warm_cache.cpu_mib", kWarmCacheCpuMib),
+            .GpuBytes = readMib("asset.warm_cache.gpu_mib", kWarmCacheGpuMib),
+        };
+    }
+
     ConsoleResult ApplyConfigAssignments(ConsoleService& console,
                                          const EngineConsoleConfig& config)
     {
@@ -11,6 +11,8 @@
 #include <net/NetConsoleCommands.h>
 #include <net/NetSession.h>
 #include <net/ReplicationSnapshot.h>
+#include <physics/PhysicsStepSystem.h>
+#include <world/transform/TransformComponents.h>
 #include <world/transform/TransformPropagation.h>
 
 #ifdef SENCHA_ENABLE_DEBUG_UI
@@ -19,6 +21,8 @@
 
 #include <SDL3/SDL.h>
 
+#include <chrono>
+
 #ifdef SENCHA_ENABLE_VULKAN
 #include <graphics/vulkan/GraphicsServices.h>
 #include <graphics/vulkan/Renderer.h>
@@ -100,13 +104,18 @@ void Engine::RegisterNetFramePhases()
         session->SetLocalTick(simulation.GetTickIndex());
 
         engine.ClearNetDeliveries();
+        const auto pumpStarted = std::chrono::steady_clock::now();
         const std::vector<NetSession::Delivery> deliveries = session->Pump(now);
+        const std::chrono::duration<double> pumpElapsed =
+            std::chrono::steady_clock::now() - pumpStarted;
 
         // Everything that arrived, counted before anything decides what to do
         // with it: traffic a build refuses is still traffic it paid for, and a
         // rate that only counted accepted messages would hide exactly the
         // pathologies worth seeing.
         NetStats& traffic = engine.NetTraffic();
+        traffic.RecordPumpSeconds(pumpElapsed.count());
+        traffic.RecordTransport(session->TransportCounters());
         traffic.Sample(now);
         for (const NetSession::Delivery& delivery : deliveries)
         {
@@ -233,18 +242,32 @@ void Engine::RegisterNetFramePhases()
 
             // Anything else that is not a snapshot is the game's; it is kept
             // for this frame rather than interpreted here.
-            if (static_cast<NetPayloadKind>(delivery.Payload[0])
-                != NetPayloadKind::Snapshot)
+            const auto kind = static_cast<NetPayloadKind>(delivery.Payload[0]);
+            if (kind != NetPayloadKind::Snapshot
+                && kind != NetPayloadKind::SnapshotCoded)
             {
                 engine.RetainNetDelivery(delivery);
                 continue;
             }
 
+            // The snapshot is a delta against the authority's last word about
+            // this client's own pawn, not against the prediction standing in
+            // its place, so the pawn goes back to that word for the apply.
+            PredictionRuntime& prediction = engine.Prediction();
+            if (isAdmitted)
+                prediction.BeginAuthoritative(world, engine.ReplicatedComponents());
+
             const SnapshotApplyResult applied =
                 engine.Replication().Apply(delivery.Payload, world,
                                            engine.RuntimeComponents(),
                                            engine.ReplicatedComponents(),
                                            &engine.SpawnRecipes());
+            if (isAdmitted)
+            {
+                prediction.EndAuthoritative(world, engine.ReplicatedComponents(),
+                                            session->LocalPeerId(), applied.Tick,
+                                            applied.Ok());
+            }
             // Every snapshot is also a clock sample, and the freshest one
             // available: it leaves the authority stamped with the tick that
             // produced it, once a frame rather than once a keepalive.
@@ -253,6 +276,11 @@ void Engine::RegisterNetFramePhases()
                 engine.NetClock().Observe(applied.Tick, simulation.GetTickIndex(),
                                           session->RoundTripMicroseconds(),
                                           simulation.GetFixedDt());
+
+                // After the prediction has its pawns back, so what is kept for
+                // drawing is only what other machines drive.
+                engine.Interpolation().Record(world, engine.Replication().ClientEntities(),
+                                              session->LocalPeerId(), applied.Tick);
             }
 
             if (!applied.Ok())
@@ -319,7 +347,11 @@ void Engine::RegisterNetFramePhases()
                 traffic.RecordOut(NetTrafficKind::Command, bytes);
         }
 
+        const auto flushStarted = std::chrono::steady_clock::now();
         session->Flush(ctx.Runtime->GetCurrentFrame().WallTime.UnscaledElapsed);
+        const std::chrono::duration<double> flushElapsed =
+            std::chrono::steady_clock::now() - flushStarted;
+        traffic.RecordFlushSeconds(flushElapsed.count());
     });
 }
 
@@ -367,6 +399,72 @@ void Engine::RegisterSimulationFramePhases()
         ctx.Zones = &zones;
         ctx.Runtime->ScheduleFixedTicks();
 
+        // Before anything this frame reads the pawns a client owns: the pump
+        // left them at the authority's word, and this either puts the
+        // prediction back or replays the ticks since from that word. Here
+        // rather than in the pump because replaying needs the frame view.
+        if (const NetSession* session = engine.TryNet();
+            session != nullptr && session->Role() == NetSessionRole::Client)
+        {
+            engine.Prediction().Reconcile(
+                *zones.Entities, engine.ReplicatedComponents(),
+                [&engine, &ctx](std::uint64_t tick) {
+                    const FrameZoneView& view = *ctx.Zones;
+                    const FixedSimTime time{
+                        .DeltaSeconds = ctx.Runtime->GetSimulationClock().GetFixedDt(),
+                        .TickIndex = tick,
+                    };
+
+                    FixedLogicContext logic{
+                        .Config = engine.Config(),
+                        .Runtime = *ctx.Runtime,
+                        .Time = time,
+                        .Entities = *view.Entities,
+                        .Partitions = view.Logic,
+                        .Resimulating = true,
+                        .Predicted = engine.Prediction().PredictedEntityIds(),
+                    };
+                    engine.Schedule().RunFixedLogic(logic);
+
+                    PhysicsContext physics{
+                        .Config = engine.Config(),
+                        .Runtime = *ctx.Runtime,
+                        .Time = time,
+                        .Entities = *view.Entities,
+                        .Partitions = view.Physics,
+                        .Resimulating = true,
+                        .Predicted = engine.Prediction().PredictedEntityIds(),
+                    };
+                    engine.Schedule().RunPhysics(physics);
+
+                    // Post-fixed work and pose history are left out: they
+                    // describe ticks as presented, and these were presented
+                    // already.
+                    PropagateTransforms(
+                        *view.Entities,
+                        view.Logic,
+                        TransformPropagationDomain::Simulation,
+                        engine.Config().Runtime.TransformForceFullPropagation);
+                },
+                [&engine, &zones](std::span<const EntityId> snapped) {
+                    // A mover keeps its own position; left alone, the next tick
+                    // would carry the pawn on from the prediction the snap
+                    // just dropped.
+                    PhysicsStepSystem* physics = engine.Schedule().Get<PhysicsStepSystem>();
+                    if (physics == nullptr)
+                        return;
+                    ::World& entities = *zones.Entities;
+                    for (const EntityId entity : snapped)
+                    {
+                        if (const LocalTransform* local = entities.TryGet<LocalTransform>(entity))
+                        {
+                            (void)physics->GetCharacterMovers().SetPosition(
+                                entities, entity, local->Value.Position);
+                        }
+                    }
+                });
+        }
+
         // After the tick budget so the frame view is settled, and before the
         // ticks themselves consume what it produces.
         PreSimulateContext preSimulate{
@@ -424,6 +522,17 @@ void Engine::RegisterSimulationFramePhases()
             zones.Logic,
             HasRuntimeFrameEvent(ctx.Runtime->GetCurrentFrame().Events,
                                  RuntimeFrameEventFlags::TemporalDiscontinuity));
+
+        // What this tick predicted for the pawns a client owns, kept until the
+        // snapshot that speaks for the same tick arrives to check it.
+        if (const NetSession* session = engine.TryNet();
+            session != nullptr && session->Role() == NetSessionRole::Client
+            && session->IsConnected())
+        {
+            engine.Prediction().Capture(entities, engine.ReplicatedComponents(),
+                                        session->LocalPeerId(),
+                                        ctx.CurrentTick.TickIndex, engine.NetClock());
+        }
     });
 
     driver.Register(FramePhase::Update, [&engine, &config](PhaseContext& ctx) {
@@ -431,6 +540,20 @@ void Engine::RegisterSimulationFramePhases()
         const FrameZoneView& zones = *ctx.Zones;
         ::World& entities = *zones.Entities;
 
+        // Before the camera rig and extraction read a presentation pose, and
+        // after the ticks, whose history capture would otherwise overwrite it
+        // with the snapshot's pose at the tick rate.
+        if (const NetSession* session = engine.TryNet();
+            session != nullptr && session->Role() == NetSessionRole::Client)
+        {
+            const double fixedDt = ctx.Runtime->GetSimulationClock().GetFixedDt();
+            engine.Interpolation().Present(
+                entities, engine.NetClock(),
+                ctx.Runtime->GetSimulationClock().GetTickIndex(),
+                rf.Presentation.Alpha,
+                fixedDt > 0.0 ? static_cast<double>(rf.WallTime.Dt) / fixedDt : 0.0);
+        }
+
         FrameUpdateContext update{
             .Config = config,
             .Runtime = *ctx.Runtime,
@@ -55,12 +55,18 @@ void EngineSchedule::RunPreSimulate(PreSimulateContext& ctx)
 
 void EngineSchedule::RunFixedLogic(FixedLogicContext& ctx)
 {
-    Run(FixedLogicEntries, ctx);
+    if (ctx.Resimulating)
+        RunResimulated(FixedLogicEntries, ctx);
+    else
+        Run(FixedLogicEntries, ctx);
 }
 
 void EngineSchedule::RunPhysics(PhysicsContext& ctx)
 {
-    Run(PhysicsEntries, ctx);
+    if (ctx.Resimulating)
+        RunResimulated(PhysicsEntries, ctx);
+    else
+        Run(PhysicsEntries, ctx);
 }
 
 void EngineSchedule::RunPostFixed(PostFixedContext& ctx)
@@ -22,19 +22,28 @@ AnimationClipAssetLoader::AnimationClipAssetLoader(LoggingProvider& logging,
 
 AssetStaging AnimationClipAssetLoader::LoadStaged(const AssetRecord& record, IAssetSource& source)
 {
-    AssetStaging staging;
-    staging.Record = record;
-
-    std::vector<std::byte> bytes;
-    if (!ReadAssetBytes(source, record, bytes))
+    AssetBytes bytes;
+    if (!ReadAssetView(source, record, bytes))
     {
+        AssetStaging staging;
+        staging.Record = record;
         staging.Error = std::format("could not read animation clip source for '{}'", record.Path);
         return staging;
     }
 
+    return DecodeStaged(record, bytes, std::stop_token{});
+}
+
+AssetStaging AnimationClipAssetLoader::DecodeStaged(const AssetRecord& record,
+                                                    const AssetBytes& bytes,
+                                                    std::stop_token)
+{
+    AssetStaging staging;
+    staging.Record = record;
+
     AnimationClipData data;
     std::string error;
-    if (!LoadSanimFromBytes(bytes, data, &error))
+    if (!LoadSanimFromBytes(bytes.Bytes(), data, &error))
     {
         staging.Error = std::format("failed to parse .sanim for '{}': {}", record.Path, error);
         return staging;
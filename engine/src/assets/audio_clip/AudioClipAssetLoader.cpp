@@ -17,16 +17,25 @@ AudioClipAssetLoader::AudioClipAssetLoader(LoggingProvider& logging, AudioClipCa
 
 AssetStaging AudioClipAssetLoader::LoadStaged(const AssetRecord& record, IAssetSource& source)
 {
-    AssetStaging staging;
-    staging.Record = record;
-
-    std::vector<std::byte> bytes;
-    if (!ReadAssetBytes(source, record, bytes))
+    AssetBytes bytes;
+    if (!ReadAssetView(source, record, bytes))
     {
+        AssetStaging staging;
+        staging.Record = record;
         staging.Error = std::format("could not read audio source for '{}'", record.Path);
         return staging;
     }
 
+    return DecodeStaged(record, bytes, std::stop_token{});
+}
+
+AssetStaging AudioClipAssetLoader::DecodeStaged(const AssetRecord& record,
+                                                const AssetBytes& bytes,
+                                                std::stop_token)
+{
+    AssetStaging staging;
+    staging.Record = record;
+
     // Sniff the container magic rather than trusting the extension: a cooked
     // artifact keeps its source's virtual path (Decision B), so the path may
     // say ".wav" while the bytes are a cooked .sclip.
@@ -34,7 +43,7 @@ AssetStaging AudioClipAssetLoader::LoadStaged(const AssetRecord& record, IAssetS
     {
         AudioClip clip;
         std::string sclipError;
-        if (!LoadSclipFromBytes(bytes, clip, &sclipError))
+        if (!LoadSclipFromBytes(bytes.Bytes(), clip, &sclipError))
         {
             staging.Error = std::format("failed to parse .sclip for '{}': {}",
                                         record.Path, sclipError);
@@ -45,7 +54,7 @@ AssetStaging AudioClipAssetLoader::LoadStaged(const AssetRecord& record, IAssetS
         return staging;
     }
 
-    std::optional<AudioClip> clip = LoadAudioClipFromWavBytes(bytes);
+    std::optional<AudioClip> clip = LoadAudioClipFromWavBytes(bytes.Bytes());
     if (!clip)
     {
         staging.Error = std::format("failed to decode audio data for '{}'", record.Path);
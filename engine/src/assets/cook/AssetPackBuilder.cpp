@@ -0,0 +1,209 @@
+#include <assets/cook/AssetPackBuilder.h>
+
+#include <core/assets/AssetPackCodec.h>
+#include <core/assets/AssetRegistry.h>
+#include <core/assets/AssetSource.h>
+#include <core/hash/ContentHash.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+    bool Fail(std::string* error, std::string message)
+    {
+        if (error != nullptr)
+            *error = std::move(message);
+        return false;
+    }
+
+    [[nodiscard]] uint64_t AlignUp(uint64_t value, uint64_t alignment)
+    {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+}
+
+AssetPackWriter::AssetPackWriter(AssetPackBuildOptions options)
+    : Options(options)
+{
+}
+
+bool AssetPackWriter::Open(const std::filesystem::path& packPath, std::string* error)
+{
+    const uint32_t alignment = Options.Alignment;
+    if (alignment < alignof(SpakEntry) || (alignment & (alignment - 1)) != 0)
+        return Fail(error, "pack alignment must be a power of two of at least 8");
+
+    Out = std::ofstream(packPath, std::ios::binary | std::ios::trunc);
+    if (!Out)
+        return Fail(error, "could not create '" + packPath.generic_string() + "'");
+
+    // Reserved now, written for real by Finish once the offsets are known.
+    const SpakFileHeader placeholder{};
+    Out.write(reinterpret_cast<const char*>(&placeholder), sizeof(placeholder));
+    Cursor = sizeof(placeholder);
+    Toc.clear();
+    Strings.clear();
+    BuildStats = {};
+    return static_cast<bool>(Out);
+}
+
+bool AssetPackWriter::PadTo(uint64_t alignment)
+{
+    static constexpr char kZeros[64] = {};
+    uint64_t padding = AlignUp(Cursor, alignment) - Cursor;
+    while (padding > 0)
+    {
+        const uint64_t chunk = std::min<uint64_t>(padding, sizeof(kZeros));
+        Out.write(kZeros, static_cast<std::streamsize>(chunk));
+        padding -= chunk;
+        Cursor += chunk;
+    }
+    return static_cast<bool>(Out);
+}
+
+bool AssetPackWriter::Add(std::string_view virtualPath, AssetType type,
+                          std::span<const std::byte> bytes, std::string* error)
+{
+    if (!Out.is_open())
+        return Fail(error, "pack is not open");
+    if (virtualPath.empty() || virtualPath.size() > UINT32_MAX
+        || Strings.size() + virtualPath.size() > UINT32_MAX)
+    {
+        return Fail(error, "path '" + std::string(virtualPath) + "' does not fit the pack");
+    }
+
+    std::span<const std::byte> stored = bytes;
+    uint16_t flags = 0;
+    // Past the reader's cap a compressed entry would be refused at open, so an
+    // asset that large stays raw and is read in place instead.
+    if (Options.Compress && !bytes.empty() && bytes.size() <= kSpakMaxDecodedEntryBytes)
+    {
+        SpakCompress(bytes, Scratch);
+        const double kept = static_cast<double>(bytes.size()) * (1.0 - Options.MinCompressionSaving);
+        if (static_cast<double>(Scratch.size()) <= kept)
+        {
+            stored = Scratch;
+            flags |= kSpakEntryCompressed;
+        }
+    }
+
+    if (!PadTo(Options.Alignment))
+        return Fail(error, "write failed");
+
+    SpakEntry entry;
+    entry.PathHash = HashSpakPath(virtualPath);
+    entry.PathOffset = static_cast<uint32_t>(Strings.size());
+    entry.PathLength = static_cast<uint32_t>(virtualPath.size());
+    entry.DataOffset = Cursor;
+    entry.StoredSize = stored.size();
+    entry.Size = bytes.size();
+    entry.ContentHash = HashBytes64(bytes);
+    entry.Type = type;
+    entry.Flags = flags;
+
+    Out.write(reinterpret_cast<const char*>(stored.data()),
+              static_cast<std::streamsize>(stored.size()));
+    if (!Out)
+        return Fail(error, "write failed");
+    Cursor += stored.size();
+
+    Strings.append(virtualPath);
+    Toc.push_back(entry);
+
+    ++BuildStats.Entries;
+    if ((flags & kSpakEntryCompressed) != 0)
+        ++BuildStats.Compressed;
+    BuildStats.RawBytes += bytes.size();
+    BuildStats.StoredBytes += stored.size();
+    return true;
+}
+
+bool AssetPackWriter::Finish(std::string* error)
+{
+    if (!Out.is_open())
+        return Fail(error, "pack is not open");
+
+    const auto pathOf = [this](const SpakEntry& entry) {
+        return std::string_view(Strings).substr(entry.PathOffset, entry.PathLength);
+    };
+    std::sort(Toc.begin(), Toc.end(), [&](const SpakEntry& a, const SpakEntry& b) {
+        if (a.PathHash != b.PathHash)
+            return a.PathHash < b.PathHash;
+        return pathOf(a) < pathOf(b);
+    });
+    for (std::size_t i = 1; i < Toc.size(); ++i)
+    {
+        if (Toc[i - 1].PathHash == Toc[i].PathHash && pathOf(Toc[i - 1]) == pathOf(Toc[i]))
+            return Fail(error, "'" + std::string(pathOf(Toc[i])) + "' was added twice");
+    }
+
+    if (!PadTo(alignof(SpakEntry)))
+        return Fail(error, "write failed");
+
+    SpakFileHeader header;
+    std::memcpy(header.Magic, kSpakMagic, sizeof(header.Magic));
+    header.Version = kSpakVersion;
+    header.Alignment = Options.Alignment;
+    header.EntryCount = static_cast<uint32_t>(Toc.size());
+    header.TocOffset = Cursor;
+    header.StringsOffset = Cursor + Toc.size() * sizeof(SpakEntry);
+    header.StringsSize = Strings.size();
+
+    Out.write(reinterpret_cast<const char*>(Toc.data()),
+              static_cast<std::streamsize>(Toc.size() * sizeof(SpakEntry)));
+    Out.write(Strings.data(), static_cast<std::streamsize>(Strings.size()));
+    Out.seekp(0);
+    Out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    Out.close();
+    if (!Out)
+        return Fail(error, "write failed");
+
+    BuildStats.FileBytes = header.StringsOffset + header.StringsSize;
+    return true;
+}
+
+bool BuildAssetPack(const AssetRegistry& registry,
+                    IAssetSource& source,
+                    const std::filesystem::path& packPath,
+                    const AssetPackBuildOptions& options,
+                    AssetPackBuildStats* stats,
+                    std::string* error)
+{
+    // Sorted so the same registry always produces the same bytes, whatever
+    // order the map happens to iterate in.
+    std::vector<const AssetRecord*> records;
+    records.reserve(registry.Records().size());
+    for (const auto& [path, record] : registry.Records())
+        records.push_back(&record);
+    std::sort(records.begin(), records.end(),
+              [](const AssetRecord* a, const AssetRecord* b) { return a->Path < b->Path; });
+
+    AssetPackWriter writer(options);
+    if (!writer.Open(packPath, error))
+        return false;
+
+    std::size_t skipped = 0;
+    std::vector<std::byte> bytes;
+    for (const AssetRecord* record : records)
+    {
+        if (record->SourceKind != AssetSourceKind::File)
+        {
+            ++skipped;
+            continue;
+        }
+        if (!ReadAssetBytes(source, *record, bytes))
+            return Fail(error, "could not read '" + record->Path + "'");
+        if (!writer.Add(record->Path, record->Type, bytes, error))
+            return false;
+    }
+
+    if (!writer.Finish(error))
+        return false;
+    if (stats != nullptr)
+    {
+        *stats = writer.Stats();
+        stats->Skipped = skipped;
+    }
+    return true;
+}
@@ -0,0 +1,152 @@
+#include <assets/cook/AssetRegistryIndexBuilder.h>
+
+#include <core/assets/AssetPackFormat.h>
+#include <core/assets/AssetRegistry.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <vector>
+
+namespace
+{
+    bool Fail(std::string* error, std::string message)
+    {
+        if (error != nullptr)
+            *error = std::move(message);
+        return false;
+    }
+
+    // `filePath` relative to `root`, or empty when it lies outside it.
+    std::string RelativeToRoot(const std::filesystem::path& root, std::string_view filePath)
+    {
+        const std::filesystem::path relative =
+            std::filesystem::path(std::string(filePath)).lexically_normal().lexically_relative(root);
+        if (relative.empty() || *relative.begin() == "..")
+            return {};
+        return relative.generic_string();
+    }
+
+    struct PendingEntry
+    {
+        const AssetRecord* Record = nullptr;
+        std::string File;
+        uint64_t PathHash = 0;
+    };
+}
+
+bool WriteAssetRegistryIndex(const AssetRegistry& registry,
+                             std::string_view assetsRoot,
+                             const std::filesystem::path& indexPath,
+                             AssetRegistryIndexBuildStats* stats,
+                             std::string* error)
+{
+    const std::filesystem::path root = std::filesystem::path(std::string(assetsRoot)).lexically_normal();
+
+    AssetRegistryIndexBuildStats built;
+    std::vector<PendingEntry> pending;
+    pending.reserve(registry.Records().size());
+    for (const auto& [path, record] : registry.Records())
+    {
+        std::string file = record.SourceKind == AssetSourceKind::File && !record.FilePath.empty()
+            ? RelativeToRoot(root, record.FilePath)
+            : std::string();
+        if (file.empty())
+        {
+            ++built.Skipped;
+            continue;
+        }
+        pending.push_back({ .Record = &record, .File = std::move(file),
+                            .PathHash = HashSpakPath(path) });
+    }
+
+    // The order a lookup searches, which also makes the same registry write
+    // the same bytes whatever order the map iterates in.
+    std::sort(pending.begin(), pending.end(), [](const PendingEntry& a, const PendingEntry& b)
+    {
+        return a.PathHash != b.PathHash ? a.PathHash < b.PathHash : a.Record->Path < b.Record->Path;
+    });
+
+    std::string strings;
+    std::vector<SregEntry> entries;
+    std::vector<SregIdEntry> ids;
+    entries.reserve(pending.size());
+    const auto appendString = [&strings](std::string_view text, uint32_t& offset, uint32_t& length)
+    {
+        offset = static_cast<uint32_t>(strings.size());
+        length = static_cast<uint32_t>(text.size());
+        strings.append(text);
+    };
+    for (const PendingEntry& item : pending)
+    {
+        const AssetRecord& record = *item.Record;
+        SregEntry entry;
+        entry.PathHash = item.PathHash;
+        entry.ContentHash = record.ContentHash;
+        entry.Id = record.Id.Value;
+        entry.Version = record.Version;
+        entry.Type = record.Type;
+        entry.SourceKind = record.SourceKind;
+        appendString(record.Path, entry.PathOffset, entry.PathLength);
+        appendString(item.File, entry.FileOffset, entry.FileLength);
+        if (strings.size() > std::numeric_limits<uint32_t>::max())
+            return Fail(error, "string table exceeds 4 GiB");
+
+        if (record.Id.IsValid())
+        {
+            ids.push_back({ .Id = record.Id.Value,
+                            .Entry = static_cast<uint32_t>(entries.size()) });
+        }
+        entries.push_back(entry);
+    }
+    std::sort(ids.begin(), ids.end(),
+              [](const SregIdEntry& a, const SregIdEntry& b) { return a.Id < b.Id; });
+
+    SregFileHeader header{};
+    std::memcpy(header.Magic, kSregMagic, sizeof(kSregMagic));
+    header.Version = kSregVersion;
+    header.EntryCount = static_cast<uint32_t>(entries.size());
+    header.IdCount = static_cast<uint32_t>(ids.size());
+    header.EntriesOffset = sizeof(SregFileHeader);
+    header.IdsOffset = header.EntriesOffset + entries.size() * sizeof(SregEntry);
+    header.StringsOffset = header.IdsOffset + ids.size() * sizeof(SregIdEntry);
+    header.StringsSize = strings.size();
+
+    std::error_code ec;
+    if (indexPath.has_parent_path())
+        std::filesystem::create_directories(indexPath.parent_path(), ec);
+
+    std::filesystem::path staging = indexPath;
+    staging += ".tmp";
+    {
+        std::ofstream out(staging, std::ios::binary | std::ios::trunc);
+        if (!out)
+            return Fail(error, "could not create '" + staging.generic_string() + "'");
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(entries.data()),
+                  static_cast<std::streamsize>(entries.size() * sizeof(SregEntry)));
+        out.write(reinterpret_cast<const char*>(ids.data()),
+                  static_cast<std::streamsize>(ids.size() * sizeof(SregIdEntry)));
+        out.write(strings.data(), static_cast<std::streamsize>(strings.size()));
+        out.close();
+        if (!out)
+            return Fail(error, "write of '" + staging.generic_string() + "' failed");
+    }
+
+    std::filesystem::rename(staging, indexPath, ec);
+    if (ec)
+    {
+        std::filesystem::remove(staging, ec);
+        return Fail(error, "could not replace '" + indexPath.generic_string() + "'");
+    }
+
+    if (stats != nullptr)
+    {
+        built.Entries = entries.size();
+        built.WithIds = ids.size();
+        built.FileBytes = header.StringsOffset + header.StringsSize;
+        *stats = built;
+    }
+    return true;
+}
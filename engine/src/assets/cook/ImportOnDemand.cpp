@@ -5,6 +5,7 @@
 #include <core/hash/ContentHash.h>
 #include <core/logging/LoggingProvider.h>
 
+#include <algorithm>
 #include <chrono>
 #include <filesystem>
 #include <fstream>
@@ -215,6 +216,29 @@ namespace
         return true;
     }
 
+    // Stale sources wait here, per importer, so each importer sees them as
+    // a batch (IAssetImporter::ImportBatch). A batch flushes once its source
+    // bytes pass the budget, bounding how much decoded data an importer holds
+    // at once; whatever is left flushes at the end of the scan.
+    constexpr std::size_t kImportBatchSourceBytes = std::size_t(64) << 20;
+
+    struct StaleSource
+    {
+        std::string SourceRelPath;
+        std::vector<std::byte> Bytes;
+        std::vector<std::byte> MetaBytes;
+        uint64_t SourceHash = 0;
+        FileStat SourceStat;
+        FileStat MetaStat;
+    };
+
+    struct ImportBatchQueue
+    {
+        IAssetImporter* Importer = nullptr;
+        std::vector<StaleSource> Sources{};
+        std::size_t SourceBytes = 0;
+    };
+
     // Private staging root for prepared bytes, unique per prepare run and under
     // .cooked so the source scan skips it.
     std::filesystem::path MakeStagingDir(const std::filesystem::path& root)
@@ -303,6 +327,57 @@ bool PrepareAssetsOnDemand(const std::filesystem::path& assetsRoot,
     FileCookOutputWriter stagingWriter(out.TempRoot);
 
     bool ok = true;
+    std::vector<ImportBatchQueue> queues;
+    const auto flush = [&](ImportBatchQueue& queue)
+    {
+        if (queue.Sources.empty())
+            return;
+        std::vector<ImportInput> inputs;
+        inputs.reserve(queue.Sources.size());
+        for (const StaleSource& source : queue.Sources)
+            inputs.push_back(ImportInput{ source.SourceRelPath, source.Bytes, source.MetaBytes });
+        std::vector<ImportResult> results = queue.Importer->ImportBatch(inputs, stagingWriter);
+        if (results.size() != inputs.size())
+        {
+            results.assign(inputs.size(),
+                ImportResult{ .Error = "importer returned the wrong number of batch results" });
+        }
+
+        for (std::size_t i = 0; i < results.size(); ++i)
+        {
+            const StaleSource& source = queue.Sources[i];
+            ImportResult& result = results[i];
+            std::string whyNot = result.Error;
+            if (!result.IsValid() || !ArtifactsAreValid(result.Artifacts, whyNot))
+            {
+                log.Warn("ImportOnDemand: import of '{}' failed: {}", source.SourceRelPath, whyNot);
+                ++stats.Failed;
+                ok = false;
+                continue;
+            }
+            StampArtifactHashes(stagingWriter, result.Artifacts);
+
+            CookedSourceEntry entry;
+            entry.SourceRelPath = source.SourceRelPath;
+            entry.InputFingerprint = source.SourceHash;
+            StampSourceStats(entry, source.SourceStat, source.MetaStat);
+            entry.Artifacts = result.Artifacts;
+
+            for (const CookedArtifact& artifact : result.Artifacts)
+            {
+                out.Artifacts.push_back(PreparedCookedArtifact{
+                    artifact, out.TempRoot / artifact.FileRelPath });
+                out.Registrations.push_back(artifact);
+            }
+            out.IndexDelta.Puts.push_back(std::move(entry));
+            ++stats.Imported;
+            log.Info("ImportOnDemand: cooked '{}' ({} artifact{})", source.SourceRelPath,
+                result.Artifacts.size(), result.Artifacts.size() == 1 ? "" : "s");
+        }
+        queue.Sources.clear();
+        queue.SourceBytes = 0;
+    };
+
     for (std::filesystem::recursive_directory_iterator it(assetsRoot, ec), end;
          it != end; it.increment(ec))
     {
@@ -384,36 +459,26 @@ bool PrepareAssetsOnDemand(const std::filesystem::path& assetsRoot,
             continue;
         }
 
-        ImportResult result =
-            importer->Import(ImportInput{ sourceRel, bytes, metaBytes }, stagingWriter);
-        std::string whyNot = result.Error;
-        if (!result.IsValid() || !ArtifactsAreValid(result.Artifacts, whyNot))
-        {
-            log.Warn("ImportOnDemand: import of '{}' failed: {}", sourceRel, whyNot);
-            ++stats.Failed;
-            ok = false;
-            continue;
-        }
-        StampArtifactHashes(stagingWriter, result.Artifacts);
-
-        CookedSourceEntry entry;
-        entry.SourceRelPath = sourceRel;
-        entry.InputFingerprint = sourceHash;
-        StampSourceStats(entry, sourceStat, metaStat);
-        entry.Artifacts = result.Artifacts;
-
-        for (const CookedArtifact& artifact : result.Artifacts)
-        {
-            out.Artifacts.push_back(PreparedCookedArtifact{
-                artifact, out.TempRoot / artifact.FileRelPath });
-            out.Registrations.push_back(artifact);
-        }
-        out.IndexDelta.Puts.push_back(std::move(entry));
-        ++stats.Imported;
-        log.Info("ImportOnDemand: cooked '{}' ({} artifact{})",
-            sourceRel, result.Artifacts.size(), result.Artifacts.size() == 1 ? "" : "s");
+        auto queue = std::find_if(queues.begin(), queues.end(),
+            [importer](const ImportBatchQueue& q) { return q.Importer == importer; });
+        if (queue == queues.end())
+            queue = queues.insert(queues.end(), ImportBatchQueue{ .Importer = importer });
+        queue->SourceBytes += bytes.size() + metaBytes.size();
+        queue->Sources.push_back(StaleSource{
+            .SourceRelPath = sourceRel,
+            .Bytes = std::move(bytes),
+            .MetaBytes = std::move(metaBytes),
+            .SourceHash = sourceHash,
+            .SourceStat = sourceStat,
+            .MetaStat = metaStat,
+        });
+        if (queue->SourceBytes >= kImportBatchSourceBytes)
+            flush(*queue);
     }
 
+    for (ImportBatchQueue& queue : queues)
+        flush(queue);
+
     out.Stats = stats;
     return ok;
 }
@@ -1,6 +1,9 @@
 #include <assets/cook/MeshCook.h>
 
 #include <assets/animation/AnimationClipSerializer.h>
+#include <assets/cook/MeshOptimize.h>
+#include <assets/cook/MeshSimplify.h>
+#include <assets/cook/MeshletBuild.h>
 #include <assets/skeleton/SkeletonSerializer.h>
 #include <assets/static_mesh/MeshSerializer.h>
 #include <core/hash/ContentHash.h>
@@ -1104,23 +1107,31 @@ ImportResult GltfMeshImporter::Import(const ImportInput& input, ICookOutputWrite
     // A skinned mesh emits a `.skmesh` (AssetType::SkinnedMesh) referencing
     // its skeleton; a static mesh emits a `.smesh` (AssetType::StaticMesh).
     // The kind is path-level — the extension and asset type distinguish them
-    // without reading the payload.
+    // without reading the payload. Both are put in GPU order and written in
+    // the quantized layout (MeshOptimize.h, MeshQuantization.h). Static
+    // meshes also get LOD chains (MeshSimplify.h); the skinned path draws
+    // full detail only, so skinned meshes carry none.
     MeshSerializer serializer(silentLogging);
     for (size_t meshIndex = 0; meshIndex < scene.Meshes.size(); ++meshIndex)
     {
         ImportedGltfMesh& mesh = scene.Meshes[meshIndex];
         const bool skinned = mesh.SkinIndex >= 0 && mesh.Skinning.has_value();
+        if (!skinned)
+            GenerateMeshLods(mesh.Geometry);
+        OptimizeMeshForGpu(mesh.Geometry, skinned ? &*mesh.Skinning : nullptr);
+        if (!skinned)
+            BuildMeshlets(mesh.Geometry);
 
         std::vector<std::byte> meshBytes;
         if (skinned)
         {
             mesh.Skinning->SkeletonPath = skeletonPaths[mesh.SkinIndex];
             SkinnedMeshData skinnedData{ std::move(mesh.Geometry), std::move(*mesh.Skinning) };
-            if (!serializer.WriteSkinnedToBytes(skinnedData, meshBytes))
+            if (!serializer.WriteSkinnedToBytes(skinnedData, meshBytes, SmeshVertexLayout::Quantized))
                 return ImportResult{ .Error = std::format(
                     "gltf import: .skmesh serialization failed for mesh {}", meshIndex) };
         }
-        else if (!serializer.WriteToBytes(mesh.Geometry, meshBytes))
+        else if (!serializer.WriteToBytes(mesh.Geometry, meshBytes, SmeshVertexLayout::Quantized))
         {
             return ImportResult{ .Error = std::format(
                 "gltf import: .smesh serialization failed for mesh {}", meshIndex) };
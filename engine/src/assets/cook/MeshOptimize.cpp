@@ -0,0 +1,424 @@
+#include <assets/cook/MeshOptimize.h>
+
+#include <render/static_mesh/MeshValidation.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+namespace
+{
+    // Forsyth's published tuning: a 32-entry LRU model, the last triangle's
+    // vertices scored flat, and a valence boost that finishes off vertices
+    // with few triangles left before they fall out of the cache.
+    constexpr uint32_t kForsythCacheSize = 32;
+    constexpr float kCacheDecayPower = 1.5f;
+    constexpr float kLastTriangleScore = 0.75f;
+    constexpr float kValenceBoostScale = 2.0f;
+    constexpr float kValenceBoostPower = 0.5f;
+
+    // The cache the overdraw pass measures against, and how much worse than
+    // its hard cluster a soft cluster may run before the pass cuts there.
+    constexpr uint32_t kFifoCacheSize = 16;
+    constexpr double kOverdrawThreshold = 1.05;
+
+    constexpr uint32_t kNoTriangle = std::numeric_limits<uint32_t>::max();
+
+    float ForsythVertexScore(int cachePosition, uint32_t remaining)
+    {
+        if (remaining == 0)
+            return -1.0f;
+
+        float score = 0.0f;
+        if (cachePosition >= 0)
+        {
+            if (cachePosition < 3)
+            {
+                score = kLastTriangleScore;
+            }
+            else
+            {
+                const float scaler = 1.0f / static_cast<float>(kForsythCacheSize - 3);
+                score = std::pow(1.0f - static_cast<float>(cachePosition - 3) * scaler, kCacheDecayPower);
+            }
+        }
+        return score + kValenceBoostScale * std::pow(static_cast<float>(remaining), -kValenceBoostPower);
+    }
+
+    // `indices` reference vertices 0..vertexCount-1; returns the same
+    // triangles in cache order, each with its corners in their own order.
+    std::vector<uint32_t> OrderForVertexCache(std::span<const uint32_t> indices, uint32_t vertexCount)
+    {
+        const size_t triangleCount = indices.size() / 3;
+
+        // Triangles per vertex, CSR; the first Remaining[v] of a vertex's
+        // slots are the triangles not yet emitted.
+        std::vector<uint32_t> remaining(vertexCount, 0);
+        for (uint32_t vertex : indices)
+            ++remaining[vertex];
+        std::vector<uint32_t> offsets(size_t(vertexCount) + 1, 0);
+        for (uint32_t vertex = 0; vertex < vertexCount; ++vertex)
+            offsets[vertex + 1] = offsets[vertex] + remaining[vertex];
+        std::vector<uint32_t> adjacency(indices.size());
+        {
+            std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+            for (size_t corner = 0; corner < indices.size(); ++corner)
+                adjacency[fill[indices[corner]]++] = static_cast<uint32_t>(corner / 3);
+        }
+
+        std::vector<int> cachePosition(vertexCount, -1);
+        std::vector<float> vertexScore(vertexCount);
+        for (uint32_t vertex = 0; vertex < vertexCount; ++vertex)
+            vertexScore[vertex] = ForsythVertexScore(-1, remaining[vertex]);
+
+        std::vector<float> triangleScore(triangleCount);
+        std::vector<bool> emitted(triangleCount, false);
+        uint32_t best = kNoTriangle;
+        for (size_t triangle = 0; triangle < triangleCount; ++triangle)
+        {
+            triangleScore[triangle] = vertexScore[indices[triangle * 3]]
+                + vertexScore[indices[triangle * 3 + 1]]
+                + vertexScore[indices[triangle * 3 + 2]];
+            if (best == kNoTriangle || triangleScore[triangle] > triangleScore[best])
+                best = static_cast<uint32_t>(triangle);
+        }
+
+        std::vector<uint32_t> cache;
+        std::vector<uint32_t> nextCache;
+        cache.reserve(kForsythCacheSize + 3);
+        nextCache.reserve(kForsythCacheSize + 3);
+
+        std::vector<uint32_t> out;
+        out.reserve(indices.size());
+        size_t cursor = 0;
+        while (out.size() < indices.size())
+        {
+            if (best == kNoTriangle)
+            {
+                // Nothing in the cache has work left: restart at the next
+                // triangle in input order.
+                while (emitted[cursor])
+                    ++cursor;
+                best = static_cast<uint32_t>(cursor);
+            }
+
+            emitted[best] = true;
+            const uint32_t corners[3] = { indices[best * 3], indices[best * 3 + 1], indices[best * 3 + 2] };
+            for (uint32_t vertex : corners)
+            {
+                out.push_back(vertex);
+                uint32_t* live = adjacency.data() + offsets[vertex];
+                uint32_t* liveEnd = live + remaining[vertex];
+                uint32_t* found = std::find(live, liveEnd, best);
+                if (found != liveEnd)
+                {
+                    std::swap(*found, *(liveEnd - 1));
+                    --remaining[vertex];
+                }
+            }
+
+            // LRU: the triangle's corners to the front, the rest shifted
+            // back, anything pushed past the end evicted.
+            nextCache.assign(std::begin(corners), std::end(corners));
+            for (uint32_t vertex : cache)
+            {
+                if (vertex != corners[0] && vertex != corners[1] && vertex != corners[2])
+                    nextCache.push_back(vertex);
+            }
+            for (size_t slot = 0; slot < nextCache.size(); ++slot)
+                cachePosition[nextCache[slot]] = slot < kForsythCacheSize ? static_cast<int>(slot) : -1;
+
+            // Rescore everything that moved, and the triangles it touches.
+            for (uint32_t vertex : nextCache)
+            {
+                const float score = ForsythVertexScore(cachePosition[vertex], remaining[vertex]);
+                const float delta = score - vertexScore[vertex];
+                vertexScore[vertex] = score;
+                for (uint32_t slot = 0; slot < remaining[vertex]; ++slot)
+                    triangleScore[adjacency[offsets[vertex] + slot]] += delta;
+            }
+            if (nextCache.size() > kForsythCacheSize)
+                nextCache.resize(kForsythCacheSize);
+            cache.swap(nextCache);
+
+            best = kNoTriangle;
+            float bestScore = 0.0f;
+            for (uint32_t vertex : cache)
+            {
+                for (uint32_t slot = 0; slot < remaining[vertex]; ++slot)
+                {
+                    const uint32_t triangle = adjacency[offsets[vertex] + slot];
+                    if (best == kNoTriangle || triangleScore[triangle] > bestScore)
+                    {
+                        best = triangle;
+                        bestScore = triangleScore[triangle];
+                    }
+                }
+            }
+        }
+        return out;
+    }
+
+    // FIFO post-transform cache model: a vertex misses unless it was one of
+    // the last `Size` misses. Reset is a time jump, not a clear.
+    class FifoCache
+    {
+    public:
+        FifoCache(uint32_t vertexCount, uint32_t size)
+            : Stamps(vertexCount, 0)
+            , Size(size)
+            , Time(size + 1)
+        {
+        }
+
+        uint32_t Misses(const uint32_t* triangle)
+        {
+            uint32_t misses = 0;
+            for (int corner = 0; corner < 3; ++corner)
+            {
+                const uint32_t vertex = triangle[corner];
+                if (Time - Stamps[vertex] > Size)
+                {
+                    Stamps[vertex] = Time++;
+                    ++misses;
+                }
+            }
+            return misses;
+        }
+
+        void Reset()
+        {
+            Time += Size + 1;
+        }
+
+    private:
+        std::vector<uint64_t> Stamps;
+        uint64_t Size = 0;
+        uint64_t Time = 0;
+    };
+
+    // Cuts the cache-ordered `indices` into clusters and draws the ones
+    // facing away from the centre first. Positions are `vertices[local]`.
+    void OrderForOverdraw(std::vector<uint32_t>& indices, std::span<const StaticMeshVertex> vertices)
+    {
+        const uint32_t triangleCount = static_cast<uint32_t>(indices.size() / 3);
+        if (triangleCount < 2)
+            return;
+
+        const uint32_t vertexCount = static_cast<uint32_t>(vertices.size());
+        FifoCache cache(vertexCount, kFifoCacheSize);
+
+        // Hard boundaries: where the cache order restarted, all three
+        // corners miss -- cutting there costs nothing.
+        std::vector<uint32_t> hard{ 0 };
+        for (uint32_t triangle = 0; triangle < triangleCount; ++triangle)
+        {
+            if (cache.Misses(&indices[triangle * 3]) == 3 && triangle > 0)
+                hard.push_back(triangle);
+        }
+        hard.push_back(triangleCount);
+
+        // Soft boundaries: within a hard cluster, cut once the running miss
+        // ratio has come down to the cluster's own (within the threshold).
+        std::vector<uint32_t> starts;
+        for (size_t cluster = 0; cluster + 1 < hard.size(); ++cluster)
+        {
+            const uint32_t begin = hard[cluster];
+            const uint32_t end = hard[cluster + 1];
+
+            cache.Reset();
+            uint32_t clusterMisses = 0;
+            for (uint32_t triangle = begin; triangle < end; ++triangle)
+                clusterMisses += cache.Misses(&indices[triangle * 3]);
+            const double target = kOverdrawThreshold * clusterMisses / double(end - begin);
+
+            cache.Reset();
+            starts.push_back(begin);
+            uint32_t runningMisses = 0;
+            uint32_t runningTriangles = 0;
+            for (uint32_t triangle = begin; triangle + 1 < end; ++triangle)
+            {
+                runningMisses += cache.Misses(&indices[triangle * 3]);
+                ++runningTriangles;
+                if (double(runningMisses) / runningTriangles <= target)
+                {
+                    starts.push_back(triangle + 1);
+                    cache.Reset();
+                    runningMisses = 0;
+                    runningTriangles = 0;
+                }
+            }
+        }
+        starts.push_back(triangleCount);
+        if (starts.size() <= 2)
+            return;
+
+        Vec3d centre(0.0f, 0.0f, 0.0f);
+        for (const StaticMeshVertex& vertex : vertices)
+            centre += vertex.Position;
+        centre = centre / static_cast<float>(vertexCount);
+
+        struct Cluster
+        {
+            uint32_t Begin = 0;
+            uint32_t End = 0;
+            float Key = 0.0f;
+        };
+        std::vector<Cluster> clusters;
+        clusters.reserve(starts.size() - 1);
+        for (size_t cluster = 0; cluster + 1 < starts.size(); ++cluster)
+        {
+            Vec3d centroid(0.0f, 0.0f, 0.0f);
+            Vec3d normal(0.0f, 0.0f, 0.0f);
+            float area = 0.0f;
+            for (uint32_t triangle = starts[cluster]; triangle < starts[cluster + 1]; ++triangle)
+            {
+                const Vec3d& a = vertices[indices[triangle * 3]].Position;
+                const Vec3d& b = vertices[indices[triangle * 3 + 1]].Position;
+                const Vec3d& c = vertices[indices[triangle * 3 + 2]].Position;
+                const Vec3d cross = (b - a).Cross(c - a);
+                const float twiceArea = cross.Magnitude();
+                centroid += (a + b + c) * (twiceArea / 3.0f);
+                normal += cross;
+                area += twiceArea;
+            }
+            if (area > 0.0f)
+                centroid = centroid / area;
+            const float normalLength = normal.Magnitude();
+            const float key = normalLength > 0.0f
+                ? (centroid - centre).Dot(normal) / normalLength
+                : 0.0f;
+            clusters.push_back({ .Begin = starts[cluster], .End = starts[cluster + 1], .Key = key });
+        }
+
+        std::stable_sort(clusters.begin(), clusters.end(),
+                         [](const Cluster& a, const Cluster& b) { return a.Key > b.Key; });
+
+        std::vector<uint32_t> ordered;
+        ordered.reserve(indices.size());
+        for (const Cluster& cluster : clusters)
+            ordered.insert(ordered.end(), indices.begin() + cluster.Begin * 3, indices.begin() + cluster.End * 3);
+        indices.swap(ordered);
+    }
+
+    bool SectionVertexRangesAreDisjoint(std::span<const StaticMeshSection> sections)
+    {
+        std::vector<const StaticMeshSection*> byOffset;
+        for (const StaticMeshSection& section : sections)
+            byOffset.push_back(&section);
+        std::sort(byOffset.begin(), byOffset.end(), [](const StaticMeshSection* a, const StaticMeshSection* b)
+        {
+            return a->VertexOffset < b->VertexOffset;
+        });
+        for (size_t index = 1; index < byOffset.size(); ++index)
+        {
+            if (uint64_t(byOffset[index - 1]->VertexOffset) + byOffset[index - 1]->VertexCount
+                > byOffset[index]->VertexOffset)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+double ComputeVertexCacheAcmr(std::span<const uint32_t> indices, uint32_t cacheSize)
+{
+    const size_t triangleCount = indices.size() / 3;
+    if (triangleCount == 0)
+        return 0.0;
+
+    const uint32_t vertexCount = indices.empty() ? 0 : *std::max_element(indices.begin(), indices.end()) + 1;
+    FifoCache cache(vertexCount, cacheSize);
+    uint64_t misses = 0;
+    for (size_t triangle = 0; triangle < triangleCount; ++triangle)
+        misses += cache.Misses(&indices[triangle * 3]);
+    return static_cast<double>(misses) / static_cast<double>(triangleCount);
+}
+
+MeshOptimizeStats OptimizeMeshForGpu(MeshGeometry& mesh, MeshSkinning* skinning)
+{
+    MeshOptimizeStats stats;
+    stats.AcmrBefore = ComputeVertexCacheAcmr(mesh.Indices);
+    stats.AcmrAfter = stats.AcmrBefore;
+    // Section ranges are trusted below; a mesh the serializer would reject
+    // anyway is left for it to report.
+    if (!ValidateMeshGeometry(mesh).IsValid()
+        || (skinning != nullptr && skinning->Influences.size() != mesh.Vertices.size()))
+    {
+        return stats;
+    }
+
+    std::vector<uint32_t> local;
+    const auto orderRange = [&](const StaticMeshSection& section, uint32_t indexOffset, uint32_t indexCount)
+    {
+        if (indexCount % 3 != 0)
+            return;
+        const auto first = mesh.Indices.begin() + indexOffset;
+        local.assign(first, first + indexCount);
+        for (uint32_t& index : local)
+            index -= section.VertexOffset;
+
+        local = OrderForVertexCache(local, section.VertexCount);
+        OrderForOverdraw(local, std::span<const StaticMeshVertex>(
+                                    mesh.Vertices.data() + section.VertexOffset, section.VertexCount));
+
+        for (size_t corner = 0; corner < local.size(); ++corner)
+            mesh.Indices[indexOffset + corner] = local[corner] + section.VertexOffset;
+    };
+    for (const StaticMeshSection& section : mesh.Sections)
+    {
+        orderRange(section, section.IndexOffset, section.IndexCount);
+        for (const StaticMeshLod& lod : section.Lods)
+            orderRange(section, lod.IndexOffset, lod.IndexCount);
+    }
+
+    if (SectionVertexRangesAreDisjoint(mesh.Sections))
+    {
+        // New position of each old vertex: first use within its section's
+        // index range, then the range's unreferenced vertices in their old
+        // order. Vertices outside every range stay put.
+        constexpr uint32_t kUnplaced = std::numeric_limits<uint32_t>::max();
+        std::vector<uint32_t> remap(mesh.Vertices.size(), kUnplaced);
+        for (const StaticMeshSection& section : mesh.Sections)
+        {
+            uint32_t next = section.VertexOffset;
+            for (uint32_t index = section.IndexOffset; index < section.IndexOffset + section.IndexCount; ++index)
+            {
+                uint32_t& target = remap[mesh.Indices[index]];
+                if (target == kUnplaced)
+                    target = next++;
+            }
+            for (uint32_t vertex = section.VertexOffset; vertex < section.VertexOffset + section.VertexCount; ++vertex)
+            {
+                if (remap[vertex] == kUnplaced)
+                    remap[vertex] = next++;
+            }
+        }
+        for (uint32_t vertex = 0; vertex < remap.size(); ++vertex)
+        {
+            if (remap[vertex] == kUnplaced)
+                remap[vertex] = vertex;
+        }
+
+        std::vector<StaticMeshVertex> vertices(mesh.Vertices.size());
+        for (size_t vertex = 0; vertex < remap.size(); ++vertex)
+            vertices[remap[vertex]] = mesh.Vertices[vertex];
+        mesh.Vertices.swap(vertices);
+        if (skinning != nullptr)
+        {
+            std::vector<MeshSkinInfluence> influences(skinning->Influences.size());
+            for (size_t vertex = 0; vertex < remap.size(); ++vertex)
+                influences[remap[vertex]] = skinning->Influences[vertex];
+            skinning->Influences.swap(influences);
+        }
+        for (uint32_t& index : mesh.Indices)
+            index = remap[index];
+        stats.FetchReordered = true;
+    }
+
+    stats.AcmrAfter = ComputeVertexCacheAcmr(mesh.Indices);
+    return stats;
+}
@@ -0,0 +1,610 @@
+#include <assets/cook/MeshSimplify.h>
+
+#include <render/static_mesh/MeshValidation.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <unordered_map>
+
+namespace
+{
+    // Border planes weigh this much per unit of squared edge length, against
+    // faces weighing their area: enough that an open edge holds its line.
+    constexpr double kBorderWeight = 10.0;
+    // A collapse may turn no remaining triangle further than this from its
+    // old facing (cosine, about 75 degrees).
+    constexpr float kMinNormalCosine = 0.25f;
+
+    constexpr uint32_t kNone = std::numeric_limits<uint32_t>::max();
+
+    // Symmetric 4x4 plane quadric, upper triangle, plus the weight it
+    // accumulated so costs read as mean squared distance.
+    struct Quadric
+    {
+        double A00 = 0.0, A01 = 0.0, A02 = 0.0, A11 = 0.0, A12 = 0.0, A22 = 0.0;
+        double B0 = 0.0, B1 = 0.0, B2 = 0.0;
+        double C = 0.0;
+        double Weight = 0.0;
+
+        void AddPlane(const Vec3d& normal, double distance, double weight)
+        {
+            const double x = normal.X;
+            const double y = normal.Y;
+            const double z = normal.Z;
+            A00 += weight * x * x;
+            A01 += weight * x * y;
+            A02 += weight * x * z;
+            A11 += weight * y * y;
+            A12 += weight * y * z;
+            A22 += weight * z * z;
+            B0 += weight * x * distance;
+            B1 += weight * y * distance;
+            B2 += weight * z * distance;
+            C += weight * distance * distance;
+            Weight += weight;
+        }
+
+        Quadric& operator+=(const Quadric& other)
+        {
+            A00 += other.A00;
+            A01 += other.A01;
+            A02 += other.A02;
+            A11 += other.A11;
+            A12 += other.A12;
+            A22 += other.A22;
+            B0 += other.B0;
+            B1 += other.B1;
+            B2 += other.B2;
+            C += other.C;
+            Weight += other.Weight;
+            return *this;
+        }
+
+        // Weighted sum of squared plane distances at `p`.
+        [[nodiscard]] double Evaluate(const Vec3d& p) const
+        {
+            const double x = p.X;
+            const double y = p.Y;
+            const double z = p.Z;
+            const double value = A00 * x * x + A11 * y * y + A22 * z * z
+                + 2.0 * (A01 * x * y + A02 * x * z + A12 * y * z)
+                + 2.0 * (B0 * x + B1 * y + B2 * z)
+                + C;
+            return std::max(value, 0.0);
+        }
+    };
+
+    // Exact position bits, with -0 folded onto +0.
+    struct PositionKey
+    {
+        uint32_t Bits[3]{};
+
+        explicit PositionKey(const Vec3d& position)
+        {
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                const float value = position[axis] + 0.0f;
+                std::memcpy(&Bits[axis], &value, sizeof(float));
+            }
+        }
+
+        bool operator==(const PositionKey&) const = default;
+    };
+
+    struct PositionKeyHash
+    {
+        std::size_t operator()(const PositionKey& key) const
+        {
+            uint64_t hash = 1469598103934665603ull;
+            for (uint32_t bits : key.Bits)
+                hash = (hash ^ bits) * 1099511628211ull;
+            return static_cast<std::size_t>(hash);
+        }
+    };
+
+    uint64_t EdgeKey(uint32_t a, uint32_t b)
+    {
+        return a < b ? (uint64_t(a) << 32) | b : (uint64_t(b) << 32) | a;
+    }
+
+    enum class VertexKind : uint8_t
+    {
+        Interior,
+        Border,
+        Locked,
+    };
+
+    class Simplifier
+    {
+    public:
+        // `pinned`, when not empty, holds one flag per vertex; flagged
+        // vertices never move.
+        Simplifier(std::span<const StaticMeshVertex> vertices,
+                   std::span<const uint32_t> indices,
+                   std::span<const uint8_t> pinned)
+            : Vertices(vertices)
+            , Current(indices.begin(), indices.end())
+            , PositionOf(vertices.size(), kNone)
+            , Remap(vertices.size(), kNone)
+            , Touched(vertices.size(), 0)
+            , Kind(vertices.size(), VertexKind::Locked)
+        {
+            std::unordered_map<PositionKey, uint32_t, PositionKeyHash> positions;
+            std::vector<uint32_t> firstWedge;
+            for (uint32_t vertex : Current)
+            {
+                if (PositionOf[vertex] != kNone)
+                    continue;
+                const auto [it, inserted] = positions.try_emplace(
+                    PositionKey(vertices[vertex].Position), static_cast<uint32_t>(firstWedge.size()));
+                PositionOf[vertex] = it->second;
+                if (inserted)
+                {
+                    firstWedge.push_back(vertex);
+                    Wedges.push_back(1);
+                }
+                else
+                {
+                    ++Wedges[it->second];
+                }
+            }
+            Pinned.assign(Wedges.size(), 0);
+            for (uint32_t position = 0; position < Wedges.size(); ++position)
+            {
+                if (!pinned.empty() && pinned[firstWedge[position]] != 0)
+                    Pinned[position] = 1;
+            }
+            for (std::size_t vertex = 0; vertex < vertices.size(); ++vertex)
+            {
+                if (!pinned.empty() && pinned[vertex] != 0 && PositionOf[vertex] != kNone)
+                    Pinned[PositionOf[vertex]] = 1;
+            }
+
+            Quadrics.assign(Wedges.size(), Quadric{});
+            for (std::size_t corner = 0; corner + 2 < Current.size(); corner += 3)
+            {
+                const Vec3d& a = Position(Current[corner]);
+                const Vec3d& b = Position(Current[corner + 1]);
+                const Vec3d& c = Position(Current[corner + 2]);
+                const Vec3d cross = (b - a).Cross(c - a);
+                const float twiceArea = cross.Magnitude();
+                if (!(twiceArea > 0.0f))
+                    continue;
+                const Vec3d normal = cross / twiceArea;
+                const double distance = -static_cast<double>(normal.Dot(a));
+                for (int k = 0; k < 3; ++k)
+                    Quadrics[PositionOf[Current[corner + k]]].AddPlane(normal, distance, 0.5 * twiceArea);
+            }
+
+            // Border planes: through each open edge, perpendicular to its
+            // triangle, so border vertices are held to their line.
+            BuildTopology();
+            for (std::size_t corner = 0; corner + 2 < Current.size(); corner += 3)
+            {
+                const Vec3d& a = Position(Current[corner]);
+                const Vec3d& b = Position(Current[corner + 1]);
+                const Vec3d& c = Position(Current[corner + 2]);
+                const Vec3d faceNormal = (b - a).Cross(c - a);
+                if (!(faceNormal.Magnitude() > 0.0f))
+                    continue;
+                for (int k = 0; k < 3; ++k)
+                {
+                    const uint32_t from = Current[corner + k];
+                    const uint32_t to = Current[corner + (k + 1) % 3];
+                    if (EdgeUses(from, to) != 1)
+                        continue;
+                    const Vec3d& p0 = Position(from);
+                    const Vec3d edge = Position(to) - p0;
+                    const float length = edge.Magnitude();
+                    const Vec3d plane = edge.Cross(faceNormal);
+                    const float planeLength = plane.Magnitude();
+                    if (!(length > 0.0f) || !(planeLength > 0.0f))
+                        continue;
+                    const Vec3d normal = plane / planeLength;
+                    const double distance = -static_cast<double>(normal.Dot(p0));
+                    const double weight = kBorderWeight * double(length) * double(length);
+                    Quadrics[PositionOf[from]].AddPlane(normal, distance, weight);
+                    Quadrics[PositionOf[to]].AddPlane(normal, distance, weight);
+                }
+            }
+        }
+
+        void Run(std::size_t targetIndexCount, float maxError)
+        {
+            const double maxCost = double(maxError) * double(maxError);
+            while (Current.size() > targetIndexCount)
+            {
+                BuildTopology();
+                if (!CollapsePass(targetIndexCount, maxCost))
+                    break;
+            }
+        }
+
+        [[nodiscard]] const std::vector<uint32_t>& Indices() const { return Current; }
+        [[nodiscard]] float Error() const { return static_cast<float>(std::sqrt(WorstCost)); }
+
+    private:
+        struct Candidate
+        {
+            double Cost = 0.0;
+            uint32_t From = kNone;
+            uint32_t To = kNone;
+        };
+
+        const Vec3d& Position(uint32_t vertex) const { return Vertices[vertex].Position; }
+
+        uint32_t EdgeUses(uint32_t a, uint32_t b) const
+        {
+            const uint64_t key = EdgeKey(PositionOf[a], PositionOf[b]);
+            const auto it = std::lower_bound(Edges.begin(), Edges.end(), key);
+            if (it == Edges.end() || *it != key)
+                return 0;
+            return static_cast<uint32_t>(std::upper_bound(it, Edges.end(), key) - it);
+        }
+
+        // Triangles around each vertex (CSR over Current), the sorted welded
+        // edge list, and each vertex's kind for this pass.
+        void BuildTopology()
+        {
+            const std::size_t vertexCount = Vertices.size();
+            Offsets.assign(vertexCount + 1, 0);
+            for (uint32_t vertex : Current)
+                ++Offsets[vertex + 1];
+            for (std::size_t vertex = 0; vertex < vertexCount; ++vertex)
+                Offsets[vertex + 1] += Offsets[vertex];
+            Around.resize(Current.size());
+            Fill.assign(Offsets.begin(), Offsets.end() - 1);
+            for (std::size_t corner = 0; corner < Current.size(); ++corner)
+                Around[Fill[Current[corner]]++] = static_cast<uint32_t>(corner / 3);
+
+            Edges.clear();
+            for (std::size_t corner = 0; corner + 2 < Current.size(); corner += 3)
+            {
+                for (int k = 0; k < 3; ++k)
+                    Edges.push_back(EdgeKey(PositionOf[Current[corner + k]],
+                                            PositionOf[Current[corner + (k + 1) % 3]]));
+            }
+            std::sort(Edges.begin(), Edges.end());
+
+            BorderEdges.assign(Wedges.size(), 0);
+            NonManifold.assign(Wedges.size(), 0);
+            for (std::size_t first = 0; first < Edges.size();)
+            {
+                std::size_t last = first + 1;
+                while (last < Edges.size() && Edges[last] == Edges[first])
+                    ++last;
+                const uint32_t a = static_cast<uint32_t>(Edges[first] >> 32);
+                const uint32_t b = static_cast<uint32_t>(Edges[first] & 0xFFFFFFFFu);
+                if (last - first == 1)
+                {
+                    ++BorderEdges[a];
+                    ++BorderEdges[b];
+                }
+                else if (last - first > 2)
+                {
+                    NonManifold[a] = 1;
+                    NonManifold[b] = 1;
+                }
+                first = last;
+            }
+
+            for (uint32_t vertex : Current)
+            {
+                const uint32_t position = PositionOf[vertex];
+                if (Wedges[position] != 1 || Pinned[position] != 0 || NonManifold[position] != 0)
+                    Kind[vertex] = VertexKind::Locked;
+                else if (BorderEdges[position] == 0)
+                    Kind[vertex] = VertexKind::Interior;
+                else if (BorderEdges[position] == 2)
+                    Kind[vertex] = VertexKind::Border;
+                else
+                    Kind[vertex] = VertexKind::Locked;
+            }
+        }
+
+        std::span<const uint32_t> TrianglesAround(uint32_t vertex) const
+        {
+            return { Around.data() + Offsets[vertex], Offsets[vertex + 1] - Offsets[vertex] };
+        }
+
+        bool Contains(uint32_t triangle, uint32_t vertex) const
+        {
+            return Current[triangle * 3] == vertex
+                || Current[triangle * 3 + 1] == vertex
+                || Current[triangle * 3 + 2] == vertex;
+        }
+
+        double CollapseCost(uint32_t from, uint32_t to) const
+        {
+            Quadric combined = Quadrics[PositionOf[from]];
+            combined += Quadrics[PositionOf[to]];
+            if (!(combined.Weight > 0.0))
+                return 0.0;
+            return combined.Evaluate(Position(to)) / combined.Weight;
+        }
+
+        // The welded neighbours `from` and `to` share must be exactly the
+        // apexes of the triangles on their edge, or the collapse pinches the
+        // surface into a non-manifold fin.
+        bool KeepsManifold(uint32_t from, uint32_t to, uint32_t sharedTriangles)
+        {
+            Neighbours.clear();
+            for (uint32_t triangle : TrianglesAround(from))
+            {
+                for (int k = 0; k < 3; ++k)
+                    Neighbours.push_back(PositionOf[Current[triangle * 3 + k]]);
+            }
+            std::sort(Neighbours.begin(), Neighbours.end());
+            Neighbours.erase(std::unique(Neighbours.begin(), Neighbours.end()), Neighbours.end());
+
+            OtherNeighbours.clear();
+            for (uint32_t triangle : TrianglesAround(to))
+            {
+                for (int k = 0; k < 3; ++k)
+                    OtherNeighbours.push_back(PositionOf[Current[triangle * 3 + k]]);
+            }
+            std::sort(OtherNeighbours.begin(), OtherNeighbours.end());
+            OtherNeighbours.erase(std::unique(OtherNeighbours.begin(), OtherNeighbours.end()),
+                                  OtherNeighbours.end());
+
+            uint32_t common = 0;
+            for (auto a = Neighbours.begin(), b = OtherNeighbours.begin();
+                 a != Neighbours.end() && b != OtherNeighbours.end();)
+            {
+                if (*a < *b)
+                    ++a;
+                else if (*b < *a)
+                    ++b;
+                else
+                {
+                    if (*a != PositionOf[from] && *a != PositionOf[to])
+                        ++common;
+                    ++a;
+                    ++b;
+                }
+            }
+            return common == sharedTriangles;
+        }
+
+        bool KeepsFacing(uint32_t from, uint32_t to) const
+        {
+            for (uint32_t triangle : TrianglesAround(from))
+            {
+                if (Contains(triangle, to))
+                    continue;
+                Vec3d before[3];
+                Vec3d after[3];
+                for (int k = 0; k < 3; ++k)
+                {
+                    const uint32_t vertex = Current[triangle * 3 + k];
+                    before[k] = Position(vertex);
+                    after[k] = vertex == from ? Position(to) : before[k];
+                }
+                const Vec3d oldNormal = (before[1] - before[0]).Cross(before[2] - before[0]);
+                const Vec3d newNormal = (after[1] - after[0]).Cross(after[2] - after[0]);
+                const float oldLength = oldNormal.Magnitude();
+                const float newLength = newNormal.Magnitude();
+                if (!(newLength > 0.0f))
+                    return false;
+                if (oldLength > 0.0f
+                    && oldNormal.Dot(newNormal) < kMinNormalCosine * oldLength * newLength)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // One round of independent collapses, cheapest first. Returns
+        // whether any was taken.
+        bool CollapsePass(std::size_t targetIndexCount, double maxCost)
+        {
+            Candidates.clear();
+            BestFor.assign(Vertices.size(), kNone);
+            const auto consider = [&](uint32_t from, uint32_t to)
+            {
+                if (Kind[from] == VertexKind::Locked || Wedges[PositionOf[to]] != 1)
+                    return;
+                if (Kind[from] == VertexKind::Border && EdgeUses(from, to) != 1)
+                    return;
+                const double cost = CollapseCost(from, to);
+                uint32_t& best = BestFor[from];
+                if (best == kNone)
+                {
+                    best = static_cast<uint32_t>(Candidates.size());
+                    Candidates.push_back({ .Cost = cost, .From = from, .To = to });
+                }
+                else if (cost < Candidates[best].Cost)
+                {
+                    Candidates[best] = { .Cost = cost, .From = from, .To = to };
+                }
+            };
+            for (std::size_t corner = 0; corner + 2 < Current.size(); corner += 3)
+            {
+                for (int k = 0; k < 3; ++k)
+                {
+                    const uint32_t a = Current[corner + k];
+                    const uint32_t b = Current[corner + (k + 1) % 3];
+                    consider(a, b);
+                    consider(b, a);
+                }
+            }
+            std::sort(Candidates.begin(), Candidates.end(), [](const Candidate& a, const Candidate& b)
+            {
+                return a.Cost != b.Cost ? a.Cost < b.Cost : a.From < b.From;
+            });
+
+            std::fill(Touched.begin(), Touched.end(), 0);
+            std::size_t triangles = Current.size() / 3;
+            const std::size_t targetTriangles = targetIndexCount / 3;
+            bool collapsed = false;
+            for (const Candidate& candidate : Candidates)
+            {
+                if (candidate.Cost > maxCost || triangles <= targetTriangles)
+                    break;
+                const uint32_t from = candidate.From;
+                const uint32_t to = candidate.To;
+                if (Touched[from] != 0 || Touched[to] != 0)
+                    continue;
+
+                uint32_t shared = 0;
+                for (uint32_t triangle : TrianglesAround(from))
+                {
+                    if (Contains(triangle, to))
+                        ++shared;
+                }
+                const uint32_t expected = Kind[from] == VertexKind::Border ? 1u : 2u;
+                if (shared != expected || !KeepsManifold(from, to, shared) || !KeepsFacing(from, to))
+                    continue;
+
+                Remap[from] = to;
+                for (uint32_t triangle : TrianglesAround(from))
+                {
+                    for (int k = 0; k < 3; ++k)
+                        Touched[Current[triangle * 3 + k]] = 1;
+                }
+                Quadrics[PositionOf[to]] += Quadrics[PositionOf[from]];
+                WorstCost = std::max(WorstCost, candidate.Cost);
+                triangles -= shared;
+                collapsed = true;
+            }
+            if (!collapsed)
+                return false;
+
+            std::size_t kept = 0;
+            for (std::size_t corner = 0; corner + 2 < Current.size(); corner += 3)
+            {
+                uint32_t corners[3];
+                for (int k = 0; k < 3; ++k)
+                {
+                    const uint32_t vertex = Current[corner + k];
+                    corners[k] = Remap[vertex] != kNone ? Remap[vertex] : vertex;
+                }
+                const uint32_t a = PositionOf[corners[0]];
+                const uint32_t b = PositionOf[corners[1]];
+                const uint32_t c = PositionOf[corners[2]];
+                if (a == b || b == c || a == c)
+                    continue;
+                for (int k = 0; k < 3; ++k)
+                    Current[kept++] = corners[k];
+            }
+            Current.resize(kept);
+            for (const Candidate& candidate : Candidates)
+                Remap[candidate.From] = kNone;
+            return true;
+        }
+
+        std::span<const StaticMeshVertex> Vertices;
+        std::vector<uint32_t> Current;
+
+        // Welded position of each referenced vertex, and per position the
+        // vertices sharing it, whether it is pinned, and its quadric.
+        std::vector<uint32_t> PositionOf;
+        std::vector<uint32_t> Wedges;
+        std::vector<uint8_t> Pinned;
+        std::vector<Quadric> Quadrics;
+
+        // Per-pass topology.
+        std::vector<uint32_t> Offsets;
+        std::vector<uint32_t> Fill;
+        std::vector<uint32_t> Around;
+        std::vector<uint64_t> Edges;
+        std::vector<uint32_t> BorderEdges;
+        std::vector<uint8_t> NonManifold;
+
+        // Per-pass scratch.
+        std::vector<uint32_t> Remap;
+        std::vector<uint8_t> Touched;
+        std::vector<VertexKind> Kind;
+        std::vector<Candidate> Candidates;
+        std::vector<uint32_t> BestFor;
+        std::vector<uint32_t> Neighbours;
+        std::vector<uint32_t> OtherNeighbours;
+
+        double WorstCost = 0.0;
+    };
+}
+
+std::vector<uint32_t> SimplifyTriangles(std::span<const StaticMeshVertex> vertices,
+                                        std::span<const uint32_t> indices,
+                                        std::size_t targetIndexCount,
+                                        float maxError,
+                                        float* outError)
+{
+    Simplifier simplifier(vertices, indices, {});
+    simplifier.Run(targetIndexCount, maxError);
+    if (outError != nullptr)
+        *outError = simplifier.Error();
+    return simplifier.Indices();
+}
+
+uint32_t GenerateMeshLods(MeshGeometry& mesh, const MeshLodSettings& settings)
+{
+    // Section ranges are trusted below; a mesh the serializer would reject
+    // anyway is left for it to report.
+    if (!ValidateMeshGeometry(mesh).IsValid())
+        return 0;
+
+    // Positions more than one section draws are pinned in all of them.
+    constexpr uint32_t kShared = kNone - 1;
+    std::unordered_map<PositionKey, uint32_t, PositionKeyHash> owner;
+    for (uint32_t sectionIndex = 0; sectionIndex < mesh.Sections.size(); ++sectionIndex)
+    {
+        const StaticMeshSection& section = mesh.Sections[sectionIndex];
+        for (uint32_t index = section.IndexOffset; index < section.IndexOffset + section.IndexCount; ++index)
+        {
+            const auto [it, inserted] = owner.try_emplace(
+                PositionKey(mesh.Vertices[mesh.Indices[index]].Position), sectionIndex);
+            if (!inserted && it->second != sectionIndex)
+                it->second = kShared;
+        }
+    }
+    std::vector<uint8_t> pinned(mesh.Vertices.size(), 0);
+    for (std::size_t vertex = 0; vertex < mesh.Vertices.size(); ++vertex)
+    {
+        const auto it = owner.find(PositionKey(mesh.Vertices[vertex].Position));
+        if (it != owner.end() && it->second == kShared)
+            pinned[vertex] = 1;
+    }
+
+    const uint32_t maxLods = std::min<uint32_t>(settings.MaxLods, static_cast<uint32_t>(kMaxMeshLods));
+    uint32_t built = 0;
+    for (StaticMeshSection& section : mesh.Sections)
+    {
+        if (!section.Lods.empty() || section.IndexCount / 3 < settings.MinTriangles)
+            continue;
+
+        const std::vector<uint32_t> base(mesh.Indices.begin() + section.IndexOffset,
+                                         mesh.Indices.begin() + section.IndexOffset + section.IndexCount);
+        Simplifier simplifier(mesh.Vertices, base, pinned);
+        const float budget =
+            settings.MaxRelativeError * ComputeMeshSectionBounds(mesh, section).Size().Magnitude();
+
+        std::size_t previous = base.size();
+        for (uint32_t level = 0; level < maxLods; ++level)
+        {
+            const std::size_t target =
+                static_cast<std::size_t>(static_cast<double>(previous / 3) * settings.TriangleRatio) * 3;
+            simplifier.Run(target, budget);
+            const std::vector<uint32_t>& simplified = simplifier.Indices();
+            if (simplified.empty()
+                || static_cast<double>(simplified.size())
+                       > static_cast<double>(previous) * (1.0 - settings.MinReduction))
+            {
+                break;
+            }
+
+            section.Lods.push_back(StaticMeshLod{
+                .IndexOffset = static_cast<uint32_t>(mesh.Indices.size()),
+                .IndexCount = static_cast<uint32_t>(simplified.size()),
+                .Error = simplifier.Error(),
+            });
+            mesh.Indices.insert(mesh.Indices.end(), simplified.begin(), simplified.end());
+            previous = simplified.size();
+            ++built;
+        }
+    }
+    return built;
+}
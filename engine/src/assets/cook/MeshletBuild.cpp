@@ -0,0 +1,318 @@
+#include <assets/cook/MeshletBuild.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    constexpr uint32_t kNoTriangle = std::numeric_limits<uint32_t>::max();
+
+    // Exact position bits, with -0 folded onto +0.
+    struct PositionKey
+    {
+        uint32_t Bits[3]{};
+
+        explicit PositionKey(const Vec3d& position)
+        {
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                const float value = position[axis] + 0.0f;
+                std::memcpy(&Bits[axis], &value, sizeof(float));
+            }
+        }
+
+        bool operator==(const PositionKey&) const = default;
+    };
+
+    struct PositionKeyHash
+    {
+        std::size_t operator()(const PositionKey& key) const
+        {
+            uint64_t hash = 1469598103934665603ull;
+            for (uint32_t bits : key.Bits)
+                hash = (hash ^ bits) * 1099511628211ull;
+            return static_cast<std::size_t>(hash);
+        }
+    };
+
+    // Unit geometric normal in winding order; zero for a degenerate triangle.
+    Vec3d TriangleNormal(const Vec3d& a, const Vec3d& b, const Vec3d& c)
+    {
+        const Vec3d cross = (b - a).Cross(c - a);
+        const float length = cross.Magnitude();
+        if (!(length > 0.0f) || !std::isfinite(length))
+            return Vec3d::Zero();
+        return cross / length;
+    }
+
+    StaticMeshMeshlet BoundMeshlet(const MeshGeometry& mesh,
+                                   std::span<const uint32_t> indices,
+                                   uint32_t indexOffset)
+    {
+        StaticMeshMeshlet meshlet{
+            .IndexOffset = indexOffset,
+            .IndexCount = static_cast<uint32_t>(indices.size()),
+        };
+
+        Aabb3d box = Aabb3d::Empty();
+        for (uint32_t vertex : indices)
+            box.ExpandToInclude(mesh.Vertices[vertex].Position);
+        meshlet.Center = box.Center();
+        float radiusSquared = 0.0f;
+        for (uint32_t vertex : indices)
+            radiusSquared = std::max(radiusSquared,
+                                     Vec3d::SqrDistance(mesh.Vertices[vertex].Position, meshlet.Center));
+        meshlet.Radius = std::sqrt(radiusSquared);
+
+        Vec3d normalSum = Vec3d::Zero();
+        for (std::size_t corner = 0; corner + 2 < indices.size(); corner += 3)
+        {
+            normalSum += TriangleNormal(mesh.Vertices[indices[corner]].Position,
+                                        mesh.Vertices[indices[corner + 1]].Position,
+                                        mesh.Vertices[indices[corner + 2]].Position);
+        }
+        const float sumLength = normalSum.Magnitude();
+        if (!(sumLength > 0.0f))
+            return meshlet;
+
+        const Vec3d axis = normalSum / sumLength;
+        float cutoff = 1.0f;
+        for (std::size_t corner = 0; corner + 2 < indices.size(); corner += 3)
+        {
+            const Vec3d normal = TriangleNormal(mesh.Vertices[indices[corner]].Position,
+                                                mesh.Vertices[indices[corner + 1]].Position,
+                                                mesh.Vertices[indices[corner + 2]].Position);
+            if (normal.SqrMagnitude() > 0.0f)
+                cutoff = std::min(cutoff, axis.Dot(normal));
+        }
+        // Past a hemisphere some triangle faces every eye: no cone to test.
+        if (cutoff > 0.0f)
+        {
+            meshlet.ConeAxis = axis;
+            meshlet.ConeCutoff = cutoff;
+        }
+        return meshlet;
+    }
+
+    // One section's base range, reordered in place into meshlets.
+    class SectionClusterer
+    {
+    public:
+        SectionClusterer(MeshGeometry& mesh, StaticMeshSection& section,
+                         const MeshletLimits& limits, std::vector<uint32_t>& vertexStamp)
+            : Mesh(mesh)
+            , Section(section)
+            , Limits(limits)
+            , Base(mesh.Indices.data() + section.IndexOffset, section.IndexCount)
+            , TriangleCount(section.IndexCount / 3)
+            , VertexStamp(vertexStamp)
+        {
+            std::vector<uint32_t> cornerPosition(Base.size());
+            {
+                std::unordered_map<PositionKey, uint32_t, PositionKeyHash> positions;
+                for (std::size_t corner = 0; corner < Base.size(); ++corner)
+                {
+                    const auto [it, inserted] = positions.try_emplace(
+                        PositionKey(mesh.Vertices[Base[corner]].Position),
+                        static_cast<uint32_t>(positions.size()));
+                    cornerPosition[corner] = it->second;
+                }
+                PositionCount = static_cast<uint32_t>(positions.size());
+            }
+
+            // Triangles per position, CSR.
+            AdjacencyOffsets.assign(std::size_t(PositionCount) + 1, 0);
+            for (uint32_t position : cornerPosition)
+                ++AdjacencyOffsets[position + 1];
+            for (uint32_t position = 0; position < PositionCount; ++position)
+                AdjacencyOffsets[position + 1] += AdjacencyOffsets[position];
+            Adjacency.resize(Base.size());
+            {
+                std::vector<uint32_t> fill(AdjacencyOffsets.begin(), AdjacencyOffsets.end() - 1);
+                for (std::size_t corner = 0; corner < Base.size(); ++corner)
+                    Adjacency[fill[cornerPosition[corner]]++] = static_cast<uint32_t>(corner / 3);
+            }
+            CornerPosition = std::move(cornerPosition);
+
+            Centroids.resize(TriangleCount);
+            Normals.resize(TriangleCount);
+            for (uint32_t triangle = 0; triangle < TriangleCount; ++triangle)
+            {
+                const Vec3d& a = Corner(triangle, 0);
+                const Vec3d& b = Corner(triangle, 1);
+                const Vec3d& c = Corner(triangle, 2);
+                Centroids[triangle] = (a + b + c) / 3.0f;
+                Normals[triangle] = TriangleNormal(a, b, c);
+            }
+            Claimed.assign(TriangleCount, 0);
+            CandidateStamp.assign(TriangleCount, 0);
+        }
+
+        uint32_t Run()
+        {
+            std::vector<uint32_t> ordered;
+            ordered.reserve(Base.size());
+            uint32_t built = 0;
+            for (uint32_t seed = 0; seed < TriangleCount; ++seed)
+            {
+                if (Claimed[seed] != 0)
+                    continue;
+                const std::size_t start = ordered.size();
+                Grow(seed, ordered);
+                const std::span<const uint32_t> slice(ordered.data() + start, ordered.size() - start);
+                Section.Meshlets.push_back(BoundMeshlet(
+                    Mesh, slice, Section.IndexOffset + static_cast<uint32_t>(start)));
+                ++built;
+            }
+            std::copy(ordered.begin(), ordered.end(), Base.begin());
+            return built;
+        }
+
+    private:
+        const Vec3d& Corner(uint32_t triangle, uint32_t k) const
+        {
+            return Mesh.Vertices[Base[triangle * 3 + k]].Position;
+        }
+
+        // Vertices `triangle` would add to the current meshlet.
+        uint32_t NewVertices(uint32_t triangle) const
+        {
+            const uint32_t* corners = Base.data() + std::size_t(triangle) * 3;
+            uint32_t added = 0;
+            for (uint32_t k = 0; k < 3; ++k)
+            {
+                if (VertexStamp[corners[k]] == Stamp)
+                    continue;
+                if ((k > 0 && corners[k] == corners[0]) || (k > 1 && corners[k] == corners[1]))
+                    continue;
+                ++added;
+            }
+            return added;
+        }
+
+        void Take(uint32_t triangle, std::vector<uint32_t>& ordered)
+        {
+            MeshletVertices += NewVertices(triangle);
+            Claimed[triangle] = 1;
+            ++MeshletTriangles;
+            CentroidSum += Centroids[triangle];
+            NormalSum += Normals[triangle];
+            for (uint32_t k = 0; k < 3; ++k)
+            {
+                const uint32_t vertex = Base[std::size_t(triangle) * 3 + k];
+                VertexStamp[vertex] = Stamp;
+                ordered.push_back(vertex);
+
+                const uint32_t position = CornerPosition[std::size_t(triangle) * 3 + k];
+                for (uint32_t slot = AdjacencyOffsets[position]; slot < AdjacencyOffsets[position + 1]; ++slot)
+                {
+                    const uint32_t neighbour = Adjacency[slot];
+                    if (Claimed[neighbour] != 0 || CandidateStamp[neighbour] == Stamp)
+                        continue;
+                    CandidateStamp[neighbour] = Stamp;
+                    Candidates.push_back(neighbour);
+                }
+            }
+        }
+
+        void Grow(uint32_t seed, std::vector<uint32_t>& ordered)
+        {
+            ++Stamp;
+            MeshletVertices = 0;
+            MeshletTriangles = 0;
+            CentroidSum = Vec3d::Zero();
+            NormalSum = Vec3d::Zero();
+            Candidates.clear();
+            Take(seed, ordered);
+
+            while (MeshletTriangles < Limits.MaxTriangles)
+            {
+                const Vec3d centre = CentroidSum / static_cast<float>(MeshletTriangles);
+                const float normalLength = NormalSum.Magnitude();
+                const Vec3d facing = normalLength > 0.0f ? NormalSum / normalLength : Vec3d::Zero();
+
+                uint32_t best = kNoTriangle;
+                uint32_t bestAdded = 4;
+                float bestScore = std::numeric_limits<float>::max();
+                for (std::size_t slot = 0; slot < Candidates.size();)
+                {
+                    const uint32_t triangle = Candidates[slot];
+                    if (Claimed[triangle] != 0)
+                    {
+                        Candidates[slot] = Candidates.back();
+                        Candidates.pop_back();
+                        continue;
+                    }
+                    ++slot;
+
+                    const uint32_t added = NewVertices(triangle);
+                    if (MeshletVertices + added > Limits.MaxVertices || added > bestAdded)
+                        continue;
+                    // Near and facing the same way: a tight sphere and a
+                    // narrow cone are what make the meshlet cullable.
+                    const float score = Vec3d::Distance(Centroids[triangle], centre)
+                                        * (2.0f - facing.Dot(Normals[triangle]));
+                    if (added < bestAdded || score < bestScore)
+                    {
+                        best = triangle;
+                        bestAdded = added;
+                        bestScore = score;
+                    }
+                }
+                if (best == kNoTriangle)
+                    break;
+                Take(best, ordered);
+            }
+        }
+
+        MeshGeometry& Mesh;
+        StaticMeshSection& Section;
+        const MeshletLimits& Limits;
+        std::span<uint32_t> Base;
+        uint32_t TriangleCount = 0;
+        uint32_t PositionCount = 0;
+
+        std::vector<uint32_t> CornerPosition;
+        std::vector<uint32_t> AdjacencyOffsets;
+        std::vector<uint32_t> Adjacency;
+        std::vector<Vec3d> Centroids;
+        std::vector<Vec3d> Normals;
+        std::vector<uint8_t> Claimed;
+
+        // Membership by generation: a vertex or candidate belongs to the
+        // meshlet being grown when its stamp equals Stamp.
+        std::vector<uint32_t>& VertexStamp;
+        std::vector<uint32_t> CandidateStamp;
+        uint32_t Stamp = 0;
+
+        std::vector<uint32_t> Candidates;
+        uint32_t MeshletVertices = 0;
+        uint32_t MeshletTriangles = 0;
+        Vec3d CentroidSum;
+        Vec3d NormalSum;
+    };
+}
+
+uint32_t BuildMeshlets(MeshGeometry& mesh, const MeshletLimits& limits)
+{
+    if (limits.MaxVertices < 3 || limits.MaxTriangles == 0)
+        return 0;
+
+    std::vector<uint32_t> vertexStamp(mesh.Vertices.size(), 0);
+    uint32_t built = 0;
+    for (StaticMeshSection& section : mesh.Sections)
+    {
+        if (!section.Meshlets.empty() || section.IndexCount < 3)
+            continue;
+        // Stamps restart per section; clearing keeps a stale stamp from a
+        // shared vertex looking like a member of the new section's meshlets.
+        std::fill(vertexStamp.begin(), vertexStamp.end(), 0u);
+        built += SectionClusterer(mesh, section, limits, vertexStamp).Run();
+    }
+    return built;
+}
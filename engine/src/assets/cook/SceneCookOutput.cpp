@@ -4,42 +4,55 @@
 #include <core/assets/AssetManifest.h>
 #include <core/hash/ContentHash.h>
 #include <core/json/JsonParser.h>
-#include <core/json/JsonStringify.h>
 #include <core/json/JsonValue.h>
+#include <core/logging/LoggingProvider.h>
+#include <core/serialization/BinaryReader.h>
+#include <core/serialization/BinaryWriter.h>
+#include <world/serialization/SceneSerializer.h>
+#include <zone/ZonePackageSceneLoader.h>
 
+#include <cstddef>
 #include <cstdint>
 #include <fstream>
-#include <optional>
 #include <sstream>
+#include <span>
 #include <unordered_set>
 #include <vector>
 
 namespace
 {
-    std::optional<JsonValue> ParseJsonFile(const std::filesystem::path& path, std::string* error)
+    // A .smat is read only for its refs, so it streams through the reader
+    // rather than becoming a DOM.
+    bool CollectFileAssetPaths(const std::filesystem::path& path,
+                               std::vector<std::string>& out,
+                               std::string* error)
     {
         std::ifstream file(path);
         if (!file.is_open())
         {
             if (error)
                 *error = "WriteCookedScene: could not open '" + path.generic_string() + "'";
-            return std::nullopt;
+            return false;
         }
 
         std::ostringstream buffer;
         buffer << file.rdbuf();
 
-        JsonParseError parseError;
-        std::optional<JsonValue> json = JsonParse(buffer.str(), &parseError);
-        if (!json && error)
-            *error = "WriteCookedScene: JSON error in '" + path.generic_string()
-                + "': " + parseError.Message;
-        return json;
+        std::string collectError;
+        if (!CollectAssetPathsFromText(buffer.str(), out, &collectError))
+        {
+            if (error)
+                *error = "WriteCookedScene: JSON error in '" + path.generic_string()
+                    + "': " + collectError;
+            return false;
+        }
+        return true;
     }
 } // namespace
 
 bool WriteCookedScene(
     const JsonValue& cookedScene,
+    const ComponentSerializerRegistry& serializers,
     std::span<const std::string> extraRefs,
     const std::function<std::filesystem::path(std::string_view)>& physicalPathFor,
     const std::filesystem::path& idMapPath,
@@ -67,11 +80,11 @@ bool WriteCookedScene(
         if (!paths[i].ends_with(".smat"))
             continue;
 
-        std::optional<JsonValue> smatJson = ParseJsonFile(physicalPathFor(paths[i]), error);
-        if (!smatJson)
+        std::vector<std::string> smatRefs;
+        if (!CollectFileAssetPaths(physicalPathFor(paths[i]), smatRefs, error))
             return false;
 
-        for (std::string& ref : CollectAssetPaths(*smatJson))
+        for (std::string& ref : smatRefs)
         {
             if (seen.insert(ref).second)
                 paths.push_back(std::move(ref));
@@ -118,18 +131,64 @@ bool WriteCookedScene(
         return false;
     }
 
-    // The cooked scene: refs the map knows become {"id","path"}; refs it does not
-    // know stay plain paths, so the cooked output is never less resolvable than
-    // its input.
-    std::ofstream out(cookedScenePath, std::ios::trunc);
-    if (out.is_open())
-        out << JsonStringify(StampAssetRefIds(cookedScene, idMap), /*pretty*/ true);
-    if (!out.good())
+    // The cooked scene: refs the map knows carry their id, so a rename after
+    // the cook still resolves; refs it does not know stay plain paths, so the
+    // cooked output is never less resolvable than its input.
+    LoggingProvider logging;
+    SceneSaveError saveError;
+    std::ofstream out(cookedScenePath, std::ios::binary | std::ios::trunc);
+    BinaryWriter writer(out);
+    const bool encoded = out.is_open()
+        && TranscodeSceneJsonToBinary(StampAssetRefIds(cookedScene, idMap), serializers,
+                                      writer, logging, &saveError);
+    if (!encoded || !out.good())
     {
         if (error)
-            *error = "WriteCookedScene: could not write '" + cookedScenePath.generic_string() + "'";
+            *error = "WriteCookedScene: could not write '" + cookedScenePath.generic_string() + "'"
+                + (saveError.Message.empty() ? std::string() : ": " + saveError.Message);
         return false;
     }
 
     return true;
 }
+
+std::optional<JsonValue> ReadCookedSceneJson(
+    const std::filesystem::path& cookedScenePath,
+    const ComponentSerializerRegistry& serializers,
+    std::string* error)
+{
+    std::ifstream file(cookedScenePath, std::ios::binary);
+    if (!file.is_open())
+    {
+        if (error)
+            *error = "ReadCookedSceneJson: could not open '" + cookedScenePath.generic_string() + "'";
+        return std::nullopt;
+    }
+    std::ostringstream buffer;
+    buffer << file.rdbuf();
+    const std::string contents = std::move(buffer).str();
+
+    if (!IsBinaryScene(std::as_bytes(std::span(contents.data(), contents.size()))))
+    {
+        JsonParseError parseError;
+        std::optional<JsonValue> json = JsonParse(contents, &parseError);
+        if (!json && error)
+            *error = "ReadCookedSceneJson: JSON error in '" + cookedScenePath.generic_string()
+                + "': " + parseError.Message;
+        return json;
+    }
+
+    LoggingProvider logging;
+    SceneLoadError loadError;
+    std::istringstream stream(contents, std::ios::binary);
+    BinaryReader reader(stream);
+    JsonValue json = TranscodeSceneBinaryToJson(reader, serializers, logging, &loadError);
+    if (json.IsNull())
+    {
+        if (error)
+            *error = "ReadCookedSceneJson: '" + cookedScenePath.generic_string() + "': "
+                + loadError.Message;
+        return std::nullopt;
+    }
+    return json;
+}
@@ -0,0 +1,145 @@
+#include <assets/cook/TextureBlockCache.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+namespace
+{
+    constexpr char kMagic[4] = { 'S', 'T', 'B', 'C' };
+    constexpr uint32_t kVersion = 1;
+
+    struct FileHeader
+    {
+        char Magic[4];
+        uint32_t Version;
+        uint64_t EntryCount;
+    };
+    static_assert(sizeof(FileHeader) == 16);
+
+    bool Fail(std::string* error, std::string message)
+    {
+        if (error != nullptr)
+            *error = std::move(message);
+        return false;
+    }
+}
+
+TextureBlockCache::TextureBlockCache(std::size_t maxBlocks)
+    : Capacity(std::max<std::size_t>(maxBlocks, 1))
+{
+}
+
+bool TextureBlockCache::Find(uint64_t key, std::span<uint8_t, kBlockBytes> out) const
+{
+    const auto it = Index.find(key);
+    if (it == Index.end())
+        return false;
+    std::memcpy(out.data(), Entries[it->second].Bytes, kBlockBytes);
+    return true;
+}
+
+void TextureBlockCache::Insert(uint64_t key, std::span<const uint8_t, kBlockBytes> block)
+{
+    Dirty = true;
+    if (const auto it = Index.find(key); it != Index.end())
+    {
+        std::memcpy(Entries[it->second].Bytes, block.data(), kBlockBytes);
+        return;
+    }
+
+    uint32_t slot = 0;
+    if (Entries.size() < Capacity)
+    {
+        slot = static_cast<uint32_t>(Entries.size());
+        Entries.emplace_back();
+    }
+    else
+    {
+        slot = static_cast<uint32_t>(Oldest);
+        Index.erase(Entries[slot].Key);
+        Oldest = (Oldest + 1) % Capacity;
+    }
+    Entries[slot].Key = key;
+    std::memcpy(Entries[slot].Bytes, block.data(), kBlockBytes);
+    Index.emplace(key, slot);
+}
+
+bool TextureBlockCache::LoadFromFile(const std::filesystem::path& path, std::string* error)
+{
+    Entries.clear();
+    Index.clear();
+    Oldest = 0;
+    Dirty = false;
+
+    std::error_code ec;
+    if (!std::filesystem::exists(path, ec))
+        return true;
+
+    std::ifstream file(path, std::ios::binary);
+    FileHeader header{};
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)))
+        return Fail(error, "texture block cache '" + path.generic_string() + "' is truncated");
+    if (std::memcmp(header.Magic, kMagic, sizeof(kMagic)) != 0 || header.Version != kVersion)
+        return Fail(error, "texture block cache '" + path.generic_string() + "' has a foreign header");
+
+    const uint64_t fileSize = std::filesystem::file_size(path, ec);
+    if (ec || fileSize != sizeof(FileHeader) + header.EntryCount * sizeof(Entry))
+        return Fail(error, "texture block cache '" + path.generic_string() + "' is truncated");
+
+    // Oldest first on disk: when the file holds more than this cache keeps,
+    // the newest survive.
+    const uint64_t skip = header.EntryCount > Capacity ? header.EntryCount - Capacity : 0;
+    file.seekg(static_cast<std::streamoff>(sizeof(FileHeader) + skip * sizeof(Entry)));
+    Entries.resize(static_cast<std::size_t>(header.EntryCount - skip));
+    if (!Entries.empty()
+        && !file.read(reinterpret_cast<char*>(Entries.data()),
+                      static_cast<std::streamsize>(Entries.size() * sizeof(Entry))))
+    {
+        Entries.clear();
+        return Fail(error, "texture block cache '" + path.generic_string() + "' read failed");
+    }
+
+    Index.reserve(Entries.size());
+    for (uint32_t slot = 0; slot < Entries.size(); ++slot)
+        Index[Entries[slot].Key] = slot;
+    return true;
+}
+
+bool TextureBlockCache::SaveToFile(const std::filesystem::path& path, std::string* error)
+{
+    std::error_code ec;
+    if (path.has_parent_path())
+        std::filesystem::create_directories(path.parent_path(), ec);
+
+    std::filesystem::path staging = path;
+    staging += ".tmp";
+    {
+        std::ofstream out(staging, std::ios::binary | std::ios::trunc);
+        if (!out)
+            return Fail(error, "could not create '" + staging.generic_string() + "'");
+
+        FileHeader header{};
+        std::memcpy(header.Magic, kMagic, sizeof(kMagic));
+        header.Version = kVersion;
+        header.EntryCount = Entries.size();
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        // The ring's oldest slot onward, then the wrapped front.
+        out.write(reinterpret_cast<const char*>(Entries.data() + Oldest),
+                  static_cast<std::streamsize>((Entries.size() - Oldest) * sizeof(Entry)));
+        out.write(reinterpret_cast<const char*>(Entries.data()),
+                  static_cast<std::streamsize>(Oldest * sizeof(Entry)));
+        out.close();
+        if (!out)
+            return Fail(error, "write of '" + staging.generic_string() + "' failed");
+    }
+
+    std::filesystem::rename(staging, path, ec);
+    if (ec)
+    {
+        std::filesystem::remove(staging, ec);
+        return Fail(error, "could not replace '" + path.generic_string() + "'");
+    }
+    Dirty = false;
+    return true;
+}
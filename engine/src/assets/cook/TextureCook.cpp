@@ -1,7 +1,9 @@
 #include <assets/cook/TextureCook.h>
+#include <assets/cook/TextureBlockCache.h>
 #include <assets/cook/TextureImportSettings.h>
 
 #include <assets/texture/TextureSerializer.h>
+#include <core/hash/ContentHash.h>
 #include <jobs/JobSystem.h>
 #include <render/Image.h>
 #include <render/ImageLoader.h>
@@ -13,11 +15,14 @@
 #include <rgbcx.h>
 
 #include <algorithm>
+#include <array>
+#include <chrono>
 #include <cmath>
 #include <cstring>
 #include <functional>
 #include <optional>
 #include <string>
+#include <vector>
 
 namespace
 {
@@ -38,22 +43,36 @@ namespace
         return static_cast<uint8_t>(std::clamp(c * 255.0f + 0.5f, 0.0f, 255.0f));
     }
 
-    // Runs fn(row) for rows [0, rowCount), through the pool when one is
-    // supplied and the level is large enough to be worth forking. Every row
-    // writes disjoint output, so the pooled result is byte-identical to the
-    // serial one; the threshold is purely a fork-overhead cutoff for the
-    // small tail levels of a mip chain.
-    void ForEachRow(JobSystem* jobs, uint32_t rowCount,
-                    const std::function<void(uint32_t row)>& fn)
+    // SrgbToLinear of every byte value: decode is a load, not a pow. Built
+    // from the same function, so filtered bytes match the direct form.
+    const std::array<float, 256>& SrgbToLinearTable()
     {
-        constexpr uint32_t kMinRowsToFork = 8;
-        if (jobs != nullptr && jobs->WorkerCount() > 0 && rowCount >= kMinRowsToFork)
+        static const std::array<float, 256> table = []
         {
-            jobs->ParallelFor(rowCount, fn);
+            std::array<float, 256> values{};
+            for (uint32_t i = 0; i < 256; ++i)
+                values[i] = SrgbToLinear(i / 255.0f);
+            return values;
+        }();
+        return table;
+    }
+
+    // Runs fn(index) for [0, count), through the pool when one is supplied
+    // and there is enough work to be worth forking. Every index writes
+    // disjoint output, so the pooled result is byte-identical to the serial
+    // one; the threshold is purely a fork-overhead cutoff for the small tail
+    // levels of a mip chain.
+    void ForEachIndex(JobSystem* jobs, uint32_t count,
+                      const std::function<void(uint32_t index)>& fn)
+    {
+        constexpr uint32_t kMinIndicesToFork = 8;
+        if (jobs != nullptr && jobs->WorkerCount() > 0 && count >= kMinIndicesToFork)
+        {
+            jobs->ParallelFor(count, fn);
             return;
         }
-        for (uint32_t row = 0; row < rowCount; ++row)
-            fn(row);
+        for (uint32_t index = 0; index < count; ++index)
+            fn(index);
     }
 
     // -- Downsampling ----------------------------------------------------------
@@ -70,11 +89,12 @@ namespace
         Normal,
     };
 
-    void DownsampleLevel(const uint8_t* src, uint32_t srcW, uint32_t srcH,
-                         uint8_t* dst, uint32_t dstW, uint32_t dstH,
-                         MipFilter filter, JobSystem* jobs)
+    void DownsampleBox(const uint8_t* src, uint32_t srcW, uint32_t srcH,
+                       uint8_t* dst, uint32_t dstW, uint32_t dstH,
+                       MipFilter filter, JobSystem* jobs)
     {
-        ForEachRow(jobs, dstH, [&](uint32_t y)
+        const std::array<float, 256>& toLinear = SrgbToLinearTable();
+        ForEachIndex(jobs, dstH, [&](uint32_t y)
         {
             const uint32_t y0 = std::min(y * 2, srcH - 1);
             const uint32_t y1 = std::min(y * 2 + 1, srcH - 1);
@@ -120,8 +140,8 @@ namespace
                     if (filter == MipFilter::Srgb && c < 3)
                     {
                         const float linear =
-                            (SrgbToLinear(s00[c] / 255.0f) + SrgbToLinear(s10[c] / 255.0f)
-                           + SrgbToLinear(s01[c] / 255.0f) + SrgbToLinear(s11[c] / 255.0f)) / 4.0f;
+                            (toLinear[s00[c]] + toLinear[s10[c]]
+                           + toLinear[s01[c]] + toLinear[s11[c]]) / 4.0f;
                         d[c] = FloatToByte(LinearToSrgb(linear));
                     }
                     else
@@ -134,6 +154,185 @@ namespace
         });
     }
 
+    // -- Kaiser ----------------------------------------------------------------
+    //
+    // Separable windowed sinc: three destination texels each side (twelve
+    // source taps per axis), Kaiser window with alpha 4. Destination texel x
+    // centres between source texels 2x and 2x+1 at every level, so all
+    // texels share one set of weights and only the edge clamp differs.
+    //
+    // Channels filter as float in the same three disciplines as the box
+    // (sRGB linearized, normals as vectors then renormalized, linear data
+    // as is). Work goes in bands of destination rows: each band filters the
+    // source rows it needs horizontally into scratch, then sums the scratch
+    // rows vertically. Both passes are straight multiply-adds over whole
+    // rows of floats, which the compiler vectorizes.
+
+    constexpr int kKaiserTaps = 12;
+    constexpr int kKaiserFirstTap = -5; // source offset of tap 0 from 2x
+    constexpr float kKaiserHalfWidth = 3.0f;
+    constexpr float kKaiserAlpha = 4.0f;
+    constexpr uint32_t kKaiserBandRows = 16;
+
+    // Modified Bessel function of the first kind, order 0, by its series.
+    float BesselI0(float x)
+    {
+        const float quarterSquare = 0.25f * x * x;
+        float sum = 1.0f;
+        float term = 1.0f;
+        for (int k = 1; k < 32 && term > sum * 1e-8f; ++k)
+        {
+            term *= quarterSquare / static_cast<float>(k * k);
+            sum += term;
+        }
+        return sum;
+    }
+
+    const std::array<float, kKaiserTaps>& KaiserWeights()
+    {
+        static const std::array<float, kKaiserTaps> weights = []
+        {
+            std::array<float, kKaiserTaps> taps{};
+            float total = 0.0f;
+            for (int tap = 0; tap < kKaiserTaps; ++tap)
+            {
+                // Source texel centre relative to the destination centre,
+                // in destination texels.
+                const float t = (static_cast<float>(tap + kKaiserFirstTap) - 0.5f) * 0.5f;
+                const float ratio = t / kKaiserHalfWidth;
+                const float window = BesselI0(kKaiserAlpha * std::sqrt(std::max(0.0f, 1.0f - ratio * ratio)))
+                                   / BesselI0(kKaiserAlpha);
+                const float phase = 3.14159265358979f * t;
+                taps[tap] = std::sin(phase) / phase * window;
+                total += taps[tap];
+            }
+            for (float& weight : taps)
+                weight /= total;
+            return taps;
+        }();
+        return weights;
+    }
+
+    void DecodeRow(const uint8_t* src, uint32_t width, MipFilter filter, float* out)
+    {
+        const std::array<float, 256>& toLinear = SrgbToLinearTable();
+        for (uint32_t x = 0; x < width; ++x)
+        {
+            const uint8_t* s = src + uint64_t(x) * 4;
+            float* d = out + uint64_t(x) * 4;
+            for (int c = 0; c < 3; ++c)
+            {
+                switch (filter)
+                {
+                case MipFilter::Srgb:   d[c] = toLinear[s[c]]; break;
+                case MipFilter::Normal: d[c] = s[c] / 127.5f - 1.0f; break;
+                default:                d[c] = s[c] / 255.0f; break;
+                }
+            }
+            d[3] = s[3] / 255.0f; // alpha is linear in every discipline
+        }
+    }
+
+    void EncodeRow(const float* src, uint32_t width, MipFilter filter, uint8_t* out)
+    {
+        for (uint32_t x = 0; x < width; ++x)
+        {
+            const float* s = src + uint64_t(x) * 4;
+            uint8_t* d = out + uint64_t(x) * 4;
+            if (filter == MipFilter::Normal)
+            {
+                const float len = std::sqrt(s[0] * s[0] + s[1] * s[1] + s[2] * s[2]);
+                const float v[3] = {
+                    len > 1e-6f ? s[0] / len : 0.0f,
+                    len > 1e-6f ? s[1] / len : 0.0f,
+                    len > 1e-6f ? s[2] / len : 1.0f, // degenerate -> flat +Z
+                };
+                for (int c = 0; c < 3; ++c)
+                    d[c] = FloatToByte((v[c] + 1.0f) * 0.5f);
+            }
+            else
+            {
+                // The negative lobes ring past [0, 1] on hard edges.
+                for (int c = 0; c < 3; ++c)
+                {
+                    const float value = std::clamp(s[c], 0.0f, 1.0f);
+                    d[c] = FloatToByte(filter == MipFilter::Srgb ? LinearToSrgb(value) : value);
+                }
+            }
+            d[3] = FloatToByte(s[3]);
+        }
+    }
+
+    void DownsampleKaiser(const uint8_t* src, uint32_t srcW, uint32_t srcH,
+                          uint8_t* dst, uint32_t dstW, uint32_t dstH,
+                          MipFilter filter, JobSystem* jobs)
+    {
+        const std::array<float, kKaiserTaps>& weights = KaiserWeights();
+        const uint32_t bandCount = (dstH + kKaiserBandRows - 1) / kKaiserBandRows;
+        const auto clampSource = [](int64_t index, uint32_t extent)
+        {
+            return static_cast<uint32_t>(std::clamp<int64_t>(index, 0, int64_t(extent) - 1));
+        };
+
+        ForEachIndex(jobs, bandCount, [&](uint32_t band)
+        {
+            const uint32_t firstRow = band * kKaiserBandRows;
+            const uint32_t endRow = std::min(dstH, firstRow + kKaiserBandRows);
+            const uint32_t firstSource = clampSource(int64_t(firstRow) * 2 + kKaiserFirstTap, srcH);
+            const uint32_t lastSource =
+                clampSource(int64_t(endRow - 1) * 2 + kKaiserFirstTap + kKaiserTaps - 1, srcH);
+
+            const std::size_t dstFloats = std::size_t(dstW) * 4;
+            std::vector<float> decoded(std::size_t(srcW) * 4);
+            std::vector<float> rows((lastSource - firstSource + 1) * dstFloats);
+            std::vector<float> sum(dstFloats);
+
+            // Horizontal: each source row the band touches, once.
+            for (uint32_t sy = firstSource; sy <= lastSource; ++sy)
+            {
+                DecodeRow(src + uint64_t(sy) * srcW * 4, srcW, filter, decoded.data());
+                float* out = rows.data() + (sy - firstSource) * dstFloats;
+                for (uint32_t x = 0; x < dstW; ++x)
+                {
+                    float acc[4] = {};
+                    for (int tap = 0; tap < kKaiserTaps; ++tap)
+                    {
+                        const float* texel = decoded.data()
+                            + uint64_t(clampSource(int64_t(x) * 2 + kKaiserFirstTap + tap, srcW)) * 4;
+                        for (int c = 0; c < 4; ++c)
+                            acc[c] += weights[tap] * texel[c];
+                    }
+                    std::memcpy(out + uint64_t(x) * 4, acc, sizeof(acc));
+                }
+            }
+
+            // Vertical: weighted sums of whole filtered rows.
+            for (uint32_t y = firstRow; y < endRow; ++y)
+            {
+                std::fill(sum.begin(), sum.end(), 0.0f);
+                for (int tap = 0; tap < kKaiserTaps; ++tap)
+                {
+                    const uint32_t sy = clampSource(int64_t(y) * 2 + kKaiserFirstTap + tap, srcH);
+                    const float* row = rows.data() + (sy - firstSource) * dstFloats;
+                    const float weight = weights[tap];
+                    for (std::size_t i = 0; i < dstFloats; ++i)
+                        sum[i] += weight * row[i];
+                }
+                EncodeRow(sum.data(), dstW, filter, dst + uint64_t(y) * dstW * 4);
+            }
+        });
+    }
+
+    void DownsampleLevel(const uint8_t* src, uint32_t srcW, uint32_t srcH,
+                         uint8_t* dst, uint32_t dstW, uint32_t dstH,
+                         MipFilter filter, TextureMipKernel kernel, JobSystem* jobs)
+    {
+        if (kernel == TextureMipKernel::Kaiser)
+            DownsampleKaiser(src, srcW, srcH, dst, dstW, dstH, filter, jobs);
+        else
+            DownsampleBox(src, srcW, srcH, dst, dstW, dstH, filter, jobs);
+    }
+
     MipFilter FilterForUsage(TextureUsage usage)
     {
         switch (usage)
@@ -175,7 +374,7 @@ TextureUsage InferTextureUsageFromName(std::string_view sourceRelPath)
 }
 
 bool BuildTextureMipChainRgba8(const Image& image, TextureUsage usage, TextureData& out,
-                               std::string* error, JobSystem* jobs)
+                               std::string* error, JobSystem* jobs, TextureMipKernel kernel)
 {
     if (!image.IsValid())
     {
@@ -224,7 +423,7 @@ bool BuildTextureMipChainRgba8(const Image& image, TextureUsage usage, TextureDa
         const TextureMipLevel& dstMip = texture.Mips[i];
         DownsampleLevel(texture.Blob.data() + srcMip.Offset, srcMip.Width, srcMip.Height,
                         texture.Blob.data() + dstMip.Offset, dstMip.Width, dstMip.Height,
-                        filter, jobs);
+                        filter, kernel, jobs);
     }
 
     out = std::move(texture);
@@ -262,16 +461,24 @@ namespace
         (void)initialized;
     }
 
-    // Compresses an RGBA8 chain into `format`, level by level, block by
-    // block. The mip table is recomputed for the block-compressed sizes.
-    bool EncodeMipChain(const TextureData& rgba, TexturePixelFormat format, TextureData& out,
-                        JobSystem* jobs)
+    bool IsBlockFormat(TexturePixelFormat format)
     {
-        EnsureEncodersInitialized();
-
-        bc7enc_compress_block_params bc7Params;
-        bc7enc_compress_block_params_init(&bc7Params);
+        switch (format)
+        {
+        case TexturePixelFormat::BC7:
+        case TexturePixelFormat::BC7_SRGB:
+        case TexturePixelFormat::BC5:
+        case TexturePixelFormat::BC4:
+            return true;
+        default:
+            return false;
+        }
+    }
 
+    // The compressed texture's header and mip table for an RGBA8 chain, with
+    // the blob sized for `format` and left for the block jobs to fill.
+    TextureData LayOutEncoded(const TextureData& rgba, TexturePixelFormat format)
+    {
         TextureData encoded;
         encoded.Format = format;
         encoded.Usage = rgba.Usage;
@@ -287,58 +494,75 @@ namespace
             totalBytes += size;
         }
         encoded.Blob.resize(totalBytes);
+        return encoded;
+    }
 
+    void EncodeBlock(TexturePixelFormat format, const uint8_t block[16 * 4], uint8_t* dst,
+                     const bc7enc_compress_block_params& bc7Params)
+    {
         switch (format)
         {
         case TexturePixelFormat::BC7:
         case TexturePixelFormat::BC7_SRGB:
+            bc7enc_compress_block(dst, block, &bc7Params);
+            break;
         case TexturePixelFormat::BC5:
-        case TexturePixelFormat::BC4:
+            // X/Y in the two channels; Z is reconstructed in-shader
+            // (Decision L).
+            rgbcx::encode_bc5(dst, block, /*chan0*/ 0, /*chan1*/ 1);
             break;
         default:
-            return false;
+            rgbcx::encode_bc4(dst, block);
+            break;
         }
+    }
 
-        for (std::size_t level = 0; level < rgba.Mips.size(); ++level)
-        {
-            const TextureMipLevel& src = rgba.Mips[level];
-            const TextureMipLevel& dst = encoded.Mips[level];
-            const uint8_t* srcPixels = rgba.Blob.data() + src.Offset;
-            uint8_t* dstBlocks = encoded.Blob.data() + dst.Offset;
-
-            const uint32_t blocksX = (src.Width + 3) / 4;
-            const uint32_t blocksY = (src.Height + 3) / 4;
-            ForEachRow(jobs, blocksY, [&](uint32_t by)
-            {
-                for (uint32_t bx = 0; bx < blocksX; ++bx)
-                {
-                    uint8_t block[16 * 4];
-                    GatherBlock(srcPixels, src.Width, src.Height, bx, by, block);
+    // Block cache keys: the gathered RGBA block, seeded by the encoder and
+    // its settings. Bump the seed whenever either changes so no stale block
+    // survives. BC7 and BC7_SRGB encode the same bytes the same way.
+    constexpr uint64_t kBc7BlockCacheSeed = 0xbc7e0c0000000001ull;
 
-                    const uint64_t blockIndex = uint64_t(by) * blocksX + bx;
-                    switch (format)
-                    {
-                    case TexturePixelFormat::BC7:
-                    case TexturePixelFormat::BC7_SRGB:
-                        bc7enc_compress_block(dstBlocks + blockIndex * 16, block, &bc7Params);
-                        break;
-                    case TexturePixelFormat::BC5:
-                        // X/Y in the two channels; Z is reconstructed
-                        // in-shader (Decision L).
-                        rgbcx::encode_bc5(dstBlocks + blockIndex * 16, block,
-                                          /*chan0*/ 0, /*chan1*/ 1);
-                        break;
-                    default:
-                        rgbcx::encode_bc4(dstBlocks + blockIndex * 8, block);
-                        break;
-                    }
-                }
-            });
-        }
+    uint64_t BlockCacheKey(const uint8_t block[16 * 4])
+    {
+        return HashBytes64(std::span<const std::byte>(reinterpret_cast<const std::byte*>(block), 16 * 4),
+                           kBc7BlockCacheSeed);
+    }
 
-        out = std::move(encoded);
-        return true;
+    bool UsesBlockCache(TexturePixelFormat format)
+    {
+        return format == TexturePixelFormat::BC7 || format == TexturePixelFormat::BC7_SRGB;
     }
+
+    // One level of one texture awaiting compression.
+    struct LevelToEncode
+    {
+        const uint8_t* Pixels = nullptr;
+        uint32_t Width = 0;
+        uint32_t Height = 0;
+        uint32_t BlocksX = 0;
+        uint8_t* Blocks = nullptr;
+        TexturePixelFormat Format = TexturePixelFormat::Unknown;
+    };
+
+    // A slice of one level's blocks: the unit of the batch's job split. Big
+    // enough that the fork cost vanishes, small enough that a batch's last
+    // jobs finish together.
+    constexpr uint32_t kBlocksPerJob = 256;
+
+    struct BlockJob
+    {
+        uint32_t Level = 0; // into the batch's LevelToEncode list
+        uint32_t FirstBlock = 0;
+        uint32_t BlockCount = 0;
+    };
+
+    struct BlockJobOutcome
+    {
+        uint32_t Encoded = 0;
+        uint32_t FromCache = 0;
+        // Freshly encoded cacheable blocks, inserted after the fork joins.
+        std::vector<std::pair<uint64_t, const uint8_t*>> Misses;
+    };
 } // namespace
 
 TexturePixelFormat CookedFormatForUsage(TextureUsage usage)
@@ -370,43 +594,153 @@ bool CookImageToTexture(const Image& image,
                         TextureData& out,
                         std::string* error)
 {
-    TextureData rgba;
-    if (!BuildTextureMipChainRgba8(image, params.Usage, rgba, error, params.Jobs))
+    TextureCookBatchEntry entry{ .Source = &image, .Params = params };
+    if (!CookTexturesBatch(std::span(&entry, 1), params.Jobs, params.BlockCache))
+    {
+        if (error)
+            *error = entry.Error;
         return false;
+    }
+    out = std::move(entry.Result);
+    return true;
+}
 
-    if (!params.GenerateMips)
+bool CookTexturesBatch(std::span<TextureCookBatchEntry> entries,
+                       JobSystem* jobs,
+                       TextureBlockCache* blockCache,
+                       TextureCookStats* stats)
+{
+    const auto start = std::chrono::steady_clock::now();
+    bool ok = true;
+    TextureCookStats batch;
+
+    // Filter every chain (each level's rows fork over the pool; levels
+    // depend on their parent, so they cannot), and lay out the compressed
+    // results for the block jobs to fill.
+    std::vector<TextureData> chains(entries.size());
+    std::vector<LevelToEncode> levels;
+    for (std::size_t i = 0; i < entries.size(); ++i)
     {
-        rgba.Mips.resize(1);
-        rgba.Blob.resize(rgba.Mips[0].ByteSize);
+        TextureCookBatchEntry& entry = entries[i];
+        const TextureCookParams& params = entry.Params;
+        entry.Result = {};
+        entry.Error.clear();
+        if (entry.Source == nullptr)
+        {
+            entry.Error = "texture cook: no source image";
+            ok = false;
+            continue;
+        }
+
+        TextureData& rgba = chains[i];
+        if (!BuildTextureMipChainRgba8(*entry.Source, params.Usage, rgba, &entry.Error, jobs,
+                                       params.MipKernel))
+        {
+            ok = false;
+            continue;
+        }
+        if (!params.GenerateMips)
+        {
+            rgba.Mips.resize(1);
+            rgba.Blob.resize(rgba.Mips[0].ByteSize);
+        }
+
+        ++batch.Textures;
+        for (const TextureMipLevel& mip : rgba.Mips)
+            batch.Pixels += uint64_t(mip.Width) * mip.Height;
+
+        if (!params.Compress)
+        {
+            // Keep the colorspace-correct RGBA8/RGBA8_SRGB chain as-is.
+            rgba.Filter = params.Filter;
+            entry.Result = std::move(rgba);
+            continue;
+        }
+
+        const TexturePixelFormat format = CookedFormatForUsage(params.Usage);
+        if (!IsBlockFormat(format))
+        {
+            entry.Error = "texture cook: no cooked format for usage";
+            ok = false;
+            continue;
+        }
+
+        entry.Result = LayOutEncoded(rgba, format);
+        entry.Result.Filter = params.Filter;
+        for (std::size_t level = 0; level < rgba.Mips.size(); ++level)
+        {
+            const TextureMipLevel& src = rgba.Mips[level];
+            levels.push_back(LevelToEncode{
+                .Pixels = rgba.Blob.data() + src.Offset,
+                .Width = src.Width,
+                .Height = src.Height,
+                .BlocksX = (src.Width + 3) / 4,
+                .Blocks = entry.Result.Blob.data() + entry.Result.Mips[level].Offset,
+                .Format = format,
+            });
+        }
     }
 
-    if (!params.Compress)
+    // Split: every level of every texture into equal slices of blocks, one
+    // flat list for one fork.
+    std::vector<BlockJob> blockJobs;
+    for (uint32_t level = 0; level < levels.size(); ++level)
     {
-        // Keep the colorspace-correct RGBA8/RGBA8_SRGB chain as-is.
-        rgba.Filter = params.Filter;
-        out = std::move(rgba);
-        return true;
+        const uint32_t blockCount = levels[level].BlocksX * ((levels[level].Height + 3) / 4);
+        for (uint32_t first = 0; first < blockCount; first += kBlocksPerJob)
+            blockJobs.push_back(BlockJob{ level, first, std::min(kBlocksPerJob, blockCount - first) });
     }
 
-    const TexturePixelFormat format = CookedFormatForUsage(params.Usage);
-    if (format == TexturePixelFormat::Unknown)
+    EnsureEncodersInitialized();
+    bc7enc_compress_block_params bc7Params;
+    bc7enc_compress_block_params_init(&bc7Params);
+
+    std::vector<BlockJobOutcome> outcomes(blockJobs.size());
+    ForEachIndex(jobs, static_cast<uint32_t>(blockJobs.size()), [&](uint32_t jobIndex)
     {
-        if (error)
-            *error = "texture cook: no cooked format for usage";
-        return false;
-    }
+        const BlockJob& job = blockJobs[jobIndex];
+        const LevelToEncode& level = levels[job.Level];
+        const bool cached = blockCache != nullptr && UsesBlockCache(level.Format);
+        const uint32_t blockBytes = level.Format == TexturePixelFormat::BC4 ? 8 : 16;
+        BlockJobOutcome& outcome = outcomes[jobIndex];
+
+        for (uint32_t block = job.FirstBlock; block < job.FirstBlock + job.BlockCount; ++block)
+        {
+            uint8_t pixels[16 * 4];
+            GatherBlock(level.Pixels, level.Width, level.Height,
+                        block % level.BlocksX, block / level.BlocksX, pixels);
+            uint8_t* dst = level.Blocks + uint64_t(block) * blockBytes;
 
-    TextureData encoded;
-    if (!EncodeMipChain(rgba, format, encoded, params.Jobs))
+            if (!cached)
+            {
+                EncodeBlock(level.Format, pixels, dst, bc7Params);
+                ++outcome.Encoded;
+                continue;
+            }
+            const uint64_t key = BlockCacheKey(pixels);
+            if (blockCache->Find(key, std::span<uint8_t, TextureBlockCache::kBlockBytes>(dst, 16)))
+            {
+                ++outcome.FromCache;
+                continue;
+            }
+            EncodeBlock(level.Format, pixels, dst, bc7Params);
+            ++outcome.Encoded;
+            outcome.Misses.emplace_back(key, dst);
+        }
+    });
+
+    for (const BlockJobOutcome& outcome : outcomes)
     {
-        if (error)
-            *error = "texture cook: block compression failed";
-        return false;
+        batch.BlocksEncoded += outcome.Encoded;
+        batch.BlocksFromCache += outcome.FromCache;
+        for (const auto& [key, bytes] : outcome.Misses)
+            blockCache->Insert(key, std::span<const uint8_t, TextureBlockCache::kBlockBytes>(bytes, 16));
     }
 
-    encoded.Filter = params.Filter;
-    out = std::move(encoded);
-    return true;
+    batch.Seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if (stats != nullptr)
+        stats->Accumulate(batch);
+    return ok;
 }
 
 std::vector<std::string_view> PngTextureImporter::SourceExtensions() const
@@ -416,48 +750,87 @@ std::vector<std::string_view> PngTextureImporter::SourceExtensions() const
 
 ImportResult PngTextureImporter::Import(const ImportInput& input, ICookOutputWriter& output)
 {
-    const std::optional<Image> image = LoadImageFromMemory(
-        reinterpret_cast<const uint8_t*>(input.Bytes.data()),
-        static_cast<int>(input.Bytes.size()),
-        /*srgb*/ true);
-    if (!image)
-        return ImportResult{ .Error = "png import: decode failed" };
-
-    // Sidecar import settings (the driver reads the file); a malformed
-    // sidecar fails the import rather than silently cooking with defaults.
-    TextureImportSettings settings;
-    std::string settingsError;
-    if (!ParseTextureImportSettings(input.MetaBytes, settings, &settingsError))
-        return ImportResult{ .Error = "png import: " + settingsError };
-
-    const TextureCookParams params{
-        .Usage = settings.Usage != TextureUsage::Unknown
-                     ? settings.Usage
-                     : InferTextureUsageFromName(input.SourceRelPath),
-        .Filter = settings.Filter,
-        .Compress = settings.Compress,
-        .GenerateMips = settings.GenerateMips,
-        .Jobs = Jobs,
-    };
+    std::vector<ImportResult> results = ImportBatch(std::span(&input, 1), output);
+    return std::move(results.front());
+}
 
-    TextureData texture;
-    std::string cookError;
-    if (!CookImageToTexture(*image, params, texture, &cookError))
-        return ImportResult{ .Error = cookError };
+std::vector<ImportResult> PngTextureImporter::ImportBatch(std::span<const ImportInput> inputs,
+                                                          ICookOutputWriter& output)
+{
+    std::vector<ImportResult> results(inputs.size());
+    std::vector<std::optional<Image>> images(inputs.size());
+    std::vector<TextureCookBatchEntry> entries;
+    std::vector<std::size_t> entryInputs;
+    entries.reserve(inputs.size());
 
-    std::vector<std::byte> stexBytes;
-    if (!WriteStexToBytes(texture, stexBytes))
-        return ImportResult{ .Error = "png import: stex serialization failed" };
+    for (std::size_t i = 0; i < inputs.size(); ++i)
+    {
+        const ImportInput& input = inputs[i];
+        images[i] = LoadImageFromMemory(
+            reinterpret_cast<const uint8_t*>(input.Bytes.data()),
+            static_cast<int>(input.Bytes.size()),
+            /*srgb*/ true);
+        if (!images[i])
+        {
+            results[i].Error = "png import: decode failed";
+            continue;
+        }
 
-    CookedArtifact artifact;
-    artifact.Path = "asset://" + std::string(input.SourceRelPath);
-    artifact.FileRelPath = ".cooked/" + std::string(input.SourceRelPath) + ".stex";
-    artifact.Type = AssetType::Texture;
+        // Sidecar import settings (the driver reads the file); a malformed
+        // sidecar fails the import rather than silently cooking with defaults.
+        TextureImportSettings settings;
+        std::string settingsError;
+        if (!ParseTextureImportSettings(input.MetaBytes, settings, &settingsError))
+        {
+            results[i].Error = "png import: " + settingsError;
+            continue;
+        }
 
-    if (!output.WriteBytes(artifact.FileRelPath, stexBytes))
-        return ImportResult{ .Error = "png import: artifact write failed" };
+        entries.push_back(TextureCookBatchEntry{
+            .Source = &*images[i],
+            .Params = TextureCookParams{
+                .Usage = settings.Usage != TextureUsage::Unknown
+                             ? settings.Usage
+                             : InferTextureUsageFromName(input.SourceRelPath),
+                .Filter = settings.Filter,
+                .Compress = settings.Compress,
+                .GenerateMips = settings.GenerateMips,
+                .MipKernel = settings.MipKernel,
+            },
+        });
+        entryInputs.push_back(i);
+    }
 
-    ImportResult result;
-    result.Artifacts.push_back(std::move(artifact));
-    return result;
+    (void)CookTexturesBatch(entries, Jobs, BlockCache, &CookStats);
+
+    for (std::size_t e = 0; e < entries.size(); ++e)
+    {
+        const ImportInput& input = inputs[entryInputs[e]];
+        ImportResult& result = results[entryInputs[e]];
+        if (!entries[e].Error.empty())
+        {
+            result.Error = entries[e].Error;
+            continue;
+        }
+
+        std::vector<std::byte> stexBytes;
+        if (!WriteStexToBytes(entries[e].Result, stexBytes))
+        {
+            result.Error = "png import: stex serialization failed";
+            continue;
+        }
+
+        CookedArtifact artifact;
+        artifact.Path = "asset://" + std::string(input.SourceRelPath);
+        artifact.FileRelPath = ".cooked/" + std::string(input.SourceRelPath) + ".stex";
+        artifact.Type = AssetType::Texture;
+
+        if (!output.WriteBytes(artifact.FileRelPath, stexBytes))
+        {
+            result.Error = "png import: artifact write failed";
+            continue;
+        }
+        result.Artifacts.push_back(std::move(artifact));
+    }
+    return results;
 }
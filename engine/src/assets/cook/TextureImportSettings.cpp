@@ -95,6 +95,17 @@ bool ParseTextureImportSettings(std::span<const std::byte> bytes,
                 return Fail(error, "'mips' must be a bool");
             out.GenerateMips = value.AsBool();
         }
+        else if (key == "mip_filter")
+        {
+            if (!value.IsString())
+                return Fail(error, "'mip_filter' must be a string");
+            if (value.AsString() == "box")
+                out.MipKernel = TextureMipKernel::Box;
+            else if (value.AsString() == "kaiser")
+                out.MipKernel = TextureMipKernel::Kaiser;
+            else
+                return Fail(error, std::format("unknown mip_filter '{}'", value.AsString()));
+        }
         else
         {
             return Fail(error, std::format("unknown import settings key '{}'", key));
@@ -115,6 +126,8 @@ bool SaveTextureImportSettingsFile(std::string_view path,
                                               ? "nearest" : "linear"));
     root.emplace_back("compress", JsonValue(settings.Compress));
     root.emplace_back("mips", JsonValue(settings.GenerateMips));
+    root.emplace_back("mip_filter", JsonValue(settings.MipKernel == TextureMipKernel::Kaiser
+                                                  ? "kaiser" : "box"));
 
     std::ofstream file{ std::string(path), std::ios::trunc };
     if (!file.is_open())
@@ -38,6 +38,22 @@ DataAssetLoader::DataAssetLoader(LoggingProvider& logging,
 }
 
 AssetStaging DataAssetLoader::LoadStaged(const AssetRecord& record, IAssetSource& source)
+{
+    AssetBytes bytes;
+    if (!ReadAssetView(source, record, bytes))
+    {
+        AssetStaging staging;
+        staging.Record = record;
+        staging.Error = std::format("could not read data asset source for '{}'", record.Path);
+        return staging;
+    }
+
+    return DecodeStaged(record, bytes, std::stop_token{});
+}
+
+AssetStaging DataAssetLoader::DecodeStaged(const AssetRecord& record,
+                                           const AssetBytes& bytes,
+                                           std::stop_token)
 {
     AssetStaging staging;
     staging.Record = record;
@@ -48,13 +64,6 @@ AssetStaging DataAssetLoader::LoadStaged(const AssetRecord& record, IAssetSource
         return staging;
     }
 
-    std::vector<std::byte> bytes;
-    if (!ReadAssetBytes(source, record, bytes))
-    {
-        staging.Error = std::format("could not read data asset source for '{}'", record.Path);
-        return staging;
-    }
-
     JsonParseError jsonError;
     const std::string text(reinterpret_cast<const char*>(bytes.data()), bytes.size());
     const std::optional<JsonValue> root = JsonParse(text, &jsonError);
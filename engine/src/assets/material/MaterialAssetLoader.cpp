@@ -2,13 +2,11 @@
 
 #include <assets/material/MaterialLoader.h>
 #include <assets/runtime/AssetSystem.h>
-#include <core/json/JsonParser.h>
 #include <core/logging/LoggingProvider.h>
 #include <graphics/vulkan/TextureCache.h>
 #include <render/MaterialCache.h>
 
 #include <format>
-#include <optional>
 #include <string>
 #include <utility>
 
@@ -25,29 +23,28 @@ MaterialAssetLoader::MaterialAssetLoader(LoggingProvider& logging,
 
 AssetStaging MaterialAssetLoader::LoadStaged(const AssetRecord& record, IAssetSource& source)
 {
-    AssetStaging staging;
-    staging.Record = record;
-
-    std::vector<std::byte> bytes;
-    if (!ReadAssetBytes(source, record, bytes))
+    AssetBytes bytes;
+    if (!ReadAssetView(source, record, bytes))
     {
+        AssetStaging staging;
+        staging.Record = record;
         staging.Error = std::format("could not read material source for '{}'", record.Path);
         return staging;
     }
 
-    JsonParseError jsonError;
-    const std::string text(reinterpret_cast<const char*>(bytes.data()), bytes.size());
-    const std::optional<JsonValue> root = JsonParse(text, &jsonError);
-    if (!root.has_value())
-    {
-        staging.Error = std::format("material JSON parse error at {}: {}",
-                                    jsonError.Position, jsonError.Message);
-        return staging;
-    }
+    return DecodeStaged(record, bytes, std::stop_token{});
+}
+
+AssetStaging MaterialAssetLoader::DecodeStaged(const AssetRecord& record,
+                                               const AssetBytes& bytes,
+                                               std::stop_token)
+{
+    AssetStaging staging;
+    staging.Record = record;
 
     MaterialDescription desc;
     MaterialParseError parseError;
-    if (!ParseMaterialJson(*root, desc, &parseError))
+    if (!ParseMaterialBytes(bytes.Bytes(), desc, &parseError))
     {
         staging.Error = parseError.Message;
         return staging;
@@ -1,12 +1,11 @@
 #include <assets/material/MaterialLoader.h>
 
 #include <core/assets/AssetRegistry.h>
+#include <core/assets/AssetSource.h>
 #include <core/json/JsonParser.h>
 #include <core/json/JsonValue.h>
 
 #include <format>
-#include <fstream>
-#include <sstream>
 
 namespace
 {
@@ -163,20 +162,31 @@ bool ParseMaterialJson(const JsonValue& root, MaterialDescription& out, Material
     return true;
 }
 
-bool LoadMaterialFromFile(std::string_view path, MaterialDescription& out, MaterialParseError* error)
+bool ParseMaterialBytes(std::span<const std::byte> bytes, MaterialDescription& out, MaterialParseError* error)
 {
-    std::ifstream file{ std::string(path) };
-    if (!file.is_open())
-        return Fail(error, std::format("could not open material file '{}'", path));
-
-    std::ostringstream buffer;
-    buffer << file.rdbuf();
+    const std::string_view text(reinterpret_cast<const char*>(bytes.data()), bytes.size());
 
     JsonParseError parseError;
-    const std::optional<JsonValue> root = JsonParse(buffer.str(), &parseError);
+    const std::optional<JsonValue> root = JsonParse(text, &parseError);
     if (!root.has_value())
         return Fail(error, std::format("material JSON parse error at {}: {}",
                                        parseError.Position, parseError.Message));
 
     return ParseMaterialJson(*root, out, error);
 }
+
+bool LoadMaterialFromSource(IAssetSource& source, std::string_view path, MaterialDescription& out,
+                            MaterialParseError* error)
+{
+    AssetBytes bytes;
+    if (!source.ReadView(path, bytes))
+        return Fail(error, std::format("could not open material file '{}'", path));
+
+    return ParseMaterialBytes(bytes.Bytes(), out, error);
+}
+
+bool LoadMaterialFromFile(std::string_view path, MaterialDescription& out, MaterialParseError* error)
+{
+    FileAssetSource files;
+    return LoadMaterialFromSource(files, path, out, error);
+}
@@ -102,7 +102,7 @@ bool ReadProbeVolumeFile(BinaryReader& reader, ProbeVolumeFile& file)
         return false;
 
     bool sawVolumeTable = false;
-    while (reader.GetStream().peek() != std::istream::traits_type::eof())
+    while (!reader.AtEnd())
     {
         ChunkReader chunk;
         if (!chunk.ReadHeader(reader))
@@ -6,6 +6,8 @@
 #include <jobs/AsyncTaskQueue.h>
 
 #include <cassert>
+#include <format>
+#include <optional>
 #include <utility>
 
 // -- AssetPreload ---------------------------------------------------------------
@@ -31,9 +33,13 @@ void AssetPreload::ReleaseAll()
 
 void AssetPreload::Cancel()
 {
+    const bool wasCancelled = Cancelled;
     Cancelled = true;
     OnComplete = nullptr;
     ReleaseAll();
+
+    if (!wasCancelled && Pending > 0 && Owner != nullptr)
+        Owner->OnPreloadCancelled();
 }
 
 void AssetPreload::AddPending()
@@ -90,9 +96,12 @@ bool AssetPreloader::CanStage(const AssetRecord& record) const
         && record.SourceKind == AssetSourceKind::File;
 }
 
-std::shared_ptr<AssetPreload> AssetPreloader::Begin(std::span<const std::string> paths)
+std::shared_ptr<AssetPreload> AssetPreloader::Begin(std::span<const std::string> paths,
+                                                    AsyncTaskPriority priority)
 {
     std::shared_ptr<AssetPreload> preload(new AssetPreload());
+    preload->Owner = this;
+    preload->SetPriority(priority);
 
     for (const std::string& path : paths)
     {
@@ -150,41 +159,128 @@ void AssetPreloader::RequestLoad(const AssetRecord& record, LoadWaiter waiter)
         return;
     }
 
+    AsyncTaskPriorityCell priority = PriorityFor(waiter);
+    AsyncTaskDeadlineCell deadline = DeadlineFor(waiter);
+
+    LoadStop& stop = Stops[record.Path];
+    if (waiter.Preload)
+        stop.Preloads.push_back(waiter.Preload.get());
+    else if (waiter.IsDependency())
+        stop.Parents.push_back(waiter.ParentPath);
+    else
+        stop.Pinned = true;
+    std::stop_token token = stop.Source.get_token();
+
     if (InFlight.Begin(record.Path, std::move(waiter))
         == AssetInFlightTable<LoadWaiter>::BeginResult::Started)
     {
-        SubmitStagedLoad(record);
+        SubmitStagedLoad(record, std::move(priority), std::move(deadline), std::move(token));
     }
 }
 
-void AssetPreloader::SubmitStagedLoad(const AssetRecord& record)
+AsyncTaskPriorityCell AssetPreloader::PriorityFor(const LoadWaiter& waiter) const
+{
+    if (waiter.Preload)
+        return waiter.Preload->Priority;
+
+    auto parent = PendingCommits.find(waiter.ParentPath);
+    return parent != PendingCommits.end() ? parent->second.Priority : nullptr;
+}
+
+AsyncTaskDeadlineCell AssetPreloader::DeadlineFor(const LoadWaiter& waiter) const
+{
+    if (waiter.Preload)
+        return waiter.Preload->Deadline;
+
+    auto parent = PendingCommits.find(waiter.ParentPath);
+    return parent != PendingCommits.end() ? parent->second.Deadline : nullptr;
+}
+
+void AssetPreloader::SubmitStagedLoad(const AssetRecord& record,
+                                      AsyncTaskPriorityCell priority,
+                                      AsyncTaskDeadlineCell deadline,
+                                      std::stop_token stop)
 {
     IAssetStager* stager = Assets.LoaderFor(record.Type);
     assert(stager != nullptr && "AssetPreloader: CanStage admitted a kind with no stager");
 
     IAssetSource* source = &Assets.DefaultSource();
 
-    Tasks.Submit<AssetStaging>(
-        // Work, task thread: pure decode against the byte seam. The record
-        // is captured by value — plain data, no shared state.
-        [stager, source, record]() -> AssetStaging
+    // Commit, owner thread at the drain point.
+    auto commit =
+        [this, type = record.Type, path = record.Path, priority, deadline](AssetStaging staging)
+    {
+        OnAssetStaged(type, path, std::move(staging), priority, deadline);
+    };
+
+    if (!stager->DecodesFromView())
+    {
+        Tasks.Submit<AssetStaging>(
+            // Work, task thread: pure decode against the byte seam. The record
+            // is captured by value — plain data, no shared state.
+            [stager, source, record, stop]() -> AssetStaging
+            {
+                if (stop.stop_requested())
+                    return StoppedStaging(record);
+                return stager->LoadStaged(record, *source);
+            },
+            std::move(commit),
+            AsyncTaskOptions{ .Priority = std::move(priority),
+                              .SharedDeadline = std::move(deadline),
+                              .Label = "asset.load" });
+        return;
+    }
+
+    // Reads of a packed manifest go out in pack order, not request order.
+    const uint64_t readOrder = AssetReadOrder(*source, record);
+
+    Tasks.SubmitStaged<std::optional<AssetBytes>, AssetStaging>(
+        // Read, I/O pool: the bytes and nothing else. A stopped load skips
+        // the read; its decode reports the stop.
+        [source, record, stop]() -> std::optional<AssetBytes>
         {
-            return stager->LoadStaged(record, *source);
+            if (stop.stop_requested())
+                return std::nullopt;
+
+            AssetBytes bytes;
+            if (!ReadAssetView(*source, record, bytes))
+                return std::nullopt;
+            return bytes;
         },
-        // Commit, owner thread at the drain point.
-        [this, type = record.Type, path = record.Path](AssetStaging staging)
+        // Decode, compute pool: pure against the bytes it was handed.
+        [stager, record, stop](std::optional<AssetBytes> bytes) -> AssetStaging
         {
-            OnAssetStaged(type, path, std::move(staging));
-        });
+            if (stop.stop_requested())
+                return StoppedStaging(record);
+            if (!bytes.has_value())
+            {
+                AssetStaging staging;
+                staging.Record = record;
+                staging.Error = std::format("could not read source for '{}'", record.Path);
+                return staging;
+            }
+            return stager->DecodeStaged(record, *bytes, stop);
+        },
+        std::move(commit),
+        AsyncTaskOptions{ .Priority = std::move(priority),
+                          .SharedDeadline = std::move(deadline),
+                          .ReadOrder = readOrder,
+                          .Label = "asset.stage" });
 }
 
 void AssetPreloader::OnAssetStaged(AssetType type,
                                    const std::string& path,
-                                   AssetStaging&& staging)
+                                   AssetStaging&& staging,
+                                   AsyncTaskPriorityCell priority,
+                                   AsyncTaskDeadlineCell deadline)
 {
     if (!staging.IsValid())
     {
-        Log.Error("AssetPreloader: '{}' failed to stage: {}", path, staging.Error);
+        auto stop = Stops.find(path);
+        if (stop != Stops.end() && stop->second.Source.stop_requested())
+            Log.Debug("AssetPreloader: '{}' stopped; no preload wants it", path);
+        else
+            Log.Error("AssetPreloader: '{}' failed to stage: {}", path, staging.Error);
         CompleteLoad(type, path, /*failed*/ true);
         return;
     }
@@ -231,6 +327,8 @@ void AssetPreloader::OnAssetStaged(AssetType type,
     PendingCommit pending;
     pending.Type = type;
     pending.Staging = std::move(staging);
+    pending.Priority = std::move(priority);
+    pending.Deadline = std::move(deadline);
     pending.DependencyLeases = std::move(residentDependencies);
     pending.PendingDependencies = static_cast<uint32_t>(toLoad.size());
     PendingCommits.emplace(path, std::move(pending));
@@ -301,6 +399,7 @@ void AssetPreloader::CompleteLoad(AssetType type, const std::string& path, bool
 {
     PendingCommits.erase(path);
     DependencyEdges.erase(path);
+    Stops.erase(path);
 
     ++DeliveryDepth;
     for (const LoadWaiter& waiter : InFlight.Finish(path))
@@ -345,6 +444,50 @@ void AssetPreloader::Deliver(const LoadWaiter& waiter,
         FinishedThisDrain.push_back(waiter.Preload);
 }
 
+void AssetPreloader::OnPreloadCancelled()
+{
+    for (auto& [path, stop] : Stops)
+    {
+        if (stop.Source.stop_requested())
+            continue;
+
+        std::unordered_set<std::string> visited;
+        if (!IsWanted(path, visited))
+            stop.Source.request_stop();
+    }
+}
+
+bool AssetPreloader::IsWanted(const std::string& path,
+                              std::unordered_set<std::string>& visited) const
+{
+    if (!visited.insert(path).second)
+        return false;
+
+    auto it = Stops.find(path);
+    if (it == Stops.end())
+        return false;
+
+    const LoadStop& stop = it->second;
+    if (stop.Pinned)
+        return true;
+
+    for (const AssetPreload* preload : stop.Preloads)
+    {
+        if (!preload->IsCancelled())
+            return true;
+    }
+
+    // A dependency is wanted while any parent waiting on it is. A parent
+    // that already completed has left Stops and wants nothing.
+    for (const std::string& parent : stop.Parents)
+    {
+        if (IsWanted(parent, visited))
+            return true;
+    }
+
+    return false;
+}
+
 bool AssetPreloader::WouldCreateCycle(std::string_view parent,
                                       std::string_view dependency) const
 {
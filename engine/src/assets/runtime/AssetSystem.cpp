@@ -160,6 +160,22 @@ AssetLease AssetSystem::TryAcquireLease(std::string_view path, AssetType type)
     return store ? store->TryAcquireLease(path) : AssetLease{};
 }
 
+void AssetSystem::SetWarmCacheBudget(const AssetWarmCacheBudget& budget)
+{
+    WarmBudget = budget;
+    for (const AssetKindRegistration& kind : KindRegistry.Entries())
+    {
+        if (kind.Store != nullptr)
+            kind.Store->SetWarmCacheBudget(budget);
+    }
+}
+
+AssetWarmCacheStats AssetSystem::GetWarmCacheStats(AssetType type) const
+{
+    const IAssetStore* store = StoreFor(type);
+    return store ? store->GetWarmCacheStats() : AssetWarmCacheStats{};
+}
+
 AssetLease AssetSystem::Commit(AssetStaging&& staged)
 {
     const AssetKindRegistration* kind = KindRegistry.Find(staged.Record.Type);
@@ -41,7 +41,7 @@ SkeletonHandle AssetSystem::LoadSkeleton(std::string_view path)
         return {};
     }
 
-    AssetStaging staging = SkelLoader.LoadStaged(*record, Source);
+    AssetStaging staging = SkelLoader.LoadStaged(*record, DefaultSource());
     if (!staging.IsValid())
     {
         Log.Error("AssetSystem: {}", staging.Error);
@@ -72,7 +72,7 @@ AnimationClipHandle AssetSystem::LoadAnimationClip(std::string_view path)
         return {};
     }
 
-    AssetStaging staging = AnimLoader.LoadStaged(*record, Source);
+    AssetStaging staging = AnimLoader.LoadStaged(*record, DefaultSource());
     if (!staging.IsValid())
     {
         Log.Error("AssetSystem: {}", staging.Error);
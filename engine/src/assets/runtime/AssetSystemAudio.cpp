@@ -43,7 +43,7 @@ AudioClipHandle AssetSystem::LoadAudioClip(std::string_view path)
         if (AudioClipHandle existing = AudioClips->Acquire(record->Path); existing.IsValid())
             return existing;
 
-        AssetStaging staging = ClipLoader.LoadStaged(*record, Source);
+        AssetStaging staging = ClipLoader.LoadStaged(*record, DefaultSource());
         if (!staging.IsValid())
         {
             Log.Error("AssetSystem: {}", staging.Error);
@@ -68,3 +68,9 @@ void AssetSystem::ReleaseAudioClip(AudioClipHandle handle)
     if (AudioClips)
         AudioClips->Release(handle);
 }
+
+void AssetSystem::RetainAudioClip(AudioClipHandle handle)
+{
+    if (AudioClips)
+        AudioClips->Retain(handle);
+}
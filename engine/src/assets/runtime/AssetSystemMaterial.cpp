@@ -121,7 +121,7 @@ MaterialHandle AssetSystem::LoadMaterial(std::string_view path)
         if (MaterialHandle existing = Materials->Acquire(record->Path); existing.IsValid())
             return existing;
 
-        AssetStaging staging = MatLoader.LoadStaged(*record, Source);
+        AssetStaging staging = MatLoader.LoadStaged(*record, DefaultSource());
         if (!staging.IsValid())
         {
             Log.Error("AssetSystem: failed to load material '{}': {}", record->Path, staging.Error);
@@ -170,7 +170,7 @@ TextureHandle AssetSystem::LoadTexture(std::string_view path, bool srgb)
             return existing;
         }
 
-        AssetStaging staging = TexLoader.LoadStaged(*record, Source, srgb);
+        AssetStaging staging = TexLoader.LoadStaged(*record, DefaultSource(), srgb);
         if (!staging.IsValid())
         {
             Log.Error("AssetSystem: {}", staging.Error);
@@ -212,3 +212,15 @@ void AssetSystem::ReleaseTexture(TextureHandle handle)
     if (Textures)
         Textures->Release(handle);
 }
+
+void AssetSystem::RetainMaterial(MaterialHandle handle)
+{
+    if (Materials)
+        Materials->Retain(handle);
+}
+
+void AssetSystem::RetainTexture(TextureHandle handle)
+{
+    if (Textures)
+        Textures->Retain(handle);
+}
@@ -101,7 +101,7 @@ StaticMeshHandle AssetSystem::LoadStaticMesh(std::string_view path)
         if (StaticMeshHandle existing = StaticMeshes->Acquire(record->Path); existing.IsValid())
             return existing;
 
-        AssetStaging staging = MeshLoader.LoadStaged(*record, Source);
+        AssetStaging staging = MeshLoader.LoadStaged(*record, DefaultSource());
         if (!staging.IsValid())
         {
             Log.Error("AssetSystem: {}", staging.Error);
@@ -137,7 +137,7 @@ SkinnedMeshHandle AssetSystem::LoadSkinnedMesh(std::string_view path)
         return {};
     }
 
-    AssetStaging staging = SkinnedLoader.LoadStaged(*record, Source);
+    AssetStaging staging = SkinnedLoader.LoadStaged(*record, DefaultSource());
     if (!staging.IsValid())
     {
         Log.Error("AssetSystem: {}", staging.Error);
@@ -163,6 +163,12 @@ void AssetSystem::ReleaseStaticMesh(StaticMeshHandle handle)
         StaticMeshes->Release(handle);
 }
 
+void AssetSystem::RetainStaticMesh(StaticMeshHandle handle)
+{
+    if (StaticMeshes)
+        StaticMeshes->Retain(handle);
+}
+
 void AssetSystem::ReleaseSkinnedMesh(SkinnedMeshHandle handle)
 {
     if (SkinnedMeshes)
@@ -15,19 +15,28 @@ SkeletonAssetLoader::SkeletonAssetLoader(LoggingProvider& logging, SkeletonCache
 
 AssetStaging SkeletonAssetLoader::LoadStaged(const AssetRecord& record, IAssetSource& source)
 {
-    AssetStaging staging;
-    staging.Record = record;
-
-    std::vector<std::byte> bytes;
-    if (!ReadAssetBytes(source, record, bytes))
+    AssetBytes bytes;
+    if (!ReadAssetView(source, record, bytes))
     {
+        AssetStaging staging;
+        staging.Record = record;
         staging.Error = std::format("could not read skeleton source for '{}'", record.Path);
         return staging;
     }
 
+    return DecodeStaged(record, bytes, std::stop_token{});
+}
+
+AssetStaging SkeletonAssetLoader::DecodeStaged(const AssetRecord& record,
+                                               const AssetBytes& bytes,
+                                               std::stop_token)
+{
+    AssetStaging staging;
+    staging.Record = record;
+
     SkeletonData data;
     std::string error;
-    if (!LoadSskelFromBytes(bytes, data, &error))
+    if (!LoadSskelFromBytes(bytes.Bytes(), data, &error))
     {
         staging.Error = std::format("failed to parse .sskel for '{}': {}", record.Path, error);
         return staging;
@@ -22,19 +22,30 @@ SkinnedMeshAssetLoader::SkinnedMeshAssetLoader(LoggingProvider& logging,
 
 AssetStaging SkinnedMeshAssetLoader::LoadStaged(const AssetRecord& record, IAssetSource& source)
 {
-    AssetStaging staging;
-    staging.Record = record;
-
-    std::vector<std::byte> bytes;
-    if (!ReadAssetBytes(source, record, bytes))
+    AssetBytes bytes;
+    if (!ReadAssetView(source, record, bytes))
     {
+        AssetStaging staging;
+        staging.Record = record;
         staging.Error = std::format("could not read skinned mesh source for '{}'", record.Path);
         return staging;
     }
 
+    return DecodeStaged(record, bytes, std::stop_token{});
+}
+
+AssetStaging SkinnedMeshAssetLoader::DecodeStaged(const AssetRecord& record,
+                                                  const AssetBytes& bytes,
+                                                  std::stop_token stop)
+{
+    AssetStaging staging;
+    staging.Record = record;
+
     SkinnedMeshData data;
-    if (!FileLoader.LoadSkinnedFromBytes(bytes, data))
+    if (!FileLoader.LoadSkinnedFromBytes(bytes.Bytes(), data, stop))
     {
+        if (stop.stop_requested())
+            return StoppedStaging(record);
         staging.Error = std::format("failed to parse .skmesh data for '{}'", record.Path);
         return staging;
     }
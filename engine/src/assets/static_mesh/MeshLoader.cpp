@@ -1,92 +1,17 @@
 #include <assets/static_mesh/MeshLoader.h>
 
+#include <assets/static_mesh/MeshQuantization.h>
 #include <assets/static_mesh/StaticMeshFormat.h>
 #include <core/logging/LoggingProvider.h>
 #include <core/serialization/BinaryReader.h>
 #include <render/static_mesh/MeshValidation.h>
 
-#include <algorithm>
-#include <cstring>
 #include <fstream>
-#include <istream>
+#include <utility>
 #include <vector>
 
 namespace
 {
-    class MemoryStreamBuffer final : public std::streambuf
-    {
-    public:
-        explicit MemoryStreamBuffer(std::span<const std::byte> bytes)
-        {
-            char* begin = &Empty;
-            char* end = begin;
-            if (!bytes.empty())
-            {
-                begin = reinterpret_cast<char*>(const_cast<std::byte*>(bytes.data()));
-                end = begin + bytes.size();
-            }
-
-            setg(begin, begin, end);
-        }
-
-    protected:
-        std::streambuf* setbuf(char_type*, std::streamsize) override
-        {
-            return this;
-        }
-
-        std::streamsize xsgetn(char_type* destination, std::streamsize count) override
-        {
-            const std::streamsize available = egptr() - gptr();
-            const std::streamsize toRead = std::min(count, available);
-            if (toRead > 0)
-            {
-                std::memcpy(destination, gptr(), static_cast<size_t>(toRead));
-                gbump(static_cast<int>(toRead));
-            }
-            return toRead;
-        }
-
-        pos_type seekoff(off_type offset,
-                         std::ios_base::seekdir direction,
-                         std::ios_base::openmode which) override
-        {
-            if ((which & std::ios_base::in) == 0)
-                return pos_type(off_type(-1));
-
-            const off_type size = egptr() - eback();
-            off_type next = 0;
-            switch (direction)
-            {
-            case std::ios_base::beg:
-                next = offset;
-                break;
-            case std::ios_base::cur:
-                next = (gptr() - eback()) + offset;
-                break;
-            case std::ios_base::end:
-                next = size + offset;
-                break;
-            default:
-                return pos_type(off_type(-1));
-            }
-
-            if (next < 0 || next > size)
-                return pos_type(off_type(-1));
-
-            setg(eback(), eback() + next, egptr());
-            return pos_type(next);
-        }
-
-        pos_type seekpos(pos_type position, std::ios_base::openmode which) override
-        {
-            return seekoff(off_type(position), std::ios_base::beg, which);
-        }
-
-    private:
-        char Empty = '\0';
-    };
-
     struct ByteRegion
     {
         uint64_t Offset = 0;
@@ -108,31 +33,15 @@ namespace
     template <typename T>
     bool ReadObjectAt(BinaryReader& reader, size_t offset, T& out)
     {
-        std::istream& stream = reader.GetStream();
-        stream.clear();
-        stream.seekg(static_cast<std::streamoff>(offset), std::ios::beg);
-        if (!stream.good())
-            return false;
-
-        return reader.Read(out);
+        return reader.Seek(static_cast<std::streamoff>(offset))
+            && reader.Read(out);
     }
 
     template <typename T>
     bool ReadArrayAt(BinaryReader& reader, size_t offset, size_t count, std::vector<T>& out)
     {
-        std::istream& stream = reader.GetStream();
-        stream.clear();
-        stream.seekg(static_cast<std::streamoff>(offset), std::ios::beg);
-        if (!stream.good())
-            return false;
-
-        out.resize(count);
-        if (count == 0)
-            return true;
-
-        return reader.ReadBytes(
-            reinterpret_cast<char*>(out.data()),
-            static_cast<std::streamsize>(sizeof(T) * count));
+        return reader.Seek(static_cast<std::streamoff>(offset))
+            && reader.ReadArray(out, count);
     }
 
     bool IsRegionWithinFile(const ByteRegion& region, size_t fileSize)
@@ -156,9 +65,11 @@ bool MeshLoader::LoadFromFile(std::string_view path, MeshGeometry& out)
     return LoadFromFileImpl(path, out, nullptr);
 }
 
-bool MeshLoader::LoadFromBytes(std::span<const std::byte> bytes, MeshGeometry& out)
+bool MeshLoader::LoadFromBytes(std::span<const std::byte> bytes,
+                               MeshGeometry& out,
+                               std::stop_token stop)
 {
-    return LoadFromBytesImpl(bytes, "<memory>", out, nullptr);
+    return LoadFromBytesImpl(bytes, "<memory>", out, nullptr, stop);
 }
 
 bool MeshLoader::LoadSkinnedFromFile(std::string_view path, SkinnedMeshData& out)
@@ -167,10 +78,12 @@ bool MeshLoader::LoadSkinnedFromFile(std::string_view path, SkinnedMeshData& out
     return LoadFromFileImpl(path, out.Geometry, &out.Skinning);
 }
 
-bool MeshLoader::LoadSkinnedFromBytes(std::span<const std::byte> bytes, SkinnedMeshData& out)
+bool MeshLoader::LoadSkinnedFromBytes(std::span<const std::byte> bytes,
+                                      SkinnedMeshData& out,
+                                      std::stop_token stop)
 {
     out = {};
-    return LoadFromBytesImpl(bytes, "<memory>", out.Geometry, &out.Skinning);
+    return LoadFromBytesImpl(bytes, "<memory>", out.Geometry, &out.Skinning, stop);
 }
 
 bool MeshLoader::LoadFromFileImpl(std::string_view path,
@@ -194,28 +107,41 @@ bool MeshLoader::LoadFromFileImpl(std::string_view path,
 
     stream.seekg(0, std::ios::beg);
     BinaryReader reader(stream);
-    return LoadFromReader(reader, static_cast<size_t>(size), path, outGeometry, outSkinning);
+    return LoadFromReader(
+        reader, static_cast<size_t>(size), path, outGeometry, outSkinning, std::stop_token{});
 }
 
 bool MeshLoader::LoadFromBytesImpl(std::span<const std::byte> bytes,
                                    std::string_view sourceName,
                                    MeshGeometry& outGeometry,
-                                   MeshSkinning* outSkinning)
+                                   MeshSkinning* outSkinning,
+                                   const std::stop_token& stop)
 {
-    MemoryStreamBuffer buffer(bytes);
-    std::istream stream(&buffer);
-    BinaryReader reader(stream);
-    return LoadFromReader(reader, bytes.size(), sourceName, outGeometry, outSkinning);
+    SpanReader memory(bytes);
+    BinaryReader reader(memory);
+    return LoadFromReader(reader, bytes.size(), sourceName, outGeometry, outSkinning, stop);
 }
 
 bool MeshLoader::LoadFromReader(BinaryReader& reader,
                                 size_t fileSize,
                                 std::string_view sourceName,
                                 MeshGeometry& out,
-                                MeshSkinning* outSkinning)
+                                MeshSkinning* outSkinning,
+                                const std::stop_token& stop)
 {
     out = {};
 
+    // A stopped load drops what it has built; the staged driver reports it.
+    const auto stopped = [&]
+    {
+        if (!stop.stop_requested())
+            return false;
+        out = {};
+        if (outSkinning != nullptr)
+            *outSkinning = {};
+        return true;
+    };
+
     if (fileSize < sizeof(SmeshFileHeader))
     {
         Log.Error("MeshLoader: failed to load '{}': file too small", sourceName);
@@ -240,7 +166,8 @@ bool MeshLoader::LoadFromReader(BinaryReader& reader,
         return false;
     }
     const bool skinned = (header.Flags & kSmeshFlagSkinned) != 0;
-    if ((header.Flags & ~(kSmeshFlagSkinned | kSmeshFlagLightmapUv)) != 0)
+    const bool quantized = (header.Flags & kSmeshFlagQuantized) != 0;
+    if ((header.Flags & ~(kSmeshFlagSkinned | kSmeshFlagLightmapUv | kSmeshFlagQuantized)) != 0)
     {
         Log.Error("MeshLoader: failed to load '{}': unsupported flags", sourceName);
         return false;
@@ -270,12 +197,15 @@ bool MeshLoader::LoadFromReader(BinaryReader& reader,
         Log.Error("MeshLoader: failed to load '{}': header size mismatch", sourceName);
         return false;
     }
-    if (header.VertexStride != sizeof(StaticMeshVertex))
+    const size_t vertexStride = quantized ? sizeof(SmeshQuantizedVertex) : sizeof(StaticMeshVertex);
+    if (header.VertexStride != vertexStride)
     {
         Log.Error("MeshLoader: failed to load '{}': vertex stride mismatch", sourceName);
         return false;
     }
-    if (header.IndexFormat != SmeshIndexFormat::UInt32)
+    // Section-relative UInt16 indices only come with the quantized layout.
+    const bool shortIndices = header.IndexFormat == SmeshIndexFormat::UInt16;
+    if (header.IndexFormat != SmeshIndexFormat::UInt32 && !(shortIndices && quantized))
     {
         Log.Error("MeshLoader: failed to load '{}': unsupported index format", sourceName);
         return false;
@@ -291,10 +221,49 @@ bool MeshLoader::LoadFromReader(BinaryReader& reader,
         return false;
     }
 
-    const uint64_t sectionBytes = uint64_t(sizeof(SmeshSectionRecord)) * header.SectionCount;
-    const uint64_t vertexBytes = uint64_t(sizeof(StaticMeshVertex)) * header.VertexCount;
-    const uint64_t indexBytes = uint64_t(sizeof(uint32_t)) * header.IndexCount;
+    // The section records say how long the LOD and meshlet tables behind
+    // them are, so they are read before the rest of the layout is checked.
+    const ByteRegion recordTable{
+        .Offset = header.SectionTableOffset,
+        .Size = uint64_t(sizeof(SmeshSectionRecord)) * header.SectionCount,
+    };
+    std::vector<SmeshSectionRecord> records;
+    if (!IsRegionWithinFile(recordTable, fileSize)
+        || !ReadArrayAt(reader, header.SectionTableOffset, header.SectionCount, records))
+    {
+        Log.Error("MeshLoader: failed to load '{}': could not read section table", sourceName);
+        return false;
+    }
+    uint64_t lodCount = 0;
+    uint64_t meshletCount = 0;
+    for (size_t sectionIndex = 0; sectionIndex < records.size(); ++sectionIndex)
+    {
+        if (records[sectionIndex].LodCount > kMaxMeshLods)
+        {
+            Log.Error("MeshLoader: failed to load '{}': section {} carries more than {} LODs",
+                      sourceName, sectionIndex, kMaxMeshLods);
+            return false;
+        }
+        if (records[sectionIndex].Reserved0 != 0)
+        {
+            Log.Error("MeshLoader: failed to load '{}': section {} reserved field must be zero",
+                      sourceName, sectionIndex);
+            return false;
+        }
+        lodCount += records[sectionIndex].LodCount;
+        meshletCount += records[sectionIndex].MeshletCount;
+    }
+
+    const uint64_t boxBytes = quantized ? uint64_t(sizeof(SmeshQuantBox)) * header.SectionCount : 0;
+    const uint64_t lodBytes = uint64_t(sizeof(SmeshLodRecord)) * lodCount;
+    const uint64_t sectionBytes = recordTable.Size + boxBytes + lodBytes
+        + uint64_t(sizeof(SmeshMeshletRecord)) * meshletCount;
+    const uint64_t vertexBytes = uint64_t(vertexStride) * header.VertexCount;
+    const uint64_t indexBytes =
+        uint64_t(shortIndices ? sizeof(uint16_t) : sizeof(uint32_t)) * header.IndexCount;
 
+    // The quantized layout's box table, the LOD table and the meshlet table
+    // ride at the end of the section region.
     const ByteRegion sections{
         .Offset = header.SectionTableOffset,
         .Size = sectionBytes,
@@ -319,18 +288,42 @@ bool MeshLoader::LoadFromReader(BinaryReader& reader,
         return false;
     }
 
-    std::vector<SmeshSectionRecord> records;
-    if (!ReadArrayAt(reader, header.SectionTableOffset, header.SectionCount, records))
+    std::vector<SmeshLodRecord> lodRecords;
+    if (!ReadArrayAt(reader, static_cast<size_t>(recordTable.End() + boxBytes),
+                     static_cast<size_t>(lodCount), lodRecords))
     {
-        Log.Error("MeshLoader: failed to load '{}': could not read section table", sourceName);
+        Log.Error("MeshLoader: failed to load '{}': could not read LOD table", sourceName);
         return false;
     }
-    if (!ReadArrayAt(reader, header.VertexDataOffset, header.VertexCount, out.Vertices))
+    std::vector<SmeshMeshletRecord> meshletRecords;
+    if (!ReadArrayAt(reader, static_cast<size_t>(recordTable.End() + boxBytes + lodBytes),
+                     static_cast<size_t>(meshletCount), meshletRecords))
+    {
+        Log.Error("MeshLoader: failed to load '{}': could not read meshlet table", sourceName);
+        return false;
+    }
+    if (stopped())
+        return false;
+    std::vector<SmeshQuantBox> boxes;
+    std::vector<SmeshQuantizedVertex> packedVertices;
+    const bool vertexRead = quantized
+        ? ReadArrayAt(reader,
+                      static_cast<size_t>(recordTable.End()),
+                      header.SectionCount, boxes)
+            && ReadArrayAt(reader, header.VertexDataOffset, header.VertexCount, packedVertices)
+        : ReadArrayAt(reader, header.VertexDataOffset, header.VertexCount, out.Vertices);
+    if (!vertexRead)
     {
         Log.Error("MeshLoader: failed to load '{}': could not read vertex data", sourceName);
         return false;
     }
-    if (!ReadArrayAt(reader, header.IndexDataOffset, header.IndexCount, out.Indices))
+    if (stopped())
+        return false;
+    std::vector<uint16_t> shortIndexData;
+    const bool indexRead = shortIndices
+        ? ReadArrayAt(reader, header.IndexDataOffset, header.IndexCount, shortIndexData)
+        : ReadArrayAt(reader, header.IndexDataOffset, header.IndexCount, out.Indices);
+    if (!indexRead)
     {
         Log.Error("MeshLoader: failed to load '{}': could not read index data", sourceName);
         return false;
@@ -391,17 +384,13 @@ bool MeshLoader::LoadFromReader(BinaryReader& reader,
 
     out.LocalBounds = ReadBounds(header.BoundsMin, header.BoundsMax);
     out.Sections.reserve(records.size());
+    size_t nextLod = 0;
+    size_t nextMeshlet = 0;
     for (size_t sectionIndex = 0; sectionIndex < records.size(); ++sectionIndex)
     {
-        const SmeshSectionRecord& record = records[sectionIndex];
-        if (record.Reserved0 != 0)
-        {
-            Log.Error("MeshLoader: failed to load '{}': section {} reserved field must be zero",
-                      sourceName, sectionIndex);
-            out = {};
+        if (stopped())
             return false;
-        }
-
+        const SmeshSectionRecord& record = records[sectionIndex];
         StaticMeshSection section;
         section.IndexOffset = record.IndexOffset;
         section.IndexCount = record.IndexCount;
@@ -409,9 +398,83 @@ bool MeshLoader::LoadFromReader(BinaryReader& reader,
         section.VertexCount = record.VertexCount;
         section.MaterialSlot = record.MaterialSlot;
         section.LocalBounds = ReadBounds(record.BoundsMin, record.BoundsMax);
-        out.Sections.push_back(section);
+        for (uint32_t lod = 0; lod < record.LodCount; ++lod, ++nextLod)
+        {
+            const SmeshLodRecord& lodRecord = lodRecords[nextLod];
+            if (lodRecord.Reserved0 != 0)
+            {
+                Log.Error("MeshLoader: failed to load '{}': section {} LOD {} reserved field must be zero",
+                          sourceName, sectionIndex, lod + 1);
+                out = {};
+                return false;
+            }
+            section.Lods.push_back(StaticMeshLod{
+                .IndexOffset = lodRecord.IndexOffset,
+                .IndexCount = lodRecord.IndexCount,
+                .Error = lodRecord.Error,
+            });
+        }
+        section.Meshlets.reserve(record.MeshletCount);
+        for (uint32_t meshlet = 0; meshlet < record.MeshletCount; ++meshlet, ++nextMeshlet)
+        {
+            const SmeshMeshletRecord& meshletRecord = meshletRecords[nextMeshlet];
+            section.Meshlets.push_back(StaticMeshMeshlet{
+                .IndexOffset = meshletRecord.IndexOffset,
+                .IndexCount = meshletRecord.IndexCount,
+                .Center = Vec3d(meshletRecord.Center[0], meshletRecord.Center[1], meshletRecord.Center[2]),
+                .Radius = meshletRecord.Radius,
+                .ConeAxis = Vec3d(meshletRecord.ConeAxis[0], meshletRecord.ConeAxis[1], meshletRecord.ConeAxis[2]),
+                .ConeCutoff = meshletRecord.ConeCutoff,
+            });
+        }
+        out.Sections.push_back(std::move(section));
+    }
+
+    if (stopped())
+        return false;
+    if (quantized)
+    {
+        const std::vector<uint32_t> owners = AssignQuantOwners(out.Sections, packedVertices.size());
+        out.Vertices.reserve(packedVertices.size());
+        for (size_t vertex = 0; vertex < packedVertices.size(); ++vertex)
+        {
+            if (owners[vertex] == kSmeshNoOwner)
+            {
+                Log.Error("MeshLoader: failed to load '{}': vertex {} lies in no section",
+                          sourceName, vertex);
+                out = {};
+                return false;
+            }
+            out.Vertices.push_back(DequantizeVertex(packedVertices[vertex], boxes[owners[vertex]]));
+        }
+    }
+    if (shortIndices)
+    {
+        if (!SectionsFitUInt16Indices(out.Sections, shortIndexData.size()))
+        {
+            Log.Error("MeshLoader: failed to load '{}': UInt16 indices need sections that "
+                      "partition the index stream", sourceName);
+            out = {};
+            return false;
+        }
+        out.Indices.resize(shortIndexData.size());
+        for (const StaticMeshSection& section : out.Sections)
+        {
+            if (stopped())
+                return false;
+            const auto rebase = [&](uint32_t offset, uint32_t count)
+            {
+                for (uint32_t index = offset; index < offset + count; ++index)
+                    out.Indices[index] = section.VertexOffset + shortIndexData[index];
+            };
+            rebase(section.IndexOffset, section.IndexCount);
+            for (const StaticMeshLod& lod : section.Lods)
+                rebase(lod.IndexOffset, lod.IndexCount);
+        }
     }
 
+    if (stopped())
+        return false;
     const MeshValidationResult validation = skinned
         ? ValidateSkinnedMeshData(SkinnedMeshData{ out, *outSkinning })
         : ValidateMeshGeometry(out);
@@ -0,0 +1,188 @@
+#include <assets/static_mesh/MeshQuantization.h>
+
+#include <assets/probes/ProbeVolumeFormat.h> // FloatToHalf, HalfToFloat
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+namespace
+{
+    constexpr float kPositionLevels = 65535.0f;
+    constexpr float kSnorm16 = 32767.0f;
+
+    float SignNotZero(float value)
+    {
+        return value < 0.0f ? -1.0f : 1.0f;
+    }
+
+    int16_t ToSnorm16(float value)
+    {
+        return static_cast<int16_t>(std::lround(std::clamp(value, -1.0f, 1.0f) * kSnorm16));
+    }
+}
+
+void EncodeOctahedral(const Vec3d& direction, int16_t (&out)[2])
+{
+    const float l1 = std::abs(direction.X) + std::abs(direction.Y) + std::abs(direction.Z);
+    if (!(l1 > 0.0f))
+    {
+        out[0] = 0;
+        out[1] = 0;
+        return;
+    }
+
+    float u = direction.X / l1;
+    float v = direction.Y / l1;
+    if (direction.Z < 0.0f)
+    {
+        // Fold the lower hemisphere over the diagonals.
+        const float foldedU = (1.0f - std::abs(v)) * SignNotZero(u);
+        const float foldedV = (1.0f - std::abs(u)) * SignNotZero(v);
+        u = foldedU;
+        v = foldedV;
+    }
+    out[0] = ToSnorm16(u);
+    out[1] = ToSnorm16(v);
+}
+
+Vec3d DecodeOctahedral(const int16_t (&encoded)[2])
+{
+    float u = std::max(static_cast<float>(encoded[0]) / kSnorm16, -1.0f);
+    float v = std::max(static_cast<float>(encoded[1]) / kSnorm16, -1.0f);
+    const float z = 1.0f - std::abs(u) - std::abs(v);
+    if (z < 0.0f)
+    {
+        const float unfoldedU = (1.0f - std::abs(v)) * SignNotZero(u);
+        const float unfoldedV = (1.0f - std::abs(u)) * SignNotZero(v);
+        u = unfoldedU;
+        v = unfoldedV;
+    }
+
+    const float length = std::sqrt(u * u + v * v + z * z);
+    return Vec3d(u / length, v / length, z / length);
+}
+
+std::vector<uint32_t> AssignQuantOwners(std::span<const StaticMeshSection> sections,
+                                        std::size_t vertexCount)
+{
+    std::vector<uint32_t> owners(vertexCount, kSmeshNoOwner);
+    for (std::size_t sectionIndex = 0; sectionIndex < sections.size(); ++sectionIndex)
+    {
+        const StaticMeshSection& section = sections[sectionIndex];
+        const std::size_t begin = std::min<std::size_t>(section.VertexOffset, vertexCount);
+        const std::size_t end =
+            std::min<std::size_t>(std::size_t(section.VertexOffset) + section.VertexCount, vertexCount);
+        for (std::size_t vertex = begin; vertex < end; ++vertex)
+        {
+            if (owners[vertex] == kSmeshNoOwner)
+                owners[vertex] = static_cast<uint32_t>(sectionIndex);
+        }
+    }
+    return owners;
+}
+
+bool CanQuantizeMesh(const MeshGeometry& mesh, std::span<const uint32_t> owners)
+{
+    if (owners.size() != mesh.Vertices.size())
+        return false;
+    for (std::size_t vertex = 0; vertex < mesh.Vertices.size(); ++vertex)
+    {
+        const Vec2d& uv = mesh.Vertices[vertex].Uv0;
+        if (owners[vertex] == kSmeshNoOwner
+            || !(std::abs(uv.X) <= kSmeshQuantizedUvLimit)
+            || !(std::abs(uv.Y) <= kSmeshQuantizedUvLimit))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool SectionsFitUInt16Indices(std::span<const StaticMeshSection> sections,
+                              std::size_t indexCount)
+{
+    // Every range a section draws from -- its own, then each LOD's -- as
+    // (offset, count).
+    std::vector<std::pair<uint32_t, uint32_t>> ranges;
+    ranges.reserve(sections.size());
+    for (const StaticMeshSection& section : sections)
+    {
+        if (section.VertexCount > uint32_t{ std::numeric_limits<uint16_t>::max() } + 1)
+            return false;
+        ranges.emplace_back(section.IndexOffset, section.IndexCount);
+        for (const StaticMeshLod& lod : section.Lods)
+            ranges.emplace_back(lod.IndexOffset, lod.IndexCount);
+    }
+    std::sort(ranges.begin(), ranges.end());
+
+    std::size_t covered = 0;
+    for (const auto& [offset, count] : ranges)
+    {
+        if (offset != covered)
+            return false;
+        covered += count;
+    }
+    return covered == indexCount;
+}
+
+std::vector<SmeshQuantBox> ComputeQuantBoxes(const MeshGeometry& mesh,
+                                             std::span<const uint32_t> owners)
+{
+    std::vector<Aabb3d> bounds(mesh.Sections.size(), Aabb3d::Empty());
+    for (std::size_t vertex = 0; vertex < mesh.Vertices.size() && vertex < owners.size(); ++vertex)
+    {
+        if (owners[vertex] < bounds.size())
+            bounds[owners[vertex]].ExpandToInclude(mesh.Vertices[vertex].Position);
+    }
+
+    std::vector<SmeshQuantBox> boxes(mesh.Sections.size());
+    for (std::size_t sectionIndex = 0; sectionIndex < boxes.size(); ++sectionIndex)
+    {
+        // A section that owns no vertex keeps the zero box; nothing reads it.
+        if (!bounds[sectionIndex].IsValid())
+            continue;
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            const float low = bounds[sectionIndex].Min[axis];
+            const float high = bounds[sectionIndex].Max[axis];
+            boxes[sectionIndex].Origin[axis] = low;
+            boxes[sectionIndex].Step[axis] = (high - low) / kPositionLevels;
+        }
+    }
+    return boxes;
+}
+
+SmeshQuantizedVertex QuantizeVertex(const StaticMeshVertex& vertex, const SmeshQuantBox& box)
+{
+    SmeshQuantizedVertex out;
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        const float offset = vertex.Position[axis] - box.Origin[axis];
+        const float level = box.Step[axis] > 0.0f ? offset / box.Step[axis] : 0.0f;
+        out.Position[axis] = static_cast<uint16_t>(std::lround(std::clamp(level, 0.0f, kPositionLevels)));
+    }
+    out.TangentSign = vertex.Tangent.W < 0.0f ? 1 : 0;
+    EncodeOctahedral(vertex.Normal, out.Normal);
+    EncodeOctahedral(Vec3d(vertex.Tangent.X, vertex.Tangent.Y, vertex.Tangent.Z), out.Tangent);
+    out.Uv0[0] = FloatToHalf(vertex.Uv0.X);
+    out.Uv0[1] = FloatToHalf(vertex.Uv0.Y);
+    out.LightmapU = vertex.LightmapU;
+    out.LightmapV = vertex.LightmapV;
+    return out;
+}
+
+StaticMeshVertex DequantizeVertex(const SmeshQuantizedVertex& vertex, const SmeshQuantBox& box)
+{
+    StaticMeshVertex out;
+    for (int axis = 0; axis < 3; ++axis)
+        out.Position[axis] = box.Origin[axis] + static_cast<float>(vertex.Position[axis]) * box.Step[axis];
+    out.Normal = DecodeOctahedral(vertex.Normal);
+    const Vec3d tangent = DecodeOctahedral(vertex.Tangent);
+    out.Tangent = Vec4(tangent.X, tangent.Y, tangent.Z, (vertex.TangentSign & 1u) != 0 ? -1.0f : 1.0f);
+    out.Uv0 = Vec2d(HalfToFloat(vertex.Uv0[0]), HalfToFloat(vertex.Uv0[1]));
+    out.LightmapU = vertex.LightmapU;
+    out.LightmapV = vertex.LightmapV;
+    return out;
+}
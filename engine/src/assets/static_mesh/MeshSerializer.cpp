@@ -1,13 +1,12 @@
 #include <assets/static_mesh/MeshSerializer.h>
 
+#include <assets/static_mesh/MeshQuantization.h>
 #include <assets/static_mesh/StaticMeshFormat.h>
 #include <core/logging/LoggingProvider.h>
 #include <core/serialization/BinaryWriter.h>
 #include <render/static_mesh/MeshValidation.h>
 
-#include <cstring>
 #include <fstream>
-#include <sstream>
 
 namespace
 {
@@ -40,17 +39,10 @@ namespace
         }
         return true;
     }
-
-    void CopyToBytes(std::ostringstream& stream, std::vector<std::byte>& out)
-    {
-        const std::string bytes = stream.str();
-        out.resize(bytes.size());
-        if (!bytes.empty())
-            std::memcpy(out.data(), bytes.data(), bytes.size());
-    }
 }
 
-bool MeshSerializer::WriteToFile(std::string_view path, const MeshGeometry& mesh)
+bool MeshSerializer::WriteToFile(std::string_view path, const MeshGeometry& mesh,
+                                 SmeshVertexLayout layout)
 {
     std::ofstream stream(std::string(path), std::ios::binary);
     if (!stream.is_open())
@@ -59,20 +51,22 @@ bool MeshSerializer::WriteToFile(std::string_view path, const MeshGeometry& mesh
         return false;
     }
     BinaryWriter writer(stream);
-    return FinishFileWrite(stream, Log, path, WriteToWriter(writer, mesh, nullptr));
+    return FinishFileWrite(stream, Log, path, WriteToWriter(writer, mesh, nullptr, layout));
 }
 
-bool MeshSerializer::WriteToBytes(const MeshGeometry& mesh, std::vector<std::byte>& out)
+bool MeshSerializer::WriteToBytes(const MeshGeometry& mesh, std::vector<std::byte>& out,
+                                  SmeshVertexLayout layout)
 {
-    std::ostringstream stream(std::ios::binary);
-    BinaryWriter writer(stream);
-    if (!WriteToWriter(writer, mesh, nullptr))
+    GrowableWriter memory;
+    BinaryWriter writer(memory);
+    if (!WriteToWriter(writer, mesh, nullptr, layout))
         return false;
-    CopyToBytes(stream, out);
+    out = memory.Take();
     return true;
 }
 
-bool MeshSerializer::WriteSkinnedToFile(std::string_view path, const SkinnedMeshData& mesh)
+bool MeshSerializer::WriteSkinnedToFile(std::string_view path, const SkinnedMeshData& mesh,
+                                        SmeshVertexLayout layout)
 {
     std::ofstream stream(std::string(path), std::ios::binary);
     if (!stream.is_open())
@@ -81,22 +75,24 @@ bool MeshSerializer::WriteSkinnedToFile(std::string_view path, const SkinnedMesh
         return false;
     }
     BinaryWriter writer(stream);
-    return FinishFileWrite(stream, Log, path, WriteToWriter(writer, mesh.Geometry, &mesh.Skinning));
+    return FinishFileWrite(stream, Log, path, WriteToWriter(writer, mesh.Geometry, &mesh.Skinning, layout));
 }
 
-bool MeshSerializer::WriteSkinnedToBytes(const SkinnedMeshData& mesh, std::vector<std::byte>& out)
+bool MeshSerializer::WriteSkinnedToBytes(const SkinnedMeshData& mesh, std::vector<std::byte>& out,
+                                         SmeshVertexLayout layout)
 {
-    std::ostringstream stream(std::ios::binary);
-    BinaryWriter writer(stream);
-    if (!WriteToWriter(writer, mesh.Geometry, &mesh.Skinning))
+    GrowableWriter memory;
+    BinaryWriter writer(memory);
+    if (!WriteToWriter(writer, mesh.Geometry, &mesh.Skinning, layout))
         return false;
-    CopyToBytes(stream, out);
+    out = memory.Take();
     return true;
 }
 
 bool MeshSerializer::WriteToWriter(BinaryWriter& writer,
                                    const MeshGeometry& mesh,
-                                   const MeshSkinning* skinningPtr)
+                                   const MeshSkinning* skinningPtr,
+                                   SmeshVertexLayout layout)
 {
     MeshGeometry canonical = mesh;
     RecomputeMeshBounds(canonical);
@@ -127,24 +123,79 @@ bool MeshSerializer::WriteToWriter(BinaryWriter& writer,
             header.Flags |= kSmeshFlagLightmapUv;
             break;
         }
+
+    std::vector<uint32_t> owners;
+    bool quantized = false;
+    if (layout == SmeshVertexLayout::Quantized)
+    {
+        owners = AssignQuantOwners(canonical.Sections, canonical.Vertices.size());
+        quantized = CanQuantizeMesh(canonical, owners);
+    }
+    const bool shortIndices = quantized
+        && SectionsFitUInt16Indices(canonical.Sections, canonical.Indices.size());
+    const uint32_t vertexStride = quantized
+        ? static_cast<uint32_t>(sizeof(SmeshQuantizedVertex))
+        : static_cast<uint32_t>(sizeof(StaticMeshVertex));
+    const uint32_t indexSize = shortIndices ? sizeof(uint16_t) : sizeof(uint32_t);
+    const uint32_t boxTableSize = quantized
+        ? static_cast<uint32_t>(sizeof(SmeshQuantBox) * canonical.Sections.size())
+        : 0;
+    std::vector<SmeshLodRecord> lodRecords;
+    for (const StaticMeshSection& section : canonical.Sections)
+    {
+        for (const StaticMeshLod& lod : section.Lods)
+        {
+            lodRecords.push_back(SmeshLodRecord{
+                .IndexOffset = lod.IndexOffset,
+                .IndexCount = lod.IndexCount,
+                .Error = lod.Error,
+            });
+        }
+    }
+    const uint32_t lodTableSize = static_cast<uint32_t>(sizeof(SmeshLodRecord) * lodRecords.size());
+    std::vector<SmeshMeshletRecord> meshletRecords;
+    for (const StaticMeshSection& section : canonical.Sections)
+    {
+        for (const StaticMeshMeshlet& meshlet : section.Meshlets)
+        {
+            meshletRecords.push_back(SmeshMeshletRecord{
+                .IndexOffset = meshlet.IndexOffset,
+                .IndexCount = meshlet.IndexCount,
+                .Center = { meshlet.Center.X, meshlet.Center.Y, meshlet.Center.Z },
+                .Radius = meshlet.Radius,
+                .ConeAxis = { meshlet.ConeAxis.X, meshlet.ConeAxis.Y, meshlet.ConeAxis.Z },
+                .ConeCutoff = meshlet.ConeCutoff,
+            });
+        }
+    }
+    const uint32_t meshletTableSize =
+        static_cast<uint32_t>(sizeof(SmeshMeshletRecord) * meshletRecords.size());
+    // Keeps whatever follows a UInt16 index stream 4-byte aligned.
+    const uint32_t indexBytes = static_cast<uint32_t>(indexSize * canonical.Indices.size());
+    const uint32_t indexPadding = (4 - indexBytes % 4) % 4;
+
+    if (quantized)
+        header.Flags |= kSmeshFlagQuantized;
     header.VertexCount = static_cast<uint32_t>(canonical.Vertices.size());
     header.IndexCount = static_cast<uint32_t>(canonical.Indices.size());
     header.SectionCount = static_cast<uint32_t>(canonical.Sections.size());
-    header.VertexStride = sizeof(StaticMeshVertex);
-    header.IndexFormat = SmeshIndexFormat::UInt32;
+    header.VertexStride = vertexStride;
+    header.IndexFormat = shortIndices ? SmeshIndexFormat::UInt16 : SmeshIndexFormat::UInt32;
     header.Topology = SmeshTopology::TriangleList;
     WriteBounds(canonical.LocalBounds, header.BoundsMin, header.BoundsMax);
     header.HeaderSize = sizeof(SmeshFileHeader);
     header.SectionTableOffset = header.HeaderSize;
     header.VertexDataOffset = header.SectionTableOffset
-        + static_cast<uint32_t>(sizeof(SmeshSectionRecord) * canonical.Sections.size());
+        + static_cast<uint32_t>(sizeof(SmeshSectionRecord) * canonical.Sections.size())
+        + boxTableSize
+        + lodTableSize
+        + meshletTableSize;
     header.IndexDataOffset = header.VertexDataOffset
-        + static_cast<uint32_t>(sizeof(StaticMeshVertex) * canonical.Vertices.size());
+        + vertexStride * static_cast<uint32_t>(canonical.Vertices.size());
     if (skinned)
     {
         header.JointCount = skinningPtr->JointCount;
-        header.SkinningDataOffset = header.IndexDataOffset
-            + static_cast<uint32_t>(sizeof(uint32_t) * canonical.Indices.size());
+        header.SkinningDataOffset = header.IndexDataOffset + indexBytes + indexPadding;
         header.SkeletonPathOffset = header.SkinningDataOffset
             + static_cast<uint32_t>(sizeof(MeshSkinInfluence) * skinningPtr->Influences.size());
     }
@@ -160,29 +211,92 @@ bool MeshSerializer::WriteToWriter(BinaryWriter& writer,
         record.VertexOffset = section.VertexOffset;
         record.VertexCount = section.VertexCount;
         record.MaterialSlot = section.MaterialSlot;
-        record.Reserved0 = 0;
+        record.LodCount = static_cast<uint32_t>(section.Lods.size());
         WriteBounds(section.LocalBounds, record.BoundsMin, record.BoundsMax);
+        record.MeshletCount = static_cast<uint32_t>(section.Meshlets.size());
 
         if (!writer.Write(record))
             return false;
     }
 
-    if (!canonical.Vertices.empty()
-        && !writer.WriteBytes(
-            reinterpret_cast<const char*>(canonical.Vertices.data()),
-            static_cast<std::streamsize>(sizeof(StaticMeshVertex) * canonical.Vertices.size())))
+    std::vector<SmeshQuantBox> boxes;
+    if (quantized)
+    {
+        boxes = ComputeQuantBoxes(canonical, owners);
+        if (!writer.WriteBytes(reinterpret_cast<const char*>(boxes.data()),
+                               static_cast<std::streamsize>(boxTableSize)))
+        {
+            return false;
+        }
+    }
+    if (!lodRecords.empty()
+        && !writer.WriteBytes(reinterpret_cast<const char*>(lodRecords.data()),
+                              static_cast<std::streamsize>(lodTableSize)))
+    {
+        return false;
+    }
+    if (!meshletRecords.empty()
+        && !writer.WriteBytes(reinterpret_cast<const char*>(meshletRecords.data()),
+                              static_cast<std::streamsize>(meshletTableSize)))
     {
         return false;
     }
 
-    if (!canonical.Indices.empty()
-        && !writer.WriteBytes(
-            reinterpret_cast<const char*>(canonical.Indices.data()),
-            static_cast<std::streamsize>(sizeof(uint32_t) * canonical.Indices.size())))
+    if (quantized)
+    {
+        std::vector<SmeshQuantizedVertex> packed;
+        packed.reserve(canonical.Vertices.size());
+        for (size_t vertex = 0; vertex < canonical.Vertices.size(); ++vertex)
+            packed.push_back(QuantizeVertex(canonical.Vertices[vertex], boxes[owners[vertex]]));
+
+        if (!writer.WriteBytes(reinterpret_cast<const char*>(packed.data()),
+                               static_cast<std::streamsize>(sizeof(SmeshQuantizedVertex) * packed.size())))
+        {
+            return false;
+        }
+    }
+    else if (!canonical.Vertices.empty()
+             && !writer.WriteBytes(
+                 reinterpret_cast<const char*>(canonical.Vertices.data()),
+                 static_cast<std::streamsize>(sizeof(StaticMeshVertex) * canonical.Vertices.size())))
     {
         return false;
     }
 
+    if (shortIndices)
+    {
+        std::vector<uint16_t> relative(canonical.Indices.size());
+        for (const StaticMeshSection& section : canonical.Sections)
+        {
+            const auto rebase = [&](uint32_t offset, uint32_t count)
+            {
+                for (uint32_t index = offset; index < offset + count; ++index)
+                    relative[index] = static_cast<uint16_t>(canonical.Indices[index] - section.VertexOffset);
+            };
+            rebase(section.IndexOffset, section.IndexCount);
+            for (const StaticMeshLod& lod : section.Lods)
+                rebase(lod.IndexOffset, lod.IndexCount);
+        }
+        if (!writer.WriteBytes(reinterpret_cast<const char*>(relative.data()),
+                               static_cast<std::streamsize>(indexBytes)))
+        {
+            return false;
+        }
+    }
+    else if (!canonical.Indices.empty()
+             && !writer.WriteBytes(
+                 reinterpret_cast<const char*>(canonical.Indices.data()),
+                 static_cast<std::streamsize>(sizeof(uint32_t) * canonical.Indices.size())))
+    {
+        return false;
+    }
+    if (skinned && indexPadding != 0)
+    {
+        const char zeros[4]{};
+        if (!writer.WriteBytes(zeros, static_cast<std::streamsize>(indexPadding)))
+            return false;
+    }
+
     if (skinned)
     {
         if (!writer.WriteBytes(
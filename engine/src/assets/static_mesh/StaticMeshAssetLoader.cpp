@@ -16,19 +16,33 @@ StaticMeshAssetLoader::StaticMeshAssetLoader(LoggingProvider& logging, StaticMes
 
 AssetStaging StaticMeshAssetLoader::LoadStaged(const AssetRecord& record, IAssetSource& source)
 {
-    AssetStaging staging;
-    staging.Record = record;
-
-    std::vector<std::byte> bytes;
-    if (!ReadAssetBytes(source, record, bytes))
+    AssetBytes bytes;
+    if (!ReadAssetView(source, record, bytes))
     {
+        AssetStaging staging;
+        staging.Record = record;
         staging.Error = std::format("could not read static mesh source for '{}'", record.Path);
         return staging;
     }
 
+    return DecodeStaged(record, bytes, std::stop_token{});
+}
+
+AssetStaging StaticMeshAssetLoader::DecodeStaged(const AssetRecord& record,
+                                                 const AssetBytes& bytes,
+                                                 std::stop_token stop)
+{
+    AssetStaging staging;
+    staging.Record = record;
+
+    // Decoded straight out of the view: for a packed mesh the file's bytes
+    // are never copied whole, only into the geometry streams. The view is
+    // released by the caller; MeshGeometry owns what it keeps.
     MeshGeometry data;
-    if (!FileLoader.LoadFromBytes(bytes, data))
+    if (!FileLoader.LoadFromBytes(bytes.Bytes(), data, stop))
     {
+        if (stop.stop_requested())
+            return StoppedStaging(record);
         staging.Error = std::format("failed to parse .smesh data for '{}'", record.Path);
         return staging;
     }
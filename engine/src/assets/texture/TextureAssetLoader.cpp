@@ -27,25 +27,46 @@ AssetStaging TextureAssetLoader::LoadStaged(const AssetRecord& record,
                                             IAssetSource& source,
                                             bool srgb)
 {
-    AssetStaging staging;
-    staging.Record = record;
-
-    std::vector<std::byte> bytes;
-    if (!ReadAssetBytes(source, record, bytes))
+    AssetBytes bytes;
+    if (!ReadAssetView(source, record, bytes))
     {
+        AssetStaging staging;
+        staging.Record = record;
         staging.Error = std::format("could not read texture source for '{}'", record.Path);
         return staging;
     }
 
+    return DecodeStaged(record, bytes, srgb);
+}
+
+AssetStaging TextureAssetLoader::DecodeStaged(const AssetRecord& record,
+                                              const AssetBytes& bytes,
+                                              std::stop_token stop)
+{
+    return DecodeStaged(record, bytes, /*srgb*/ true, std::move(stop));
+}
+
+AssetStaging TextureAssetLoader::DecodeStaged(const AssetRecord& record,
+                                              const AssetBytes& bytes,
+                                              bool srgb,
+                                              std::stop_token stop)
+{
+    AssetStaging staging;
+    staging.Record = record;
+
     // Sniff the container magic rather than trusting the extension: a cooked
     // artifact keeps its source's virtual path (Decision B), so the path may
     // say ".png" while the bytes are a cooked .stex. The .stex carries its
     // own format and usage tags — `srgb` applies only to loose image bytes.
+    // The payload borrows its mip chain from the view, so the commit's
+    // upload is the one copy those bytes take, and there is no per-mip work
+    // here to stop between. A loose image is decoded whole, so the stop is
+    // checked once, before the decode starts.
     if (LooksLikeStex(bytes.data(), bytes.size()))
     {
         TextureData texture;
         std::string stexError;
-        if (!LoadStexFromBytes(bytes, texture, &stexError))
+        if (!LoadStexFromView(bytes, texture, &stexError))
         {
             staging.Error = std::format("failed to parse .stex for '{}': {}",
                                         record.Path, stexError);
@@ -56,6 +77,9 @@ AssetStaging TextureAssetLoader::LoadStaged(const AssetRecord& record,
         return staging;
     }
 
+    if (stop.stop_requested())
+        return StoppedStaging(record);
+
     std::optional<Image> image = LoadImageFromMemory(
         reinterpret_cast<const uint8_t*>(bytes.data()), static_cast<int>(bytes.size()), srgb);
     if (!image)
@@ -86,8 +110,8 @@ TextureHandle TextureAssetLoader::CommitTyped(AssetStaging&& staged)
     TextureHandle handle{};
     if (TextureData* texture = std::any_cast<TextureData>(&staged.Payload))
     {
-        handle = Cache->CreateFromTextureData(staged.Record.Path, *texture,
-                                              TextureCache::SamplerForTextureData(*texture));
+        const SamplerDesc sampler = TextureCache::SamplerForTextureData(*texture);
+        handle = Cache->CreateFromTextureData(staged.Record.Path, std::move(*texture), sampler);
     }
     else if (Image* image = std::any_cast<Image>(&staged.Payload))
     {
@@ -14,60 +14,96 @@ namespace
     }
 } // namespace
 
+namespace
+{
+    // Everything but the pixels: the header, the mip table, and where the
+    // pixel data lies within `bytes`. The two entry points differ only in
+    // whether the pixels are then copied or borrowed.
+    bool ParseStex(std::span<const std::byte> bytes,
+                   TextureData& texture,
+                   std::span<const std::byte>& pixels,
+                   std::string* error)
+    {
+        if (bytes.size() < sizeof(StexFileHeader))
+            return Fail(error, "stex: byte stream smaller than header");
+
+        StexFileHeader header;
+        std::memcpy(&header, bytes.data(), sizeof(header));
+
+        if (std::memcmp(header.Magic, kStexMagic, sizeof(header.Magic)) != 0)
+            return Fail(error, "stex: bad magic");
+        if (header.Version != kStexVersion)
+            return Fail(error, "stex: unsupported version");
+        if (header.HeaderSize != sizeof(StexFileHeader))
+            return Fail(error, "stex: unexpected header size");
+        if (header.MipCount == 0)
+            return Fail(error, "stex: zero mip count");
+
+        const uint64_t mipTableEnd =
+            uint64_t(header.MipTableOffset) + sizeof(StexMipRecord) * uint64_t(header.MipCount);
+        if (header.MipTableOffset < header.HeaderSize || mipTableEnd > bytes.size())
+            return Fail(error, "stex: mip table out of range");
+        if (header.PixelDataOffset < mipTableEnd)
+            return Fail(error, "stex: pixel data overlaps mip table");
+        if (uint64_t(header.PixelDataOffset) + header.PixelDataSize > bytes.size())
+            return Fail(error, "stex: pixel data out of range");
+
+        texture.Format = header.Format;
+        texture.Usage = header.Usage;
+        texture.Filter = (header.Flags & kStexFlagNearestFilter) != 0 ? TextureFilter::Nearest
+                                                                      : TextureFilter::Linear;
+        texture.Width = header.Width;
+        texture.Height = header.Height;
+
+        texture.Mips.resize(header.MipCount);
+        for (uint32_t i = 0; i < header.MipCount; ++i)
+        {
+            StexMipRecord record;
+            std::memcpy(&record,
+                        bytes.data() + header.MipTableOffset + sizeof(StexMipRecord) * i,
+                        sizeof(record));
+            texture.Mips[i] = TextureMipLevel{
+                .Width = record.Width,
+                .Height = record.Height,
+                .Offset = record.Offset,
+                .ByteSize = record.ByteSize,
+            };
+        }
+
+        pixels = bytes.subspan(header.PixelDataOffset,
+                               static_cast<std::size_t>(header.PixelDataSize));
+        return true;
+    }
+} // namespace
+
 bool LoadStexFromBytes(std::span<const std::byte> bytes, TextureData& out, std::string* error)
 {
-    if (bytes.size() < sizeof(StexFileHeader))
-        return Fail(error, "stex: byte stream smaller than header");
-
-    StexFileHeader header;
-    std::memcpy(&header, bytes.data(), sizeof(header));
-
-    if (std::memcmp(header.Magic, kStexMagic, sizeof(header.Magic)) != 0)
-        return Fail(error, "stex: bad magic");
-    if (header.Version != kStexVersion)
-        return Fail(error, "stex: unsupported version");
-    if (header.HeaderSize != sizeof(StexFileHeader))
-        return Fail(error, "stex: unexpected header size");
-    if (header.MipCount == 0)
-        return Fail(error, "stex: zero mip count");
-
-    const uint64_t mipTableEnd =
-        uint64_t(header.MipTableOffset) + sizeof(StexMipRecord) * uint64_t(header.MipCount);
-    if (header.MipTableOffset < header.HeaderSize || mipTableEnd > bytes.size())
-        return Fail(error, "stex: mip table out of range");
-    if (header.PixelDataOffset < mipTableEnd)
-        return Fail(error, "stex: pixel data overlaps mip table");
-    if (uint64_t(header.PixelDataOffset) + header.PixelDataSize > bytes.size())
-        return Fail(error, "stex: pixel data out of range");
+    TextureData texture;
+    std::span<const std::byte> pixels;
+    if (!ParseStex(bytes, texture, pixels, error))
+        return false;
+
+    texture.Blob.resize(pixels.size());
+    if (!pixels.empty())
+        std::memcpy(texture.Blob.data(), pixels.data(), pixels.size());
 
+    if (!ValidateTextureData(texture))
+        return Fail(error, "stex: structural validation failed");
+
+    out = std::move(texture);
+    return true;
+}
+
+bool LoadStexFromView(const AssetBytes& bytes, TextureData& out, std::string* error)
+{
     TextureData texture;
-    texture.Format = header.Format;
-    texture.Usage = header.Usage;
-    texture.Filter = (header.Flags & kStexFlagNearestFilter) != 0 ? TextureFilter::Nearest
-                                                                  : TextureFilter::Linear;
-    texture.Width = header.Width;
-    texture.Height = header.Height;
-
-    texture.Mips.resize(header.MipCount);
-    for (uint32_t i = 0; i < header.MipCount; ++i)
-    {
-        StexMipRecord record;
-        std::memcpy(&record,
-                    bytes.data() + header.MipTableOffset + sizeof(StexMipRecord) * i,
-                    sizeof(record));
-        texture.Mips[i] = TextureMipLevel{
-            .Width = record.Width,
-            .Height = record.Height,
-            .Offset = record.Offset,
-            .ByteSize = record.ByteSize,
-        };
-    }
+    std::span<const std::byte> pixels;
+    if (!ParseStex(bytes.Bytes(), texture, pixels, error))
+        return false;
 
-    texture.Blob.resize(header.PixelDataSize);
-    if (header.PixelDataSize > 0)
-        std::memcpy(texture.Blob.data(),
-                    bytes.data() + header.PixelDataOffset,
-                    header.PixelDataSize);
+    texture.BorrowedBlob = std::span<const uint8_t>(
+        reinterpret_cast<const uint8_t*>(pixels.data()), pixels.size());
+    texture.BlobOwner = bytes.Keepalive();
 
     if (!ValidateTextureData(texture))
         return Fail(error, "stex: structural validation failed");
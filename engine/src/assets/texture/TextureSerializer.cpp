@@ -6,7 +6,6 @@
 
 #include <cstring>
 #include <fstream>
-#include <sstream>
 
 namespace
 {
@@ -26,7 +25,7 @@ namespace
         header.MipTableOffset = header.HeaderSize;
         header.PixelDataOffset = header.MipTableOffset
             + static_cast<uint32_t>(sizeof(StexMipRecord) * texture.Mips.size());
-        header.PixelDataSize = texture.Blob.size();
+        header.PixelDataSize = texture.Pixels().size();
 
         if (!writer.Write(header))
             return false;
@@ -43,8 +42,8 @@ namespace
         }
 
         return writer.WriteBytes(
-            reinterpret_cast<const char*>(texture.Blob.data()),
-            static_cast<std::streamsize>(texture.Blob.size()));
+            reinterpret_cast<const char*>(texture.Pixels().data()),
+            static_cast<std::streamsize>(texture.Pixels().size()));
     }
 } // namespace
 
@@ -53,15 +52,12 @@ bool WriteStexToBytes(const TextureData& texture, std::vector<std::byte>& out)
     if (!ValidateTextureData(texture))
         return false;
 
-    std::ostringstream stream(std::ios::binary);
-    BinaryWriter writer(stream);
+    GrowableWriter memory(texture.Pixels().size() + 256);
+    BinaryWriter writer(memory);
     if (!WriteToWriter(writer, texture))
         return false;
 
-    const std::string bytes = stream.str();
-    out.resize(bytes.size());
-    if (!bytes.empty())
-        std::memcpy(out.data(), bytes.data(), bytes.size());
+    out = memory.Take();
     return true;
 }
 
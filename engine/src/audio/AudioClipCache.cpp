@@ -53,3 +53,8 @@ bool AudioClipCache::IsEntryLive(const AudioClipEntry& entry) const
 {
     return entry.Clip.IsValid();
 }
+
+AssetFootprint AudioClipCache::WarmFootprint(const AudioClipEntry& entry) const
+{
+    return { .CpuBytes = entry.Clip.ByteSize(), .GpuBytes = 0 };
+}
@@ -0,0 +1,93 @@
+#include <core/assets/AssetBytes.h>
+
+#include <algorithm>
+#include <mutex>
+#include <utility>
+
+namespace
+{
+    // Retained capacity, across every pooled buffer. A preload's working set
+    // of in-flight reads fits; one outsized asset does not pin its buffer for
+    // the rest of the session.
+    constexpr std::size_t kPoolBudgetBytes = 32u << 20;
+    constexpr std::size_t kPoolMaxBuffers = 16;
+
+    class AssetBufferPool
+    {
+    public:
+        std::vector<std::byte> Acquire()
+        {
+            std::lock_guard lock(Mutex);
+            if (Free.empty())
+                return {};
+            std::vector<std::byte> buffer = std::move(Free.back());
+            Free.pop_back();
+            Retained -= buffer.capacity();
+            return buffer;
+        }
+
+        void Release(std::vector<std::byte>&& buffer)
+        {
+            buffer.clear();
+            std::lock_guard lock(Mutex);
+            if (Free.size() >= kPoolMaxBuffers
+                || buffer.capacity() > kPoolBudgetBytes - std::min(Retained, kPoolBudgetBytes))
+            {
+                return;
+            }
+            Retained += buffer.capacity();
+            Free.push_back(std::move(buffer));
+        }
+
+    private:
+        std::mutex Mutex;
+        std::vector<std::vector<std::byte>> Free;
+        std::size_t Retained = 0;
+    };
+
+    // Never destroyed: a view released during static destruction (a cache
+    // torn down after main) still has somewhere to return its buffer.
+    AssetBufferPool& Pool()
+    {
+        static AssetBufferPool* pool = new AssetBufferPool();
+        return *pool;
+    }
+}
+
+AssetBytes AssetBytes::Adopt(std::vector<std::byte>&& bytes)
+{
+    auto owner = std::make_shared<const std::vector<std::byte>>(std::move(bytes));
+    const std::span<const std::byte> view(owner->data(), owner->size());
+    return AssetBytes(std::move(owner), view);
+}
+
+AssetBytes AssetBytes::Slice(std::size_t offset, std::size_t count) const
+{
+    offset = std::min(offset, View.size());
+    count = std::min(count, View.size() - offset);
+    return AssetBytes(Owner, View.subspan(offset, count));
+}
+
+PooledAssetBuffer::PooledAssetBuffer()
+    : Buffer(Pool().Acquire())
+{
+}
+
+PooledAssetBuffer::~PooledAssetBuffer()
+{
+    if (!Sealed)
+        Pool().Release(std::move(Buffer));
+}
+
+AssetBytes PooledAssetBuffer::Seal() &&
+{
+    Sealed = true;
+    std::shared_ptr<std::vector<std::byte>> owner(
+        new std::vector<std::byte>(std::move(Buffer)),
+        [](std::vector<std::byte>* buffer) {
+            Pool().Release(std::move(*buffer));
+            delete buffer;
+        });
+    const std::span<const std::byte> view(owner->data(), owner->size());
+    return AssetBytes(std::move(owner), view);
+}
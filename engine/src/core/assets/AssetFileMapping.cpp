@@ -0,0 +1,95 @@
+#include <core/assets/AssetFileMapping.h>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+    std::shared_ptr<const AssetFileMapping> Fail(std::string* error, std::string message)
+    {
+        if (error != nullptr)
+            *error = std::move(message);
+        return nullptr;
+    }
+}
+
+std::shared_ptr<const AssetFileMapping> AssetFileMapping::Open(std::string_view path,
+                                                               std::string* error)
+{
+    const std::string file(path);
+    std::shared_ptr<AssetFileMapping> mapping(new AssetFileMapping());
+
+#if defined(_WIN32)
+    const HANDLE handle = ::CreateFileA(file.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                        OPEN_EXISTING, FILE_FLAG_RANDOM_ACCESS, nullptr);
+    if (handle == INVALID_HANDLE_VALUE)
+        return Fail(error, "could not open '" + file + "'");
+
+    LARGE_INTEGER size{};
+    if (!::GetFileSizeEx(handle, &size) || size.QuadPart <= 0)
+    {
+        ::CloseHandle(handle);
+        return Fail(error, "'" + file + "' is empty or unreadable");
+    }
+
+    const HANDLE view = ::CreateFileMappingA(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    const void* base = view == nullptr ? nullptr : ::MapViewOfFile(view, FILE_MAP_READ, 0, 0, 0);
+    if (base == nullptr)
+    {
+        if (view != nullptr)
+            ::CloseHandle(view);
+        ::CloseHandle(handle);
+        return Fail(error, "could not map '" + file + "'");
+    }
+
+    mapping->File = handle;
+    mapping->View = view;
+    mapping->Base = static_cast<const std::byte*>(base);
+    mapping->Length = static_cast<std::size_t>(size.QuadPart);
+#else
+    const int descriptor = ::open(file.c_str(), O_RDONLY | O_CLOEXEC);
+    if (descriptor < 0)
+        return Fail(error, "could not open '" + file + "'");
+
+    struct stat status{};
+    if (::fstat(descriptor, &status) != 0 || status.st_size <= 0)
+    {
+        ::close(descriptor);
+        return Fail(error, "'" + file + "' is empty or unreadable");
+    }
+
+    // The descriptor is not needed once the mapping exists: the mapping holds
+    // its own reference to the file.
+    void* view = ::mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ,
+                        MAP_PRIVATE, descriptor, 0);
+    ::close(descriptor);
+    if (view == MAP_FAILED)
+        return Fail(error, "could not map '" + file + "'");
+
+    mapping->Base = static_cast<const std::byte*>(view);
+    mapping->Length = static_cast<std::size_t>(status.st_size);
+#endif
+
+    return mapping;
+}
+
+AssetFileMapping::~AssetFileMapping()
+{
+    if (Base == nullptr)
+        return;
+#if defined(_WIN32)
+    ::UnmapViewOfFile(Base);
+    ::CloseHandle(static_cast<HANDLE>(View));
+    ::CloseHandle(static_cast<HANDLE>(File));
+#else
+    ::munmap(const_cast<std::byte*>(Base), Length);
+#endif
+}
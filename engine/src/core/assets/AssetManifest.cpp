@@ -2,6 +2,7 @@
 
 #include <core/assets/AssetRegistry.h>
 #include <core/json/JsonParser.h>
+#include <core/json/JsonReader.h>
 #include <core/json/JsonStringify.h>
 #include <core/json/JsonValue.h>
 
@@ -55,6 +56,33 @@ std::vector<std::string> CollectAssetPaths(const JsonValue& root)
     return paths;
 }
 
+bool CollectAssetPathsFromText(std::string_view jsonText,
+                               std::vector<std::string>& out,
+                               std::string* error)
+{
+    std::vector<std::string> paths;
+    std::unordered_set<std::string> seen;
+    JsonReader reader(jsonText);
+    while (true)
+    {
+        switch (reader.Next())
+        {
+        case JsonToken::String:
+            if (IsValidAssetPath(reader.String()) && seen.emplace(reader.String()).second)
+                paths.emplace_back(reader.String());
+            break;
+        case JsonToken::End:
+            out = std::move(paths);
+            return true;
+        case JsonToken::Error:
+            return Fail(error, std::format("JSON parse error at {}: {}",
+                                           reader.Error().Position, reader.Error().Message));
+        default:
+            break;
+        }
+    }
+}
+
 std::vector<std::string> ResolveManifestPaths(const AssetManifest& manifest,
                                               const AssetRegistry& registry)
 {
@@ -0,0 +1,174 @@
+#include <core/assets/AssetPackCodec.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace
+{
+    constexpr std::size_t kMinMatch = 4;
+    constexpr std::size_t kMaxOffset = 0xFFFF;
+    constexpr std::size_t kRunMask = 15;
+
+    // 16K positions. Matches found are only as good as the table remembers,
+    // and at cook time a larger one costs nothing worth measuring.
+    constexpr unsigned kHashBits = 14;
+    constexpr std::uint32_t kNoPosition = 0xFFFFFFFFu;
+
+    [[nodiscard]] std::uint32_t Read32(const std::byte* p)
+    {
+        std::uint32_t value;
+        std::memcpy(&value, p, sizeof(value));
+        return value;
+    }
+
+    [[nodiscard]] std::uint32_t HashSequence(std::uint32_t sequence)
+    {
+        return (sequence * 2654435761u) >> (32 - kHashBits);
+    }
+
+    void WriteRunExtension(std::vector<std::byte>& out, std::size_t value)
+    {
+        while (value >= 255)
+        {
+            out.push_back(std::byte{ 255 });
+            value -= 255;
+        }
+        out.push_back(static_cast<std::byte>(value));
+    }
+
+    void WriteSequence(std::vector<std::byte>& out, std::span<const std::byte> literals,
+                       std::size_t offset, std::size_t matchLength)
+    {
+        const std::size_t literalRun = literals.size();
+        const std::size_t matchRun = matchLength == 0 ? 0 : matchLength - kMinMatch;
+        const std::size_t token = (std::min(literalRun, kRunMask) << 4)
+                                | std::min(matchRun, kRunMask);
+        out.push_back(static_cast<std::byte>(token));
+        if (literalRun >= kRunMask)
+            WriteRunExtension(out, literalRun - kRunMask);
+        out.insert(out.end(), literals.begin(), literals.end());
+
+        // The last sequence is literals only; its end is the input's end.
+        if (matchLength == 0)
+            return;
+
+        out.push_back(static_cast<std::byte>(offset & 0xFF));
+        out.push_back(static_cast<std::byte>((offset >> 8) & 0xFF));
+        if (matchRun >= kRunMask)
+            WriteRunExtension(out, matchRun - kRunMask);
+    }
+
+    // A run's extension bytes, added onto the nibble already read. Bounded by
+    // `limit`, past which the run could not fit the output anyway.
+    [[nodiscard]] bool ReadRunExtension(std::span<const std::byte> input, std::size_t& cursor,
+                                        std::size_t limit, std::size_t& value)
+    {
+        for (;;)
+        {
+            if (cursor >= input.size())
+                return false;
+            const std::size_t next = std::to_integer<std::size_t>(input[cursor++]);
+            value += next;
+            if (value > limit)
+                return false;
+            if (next != 255)
+                return true;
+        }
+    }
+}
+
+void SpakCompress(std::span<const std::byte> input, std::vector<std::byte>& out)
+{
+    out.clear();
+    out.reserve(input.size() + input.size() / 255 + 16);
+
+    const std::size_t size = input.size();
+    std::vector<std::uint32_t> table(std::size_t{ 1 } << kHashBits, kNoPosition);
+
+    std::size_t anchor = 0;
+    std::size_t position = 0;
+    while (position + kMinMatch <= size)
+    {
+        const std::uint32_t sequence = Read32(input.data() + position);
+        std::uint32_t& slot = table[HashSequence(sequence)];
+        const std::uint32_t candidate = slot;
+        slot = static_cast<std::uint32_t>(position);
+
+        if (candidate == kNoPosition || position - candidate > kMaxOffset
+            || Read32(input.data() + candidate) != sequence)
+        {
+            ++position;
+            continue;
+        }
+
+        std::size_t length = kMinMatch;
+        while (position + length < size && input[candidate + length] == input[position + length])
+            ++length;
+
+        WriteSequence(out, input.subspan(anchor, position - anchor), position - candidate, length);
+        position += length;
+        anchor = position;
+    }
+
+    WriteSequence(out, input.subspan(anchor), 0, 0);
+}
+
+bool SpakDecompress(std::span<const std::byte> input, std::span<std::byte> out)
+{
+    std::size_t in = 0;
+    std::size_t written = 0;
+    for (;;)
+    {
+        if (in >= input.size())
+            return false;
+        const std::size_t token = std::to_integer<std::size_t>(input[in++]);
+
+        std::size_t literals = token >> 4;
+        if (literals == kRunMask
+            && !ReadRunExtension(input, in, out.size() - written, literals))
+        {
+            return false;
+        }
+        if (literals > input.size() - in || literals > out.size() - written)
+            return false;
+        if (literals > 0)
+            std::memcpy(out.data() + written, input.data() + in, literals);
+        in += literals;
+        written += literals;
+
+        if (in == input.size())
+            return written == out.size();
+
+        if (input.size() - in < 2)
+            return false;
+        const std::size_t offset = std::to_integer<std::size_t>(input[in])
+                                 | (std::to_integer<std::size_t>(input[in + 1]) << 8);
+        in += 2;
+        if (offset == 0 || offset > written)
+            return false;
+
+        std::size_t length = token & kRunMask;
+        if (length == kRunMask && !ReadRunExtension(input, in, out.size() - written, length))
+            return false;
+        length += kMinMatch;
+        if (length > out.size() - written)
+            return false;
+
+        // Overlapping by design when the offset is shorter than the match:
+        // that is how a run of one repeated byte is spelled. Byte by byte then,
+        // and a block copy when source and destination cannot overlap.
+        std::byte* dst = out.data() + written;
+        const std::byte* src = dst - offset;
+        if (offset >= length)
+        {
+            std::memcpy(dst, src, length);
+        }
+        else
+        {
+            for (std::size_t i = 0; i < length; ++i)
+                dst[i] = src[i];
+        }
+        written += length;
+    }
+}
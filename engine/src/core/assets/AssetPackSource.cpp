@@ -0,0 +1,231 @@
+#include <core/assets/AssetPackSource.h>
+
+#include <core/assets/AssetFileMapping.h>
+#include <core/assets/AssetPackCodec.h>
+#include <core/assets/AssetRegistry.h>
+#include <core/hash/ContentHash.h>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+namespace
+{
+    bool Fail(std::string* error, std::string message)
+    {
+        if (error != nullptr)
+            *error = std::move(message);
+        return false;
+    }
+
+    // a + b <= limit, without the sum wrapping for a hostile a or b.
+    [[nodiscard]] bool FitsWithin(std::uint64_t offset, std::uint64_t length, std::uint64_t limit)
+    {
+        return offset <= limit && length <= limit - offset;
+    }
+
+    [[nodiscard]] bool IsRaw(const SpakEntry& entry)
+    {
+        return (entry.Flags & kSpakEntryCompressed) == 0;
+    }
+}
+
+uint64_t HashSpakPath(std::string_view virtualPath)
+{
+    return HashBytes64(virtualPath);
+}
+
+AssetPackSource::AssetPackSource(IAssetSource* fallback)
+    : Fallback(fallback)
+{
+}
+
+AssetPackSource::~AssetPackSource()
+{
+    Close();
+}
+
+bool AssetPackSource::Open(std::string_view packPath, std::string* error)
+{
+    Close();
+    std::shared_ptr<const AssetFileMapping> mapping = AssetFileMapping::Open(packPath, error);
+    if (mapping == nullptr)
+        return false;
+
+    Base = mapping->Data();
+    Size = mapping->Size();
+    Mapped = std::move(mapping);
+    if (!Validate(error))
+    {
+        Close();
+        return false;
+    }
+    return true;
+}
+
+void AssetPackSource::Close()
+{
+    Mapped.reset();
+    Base = nullptr;
+    Size = 0;
+    Toc = {};
+    Strings = {};
+}
+
+bool AssetPackSource::Validate(std::string* error)
+{
+    if (!LooksLikeSpak(Base, Size))
+        return Fail(error, "not a .spak file");
+
+    SpakFileHeader header;
+    std::memcpy(&header, Base, sizeof(header));
+    if (header.Version != kSpakVersion)
+    {
+        return Fail(error, "unsupported .spak version " + std::to_string(header.Version)
+                         + " (this build reads " + std::to_string(kSpakVersion) + ")");
+    }
+    if (header.Alignment == 0 || (header.Alignment & (header.Alignment - 1)) != 0)
+        return Fail(error, "alignment is not a power of two");
+
+    const std::uint64_t tocBytes =
+        static_cast<std::uint64_t>(header.EntryCount) * sizeof(SpakEntry);
+    if (!FitsWithin(header.TocOffset, tocBytes, Size)
+        || header.TocOffset % alignof(SpakEntry) != 0)
+    {
+        return Fail(error, "table of contents lies outside the file");
+    }
+    if (!FitsWithin(header.StringsOffset, header.StringsSize, Size))
+        return Fail(error, "path table lies outside the file");
+
+    // The mapping starts on a page boundary and the offset was checked to be
+    // a multiple of the record's alignment, so the table is read in place.
+    Toc = std::span<const SpakEntry>(
+        reinterpret_cast<const SpakEntry*>(Base + header.TocOffset), header.EntryCount);
+    Strings = std::string_view(reinterpret_cast<const char*>(Base + header.StringsOffset),
+                               static_cast<std::size_t>(header.StringsSize));
+
+    for (std::size_t index = 0; index < Toc.size(); ++index)
+    {
+        const SpakEntry& entry = Toc[index];
+        if (!FitsWithin(entry.PathOffset, entry.PathLength, Strings.size()))
+            return Fail(error, "entry " + std::to_string(index) + " names a path outside the table");
+        if (!FitsWithin(entry.DataOffset, entry.StoredSize, Size))
+            return Fail(error, "entry " + std::to_string(index) + " lies outside the file");
+        if (IsRaw(entry) && entry.Size != entry.StoredSize)
+            return Fail(error, "raw entry " + std::to_string(index) + " has two sizes");
+        // ReadBytes and ReadView size their output from Size before the
+        // decoder has looked at a byte, so a damaged Size would otherwise be an
+        // allocation of whatever the file says.
+        if (!IsRaw(entry)
+            && (entry.Size > kSpakMaxDecodedEntryBytes
+                || entry.Size > entry.StoredSize * kSpakMaxExpansion))
+        {
+            return Fail(error, "compressed entry " + std::to_string(index)
+                             + " claims an impossible decoded size");
+        }
+
+        const std::string_view path = PathOf(entry);
+        if (entry.PathHash != HashSpakPath(path))
+            return Fail(error, "entry '" + std::string(path) + "' has the wrong path hash");
+
+        // Sorted is what makes a lookup a binary search; an unsorted table
+        // would find some entries and silently miss others.
+        if (index > 0)
+        {
+            const SpakEntry& previous = Toc[index - 1];
+            if (previous.PathHash > entry.PathHash
+                || (previous.PathHash == entry.PathHash && PathOf(previous) >= path))
+            {
+                return Fail(error, "table of contents is not sorted");
+            }
+        }
+    }
+    return true;
+}
+
+std::string_view AssetPackSource::PathOf(const SpakEntry& entry) const
+{
+    return Strings.substr(entry.PathOffset, entry.PathLength);
+}
+
+const SpakEntry* AssetPackSource::Find(std::string_view virtualPath) const
+{
+    if (Toc.empty())
+        return nullptr;
+
+    const std::uint64_t hash = HashSpakPath(virtualPath);
+    auto it = std::lower_bound(Toc.begin(), Toc.end(), hash,
+        [](const SpakEntry& entry, std::uint64_t value) { return entry.PathHash < value; });
+    for (; it != Toc.end() && it->PathHash == hash; ++it)
+    {
+        if (PathOf(*it) == virtualPath)
+            return &*it;
+    }
+    return nullptr;
+}
+
+bool AssetPackSource::ReadBytes(std::string_view filePath, std::vector<std::byte>& out)
+{
+    const SpakEntry* entry = Find(filePath);
+    if (entry == nullptr)
+        return Fallback != nullptr && Fallback->ReadBytes(filePath, out);
+
+    const std::span<const std::byte> stored(Base + entry->DataOffset,
+                                            static_cast<std::size_t>(entry->StoredSize));
+    if (IsRaw(*entry))
+    {
+        out.assign(stored.begin(), stored.end());
+        return true;
+    }
+
+    out.resize(static_cast<std::size_t>(entry->Size));
+    return SpakDecompress(stored, out);
+}
+
+bool AssetPackSource::ReadView(std::string_view filePath, AssetBytes& out)
+{
+    const SpakEntry* entry = Find(filePath);
+    if (entry == nullptr)
+        return Fallback != nullptr && Fallback->ReadView(filePath, out);
+
+    const std::span<const std::byte> stored(Base + entry->DataOffset,
+                                            static_cast<std::size_t>(entry->StoredSize));
+    if (IsRaw(*entry))
+    {
+        out = AssetBytes(Mapped, stored);
+        return true;
+    }
+
+    PooledAssetBuffer buffer;
+    buffer.Bytes().resize(static_cast<std::size_t>(entry->Size));
+    if (!SpakDecompress(stored, buffer.Bytes()))
+        return false;
+    out = std::move(buffer).Seal();
+    return true;
+}
+
+uint64_t AssetPackSource::ReadOrder(std::string_view filePath) const
+{
+    const SpakEntry* entry = Find(filePath);
+    return entry != nullptr ? entry->DataOffset : 0;
+}
+
+int RegisterPackedAssets(const AssetPackSource& pack, AssetRegistry& registry)
+{
+    int registered = 0;
+    for (const SpakEntry& entry : pack.Entries())
+    {
+        const std::string_view path = pack.PathOf(entry);
+        if (registry.Contains(path))
+            continue;
+
+        AssetRecord record;
+        record.Type = entry.Type;
+        record.SourceKind = AssetSourceKind::File;
+        record.Path = std::string(path);
+        record.ContentHash = entry.ContentHash;
+        if (registry.Register(record))
+            ++registered;
+    }
+    return registered;
+}
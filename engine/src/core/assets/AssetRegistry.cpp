@@ -1,6 +1,7 @@
 #include <core/assets/AssetRegistry.h>
 
 #include <core/assets/AssetKindRegistry.h>
+#include <core/assets/AssetRegistryIndex.h>
 
 #include <core/hash/ContentHash.h>
 #include <core/json/JsonParser.h>
@@ -62,6 +63,11 @@ bool AssetRegistry::Register(const AssetRecord& record)
         return false;
     }
 
+    // A path the mounted index holds is registered already, as far as a
+    // caller can tell; building it here makes the duplicate check see it.
+    if (Index != nullptr)
+        (void)FindByPath(record.Path);
+
     const std::string path = record.Path;
     const std::string type = std::string(AssetTypeToString(record.Type));
     auto [it, inserted] = RecordsByPath.emplace(record.Path, record);
@@ -105,6 +111,9 @@ bool AssetRegistry::RegisterOrVerify(const AssetRecord& record)
         return false;
     }
 
+    if (Index != nullptr)
+        (void)FindByPath(record.Path);
+
     auto it = RecordsByPath.find(record.Path);
     if (it == RecordsByPath.end())
     {
@@ -125,6 +134,12 @@ bool AssetRegistry::RegisterOrVerify(const AssetRecord& record)
 
 bool AssetRegistry::Unregister(std::string_view path)
 {
+    if (Index != nullptr && !IsWithdrawn(path) && Index->Find(path) != nullptr)
+    {
+        (void)FindByPath(path);
+        Withdrawn.emplace(path);
+    }
+
     auto it = RecordsByPath.find(std::string(path));
     if (it == RecordsByPath.end())
         return false;
@@ -144,6 +159,17 @@ bool AssetRegistry::AssignId(std::string_view path, AssetId id)
     }
 
     auto it = RecordsByPath.find(std::string(path));
+    if (it == RecordsByPath.end() && Index != nullptr && !IsWithdrawn(path))
+    {
+        // The cook binds ids before it writes the index, so applying the id
+        // map over a mounted index mostly restates what it holds; that needs
+        // no record built.
+        const SregEntry* entry = Index->Find(path);
+        if (entry != nullptr && entry->Id == id.Value && !RecordsById.contains(id))
+            return true;
+        if (Materialize(path) != nullptr)
+            it = RecordsByPath.find(std::string(path));
+    }
     if (it == RecordsByPath.end())
     {
         Log.Warn("AssetRegistry: cannot assign id to unregistered path '{}'", path);
@@ -175,18 +201,79 @@ bool AssetRegistry::AssignId(std::string_view path, AssetId id)
 const AssetRecord* AssetRegistry::FindByPath(std::string_view path) const
 {
     auto it = RecordsByPath.find(std::string(path));
-    return it == RecordsByPath.end() ? nullptr : &it->second;
+    if (it != RecordsByPath.end())
+        return &it->second;
+    return Materialize(path);
 }
 
 const AssetRecord* AssetRegistry::FindById(AssetId id) const
 {
     auto it = RecordsById.find(id);
-    return it == RecordsById.end() ? nullptr : it->second;
+    if (it != RecordsById.end())
+        return it->second;
+    if (Index == nullptr)
+        return nullptr;
+
+    // A path registered directly shadows the index entry, and with it the
+    // id the index bound to that path.
+    const SregEntry* entry = Index->FindById(id);
+    const AssetRecord* record = entry != nullptr ? FindByPath(Index->PathOf(*entry)) : nullptr;
+    return record != nullptr && record->Id == id ? record : nullptr;
 }
 
 bool AssetRegistry::Contains(std::string_view path) const
 {
-    return FindByPath(path) != nullptr;
+    if (RecordsByPath.contains(std::string(path)))
+        return true;
+    return Index != nullptr && Index->Find(path) != nullptr && !IsWithdrawn(path);
+}
+
+void AssetRegistry::MountIndex(const AssetRegistryIndex* index)
+{
+    Index = index;
+    IndexMaterialized = false;
+}
+
+const std::unordered_map<std::string, AssetRecord>& AssetRegistry::Records() const
+{
+    if (Index != nullptr && !IndexMaterialized)
+    {
+        for (const SregEntry& entry : Index->Entries())
+            (void)FindByPath(Index->PathOf(entry));
+        IndexMaterialized = true;
+    }
+    return RecordsByPath;
+}
+
+const AssetRecord* AssetRegistry::Materialize(std::string_view path) const
+{
+    if (Index == nullptr)
+        return nullptr;
+    const SregEntry* entry = Index->Find(path);
+    if (entry == nullptr || IsWithdrawn(path))
+        return nullptr;
+
+    auto [it, inserted] = RecordsByPath.emplace(std::string(path), Index->MakeRecord(*entry));
+    AssetRecord& record = it->second;
+    if (inserted && record.Id.IsValid())
+    {
+        if (auto bound = RecordsById.find(record.Id); bound != RecordsById.end())
+        {
+            Log.Warn("AssetRegistry: index id {} for '{}' is already bound to '{}'; dropped",
+                AssetIdToString(record.Id), record.Path, bound->second->Path);
+            record.Id = {};
+        }
+        else
+        {
+            RecordsById.emplace(record.Id, &record);
+        }
+    }
+    return &record;
+}
+
+bool AssetRegistry::IsWithdrawn(std::string_view path) const
+{
+    return !Withdrawn.empty() && Withdrawn.contains(std::string(path));
 }
 
 bool ScanAssetsDirectory(std::string_view rootDirectory,
@@ -0,0 +1,248 @@
+#include <core/assets/AssetRegistryIndex.h>
+
+#include <core/assets/AssetFileMapping.h>
+#include <core/assets/AssetPackFormat.h>
+#include <core/assets/AssetRegistry.h>
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+
+namespace
+{
+    bool Fail(std::string* error, std::string message)
+    {
+        if (error != nullptr)
+            *error = std::move(message);
+        return false;
+    }
+
+    // a + b <= limit, without the sum wrapping for a hostile a or b.
+    [[nodiscard]] bool FitsWithin(std::uint64_t offset, std::uint64_t length, std::uint64_t limit)
+    {
+        return offset <= limit && length <= limit - offset;
+    }
+
+    // The walk-side fields a record is compared on: everything but the id,
+    // which a walk does not know.
+    [[nodiscard]] bool SameWalkedRecord(const AssetRecord& a, const AssetRecord& b)
+    {
+        return a.Type == b.Type
+            && a.SourceKind == b.SourceKind
+            && a.FilePath == b.FilePath
+            && a.ContentHash == b.ContentHash
+            && a.Version == b.Version;
+    }
+}
+
+std::string AssetRegistryIndexPath(std::string_view assetsRoot)
+{
+    return (std::filesystem::path(std::string(assetsRoot)) / kCookedCacheDirName
+            / kAssetRegistryIndexFileName).generic_string();
+}
+
+AssetRegistryIndex::AssetRegistryIndex() = default;
+
+AssetRegistryIndex::~AssetRegistryIndex() = default;
+
+bool AssetRegistryIndex::Open(std::string_view indexPath,
+                              std::string_view assetsRoot,
+                              std::string* error)
+{
+    Close();
+    std::shared_ptr<const AssetFileMapping> mapping = AssetFileMapping::Open(indexPath, error);
+    if (mapping == nullptr)
+        return false;
+
+    Mapped = std::move(mapping);
+    Root = std::string(assetsRoot);
+    if (!Validate(error))
+    {
+        Close();
+        return false;
+    }
+    return true;
+}
+
+void AssetRegistryIndex::Close()
+{
+    Mapped.reset();
+    Root.clear();
+    Table = {};
+    Ids = {};
+    Strings = {};
+}
+
+std::size_t AssetRegistryIndex::MappedBytes() const
+{
+    return Mapped != nullptr ? Mapped->Size() : 0;
+}
+
+bool AssetRegistryIndex::Validate(std::string* error)
+{
+    const std::byte* base = Mapped->Data();
+    const std::size_t size = Mapped->Size();
+    if (!LooksLikeSreg(base, size))
+        return Fail(error, "not a .sreg file");
+
+    SregFileHeader header;
+    std::memcpy(&header, base, sizeof(header));
+    if (header.Version != kSregVersion)
+    {
+        return Fail(error, "unsupported .sreg version " + std::to_string(header.Version)
+                         + " (this build reads " + std::to_string(kSregVersion) + ")");
+    }
+
+    const std::uint64_t entryBytes =
+        static_cast<std::uint64_t>(header.EntryCount) * sizeof(SregEntry);
+    const std::uint64_t idBytes =
+        static_cast<std::uint64_t>(header.IdCount) * sizeof(SregIdEntry);
+    if (!FitsWithin(header.EntriesOffset, entryBytes, size)
+        || header.EntriesOffset % alignof(SregEntry) != 0)
+    {
+        return Fail(error, "entry table lies outside the file");
+    }
+    if (!FitsWithin(header.IdsOffset, idBytes, size)
+        || header.IdsOffset % alignof(SregIdEntry) != 0)
+    {
+        return Fail(error, "id table lies outside the file");
+    }
+    if (!FitsWithin(header.StringsOffset, header.StringsSize, size))
+        return Fail(error, "string table lies outside the file");
+
+    // Page-aligned mapping, offsets checked against the record alignment:
+    // both tables are read in place.
+    Table = std::span<const SregEntry>(
+        reinterpret_cast<const SregEntry*>(base + header.EntriesOffset), header.EntryCount);
+    Ids = std::span<const SregIdEntry>(
+        reinterpret_cast<const SregIdEntry*>(base + header.IdsOffset), header.IdCount);
+    Strings = std::string_view(reinterpret_cast<const char*>(base + header.StringsOffset),
+                               static_cast<std::size_t>(header.StringsSize));
+
+    for (std::size_t index = 0; index < Table.size(); ++index)
+    {
+        const SregEntry& entry = Table[index];
+        if (!FitsWithin(entry.PathOffset, entry.PathLength, Strings.size())
+            || !FitsWithin(entry.FileOffset, entry.FileLength, Strings.size()))
+        {
+            return Fail(error, "entry " + std::to_string(index) + " names a string outside the table");
+        }
+        if (entry.Type == AssetType::Unknown || entry.SourceKind == AssetSourceKind::Unknown)
+            return Fail(error, "entry " + std::to_string(index) + " has no type");
+
+        const std::string_view path = PathOf(entry);
+        if (entry.PathHash != HashSpakPath(path))
+            return Fail(error, "entry '" + std::string(path) + "' has the wrong path hash");
+
+        if (index > 0)
+        {
+            const SregEntry& previous = Table[index - 1];
+            if (previous.PathHash > entry.PathHash
+                || (previous.PathHash == entry.PathHash && PathOf(previous) >= path))
+            {
+                return Fail(error, "entry table is not sorted");
+            }
+        }
+    }
+
+    for (std::size_t index = 0; index < Ids.size(); ++index)
+    {
+        const SregIdEntry& row = Ids[index];
+        if (row.Id == 0 || row.Entry >= Table.size() || Table[row.Entry].Id != row.Id)
+            return Fail(error, "id row " + std::to_string(index) + " does not match its entry");
+        if (index > 0 && Ids[index - 1].Id >= row.Id)
+            return Fail(error, "id table is not sorted");
+    }
+    return true;
+}
+
+std::string_view AssetRegistryIndex::PathOf(const SregEntry& entry) const
+{
+    return Strings.substr(entry.PathOffset, entry.PathLength);
+}
+
+std::string_view AssetRegistryIndex::FileOf(const SregEntry& entry) const
+{
+    return Strings.substr(entry.FileOffset, entry.FileLength);
+}
+
+const SregEntry* AssetRegistryIndex::Find(std::string_view virtualPath) const
+{
+    if (Table.empty())
+        return nullptr;
+
+    const std::uint64_t hash = HashSpakPath(virtualPath);
+    auto it = std::lower_bound(Table.begin(), Table.end(), hash,
+        [](const SregEntry& entry, std::uint64_t value) { return entry.PathHash < value; });
+    for (; it != Table.end() && it->PathHash == hash; ++it)
+    {
+        if (PathOf(*it) == virtualPath)
+            return &*it;
+    }
+    return nullptr;
+}
+
+const SregEntry* AssetRegistryIndex::FindById(AssetId id) const
+{
+    if (!id.IsValid() || Ids.empty())
+        return nullptr;
+
+    auto it = std::lower_bound(Ids.begin(), Ids.end(), id.Value,
+        [](const SregIdEntry& row, std::uint64_t value) { return row.Id < value; });
+    if (it == Ids.end() || it->Id != id.Value)
+        return nullptr;
+    return &Table[it->Entry];
+}
+
+AssetRecord AssetRegistryIndex::MakeRecord(const SregEntry& entry) const
+{
+    AssetRecord record;
+    record.Type = entry.Type;
+    record.SourceKind = entry.SourceKind;
+    record.Path = std::string(PathOf(entry));
+    if (entry.FileLength > 0)
+    {
+        record.FilePath =
+            (std::filesystem::path(Root) / std::string(FileOf(entry))).generic_string();
+    }
+    record.Id = AssetId{ entry.Id };
+    record.ContentHash = entry.ContentHash;
+    record.Version = entry.Version;
+    return record;
+}
+
+AssetRegistryIndexCheck CheckAssetRegistryIndex(const AssetRegistryIndex& index,
+                                                 const AssetKindRegistry& kinds,
+                                                 LoggingProvider& logging)
+{
+    AssetRegistryIndexCheck check;
+    const std::string root(index.AssetsRoot());
+
+    AssetRegistry walked(logging);
+    ScanAssetsDirectory(root, walked, kinds);
+    ScanAssetsDirectory(
+        (std::filesystem::path(root) / kCookedCacheDirName).generic_string(), walked, kinds);
+    RegisterCookedAssets(root, walked);
+
+    for (const auto& [path, record] : walked.Records())
+    {
+        ++check.Walked;
+        const SregEntry* entry = index.Find(path);
+        if (entry == nullptr)
+            check.Missing.push_back(path);
+        else if (!SameWalkedRecord(index.MakeRecord(*entry), record))
+            check.Stale.push_back(path);
+    }
+    for (const SregEntry& entry : index.Entries())
+    {
+        const std::string_view path = index.PathOf(entry);
+        if (!walked.Contains(path))
+            check.Extra.emplace_back(path);
+    }
+
+    // Map order is not an order anyone can read a report in.
+    std::sort(check.Missing.begin(), check.Missing.end());
+    std::sort(check.Stale.begin(), check.Stale.end());
+    std::sort(check.Extra.begin(), check.Extra.end());
+    return check;
+}
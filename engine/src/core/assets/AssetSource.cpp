@@ -3,6 +3,20 @@
 #include <fstream>
 #include <string>
 
+bool IAssetSource::ReadView(std::string_view filePath, AssetBytes& out)
+{
+    PooledAssetBuffer buffer;
+    if (!ReadBytes(filePath, buffer.Bytes()))
+        return false;
+    out = std::move(buffer).Seal();
+    return true;
+}
+
+uint64_t IAssetSource::ReadOrder(std::string_view) const
+{
+    return 0;
+}
+
 bool FileAssetSource::ReadBytes(std::string_view filePath, std::vector<std::byte>& out)
 {
     std::ifstream file{ std::string(filePath), std::ios::binary | std::ios::ate };
@@ -27,3 +41,17 @@ bool ReadAssetBytes(IAssetSource& source, const AssetRecord& record, std::vector
         record.FilePath.empty() ? std::string_view(record.Path) : std::string_view(record.FilePath);
     return source.ReadBytes(filePath, out);
 }
+
+bool ReadAssetView(IAssetSource& source, const AssetRecord& record, AssetBytes& out)
+{
+    const std::string_view filePath =
+        record.FilePath.empty() ? std::string_view(record.Path) : std::string_view(record.FilePath);
+    return source.ReadView(filePath, out);
+}
+
+uint64_t AssetReadOrder(const IAssetSource& source, const AssetRecord& record)
+{
+    const std::string_view filePath =
+        record.FilePath.empty() ? std::string_view(record.Path) : std::string_view(record.FilePath);
+    return source.ReadOrder(filePath);
+}
@@ -97,7 +97,9 @@ std::optional<EngineConfig> LoadEngineConfig(
         || !ReadSection<EngineAudioConfig, AudioConfigError>(
             *root, "audio", config.Audio, sectionError, DeserializeAudioConfig)
         || !ReadSection<EngineCaptionConfig, CaptionConfigError>(
-            *root, "captions", config.Captions, sectionError, DeserializeCaptionConfig))
+            *root, "captions", config.Captions, sectionError, DeserializeCaptionConfig)
+        || !ReadSection<EngineNetConfig, NetConfigError>(
+            *root, "net", config.Net, sectionError, DeserializeNetConfig))
     {
         if (error) error->Message = sectionError;
         return std::nullopt;
@@ -0,0 +1,54 @@
+#include <core/config/NetConfig.h>
+
+namespace
+{
+    bool ReadString(const JsonValue& root,
+                    const char* key,
+                    std::string& out,
+                    std::string& error)
+    {
+        const JsonValue* value = root.Find(key);
+        if (!value)
+            return true;
+        if (!value->IsString())
+        {
+            error = std::string("net config: '") + key + "' must be a string";
+            return false;
+        }
+        out = value->AsString();
+        return true;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// DeserializeNetConfig
+//
+// Expected JSON shape (the "net" object from engine.json):
+//
+//   {
+//     "entropyModel":    "net/snapshots.model",  // default "", snapshots raw
+//     "snapshotCapture": "captures/host.sncap"   // default "", no capture
+//   }
+// ---------------------------------------------------------------------------
+
+std::optional<EngineNetConfig> DeserializeNetConfig(
+    const JsonValue& root,
+    NetConfigError* error)
+{
+    if (!root.IsObject())
+    {
+        if (error) error->Message = "net config: root must be a JSON object";
+        return std::nullopt;
+    }
+
+    EngineNetConfig config;
+    std::string sectionError;
+    if (!ReadString(root, "entropyModel", config.EntropyModelPath, sectionError)
+        || !ReadString(root, "snapshotCapture", config.SnapshotCapturePath, sectionError))
+    {
+        if (error) error->Message = sectionError;
+        return std::nullopt;
+    }
+
+    return config;
+}
@@ -101,6 +101,8 @@ std::optional<EngineRuntimeConfig> DeserializeRuntimeConfig(
             config.JobWorkerCount, sectionError)
         || !ReadIntEither(root, "asyncTaskThreadCount", "async_task_thread_count",
             config.AsyncTaskThreadCount, sectionError)
+        || !ReadIntEither(root, "asyncIoThreadCount", "async_io_thread_count",
+            config.AsyncIoThreadCount, sectionError)
         || !ReadIntEither(root, "streamingHopCount", "streaming_hop_count",
             config.StreamingHopCount, sectionError)
         || !ReadDoubleEither(root, "streamingLingerSeconds", "streaming_linger_seconds",
@@ -113,6 +115,8 @@ std::optional<EngineRuntimeConfig> DeserializeRuntimeConfig(
             config.StreamingNeighborPhysics, sectionError)
         || !ReadDoubleEither(root, "streamingRadius", "streaming_radius",
             config.StreamingRadius, sectionError)
+        || !ReadDoubleEither(root, "streamingPredictSeconds", "streaming_predict_seconds",
+            config.StreamingPredictSeconds, sectionError)
         || !ReadBoolEither(root, "exitOnEscape", "exit_on_escape",
             config.ExitOnEscape, sectionError)
         || !ReadBoolEither(root, "togglePauseOnF1", "toggle_pause_on_f1",
@@ -158,6 +162,12 @@ std::optional<EngineRuntimeConfig> DeserializeRuntimeConfig(
         return std::nullopt;
     }
 
+    if (config.AsyncIoThreadCount < 0)
+    {
+        if (error) error->Message = "runtime config: 'asyncIoThreadCount' must be zero (reads on task threads) or positive";
+        return std::nullopt;
+    }
+
     if (config.StreamingHopCount < 0)
     {
         if (error) error->Message = "runtime config: 'streamingHopCount' must be zero (focus zone only) or positive";
@@ -182,5 +192,11 @@ std::optional<EngineRuntimeConfig> DeserializeRuntimeConfig(
         return std::nullopt;
     }
 
+    if (!std::isfinite(config.StreamingPredictSeconds) || config.StreamingPredictSeconds < 0.0)
+    {
+        if (error) error->Message = "runtime config: 'streamingPredictSeconds' must be zero (no prediction) or positive";
+        return std::nullopt;
+    }
+
     return config;
 }
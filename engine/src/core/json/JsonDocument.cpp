@@ -0,0 +1,238 @@
+#include <core/json/JsonDocument.h>
+#include <core/json/JsonReader.h>
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+
+namespace
+{
+
+constexpr uint32_t kEmptyBucket = UINT32_MAX;
+
+// Decoded strings are rare next to the ones viewed in place, so the arena
+// grows in blocks large enough that most documents need only one.
+constexpr std::size_t kArenaBlockBytes = 64u * 1024u;
+
+std::size_t HashKey(std::string_view key)
+{
+	return std::hash<std::string_view>{}(key);
+}
+
+} // anonymous namespace
+
+// -- JsonDocument -------------------------------------------------------------
+
+std::optional<JsonDocument> JsonDocument::Parse(std::string_view input, JsonParseError* error)
+{
+	JsonDocument document;
+	// Pretty-printed data runs about a node per eight bytes; reserving for
+	// that spares the node array most of its regrowth copies.
+	document.Nodes.reserve(input.size() / 8 + 1);
+
+	JsonReader reader(input);
+	std::vector<uint32_t> open;          // node of each open container
+	std::vector<std::size_t> openFirst;  // where its children start in pending
+	std::vector<uint32_t> pending;       // children of open containers, innermost last
+	std::string_view key;
+
+	const auto text = [&]() {
+		return reader.StringInInput() ? reader.String() : document.StoreText(reader.String());
+	};
+	const auto add = [&](JsonNodeType type) -> Node& {
+		const uint32_t index = static_cast<uint32_t>(document.Nodes.size());
+		if (!open.empty())
+			pending.push_back(index);
+		const bool member = !open.empty() && document.Nodes[open.back()].Type == JsonNodeType::Object;
+		Node& node = document.Nodes.emplace_back();
+		node.Type = type;
+		if (member)
+			node.Key = key;
+		return node;
+	};
+	const auto begin = [&](JsonNodeType type) {
+		const uint32_t index = static_cast<uint32_t>(document.Nodes.size());
+		(void)add(type);
+		open.push_back(index);
+		openFirst.push_back(pending.size());
+	};
+
+	while (true)
+	{
+		switch (reader.Next())
+		{
+		case JsonToken::BeginObject:
+			begin(JsonNodeType::Object);
+			break;
+		case JsonToken::BeginArray:
+			begin(JsonNodeType::Array);
+			break;
+		case JsonToken::EndObject:
+		case JsonToken::EndArray:
+			document.CloseContainer(open.back(), pending, openFirst.back());
+			open.pop_back();
+			openFirst.pop_back();
+			break;
+		case JsonToken::Key:
+			// Stored now: the value that follows may reuse the reader's
+			// scratch buffer.
+			key = text();
+			break;
+		case JsonToken::String:
+			add(JsonNodeType::String).Text = text();
+			break;
+		case JsonToken::Number:
+			add(JsonNodeType::Number).Number = reader.Number();
+			break;
+		case JsonToken::Bool:
+			add(JsonNodeType::Bool).Bool = reader.Bool();
+			break;
+		case JsonToken::Null:
+			(void)add(JsonNodeType::Null);
+			break;
+		case JsonToken::End:
+			return document;
+		case JsonToken::Error:
+			if (error)
+				*error = reader.Error();
+			return std::nullopt;
+		}
+	}
+}
+
+std::string_view JsonDocument::StoreText(std::string_view text)
+{
+	if (text.empty())
+		return {};
+	if (ArenaCapacity - ArenaUsed < text.size())
+	{
+		const std::size_t size = std::max(kArenaBlockBytes, text.size());
+		ArenaBlocks.emplace_back(new char[size]);
+		ArenaUsed = 0;
+		ArenaCapacity = size;
+	}
+	char* out = ArenaBlocks.back().get() + ArenaUsed;
+	std::memcpy(out, text.data(), text.size());
+	ArenaUsed += text.size();
+	return { out, text.size() };
+}
+
+void JsonDocument::CloseContainer(uint32_t node, std::vector<uint32_t>& pending, std::size_t firstPending)
+{
+	Node& container = Nodes[node];
+	container.First = static_cast<uint32_t>(Children.size());
+	container.Count = static_cast<uint32_t>(pending.size() - firstPending);
+	Children.insert(Children.end(), pending.begin() + static_cast<std::ptrdiff_t>(firstPending), pending.end());
+	pending.resize(firstPending);
+
+	if (container.Type == JsonNodeType::Object && container.Count >= kJsonHashedObjectMembers)
+		HashMembers(container);
+}
+
+void JsonDocument::HashMembers(Node& object)
+{
+	// Open addressing at no more than half load, so a probe for a missing
+	// key reaches an empty bucket quickly.
+	std::size_t bucketCount = 1;
+	while (bucketCount < static_cast<std::size_t>(object.Count) * 2)
+		bucketCount <<= 1;
+
+	object.Buckets = static_cast<uint32_t>(Buckets.size());
+	object.BucketMask = static_cast<uint32_t>(bucketCount - 1);
+	Buckets.resize(Buckets.size() + bucketCount, kEmptyBucket);
+
+	for (uint32_t member = 0; member < object.Count; ++member)
+	{
+		const std::string_view key = Nodes[Children[object.First + member]].Key;
+		std::size_t slot = HashKey(key) & object.BucketMask;
+		while (true)
+		{
+			uint32_t& bucket = Buckets[object.Buckets + slot];
+			if (bucket == kEmptyBucket)
+			{
+				bucket = member;
+				break;
+			}
+			// A repeated key keeps its first member, as a scan would find.
+			if (Nodes[Children[object.First + bucket]].Key == key)
+				break;
+			slot = (slot + 1) & object.BucketMask;
+		}
+	}
+}
+
+// -- JsonNode -----------------------------------------------------------------
+
+bool JsonNode::IsNull() const   { return Document && Document->Nodes[Index].Type == JsonNodeType::Null; }
+bool JsonNode::IsBool() const   { return Document && Document->Nodes[Index].Type == JsonNodeType::Bool; }
+bool JsonNode::IsNumber() const { return Document && Document->Nodes[Index].Type == JsonNodeType::Number; }
+bool JsonNode::IsString() const { return Document && Document->Nodes[Index].Type == JsonNodeType::String; }
+bool JsonNode::IsArray() const  { return Document && Document->Nodes[Index].Type == JsonNodeType::Array; }
+bool JsonNode::IsObject() const { return Document && Document->Nodes[Index].Type == JsonNodeType::Object; }
+
+bool JsonNode::AsBool() const
+{
+	return IsBool() && Document->Nodes[Index].Bool;
+}
+
+double JsonNode::AsNumber() const
+{
+	return IsNumber() ? Document->Nodes[Index].Number : 0.0;
+}
+
+std::string_view JsonNode::AsString() const
+{
+	return IsString() ? Document->Nodes[Index].Text : std::string_view{};
+}
+
+std::size_t JsonNode::Size() const
+{
+	return IsArray() || IsObject() ? Document->Nodes[Index].Count : 0;
+}
+
+JsonNode JsonNode::operator[](std::size_t index) const
+{
+	if (index >= Size())
+		return {};
+	const JsonDocument::Node& node = Document->Nodes[Index];
+	return JsonNode(Document, Document->Children[node.First + index]);
+}
+
+std::string_view JsonNode::KeyAt(std::size_t index) const
+{
+	if (!IsObject() || index >= Size())
+		return {};
+	const JsonDocument::Node& node = Document->Nodes[Index];
+	return Document->Nodes[Document->Children[node.First + index]].Key;
+}
+
+JsonNode JsonNode::Find(std::string_view key) const
+{
+	if (!IsObject())
+		return {};
+
+	const JsonDocument& document = *Document;
+	const JsonDocument::Node& node = document.Nodes[Index];
+	if (node.BucketMask != 0)
+	{
+		std::size_t slot = HashKey(key) & node.BucketMask;
+		while (true)
+		{
+			const uint32_t member = document.Buckets[node.Buckets + slot];
+			if (member == kEmptyBucket)
+				return {};
+			const uint32_t child = document.Children[node.First + member];
+			if (document.Nodes[child].Key == key)
+				return JsonNode(Document, child);
+			slot = (slot + 1) & node.BucketMask;
+		}
+	}
+
+	for (uint32_t member = 0; member < node.Count; ++member)
+	{
+		const uint32_t child = document.Children[node.First + member];
+		if (document.Nodes[child].Key == key)
+			return JsonNode(Document, child);
+	}
+	return {};
+}
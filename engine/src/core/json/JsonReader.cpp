@@ -0,0 +1,396 @@
+#include <core/json/JsonReader.h>
+
+#include <bit>
+#include <charconv>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SENCHA_JSON_SSE2 1
+#endif
+
+namespace
+{
+
+bool IsWhitespace(char c)
+{
+	return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+// The two scans below are where a large document spends its time outside of
+// number conversion: runs of indentation, and the bodies of strings. With SSE2
+// they test sixteen bytes per step; the scalar loop finishes the tail and is
+// the whole scan on targets without it.
+
+std::size_t FindNonWhitespace(std::string_view input, std::size_t pos)
+{
+#ifdef SENCHA_JSON_SSE2
+	const __m128i space = _mm_set1_epi8(' ');
+	const __m128i tab = _mm_set1_epi8('\t');
+	const __m128i newline = _mm_set1_epi8('\n');
+	const __m128i carriage = _mm_set1_epi8('\r');
+	while (pos + 16 <= input.size())
+	{
+		const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input.data() + pos));
+		const __m128i blank = _mm_or_si128(
+			_mm_or_si128(_mm_cmpeq_epi8(chunk, space), _mm_cmpeq_epi8(chunk, tab)),
+			_mm_or_si128(_mm_cmpeq_epi8(chunk, newline), _mm_cmpeq_epi8(chunk, carriage)));
+		const unsigned solid = ~static_cast<unsigned>(_mm_movemask_epi8(blank)) & 0xFFFFu;
+		if (solid != 0)
+			return pos + static_cast<std::size_t>(std::countr_zero(solid));
+		pos += 16;
+	}
+#endif
+	while (pos < input.size() && IsWhitespace(input[pos]))
+		++pos;
+	return pos;
+}
+
+// Offset of the next '"' or '\\' at or after pos; input.size() if none.
+std::size_t FindQuoteOrEscape(std::string_view input, std::size_t pos)
+{
+#ifdef SENCHA_JSON_SSE2
+	const __m128i quote = _mm_set1_epi8('"');
+	const __m128i backslash = _mm_set1_epi8('\\');
+	while (pos + 16 <= input.size())
+	{
+		const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input.data() + pos));
+		const unsigned special = static_cast<unsigned>(_mm_movemask_epi8(
+			_mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash))));
+		if (special != 0)
+			return pos + static_cast<std::size_t>(std::countr_zero(special));
+		pos += 16;
+	}
+#endif
+	while (pos < input.size() && input[pos] != '"' && input[pos] != '\\')
+		++pos;
+	return pos;
+}
+
+void AppendUtf8(std::string& out, unsigned int codepoint)
+{
+	if (codepoint < 0x80)
+	{
+		out += static_cast<char>(codepoint);
+	}
+	else if (codepoint < 0x800)
+	{
+		out += static_cast<char>(0xC0 | (codepoint >> 6));
+		out += static_cast<char>(0x80 | (codepoint & 0x3F));
+	}
+	else
+	{
+		out += static_cast<char>(0xE0 | (codepoint >> 12));
+		out += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+		out += static_cast<char>(0x80 | (codepoint & 0x3F));
+	}
+}
+
+} // anonymous namespace
+
+JsonToken JsonReader::Next()
+{
+	switch (State)
+	{
+	case Expect::Value:
+		SkipWhitespace();
+		return ReadValue();
+
+	case Expect::ValueOrEnd:
+		SkipWhitespace();
+		if (Pos < Input.size() && Input[Pos] == ']')
+			return Close(']');
+		return ReadValue();
+
+	case Expect::Key:
+		SkipWhitespace();
+		return ReadKey();
+
+	case Expect::KeyOrEnd:
+		SkipWhitespace();
+		if (Pos < Input.size() && Input[Pos] == '}')
+			return Close('}');
+		return ReadKey();
+
+	case Expect::CommaOrEnd:
+	{
+		SkipWhitespace();
+		const char c = Pos < Input.size() ? Input[Pos] : '\0';
+		if (Stack.back() == '{')
+		{
+			if (c == '}')
+				return Close('}');
+			if (c != ',')
+				return Fail("Expected ',' or '}' in object");
+			++Pos;
+			SkipWhitespace();
+			return ReadKey();
+		}
+		if (c == ']')
+			return Close(']');
+		if (c != ',')
+			return Fail("Expected ',' or ']' in array");
+		++Pos;
+		SkipWhitespace();
+		return ReadValue();
+	}
+
+	case Expect::Done:
+		SkipWhitespace();
+		if (Pos < Input.size())
+			return Fail("Unexpected trailing content");
+		return JsonToken::End;
+
+	case Expect::Failed:
+		break;
+	}
+	return JsonToken::Error;
+}
+
+bool JsonReader::SkipContainer()
+{
+	if (State != Expect::KeyOrEnd && State != Expect::ValueOrEnd)
+		return !Failed();
+
+	const std::size_t depth = Stack.size();
+	while (Stack.size() >= depth)
+	{
+		if (Next() == JsonToken::Error)
+			return false;
+	}
+	return true;
+}
+
+JsonToken JsonReader::ReadValue()
+{
+	if (Pos >= Input.size())
+		return Fail("Unexpected end of input");
+
+	const char c = Input[Pos];
+	switch (c)
+	{
+	case '"':
+		if (!ReadString())
+			return JsonToken::Error;
+		State = Stack.empty() ? Expect::Done : Expect::CommaOrEnd;
+		return JsonToken::String;
+
+	case '{':
+		++Pos;
+		Stack.push_back('{');
+		State = Expect::KeyOrEnd;
+		return JsonToken::BeginObject;
+
+	case '[':
+		++Pos;
+		Stack.push_back('[');
+		State = Expect::ValueOrEnd;
+		return JsonToken::BeginArray;
+
+	case 't':
+	case 'f':
+		if (Match("true"))
+			BoolValue = true;
+		else if (Match("false"))
+			BoolValue = false;
+		else
+			return Fail("Invalid boolean");
+		State = Stack.empty() ? Expect::Done : Expect::CommaOrEnd;
+		return JsonToken::Bool;
+
+	case 'n':
+		if (!Match("null"))
+			return Fail("Invalid null");
+		State = Stack.empty() ? Expect::Done : Expect::CommaOrEnd;
+		return JsonToken::Null;
+
+	default:
+		if (c != '-' && (c < '0' || c > '9'))
+			return Fail(std::string("Unexpected character: ") + c);
+		if (!ReadNumber())
+			return JsonToken::Error;
+		State = Stack.empty() ? Expect::Done : Expect::CommaOrEnd;
+		return JsonToken::Number;
+	}
+}
+
+JsonToken JsonReader::ReadKey()
+{
+	if (Pos >= Input.size() || Input[Pos] != '"')
+		return Fail("Expected string key in object");
+	if (!ReadString())
+		return JsonToken::Error;
+
+	SkipWhitespace();
+	if (Pos >= Input.size() || Input[Pos] != ':')
+		return Fail("Expected ':' after object key");
+	++Pos;
+	State = Expect::Value;
+	return JsonToken::Key;
+}
+
+JsonToken JsonReader::Close(char closer)
+{
+	++Pos;
+	Stack.pop_back();
+	State = Stack.empty() ? Expect::Done : Expect::CommaOrEnd;
+	return closer == '}' ? JsonToken::EndObject : JsonToken::EndArray;
+}
+
+JsonToken JsonReader::Fail(std::string message)
+{
+	if (State != Expect::Failed)
+	{
+		State = Expect::Failed;
+		ErrorInfo.Message = std::move(message);
+		ErrorInfo.Position = Pos;
+	}
+	return JsonToken::Error;
+}
+
+bool JsonReader::ReadString()
+{
+	const std::size_t start = ++Pos; // past the opening quote
+	const std::size_t special = FindQuoteOrEscape(Input, start);
+	if (special < Input.size() && Input[special] == '"')
+	{
+		Text = Input.substr(start, special - start);
+		TextInInput = true;
+		Pos = special + 1;
+		return true;
+	}
+	return ReadEscaped(start, special);
+}
+
+bool JsonReader::ReadEscaped(std::size_t start, std::size_t special)
+{
+	Scratch.assign(Input.data() + start, special - start);
+	Pos = special;
+	while (Pos < Input.size())
+	{
+		if (Input[Pos] == '"')
+		{
+			++Pos;
+			Text = Scratch;
+			TextInInput = false;
+			return true;
+		}
+
+		++Pos; // the backslash
+		if (Pos >= Input.size())
+		{
+			(void)Fail("Unterminated escape sequence");
+			return false;
+		}
+		const char e = Input[Pos++];
+		switch (e)
+		{
+		case '"':  Scratch += '"'; break;
+		case '\\': Scratch += '\\'; break;
+		case '/':  Scratch += '/'; break;
+		case 'b':  Scratch += '\b'; break;
+		case 'f':  Scratch += '\f'; break;
+		case 'n':  Scratch += '\n'; break;
+		case 'r':  Scratch += '\r'; break;
+		case 't':  Scratch += '\t'; break;
+		case 'u':
+		{
+			if (Pos + 4 > Input.size())
+			{
+				(void)Fail("Incomplete \\u escape");
+				return false;
+			}
+			const char* hex = Input.data() + Pos;
+			unsigned int codepoint = 0;
+			const auto [ptr, ec] = std::from_chars(hex, hex + 4, codepoint, 16);
+			if (ec != std::errc{} || ptr != hex + 4)
+			{
+				(void)Fail("Invalid \\u escape");
+				return false;
+			}
+			Pos += 4;
+			AppendUtf8(Scratch, codepoint);
+			break;
+		}
+		default:
+			(void)Fail(std::string("Invalid escape: \\") + e);
+			return false;
+		}
+
+		const std::size_t next = FindQuoteOrEscape(Input, Pos);
+		Scratch.append(Input.data() + Pos, next - Pos);
+		Pos = next;
+	}
+
+	(void)Fail("Unterminated string");
+	return false;
+}
+
+bool JsonReader::ReadNumber()
+{
+	const std::size_t start = Pos;
+
+	if (Input[Pos] == '-')
+		++Pos;
+
+	if (!ConsumeDigits())
+	{
+		(void)Fail("Invalid number");
+		return false;
+	}
+
+	if (Pos < Input.size() && Input[Pos] == '.')
+	{
+		++Pos;
+		if (!ConsumeDigits())
+		{
+			(void)Fail("Invalid number after decimal point");
+			return false;
+		}
+	}
+
+	if (Pos < Input.size() && (Input[Pos] == 'e' || Input[Pos] == 'E'))
+	{
+		++Pos;
+		if (Pos < Input.size() && (Input[Pos] == '+' || Input[Pos] == '-'))
+			++Pos;
+		if (!ConsumeDigits())
+		{
+			(void)Fail("Invalid number exponent");
+			return false;
+		}
+	}
+
+	const auto [ptr, ec] = std::from_chars(Input.data() + start, Input.data() + Pos, NumberValue);
+	if (ec != std::errc{})
+	{
+		(void)Fail("Failed to parse number");
+		return false;
+	}
+	return true;
+}
+
+bool JsonReader::ConsumeDigits()
+{
+	if (Pos >= Input.size() || Input[Pos] < '0' || Input[Pos] > '9')
+		return false;
+	while (Pos < Input.size() && Input[Pos] >= '0' && Input[Pos] <= '9')
+		++Pos;
+	return true;
+}
+
+bool JsonReader::Match(std::string_view literal)
+{
+	if (Input.substr(Pos, literal.size()) != literal)
+		return false;
+	Pos += literal.size();
+	return true;
+}
+
+void JsonReader::SkipWhitespace()
+{
+	// Most tokens are followed by nothing or a single space; settle those
+	// before paying for the wide scan.
+	if (Pos < Input.size() && !IsWhitespace(Input[Pos]))
+		return;
+	Pos = FindNonWhitespace(Input, Pos);
+}
@@ -46,32 +46,25 @@ bool ChunkWriter::Begin(BinaryWriter& writer, std::uint32_t id, std::uint32_t ve
     if (!writer.Write(version)) return false;
 
     // Remember where the size field is so we can patch it later.
-    SizeFieldPos = writer.GetStream().tellp();
-    if (SizeFieldPos == std::streampos(-1)) return false;
+    SizeFieldPos = writer.Tell();
+    if (SizeFieldPos < 0) return false;
 
     std::uint32_t placeholder = 0;
     if (!writer.Write(placeholder)) return false;
 
-    PayloadStartPos = writer.GetStream().tellp();
-    return PayloadStartPos != std::streampos(-1);
+    PayloadStartPos = writer.Tell();
+    return PayloadStartPos >= 0;
 }
 
 bool ChunkWriter::End(BinaryWriter& writer)
 {
-    if (SizeFieldPos == std::streampos(-1)) return false;
+    if (SizeFieldPos < 0) return false;
 
-    auto endPos = writer.GetStream().tellp();
-    if (endPos == std::streampos(-1)) return false;
+    const std::streamoff endPos = writer.Tell();
+    if (endPos < 0) return false;
 
-    auto payloadSize = static_cast<std::uint32_t>(endPos - PayloadStartPos);
-
-    // Seek back to the size field and patch it.
-    writer.GetStream().seekp(SizeFieldPos);
-    if (!writer.Write(payloadSize)) return false;
-
-    // Seek back to the end of the payload.
-    writer.GetStream().seekp(endPos);
-    return !writer.GetStream().fail();
+    const auto payloadSize = static_cast<std::uint32_t>(endPos - PayloadStartPos);
+    return writer.WriteAt(SizeFieldPos, payloadSize);
 }
 
 // --- ChunkReader ------------------------------------------------------------
@@ -80,15 +73,21 @@ bool ChunkReader::ReadHeader(BinaryReader& reader)
 {
     if (!ReadChunkHeader(reader, Header)) return false;
 
-    PayloadStartPos = reader.GetStream().tellg();
-    return PayloadStartPos != std::streampos(-1);
+    // One bounds check for the whole payload; truncated data fails here
+    // rather than partway through a decode.
+    if (const SpanReader* memory = reader.MemorySource();
+        memory != nullptr && Header.Size > memory->Remaining())
+    {
+        return false;
+    }
+
+    PayloadStartPos = reader.Tell();
+    return PayloadStartPos >= 0;
 }
 
 bool ChunkReader::Skip(BinaryReader& reader)
 {
-    if (PayloadStartPos == std::streampos(-1)) return false;
+    if (PayloadStartPos < 0) return false;
 
-    auto targetPos = PayloadStartPos + static_cast<std::streamoff>(Header.Size);
-    reader.GetStream().seekg(targetPos);
-    return !reader.GetStream().fail();
+    return reader.Seek(PayloadStartPos + static_cast<std::streamoff>(Header.Size));
 }
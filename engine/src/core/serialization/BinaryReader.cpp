@@ -1,10 +1,39 @@
 #include <core/serialization/BinaryReader.h>
 
-bool BinaryReader::ReadBytes(char* buffer, std::streamsize count)
+bool BinaryReader::ReadFromStream(char* buffer, std::streamsize count)
 {
     if (count < 0) return false;
     if (count == 0) return true;
 
-    Stream.read(buffer, count);
-    return Stream.good();
-}
\ No newline at end of file
+    Stream->read(buffer, count);
+    return Stream->good();
+}
+
+std::streamoff BinaryReader::Tell()
+{
+    if (Memory != nullptr)
+        return static_cast<std::streamoff>(Memory->Position());
+
+    const std::streampos position = Stream->tellg();
+    return position == std::streampos(-1) ? -1 : static_cast<std::streamoff>(position);
+}
+
+bool BinaryReader::Seek(std::streamoff position)
+{
+    if (position < 0) return false;
+    if (Memory != nullptr)
+        return Memory->Seek(static_cast<std::size_t>(position));
+
+    // A read that stopped at the end leaves eofbit set; seeking back to an
+    // earlier offset is still valid.
+    Stream->clear();
+    Stream->seekg(position);
+    return !Stream->fail();
+}
+
+bool BinaryReader::AtEnd()
+{
+    if (Memory != nullptr)
+        return Memory->AtEnd();
+    return Stream->peek() == std::istream::traits_type::eof();
+}
@@ -1,10 +1,31 @@
 #include <core/serialization/BinaryWriter.h>
 
-bool BinaryWriter::WriteBytes(const char* buffer, std::streamsize count)
+bool BinaryWriter::WriteToStream(const char* buffer, std::streamsize count)
 {
     if (count < 0) return false;
     if (count == 0) return true;
 
-    Stream.write(buffer, count);
-    return !Stream.fail();
-}
\ No newline at end of file
+    Stream->write(buffer, count);
+    return !Stream->fail();
+}
+
+bool BinaryWriter::WriteToStreamAt(std::streamoff position, const char* buffer, std::streamsize count)
+{
+    const std::streampos end = Stream->tellp();
+    if (end == std::streampos(-1)) return false;
+
+    Stream->seekp(position);
+    if (!WriteToStream(buffer, count)) return false;
+
+    Stream->seekp(end);
+    return !Stream->fail();
+}
+
+std::streamoff BinaryWriter::Tell()
+{
+    if (Memory != nullptr)
+        return static_cast<std::streamoff>(Memory->Size());
+
+    const std::streampos position = Stream->tellp();
+    return position == std::streampos(-1) ? -1 : static_cast<std::streamoff>(position);
+}
@@ -5,6 +5,8 @@
 #include <net/NetStats.h>
 #include <net/NetTickEstimator.h>
 #include <net/PeerCommandRuntime.h>
+#include <net/PredictionRuntime.h>
+#include <net/SnapshotInterpolation.h>
 
 #include <imgui.h>
 
@@ -59,11 +61,15 @@ NetStatsPanel::NetStatsPanel(const std::unique_ptr<NetSession>& session,
                              const NetStats& traffic,
                              const NetTickEstimator& clock,
                              PeerCommandRuntime& commands,
+                             const PredictionRuntime& prediction,
+                             const SnapshotInterpolation& interpolation,
                              ConsoleRegistry& console)
     : Session(session)
     , Traffic(traffic)
     , Clock(clock)
     , Commands(commands)
+    , Prediction(prediction)
+    , Interpolation(interpolation)
     , Console(console)
 {
 }
@@ -108,6 +114,54 @@ void NetStatsPanel::Draw()
         {
             ImGui::TextUnformatted("authority clock not named yet");
         }
+
+        ImGui::SeparatorText("Prediction");
+        if (!Prediction.IsEnabled())
+            ImGui::TextUnformatted("off: input-delay mode. `net.predict 1` to predict.");
+        const PredictionRuntime::Counters& predicted = Prediction.Stats();
+        // The rate that matters is mispredictions per check: a handful out of
+        // thousands is a collision the client could not have known about, and
+        // a steady fraction is a simulation that does not match the
+        // authority's.
+        ImGui::Text("%zu entities  |  %zu ticks held", Prediction.PredictedEntities(),
+                    Prediction.RecordedTicks());
+        ImGui::Text("checked %" PRIu64 "  mispredicted %" PRIu64
+                    "  over budget %" PRIu64 "  unverified %" PRIu64
+                    "  snapped %" PRIu64,
+                    predicted.Reconciled, predicted.Mispredicted,
+                    predicted.OverBudget, predicted.Unverified, predicted.Snapped);
+        ImGui::Text("resim  %u ticks  %.3f ms last  %.3f ms peak  |  %" PRIu64
+                    " ticks total",
+                    predicted.LastResimTicks, predicted.LastResimMilliseconds,
+                    predicted.PeakResimMilliseconds, predicted.ResimulatedTicks);
+
+        int budget = static_cast<int>(Prediction.ResimBudget());
+        if (ImGui::SliderInt("resim budget (ticks)", &budget, 0,
+                             static_cast<int>(PredictionRuntime::kCapacityTicks)))
+        {
+            (void)Console.SetCVar("net.resim_budget",
+                                  static_cast<std::int64_t>(budget),
+                                  ConsoleValueSource{ "net stats panel" },
+                                  ConsolePhase::EngineReady);
+        }
+        ImGui::SetItemTooltip(
+            "Ticks one correction may replay. Over it the correction is "
+            "skipped; below the round trip, every one is.");
+
+        ImGui::SeparatorText("Interpolation");
+        if (!Interpolation.IsEnabled())
+            ImGui::TextUnformatted("off: remote entities drawn at the tick rate.");
+        const SnapshotInterpolation::Counters& drawn = Interpolation.Stats();
+        // Delay is the cost and jitter the reason for it: a delay well above
+        // what the jitter asks for is a render clock still easing in.
+        ImGui::Text("delay %.2f ticks (target %.2f)  |  jitter %.2f ticks",
+                    drawn.DelayTicks, drawn.TargetDelayTicks, Clock.JitterTicks());
+        ImGui::Text("%zu entities: %u blended  %u extrapolated  %u held",
+                    Interpolation.TrackedEntities(), drawn.Interpolated,
+                    drawn.Extrapolated, drawn.Held);
+        ImGui::SetItemTooltip(
+            "Extrapolated entities are past the newest snapshot; held ones "
+            "ran out of extrapolation and stopped.");
     }
     else
     {
@@ -135,6 +189,21 @@ void NetStatsPanel::Draw()
         ImGui::TreePop();
     }
 
+    if (ImGui::TreeNode("Transport"))
+    {
+        // Calls next to datagrams: the ratio is what batching buys, and a
+        // transport that cannot batch reads one to one.
+        const NetTransportRate& transport = Traffic.Transport();
+        ImGui::Text("recv  %7.1f calls/s  %7.1f dgram/s",
+                    transport.ReceiveCalls, transport.DatagramsIn);
+        ImGui::Text("send  %7.1f calls/s  %7.1f dgram/s",
+                    transport.SendCalls, transport.DatagramsOut);
+        ImGui::Text("pump  %.3f ms avg  %.3f ms peak  |  flush %.3f ms avg",
+                    transport.PumpMilliseconds, transport.PumpMillisecondsPeak,
+                    transport.FlushMilliseconds);
+        ImGui::TreePop();
+    }
+
     ImGui::SeparatorText("Peers");
     const std::vector<PeerId> peers = session->ConnectedPeers();
     if (peers.empty())
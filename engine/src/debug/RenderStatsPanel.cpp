@@ -74,6 +74,10 @@ void RenderStatsPanel::Draw()
 	            stats->VisibleObjects, stats->DrawCalls, stats->SubmittedTriangles);
 	ImGui::Text("  pipeline switches %u  material switches %u",
 	            stats->PipelineSwitches, stats->MaterialSwitches);
+	ImGui::Text("  LOD-reduced items %u  full-detail tris %u",
+	            stats->LodReducedItems, stats->FullDetailTriangles);
+	ImGui::Text("  meshlets tested %u  culled %u",
+	            stats->MeshletsTested, stats->MeshletsCulled);
 	if (stats->InstancesDropped > 0)
 	{
 		ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.4f, 1.0f),
@@ -87,6 +91,28 @@ void RenderStatsPanel::Draw()
 	            stats->ShadowCastingLights);
 	ImGui::Text("  probe volumes resident %u", stats->ProbeVolumesResident);
 
+	ImGui::Separator();
+	ImGui::Text("Texture streaming");
+	const float textureMib = static_cast<float>(stats->TextureResidentBytes) / (1024.0f * 1024.0f);
+	if (stats->TextureBudgetBytes > 0)
+	{
+		ImGui::Text("  resident %.1f / %.1f MiB  textures %u", textureMib,
+		            static_cast<float>(stats->TextureBudgetBytes) / (1024.0f * 1024.0f),
+		            stats->TexturesStreamed);
+	}
+	else
+	{
+		ImGui::Text("  resident %.1f MiB (no budget)  textures %u", textureMib,
+		            stats->TexturesStreamed);
+	}
+	ImGui::Text("  mips requested %u  resident %u  pending textures %u",
+	            stats->TextureMipsRequested, stats->TextureMipsResident,
+	            stats->TexturesPending);
+	ImGui::Text("  promoted %u  evicted %u  uploaded %.1f KiB  latency %.1f ms",
+	            stats->TexturePromotions, stats->TextureEvictions,
+	            static_cast<float>(stats->TextureUploadBytes) / 1024.0f,
+	            static_cast<float>(stats->TextureStreamLatencyUs) / 1000.0f);
+
 	ImGui::Separator();
 	ImGui::Text("Shadows");
 	ImGui::Text("  slots %u  denied %u  views rendered %u  caster draws %u",
@@ -105,9 +131,9 @@ void RenderStatsPanel::Draw()
 	            static_cast<float>(stats->ShadowTileBytes) / (1024.0f * 1024.0f));
 	ImGui::Text("  point cubes %u  faces rendered %u",
 	            stats->PointShadowCubesHeld, stats->PointShadowFacesRendered);
-	ImGui::Text("  casters tested %u  visible %u  runs %u",
+	ImGui::Text("  casters tested %u  visible %u  runs %u  meshlets culled %u",
 	            stats->ShadowCastersTested, stats->ShadowCastersVisible,
-	            stats->ShadowInstanceRuns);
+	            stats->ShadowInstanceRuns, stats->ShadowMeshletsCulled);
 
 	ImGui::Separator();
 	ImGui::Text("Frame services");
@@ -4,7 +4,9 @@
 #include <graphics/vulkan/VulkanImageService.h>
 #include <graphics/vulkan/VulkanSamplerCache.h>
 
+#include <algorithm>
 #include <cassert>
+#include <utility>
 
 namespace
 {
@@ -18,6 +20,16 @@ namespace
         return VK_FORMAT_R8G8B8A8_SRGB;
     }
 
+    // Bytes of `texture`'s chain from `topMip` down: what an image built by
+    // UploadGpuImage at that level holds.
+    uint64_t MipChainBytes(const TextureData& texture, uint32_t topMip)
+    {
+        uint64_t bytes = 0;
+        for (size_t level = topMip; level < texture.Mips.size(); ++level)
+            bytes += texture.Mips[level].ByteSize;
+        return bytes;
+    }
+
     VkFormat ToVkFormat(TexturePixelFormat fmt)
     {
         switch (fmt)
@@ -126,9 +138,52 @@ TextureHandle TextureCache::CreateFromTextureData(std::string_view name,
     entry.Bindless = bindless;
     entry.Extent = { texture.Width, texture.Height };
     entry.Sampler = sampler;
+    entry.GpuBytes = MipChainBytes(texture, 0);
     return name.empty() ? AllocHandle(std::move(entry)) : AllocNamedHandle(name, std::move(entry));
 }
 
+TextureHandle TextureCache::CreateFromTextureData(std::string_view name,
+                                                  TextureData&& texture,
+                                                  const SamplerDesc& sampler)
+{
+    const uint32_t tailTopMip = TextureMipTailTopMip(texture.Mips);
+    if (!MipStreaming || name.empty() || tailTopMip == 0)
+        return CreateFromTextureData(name, std::as_const(texture), sampler);
+
+    if (TextureHandle existing = FindRegisteredHandle(name, /*addRef*/ true); existing.IsValid())
+        return existing;
+
+    auto source = std::make_shared<const TextureData>(std::move(texture));
+    ImageHandle gpuImage = UploadGpuImage(*source, name, tailTopMip);
+    if (!gpuImage.IsValid())
+        return {};
+
+    VkSampler vkSampler = Samplers->Get(sampler);
+    BindlessImageIndex bindless = Descriptors->RegisterSampledImage(gpuImage, vkSampler);
+    if (!bindless.IsValid())
+    {
+        Log.Error("TextureCache: bindless descriptor slot exhausted for '{}'", name);
+        Images->Destroy(gpuImage);
+        return {};
+    }
+
+    TextureEntry entry;
+    entry.GpuImage = gpuImage;
+    entry.Bindless = bindless;
+    entry.Extent = { source->Width, source->Height };
+    entry.Sampler = sampler;
+    entry.StreamSource = source;
+    entry.ResidentTopMip = tailTopMip;
+    entry.GpuBytes = MipChainBytes(*source, tailTopMip);
+    const TextureHandle handle = AllocNamedHandle(name, std::move(entry));
+    if (handle.IsValid())
+    {
+        Residency.Track(bindless.Value, source->Mips, tailTopMip, tailTopMip);
+        StreamedTextures[bindless.Value] = handle;
+    }
+    return handle;
+}
+
 TextureHandle TextureCache::Find(std::string_view name) const
 {
     return FindRegisteredHandle(name);
@@ -143,11 +198,32 @@ std::string_view TextureCache::GetName(TextureHandle handle) const
 
 bool TextureCache::ReloadInPlace(std::string_view path, const TextureData& texture)
 {
+    TextureEntry* streamed = Resolve(FindRegisteredHandle(path));
+    if (streamed != nullptr && streamed->StreamSource != nullptr)
+    {
+        const uint32_t tailTopMip = TextureMipTailTopMip(texture.Mips);
+        const uint32_t topMip = std::min(streamed->ResidentTopMip, tailTopMip);
+        auto source = std::make_shared<const TextureData>(texture);
+        ImageHandle gpuImage = UploadGpuImage(*source, path, topMip);
+        if (!gpuImage.IsValid())
+            return false;
+        const SamplerDesc sampler = SamplerForTextureData(texture);
+        if (!ReloadEntryImage(path, gpuImage, { texture.Width, texture.Height },
+                              MipChainBytes(texture, topMip), &sampler))
+            return false;
+
+        streamed->StreamSource = source;
+        streamed->ResidentTopMip = topMip;
+        Residency.Track(streamed->Bindless.Value, source->Mips, topMip, tailTopMip);
+        return true;
+    }
+
     ImageHandle gpuImage = UploadGpuImage(texture, path);
     if (!gpuImage.IsValid())
         return false;
     const SamplerDesc sampler = SamplerForTextureData(texture);
-    return ReloadEntryImage(path, gpuImage, { texture.Width, texture.Height }, &sampler);
+    return ReloadEntryImage(path, gpuImage, { texture.Width, texture.Height },
+                            MipChainBytes(texture, 0), &sampler);
 }
 
 bool TextureCache::ReloadInPlace(std::string_view path, const Image& image)
@@ -160,11 +236,11 @@ bool TextureCache::ReloadInPlace(std::string_view path, const Image& image)
     ImageHandle gpuImage = UploadGpuImage(image, std::string(path).c_str());
     if (!gpuImage.IsValid())
         return false;
-    return ReloadEntryImage(path, gpuImage, { image.Width, image.Height });
+    return ReloadEntryImage(path, gpuImage, { image.Width, image.Height }, image.ByteSize());
 }
 
 bool TextureCache::ReloadEntryImage(std::string_view path, ImageHandle newImage, VkExtent2D extent,
-                                    const SamplerDesc* newSampler)
+                                    uint64_t gpuBytes, const SamplerDesc* newSampler)
 {
     TextureEntry* entry = Resolve(FindRegisteredHandle(path));
     if (entry == nullptr)
@@ -177,15 +253,56 @@ bool TextureCache::ReloadEntryImage(std::string_view path, ImageHandle newImage,
     if (newSampler != nullptr)
         entry->Sampler = *newSampler;
 
+    SwapEntryImage(*entry, newImage, gpuBytes);
+    entry->Extent = extent;
+    return true;
+}
+
+void TextureCache::SwapEntryImage(TextureEntry& entry, ImageHandle newImage, uint64_t gpuBytes)
+{
     // Repoint the existing bindless slot at the new image (same index, so
     // materials are unaffected), then retire the old image through the
     // deletion queue. Generation, refcount, and the handle are untouched.
-    VkSampler vkSampler = Samplers->Get(entry->Sampler);
-    Descriptors->UpdateSampledImage(entry->Bindless, newImage, vkSampler);
-    Images->Destroy(entry->GpuImage);
+    VkSampler vkSampler = Samplers->Get(entry.Sampler);
+    Descriptors->UpdateSampledImage(entry.Bindless, newImage, vkSampler);
+    Images->Destroy(entry.GpuImage);
+    entry.GpuImage = newImage;
+    entry.GpuBytes = gpuBytes;
+}
 
-    entry->GpuImage = newImage;
-    entry->Extent = extent;
+// -- Mip streaming ------------------------------------------------------------
+
+void TextureCache::UpdateMipStreaming(const TextureStreamingDemand& demand,
+                                      const TextureStreamingBudgets& budgets,
+                                      double nowMs)
+{
+    Residency.Update(demand, budgets, nowMs);
+    for (const TextureMipChange& change : Residency.Changes())
+    {
+        const auto it = StreamedTextures.find(change.Texture);
+        if (it == StreamedTextures.end() || !ApplyResidentTopMip(it->second, change.ToTopMip))
+            Residency.MarkChangeFailed(change.Texture);
+    }
+}
+
+uint32_t TextureCache::GetResidentTopMip(TextureHandle handle) const
+{
+    const TextureEntry* entry = Resolve(handle);
+    return entry ? entry->ResidentTopMip : 0;
+}
+
+bool TextureCache::ApplyResidentTopMip(TextureHandle handle, uint32_t topMip)
+{
+    TextureEntry* entry = Resolve(handle);
+    if (entry == nullptr || entry->StreamSource == nullptr)
+        return false;
+
+    ImageHandle gpuImage = UploadGpuImage(*entry->StreamSource, entry->PathKey, topMip);
+    if (!gpuImage.IsValid())
+        return false;
+
+    SwapEntryImage(*entry, gpuImage, MipChainBytes(*entry->StreamSource, topMip));
+    entry->ResidentTopMip = topMip;
     return true;
 }
 
@@ -226,6 +343,14 @@ ImageHandle TextureCache::GetGpuImage(TextureHandle handle) const
 
 void TextureCache::OnFree(TextureEntry& entry)
 {
+    if (entry.StreamSource != nullptr && entry.Bindless.IsValid())
+    {
+        Residency.Untrack(entry.Bindless.Value);
+        StreamedTextures.erase(entry.Bindless.Value);
+    }
+    entry.StreamSource.reset();
+    entry.ResidentTopMip = 0;
+
     if (entry.Bindless.IsValid())
     {
         Descriptors->UnregisterSampledImage(entry.Bindless);
@@ -239,6 +364,7 @@ void TextureCache::OnFree(TextureEntry& entry)
     }
 
     entry.Extent = {};
+    entry.GpuBytes = 0;
 }
 
 bool TextureCache::IsEntryLive(const TextureEntry& entry) const
@@ -246,6 +372,16 @@ bool TextureCache::IsEntryLive(const TextureEntry& entry) const
     return entry.GpuImage.IsValid();
 }
 
+AssetFootprint TextureCache::WarmFootprint(const TextureEntry& entry) const
+{
+    // A streamed entry also keeps its cooked source in memory. Parked, it is
+    // still tracked and sheds toward its tail like any unseen texture; the
+    // footprint is what it held when it was released.
+    const uint64_t sourceBytes =
+        entry.StreamSource != nullptr ? entry.StreamSource->Pixels().size() : 0;
+    return { .CpuBytes = sourceBytes, .GpuBytes = entry.GpuBytes };
+}
+
 // -- Private ------------------------------------------------------------------
 
 bool TextureCache::UploadImage(const Image& image,
@@ -272,6 +408,7 @@ bool TextureCache::UploadImage(const Image& image,
     out.Bindless = bindless;
     out.Extent   = { image.Width, image.Height };
     out.Sampler  = sampler;
+    out.GpuBytes = image.ByteSize();
     return true;
 }
 
@@ -301,7 +438,8 @@ ImageHandle TextureCache::UploadGpuImage(const Image& image, const char* debugNa
     return gpuImage;
 }
 
-ImageHandle TextureCache::UploadGpuImage(const TextureData& texture, std::string_view name)
+ImageHandle TextureCache::UploadGpuImage(const TextureData& texture, std::string_view name,
+                                         uint32_t topMip)
 {
     if (!ValidateTextureData(texture))
     {
@@ -317,11 +455,14 @@ ImageHandle TextureCache::UploadGpuImage(const TextureData& texture, std::string
         return {};
     }
 
+    assert(topMip < texture.Mips.size());
+    const TextureMipLevel& top = texture.Mips[topMip];
+
     ImageCreateInfo info;
     info.Format = format;
-    info.Extent = { texture.Width, texture.Height };
+    info.Extent = { top.Width, top.Height };
     info.Usage = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
-    info.MipLevels = static_cast<uint32_t>(texture.Mips.size());
+    info.MipLevels = static_cast<uint32_t>(texture.Mips.size()) - topMip;
     info.GenerateMips = false;
     const std::string debugName(name);
     info.DebugName = debugName.c_str();
@@ -333,21 +474,24 @@ ImageHandle TextureCache::UploadGpuImage(const TextureData& texture, std::string
         return {};
     }
 
+    // Levels are contiguous from the top one down (ValidateTextureData), so
+    // skipping the upper levels is an offset into the blob.
     std::vector<VulkanImageService::MipUploadRegion> regions;
-    regions.reserve(texture.Mips.size());
-    for (uint32_t i = 0; i < texture.Mips.size(); ++i)
+    regions.reserve(info.MipLevels);
+    for (uint32_t i = topMip; i < texture.Mips.size(); ++i)
     {
         const TextureMipLevel& mip = texture.Mips[i];
         regions.push_back(VulkanImageService::MipUploadRegion{
-            .MipLevel = i,
+            .MipLevel = i - topMip,
             .Width = mip.Width,
             .Height = mip.Height,
-            .Offset = static_cast<VkDeviceSize>(mip.Offset),
+            .Offset = static_cast<VkDeviceSize>(mip.Offset - top.Offset),
         });
     }
 
-    if (!Images->UploadMips(gpuImage, texture.Blob.data(),
-                            static_cast<VkDeviceSize>(texture.Blob.size()), regions))
+    const std::span<const uint8_t> pixels = texture.Pixels().subspan(top.Offset);
+    if (!Images->UploadMips(gpuImage, pixels.data(),
+                            static_cast<VkDeviceSize>(pixels.size()), regions))
     {
         Log.Error("TextureCache: mip-chain upload failed for '{}'", name);
         Images->Destroy(gpuImage);
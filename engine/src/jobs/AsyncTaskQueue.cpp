@@ -1,7 +1,10 @@
 #include <jobs/AsyncTaskQueue.h>
 
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
+#include <iterator>
+#include <utility>
 
 namespace
 {
@@ -25,15 +28,39 @@ namespace
         return fn(std::forward<Args>(args)...);
 #endif
     }
+
+    [[nodiscard]] AsyncTaskPriority PriorityOf(const AsyncTaskPriorityCell& cell)
+    {
+        return cell ? cell->load(std::memory_order_relaxed) : AsyncTaskPriority::Normal;
+    }
+
+    template <typename Task>
+    [[nodiscard]] std::chrono::steady_clock::time_point DeadlineOf(const Task& task)
+    {
+        return task.SharedDeadline ? task.SharedDeadline->load(std::memory_order_relaxed)
+                                   : task.Deadline;
+    }
 }
 
-AsyncTaskQueue::AsyncTaskQueue(uint32_t workerCount)
-    : OwnerThread(std::this_thread::get_id())
+AsyncTaskQueue::AsyncTaskQueue(uint32_t workerCount, uint32_t ioWorkerCount)
+    : ComputeWorkerCount(workerCount)
+    , IoWorkers(ioWorkerCount)
+    // Enough finished reads to keep every compute thread fed through one
+    // more pick, and no more: each holds a whole file's bytes.
+    , MaxDecodeBacklog(std::max<std::size_t>(2, 2 * static_cast<std::size_t>(workerCount)))
+    , OwnerThread(std::this_thread::get_id())
 {
-    Workers.reserve(workerCount);
+    assert((ioWorkerCount == 0 || workerCount > 0)
+           && "AsyncTaskQueue: an I/O pool needs compute threads to decode what it reads");
+
+    Workers.reserve(workerCount + ioWorkerCount);
     for (uint32_t i = 0; i < workerCount; ++i)
     {
-        Workers.emplace_back(&AsyncTaskQueue::WorkerMain, this);
+        Workers.emplace_back(&AsyncTaskQueue::WorkerMain, this, Lane::Compute);
+    }
+    for (uint32_t i = 0; i < ioWorkerCount; ++i)
+    {
+        Workers.emplace_back(&AsyncTaskQueue::WorkerMain, this, Lane::Io);
     }
 }
 
@@ -46,28 +73,47 @@ AsyncTaskQueue::~AsyncTaskQueue()
         ShutdownRequested = true;
     }
     WorkSignal.notify_all();
+    IoSignal.notify_all();
     for (auto& worker : Workers)
     {
         worker.join();
     }
 }
 
-AsyncTaskHandle AsyncTaskQueue::SubmitErased(ErasedWork work)
+AsyncTaskHandle AsyncTaskQueue::SubmitErased(ErasedRead read,
+                                             ErasedWork work,
+                                             AsyncTaskOptions options)
 {
     assert(std::this_thread::get_id() == OwnerThread
            && "AsyncTaskQueue::Submit is owner-thread-only");
 
     auto state = std::make_shared<std::atomic<AsyncTaskState>>(AsyncTaskState::Pending);
+    const bool staged = static_cast<bool>(read);
 
     {
         std::lock_guard<std::mutex> lock(Mutex);
-        PendingTasks.push_back(Task{ state, std::move(work), {} });
+        Task task{ .State = state,
+                   .Priority = std::move(options.Priority),
+                   .Deadline = options.Deadline,
+                   .SharedDeadline = std::move(options.SharedDeadline),
+                   .ReadOrder = options.ReadOrder,
+                   .Label = options.Label,
+                   .Read = std::move(read),
+                   .Work = std::move(work),
+                   .Commit = {},
+                   .SubmittedAt = TraceLatency ? std::chrono::steady_clock::now()
+                                               : std::chrono::steady_clock::time_point{} };
+        (staged ? PendingReads : PendingTasks).push_back(std::move(task));
+    }
+    if (staged && IoWorkerCount() > 0)
+    {
+        IoSignal.notify_one();
     }
-    if (!Workers.empty())
+    else if (!Workers.empty())
     {
         WorkSignal.notify_one();
     }
-    return AsyncTaskHandle{ std::move(state) };
+    return AsyncTaskHandle{ std::move(state), std::move(options.Stop) };
 }
 
 bool AsyncTaskQueue::Cancel(const AsyncTaskHandle& handle)
@@ -76,17 +122,50 @@ bool AsyncTaskQueue::Cancel(const AsyncTaskHandle& handle)
            && "AsyncTaskQueue::Cancel is owner-thread-only");
     assert(handle.IsValid() && "AsyncTaskQueue::Cancel: invalid handle");
 
+    // Running is divertible only when the work can be told to stop; the
+    // thread running it drops the result when it sees Cancelled.
+    const bool stoppable = handle.Stop.stop_possible();
     AsyncTaskState expected = handle.State->load();
-    while (expected == AsyncTaskState::Pending || expected == AsyncTaskState::AwaitingCommit)
+    while (expected == AsyncTaskState::Pending || expected == AsyncTaskState::AwaitingCommit
+           || (stoppable && expected == AsyncTaskState::Running))
     {
         if (handle.State->compare_exchange_weak(expected, AsyncTaskState::Cancelled))
         {
+            if (stoppable)
+            {
+                std::stop_source stop = handle.Stop;
+                stop.request_stop();
+            }
             return true;
         }
     }
     return false;
 }
 
+AsyncTaskHandle AsyncTaskQueue::SubmitCommitSlices(std::function<bool()> slice,
+                                                   AsyncTaskOptions options)
+{
+    assert(std::this_thread::get_id() == OwnerThread
+           && "AsyncTaskQueue::SubmitCommitSlices is owner-thread-only");
+    assert(slice && "AsyncTaskQueue::SubmitCommitSlices: slice must not be empty");
+
+    auto state = std::make_shared<std::atomic<AsyncTaskState>>(AsyncTaskState::AwaitingCommit);
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+        Task task{ .State = state,
+                   .Priority = std::move(options.Priority),
+                   .Deadline = options.Deadline,
+                   .SharedDeadline = std::move(options.SharedDeadline),
+                   .Label = options.Label,
+                   .Read = {},
+                   .Work = {},
+                   .Commit = std::move(slice),
+                   .Sliced = true };
+        QueueSliceLocked(std::move(task));
+    }
+    return AsyncTaskHandle{ std::move(state), std::move(options.Stop) };
+}
+
 std::size_t AsyncTaskQueue::DrainCompletions(const AsyncDrainBudget& budget)
 {
     assert(std::this_thread::get_id() == OwnerThread
@@ -94,15 +173,18 @@ std::size_t AsyncTaskQueue::DrainCompletions(const AsyncDrainBudget& budget)
 
     // Pop one, commit one: the time check has to sit between commits, and
     // commits run unlocked because they may Submit follow-up tasks while task
-    // threads keep publishing completions.
+    // threads keep publishing completions. A slice of a sliced commit is a
+    // turn like any commit and goes back in line after it; only a finished
+    // commit counts.
     const auto start = std::chrono::steady_clock::now();
     std::size_t committed = 0;
+    std::size_t turns = 0;
 
     while (committed < budget.MaxCommits)
     {
-        // MaxTime is soft: the first commit always runs, later ones only
+        // MaxTime is soft: the first turn always runs, later ones only
         // while the budget has time left (AsyncDrainBudget contract).
-        if (committed > 0 && std::chrono::steady_clock::now() - start >= budget.MaxTime)
+        if (turns > 0 && std::chrono::steady_clock::now() - start >= budget.MaxTime)
         {
             break;
         }
@@ -118,17 +200,58 @@ std::size_t AsyncTaskQueue::DrainCompletions(const AsyncDrainBudget& budget)
             CompletedTasks.pop_front();
         }
 
+        if (task.Sliced)
+        {
+            // Stays AwaitingCommit until its last slice, so Cancel between
+            // slices drops the rest here.
+            if (task.State->load() != AsyncTaskState::AwaitingCommit)
+            {
+                continue;
+            }
+            ++turns;
+            if (!RunGuarded("commit", task.Commit))
+            {
+                std::lock_guard<std::mutex> lock(Mutex);
+                QueueSliceLocked(std::move(task));
+                continue;
+            }
+            AsyncTaskState expected = AsyncTaskState::AwaitingCommit;
+            (void)task.State->compare_exchange_strong(expected, AsyncTaskState::Committed);
+            ++committed;
+            continue;
+        }
+
         AsyncTaskState expected = AsyncTaskState::AwaitingCommit;
         if (!task.State->compare_exchange_strong(expected, AsyncTaskState::Committed))
         {
             continue;  // cancelled between completion and drain: drop, free budget
         }
-        RunGuarded("commit", task.Commit);
+        ++turns;
+        (void)RunGuarded("commit", task.Commit);
         ++committed;
     }
     return committed;
 }
 
+void AsyncTaskQueue::QueueSliceLocked(Task&& task)
+{
+    // Behind every waiting commit, so none waits more than a slice; ahead of
+    // sliced commits of lower priority, so a speculative zone's import does
+    // not take turns with the focus zone's.
+    const AsyncTaskPriority priority = PriorityOf(task.Priority);
+    auto at = CompletedTasks.end();
+    while (at != CompletedTasks.begin())
+    {
+        const Task& waiting = *std::prev(at);
+        if (!waiting.Sliced || PriorityOf(waiting.Priority) >= priority)
+        {
+            break;
+        }
+        --at;
+    }
+    CompletedTasks.insert(at, std::move(task));
+}
+
 std::size_t AsyncTaskQueue::PumpWork(std::size_t maxTasks)
 {
     assert(std::this_thread::get_id() == OwnerThread
@@ -137,26 +260,171 @@ std::size_t AsyncTaskQueue::PumpWork(std::size_t maxTasks)
            && "AsyncTaskQueue::PumpWork is for the zero-worker test mode only");
 
     std::size_t ran = 0;
-    while (ran < maxTasks && RunOnePendingTask())
+    while (ran < maxTasks && RunOnePendingTask(Lane::Pump))
     {
         ++ran;
     }
     return ran;
 }
 
-bool AsyncTaskQueue::RunOnePendingTask()
+void AsyncTaskQueue::SetLatencyTracing(bool enabled)
+{
+    assert(std::this_thread::get_id() == OwnerThread
+           && "AsyncTaskQueue::SetLatencyTracing is owner-thread-only");
+    std::lock_guard<std::mutex> lock(Mutex);
+    TraceLatency = enabled;
+}
+
+std::vector<AsyncTaskLatency> AsyncTaskQueue::TakeLatencySamples()
+{
+    assert(std::this_thread::get_id() == OwnerThread
+           && "AsyncTaskQueue::TakeLatencySamples is owner-thread-only");
+    std::lock_guard<std::mutex> lock(Mutex);
+    return std::exchange(LatencySamples, {});
+}
+
+bool AsyncTaskQueue::HasWorkLocked(Lane lane) const
+{
+    switch (lane)
+    {
+    case Lane::Io:
+        return !PendingReads.empty() && DecodeBacklog < MaxDecodeBacklog;
+    case Lane::Compute:
+        return !PendingTasks.empty() || (IoWorkerCount() == 0 && !PendingReads.empty());
+    case Lane::Pump:
+        return !PendingTasks.empty() || !PendingReads.empty();
+    }
+    return false;
+}
+
+bool AsyncTaskQueue::TakeLocked(Lane lane, Task& out)
+{
+    if (!HasWorkLocked(lane))
+    {
+        return false;
+    }
+
+    // RunsBefore orders the candidates; oldest first among equals. Ties
+    // between a decode and a read go to the decode: finishing it releases
+    // bytes, the read would hold more. Queues are manifest-sized, so a scan
+    // is fine.
+    std::deque<Task>* best = nullptr;
+    std::size_t bestIndex = 0;
+    const auto scan = [&](std::deque<Task>& queue)
+    {
+        for (std::size_t i = 0; i < queue.size(); ++i)
+        {
+            if (best == nullptr || RunsBefore(queue[i], (*best)[bestIndex]))
+            {
+                best = &queue;
+                bestIndex = i;
+            }
+        }
+    };
+    if (lane != Lane::Io)
+    {
+        scan(PendingTasks);
+    }
+    if (lane == Lane::Io || lane == Lane::Pump || IoWorkerCount() == 0)
+    {
+        scan(PendingReads);
+    }
+    if (best == nullptr)
+    {
+        return false;
+    }
+
+    out = std::move((*best)[bestIndex]);
+    best->erase(best->begin() + static_cast<std::ptrdiff_t>(bestIndex));
+    if (out.Decoding)
+    {
+        --DecodeBacklog;
+    }
+    else
+    {
+        if (out.Read && out.ReadOrder != 0)
+        {
+            ReadCursor = out.ReadOrder;
+        }
+        if (TraceLatency)
+        {
+            out.StartedAt = std::chrono::steady_clock::now();
+        }
+    }
+    return true;
+}
+
+bool AsyncTaskQueue::RunsBefore(const Task& candidate, const Task& best) const
+{
+    const AsyncTaskPriority priority = PriorityOf(candidate.Priority);
+    const AsyncTaskPriority bestPriority = PriorityOf(best.Priority);
+    if (priority != bestPriority)
+    {
+        return priority > bestPriority;
+    }
+    const auto deadline = DeadlineOf(candidate);
+    const auto bestDeadline = DeadlineOf(best);
+    if (deadline != bestDeadline)
+    {
+        return deadline < bestDeadline;
+    }
+    if (candidate.Read && best.Read && candidate.ReadOrder != best.ReadOrder)
+    {
+        // Distance up from the cursor, wrapping: the sweep takes the nearest
+        // read at or past the last one, and restarts from the lowest when
+        // none is left above it. Unplaced reads (zero) sort after placed ones
+        // unless the sweep has wrapped to them.
+        return candidate.ReadOrder - ReadCursor < best.ReadOrder - ReadCursor;
+    }
+    return false;
+}
+
+void AsyncTaskQueue::FinishLocked(Task& task, bool cancelled)
+{
+    // A task submitted before tracing was turned on has no submit time.
+    if (TraceLatency && task.SubmittedAt != std::chrono::steady_clock::time_point{}
+        && task.StartedAt != std::chrono::steady_clock::time_point{})
+    {
+        const auto now = std::chrono::steady_clock::now();
+        LatencySamples.push_back(AsyncTaskLatency{
+            .Label = task.Label,
+            .Priority = PriorityOf(task.Priority),
+            .Queued = task.StartedAt - task.SubmittedAt,
+            .Service = now - task.StartedAt,
+            .MissedDeadline = now > DeadlineOf(task),
+            .Cancelled = cancelled });
+    }
+    if (!cancelled)
+    {
+        CompletedTasks.push_back(std::move(task));
+    }
+}
+
+bool AsyncTaskQueue::RunOnePendingTask(Lane lane)
 {
     Task task;
     for (;;)
     {
+        bool freedBacklog = false;
         {
             std::lock_guard<std::mutex> lock(Mutex);
-            if (PendingTasks.empty())
+            if (!TakeLocked(lane, task))
             {
                 return false;
             }
-            task = std::move(PendingTasks.front());
-            PendingTasks.pop_front();
+            freedBacklog = task.Decoding;
+        }
+        if (freedBacklog)
+        {
+            IoSignal.notify_one();
+            if (task.State->load() != AsyncTaskState::Cancelled)
+            {
+                break;  // claimed when its read stage started
+            }
+            // Stopped between read and decode: the bytes are dropped undecoded.
+            std::lock_guard<std::mutex> lock(Mutex);
+            FinishLocked(task, /*cancelled*/ true);
+            continue;
         }
 
         AsyncTaskState expected = AsyncTaskState::Pending;
@@ -167,29 +435,65 @@ bool AsyncTaskQueue::RunOnePendingTask()
         // Cancelled while pending: discard (payload-free) and try the next.
     }
 
+    if (task.Read)
+    {
+        task.Work = RunGuarded("read", task.Read);
+        task.Read = nullptr;
+        task.Decoding = true;
+
+        if (task.State->load() == AsyncTaskState::Cancelled)
+        {
+            std::lock_guard<std::mutex> lock(Mutex);
+            FinishLocked(task, /*cancelled*/ true);
+            return true;
+        }
+
+        // Test mode runs the decode here: PumpWork counts tasks, not stages.
+        if (lane != Lane::Pump)
+        {
+            {
+                std::lock_guard<std::mutex> lock(Mutex);
+                PendingTasks.push_back(std::move(task));
+                ++DecodeBacklog;
+            }
+            WorkSignal.notify_one();
+            return true;
+        }
+    }
+
     task.Commit = RunGuarded("work", task.Work);
     task.Work = nullptr;
-    task.State->store(AsyncTaskState::AwaitingCommit);
+
+    // Fails only when Cancel stopped the task while it ran; its result is
+    // dropped here, on the thread that produced it.
+    AsyncTaskState expected = AsyncTaskState::Running;
+    const bool finished =
+        task.State->compare_exchange_strong(expected, AsyncTaskState::AwaitingCommit);
+    if (!finished)
+    {
+        task.Commit = nullptr;
+    }
 
     {
         std::lock_guard<std::mutex> lock(Mutex);
-        CompletedTasks.push_back(std::move(task));
+        FinishLocked(task, !finished);
     }
     return true;
 }
 
-void AsyncTaskQueue::WorkerMain()
+void AsyncTaskQueue::WorkerMain(Lane lane)
 {
+    std::condition_variable& signal = lane == Lane::Io ? IoSignal : WorkSignal;
     for (;;)
     {
         {
             std::unique_lock<std::mutex> lock(Mutex);
-            WorkSignal.wait(lock, [&] { return ShutdownRequested || !PendingTasks.empty(); });
+            signal.wait(lock, [&] { return ShutdownRequested || HasWorkLocked(lane); });
             if (ShutdownRequested)
             {
                 return;
             }
         }
-        RunOnePendingTask();
+        RunOnePendingTask(lane);
     }
 }
@@ -6,6 +6,8 @@
 #include <core/console/ConsoleTypes.h>
 #include <net/NetSession.h>
 #include <net/PeerCommandRuntime.h>
+#include <net/PredictionRuntime.h>
+#include <net/SnapshotInterpolation.h>
 #include <net/UdpTransport.h>
 
 #include <algorithm>
@@ -162,6 +164,67 @@ void RegisterNetConsoleCommands(ConsoleRegistry& registry, Engine& engine)
         },
     });
 
+    registry.RegisterCVar({
+        .Name = "net.predict",
+        .Owner = "engine",
+        .Type = CVarType::Bool,
+        .DefaultValue = false,
+        .CurrentValue = false,
+        // Off is input-delay mode, the reference prediction is measured
+        // against and the right default where the round trip is short.
+        .Flags = CVarFlags::Archive,
+        .Help = "Predict this client's own pawn and correct it against the "
+                "authority. Off shows the pawn as replicated, a round trip late.",
+        .Source = { "engine defaults" },
+        .OnChange = [&engine](const CVarChangeContext& change) {
+            if (const bool* enabled = std::get_if<bool>(&change.NewValue))
+                engine.Prediction().SetEnabled(*enabled);
+        },
+    });
+
+    registry.RegisterCVar({
+        .Name = "net.resim_budget",
+        .Owner = "engine",
+        .Type = CVarType::Int,
+        .DefaultValue = static_cast<std::int64_t>(
+            PredictionRuntime::kDefaultResimBudget),
+        .CurrentValue = static_cast<std::int64_t>(
+            PredictionRuntime::kDefaultResimBudget),
+        // The client's own: it is this machine's frame time a correction
+        // spends, and no other peer is affected by how it chooses.
+        .Flags = CVarFlags::Archive,
+        .Help = "Ticks one prediction correction may resimulate. A correction "
+                "over the budget is skipped and prediction runs uncorrected; "
+                "below the round trip, every correction is skipped.",
+        .Source = { "engine defaults" },
+        .Min = static_cast<std::int64_t>(0),
+        .Max = static_cast<std::int64_t>(PredictionRuntime::kCapacityTicks),
+        .OnChange = [&engine](const CVarChangeContext& change) {
+            if (const std::int64_t* ticks =
+                    std::get_if<std::int64_t>(&change.NewValue))
+            {
+                engine.Prediction().SetResimBudget(
+                    static_cast<std::uint32_t>(std::max<std::int64_t>(0, *ticks)));
+            }
+        },
+    });
+
+    registry.RegisterCVar({
+        .Name = "net.interpolate",
+        .Owner = "engine",
+        .Type = CVarType::Bool,
+        .DefaultValue = true,
+        .CurrentValue = true,
+        .Flags = CVarFlags::Archive,
+        .Help = "Draw other players' entities a jitter-sized delay behind the "
+                "newest snapshot, blended. Off draws them as applied.",
+        .Source = { "engine defaults" },
+        .OnChange = [&engine](const CVarChangeContext& change) {
+            if (const bool* enabled = std::get_if<bool>(&change.NewValue))
+                engine.Interpolation().SetEnabled(*enabled);
+        },
+    });
+
     registry.RegisterCommand({
         .Name = "host",
         .Owner = "engine",
@@ -0,0 +1,243 @@
+#include <net/NetEntropyCoder.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+    // The coder state lives in [kLower, kLower << 8) between symbols, and is
+    // renormalized a byte at a time. 2^23 leaves room for the 12-bit scale
+    // below a 32-bit state without ever overflowing it.
+    constexpr std::uint32_t kLower = 1u << 23;
+
+    void StoreU32(std::byte* at, std::uint32_t value)
+    {
+        for (std::size_t i = 0; i < 4; ++i)
+            at[i] = static_cast<std::byte>((value >> (i * 8)) & 0xFFu);
+    }
+
+    std::uint32_t LoadU32(const std::byte* at)
+    {
+        std::uint32_t value = 0;
+        for (std::size_t i = 0; i < 4; ++i)
+            value |= static_cast<std::uint32_t>(at[i]) << (i * 8);
+        return value;
+    }
+}
+
+//=============================================================================
+// NetEntropyModel
+//=============================================================================
+
+NetEntropyModel::NetEntropyModel()
+{
+    Frequencies.fill(static_cast<std::uint16_t>(kNetEntropyScale / 256));
+    Build();
+}
+
+NetEntropyModel NetEntropyModel::FromCounts(std::span<const std::uint64_t, 256> counts)
+{
+    std::uint64_t total = 0;
+    for (std::uint64_t count : counts)
+        total += count;
+
+    NetEntropyModel model;
+    if (total == 0)
+        return model;
+
+    std::uint32_t sum = 0;
+    for (std::size_t symbol = 0; symbol < 256; ++symbol)
+    {
+        const double share = static_cast<double>(counts[symbol])
+                           * static_cast<double>(kNetEntropyScale)
+                           / static_cast<double>(total);
+        const auto scaled = static_cast<std::uint32_t>(share + 0.5);
+        model.Frequencies[symbol] = static_cast<std::uint16_t>(std::max(1u, scaled));
+        sum += model.Frequencies[symbol];
+    }
+
+    // Rounding and the floor of one leave the sum near the scale but rarely on
+    // it. The correction goes to or comes from the most frequent symbol, where
+    // a unit is the smallest relative change to the model; the scan is ordered
+    // so the result is identical on every machine that trains from the same
+    // counts.
+    while (sum != kNetEntropyScale)
+    {
+        std::size_t largest = 0;
+        for (std::size_t symbol = 1; symbol < 256; ++symbol)
+        {
+            if (model.Frequencies[symbol] > model.Frequencies[largest])
+                largest = symbol;
+        }
+        if (sum > kNetEntropyScale)
+        {
+            --model.Frequencies[largest];
+            --sum;
+        }
+        else
+        {
+            ++model.Frequencies[largest];
+            ++sum;
+        }
+    }
+
+    model.Build();
+    return model;
+}
+
+void NetEntropyModel::Build()
+{
+    std::uint32_t start = 0;
+    std::uint32_t hash = 2166136261u;
+    for (std::size_t symbol = 0; symbol < 256; ++symbol)
+    {
+        Starts[symbol] = static_cast<std::uint16_t>(start);
+        const std::uint32_t frequency = Frequencies[symbol];
+        for (std::uint32_t slot = start; slot < start + frequency; ++slot)
+            Lookup[slot] = static_cast<std::uint8_t>(symbol);
+        start += frequency;
+
+        hash ^= frequency & 0xFFu;
+        hash *= 16777619u;
+        hash ^= frequency >> 8;
+        hash *= 16777619u;
+    }
+    TableHash = hash;
+}
+
+std::vector<std::byte> NetEntropyModel::Serialize() const
+{
+    std::vector<std::byte> out(256 * 2);
+    for (std::size_t symbol = 0; symbol < 256; ++symbol)
+    {
+        out[symbol * 2] = static_cast<std::byte>(Frequencies[symbol] & 0xFFu);
+        out[symbol * 2 + 1] = static_cast<std::byte>(Frequencies[symbol] >> 8);
+    }
+    return out;
+}
+
+std::optional<NetEntropyModel> NetEntropyModel::Deserialize(std::span<const std::byte> bytes)
+{
+    if (bytes.size() != 256 * 2)
+        return std::nullopt;
+
+    NetEntropyModel model;
+    std::uint32_t sum = 0;
+    for (std::size_t symbol = 0; symbol < 256; ++symbol)
+    {
+        const auto frequency = static_cast<std::uint16_t>(
+            static_cast<std::uint32_t>(bytes[symbol * 2])
+            | (static_cast<std::uint32_t>(bytes[symbol * 2 + 1]) << 8));
+        if (frequency == 0)
+            return std::nullopt;
+        model.Frequencies[symbol] = frequency;
+        sum += frequency;
+    }
+    if (sum != kNetEntropyScale)
+        return std::nullopt;
+
+    model.Build();
+    return model;
+}
+
+//=============================================================================
+// NetEntropyTrainer
+//=============================================================================
+
+void NetEntropyTrainer::Observe(std::span<const std::byte> payload)
+{
+    for (std::byte value : payload)
+        ++Counts[static_cast<std::uint8_t>(value)];
+    Total += payload.size();
+}
+
+NetEntropyModel NetEntropyTrainer::Build() const
+{
+    return NetEntropyModel::FromCounts(Counts);
+}
+
+//=============================================================================
+// Encode and decode
+//=============================================================================
+
+std::optional<std::size_t> NetEntropyEncode(const NetEntropyModel& model,
+                                            std::span<const std::byte> input,
+                                            std::span<std::byte> out)
+{
+    if (input.size() > 0xFFFFu || out.size() < kNetEntropyHeaderBytes)
+        return std::nullopt;
+
+    // rANS is last-in first-out: the encoder walks the input backwards and
+    // writes its bytes from the end of the buffer towards the front, so the
+    // decoder can read forwards. The stream is moved down behind the header
+    // once its length is known, which keeps this free of a scratch buffer.
+    std::byte* const begin = out.data() + kNetEntropyHeaderBytes;
+    std::byte* const end = out.data() + out.size();
+    std::byte* cursor = end;
+
+    std::uint32_t state = kLower;
+    for (std::size_t index = input.size(); index-- > 0;)
+    {
+        const auto symbol = static_cast<std::uint8_t>(input[index]);
+        const std::uint32_t frequency = model.Frequency(symbol);
+        const std::uint32_t limit = ((kLower >> kNetEntropyScaleBits) << 8) * frequency;
+        while (state >= limit)
+        {
+            if (cursor == begin)
+                return std::nullopt;
+            *--cursor = static_cast<std::byte>(state & 0xFFu);
+            state >>= 8;
+        }
+        state = ((state / frequency) << kNetEntropyScaleBits)
+              + (state % frequency)
+              + model.Start(symbol);
+    }
+
+    const auto streamBytes = static_cast<std::size_t>(end - cursor);
+    std::memmove(begin, cursor, streamBytes);
+    out[0] = static_cast<std::byte>(input.size() & 0xFFu);
+    out[1] = static_cast<std::byte>(input.size() >> 8);
+    StoreU32(out.data() + 2, state);
+    return kNetEntropyHeaderBytes + streamBytes;
+}
+
+std::optional<std::size_t> NetEntropyDecode(const NetEntropyModel& model,
+                                            std::span<const std::byte> input,
+                                            std::span<std::byte> out)
+{
+    if (input.size() < kNetEntropyHeaderBytes)
+        return std::nullopt;
+
+    const std::size_t length = static_cast<std::size_t>(input[0])
+                             | (static_cast<std::size_t>(input[1]) << 8);
+    if (length > out.size())
+        return std::nullopt;
+
+    std::uint32_t state = LoadU32(input.data() + 2);
+    // A state below the floor is one no encoder ever finishes in.
+    if (state < kLower)
+        return std::nullopt;
+
+    std::size_t cursor = kNetEntropyHeaderBytes;
+    constexpr std::uint32_t kMask = kNetEntropyScale - 1;
+    for (std::size_t index = 0; index < length; ++index)
+    {
+        const std::uint32_t slot = state & kMask;
+        const std::uint8_t symbol = model.SymbolAt(slot);
+        out[index] = static_cast<std::byte>(symbol);
+        state = model.Frequency(symbol) * (state >> kNetEntropyScaleBits)
+              + slot - model.Start(symbol);
+        while (state < kLower)
+        {
+            if (cursor == input.size())
+                return std::nullopt;
+            state = (state << 8) | static_cast<std::uint32_t>(input[cursor++]);
+        }
+    }
+
+    // The encoder started from exactly kLower and wrote exactly these bytes.
+    // Anything else means the stream or the model is not the one it claims.
+    if (state != kLower || cursor != input.size())
+        return std::nullopt;
+    return length;
+}
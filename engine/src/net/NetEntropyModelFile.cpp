@@ -0,0 +1,133 @@
+#include <net/NetEntropyModelFile.h>
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <vector>
+
+namespace
+{
+    constexpr std::array<char, 4> kCaptureMagic{ 'S', 'N', 'C', 'P' };
+    constexpr std::size_t kModelBytes = 256 * 2;
+}
+
+std::optional<NetEntropyModel> LoadNetEntropyModel(const std::filesystem::path& path,
+                                                   std::string* error)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+    {
+        if (error) *error = "cannot open '" + path.string() + "'";
+        return std::nullopt;
+    }
+
+    // One byte past the table, so a longer file is caught as the wrong size
+    // rather than silently truncated into a valid-looking model.
+    std::vector<char> bytes(kModelBytes + 1);
+    file.read(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    const auto read = static_cast<std::size_t>(file.gcount());
+    if (read != kModelBytes)
+    {
+        if (error) *error = "'" + path.string() + "' is not a 512-byte model table";
+        return std::nullopt;
+    }
+
+    std::optional<NetEntropyModel> model = NetEntropyModel::Deserialize(
+        std::as_bytes(std::span(bytes.data(), kModelBytes)));
+    if (!model && error)
+        *error = "'" + path.string() + "' holds a table that cannot decode every byte";
+    return model;
+}
+
+bool SaveNetEntropyModel(const std::filesystem::path& path, const NetEntropyModel& model)
+{
+    const std::vector<std::byte> bytes = model.Serialize();
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(bytes.data()),
+               static_cast<std::streamsize>(bytes.size()));
+    return static_cast<bool>(file);
+}
+
+//=============================================================================
+// NetSnapshotCapture
+//=============================================================================
+
+bool NetSnapshotCapture::Open(const std::filesystem::path& path)
+{
+    Close();
+    Written = 0;
+    File.open(path, std::ios::binary | std::ios::trunc);
+    if (!File)
+        return false;
+
+    char version[4];
+    for (std::size_t i = 0; i < 4; ++i)
+        version[i] = static_cast<char>((kNetSnapshotCaptureVersion >> (i * 8)) & 0xFFu);
+    File.write(kCaptureMagic.data(), kCaptureMagic.size());
+    File.write(version, sizeof(version));
+    return static_cast<bool>(File);
+}
+
+void NetSnapshotCapture::Close()
+{
+    if (File.is_open())
+        File.close();
+    File.clear();
+}
+
+void NetSnapshotCapture::Append(std::span<const std::byte> snapshot)
+{
+    if (!File.is_open() || snapshot.size() > 0xFFFFu)
+        return;
+
+    const char length[2] = {
+        static_cast<char>(snapshot.size() & 0xFFu),
+        static_cast<char>(snapshot.size() >> 8),
+    };
+    File.write(length, sizeof(length));
+    File.write(reinterpret_cast<const char*>(snapshot.data()),
+               static_cast<std::streamsize>(snapshot.size()));
+    ++Written;
+}
+
+std::optional<std::uint64_t> ReadNetSnapshotCapture(const std::filesystem::path& path,
+                                                    NetEntropyTrainer& trainer)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+        return std::nullopt;
+
+    std::array<unsigned char, 8> header{};
+    file.read(reinterpret_cast<char*>(header.data()), header.size());
+    if (file.gcount() != static_cast<std::streamsize>(header.size())
+        || !std::equal(kCaptureMagic.begin(), kCaptureMagic.end(), header.begin(),
+                       [](char a, unsigned char b) { return static_cast<unsigned char>(a) == b; }))
+    {
+        return std::nullopt;
+    }
+    std::uint32_t version = 0;
+    for (std::size_t i = 0; i < 4; ++i)
+        version |= static_cast<std::uint32_t>(header[4 + i]) << (i * 8);
+    if (version != kNetSnapshotCaptureVersion)
+        return std::nullopt;
+
+    std::uint64_t snapshots = 0;
+    std::vector<char> payload;
+    for (;;)
+    {
+        unsigned char length[2];
+        file.read(reinterpret_cast<char*>(length), sizeof(length));
+        if (file.gcount() != static_cast<std::streamsize>(sizeof(length)))
+            break;
+
+        payload.resize(static_cast<std::size_t>(length[0])
+                       | (static_cast<std::size_t>(length[1]) << 8));
+        file.read(payload.data(), static_cast<std::streamsize>(payload.size()));
+        if (file.gcount() != static_cast<std::streamsize>(payload.size()))
+            break;
+
+        trainer.Observe(std::as_bytes(std::span(payload)));
+        ++snapshots;
+    }
+    return snapshots;
+}
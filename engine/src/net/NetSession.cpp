@@ -116,6 +116,10 @@ bool NetSession::Connect(const NetAddress& authority, const NetIdentity& identit
     Scratch scratch{};
     const NetHello hello{ .ProtocolVersion = kNetProtocolVersion };
     SendRaw(AuthorityAddress, NetEncodeHello(hello, scratch));
+    // Out now rather than at the first pump: the connect timeout is measured
+    // from that pump, and a hello still sitting in the queue would spend part
+    // of it before the authority could possibly have answered.
+    Transport.FlushSends();
     return true;
 }
 
@@ -196,8 +200,11 @@ std::vector<PeerId> NetSession::ConnectedPeers() const
 
 void NetSession::SendRaw(const NetAddress& to, std::span<const std::byte> bytes)
 {
+    // Queued, not sent: the pump and the flush each hand the transport one
+    // batch at the end, which is one system call per frame each way on a
+    // transport that can batch and no change at all on one that cannot.
     if (!bytes.empty())
-        (void)Transport.Send(to, bytes);
+        (void)Transport.Queue(to, bytes);
 }
 
 void NetSession::RefuseAt(const NetAddress& address, std::string_view reason)
@@ -642,6 +649,9 @@ std::vector<NetSession::Delivery> NetSession::Pump(double nowSeconds)
         }
     }
 
+    // Challenges, admissions, refusals, and timeout notices produced above.
+    // A transport this pump closed has already flushed them on the way out.
+    Transport.FlushSends();
     return out;
 }
 
@@ -669,6 +679,7 @@ void NetSession::Flush(double nowSeconds)
             for (const NetChannelSet::Packet& packet : peer.Channels.Drain(nowSeconds))
                 SendRaw(peer.Address, packet.Bytes);
         }
+        Transport.FlushSends();
         return;
     }
 
@@ -682,6 +693,7 @@ void NetSession::Flush(double nowSeconds)
         }
         for (const NetChannelSet::Packet& packet : ClientChannels.Drain(nowSeconds))
             SendRaw(AuthorityAddress, packet.Bytes);
+        Transport.FlushSends();
     }
 }
 
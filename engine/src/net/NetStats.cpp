@@ -30,6 +30,7 @@ NetTrafficKind NetTrafficKindOf(NetPayloadKind payload)
     switch (payload)
     {
     case NetPayloadKind::Snapshot: return NetTrafficKind::Snapshot;
+    case NetPayloadKind::SnapshotCoded: return NetTrafficKind::Snapshot;
     case NetPayloadKind::Command:  return NetTrafficKind::Command;
     case NetPayloadKind::CVar:     return NetTrafficKind::CVar;
     case NetPayloadKind::Invalid:  break;
@@ -55,6 +56,34 @@ void NetStats::RecordOut(NetTrafficKind kind, std::size_t bytes,
     LifetimeOut += bytes;
 }
 
+void NetStats::RecordTransport(const NetTransportCounters& counters)
+{
+    const bool reopened = counters.ReceiveCalls < LastCounters.ReceiveCalls
+                       || counters.SendCalls < LastCounters.SendCalls
+                       || counters.DatagramsReceived < LastCounters.DatagramsReceived
+                       || counters.DatagramsSent < LastCounters.DatagramsSent;
+    const NetTransportCounters base = reopened ? NetTransportCounters{} : LastCounters;
+
+    WindowCounters.ReceiveCalls += counters.ReceiveCalls - base.ReceiveCalls;
+    WindowCounters.SendCalls += counters.SendCalls - base.SendCalls;
+    WindowCounters.DatagramsReceived += counters.DatagramsReceived - base.DatagramsReceived;
+    WindowCounters.DatagramsSent += counters.DatagramsSent - base.DatagramsSent;
+    LastCounters = counters;
+}
+
+void NetStats::RecordPumpSeconds(double seconds)
+{
+    WindowPumpSeconds += seconds;
+    WindowPumpPeak = std::max(WindowPumpPeak, seconds);
+    ++WindowPumps;
+}
+
+void NetStats::RecordFlushSeconds(double seconds)
+{
+    WindowFlushSeconds += seconds;
+    ++WindowFlushes;
+}
+
 void NetStats::Push(std::array<float, kHistory>& series, float value)
 {
     std::rotate(series.begin(), series.begin() + 1, series.end());
@@ -96,6 +125,26 @@ void NetStats::Sample(double nowSeconds)
         WindowOut[kind] = Counter{};
     }
 
+    TransportRate.ReceiveCalls =
+        static_cast<double>(WindowCounters.ReceiveCalls) * perSecond;
+    TransportRate.SendCalls =
+        static_cast<double>(WindowCounters.SendCalls) * perSecond;
+    TransportRate.DatagramsIn =
+        static_cast<double>(WindowCounters.DatagramsReceived) * perSecond;
+    TransportRate.DatagramsOut =
+        static_cast<double>(WindowCounters.DatagramsSent) * perSecond;
+    TransportRate.PumpMilliseconds =
+        WindowPumps > 0 ? WindowPumpSeconds * 1000.0 / WindowPumps : 0.0;
+    TransportRate.PumpMillisecondsPeak = WindowPumpPeak * 1000.0;
+    TransportRate.FlushMilliseconds =
+        WindowFlushes > 0 ? WindowFlushSeconds * 1000.0 / WindowFlushes : 0.0;
+    WindowCounters = NetTransportCounters{};
+    WindowPumpSeconds = 0.0;
+    WindowPumpPeak = 0.0;
+    WindowPumps = 0;
+    WindowFlushSeconds = 0.0;
+    WindowFlushes = 0;
+
     Push(SeriesIn, static_cast<float>(bytesIn));
     Push(SeriesOut, static_cast<float>(bytesOut));
     Closed = std::min(Closed + 1, kHistory);
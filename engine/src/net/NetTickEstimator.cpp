@@ -5,6 +5,11 @@
 
 namespace
 {
+    // Gain of the jitter average. One sixteenth is the interarrival estimator
+    // RTP uses: slow enough that one late packet does not double the playout
+    // delay, fast enough to follow a route that got worse within a second.
+    constexpr double kJitterGain = 1.0 / 16.0;
+
     // Round trips are measured, so they carry noise; rounding up is the safe
     // direction. A flight time guessed short stamps commands that arrive after
     // the tick they were meant for, which is input lost -- guessed long, they
@@ -54,13 +59,27 @@ void NetTickEstimator::Observe(std::uint64_t authorityTick, std::uint64_t localT
         static_cast<std::int64_t>(authorityTick) + static_cast<std::int64_t>(Flight)
         - static_cast<std::int64_t>(localTick);
 
+    const std::int64_t transit =
+        static_cast<std::int64_t>(localTick) - static_cast<std::int64_t>(authorityTick);
     if (!Observed)
     {
         Delta = observed;
+        LastTransit = transit;
         Observed = true;
         return;
     }
 
+    const std::int64_t swing = transit - LastTransit;
+    LastTransit = transit;
+    // A discontinuity is not jitter: a snap below resets the offset, and
+    // counting the same step as a sixteenth of a second of deviation would
+    // leave the playout delay inflated long after the connection settled.
+    if (swing <= kSnapTicks && swing >= -kSnapTicks)
+    {
+        const double deviation = static_cast<double>(swing < 0 ? -swing : swing);
+        Jitter += (deviation - Jitter) * kJitterGain;
+    }
+
     const std::int64_t difference = observed - Delta;
     if (difference > kSnapTicks || difference < -kSnapTicks)
     {
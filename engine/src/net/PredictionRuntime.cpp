@@ -0,0 +1,504 @@
+#include <net/PredictionRuntime.h>
+
+#include <ecs/World.h>
+#include <net/NetReplicationComponents.h>
+#include <net/NetTickEstimator.h>
+#include <net/ReplicationCodec.h>
+#include <net/ReplicationLayout.h>
+#include <world/transform/DerivedTransform.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <utility>
+
+namespace
+{
+    [[nodiscard]] std::uint64_t AddOffset(std::uint64_t tick, std::int64_t offset)
+    {
+        if (offset >= 0)
+            return tick + static_cast<std::uint64_t>(offset);
+        const auto back = static_cast<std::uint64_t>(-offset);
+        return back > tick ? 0 : tick - back;
+    }
+
+    // The entity's slot in a frame, or the frame's count when it has none.
+    template <typename FrameT>
+    [[nodiscard]] std::size_t SlotOf(const FrameT& frame, EntityId entity)
+    {
+        for (std::size_t slot = 0; slot < frame.EntityCount; ++slot)
+        {
+            if (frame.Entities[slot] == entity)
+                return slot;
+        }
+        return frame.EntityCount;
+    }
+}
+
+//=============================================================================
+// Storage
+//=============================================================================
+
+void PredictionRuntime::Configure(const ReplicationLayout& layout)
+{
+    const std::span<const ReplicatedComponent> components = layout.Components();
+
+    ComponentOffsets.assign(components.size(), 0);
+    std::size_t bytes = 0;
+    std::size_t widest = 0;
+    for (std::size_t index = 0; index < components.size(); ++index)
+    {
+        ComponentOffsets[index] = bytes;
+        bytes += components[index].Size;
+        widest = std::max(widest, components[index].Size);
+    }
+
+    SlotBytes = bytes;
+    constexpr std::size_t slots = (kCapacityTicks + 1) * kMaxPredictedEntities;
+    Storage.assign(slots * SlotBytes, std::byte{ 0 });
+    PresenceFlags.assign(slots * components.size(), 0);
+    CompareScratch.assign(widest, std::byte{ 0 });
+    LayoutHash = layout.TableHash();
+
+    Head = 0;
+    Recorded = 0;
+    HasShadow = false;
+    Pending = false;
+}
+
+bool PredictionRuntime::IsConfiguredFor(const ReplicationLayout& layout) const
+{
+    return !ComponentOffsets.empty() && ComponentOffsets.size() == layout.Size()
+        && LayoutHash == layout.TableHash();
+}
+
+std::span<std::byte> PredictionRuntime::EntityBytes(std::size_t frame, std::size_t slot)
+{
+    return std::span<std::byte>(Storage).subspan(
+        (frame * kMaxPredictedEntities + slot) * SlotBytes, SlotBytes);
+}
+
+std::span<const std::byte> PredictionRuntime::EntityBytes(std::size_t frame,
+                                                          std::size_t slot) const
+{
+    return std::span<const std::byte>(Storage).subspan(
+        (frame * kMaxPredictedEntities + slot) * SlotBytes, SlotBytes);
+}
+
+std::uint8_t* PredictionRuntime::Presence(std::size_t frame, std::size_t slot)
+{
+    return PresenceFlags.data()
+         + (frame * kMaxPredictedEntities + slot) * ComponentOffsets.size();
+}
+
+const std::uint8_t* PredictionRuntime::Presence(std::size_t frame, std::size_t slot) const
+{
+    return PresenceFlags.data()
+         + (frame * kMaxPredictedEntities + slot) * ComponentOffsets.size();
+}
+
+void PredictionRuntime::CollectOwned(const World& world, PeerId localPeer,
+                                     Frame& frame) const
+{
+    frame.EntityCount = 0;
+    if (!localPeer.IsValid() || !world.IsRegistered<NetOwner>())
+        return;
+
+    world.ForEachComponent<NetOwner>([&](EntityId entity, const NetOwner& owner) {
+        if (owner.Peer != localPeer.Value || frame.EntityCount >= kMaxPredictedEntities)
+            return;
+        frame.Entities[frame.EntityCount++] = entity;
+    });
+}
+
+void PredictionRuntime::Store(const World& world, const ReplicationLayout& layout,
+                              std::size_t index, const Frame& frame)
+{
+    const std::span<const ReplicatedComponent> components = layout.Components();
+    for (std::size_t slot = 0; slot < frame.EntityCount; ++slot)
+    {
+        const std::span<std::byte> bytes = EntityBytes(index, slot);
+        std::uint8_t* present = Presence(index, slot);
+        for (std::size_t c = 0; c < components.size(); ++c)
+        {
+            present[c] = 0;
+            if (!world.IsRegistered(components[c].Type))
+                continue;
+            const ComponentId column = world.GetComponentIdByType(components[c].Type);
+            const void* source = world.GetComponentRaw(frame.Entities[slot], column);
+            if (source == nullptr)
+                continue;
+            std::memcpy(bytes.data() + ComponentOffsets[c], source, components[c].Size);
+            present[c] = 1;
+        }
+    }
+}
+
+// Raw writes are safe here for the reason the layout enforces: a replicated
+// component declares no lifecycle hooks, so its bytes are its whole state --
+// the same assumption snapshot apply rests on.
+void PredictionRuntime::Restore(World& world, const ReplicationLayout& layout,
+                                std::size_t index, const Frame& frame,
+                                RestoreFields fields)
+{
+    const std::span<const ReplicatedComponent> components = layout.Components();
+    for (std::size_t slot = 0; slot < frame.EntityCount; ++slot)
+    {
+        const EntityId entity = frame.Entities[slot];
+        if (!world.IsAlive(entity))
+            continue;
+
+        const std::span<const std::byte> bytes = EntityBytes(index, slot);
+        const std::uint8_t* present = Presence(index, slot);
+        for (std::size_t c = 0; c < components.size(); ++c)
+        {
+            if (present[c] == 0 || !world.IsRegistered(components[c].Type))
+                continue;
+            const ComponentId column = world.GetComponentIdByType(components[c].Type);
+            auto* target = static_cast<std::byte*>(world.GetComponentRaw(entity, column));
+            if (target == nullptr)
+                continue;
+
+            const std::byte* source = bytes.data() + ComponentOffsets[c];
+            const bool wantOwnerLocal = fields == RestoreFields::OwnerLocal;
+            for (const ReplicatedField& field : components[c].Fields)
+            {
+                if (field.OwnerLocal == wantOwnerLocal)
+                {
+                    std::memcpy(target + field.Offset, source + field.Offset,
+                                field.Size * field.Count);
+                }
+            }
+        }
+        // Same obligation snapshot apply has: the local transform just moved,
+        // and whatever reads the world one before the next propagation must not
+        // see where it was.
+        SeedDerivedWorldTransform(world, entity);
+    }
+}
+
+bool PredictionRuntime::Agrees(const ReplicationLayout& layout, std::size_t predicted,
+                               std::size_t authoritative)
+{
+    const std::span<const ReplicatedComponent> components = layout.Components();
+    const Frame& guess = Frames[predicted];
+    const Frame& truth = Frames[authoritative];
+
+    for (std::size_t slot = 0; slot < truth.EntityCount; ++slot)
+    {
+        // An entity the prediction never held -- a pawn granted since -- has
+        // nothing to disagree with.
+        const std::size_t guessSlot = SlotOf(guess, truth.Entities[slot]);
+        if (guessSlot == guess.EntityCount)
+            continue;
+
+        const std::span<const std::byte> truthBytes = EntityBytes(authoritative, slot);
+        const std::span<const std::byte> guessBytes = EntityBytes(predicted, guessSlot);
+        const std::uint8_t* truthPresent = Presence(authoritative, slot);
+        const std::uint8_t* guessPresent = Presence(predicted, guessSlot);
+
+        for (std::size_t c = 0; c < components.size(); ++c)
+        {
+            if (truthPresent[c] != guessPresent[c])
+                return false;
+            if (truthPresent[c] == 0)
+                continue;
+
+            // The authority's bytes came off the wire and are wire precision
+            // already; the guess is snapped to match, so rounding is not
+            // reported as divergence.
+            const ReplicatedComponent& component = components[c];
+            const std::span<std::byte> snapped =
+                std::span<std::byte>(CompareScratch).subspan(0, component.Size);
+            std::memcpy(snapped.data(), guessBytes.data() + ComponentOffsets[c],
+                        component.Size);
+            ReplicationSnapToWire(component, snapped);
+
+            const std::byte* expected = truthBytes.data() + ComponentOffsets[c];
+            for (const ReplicatedField& field : component.Fields)
+            {
+                if (field.OwnerLocal)
+                    continue;
+                if (std::memcmp(snapped.data() + field.Offset, expected + field.Offset,
+                                field.Size * field.Count) != 0)
+                {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+const PredictionRuntime::Frame* PredictionRuntime::Find(std::uint64_t tick,
+                                                        std::size_t& index) const
+{
+    for (std::size_t back = 0; back < Recorded; ++back)
+    {
+        const std::size_t candidate = (Head + kCapacityTicks - back) % kCapacityTicks;
+        if (Frames[candidate].AuthorityTick == tick)
+        {
+            index = candidate;
+            return &Frames[candidate];
+        }
+    }
+    return nullptr;
+}
+
+std::size_t PredictionRuntime::NewestIndex() const
+{
+    return Head;
+}
+
+std::size_t PredictionRuntime::PredictedEntities() const
+{
+    return Recorded == 0 ? 0 : Frames[Head].EntityCount;
+}
+
+std::span<const EntityId> PredictionRuntime::PredictedEntityIds() const
+{
+    if (Recorded == 0)
+        return {};
+    return std::span<const EntityId>(Frames[Head].Entities)
+        .first(Frames[Head].EntityCount);
+}
+
+//=============================================================================
+// Recording
+//=============================================================================
+
+void PredictionRuntime::Capture(const World& world, const ReplicationLayout& layout,
+                                PeerId localPeer, std::uint64_t tick,
+                                const NetTickEstimator& clock)
+{
+    if (!Enabled || !clock.HasEstimate() || layout.Size() == 0)
+        return;
+    if (!IsConfiguredFor(layout))
+        Configure(layout);
+
+    const std::size_t index = Recorded == 0 ? 0 : (Head + 1) % kCapacityTicks;
+    Frame& frame = Frames[index];
+
+    // Named the way a snapshot is stamped: the tick index after this one ran,
+    // which is what the authority's clock reads when it publishes the result.
+    frame.Tick = tick + 1;
+    frame.AuthorityTick = AddOffset(tick, clock.CommandOffset()) + 1;
+
+    frame.Input = NetCommandRecord{};
+    frame.Input.Tick = tick;
+    if (const InputActionState* actions = world.TryGetResource<InputActionState>();
+        actions != nullptr && actions->HistoryCount() > 0 && actions->CurrentTick() == tick)
+    {
+        const InputActionView view = actions->Tick();
+        frame.Input.ActionCount = static_cast<std::uint8_t>(
+            std::min<std::size_t>(view.Values.size(), kNetMaxCommandActions));
+        std::copy_n(view.Values.begin(), frame.Input.ActionCount,
+                    frame.Input.Actions.begin());
+    }
+
+    CollectOwned(world, localPeer, frame);
+    Store(world, layout, index, frame);
+    frame.Abandoned = false;
+
+    Head = index;
+    Recorded = std::min(Recorded + 1, kCapacityTicks);
+}
+
+void PredictionRuntime::BeginAuthoritative(World& world, const ReplicationLayout& layout)
+{
+    if (!Enabled || !HasShadow || !IsConfiguredFor(layout))
+        return;
+    Restore(world, layout, kShadow, Frames[kShadow], RestoreFields::Authoritative);
+}
+
+void PredictionRuntime::EndAuthoritative(World& world, const ReplicationLayout& layout,
+                                         PeerId localPeer, std::uint64_t authorityTick,
+                                         bool applied)
+{
+    if (!Enabled || !IsConfiguredFor(layout))
+        return;
+
+    if (!applied)
+    {
+        // Whatever half-applied is not the authority's word. Put the prediction
+        // back and wait for a snapshot that decodes.
+        if (Recorded > 0)
+        {
+            Restore(world, layout, NewestIndex(), Frames[NewestIndex()],
+                    RestoreFields::Authoritative);
+        }
+        return;
+    }
+
+    Frame& shadow = Frames[kShadow];
+    shadow.Tick = 0;
+    shadow.AuthorityTick = authorityTick;
+    CollectOwned(world, localPeer, shadow);
+    Store(world, layout, kShadow, shadow);
+    HasShadow = true;
+    Pending = true;
+    PendingTick = authorityTick;
+}
+
+//=============================================================================
+// Rollback
+//=============================================================================
+
+void PredictionRuntime::Snap(World& world, const ReplicationLayout& layout,
+                             const ReseatEntities& reseat)
+{
+    // The snapshot left the authority's state in the world; keeping it is the
+    // whole correction. It becomes the newest record, so a snapshot that later
+    // fails to decode falls back to it rather than to the prediction dropped
+    // here.
+    const std::size_t newest = NewestIndex();
+    Frame& frame = Frames[newest];
+    frame.Entities = Frames[kShadow].Entities;
+    frame.EntityCount = Frames[kShadow].EntityCount;
+    Store(world, layout, newest, frame);
+
+    // Every record so far, the newest included, now describes a run the pawn
+    // is no longer on. Their inputs still replay; their states compare with
+    // nothing, or a later snapshot could agree with a state this machine no
+    // longer predicts.
+    for (std::size_t back = 0; back < Recorded; ++back)
+        Frames[(Head + kCapacityTicks - back) % kCapacityTicks].Abandoned = true;
+
+    ++Totals.Snapped;
+    if (reseat)
+        reseat(std::span<const EntityId>(frame.Entities).first(frame.EntityCount));
+}
+
+void PredictionRuntime::Reconcile(World& world, const ReplicationLayout& layout,
+                                  const ResimulateTick& resimulate,
+                                  const ReseatEntities& reseat)
+{
+    if (!Enabled || !Pending || !IsConfiguredFor(layout))
+        return;
+    Pending = false;
+
+    if (Recorded == 0)
+        return;
+
+    const std::size_t newest = NewestIndex();
+    std::size_t matched = 0;
+    const Frame* predicted = Find(PendingTick, matched);
+    if (predicted == nullptr)
+    {
+        ++Totals.Unverified;
+        Snap(world, layout, reseat);
+        return;
+    }
+
+    ++Totals.Reconciled;
+    if (!predicted->Abandoned && Agrees(layout, matched, kShadow))
+    {
+        Restore(world, layout, newest, Frames[newest], RestoreFields::Authoritative);
+        return;
+    }
+
+    ++Totals.Mispredicted;
+    const std::uint64_t from = predicted->Tick;
+    const std::uint64_t to = Frames[newest].Tick;
+    const std::uint64_t window = to - from;
+    if (window > Budget || !resimulate)
+    {
+        ++Totals.OverBudget;
+        Snap(world, layout, reseat);
+        return;
+    }
+
+    // The world already holds the authority's state for `from`. It becomes the
+    // record for that tick, so a later snapshot in the same window compares
+    // against what was corrected rather than against the old guess.
+    Frames[matched].EntityCount = Frames[kShadow].EntityCount;
+    Frames[matched].Entities = Frames[kShadow].Entities;
+    Frames[matched].Abandoned = false;
+    std::memcpy(EntityBytes(matched, 0).data(), EntityBytes(kShadow, 0).data(),
+                SlotBytes * kMaxPredictedEntities);
+    std::memcpy(Presence(matched, 0), Presence(kShadow, 0),
+                ComponentOffsets.size() * kMaxPredictedEntities);
+
+    InputActionState* live = world.TryGetResource<InputActionState>();
+    const auto started = std::chrono::steady_clock::now();
+
+    std::size_t index = matched;
+    std::uint32_t replayed = 0;
+    for (std::uint64_t tick = from; tick < to; ++tick)
+    {
+        index = (index + 1) % kCapacityTicks;
+        Frame& frame = Frames[index];
+        // Recorded ticks are consecutive; a gap means the ring was written by
+        // something other than one capture per tick, and replaying across it
+        // would feed one tick's input to another.
+        if (frame.Tick != tick + 1)
+            break;
+
+        // The input this tick consumed the first time, presented as the only
+        // resolved actions there are.
+        if (live != nullptr)
+        {
+            // Swapped rather than copied: the live state keeps its history
+            // untouched in Replay until the swap back. Sized to the live
+            // vocabulary, which allocates only when that changes.
+            std::swap(*live, Replay);
+            live->Configure(Replay.ActionCount());
+            const std::span<InputActionValue> values = live->BeginTick(tick);
+            for (std::size_t action = 0; action < values.size(); ++action)
+            {
+                values[action] = action < frame.Input.ActionCount
+                                     ? frame.Input.Actions[action]
+                                     : InputActionValue{};
+            }
+        }
+
+        // Owner-local state -- where the player was looking -- is this
+        // machine's own record and was right the first time; the tick replays
+        // with what it had then.
+        Restore(world, layout, index, frame, RestoreFields::OwnerLocal);
+
+        resimulate(tick);
+
+        if (live != nullptr)
+            std::swap(*live, Replay);
+
+        Store(world, layout, index, frame);
+        frame.Abandoned = false;
+        ++replayed;
+    }
+
+    // And back to where the player is looking now, which the replay walked
+    // through the recorded history of. The shadow was stored from the world
+    // before any of it.
+    Restore(world, layout, kShadow, Frames[kShadow], RestoreFields::OwnerLocal);
+
+    const std::chrono::duration<double, std::milli> elapsed =
+        std::chrono::steady_clock::now() - started;
+    Totals.ResimulatedTicks += replayed;
+    Totals.LastResimTicks = replayed;
+    Totals.LastResimMilliseconds = elapsed.count();
+    Totals.PeakResimMilliseconds =
+        std::max(Totals.PeakResimMilliseconds, elapsed.count());
+}
+
+void PredictionRuntime::SetEnabled(bool enabled)
+{
+    if (!enabled)
+    {
+        Head = 0;
+        Recorded = 0;
+        HasShadow = false;
+        Pending = false;
+    }
+    Enabled = enabled;
+}
+
+void PredictionRuntime::Reset()
+{
+    Head = 0;
+    Recorded = 0;
+    HasShadow = false;
+    Pending = false;
+    PendingTick = 0;
+    Totals = Counters{};
+}
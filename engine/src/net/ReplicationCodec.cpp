@@ -1,6 +1,7 @@
 #include <net/ReplicationCodec.h>
 
 #include <algorithm>
+#include <array>
 #include <bit>
 #include <cassert>
 #include <cmath>
@@ -12,7 +13,8 @@ namespace
     // exactly what they declared; everything else takes its natural width.
     std::uint8_t ScalarBits(const ReplicatedField& field)
     {
-        if (field.Quantization.IsQuantized())
+        if (field.Quantization.IsQuantized()
+            && field.Quantization.Kind == FieldQuantizationKind::Range)
             return field.Quantization.Bits;
 
         switch (field.Scalar)
@@ -37,7 +39,27 @@ namespace
     // the codec ignores it here.
     bool IsQuantizedFloat(const ReplicatedField& field)
     {
-        return field.Quantization.IsQuantized() && field.Scalar == FieldScalar::Float;
+        return field.Quantization.IsQuantized()
+            && field.Quantization.Kind == FieldQuantizationKind::Range
+            && field.Scalar == FieldScalar::Float;
+    }
+
+    // The layout admits SmallestThree only on a four-float leaf, so this needs
+    // no shape check of its own.
+    bool IsRotation(const ReplicatedField& field)
+    {
+        return field.Quantization.IsQuantized()
+            && field.Quantization.Kind == FieldQuantizationKind::SmallestThree;
+    }
+
+    // Bits a present field occupies: two for the dropped component's index
+    // plus three packed components for a rotation, otherwise every scalar at
+    // its own width.
+    std::size_t FieldBits(const ReplicatedField& field)
+    {
+        if (IsRotation(field))
+            return 2 + 3 * static_cast<std::size_t>(field.Quantization.Bits);
+        return static_cast<std::size_t>(ScalarBits(field)) * field.Count;
     }
 
     const std::byte* ScalarAt(std::span<const std::byte> bytes,
@@ -68,6 +90,89 @@ namespace
         std::memcpy(at, &value, sizeof(T));
     }
 
+    struct PackedRotation
+    {
+        std::uint32_t Largest = 3;
+        std::array<std::uint32_t, 3> Values{};
+
+        bool operator==(const PackedRotation&) const = default;
+    };
+
+    // Normalizes before packing, because the dropped component is rebuilt from
+    // unit length: a quaternion that drifted off the unit sphere would come
+    // back a different rotation rather than the same one rounded. Anything
+    // with no direction at all -- zero, NaN, infinite -- packs as identity,
+    // which is the one rotation that is never a surprise.
+    PackedRotation PackRotation(const ReplicatedField& field, const std::byte* at)
+    {
+        std::array<double, 4> q{};
+        double lengthSquared = 0.0;
+        for (std::uint8_t i = 0; i < 4; ++i)
+        {
+            q[i] = static_cast<double>(LoadAs<float>(at + static_cast<std::size_t>(i) * field.Size));
+            lengthSquared += q[i] * q[i];
+        }
+        if (!(lengthSquared > 1e-12) || !std::isfinite(lengthSquared))
+            q = { 0.0, 0.0, 0.0, 1.0 };
+        else
+        {
+            const double inverse = 1.0 / std::sqrt(lengthSquared);
+            for (double& component : q)
+                component *= inverse;
+        }
+
+        PackedRotation packed;
+        packed.Largest = 0;
+        for (std::uint32_t i = 1; i < 4; ++i)
+        {
+            if (std::abs(q[i]) > std::abs(q[packed.Largest]))
+                packed.Largest = i;
+        }
+        // q and -q are the same rotation, so the dropped component is made
+        // positive and its sign never travels.
+        const double sign = q[packed.Largest] < 0.0 ? -1.0 : 1.0;
+        std::size_t slot = 0;
+        for (std::uint32_t i = 0; i < 4; ++i)
+        {
+            if (i == packed.Largest)
+                continue;
+            packed.Values[slot++] = ReplicationQuantize(
+                static_cast<float>(q[i] * sign), field.Quantization);
+        }
+        return packed;
+    }
+
+    void UnpackRotation(const ReplicatedField& field, const PackedRotation& packed,
+                        std::byte* at)
+    {
+        std::array<double, 4> q{};
+        double sumSquared = 0.0;
+        std::size_t slot = 0;
+        for (std::uint32_t i = 0; i < 4; ++i)
+        {
+            if (i == packed.Largest)
+                continue;
+            q[i] = static_cast<double>(
+                ReplicationDequantize(packed.Values[slot++], field.Quantization));
+            sumSquared += q[i] * q[i];
+        }
+
+        // Three components can describe more than unit length between them
+        // only if the bits were not written by PackRotation. Scaled back onto
+        // the sphere, so hostile input still decodes to a rotation.
+        if (sumSquared > 1.0)
+        {
+            const double inverse = 1.0 / std::sqrt(sumSquared);
+            for (double& component : q)
+                component *= inverse;
+            sumSquared = 1.0;
+        }
+        q[packed.Largest] = std::sqrt(1.0 - sumSquared);
+
+        for (std::uint8_t i = 0; i < 4; ++i)
+            StoreAs(at + static_cast<std::size_t>(i) * field.Size, static_cast<float>(q[i]));
+    }
+
     // Whether a field differs from the baseline in a way the wire would carry.
     // Quantized floats compare at wire precision, so jitter finer than the
     // declared resolution does not spend a field every tick describing a change
@@ -76,6 +181,12 @@ namespace
                       std::span<const std::byte> current,
                       std::span<const std::byte> baseline)
     {
+        if (IsRotation(field))
+        {
+            return PackRotation(field, ScalarAt(current, field, 0))
+                != PackRotation(field, ScalarAt(baseline, field, 0));
+        }
+
         for (std::uint8_t i = 0; i < field.Count; ++i)
         {
             const std::byte* a = ScalarAt(current, field, i);
@@ -188,6 +299,45 @@ namespace
         }
         return false;
     }
+
+    void WriteField(const ReplicatedField& field, std::span<const std::byte> bytes,
+                    NetBitWriter& writer)
+    {
+        if (IsRotation(field))
+        {
+            const PackedRotation packed = PackRotation(field, ScalarAt(bytes, field, 0));
+            writer.WriteBits(packed.Largest, 2);
+            for (std::uint32_t value : packed.Values)
+                writer.WriteBits(value, field.Quantization.Bits);
+            return;
+        }
+        for (std::uint8_t scalar = 0; scalar < field.Count; ++scalar)
+            WriteScalar(field, ScalarAt(bytes, field, scalar), writer);
+    }
+
+    bool ReadField(const ReplicatedField& field, std::span<std::byte> bytes,
+                   NetBitReader& reader)
+    {
+        if (IsRotation(field))
+        {
+            PackedRotation packed;
+            if (!reader.ReadBits(2, packed.Largest))
+                return false;
+            for (std::uint32_t& value : packed.Values)
+            {
+                if (!reader.ReadBits(field.Quantization.Bits, value))
+                    return false;
+            }
+            UnpackRotation(field, packed, ScalarAt(bytes, field, 0));
+            return true;
+        }
+        for (std::uint8_t scalar = 0; scalar < field.Count; ++scalar)
+        {
+            if (!ReadScalar(field, ScalarAt(bytes, field, scalar), reader))
+                return false;
+        }
+        return true;
+    }
 }
 
 //=============================================================================
@@ -370,6 +520,12 @@ void ReplicationSnapToWire(const ReplicatedComponent& component,
 
     for (const ReplicatedField& field : component.Fields)
     {
+        if (IsRotation(field))
+        {
+            std::byte* at = ScalarAt(componentBytes, field, 0);
+            UnpackRotation(field, PackRotation(field, at), at);
+            continue;
+        }
         if (!IsQuantizedFloat(field))
             continue;
         for (std::uint8_t i = 0; i < field.Count; ++i)
@@ -391,7 +547,7 @@ std::size_t ReplicationMaxComponentBits(const ReplicatedComponent& component)
 {
     std::size_t bits = component.Fields.size();  // the mask
     for (const ReplicatedField& field : component.Fields)
-        bits += static_cast<std::size_t>(ScalarBits(field)) * field.Count;
+        bits += FieldBits(field);
     return bits;
 }
 
@@ -429,9 +585,7 @@ bool ReplicationEncodeComponent(const ReplicatedComponent& component,
     {
         if ((mask & (std::uint64_t{ 1 } << i)) == 0)
             continue;
-        const ReplicatedField& field = component.Fields[i];
-        for (std::uint8_t scalar = 0; scalar < field.Count; ++scalar)
-            WriteScalar(field, ScalarAt(current, field, scalar), writer);
+        WriteField(component.Fields[i], current, writer);
     }
 
     return !writer.Overflowed();
@@ -458,12 +612,8 @@ bool ReplicationDecodeComponent(const ReplicatedComponent& component,
     {
         if ((mask & (std::uint64_t{ 1 } << i)) == 0)
             continue;
-        const ReplicatedField& field = component.Fields[i];
-        for (std::uint8_t scalar = 0; scalar < field.Count; ++scalar)
-        {
-            if (!ReadScalar(field, ScalarAt(target, field, scalar), reader))
-                return false;
-        }
+        if (!ReadField(component.Fields[i], target, reader))
+            return false;
     }
 
     return true;
@@ -45,10 +45,23 @@ namespace
         return false;
     }
 
-    bool QuantizationIsUsable(const FieldQuantization& q)
+    bool QuantizationIsUsable(const RuntimeField& field)
     {
+        const FieldQuantization& q = field.Quantization;
         if (!q.IsQuantized())
             return true;
+        if (q.Kind == FieldQuantizationKind::SmallestThree)
+        {
+            // Four floats or it is not a quaternion. The width ceiling keeps
+            // the three packed components and their two-bit index inside one
+            // 64-bit comparison, and below it resolution stops being worth the
+            // bits: sixteen per component is already finer than a float's own
+            // rounding of a normalized rotation.
+            return field.Scalar == FieldScalar::Float
+                && field.Count == 4
+                && q.Bits >= 2
+                && q.Bits <= 16;
+        }
         // 32 bits is the ceiling because the encoder works in a 32-bit integer
         // domain; a range that is empty or not finite has no fixed-point form.
         return q.Bits <= 32
@@ -109,7 +122,7 @@ bool ReplicationLayout::AddErased(ComponentTypeId type,
                  std::string(name) + "." + field.Name);
             return false;
         }
-        if (!QuantizationIsUsable(field.Quantization))
+        if (!QuantizationIsUsable(field))
         {
             Fail(ReplicationLayoutError::InvalidQuantization,
                  std::string(name) + "." + field.Name);
@@ -202,6 +215,7 @@ std::uint64_t ReplicationLayout::TableHash() const
             MixU64(hash, field.Count);
             MixU64(hash, static_cast<std::uint64_t>(field.Scalar));
             MixU64(hash, field.Quantization.Bits);
+            MixU64(hash, static_cast<std::uint64_t>(field.Quantization.Kind));
             MixBytes(hash, &field.Quantization.Min, sizeof(float));
             MixBytes(hash, &field.Quantization.Max, sizeof(float));
             MixU64(hash, field.OwnerOnly ? 1u : 0u);
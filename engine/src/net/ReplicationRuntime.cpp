@@ -2,6 +2,7 @@
 
 #include <ecs/World.h>
 #include <ecs/WorldComponentSchema.h>
+#include <net/NetEntropyModelFile.h>
 
 #include <algorithm>
 
@@ -13,6 +14,16 @@ namespace
     // snapshot supersedes this one before a resend could arrive.
     constexpr std::size_t kKindBytes = 1;
     constexpr std::size_t kMaxSnapshotBytes = kNetMaxPayloadBytes - kKindBytes;
+
+    // A coded snapshot adds one byte after the kind: the low byte of the model
+    // hash. Not a proof of agreement, but it turns the common mistake -- two
+    // builds shipping different models -- into a refusal instead of garbage.
+    constexpr std::size_t kModelTagBytes = 1;
+
+    std::byte ModelTag(const NetEntropyModel& model)
+    {
+        return static_cast<std::byte>(model.Hash() & 0xFFu);
+    }
 }
 
 ReplicationRuntime::PublishStats ReplicationRuntime::Publish(
@@ -29,6 +40,8 @@ ReplicationRuntime::PublishStats ReplicationRuntime::Publish(
 
     if (Scratch.size() < kKindBytes + kMaxSnapshotBytes)
         Scratch.resize(kKindBytes + kMaxSnapshotBytes);
+    if (EntropyModel != nullptr && CodedScratch.size() < kNetMaxPayloadBytes)
+        CodedScratch.resize(kNetMaxPayloadBytes);
     Scratch[0] = static_cast<std::byte>(NetPayloadKind::Snapshot);
 
     for (PeerId peer : peers)
@@ -56,13 +69,32 @@ ReplicationRuntime::PublishStats ReplicationRuntime::Publish(
             continue;
         }
 
-        const std::size_t total = kKindBytes + written.BytesWritten;
-        if (!session.Send(peer, NetChannelKind::UnreliableSequenced,
-                          std::span(Scratch).subspan(0, total)))
+        std::span<const std::byte> outgoing =
+            std::span(Scratch).subspan(0, kKindBytes + written.BytesWritten);
+        if (Capture != nullptr)
+            Capture->Append(outgoing.subspan(kKindBytes));
+
+        // The coded form goes out only when it is actually smaller. A tiny
+        // delta does not repay the coder's header, and a snapshot the model
+        // did not anticipate can grow; either way the raw form is still valid.
+        if (EntropyModel != nullptr)
         {
-            continue;
+            const std::optional<std::size_t> coded = NetEntropyEncode(
+                *EntropyModel, outgoing.subspan(kKindBytes),
+                std::span(CodedScratch).subspan(kKindBytes + kModelTagBytes));
+            if (coded && kKindBytes + kModelTagBytes + *coded < outgoing.size())
+            {
+                CodedScratch[0] = static_cast<std::byte>(NetPayloadKind::SnapshotCoded);
+                CodedScratch[1] = ModelTag(*EntropyModel);
+                outgoing = std::span(CodedScratch)
+                               .subspan(0, kKindBytes + kModelTagBytes + *coded);
+            }
         }
 
+        const std::size_t total = outgoing.size();
+        if (!session.Send(peer, NetChannelKind::UnreliableSequenced, outgoing))
+            continue;
+
         ++stats.SnapshotsSent;
         stats.BytesQueued += total;
     }
@@ -88,9 +120,39 @@ SnapshotApplyResult ReplicationRuntime::Apply(std::span<const std::byte> payload
         result.Error = SnapshotApplyError::Truncated;
         return result;
     }
-    if (static_cast<NetPayloadKind>(payload[0]) != NetPayloadKind::Snapshot)
+    const auto kind = static_cast<NetPayloadKind>(payload[0]);
+    if (kind != NetPayloadKind::Snapshot && kind != NetPayloadKind::SnapshotCoded)
         return result;  // Another kind on the same channel; not ours, not an error.
 
+    std::span<const std::byte> body = payload.subspan(kKindBytes);
+    if (kind == NetPayloadKind::SnapshotCoded)
+    {
+        if (body.size() < kModelTagBytes)
+        {
+            result.Error = SnapshotApplyError::Truncated;
+            return result;
+        }
+        if (EntropyModel == nullptr || body[0] != ModelTag(*EntropyModel))
+        {
+            result.Error = SnapshotApplyError::EntropyModelMismatch;
+            return result;
+        }
+
+        // Decoded into a buffer no larger than a raw snapshot may be, so a
+        // stream that claims more is refused by the coder before it writes.
+        if (CodedScratch.size() < kMaxSnapshotBytes)
+            CodedScratch.resize(kMaxSnapshotBytes);
+        const std::optional<std::size_t> decoded = NetEntropyDecode(
+            *EntropyModel, body.subspan(kModelTagBytes),
+            std::span(CodedScratch).subspan(0, kMaxSnapshotBytes));
+        if (!decoded)
+        {
+            result.Error = SnapshotApplyError::EntropyModelMismatch;
+            return result;
+        }
+        body = std::span<const std::byte>(CodedScratch).subspan(0, *decoded);
+    }
+
     SnapshotApplyRequest request;
     request.Target = &world;
     request.Schema = &schema;
@@ -98,7 +160,7 @@ SnapshotApplyResult ReplicationRuntime::Apply(std::span<const std::byte> payload
     request.Identity = &ClientMap;
     request.Recipes = recipes;
 
-    return ReplicationApplySnapshot(request, payload.subspan(kKindBytes));
+    return ReplicationApplySnapshot(request, body);
 }
 
 void ReplicationRuntime::ForgetPeer(PeerId peer)
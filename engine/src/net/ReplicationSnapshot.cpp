@@ -50,6 +50,7 @@ std::string_view SnapshotApplyErrorToString(SnapshotApplyError error)
     case SnapshotApplyError::UnknownComponentStorage:
         return "no storage for component";
     case SnapshotApplyError::ComponentAddFailed:     return "could not add component";
+    case SnapshotApplyError::EntropyModelMismatch:   return "entropy model mismatch";
     }
     return "unknown";
 }
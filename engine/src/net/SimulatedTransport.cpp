@@ -103,3 +103,8 @@ std::span<const NetDatagram> SimulatedTransport::Receive()
 {
     return Inner.Receive();
 }
+
+NetTransportCounters SimulatedTransport::Counters() const
+{
+    return Inner.Counters();
+}
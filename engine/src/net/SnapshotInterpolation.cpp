@@ -0,0 +1,216 @@
+#include <net/SnapshotInterpolation.h>
+
+#include <ecs/World.h>
+#include <net/NetReplicationComponents.h>
+#include <net/NetTickEstimator.h>
+#include <world/transform/TransformComponents.h>
+#include <world/transform/TransformHistory.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    // How hard the render clock may be steered, as a fraction of the time it
+    // advances: at a tenth, motion drawn through a delay change runs at most
+    // ten percent fast or slow, which reads as nothing at all.
+    constexpr double kSteerRate = 0.1;
+}
+
+const SnapshotInterpolation::Sample& SnapshotInterpolation::Track::At(std::size_t age) const
+{
+    return Samples[(Head + kSamplesPerEntity - 1 - age) % kSamplesPerEntity];
+}
+
+void SnapshotInterpolation::Record(World& world, const ReplicationClientIdentity& identity,
+                                   PeerId localPeer, std::uint64_t authorityTick)
+{
+    if (!Enabled || !world.IsRegistered<LocalTransform>())
+        return;
+
+    // The channel already drops what arrives behind something newer, so this
+    // is a guard rather than a path: a sample older than the newest would
+    // have to be inserted rather than appended, and drawing never reaches
+    // back that far.
+    if (Totals.Recorded > 0 && authorityTick <= NewestTick)
+    {
+        ++Totals.Stale;
+        return;
+    }
+    NewestTick = authorityTick;
+    ++Totals.Recorded;
+    ++Generation;
+
+    const bool parented = world.IsRegistered<Parent>();
+    const bool owned = world.IsRegistered<NetOwner>();
+    const bool drawable = world.IsRegistered<WorldTransformHistory>();
+
+    for (const auto& [id, entity] : identity.All())
+    {
+        const World& reader = world;
+        const LocalTransform* local = reader.TryGet<LocalTransform>(entity);
+        if (local == nullptr)
+            continue;
+        if (parented && reader.TryGet<Parent>(entity) != nullptr)
+            continue;
+        if (owned)
+        {
+            const NetOwner* owner = reader.TryGet<NetOwner>(entity);
+            if (owner != nullptr && owner->Peer != 0 && owner->Peer == localPeer.Value)
+                continue;
+        }
+
+        // Every entity the authority knows about gets a sample, including the
+        // ones this snapshot said nothing about: unchanged is a pose too, and
+        // without it a still entity would be extrapolated from stale motion.
+        const Transform3f pose = local->Value;
+
+        Track& track = Tracks[id];
+        if (track.Entity != entity)
+            track = Track{ .Entity = entity };
+        track.Seen = Generation;
+        track.Samples[track.Head] = Sample{ .Tick = authorityTick, .Pose = pose };
+        track.Head = (track.Head + 1) % kSamplesPerEntity;
+        track.Count = std::min(track.Count + 1, kSamplesPerEntity);
+
+        if (drawable && reader.TryGet<WorldTransformHistory>(entity) == nullptr)
+        {
+            world.AddComponent<WorldTransformHistory>(entity, WorldTransformHistory{
+                .Previous = pose,
+                .Current = pose,
+                .Snap = false,
+            });
+        }
+    }
+
+    // Destroyed, or now owned here; either way nothing left to draw.
+    std::erase_if(Tracks, [this](const auto& entry) { return entry.second.Seen != Generation; });
+}
+
+void SnapshotInterpolation::Present(World& world, const NetTickEstimator& clock,
+                                    std::uint64_t localTick, double alpha,
+                                    double elapsedTicks)
+{
+    Totals.Interpolated = 0;
+    Totals.Extrapolated = 0;
+    Totals.Held = 0;
+    if (!Enabled || Tracks.empty() || !clock.HasEstimate())
+        return;
+
+    // The tick the newest snapshot should be speaking for about now: the
+    // authority's present, less the time its word takes to get here.
+    const double newest = static_cast<double>(localTick) + alpha
+                        + static_cast<double>(clock.Offset())
+                        - static_cast<double>(clock.FlightTicks());
+    const double target = std::clamp(kMinDelayTicks + kJitterScale * clock.JitterTicks(),
+                                     kMinDelayTicks, kMaxDelayTicks);
+    const double wanted = newest - target;
+
+    // Far off is a discontinuity the estimator has snapped across too: the
+    // join, or a hitch long enough that easing toward it would draw seconds of
+    // fast-forward.
+    const double step = std::max(elapsedTicks, 0.0);
+    if (!Clocked || std::abs(wanted - (Clock + step))
+                        > static_cast<double>(NetTickEstimator::kSnapTicks))
+    {
+        Clock = wanted;
+        Clocked = true;
+    }
+    else
+    {
+        const double advanced = Clock + step;
+        const double steer = kSteerRate * step;
+        Clock = advanced + std::clamp(wanted - advanced, -steer, steer);
+    }
+    Totals.TargetDelayTicks = target;
+    Totals.DelayTicks = newest - Clock;
+
+    if (!world.IsRegistered<WorldTransformHistory>())
+        return;
+
+    for (const auto& [id, track] : Tracks)
+    {
+        if (track.Count == 0)
+            continue;
+        WorldTransformHistory* history = world.TryGet<WorldTransformHistory>(track.Entity);
+        if (history == nullptr)
+            continue;
+
+        Transform3f pose;
+        switch (Place(track, Clock, pose))
+        {
+        case Placement::Interpolated: ++Totals.Interpolated; break;
+        case Placement::Extrapolated: ++Totals.Extrapolated; break;
+        case Placement::Held:         ++Totals.Held;         break;
+        }
+
+        // Both ends of the tick blend are the pose already blended here, so
+        // whatever alpha extraction uses draws exactly this.
+        history->Previous = pose;
+        history->Current = pose;
+        history->Snap = false;
+    }
+}
+
+SnapshotInterpolation::Placement SnapshotInterpolation::Place(const Track& track, double tick,
+                                                              Transform3f& pose)
+{
+    const Sample& newest = track.Newest();
+    if (tick >= static_cast<double>(newest.Tick))
+    {
+        if (track.Count < 2)
+        {
+            pose = newest.Pose;
+            return Placement::Held;
+        }
+
+        // On along the last two samples, for as long as that is a guess worth
+        // drawing, and then stopped where the guess ended.
+        const Sample& before = track.At(1);
+        const double span = static_cast<double>(newest.Tick - before.Tick);
+        const double over = tick - static_cast<double>(newest.Tick);
+        const double carried = std::min(over, kMaxExtrapolationTicks);
+        pose = Transform3f::Interpolate(before.Pose, newest.Pose,
+                                        static_cast<float>(1.0 + carried / span));
+        if (over > kMaxExtrapolationTicks)
+            return Placement::Held;
+        return over > 0.0 ? Placement::Extrapolated : Placement::Interpolated;
+    }
+
+    for (std::size_t age = 1; age < track.Count; ++age)
+    {
+        const Sample& older = track.At(age);
+        if (static_cast<double>(older.Tick) > tick)
+            continue;
+
+        const Sample& newer = track.At(age - 1);
+        const double span = static_cast<double>(newer.Tick - older.Tick);
+        const double t = (tick - static_cast<double>(older.Tick)) / span;
+        pose = Transform3f::Interpolate(older.Pose, newer.Pose, static_cast<float>(t));
+        return Placement::Interpolated;
+    }
+
+    // Before anything kept: a buffer that has only just started, or a delay
+    // that grew past its length. The oldest pose is the nearest there is.
+    pose = track.At(track.Count - 1).Pose;
+    return Placement::Held;
+}
+
+void SnapshotInterpolation::SetEnabled(bool enabled)
+{
+    if (Enabled == enabled)
+        return;
+    Enabled = enabled;
+    if (!enabled)
+        Reset();
+}
+
+void SnapshotInterpolation::Reset()
+{
+    Tracks.clear();
+    Generation = 0;
+    NewestTick = 0;
+    Clock = 0.0;
+    Clocked = false;
+    Totals = Counters{};
+}
@@ -1,5 +1,6 @@
 #include <net/UdpTransport.h>
 
+#include <algorithm>
 #include <cerrno>
 #include <cstring>
 
@@ -15,6 +16,15 @@ using SocketHandle = SOCKET;
 #include <unistd.h>
 #endif
 
+// recvmmsg/sendmmsg are Linux extensions. Everything else takes the per-datagram
+// path, which is the portable fallback rather than a degraded mode: same
+// datagrams, same order, more calls.
+#if defined(__linux__)
+#define SENCHA_NET_BATCHED_IO 1
+#else
+#define SENCHA_NET_BATCHED_IO 0
+#endif
+
 namespace
 {
 #if defined(_WIN32)
@@ -25,6 +35,13 @@ namespace
     bool WouldBlock() { return errno == EAGAIN || errno == EWOULDBLOCK; }
 #endif
 
+#if SENCHA_NET_BATCHED_IO
+    // Headers per batched call. The message vectors live on the stack for the
+    // length of one call, so this bounds the stack cost rather than the pump:
+    // a pump larger than one batch simply makes another call.
+    constexpr std::size_t kBatch = 64;
+#endif
+
     // Both directions of the one conversion between the engine's address value
     // and the platform's. Confined here so NetAddress stays socket-free.
     bool ToSockAddr(const NetAddress& address, sockaddr_storage& out, socklen_t& length)
@@ -142,12 +159,15 @@ void UdpTransport::Close()
 {
     if (Socket >= 0)
     {
+        FlushSends();
         CloseSocket(Socket);
         Socket = -1;
     }
     Local = {};
     Pendings.clear();
     Received.clear();
+    Outbox.clear();
+    Calls = {};
 }
 
 bool UdpTransport::Send(const NetAddress& to, std::span<const std::byte> payload)
@@ -167,7 +187,101 @@ bool UdpTransport::Send(const NetAddress& to, std::span<const std::byte> payload
         0,
         reinterpret_cast<const sockaddr*>(&destination),
         length);
-    return sent >= 0 && static_cast<std::size_t>(sent) == payload.size();
+    ++Calls.SendCalls;
+    const bool whole = sent >= 0 && static_cast<std::size_t>(sent) == payload.size();
+    if (whole)
+        ++Calls.DatagramsSent;
+    return whole;
+}
+
+bool UdpTransport::Queue(const NetAddress& to, std::span<const std::byte> payload)
+{
+    if (!IsOpen() || payload.size() > kNetMaxDatagramBytes)
+        return false;
+    // Refused now rather than at flush: a caller told "queued" must not learn
+    // afterwards that the address could never have been sent to.
+    if (to.Family != NetAddressFamily::IPv4 && to.Family != NetAddressFamily::IPv6)
+        return false;
+
+    const std::size_t index = Outbox.size();
+    if (SendSlots.size() <= index)
+        SendSlots.resize(index + 1);
+    std::memcpy(SendSlots[index].data(), payload.data(), payload.size());
+    Outbox.push_back(Outgoing{ .To = to, .Length = payload.size() });
+    return true;
+}
+
+void UdpTransport::FlushSends()
+{
+    if (Outbox.empty())
+        return;
+    if (IsOpen())
+    {
+#if SENCHA_NET_BATCHED_IO
+        FlushBatched();
+#else
+        FlushEach();
+#endif
+    }
+    Outbox.clear();
+}
+
+void UdpTransport::FlushEach()
+{
+    for (std::size_t index = 0; index < Outbox.size(); ++index)
+    {
+        const Outgoing& outgoing = Outbox[index];
+        if (!Send(outgoing.To, std::span<const std::byte>(SendSlots[index].data(),
+                                                          outgoing.Length)))
+        {
+            ++Failed;
+        }
+    }
+}
+
+void UdpTransport::FlushBatched()
+{
+#if SENCHA_NET_BATCHED_IO
+    std::array<mmsghdr, kBatch> headers{};
+    std::array<iovec, kBatch> vectors{};
+    std::array<sockaddr_storage, kBatch> destinations{};
+
+    std::size_t next = 0;
+    while (next < Outbox.size())
+    {
+        const std::size_t count = std::min(kBatch, Outbox.size() - next);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const Outgoing& outgoing = Outbox[next + i];
+            socklen_t length = 0;
+            // Queue refused every family ToSockAddr cannot convert.
+            (void)ToSockAddr(outgoing.To, destinations[i], length);
+            vectors[i].iov_base = SendSlots[next + i].data();
+            vectors[i].iov_len = outgoing.Length;
+            headers[i] = mmsghdr{};
+            headers[i].msg_hdr.msg_name = &destinations[i];
+            headers[i].msg_hdr.msg_namelen = length;
+            headers[i].msg_hdr.msg_iov = &vectors[i];
+            headers[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        const int sent = ::sendmmsg(Socket, headers.data(),
+                                    static_cast<unsigned int>(count), 0);
+        ++Calls.SendCalls;
+        if (sent < 0)
+        {
+            // The call stops at the first datagram the platform refuses and
+            // reports an error only when that was the first. Skipping the one
+            // refused keeps a single bad destination from stalling every peer
+            // queued behind it -- the per-datagram path behaves the same way.
+            ++Failed;
+            ++next;
+            continue;
+        }
+        Calls.DatagramsSent += static_cast<std::uint64_t>(sent);
+        next += static_cast<std::size_t>(sent);
+    }
+#endif
 }
 
 std::span<const NetDatagram> UdpTransport::Receive()
@@ -180,6 +294,26 @@ std::span<const NetDatagram> UdpTransport::Receive()
     if (Slots.size() < MaxPerReceive)
         Slots.resize(MaxPerReceive);
 
+#if SENCHA_NET_BATCHED_IO
+    ReceiveBatched();
+#else
+    ReceiveEach();
+#endif
+
+    Received.reserve(Pendings.size());
+    for (const Pending& pending : Pendings)
+    {
+        Received.push_back(NetDatagram{
+            .From = pending.From,
+            .Payload = std::span<const std::byte>(Slots[pending.Slot].data(),
+                                                  pending.Length),
+        });
+    }
+    return Received;
+}
+
+void UdpTransport::ReceiveEach()
+{
     for (std::size_t index = 0; index < MaxPerReceive; ++index)
     {
         sockaddr_storage from{};
@@ -191,6 +325,7 @@ std::span<const NetDatagram> UdpTransport::Receive()
             0,
             reinterpret_cast<sockaddr*>(&from),
             &fromLength);
+        ++Calls.ReceiveCalls;
 
         if (received < 0)
         {
@@ -219,16 +354,70 @@ std::span<const NetDatagram> UdpTransport::Receive()
             .Slot = index,
             .Length = length,
         });
+        ++Calls.DatagramsReceived;
     }
+}
 
-    Received.reserve(Pendings.size());
-    for (const Pending& pending : Pendings)
+void UdpTransport::ReceiveBatched()
+{
+#if SENCHA_NET_BATCHED_IO
+    std::array<mmsghdr, kBatch> headers{};
+    std::array<iovec, kBatch> vectors{};
+    std::array<sockaddr_storage, kBatch> sources{};
+
+    std::size_t base = 0;
+    while (base < MaxPerReceive)
     {
-        Received.push_back(NetDatagram{
-            .From = pending.From,
-            .Payload = std::span<const std::byte>(Slots[pending.Slot].data(),
-                                                  pending.Length),
-        });
+        const std::size_t count = std::min(kBatch, MaxPerReceive - base);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            vectors[i].iov_base = Slots[base + i].data();
+            vectors[i].iov_len = Slots[base + i].size();
+            headers[i] = mmsghdr{};
+            headers[i].msg_hdr.msg_name = &sources[i];
+            headers[i].msg_hdr.msg_namelen = sizeof(sockaddr_storage);
+            headers[i].msg_hdr.msg_iov = &vectors[i];
+            headers[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        const int received = ::recvmmsg(Socket, headers.data(),
+                                        static_cast<unsigned int>(count),
+                                        MSG_DONTWAIT, nullptr);
+        ++Calls.ReceiveCalls;
+        if (received < 0)
+        {
+            if (WouldBlock())
+                return;
+            // The refused-ICMP case from the per-datagram path: it consumes
+            // nothing, so a retry reads the datagrams behind it. One retry per
+            // slot keeps a socket that errors forever from spinning the pump.
+            ++base;
+            continue;
+        }
+
+        for (std::size_t i = 0; i < static_cast<std::size_t>(received); ++i)
+        {
+            // MSG_TRUNC is how the kernel says the datagram did not fit the
+            // slot; the per-datagram path cannot see that and so relies on the
+            // slot being exactly the transport's bound, which this one is too.
+            if ((headers[i].msg_hdr.msg_flags & MSG_TRUNC) != 0)
+            {
+                ++Oversized;
+                continue;
+            }
+            Pendings.push_back(Pending{
+                .From = FromSockAddr(sources[i]),
+                .Slot = base + i,
+                .Length = headers[i].msg_len,
+            });
+            ++Calls.DatagramsReceived;
+        }
+
+        base += static_cast<std::size_t>(received);
+        // A short batch means the socket ran dry; asking again would only
+        // spend a call to hear EAGAIN.
+        if (static_cast<std::size_t>(received) < count)
+            return;
     }
-    return Received;
+#endif
 }
@@ -17,10 +17,20 @@ void CharacterControllerSystem::Physics(PhysicsContext& ctx)
         return;
 
     CharacterMoverPool& movers = Step->GetCharacterMovers();
+    const float dt = static_cast<float>(ctx.Time.DeltaSeconds);
+
+    // Replaying a corrected prediction moves the predicted characters only.
+    // Binding and unbinding movers is once-per-real-tick work, like the step.
+    if (ctx.Resimulating)
+    {
+        movers.DriveEntities(ctx.Entities, ctx.Predicted, dt, Gravity);
+        return;
+    }
+
     movers.Reconcile(ctx.Entities, ctx.Partitions);
     movers.Drive(
         ctx.Entities,
         ctx.Partitions,
-        static_cast<float>(ctx.Time.DeltaSeconds),
+        dt,
         Gravity);
 }
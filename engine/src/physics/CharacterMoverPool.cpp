@@ -40,6 +40,37 @@ SupportKind ToSupportKind(CharacterSupportKind kind)
     }
     return SupportKind::None;
 }
+
+// One mover's tick: the composed request in, the achieved motion out.
+void MoveCharacter(
+    CharacterMover& mover,
+    float dt,
+    const Vec3d& gravity,
+    LocalTransform& transform,
+    const MotionRequest& motion,
+    KinematicState& kinematic,
+    SupportState& support)
+{
+    CharacterMoveRequest request;
+    request.Velocity = motion.Velocity;
+    request.UpAxis = motion.UpAxis;
+    request.GravityScale = motion.GravityScale;
+    request.Gravity = gravity;
+    request.DeltaSeconds = dt;
+
+    const CharacterMoveResult result = mover.Move(request);
+
+    // The achieved velocity is what locomotion reads next tick, so a character
+    // that hit a wall does not keep the velocity it asked for.
+    kinematic.Velocity = result.Velocity;
+    support.Kind = ToSupportKind(result.Support.Kind);
+    support.Surface = result.Support.Surface;
+    support.ContactPoint = result.Support.ContactPoint;
+    support.Normal = result.Support.Normal;
+    support.SurfaceVelocity = result.Support.Velocity;
+
+    transform.Value.Position = result.Position;
+}
 } // namespace
 
 struct CharacterMoverPool::State
@@ -229,33 +260,51 @@ void CharacterMoverPool::Drive(
 
         for (uint32_t index = 0; index < view.Count(); ++index)
         {
-            CharacterMover& mover =
-                *state.Slots[links[index].MoverSlot].Mover;
-
-            CharacterMoveRequest request;
-            request.Velocity = requests[index].Velocity;
-            request.UpAxis = requests[index].UpAxis;
-            request.GravityScale = requests[index].GravityScale;
-            request.Gravity = gravity;
-            request.DeltaSeconds = dt;
-
-            const CharacterMoveResult result = mover.Move(request);
-
-            // The achieved velocity is what locomotion reads next tick, so a
-            // character that hit a wall does not keep the velocity it asked
-            // for.
-            kinematics[index].Velocity = result.Velocity;
-            supports[index].Kind = ToSupportKind(result.Support.Kind);
-            supports[index].Surface = result.Support.Surface;
-            supports[index].ContactPoint = result.Support.ContactPoint;
-            supports[index].Normal = result.Support.Normal;
-            supports[index].SurfaceVelocity = result.Support.Velocity;
-
-            transforms[index].Value.Position = result.Position;
+            MoveCharacter(
+                *state.Slots[links[index].MoverSlot].Mover,
+                dt,
+                gravity,
+                transforms[index],
+                requests[index],
+                kinematics[index],
+                supports[index]);
         }
     });
 }
 
+void CharacterMoverPool::DriveEntities(
+    World& world,
+    std::span<const EntityId> entities,
+    float dt,
+    const Vec3d& gravity)
+{
+    if (!ReadyToDrive(world) || !S)
+        return;
+
+    State& state = *S;
+    for (const EntityId entity : entities)
+    {
+        if (!world.IsAlive(entity))
+            continue;
+        const CharacterMoverLink* link = world.TryGet<CharacterMoverLink>(entity);
+        LocalTransform* transform = world.TryGet<LocalTransform>(entity);
+        const MotionRequest* motion = world.TryGet<MotionRequest>(entity);
+        KinematicState* kinematic = world.TryGet<KinematicState>(entity);
+        SupportState* support = world.TryGet<SupportState>(entity);
+        if (link == nullptr || transform == nullptr || motion == nullptr
+            || kinematic == nullptr || support == nullptr
+            || link->MoverSlot >= state.Slots.size()
+            || !state.Slots[link->MoverSlot].Mover)
+        {
+            continue;
+        }
+
+        CharacterMover& mover = *state.Slots[link->MoverSlot].Mover;
+        mover.SetPosition(transform->Value.Position);
+        MoveCharacter(mover, dt, gravity, *transform, *motion, *kinematic, *support);
+    }
+}
+
 void CharacterMoverPool::EvictPartition(
     World& world,
     StoragePartitionId partition)
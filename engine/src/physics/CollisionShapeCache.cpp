@@ -3,11 +3,54 @@
 #include "CollisionShapeCacheImpl.h"
 #include "JoltStartup.h"
 
+#include <iterator>
 #include <sstream>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <Jolt/Core/StreamWrapper.h>
 
+namespace
+{
+JPH::ShapeRefC RestoreShape(std::span<const std::byte> blob)
+{
+    EnsureJoltRegistered(); // sRestoreFromBinaryState builds the shape via the Factory
+
+    std::string buffer(reinterpret_cast<const char*>(blob.data()), blob.size());
+    std::istringstream stream(buffer, std::ios::binary);
+    JPH::StreamInWrapper in(stream);
+
+    JPH::Shape::ShapeResult result = JPH::Shape::sRestoreFromBinaryState(in);
+    if (result.HasError() || !result.IsValid())
+        return JPH::ShapeRefC();
+    return result.Get();
+}
+} // namespace
+
+CollisionShapeBatch::CollisionShapeBatch()
+    : Impl(std::make_unique<CollisionShapeBatchImpl>())
+{
+}
+
+CollisionShapeBatch::~CollisionShapeBatch() = default;
+CollisionShapeBatch::CollisionShapeBatch(CollisionShapeBatch&&) noexcept = default;
+CollisionShapeBatch& CollisionShapeBatch::operator=(CollisionShapeBatch&&) noexcept = default;
+
+bool CollisionShapeBatch::Restore(std::span<const std::byte> blob)
+{
+    JPH::ShapeRefC shape = RestoreShape(blob);
+    if (shape == nullptr)
+        return false;
+    Impl->Shapes.push_back(std::move(shape));
+    return true;
+}
+
+std::size_t CollisionShapeBatch::Count() const
+{
+    return Impl->Shapes.size();
+}
+
 CollisionShapeCache::CollisionShapeCache()
     : Impl(std::make_unique<CollisionShapeCacheImpl>())
 {
@@ -19,18 +62,26 @@ CollisionShapeCache& CollisionShapeCache::operator=(CollisionShapeCache&&) noexc
 
 CollisionShapeHandle CollisionShapeCache::LoadBlob(std::span<const std::byte> blob)
 {
-    EnsureJoltRegistered(); // sRestoreFromBinaryState builds the shape via the Factory
+    JPH::ShapeRefC shape = RestoreShape(blob);
+    if (shape == nullptr)
+        return CollisionShapeHandle{};
 
-    std::string buffer(reinterpret_cast<const char*>(blob.data()), blob.size());
-    std::istringstream stream(buffer, std::ios::binary);
-    JPH::StreamInWrapper in(stream);
+    Impl->Shapes.push_back(std::move(shape));
+    return CollisionShapeHandle{ static_cast<uint32_t>(Impl->Shapes.size()) };
+}
 
-    JPH::Shape::ShapeResult result = JPH::Shape::sRestoreFromBinaryState(in);
-    if (result.HasError() || !result.IsValid())
+CollisionShapeHandle CollisionShapeCache::Adopt(CollisionShapeBatch&& batch)
+{
+    std::vector<JPH::ShapeRefC>& shapes = batch.Internal().Shapes;
+    if (shapes.empty())
         return CollisionShapeHandle{};
 
-    Impl->Shapes.push_back(result.Get());
-    return CollisionShapeHandle{ static_cast<uint32_t>(Impl->Shapes.size()) };
+    const CollisionShapeHandle first{ static_cast<uint32_t>(Impl->Shapes.size() + 1) };
+    Impl->Shapes.insert(Impl->Shapes.end(),
+                        std::make_move_iterator(shapes.begin()),
+                        std::make_move_iterator(shapes.end()));
+    shapes.clear();
+    return first;
 }
 
 bool CollisionShapeCache::Has(CollisionShapeHandle handle) const
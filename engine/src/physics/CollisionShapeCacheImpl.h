@@ -1,7 +1,8 @@
 #pragma once
 
-// Internal Jolt-side completion of CollisionShapeCache's PIMPL. Holds the loaded
-// shapes; handle.Value - 1 indexes (0 is the invalid handle).
+// Internal Jolt-side completion of CollisionShapeCache's and CollisionShapeBatch's
+// PIMPLs. Holds the loaded shapes; handle.Value - 1 indexes (0 is the invalid
+// handle).
 
 #include <Jolt/Jolt.h>
 
@@ -11,6 +12,11 @@
 
 #include <physics/CollisionShape.h>
 
+struct CollisionShapeBatchImpl
+{
+    std::vector<JPH::ShapeRefC> Shapes;
+};
+
 struct CollisionShapeCacheImpl
 {
     std::vector<JPH::ShapeRefC> Shapes;
@@ -36,6 +36,10 @@ void PhysicsStepSystem::Physics(PhysicsContext& ctx)
     const float dt = static_cast<float>(ctx.Time.DeltaSeconds);
 
     Bodies.SyncToPhysics(ctx.Entities, ctx.Partitions);
+    // The rebuild a bulk attach leaves owed waits for a frame that attached
+    // nothing, so it never lands on top of the attach itself.
+    if (Bodies.AttachedLastSync() == 0 && Simulation.BroadPhaseOptimizePending())
+        Simulation.OptimizeBroadPhase();
     Simulation.Step(dt, CollisionSteps);
     Bodies.SyncFromPhysics(ctx.Entities, ctx.Partitions);
 }
@@ -28,6 +28,7 @@ PhysicsWorld::PhysicsWorld(const PhysicsWorldConfig& config)
         Impl->ObjectVsObject);
     Impl->System.SetGravity(ToJph(config.Gravity));
     Impl->MaxDriveClosingSpeed = config.MaxDriveClosingSpeed;
+    Impl->BroadPhaseOptimizeBatch = config.BroadPhaseOptimizeBatch;
     Impl->MaxDriveClosingAngularSpeed = config.MaxDriveClosingAngularSpeed;
 }
 
@@ -151,17 +152,22 @@ void PhysicsWorld::DriveConstraints(float dt)
     }
 }
 
-PhysicsBodyId PhysicsWorld::AddBody(const BodyDesc& desc)
+namespace
+{
+bool MakeCreationSettings(
+    const BodyDesc& desc,
+    const CollisionShapeCache* cache,
+    JPH::BodyCreationSettings& settings)
 {
     JPH::ShapeRefC shape;
-    if (desc.MeshShape.IsValid() && ShapeCache != nullptr)
-        shape = ShapeCache->Internal().Resolve(desc.MeshShape);
+    if (desc.MeshShape.IsValid() && cache != nullptr)
+        shape = cache->Internal().Resolve(desc.MeshShape);
     else
         shape = BuildShape(desc.Shape);
     if (shape == nullptr)
-        return PhysicsBodyId{};
+        return false;
 
-    JPH::BodyCreationSettings settings(
+    settings = JPH::BodyCreationSettings(
         shape,
         ToJphR(desc.Position),
         ToJph(desc.Rotation),
@@ -177,15 +183,81 @@ PhysicsBodyId PhysicsWorld::AddBody(const BodyDesc& desc)
         settings.mOverrideMassProperties = JPH::EOverrideMassProperties::CalculateInertia;
         settings.mMassPropertiesOverride.mMass = desc.Mass;
     }
+    return true;
+}
 
-    const JPH::EActivation activation =
-        desc.Motion == BodyMotion::Static ? JPH::EActivation::DontActivate : JPH::EActivation::Activate;
+JPH::EActivation ActivationFor(BodyMotion motion)
+{
+    return motion == BodyMotion::Static ? JPH::EActivation::DontActivate : JPH::EActivation::Activate;
+}
+
+void InsertBatch(JPH::BodyInterface& bodies, std::vector<JPH::BodyID>& batch, JPH::EActivation activation)
+{
+    if (batch.empty())
+        return;
+    // Prepare sorts the batch in place and builds its broadphase subtrees;
+    // Finalize splices them in under one lock.
+    const int count = static_cast<int>(batch.size());
+    const JPH::BodyInterface::AddState state = bodies.AddBodiesPrepare(batch.data(), count);
+    bodies.AddBodiesFinalize(batch.data(), count, state, activation);
+    batch.clear();
+}
+} // namespace
+
+PhysicsBodyId PhysicsWorld::AddBody(const BodyDesc& desc)
+{
+    JPH::BodyCreationSettings settings;
+    if (!MakeCreationSettings(desc, ShapeCache, settings))
+        return PhysicsBodyId{};
 
     JPH::BodyInterface& bodies = Impl->System.GetBodyInterface();
-    const JPH::BodyID id = bodies.CreateAndAddBody(settings, activation);
+    const JPH::BodyID id = bodies.CreateAndAddBody(settings, ActivationFor(desc.Motion));
     return FromJph(id);
 }
 
+size_t PhysicsWorld::AddBodies(std::span<const BodyDesc> descs, std::span<PhysicsBodyId> ids)
+{
+    assert(ids.size() == descs.size() && "AddBodies: one id slot per desc");
+
+    JPH::BodyInterface& bodies = Impl->System.GetBodyInterface();
+    size_t added = 0;
+    for (size_t index = 0; index < descs.size(); ++index)
+    {
+        ids[index] = PhysicsBodyId{};
+        JPH::BodyCreationSettings settings;
+        if (!MakeCreationSettings(descs[index], ShapeCache, settings))
+            continue;
+
+        // Null once the body pool is exhausted, as CreateAndAddBody's id is
+        // invalid then.
+        const JPH::Body* body = bodies.CreateBody(settings);
+        if (body == nullptr)
+            continue;
+
+        ids[index] = FromJph(body->GetID());
+        (descs[index].Motion == BodyMotion::Static ? Impl->InsertStatic : Impl->InsertActive)
+            .push_back(body->GetID());
+        ++added;
+    }
+
+    InsertBatch(bodies, Impl->InsertStatic, JPH::EActivation::DontActivate);
+    InsertBatch(bodies, Impl->InsertActive, JPH::EActivation::Activate);
+    if (added > 0 && added >= Impl->BroadPhaseOptimizeBatch)
+        Impl->BroadPhaseDirty = true;
+    return added;
+}
+
+void PhysicsWorld::OptimizeBroadPhase()
+{
+    Impl->System.OptimizeBroadPhase();
+    Impl->BroadPhaseDirty = false;
+}
+
+bool PhysicsWorld::BroadPhaseOptimizePending() const
+{
+    return Impl->BroadPhaseDirty;
+}
+
 void PhysicsWorld::RemoveBody(PhysicsBodyId id)
 {
     if (!id.IsValid())
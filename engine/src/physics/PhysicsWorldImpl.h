@@ -68,6 +68,13 @@ struct PhysicsWorldImpl
     uint32_t AliveConstraints = 0;
     uint64_t StaleRefreshes = 0;
 
+    // AddBodies' insertion lists, kept for their capacity. Split by activation
+    // because a bulk insertion takes one activation mode.
+    std::vector<JPH::BodyID> InsertStatic;
+    std::vector<JPH::BodyID> InsertActive;
+    bool BroadPhaseDirty = false;
+    uint32_t BroadPhaseOptimizeBatch = 128;
+
     // From PhysicsWorldConfig (see its comment on tunneling).
     float MaxDriveClosingSpeed = 50.0f;
     float MaxDriveClosingAngularSpeed = 30.0f;
@@ -2,6 +2,7 @@
 
 #include <cassert>
 #include <cmath>
+#include <vector>
 
 #include <ecs/CommandBuffer.h>
 #include <ecs/Query.h>
@@ -61,6 +62,11 @@ struct RigidBodyBinding::SceneState
     }
 
     CommandBuffer Commands;
+    // One Reconcile's new bodies, gathered so they enter the simulation in a
+    // single AddBodies batch. Kept for their capacity.
+    std::vector<EntityId> Attaching;
+    std::vector<BodyDesc> AttachDescs;
+    std::vector<PhysicsBodyId> AttachIds;
     Query<Read<LocalTransform>, Read<RigidBody>, Read<PhysicsBodyLink>>
         KinematicPush;
     Query<Write<LocalTransform>, Write<RigidBody>, Read<PhysicsBodyLink>>
@@ -160,12 +166,23 @@ void RigidBodyBinding::Reconcile(
             desc.AngularDamping = body->AngularDamping;
         }
 
-        const PhysicsBodyId id = Simulation->AddBody(desc);
+        state.Attaching.push_back(entity);
+        state.AttachDescs.push_back(desc);
+    });
+
+    // A zone entering physics brings all its colliders in one pass; inserting
+    // them as one batch keeps that from being a broadphase insert per body.
+    state.AttachIds.resize(state.AttachDescs.size());
+    AttachedCount = Simulation->AddBodies(state.AttachDescs, state.AttachIds);
+    for (size_t index = 0; index < state.Attaching.size(); ++index)
+    {
+        const EntityId entity = state.Attaching[index];
+        const PhysicsBodyId id = state.AttachIds[index];
         if (!id.IsValid())
-            return;
+            continue;
 
         Owned.push_back(BodyRecord{ entity, id });
-        if (body != nullptr)
+        if (const RigidBody* body = readOnly.TryGet<RigidBody>(entity))
         {
             Simulation->SetLinearVelocity(
                 id,
@@ -177,7 +194,10 @@ void RigidBodyBinding::Reconcile(
         state.Commands.AddComponent<PhysicsBodyLink>(
             entity,
             PhysicsBodyLink{ id });
-    });
+    }
+    state.Attaching.clear();
+    state.AttachDescs.clear();
+    state.AttachIds.clear();
 
     for (size_t index = 0; index < Owned.size();)
     {
@@ -217,6 +237,7 @@ void RigidBodyBinding::SyncToPhysics(
              && !world.IsRegistered<PhysicsBodyLink>())
            && "Collider registered without PhysicsBodyLink");
 
+    AttachedCount = 0;
     if (!Ready(world))
         return;
 
@@ -5,6 +5,7 @@
 #include <ios>
 #include <optional>
 #include <sstream>
+#include <utility>
 #include <vector>
 
 #include <core/json/JsonParser.h>
@@ -55,16 +56,14 @@ Vec3d ReadOrigin(const JsonValue& entry)
 }
 } // namespace
 
-int LoadZoneCollision(
-    World& world,
-    CollisionShapeCache& cache,
+RestoredZoneCollision RestoreZoneCollision(
     const std::string& sidecarPath,
-    const std::string& cookedRoot,
-    StoragePartitionId partition)
+    const std::string& cookedRoot)
 {
+    RestoredZoneCollision collision;
     std::ifstream file(sidecarPath);
     if (!file.is_open())
-        return 0;
+        return collision;
 
     std::ostringstream buffer;
     buffer << file.rdbuf();
@@ -73,13 +72,8 @@ int LoadZoneCollision(
     std::optional<JsonValue> json =
         JsonParse(buffer.str(), &parseError);
     if (!json || !json->IsArray())
-        return 0;
+        return collision;
 
-    ArchetypeSignature colliderSignature;
-    colliderSignature.set(world.GetComponentId<LocalTransform>());
-    colliderSignature.set(world.GetComponentId<Collider>());
-
-    int loaded = 0;
     for (const JsonValue& entry : json->AsArray())
     {
         if (!entry.IsObject())
@@ -94,12 +88,32 @@ int LoadZoneCollision(
         if (bytes.empty())
             continue;
 
-        const CollisionShapeHandle handle = cache.LoadBlob(bytes);
-        if (!handle.IsValid())
+        if (!collision.Shapes.Restore(bytes))
             continue;
+        collision.Origins.push_back(ReadOrigin(entry));
+    }
+    return collision;
+}
 
+int InstallZoneCollision(
+    World& world,
+    CollisionShapeCache& cache,
+    RestoredZoneCollision&& collision,
+    StoragePartitionId partition)
+{
+    const std::size_t count = collision.Origins.size();
+    const CollisionShapeHandle first = cache.Adopt(std::move(collision.Shapes));
+    if (!first.IsValid())
+        return 0;
+
+    ArchetypeSignature colliderSignature;
+    colliderSignature.set(world.GetComponentId<LocalTransform>());
+    colliderSignature.set(world.GetComponentId<Collider>());
+
+    for (std::size_t index = 0; index < count; ++index)
+    {
         Transform3f transform;
-        transform.Position = ReadOrigin(entry);
+        transform.Position = collision.Origins[index];
 
         const EntityId entity = world.CreateEntityWithSignature(
             partition,
@@ -107,9 +121,23 @@ int LoadZoneCollision(
         *world.TryGet<LocalTransform>(entity) =
             LocalTransform{ transform };
         Collider collider;
-        collider.Mesh = handle;
+        collider.Mesh = CollisionShapeHandle{
+            first.Value + static_cast<uint32_t>(index) };
         *world.TryGet<Collider>(entity) = collider;
-        ++loaded;
     }
-    return loaded;
+    return static_cast<int>(count);
+}
+
+int LoadZoneCollision(
+    World& world,
+    CollisionShapeCache& cache,
+    const std::string& sidecarPath,
+    const std::string& cookedRoot,
+    StoragePartitionId partition)
+{
+    return InstallZoneCollision(
+        world,
+        cache,
+        RestoreZoneCollision(sidecarPath, cookedRoot),
+        partition);
 }
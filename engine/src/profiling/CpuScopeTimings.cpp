@@ -8,6 +8,7 @@ const char* ToString(CpuScope scope)
     case CpuScope::LightSelection: return "Extract/Lights";
     case CpuScope::ShadowGather:   return "Extract/ShadowCasters";
     case CpuScope::ShadowResidency: return "Extract/ShadowResidency";
+    case CpuScope::TextureResidency: return "Extract/TextureResidency";
     case CpuScope::ShadowRecord:   return "Record/ShadowViews";
     case CpuScope::ForwardRecord:  return "Record/ForwardOpaque";
     case CpuScope::Count:          break;
@@ -41,6 +41,10 @@ namespace
 			{ "pipeline_switches_count", static_cast<double>(stats.PipelineSwitches) },
 			{ "material_switches_count", static_cast<double>(stats.MaterialSwitches) },
 			{ "instances_dropped_count", static_cast<double>(stats.InstancesDropped) },
+			{ "lod_reduced_items_count", static_cast<double>(stats.LodReducedItems) },
+			{ "full_detail_triangles_count", static_cast<double>(stats.FullDetailTriangles) },
+			{ "meshlets_tested_count", static_cast<double>(stats.MeshletsTested) },
+			{ "meshlets_culled_count", static_cast<double>(stats.MeshletsCulled) },
 			{ "lights_visible_count", static_cast<double>(stats.LightsVisible) },
 			{ "lights_dropped_at_cap_count", static_cast<double>(stats.LightsDroppedAtCap) },
 			{ "shadow_casting_lights_count", static_cast<double>(stats.ShadowCastingLights) },
@@ -51,6 +55,7 @@ namespace
 			{ "shadow_casters_visible_count", static_cast<double>(stats.ShadowCastersVisible) },
 			{ "shadow_casters_dropped_count", static_cast<double>(stats.ShadowCastersDropped) },
 			{ "shadow_instance_runs_count", static_cast<double>(stats.ShadowInstanceRuns) },
+			{ "shadow_meshlets_culled_count", static_cast<double>(stats.ShadowMeshletsCulled) },
 			{ "shadow_slots_held_count", static_cast<double>(stats.ShadowSlotsHeld) },
 			{ "shadow_cache_hits_count", static_cast<double>(stats.ShadowCacheHits) },
 			{ "shadow_requests_denied_count", static_cast<double>(stats.ShadowRequestsDenied) },
@@ -61,6 +66,16 @@ namespace
 			{ "shadow_tile_bytes", static_cast<double>(stats.ShadowTileBytes) },
 			{ "caster_diff_events_count", static_cast<double>(stats.CasterDiffEvents) },
 			{ "probe_volumes_resident_count", static_cast<double>(stats.ProbeVolumesResident) },
+			{ "textures_streamed_count", static_cast<double>(stats.TexturesStreamed) },
+			{ "texture_resident_bytes", static_cast<double>(stats.TextureResidentBytes) },
+			{ "texture_budget_bytes", static_cast<double>(stats.TextureBudgetBytes) },
+			{ "texture_mips_requested_count", static_cast<double>(stats.TextureMipsRequested) },
+			{ "texture_mips_resident_count", static_cast<double>(stats.TextureMipsResident) },
+			{ "textures_pending_count", static_cast<double>(stats.TexturesPending) },
+			{ "texture_promotions_count", static_cast<double>(stats.TexturePromotions) },
+			{ "texture_evictions_count", static_cast<double>(stats.TextureEvictions) },
+			{ "texture_upload_bytes", static_cast<double>(stats.TextureUploadBytes) },
+			{ "texture_stream_latency_ms", static_cast<double>(stats.TextureStreamLatencyUs) / 1000.0 },
 			{ "scratch_high_water_bytes", static_cast<double>(stats.ScratchHighWaterBytes) },
 			{ "scratch_used_bytes", static_cast<double>(stats.ScratchUsedBytes) },
 			{ "scratch_bytes_per_frame", static_cast<double>(stats.ScratchBytesPerFrame) },
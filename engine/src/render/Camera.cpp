@@ -81,6 +81,7 @@ bool CameraRenderDataSystem::Build(const ActiveCameraService& activeCamera,
     out.ViewProjection = projection * out.View;
     out.Position = transform->Value.Position;
     out.ViewFrustum = Frustum::FromViewProjection(out.ViewProjection);
+    out.ViewportHeight = static_cast<float>(targetExtent.height);
     // Rigs are optional vocabulary: an editor viewport camera and a bare
     // authored camera have none, and their worlds never register the type.
     out.ExcludedEntity = EntityId{};
@@ -8,6 +8,8 @@
 #include <graphics/vulkan/VulkanPipelineCache.h>
 #include <graphics/vulkan/VulkanShaderCache.h>
 #include <graphics/vulkan/VulkanSwapchainService.h>
+#include <render/static_mesh/MeshLod.h>
+#include <render/static_mesh/MeshletCulling.h>
 #include <shaders/kMeshForwardFragSpv.h>
 #include <shaders/kMeshForwardVertSpv.h>
 #ifdef SENCHA_ENABLE_RENDER_PROFILING
@@ -410,9 +412,32 @@ void MeshForwardPass::BindFrameState(const FrameContext& frame, VkDeviceSize uni
                             2, 1, &lightingSet, 0, nullptr);
 }
 
-void MeshForwardPass::DrawRuns(const FrameContext& frame, const RenderQueue& queue,
-                               StaticMeshCache& meshes, MaterialCache& materials,
-                               Vec4 tint, uint32_t streamedInstances)
+bool MeshForwardPass::CollectVisibleRanges(const CameraRenderData& camera,
+                                           const RenderQueueItem& item,
+                                           const StaticMeshSection& section,
+                                           uint32_t drawCount)
+{
+    VisibleRanges.clear();
+    // Instances of a run share one draw and so one set of ranges; coarser
+    // levels are not clustered.
+    if (drawCount != 1 || item.Lod != 0 || section.Meshlets.empty())
+    {
+        VisibleRanges.push_back(SectionLodRange(section, item.Lod));
+        return true;
+    }
+
+    MeshletCullView view = MakeMeshletCullView(camera.View, camera.Projection, item.WorldMatrix);
+    view.CullBackfaces = view.CullBackfaces
+        && (item.Pipeline == OpaquePipelineId::StandardLitBack
+            || item.Pipeline == OpaquePipelineId::UnlitBack);
+    LastStats.MeshletsTested += static_cast<uint32_t>(section.Meshlets.size());
+    LastStats.MeshletsCulled += CullMeshlets(section.Meshlets, view, VisibleRanges);
+    return !VisibleRanges.empty();
+}
+
+void MeshForwardPass::DrawRuns(const FrameContext& frame, const CameraRenderData& camera,
+                               const RenderQueue& queue, StaticMeshCache& meshes,
+                               MaterialCache& materials, Vec4 tint, uint32_t streamedInstances)
 {
     const std::vector<RenderQueueItem>& items = queue.Opaque();
     const std::vector<uint32_t>& order = queue.OpaqueOrder();
@@ -453,6 +478,11 @@ void MeshForwardPass::DrawRuns(const FrameContext& frame, const RenderQueue& que
 #endif
         if (pipelineIndex >= pipelineCount)
             continue;
+        const StaticMeshSection& section = mesh->Sections[item.SectionIndex];
+        // Culled before any state is bound: a run with nothing in view costs
+        // no commands at all.
+        if (!CollectVisibleRanges(camera, item, section, drawCount))
+            continue;
         const VkPipeline pipeline = pipelineSet[pipelineIndex];
         if (pipeline != lastPipeline)
         {
@@ -461,7 +491,6 @@ void MeshForwardPass::DrawRuns(const FrameContext& frame, const RenderQueue& que
             ++LastStats.PipelineSwitches;
         }
 
-        const StaticMeshSection& section = mesh->Sections[item.SectionIndex];
         const VkBuffer vertexBuffer = Buffers->GetBuffer(mesh->VertexBuffer);
         const VkBuffer indexBuffer = Buffers->GetBuffer(mesh->IndexBuffer);
 
@@ -499,10 +528,13 @@ void MeshForwardPass::DrawRuns(const FrameContext& frame, const RenderQueue& que
                            VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
                            0, sizeof(push), &push);
         ++LastStats.MaterialSwitches;
-        vkCmdDrawIndexed(frame.Cmd, section.IndexCount, drawCount,
-                         section.IndexOffset, 0, run.First);
-        ++LastStats.DrawCalls;
-        LastStats.Triangles += section.IndexCount / 3u * drawCount;
+        for (const MeshIndexRange& range : VisibleRanges)
+        {
+            vkCmdDrawIndexed(frame.Cmd, range.IndexCount, drawCount,
+                             range.IndexOffset, 0, run.First);
+            ++LastStats.DrawCalls;
+            LastStats.Triangles += range.IndexCount / 3u * drawCount;
+        }
     }
 }
 
@@ -571,7 +603,7 @@ void MeshForwardPass::Draw(const FrameContext& frame,
         vkCmdClearAttachments(frame.Cmd, 1, &clear, 1, &rect);
     }
 #endif
-    DrawRuns(frame, queue, meshes, materials, tint, streamed);
+    DrawRuns(frame, camera, queue, meshes, materials, tint, streamed);
 }
 
 void MeshForwardPass::Teardown()
@@ -71,6 +71,8 @@ void MeshRenderFeature::OnDraw(const FrameContext& frame)
         out.PipelineSwitches = stats.PipelineSwitches;
         out.MaterialSwitches = stats.MaterialSwitches;
         out.InstancesDropped = stats.InstancesDropped;
+        out.MeshletsTested = stats.MeshletsTested;
+        out.MeshletsCulled = stats.MeshletsCulled;
         if (stats.Skipped)
             ++out.PassesSkipped;
     }
@@ -3,6 +3,7 @@
 #include <core/logging/LoggingProvider.h>
 #include <graphics/vulkan/VulkanImageService.h>
 #include <world/RuntimeWorld.h>
+#include <world/serialization/SceneFormat.h>
 
 #include <algorithm>
 #include <fstream>
@@ -177,11 +178,10 @@ std::size_t ProbeVolumeSet::ResidentVolumeCount() const
 bool ReadZoneProbeFile(const std::string& cookedScenePath, ProbeVolumeFile& out)
 {
     out.Volumes.clear();
-    constexpr std::string_view cookedSuffix = ".cooked.json";
-    if (!cookedScenePath.ends_with(cookedSuffix))
+    if (!cookedScenePath.ends_with(CookedSceneSuffix))
         return false;
     std::string probePath =
-        cookedScenePath.substr(0, cookedScenePath.size() - cookedSuffix.size());
+        cookedScenePath.substr(0, cookedScenePath.size() - CookedSceneSuffix.size());
     probePath += "/probes.sprobe";
 
     std::ifstream stream(probePath, std::ios::binary);
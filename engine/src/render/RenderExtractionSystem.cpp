@@ -6,9 +6,13 @@
 #include <render/ZoneLightmapComponent.h>
 
 #include <algorithm>
+#include <cmath>
 
 namespace
 {
+// Nearer than this, an entity's LOD projects as if it sat here.
+constexpr float kMinLodDepth = 1.0e-3f;
+
 std::size_t TableSlot(StoragePartitionId partition)
 {
     return static_cast<std::size_t>(partition.Value);
@@ -79,6 +83,39 @@ ZoneLightmapIndices LookupZoneLightmap(
     return slot < table.size() ? table[slot] : ZoneLightmapIndices{};
 }
 
+std::vector<RenderExtractionSystem::LodState>& RenderExtractionSystem::LodStatesFor(
+    EntityId camera)
+{
+    ++ExtractCount;
+    for (ViewLodStates& view : LodViews)
+    {
+        if (view.Camera == camera)
+        {
+            view.LastExtract = ExtractCount;
+            return view.States;
+        }
+    }
+
+    if (LodViews.size() < kMaxLodViews)
+    {
+        LodViews.push_back(ViewLodStates{ .Camera = camera, .LastExtract = ExtractCount, .States = {} });
+        return LodViews.back().States;
+    }
+
+    // The view extracted least recently is the one most likely gone; its
+    // table is reused, capacity and all, and starts fresh.
+    ViewLodStates& recycled = *std::min_element(
+        LodViews.begin(), LodViews.end(),
+        [](const ViewLodStates& a, const ViewLodStates& b)
+        {
+            return a.LastExtract < b.LastExtract;
+        });
+    recycled.Camera = camera;
+    recycled.LastExtract = ExtractCount;
+    recycled.States.clear();
+    return recycled.States;
+}
+
 void RenderExtractionSystem::Extract(
     const World& world,
     const StoragePartitionSet& partitions,
@@ -88,8 +125,12 @@ void RenderExtractionSystem::Extract(
     const CameraRenderData& camera,
     RenderQueue& queue,
     const TextureCache* textures,
-    double interpolationAlpha)
+    double interpolationAlpha,
+    TextureStreamingDemand* textureDemand,
+    const MeshLodPolicy& lodPolicy)
 {
+    LastLodStats = {};
+
     if (!world.IsRegistered<WorldTransform>()
         || !world.IsRegistered<StaticMeshComponent>())
     {
@@ -129,6 +170,41 @@ void RenderExtractionSystem::Extract(
         LastWorld = &world;
     }
 
+    // Pixels one world unit spans at unit depth under a perspective projection,
+    // or anywhere under an orthographic one (TextureStreamingDemand's latch).
+    const bool orthographic = camera.Projection[3][3] != 0.0f;
+    const float pixelScale =
+        std::abs(camera.Projection[1][1]) * 0.5f * camera.ViewportHeight;
+
+    std::vector<LodState>& lodStates = LodStatesFor(camera.Entity);
+    const auto selectLod = [&](EntityId entity, const GpuStaticMesh& mesh,
+                               const Transform3f& pose, const Aabb3d& worldBounds,
+                               float cameraDepth) -> uint32_t
+    {
+        if (mesh.LodErrors.size() <= 1)
+            return 0;
+
+        // Errors are in mesh units; the largest axis scale bounds how far they
+        // stretch in the world. Depth is taken at the near side of the bounds,
+        // so a mesh the camera stands inside draws at full detail.
+        const float scale = std::max({ std::abs(pose.Scale.X),
+                                       std::abs(pose.Scale.Y),
+                                       std::abs(pose.Scale.Z) });
+        const float nearDepth = std::max(
+            cameraDepth - worldBounds.Size().Magnitude() * 0.5f, kMinLodDepth);
+        const float pixelsPerUnit = orthographic
+            ? pixelScale * scale
+            : pixelScale * scale / nearDepth;
+
+        if (entity.Index >= lodStates.size())
+            lodStates.resize(static_cast<std::size_t>(entity.Index) + 1);
+        LodState& state = lodStates[entity.Index];
+        if (state.Generation != entity.Generation)
+            state = LodState{ .Generation = entity.Generation };
+        state.Level = SelectMeshLod(mesh.LodErrors, pixelsPerUnit, state.Level, lodPolicy);
+        return state.Level;
+    };
+
     // Whether an entity carries pose history is an archetype property, so the
     // two paths are separate chunk walks rather than a per-entity branch.
     const auto emitChunk = [&](auto& view, auto&& poseAt)
@@ -155,7 +231,8 @@ void RenderExtractionSystem::Extract(
                 continue;
             }
 
-            const Mat4 worldMatrix = poseAt(i).ToMat4();
+            const Transform3f pose = poseAt(i);
+            const Mat4 worldMatrix = pose.ToMat4();
             const Aabb3d worldBounds =
                 TransformBounds(mesh->LocalBounds, worldMatrix);
             if (!camera.ViewFrustum.IntersectsAabb(worldBounds))
@@ -167,6 +244,22 @@ void RenderExtractionSystem::Extract(
                 worldBounds.Center().Z,
                 1.0f);
             const float cameraDepth = -cameraSpaceCenter.Z;
+            const float screenPixels = textureDemand != nullptr
+                ? textureDemand->ProjectedPixels(worldBounds.Size().Magnitude(), cameraDepth)
+                : 0.0f;
+            if (textureDemand != nullptr && lightmap.Lightmap != UINT32_MAX)
+            {
+                // The mesh covers only its scale-bias rectangle of the zone's
+                // atlas, so the whole atlas is wanted that much larger.
+                const float atlasCoverage = std::max(
+                    std::max(renderer.LightmapScaleBias.X, renderer.LightmapScaleBias.Y),
+                    1.0e-3f);
+                textureDemand->Note(lightmap.Lightmap, screenPixels / atlasCoverage);
+                textureDemand->Note(lightmap.Ao, screenPixels / atlasCoverage);
+            }
+
+            const uint32_t lod = selectLod(
+                view.Entity(i), *mesh, pose, worldBounds, cameraDepth);
 
             for (uint32_t sectionIndex = 0;
                  sectionIndex < static_cast<uint32_t>(mesh->Sections.size());
@@ -175,8 +268,8 @@ void RenderExtractionSystem::Extract(
                 if ((renderer.SectionMask & (1u << sectionIndex)) == 0)
                     continue;
 
-                const uint32_t slot =
-                    mesh->Sections[sectionIndex].MaterialSlot;
+                const StaticMeshSection& section = mesh->Sections[sectionIndex];
+                const uint32_t slot = section.MaterialSlot;
                 const MaterialHandle materialHandle =
                     slot < sectionMaterials->size()
                         ? (*sectionMaterials)[slot]
@@ -189,6 +282,7 @@ void RenderExtractionSystem::Extract(
                 item.Mesh = renderer.Mesh;
                 item.Material = materialHandle;
                 item.SectionIndex = sectionIndex;
+                item.Lod = ClampSectionLod(section, lod);
                 item.WorldMatrix = worldMatrix;
                 item.WorldBounds = worldBounds;
                 item.CameraDepth = cameraDepth;
@@ -198,6 +292,18 @@ void RenderExtractionSystem::Extract(
                 item.AoTextureIndex = lightmap.Ao;
                 item.LightmapScaleBias = renderer.LightmapScaleBias;
                 queue.AddOpaque(item);
+
+                LastLodStats.FullDetailTriangles += section.IndexCount / 3u;
+                if (item.Lod != 0)
+                    ++LastLodStats.ReducedItems;
+
+                if (textureDemand != nullptr)
+                {
+                    textureDemand->Note(material->BaseColorTextureIndex, screenPixels);
+                    textureDemand->Note(material->NormalTextureIndex, screenPixels);
+                    textureDemand->Note(material->OrmTextureIndex, screenPixels);
+                    textureDemand->Note(material->EmissiveTextureIndex, screenPixels);
+                }
             }
         }
     };
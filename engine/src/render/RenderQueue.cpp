@@ -6,7 +6,7 @@
 uint64_t BuildOpaqueSortKey(const RenderQueueItem& item)
 {
     // Key layout (MSB -> LSB):
-    // [8b pass][2b pipeline][14b material][20b mesh][4b section][16b depth]
+    // [8b pass][2b pipeline][14b material][20b mesh][4b section][3b lod][13b depth]
     uint32_t depthBits = 0;
     std::memcpy(&depthBits, &item.CameraDepth, sizeof(depthBits));
     return (static_cast<uint64_t>(item.Pass) << 56)
@@ -14,7 +14,8 @@ uint64_t BuildOpaqueSortKey(const RenderQueueItem& item)
          | (static_cast<uint64_t>(SlotIndex(item.Material) & 0x3FFFu) << 40)
          | (static_cast<uint64_t>(SlotIndex(item.Mesh) & 0xFFFFFu) << 20)
          | (static_cast<uint64_t>(item.SectionIndex & 0xFu) << 16)
-         | (depthBits >> 16);
+         | (static_cast<uint64_t>(item.Lod & 0x7u) << 13)
+         | (depthBits >> 19);
 }
 
 void RenderQueue::Reset()
@@ -56,6 +57,7 @@ void RenderQueue::SortOpaque()
             if (item.Pipeline == head.Pipeline
                 && item.Mesh == head.Mesh
                 && item.SectionIndex == head.SectionIndex
+                && item.Lod == head.Lod
                 && item.Material == head.Material
                 && item.Pass == head.Pass
                 && item.LightmapTextureIndex == head.LightmapTextureIndex
@@ -5,6 +5,7 @@
 #include <graphics/vulkan/VulkanFrameScratch.h>
 #include <graphics/vulkan/VulkanPipelineCache.h>
 #include <math/geometry/3d/Frustum.h>
+#include <render/static_mesh/MeshletCulling.h>
 #include <shaders/kShadowDepthFragSpv.h>
 #include <shaders/kShadowDepthVertSpv.h>
 
@@ -316,6 +317,26 @@ bool ShadowDepthPass::RecordView(const FrameContext& frame,
         const GpuStaticMesh* mesh = meshes.Get(lead.Mesh);
         const StaticMeshSection& section = mesh->Sections[lead.SectionIndex];
 
+        // A lone caster draws only the meshlets inside the view. Frustum
+        // only: the back-face cone test is left to the camera pass.
+        VisibleRanges.clear();
+        if (last - first == 1 && !section.Meshlets.empty())
+        {
+            LastStats.MeshletsCulled += CullMeshlets(
+                section.Meshlets, MakeMeshletCullView(viewProjection, lead.WorldMatrix),
+                VisibleRanges);
+            if (VisibleRanges.empty())
+            {
+                first = last;
+                continue;
+            }
+        }
+        else
+        {
+            VisibleRanges.push_back({ .IndexOffset = section.IndexOffset,
+                                      .IndexCount = section.IndexCount });
+        }
+
         const VkPipeline pipeline = lead.DoubleSided
             ? DoubleSidedPipeline
             : (flipFrontFace ? FlippedBackPipeline : BackPipeline);
@@ -339,8 +360,11 @@ bool ShadowDepthPass::RecordView(const FrameContext& frame,
             LastIndexBuffer = indexBuffer;
         }
 
-        vkCmdDrawIndexed(frame.Cmd, section.IndexCount, last - first,
-                         section.IndexOffset, 0, first);
+        for (const MeshIndexRange& range : VisibleRanges)
+        {
+            vkCmdDrawIndexed(frame.Cmd, range.IndexCount, last - first,
+                             range.IndexOffset, 0, first);
+        }
         ++LastStats.CasterDraws;
         ++LastStats.InstanceRuns;
         first = last;
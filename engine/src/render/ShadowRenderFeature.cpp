@@ -86,6 +86,7 @@ void ShadowRenderFeature::OnDraw(const FrameContext& frame)
         Instrumentation->Stats->ShadowCastersVisible = stats.CastersVisible;
         Instrumentation->Stats->ShadowCastersDropped = stats.CastersDropped;
         Instrumentation->Stats->ShadowInstanceRuns = stats.InstanceRuns;
+        Instrumentation->Stats->ShadowMeshletsCulled = stats.MeshletsCulled;
         if (stats.Skipped)
             ++Instrumentation->Stats->PassesSkipped;
     }
@@ -26,5 +26,5 @@ bool ValidateTextureData(const TextureData& texture)
         expectedHeight = expectedHeight > 1 ? expectedHeight / 2 : 1;
     }
 
-    return expectedOffset == texture.Blob.size();
+    return expectedOffset == texture.Pixels().size();
 }
@@ -0,0 +1,366 @@
+#include <render/TextureResidency.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    // Closest a draw's center may sit to the camera for sizing purposes; a
+    // camera inside the bounds wants the top level, not a division by zero.
+    constexpr float kMinProjectedDepth = 1.0e-3f;
+}
+
+std::uint32_t TextureMipTailTopMip(std::span<const TextureMipLevel> mips,
+                                   std::uint32_t tailExtent)
+{
+    for (std::uint32_t level = 0; level < mips.size(); ++level)
+    {
+        if (std::max(mips[level].Width, mips[level].Height) <= tailExtent)
+            return level;
+    }
+    return mips.empty() ? 0 : static_cast<std::uint32_t>(mips.size() - 1);
+}
+
+std::uint32_t TextureDesiredTopMip(std::uint32_t width,
+                                   std::uint32_t height,
+                                   std::uint32_t mipCount,
+                                   float screenPixels)
+{
+    if (mipCount == 0)
+        return 0;
+    const std::uint32_t lastLevel = mipCount - 1;
+    if (!(screenPixels > 0.0f))
+        return lastLevel;
+
+    const float ratio = static_cast<float>(std::max(width, height)) / screenPixels;
+    if (ratio <= 1.0f)
+        return 0;
+    const auto level = static_cast<std::uint32_t>(std::floor(std::log2(ratio)));
+    return std::min(level, lastLevel);
+}
+
+// -- TextureStreamingDemand ---------------------------------------------------
+
+void TextureStreamingDemand::BeginFrame(const Mat4& projection, float viewportHeight)
+{
+    for (std::uint32_t texture : Noted)
+        Pixels[texture] = 0.0f;
+    Noted.clear();
+
+    // Perspective projections carry w = -z in the last row, orthographic ones
+    // a constant 1. The y scale maps half the view height to one NDC unit.
+    Orthographic = projection[3][3] != 0.0f;
+    PixelScale = std::abs(projection[1][1]) * 0.5f * viewportHeight;
+}
+
+float TextureStreamingDemand::ProjectedPixels(float worldDiameter, float cameraDepth) const
+{
+    if (Orthographic)
+        return worldDiameter * PixelScale;
+    return worldDiameter * PixelScale / std::max(cameraDepth, kMinProjectedDepth);
+}
+
+void TextureStreamingDemand::Note(std::uint32_t texture, float screenPixels)
+{
+    if (texture == UINT32_MAX || !(screenPixels > 0.0f))
+        return;
+
+    if (texture >= Pixels.size())
+        Pixels.resize(static_cast<std::size_t>(texture) + 1, 0.0f);
+    if (Pixels[texture] == 0.0f)
+        Noted.push_back(texture);
+    Pixels[texture] = std::max(Pixels[texture], screenPixels);
+}
+
+float TextureStreamingDemand::ScreenPixels(std::uint32_t texture) const
+{
+    return texture < Pixels.size() ? Pixels[texture] : 0.0f;
+}
+
+// -- TextureResidency ---------------------------------------------------------
+
+void TextureResidency::Track(std::uint32_t texture, std::span<const TextureMipLevel> mips,
+                             std::uint32_t residentTopMip, std::uint32_t tailTopMip)
+{
+    if (mips.empty())
+        return;
+
+    Untrack(texture);
+    if (texture >= Entries.size())
+        Entries.resize(static_cast<std::size_t>(texture) + 1);
+
+    const auto lastLevel = static_cast<std::uint32_t>(mips.size() - 1);
+    Entry& entry = Entries[texture];
+    entry.Live = true;
+    entry.Width = mips.front().Width;
+    entry.Height = mips.front().Height;
+    entry.LevelBytes.clear();
+    for (const TextureMipLevel& mip : mips)
+        entry.LevelBytes.push_back(mip.ByteSize);
+    entry.TailTopMip = std::min(tailTopMip, lastLevel);
+    entry.ResidentTopMip = std::min(residentTopMip, lastLevel);
+    entry.WantedTopMip = entry.TailTopMip;
+    entry.FrameStartTopMip = entry.ResidentTopMip;
+    entry.LastSeenFrame = FrameNumber;
+    ResidentBytes += ChainBytes(entry, entry.ResidentTopMip);
+}
+
+void TextureResidency::Untrack(std::uint32_t texture)
+{
+    if (!IsTracked(texture))
+        return;
+
+    Entry& entry = Entries[texture];
+    ResidentBytes -= ChainBytes(entry, entry.ResidentTopMip);
+    entry = Entry{};
+}
+
+bool TextureResidency::IsTracked(std::uint32_t texture) const
+{
+    return texture < Entries.size() && Entries[texture].Live;
+}
+
+std::uint32_t TextureResidency::ResidentTopMip(std::uint32_t texture) const
+{
+    return IsTracked(texture) ? Entries[texture].ResidentTopMip : 0;
+}
+
+void TextureResidency::Update(const TextureStreamingDemand& demand,
+                              const TextureStreamingBudgets& budgets,
+                              double nowMs)
+{
+    ++FrameNumber;
+    FrameChanges.clear();
+    UploadedBytes = 0;
+
+    for (std::uint32_t index = 0; index < Entries.size(); ++index)
+    {
+        Entry& entry = Entries[index];
+        if (!entry.Live)
+            continue;
+
+        entry.FrameStartTopMip = entry.ResidentTopMip;
+        entry.ScreenPixels = demand.ScreenPixels(index);
+        if (entry.ScreenPixels > 0.0f)
+        {
+            entry.LastSeenFrame = FrameNumber;
+            entry.WantedTopMip = std::min(
+                TextureDesiredTopMip(entry.Width, entry.Height,
+                                     static_cast<std::uint32_t>(entry.LevelBytes.size()),
+                                     entry.ScreenPixels),
+                entry.TailTopMip);
+        }
+        else
+        {
+            entry.WantedTopMip = entry.TailTopMip;
+        }
+
+        if (entry.WantedTopMip < entry.ResidentTopMip)
+        {
+            if (!entry.Waiting)
+            {
+                entry.Waiting = true;
+                entry.WaitingSinceMs = nowMs;
+            }
+        }
+        else
+        {
+            entry.Waiting = false;
+        }
+    }
+
+    if (budgets.ResidentBytes > 0 && ResidentBytes > budgets.ResidentBytes)
+        (void)ShedSurplus(ResidentBytes - budgets.ResidentBytes, UINT32_MAX);
+
+    Candidates.clear();
+    for (std::uint32_t index = 0; index < Entries.size(); ++index)
+    {
+        if (Entries[index].Live && Entries[index].WantedTopMip < Entries[index].ResidentTopMip)
+            Candidates.push_back(index);
+    }
+    std::sort(Candidates.begin(), Candidates.end(), [this](std::uint32_t a, std::uint32_t b)
+    {
+        const Entry& lhs = Entries[a];
+        const Entry& rhs = Entries[b];
+        const std::uint32_t lhsDeficit = lhs.ResidentTopMip - lhs.WantedTopMip;
+        const std::uint32_t rhsDeficit = rhs.ResidentTopMip - rhs.WantedTopMip;
+        if (lhsDeficit != rhsDeficit)
+            return lhsDeficit > rhsDeficit;
+        if (lhs.ScreenPixels != rhs.ScreenPixels)
+            return lhs.ScreenPixels > rhs.ScreenPixels;
+        return a < b;
+    });
+
+    std::uint32_t served = 0;
+    for (std::uint32_t index : Candidates)
+    {
+        Entry& entry = Entries[index];
+        std::uint32_t target = entry.WantedTopMip;
+
+        // A promotion rebuilds the whole chain it will hold, so that is what
+        // it costs against the upload clamp. The first one always runs.
+        if (budgets.UploadBytesPerFrame > 0 && served > 0)
+        {
+            while (target < entry.ResidentTopMip
+                   && UploadedBytes + ChainBytes(entry, target) > budgets.UploadBytesPerFrame)
+            {
+                ++target;
+            }
+        }
+
+        if (budgets.ResidentBytes > 0)
+        {
+            const std::uint64_t growth =
+                ChainBytes(entry, target) - ChainBytes(entry, entry.ResidentTopMip);
+            if (ResidentBytes + growth > budgets.ResidentBytes)
+                (void)ShedSurplus(ResidentBytes + growth - budgets.ResidentBytes, index);
+            while (target < entry.ResidentTopMip
+                   && ResidentBytes + ChainBytes(entry, target)
+                          - ChainBytes(entry, entry.ResidentTopMip) > budgets.ResidentBytes)
+            {
+                ++target;
+            }
+        }
+
+        if (target >= entry.ResidentTopMip)
+            continue;
+
+        ResidentBytes += ChainBytes(entry, target) - ChainBytes(entry, entry.ResidentTopMip);
+        UploadedBytes += ChainBytes(entry, target);
+        entry.ResidentTopMip = target;
+        ++served;
+        RecordChange(index);
+
+        if (entry.ResidentTopMip <= entry.WantedTopMip)
+        {
+            entry.Waiting = false;
+            LastLatencyMs = nowMs - entry.WaitingSinceMs;
+        }
+    }
+
+    BuildStats(budgets.ResidentBytes);
+}
+
+void TextureResidency::MarkChangeFailed(std::uint32_t texture)
+{
+    if (!IsTracked(texture))
+        return;
+
+    Entry& entry = Entries[texture];
+    if (entry.ResidentTopMip == entry.FrameStartTopMip)
+        return;
+
+    UploadedBytes -= std::min(UploadedBytes, ChainBytes(entry, entry.ResidentTopMip));
+    ResidentBytes -= ChainBytes(entry, entry.ResidentTopMip);
+    ResidentBytes += ChainBytes(entry, entry.FrameStartTopMip);
+    entry.ResidentTopMip = entry.FrameStartTopMip;
+    entry.Waiting = entry.WantedTopMip < entry.ResidentTopMip;
+    BuildStats(Stats.BudgetBytes);
+}
+
+void TextureResidency::Reset()
+{
+    Entries.clear();
+    FrameChanges.clear();
+    Candidates.clear();
+    Victims.clear();
+    Stats = TextureStreamingFrameStats{};
+    ResidentBytes = 0;
+    UploadedBytes = 0;
+    FrameNumber = 0;
+    LastLatencyMs = 0.0;
+}
+
+std::uint64_t TextureResidency::ChainBytes(const Entry& entry, std::uint32_t topMip)
+{
+    std::uint64_t bytes = 0;
+    for (std::size_t level = topMip; level < entry.LevelBytes.size(); ++level)
+        bytes += entry.LevelBytes[level];
+    return bytes;
+}
+
+std::uint64_t TextureResidency::ShedSurplus(std::uint64_t bytesNeeded, std::uint32_t protect)
+{
+    Victims.clear();
+    for (std::uint32_t index = 0; index < Entries.size(); ++index)
+    {
+        const Entry& entry = Entries[index];
+        if (entry.Live && index != protect && entry.ResidentTopMip < entry.WantedTopMip)
+            Victims.push_back(index);
+    }
+    std::sort(Victims.begin(), Victims.end(), [this](std::uint32_t a, std::uint32_t b)
+    {
+        const Entry& lhs = Entries[a];
+        const Entry& rhs = Entries[b];
+        if (lhs.LastSeenFrame != rhs.LastSeenFrame)
+            return lhs.LastSeenFrame < rhs.LastSeenFrame;
+        const std::uint32_t lhsSurplus = lhs.WantedTopMip - lhs.ResidentTopMip;
+        const std::uint32_t rhsSurplus = rhs.WantedTopMip - rhs.ResidentTopMip;
+        if (lhsSurplus != rhsSurplus)
+            return lhsSurplus > rhsSurplus;
+        return a < b;
+    });
+
+    std::uint64_t freed = 0;
+    for (std::uint32_t index : Victims)
+    {
+        Entry& entry = Entries[index];
+        while (freed < bytesNeeded && entry.ResidentTopMip < entry.WantedTopMip)
+        {
+            freed += entry.LevelBytes[entry.ResidentTopMip];
+            ResidentBytes -= entry.LevelBytes[entry.ResidentTopMip];
+            ++entry.ResidentTopMip;
+        }
+        if (entry.ResidentTopMip != entry.FrameStartTopMip)
+        {
+            UploadedBytes += ChainBytes(entry, entry.ResidentTopMip);
+            RecordChange(index);
+        }
+        if (freed >= bytesNeeded)
+            break;
+    }
+    return freed;
+}
+
+void TextureResidency::RecordChange(std::uint32_t texture)
+{
+    const Entry& entry = Entries[texture];
+    for (TextureMipChange& change : FrameChanges)
+    {
+        if (change.Texture == texture)
+        {
+            change.ToTopMip = entry.ResidentTopMip;
+            return;
+        }
+    }
+    FrameChanges.push_back(TextureMipChange{
+        .Texture = texture,
+        .FromTopMip = entry.FrameStartTopMip,
+        .ToTopMip = entry.ResidentTopMip,
+    });
+}
+
+void TextureResidency::BuildStats(std::uint64_t budgetBytes)
+{
+    Stats = TextureStreamingFrameStats{};
+    Stats.BudgetBytes = budgetBytes;
+    Stats.ResidentBytes = ResidentBytes;
+    Stats.UploadedBytes = UploadedBytes;
+    Stats.LastLatencyMs = LastLatencyMs;
+    for (const Entry& entry : Entries)
+    {
+        if (!entry.Live)
+            continue;
+
+        const auto levels = static_cast<std::uint32_t>(entry.LevelBytes.size());
+        ++Stats.StreamedTextures;
+        Stats.RequestedMips += levels - entry.WantedTopMip;
+        Stats.ResidentMips += levels - entry.ResidentTopMip;
+        if (entry.WantedTopMip < entry.ResidentTopMip)
+            ++Stats.PendingTextures;
+        if (entry.ResidentTopMip < entry.FrameStartTopMip)
+            ++Stats.Promotions;
+        else if (entry.ResidentTopMip > entry.FrameStartTopMip)
+            ++Stats.Evictions;
+    }
+}
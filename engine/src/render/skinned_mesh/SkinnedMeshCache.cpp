@@ -94,3 +94,13 @@ bool SkinnedMeshCache::IsEntryLive(const SkinnedMeshEntry& entry) const
 {
     return entry.Alive;
 }
+
+AssetFootprint SkinnedMeshCache::WarmFootprint(const SkinnedMeshEntry& entry) const
+{
+    // The skeleton the entry retains stays live, not parked; it is counted by
+    // its own cache when it is finally released.
+    return {
+        .CpuBytes = sizeof(MeshSkinInfluence) * entry.Skinning.Influences.size(),
+        .GpuBytes = GpuMeshByteSize(entry.Mesh),
+    };
+}
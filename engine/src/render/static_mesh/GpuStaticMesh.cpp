@@ -1,6 +1,7 @@
 #include <render/static_mesh/GpuStaticMesh.h>
 
 #include <core/logging/Logger.h>
+#include <render/static_mesh/MeshLod.h>
 #include <render/static_mesh/MeshValidation.h>
 
 bool UploadMeshGeometryToGpu(VulkanBufferService& buffers,
@@ -52,6 +53,7 @@ bool UploadMeshGeometryToGpu(VulkanBufferService& buffers,
         .IndexCount = static_cast<uint32_t>(geometry.Indices.size()),
         .LocalBounds = geometry.LocalBounds,
         .Sections = geometry.Sections,
+        .LodErrors = ComputeMeshLodErrors(geometry.Sections),
     };
     return true;
 }
@@ -64,3 +66,9 @@ void DestroyGpuMesh(VulkanBufferService& buffers, GpuStaticMesh& mesh)
         buffers.Destroy(mesh.IndexBuffer);
     mesh = {};
 }
+
+uint64_t GpuMeshByteSize(const GpuStaticMesh& mesh)
+{
+    return sizeof(StaticMeshVertex) * static_cast<uint64_t>(mesh.VertexCount)
+        + sizeof(uint32_t) * static_cast<uint64_t>(mesh.IndexCount);
+}
@@ -0,0 +1,69 @@
+#include <render/static_mesh/MeshLod.h>
+
+#include <algorithm>
+
+std::vector<float> ComputeMeshLodErrors(std::span<const StaticMeshSection> sections)
+{
+    std::size_t levels = 1;
+    for (const StaticMeshSection& section : sections)
+        levels = std::max(levels, section.Lods.size() + 1);
+
+    std::vector<float> errors(levels, 0.0f);
+    for (const StaticMeshSection& section : sections)
+    {
+        for (std::size_t level = 1; level < levels; ++level)
+        {
+            const std::size_t drawn = std::min(level, section.Lods.size());
+            if (drawn > 0)
+                errors[level] = std::max(errors[level], section.Lods[drawn - 1].Error);
+        }
+    }
+    return errors;
+}
+
+uint32_t ClampSectionLod(const StaticMeshSection& section, uint32_t level)
+{
+    return std::min(level, static_cast<uint32_t>(section.Lods.size()));
+}
+
+MeshIndexRange SectionLodRange(const StaticMeshSection& section, uint32_t level)
+{
+    const uint32_t drawn = ClampSectionLod(section, level);
+    if (drawn == 0)
+        return { .IndexOffset = section.IndexOffset, .IndexCount = section.IndexCount };
+    const StaticMeshLod& lod = section.Lods[drawn - 1];
+    return { .IndexOffset = lod.IndexOffset, .IndexCount = lod.IndexCount };
+}
+
+uint32_t SelectMeshLod(std::span<const float> levelErrors,
+                       float pixelsPerUnit,
+                       uint32_t current,
+                       const MeshLodPolicy& policy)
+{
+    if (levelErrors.size() <= 1 || !(pixelsPerUnit > 0.0f) || !(policy.PixelError > 0.0f))
+        return 0;
+
+    const uint32_t coarsest = static_cast<uint32_t>(levelErrors.size() - 1);
+    const auto fits = [&](uint32_t level, float budget)
+    {
+        return levelErrors[level] * pixelsPerUnit <= budget;
+    };
+
+    const float budget = policy.PixelError;
+    if (current == kNoMeshLod)
+    {
+        uint32_t level = 0;
+        while (level < coarsest && fits(level + 1, budget))
+            ++level;
+        return level;
+    }
+
+    // Refine at the budget itself, coarsen only under the tightened one.
+    const float coarsenBudget = budget * (1.0f - std::clamp(policy.Hysteresis, 0.0f, 1.0f));
+    uint32_t level = std::min(current, coarsest);
+    while (level > 0 && !fits(level, budget))
+        --level;
+    while (level < coarsest && fits(level + 1, coarsenBudget))
+        ++level;
+    return level;
+}
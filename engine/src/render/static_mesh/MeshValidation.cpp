@@ -118,6 +118,64 @@ MeshValidationResult ValidateMeshGeometry(const MeshGeometry& mesh)
                 }
             }
         }
+
+        if (section.Lods.size() > kMaxMeshLods)
+        {
+            AddError(result, "section " + std::to_string(sectionIndex) + " carries more than "
+                                 + std::to_string(kMaxMeshLods) + " LODs");
+        }
+        float previousError = 0.0f;
+        for (size_t lodIndex = 0; lodIndex < section.Lods.size(); ++lodIndex)
+        {
+            const StaticMeshLod& lod = section.Lods[lodIndex];
+            const std::string name = "section " + std::to_string(sectionIndex)
+                + " LOD " + std::to_string(lodIndex + 1);
+            const uint64_t endLodIndex = static_cast<uint64_t>(lod.IndexOffset) + lod.IndexCount;
+
+            if (lod.IndexCount == 0 || (lod.IndexCount % 3) != 0)
+                AddError(result, name + " index count must be a nonzero multiple of 3");
+            if (endLodIndex > mesh.Indices.size())
+                AddError(result, name + " index range exceeds index buffer");
+            if (!IsFinite(lod.Error) || lod.Error < previousError)
+                AddError(result, name + " error must be finite and no less than the level before");
+            previousError = lod.Error;
+
+            if (endLodIndex <= mesh.Indices.size() && endVertex <= mesh.Vertices.size())
+            {
+                for (uint64_t index = lod.IndexOffset; index < endLodIndex; ++index)
+                {
+                    const uint32_t vertexIndex = mesh.Indices[static_cast<size_t>(index)];
+                    if (vertexIndex < section.VertexOffset || vertexIndex >= endVertex)
+                    {
+                        AddError(result, name + " indices must fall within its section's vertex range");
+                        break;
+                    }
+                }
+            }
+        }
+
+        // Meshlets tile the base range in order, each whole triangles.
+        uint64_t nextMeshletIndex = section.IndexOffset;
+        for (size_t meshletIndex = 0; meshletIndex < section.Meshlets.size(); ++meshletIndex)
+        {
+            const StaticMeshMeshlet& meshlet = section.Meshlets[meshletIndex];
+            const std::string name = "section " + std::to_string(sectionIndex)
+                + " meshlet " + std::to_string(meshletIndex);
+            if (meshlet.IndexOffset != nextMeshletIndex)
+            {
+                AddError(result, name + " must start where the meshlet before it ends");
+                break;
+            }
+            if (meshlet.IndexCount == 0 || (meshlet.IndexCount % 3) != 0)
+                AddError(result, name + " index count must be a nonzero multiple of 3");
+            if (!IsFinite(meshlet.Center) || !IsFinite(meshlet.Radius) || meshlet.Radius < 0.0f)
+                AddError(result, name + " bounding sphere must be finite");
+            if (!IsFinite(meshlet.ConeAxis) || !IsFinite(meshlet.ConeCutoff) || meshlet.ConeCutoff > 1.0f)
+                AddError(result, name + " normal cone must be finite with a cutoff of at most 1");
+            nextMeshletIndex += meshlet.IndexCount;
+        }
+        if (!section.Meshlets.empty() && nextMeshletIndex != endIndex)
+            AddError(result, "section " + std::to_string(sectionIndex) + " meshlets must cover its index range");
     }
 
     return result;
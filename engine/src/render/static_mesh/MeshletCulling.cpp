@@ -0,0 +1,109 @@
+#include <render/static_mesh/MeshletCulling.h>
+
+#include <math/geometry/3d/Sphere.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    // Whether every triangle the cone holds faces away from every point of
+    // the meshlet's sphere, as seen from the view. A triangle faces away from
+    // the eye when its normal and the direction from the eye to it are less
+    // than a right angle apart; the worst case adds the cone's spread, the
+    // axis's angle to the view direction, and (in perspective) the angle the
+    // sphere subtends.
+    [[nodiscard]] bool ConeFacesAway(const StaticMeshMeshlet& meshlet, const MeshletCullView& view)
+    {
+        const float cosSpread = meshlet.ConeCutoff;
+        if (cosSpread <= 0.0f)
+            return false;
+        const float sinSpread = std::sqrt(std::max(0.0f, 1.0f - cosSpread * cosSpread));
+
+        float cosAxis = 0.0f;
+        float limit = 0.0f;
+        if (view.Orthographic)
+        {
+            cosAxis = meshlet.ConeAxis.Dot(view.Forward);
+        }
+        else
+        {
+            const Vec3d toCenter = meshlet.Center - view.Eye;
+            const float distance = toCenter.Magnitude();
+            // The eye inside the sphere sees the meshlet from every side.
+            if (distance <= meshlet.Radius)
+                return false;
+            cosAxis = meshlet.ConeAxis.Dot(toCenter) / distance;
+            limit = meshlet.Radius / distance;
+        }
+        const float sinAxis = std::sqrt(std::max(0.0f, 1.0f - cosAxis * cosAxis));
+        // cos(axis angle + spread) against sin of the subtended half-angle.
+        return cosAxis * cosSpread - sinAxis * sinSpread > limit;
+    }
+}
+
+MeshletCullView MakeMeshletCullView(const Mat4& viewProjection, const Mat4& worldMatrix)
+{
+    return MeshletCullView{
+        .LocalFrustum = Frustum::FromViewProjection(viewProjection * worldMatrix),
+    };
+}
+
+MeshletCullView MakeMeshletCullView(const Mat4& view,
+                                    const Mat4& projection,
+                                    const Mat4& worldMatrix)
+{
+    MeshletCullView result = MakeMeshletCullView(projection * view, worldMatrix);
+
+    // A mirroring transform swaps which winding faces out; rather than flip
+    // every cone, such instances keep all their meshlets.
+    if (worldMatrix.Determinant() <= 0.0f)
+        return result;
+
+    const Mat4 toLocal = worldMatrix.Inverse();
+    const Mat4 cameraToWorld = view.Inverse();
+    const Vec3d forward = toLocal.TransformVector(
+        cameraToWorld.TransformVector(Vec3d{ 0.0f, 0.0f, -1.0f }));
+    if (forward.SqrMagnitude() <= 0.0f)
+        return result;
+
+    result.CullBackfaces = true;
+    result.Orthographic = projection[3][3] != 0.0f;
+    result.Eye = toLocal.TransformPoint(cameraToWorld.TransformPoint(Vec3d::Zero()));
+    result.Forward = forward.Normalized();
+    return result;
+}
+
+bool IsMeshletVisible(const StaticMeshMeshlet& meshlet, const MeshletCullView& view)
+{
+    if (!view.LocalFrustum.IntersectsSphere(Sphere(meshlet.Center, meshlet.Radius)))
+        return false;
+    return !(view.CullBackfaces && ConeFacesAway(meshlet, view));
+}
+
+uint32_t CullMeshlets(std::span<const StaticMeshMeshlet> meshlets,
+                      const MeshletCullView& view,
+                      std::vector<MeshIndexRange>& out)
+{
+    const std::size_t firstOut = out.size();
+    uint32_t rejected = 0;
+    for (const StaticMeshMeshlet& meshlet : meshlets)
+    {
+        if (!IsMeshletVisible(meshlet, view))
+        {
+            ++rejected;
+            continue;
+        }
+        if (out.size() > firstOut)
+        {
+            MeshIndexRange& last = out.back();
+            if (last.IndexOffset + last.IndexCount == meshlet.IndexOffset)
+            {
+                last.IndexCount += meshlet.IndexCount;
+                continue;
+            }
+        }
+        out.push_back({ .IndexOffset = meshlet.IndexOffset, .IndexCount = meshlet.IndexCount });
+    }
+    return rejected;
+}
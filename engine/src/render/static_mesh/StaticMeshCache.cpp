@@ -112,6 +112,11 @@ bool StaticMeshCache::IsEntryLive(const StaticMeshEntry& entry) const
     return entry.Alive;
 }
 
+AssetFootprint StaticMeshCache::WarmFootprint(const StaticMeshEntry& entry) const
+{
+    return { .CpuBytes = 0, .GpuBytes = GpuMeshByteSize(entry.Mesh) };
+}
+
 bool StaticMeshCache::UploadMesh(const MeshGeometry& data, StaticMeshEntry& out)
 {
     if (!UploadMeshGeometryToGpu(*Buffers, data, out.Mesh, Log))
@@ -1,10 +1,10 @@
 #include <world/RuntimeWorld.h>
 
 #include <components/ActiveCameraService.h>
-#include <ecs/Query.h>
 #include <ecs/WorldComponentSchema.h>
+#include <jobs/AsyncTaskQueue.h>
 #include <world/identity/PersistentEntityIndex.h>
-#include <world/identity/PersistentIdComponent.h>
+#include <zone/ZoneDetachCapture.h>
 #include <zone/ZoneStateStore.h>
 
 #include <vector>
@@ -12,6 +12,35 @@
 #include <algorithm>
 #include <cassert>
 #include <limits>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+// One zone's detach capture between the owner-thread detach and the commit.
+// Everything the diff reads is owned here, so whichever thread runs it first
+// holds the mutex only against the other runner, never against the World.
+struct RuntimeWorld::PendingDetachCapture
+{
+    ZoneId Zone;
+    std::mutex Mutex;
+    ZoneStateBaseline Baseline;
+    DetachedPartition Rows;
+    ZoneDetachColumns Columns;
+    std::optional<ZoneDetachCapture> Result;
+    // Committed, or dropped with the RuntimeWorld; either way the commit
+    // callback has nothing left to do.
+    bool Settled = false;
+
+    // Caller holds Mutex. The slabs are released where the diff ran.
+    void Run()
+    {
+        if (Result.has_value())
+            return;
+        Result = CaptureZoneDetach(Baseline, Rows, Columns);
+        Rows = {};
+        Baseline = {};
+    }
+};
 
 RuntimeWorld::RuntimeWorld(const WorldComponentSchema& schema)
 {
@@ -48,6 +77,13 @@ RuntimeWorld::~RuntimeWorld()
     assert(!ResidencyProcessing_
            && "RuntimeWorld destroyed during ZoneResidency processing");
 
+    // A commit the queue still holds must not reach a store that is gone.
+    for (const std::shared_ptr<PendingDetachCapture>& job : PendingCaptures_)
+    {
+        const std::lock_guard lock(job->Mutex);
+        job->Settled = true;
+    }
+
     // Shutdown follows the same lifetime order as explicit detachment: entity
     // hooks run while simulation-scoped World resources and zone resources are
     // alive, then zone-scoped resources are destroyed. Persistent entities are
@@ -74,6 +110,8 @@ RuntimeZoneRecord& RuntimeWorld::BeginZoneImport(ZoneId zone)
     assert(FindZone(zone) == nullptr
            && "BeginZoneImport received a duplicate ZoneId");
 
+    CompleteDetachCaptures(zone);
+
     const StoragePartitionId partition = AllocatePartition();
     auto record = std::make_unique<RuntimeZoneRecord>();
     record->Id = zone;
@@ -335,35 +373,10 @@ void RuntimeWorld::FinalizeResidencyProcessing()
         assert(record->Id == change.Zone);
         assert(record->State == RuntimeZoneLoadState::Detaching);
 
-        // Capture the zone's persistent-identity deviation while its entities
-        // are still alive; this is the moment "unload" stops meaning "forget".
-        // Worlds whose schema never registered the identity component (minimal
-        // fixtures) have nothing to capture and must not build the query.
-        if (auto* zoneState = Entities_.TryGetResource<ZoneStateStore>();
-            zoneState != nullptr && Entities_.IsRegistered<PersistentIdComponent>())
-        {
-            std::vector<PersistentEntityId> live;
-            StoragePartitionSet detaching;
-            detaching.Add(change.Partition);
-            Query<Read<PersistentIdComponent>> identified(Entities_);
-            identified.ForEachChunkIn(
-                detaching,
-                [&](auto& view)
-                {
-                    for (const PersistentIdComponent& id :
-                         view.template Read<PersistentIdComponent>())
-                    {
-                        if (id.Id.IsValid())
-                            live.push_back(id.Id);
-                    }
-                });
-            zoneState->RecordDetachCapture(change.Zone, live);
-        }
-
-        // Backend scenes receive the residency batch before this point. Entity
-        // hooks then run through the ordinary World destruction path while
-        // simulation-scoped World resources and zone resources are still alive.
-        (void)Entities_.DestroyPartition(change.Partition);
+        // Backend scenes receive the residency batch before this point. Remove
+        // hooks run here while simulation-scoped World resources and zone
+        // resources are still alive; the rows themselves leave as whole slabs.
+        CaptureDetachedZone(change.Zone, Entities_.DetachPartition(change.Partition));
         [[maybe_unused]] const std::size_t erased = PartitionByZone_.erase(change.Zone);
         assert(erased == 1 && "Detaching zone was missing from ZoneId index");
         ZonesByPartition_[change.Partition.Value].reset();
@@ -374,6 +387,69 @@ void RuntimeWorld::FinalizeResidencyProcessing()
     ResidencyProcessing_ = false;
 }
 
+// The zone's persistent-identity and tracked-component deviation is captured
+// from the detached rows; this is the moment "unload" stops meaning "forget".
+// Only taking the baseline touches the store here. Rows with no baseline to
+// diff against are simply released.
+void RuntimeWorld::CaptureDetachedZone(ZoneId zone, DetachedPartition rows)
+{
+    auto* zoneState = Entities_.TryGetResource<ZoneStateStore>();
+    if (zoneState == nullptr)
+        return;
+    ZoneStateBaseline baseline = zoneState->BeginDetachCapture(zone);
+    if (baseline.Authored.empty())
+        return;
+
+    auto job = std::make_shared<PendingDetachCapture>();
+    job->Zone = zone;
+    job->Baseline = std::move(baseline);
+    job->Rows = std::move(rows);
+    job->Columns = ResolveZoneDetachColumns(Entities_, *zoneState);
+
+    if (DetachCaptureLane_ == nullptr)
+    {
+        CommitDetachCapture(job);
+        return;
+    }
+
+    PendingCaptures_.push_back(job);
+    DetachCaptureLane_->Submit<bool>(
+        [job]
+        {
+            const std::lock_guard lock(job->Mutex);
+            job->Run();
+            return true;
+        },
+        [this, job](bool) { CommitDetachCapture(job); });
+}
+
+void RuntimeWorld::CommitDetachCapture(const std::shared_ptr<PendingDetachCapture>& job)
+{
+    {
+        const std::lock_guard lock(job->Mutex);
+        if (job->Settled)
+            return;
+        job->Run();
+        job->Settled = true;
+        if (auto* zoneState = Entities_.TryGetResource<ZoneStateStore>())
+            zoneState->CommitDetachCapture(job->Zone, std::move(*job->Result));
+    }
+    std::erase(PendingCaptures_, job);
+}
+
+void RuntimeWorld::CompleteDetachCaptures(ZoneId zone)
+{
+    for (std::size_t i = 0; i < PendingCaptures_.size();)
+    {
+        if (PendingCaptures_[i]->Zone != zone)
+        {
+            ++i;
+            continue;
+        }
+        CommitDetachCapture(std::shared_ptr<PendingDetachCapture>(PendingCaptures_[i]));
+    }
+}
+
 const FrameZoneView& RuntimeWorld::BuildFrameView()
 {
     assert(!ResidencyProcessing_
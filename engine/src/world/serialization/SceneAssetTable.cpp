@@ -0,0 +1,237 @@
+#include <world/serialization/SceneAssetTable.h>
+
+#include <assets/runtime/AssetSystem.h>
+#include <core/serialization/Serialize.h>
+
+#include <utility>
+
+namespace
+{
+    // Longest path the table reads back; a corrupt length fails the chunk
+    // instead of allocating it.
+    constexpr std::uint32_t MaxAssetPathLength = 4096;
+
+    // Transcode tokens are handle-shaped so a handle field can hold one: the
+    // slot is the entry index plus one, the generation always one.
+    std::uint64_t TranscodeToken(std::size_t index)
+    {
+        return (static_cast<std::uint64_t>(index) + 1) | (std::uint64_t{ 1 } << 32);
+    }
+
+    bool TranscodeIndex(std::uint64_t token, std::size_t count, std::size_t& index)
+    {
+        const std::uint64_t slot = token & 0xFFFFFFFFu;
+        if ((token >> 32) != 1 || slot == 0 || slot > count)
+            return false;
+        index = static_cast<std::size_t>(slot - 1);
+        return true;
+    }
+
+    std::string InternKey(AssetType type, std::string_view path)
+    {
+        std::string key;
+        key.reserve(path.size() + 3);
+        key += std::to_string(static_cast<std::uint16_t>(type));
+        key += ':';
+        key += path;
+        return key;
+    }
+}
+
+std::uint32_t SceneAssetTable::Intern(AssetType type, std::string_view path, AssetId id)
+{
+    const auto [found, inserted] = IndexByKey.try_emplace(
+        InternKey(type, path), static_cast<std::uint32_t>(Table.size()));
+    if (inserted)
+        Table.push_back(Entry{ type, std::string(path), id });
+    else if (!Table[found->second].Id.IsValid())
+        Table[found->second].Id = id;
+    return found->second;
+}
+
+bool SceneAssetTable::Write(BinaryWriter& writer) const
+{
+    if (!Serialize(writer, static_cast<std::uint32_t>(Table.size())))
+        return false;
+
+    for (const Entry& entry : Table)
+    {
+        if (!Serialize(writer, static_cast<std::uint16_t>(entry.Type))
+            || !Serialize(writer, entry.Path)
+            || !Serialize(writer, entry.Id))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool SceneAssetTable::Read(BinaryReader& reader, std::uint32_t version)
+{
+    Table.clear();
+    Resolved.clear();
+    IndexByKey.clear();
+
+    std::uint32_t count = 0;
+    if (!Deserialize(reader, count))
+        return false;
+
+    for (std::uint32_t i = 0; i < count; ++i)
+    {
+        std::uint16_t type = 0;
+        std::string path;
+        AssetId id{};
+        if (!Deserialize(reader, type) || !Deserialize(reader, path, MaxAssetPathLength))
+            return false;
+        if (version >= 2 && !Deserialize(reader, id))
+            return false;
+
+        // Entries are positional: a duplicate still takes its own slot so the
+        // writer's indices stay valid.
+        IndexByKey.try_emplace(InternKey(static_cast<AssetType>(type), path), i);
+        Table.push_back(Entry{ static_cast<AssetType>(type), std::move(path), id });
+    }
+    return true;
+}
+
+std::size_t SceneAssetTable::Resolve(AssetSystem& assets)
+{
+    ReleaseAll(assets);
+    Resolved.assign(Table.size(), 0);
+
+    std::size_t unresolved = 0;
+    for (std::size_t i = 0; i < Table.size(); ++i)
+    {
+        const Entry& entry = Table[i];
+        // An invalid id resolves to the stored path unchanged.
+        const std::string_view path = assets.ResolveRefPath(entry.Id, entry.Path, entry.Type);
+        std::uint64_t token = 0;
+        switch (entry.Type)
+        {
+        case AssetType::StaticMesh:
+            token = assets.LoadStaticMesh(path).ToToken();
+            break;
+        case AssetType::Material:
+            token = assets.LoadMaterial(path).ToToken();
+            break;
+        case AssetType::Texture:
+            token = assets.LoadTexture(path).ToToken();
+            break;
+        case AssetType::Audio:
+            token = assets.LoadAudioClip(path).ToToken();
+            break;
+        default:
+            break;
+        }
+
+        Resolved[i] = token;
+        if (token == 0)
+            ++unresolved;
+    }
+    return unresolved;
+}
+
+std::uint64_t SceneAssetTable::ResolvedToken(std::uint32_t index, AssetType type) const
+{
+    if (index >= Resolved.size() || Table[index].Type != type)
+        return 0;
+    return Resolved[index];
+}
+
+StaticMeshHandle SceneAssetTable::AcquireStaticMesh(std::uint32_t index, AssetSystem& assets) const
+{
+    const auto handle = StaticMeshHandle::FromToken(ResolvedToken(index, AssetType::StaticMesh));
+    if (handle.IsValid())
+        assets.RetainStaticMesh(handle);
+    return handle;
+}
+
+MaterialHandle SceneAssetTable::AcquireMaterial(std::uint32_t index, AssetSystem& assets) const
+{
+    const auto handle = MaterialHandle::FromToken(ResolvedToken(index, AssetType::Material));
+    if (handle.IsValid())
+        assets.RetainMaterial(handle);
+    return handle;
+}
+
+TextureHandle SceneAssetTable::AcquireTexture(std::uint32_t index, AssetSystem& assets) const
+{
+    const auto handle = TextureHandle::FromToken(ResolvedToken(index, AssetType::Texture));
+    if (handle.IsValid())
+        assets.RetainTexture(handle);
+    return handle;
+}
+
+AudioClipHandle SceneAssetTable::AcquireAudioClip(std::uint32_t index, AssetSystem& assets) const
+{
+    const auto handle = AudioClipHandle::FromToken(ResolvedToken(index, AssetType::Audio));
+    if (handle.IsValid())
+        assets.RetainAudioClip(handle);
+    return handle;
+}
+
+const SceneAssetTable::Entry* SceneAssetTable::At(std::uint32_t index) const
+{
+    return index < Table.size() ? &Table[index] : nullptr;
+}
+
+std::string_view SceneAssetTable::PathAt(std::uint32_t index) const
+{
+    return index < Table.size() ? std::string_view{ Table[index].Path } : std::string_view{};
+}
+
+void SceneAssetTable::ReleaseAll(AssetSystem& assets)
+{
+    for (std::size_t i = 0; i < Resolved.size(); ++i)
+    {
+        const std::uint64_t token = std::exchange(Resolved[i], 0);
+        if (token == 0)
+            continue;
+
+        switch (Table[i].Type)
+        {
+        case AssetType::StaticMesh:
+            assets.ReleaseStaticMesh(StaticMeshHandle::FromToken(token));
+            break;
+        case AssetType::Material:
+            assets.ReleaseMaterial(MaterialHandle::FromToken(token));
+            break;
+        case AssetType::Texture:
+            assets.ReleaseTexture(TextureHandle::FromToken(token));
+            break;
+        case AssetType::Audio:
+            assets.ReleaseAudioClip(AudioClipHandle::FromToken(token));
+            break;
+        default:
+            break;
+        }
+    }
+    Resolved.clear();
+}
+
+std::uint64_t SceneRefTranscode::Intern(AssetType type, std::string_view path, AssetId id)
+{
+    return TranscodeToken(Refs.Intern(type, path, id));
+}
+
+const SceneAssetTable::Entry* SceneRefTranscode::Find(std::uint64_t token) const
+{
+    std::size_t index = 0;
+    if (!TranscodeIndex(token, Refs.Entries().size(), index))
+        return nullptr;
+    return Refs.At(static_cast<std::uint32_t>(index));
+}
+
+std::uint64_t SceneRefTranscode::InternMaterialSet(std::vector<MaterialHandle> members)
+{
+    MaterialSets.push_back(std::move(members));
+    return TranscodeToken(MaterialSets.size() - 1);
+}
+
+const std::vector<MaterialHandle>* SceneRefTranscode::FindMaterialSet(std::uint64_t token) const
+{
+    std::size_t index = 0;
+    if (!TranscodeIndex(token, MaterialSets.size(), index))
+        return nullptr;
+    return &MaterialSets[index];
+}
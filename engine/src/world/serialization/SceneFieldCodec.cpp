@@ -3,10 +3,16 @@
 #include <core/assets/AssetId.h>
 #include <assets/runtime/AssetSystem.h>
 #include <core/logging/LoggingProvider.h>
+#include <world/serialization/SceneAssetTable.h>
 
+#include <cstdint>
 #include <optional>
+#include <string>
+#include <utility>
+#include <vector>
 
-// Per-handle-type asset I/O for the archive (text scene JSON). The editor's
+// Per-handle-type asset I/O for the archive: a path (or id-stamped ref) in
+// text scene JSON, an index into the scene's SceneAssetTable in binary. The editor's
 // live-memory equivalent is editor/level/AssetFieldIo (handle bytes in a
 // running component, with refcount balance). They are kept separate on purpose
 // (archive I/O vs live edit are different operations). A new asset-handle type
@@ -23,20 +29,6 @@ namespace
 
 namespace
 {
-    bool RejectBinaryWrite(IWriteArchive& archive, std::string_view key)
-    {
-        assert(false && "Binary scene serialization for AssetRef-backed handles is not implemented yet");
-        archive.MarkInvalidField(key);
-        return false;
-    }
-
-    bool RejectBinaryRead(IReadArchive& archive, std::string_view key)
-    {
-        assert(false && "Binary scene serialization for AssetRef-backed handles is not implemented yet");
-        archive.MarkInvalidField(key);
-        return false;
-    }
-
     // Reads the legacy {"type": ..., "path": ...} ref object. The enclosing
     // object scope is already open.
     bool ReadLegacyAssetRefFields(IReadArchive& archive,
@@ -91,6 +83,7 @@ namespace
                                    std::string_view key,
                                    AssetType expected,
                                    std::string& outPath,
+                                   AssetId& outId,
                                    SceneSerializationContext& context)
     {
         std::string idText;
@@ -112,6 +105,7 @@ namespace
             return false;
         }
 
+        outId = *id;
         outPath = context.Assets
             ? std::string(context.Assets->ResolveRefPath(*id, path, expected))
             : std::move(path);
@@ -128,11 +122,14 @@ namespace
         return true;
     }
 
+    // `outId`, when given, receives the id of a stamped ref and is left alone
+    // for the other forms.
     bool ReadTypedAssetPath(IReadArchive& archive,
                             std::string_view key,
                             AssetType expected,
                             std::string& outPath,
-                            SceneSerializationContext& context)
+                            SceneSerializationContext& context,
+                            AssetId* outId = nullptr)
     {
         if (archive.IsString(key))
         {
@@ -152,9 +149,12 @@ namespace
         {
             archive.BeginObject(key);
             const bool stamped = archive.HasField(std::string_view{"id"});
+            AssetId id{};
             const bool ok = stamped
-                ? ReadStampedAssetRefFields(archive, key, expected, outPath, context)
+                ? ReadStampedAssetRefFields(archive, key, expected, outPath, id, context)
                 : ReadLegacyAssetRefFields(archive, key, expected, outPath, context);
+            if (ok && outId != nullptr)
+                *outId = id;
             archive.End();
             return ok && archive.Ok();
         }
@@ -165,9 +165,12 @@ namespace
         return false;
     }
 
+    // A ref with an id writes the cooked {"id","path"} form; only a transcode
+    // of a cooked scene has one to write.
     bool WriteTypedAssetPath(IWriteArchive& archive,
                              std::string_view key,
                              std::string_view path,
+                             AssetId id,
                              SceneSerializationContext& context)
     {
         if (path.empty())
@@ -177,9 +180,159 @@ namespace
             return false;
         }
 
-        archive.Field(key, path);
+        if (!id.IsValid())
+        {
+            archive.Field(key, path);
+            return archive.Ok();
+        }
+
+        const std::string idText = AssetIdToString(id);
+        archive.BeginObject(key);
+        archive.Field(std::string_view{"id"}, std::string_view{ idText });
+        archive.Field(std::string_view{"path"}, path);
+        archive.End();
+        return archive.Ok();
+    }
+
+    // A null handle is no ref. Text leaves the key out, so a load takes the
+    // field's default (or reports it missing); binary keeps the slot and writes
+    // NoEntry, which loads back as a null handle.
+    bool WriteNullRef(IWriteArchive& archive, std::string_view key)
+    {
+        if (!archive.IsText())
+            archive.Field(key, SceneAssetTable::NoEntry);
         return archive.Ok();
     }
+
+    // Binary handle fields carry an index into the scene's asset table, which
+    // SaveSceneBinary writes once ahead of the component chunks.
+    bool WriteAssetRef(IWriteArchive& archive,
+                       std::string_view key,
+                       AssetType type,
+                       std::string_view path,
+                       SceneSerializationContext& context,
+                       AssetId id = {})
+    {
+        if (archive.IsText())
+            return WriteTypedAssetPath(archive, key, path, id, context);
+
+        if (context.AssetTable == nullptr)
+        {
+            GetSceneLogger(context).Error("SceneFieldCodec: binary field '{}' has no scene asset table", key);
+            archive.MarkInvalidField(key);
+            return false;
+        }
+        if (path.empty())
+        {
+            GetSceneLogger(context).Error("SceneFieldCodec: field '{}' has no registered asset path", key);
+            archive.MarkInvalidField(key);
+            return false;
+        }
+
+        archive.Field(key, context.AssetTable->Intern(type, path, id));
+        return archive.Ok();
+    }
+
+    // A transcode's load: whichever form the ref is read from, it goes into the
+    // transcode and the field holds the token.
+    template <typename THandle>
+    bool ReadTranscodedRef(IReadArchive& archive,
+                           std::string_view key,
+                           AssetType type,
+                           THandle& value,
+                           SceneSerializationContext& context)
+    {
+        std::string path;
+        AssetId id{};
+        if (archive.IsText())
+        {
+            if (!ReadTypedAssetPath(archive, key, type, path, context, &id))
+                return false;
+        }
+        else
+        {
+            std::uint32_t index = 0;
+            archive.Field(key, index);
+            if (!archive.Ok())
+                return false;
+            if (index == SceneAssetTable::NoEntry)
+            {
+                value = {};
+                return true;
+            }
+
+            const SceneAssetTable::Entry* entry =
+                context.AssetTable != nullptr ? context.AssetTable->At(index) : nullptr;
+            if (entry == nullptr || entry->Type != type)
+            {
+                GetSceneLogger(context).Error(
+                    "SceneFieldCodec: field '{}' references asset table entry {} that is missing or of another type",
+                    key, index);
+                archive.MarkInvalidField(key);
+                return false;
+            }
+            path = entry->Path;
+            id = entry->Id;
+        }
+
+        value = THandle::FromToken(context.Transcode->Intern(type, path, id));
+        return archive.Ok();
+    }
+
+    // A transcode's save: the ref behind the field's token.
+    template <typename THandle>
+    bool WriteTranscodedRef(IWriteArchive& archive,
+                            std::string_view key,
+                            AssetType type,
+                            THandle value,
+                            SceneSerializationContext& context)
+    {
+        const SceneAssetTable::Entry* entry = context.Transcode->Find(value.ToToken());
+        if (entry == nullptr)
+        {
+            GetSceneLogger(context).Error("SceneFieldCodec: field '{}' holds no transcoded asset ref", key);
+            archive.MarkInvalidField(key);
+            return false;
+        }
+        return WriteAssetRef(archive, key, type, entry->Path, context, entry->Id);
+    }
+
+    template <typename THandle>
+    bool ReadAssetTableRef(IReadArchive& archive,
+                           std::string_view key,
+                           THandle& value,
+                           THandle (SceneAssetTable::*acquire)(std::uint32_t, AssetSystem&) const,
+                           SceneSerializationContext& context)
+    {
+        if (context.AssetTable == nullptr || context.Assets == nullptr)
+        {
+            GetSceneLogger(context).Error(
+                "SceneFieldCodec: binary field '{}' needs a scene asset table and an AssetSystem", key);
+            archive.MarkInvalidField(key);
+            return false;
+        }
+
+        std::uint32_t index = 0;
+        archive.Field(key, index);
+        if (!archive.Ok())
+            return false;
+        if (index == SceneAssetTable::NoEntry)
+        {
+            value = {};
+            return true;
+        }
+
+        value = (context.AssetTable->*acquire)(index, *context.Assets);
+        if (!value.IsValid())
+        {
+            GetSceneLogger(context).Error(
+                "SceneFieldCodec: field '{}' references asset table entry {} ('{}') that did not resolve",
+                key, index, context.AssetTable->PathAt(index));
+            archive.MarkInvalidField(key);
+            return false;
+        }
+        return true;
+    }
 }
 
 bool SceneFieldCodec<StaticMeshHandle>::Save(IWriteArchive& archive,
@@ -187,8 +340,11 @@ bool SceneFieldCodec<StaticMeshHandle>::Save(IWriteArchive& archive,
                                              StaticMeshHandle value,
                                              SceneSerializationContext& context)
 {
-    if (!archive.IsText())
-        return RejectBinaryWrite(archive, key);
+    if (!value.IsValid())
+        return WriteNullRef(archive, key);
+
+    if (context.Transcode != nullptr)
+        return WriteTranscodedRef(archive, key, AssetType::StaticMesh, value, context);
 
     if (!context.Assets)
     {
@@ -197,7 +353,7 @@ bool SceneFieldCodec<StaticMeshHandle>::Save(IWriteArchive& archive,
         return false;
     }
 
-    return WriteTypedAssetPath(archive, key, context.Assets->GetPathForStaticMesh(value), context);
+    return WriteAssetRef(archive, key, AssetType::StaticMesh, context.Assets->GetPathForStaticMesh(value), context);
 }
 
 bool SceneFieldCodec<StaticMeshHandle>::Load(IReadArchive& archive,
@@ -205,8 +361,11 @@ bool SceneFieldCodec<StaticMeshHandle>::Load(IReadArchive& archive,
                                              StaticMeshHandle& value,
                                              SceneSerializationContext& context)
 {
+    if (context.Transcode != nullptr)
+        return ReadTranscodedRef(archive, key, AssetType::StaticMesh, value, context);
+
     if (!archive.IsText())
-        return RejectBinaryRead(archive, key);
+        return ReadAssetTableRef(archive, key, value, &SceneAssetTable::AcquireStaticMesh, context);
 
     std::string path;
     if (!ReadTypedAssetPath(archive, key, AssetType::StaticMesh, path, context))
@@ -236,8 +395,11 @@ bool SceneFieldCodec<MaterialHandle>::Save(IWriteArchive& archive,
                                            MaterialHandle value,
                                            SceneSerializationContext& context)
 {
-    if (!archive.IsText())
-        return RejectBinaryWrite(archive, key);
+    if (!value.IsValid())
+        return WriteNullRef(archive, key);
+
+    if (context.Transcode != nullptr)
+        return WriteTranscodedRef(archive, key, AssetType::Material, value, context);
 
     if (!context.Assets)
     {
@@ -246,7 +408,7 @@ bool SceneFieldCodec<MaterialHandle>::Save(IWriteArchive& archive,
         return false;
     }
 
-    return WriteTypedAssetPath(archive, key, context.Assets->GetPathForMaterial(value), context);
+    return WriteAssetRef(archive, key, AssetType::Material, context.Assets->GetPathForMaterial(value), context);
 }
 
 bool SceneFieldCodec<MaterialHandle>::Load(IReadArchive& archive,
@@ -254,8 +416,11 @@ bool SceneFieldCodec<MaterialHandle>::Load(IReadArchive& archive,
                                            MaterialHandle& value,
                                            SceneSerializationContext& context)
 {
+    if (context.Transcode != nullptr)
+        return ReadTranscodedRef(archive, key, AssetType::Material, value, context);
+
     if (!archive.IsText())
-        return RejectBinaryRead(archive, key);
+        return ReadAssetTableRef(archive, key, value, &SceneAssetTable::AcquireMaterial, context);
 
     std::string path;
     if (!ReadTypedAssetPath(archive, key, AssetType::Material, path, context))
@@ -284,25 +449,31 @@ bool SceneFieldCodec<MaterialSetHandle>::Save(IWriteArchive& archive,
                                               MaterialSetHandle value,
                                               SceneSerializationContext& context)
 {
-    if (!archive.IsText())
-        return RejectBinaryWrite(archive, key);
-
-    if (!context.Assets)
+    if (!context.Assets && !context.Transcode)
     {
         GetSceneLogger(context).Error("SceneFieldCodec<MaterialSetHandle>: missing AssetSystem for field '{}'", key);
         archive.MarkInvalidField(key);
         return false;
     }
 
-    const std::vector<MaterialHandle>* members = context.Assets->GetMaterialSet(value);
+    const std::vector<MaterialHandle>* members = context.Transcode != nullptr
+        ? context.Transcode->FindMaterialSet(value.ToToken())
+        : context.Assets->GetMaterialSet(value);
     const std::size_t count = members ? members->size() : 0;
     archive.BeginArray(key, count);
+    // A binary array scope stores no count of its own.
+    if (!archive.IsText())
+        archive.Field(key, static_cast<std::uint32_t>(count));
     if (members)
     {
         for (const MaterialHandle material : *members)
         {
             // Key is ignored inside an array scope; the element is appended.
-            if (!WriteTypedAssetPath(archive, key, context.Assets->GetPathForMaterial(material), context))
+            const bool written = context.Transcode != nullptr
+                ? WriteTranscodedRef(archive, key, AssetType::Material, material, context)
+                : WriteAssetRef(archive, key, AssetType::Material,
+                                context.Assets->GetPathForMaterial(material), context);
+            if (!written)
             {
                 archive.End();
                 return false;
@@ -318,10 +489,7 @@ bool SceneFieldCodec<MaterialSetHandle>::Load(IReadArchive& archive,
                                               MaterialSetHandle& value,
                                               SceneSerializationContext& context)
 {
-    if (!archive.IsText())
-        return RejectBinaryRead(archive, key);
-
-    if (!context.Assets)
+    if (!context.Assets && !context.Transcode)
     {
         GetSceneLogger(context).Error("SceneFieldCodec<MaterialSetHandle>: missing AssetSystem for field '{}'", key);
         archive.MarkInvalidField(key);
@@ -329,6 +497,15 @@ bool SceneFieldCodec<MaterialSetHandle>::Load(IReadArchive& archive,
     }
 
     const auto resolveInto = [&](std::string_view refKey, std::vector<MaterialHandle>& out) {
+        if (context.Transcode != nullptr)
+        {
+            MaterialHandle material;
+            if (!ReadTranscodedRef(archive, refKey, AssetType::Material, material, context))
+                return false;
+            out.push_back(material);
+            return true;
+        }
+
         std::string path;
         if (!ReadTypedAssetPath(archive, refKey, AssetType::Material, path, context))
             return false;
@@ -345,7 +522,29 @@ bool SceneFieldCodec<MaterialSetHandle>::Load(IReadArchive& archive,
 
     std::vector<MaterialHandle> materials;
 
-    if (archive.HasField(key))
+    if (!archive.IsText())
+    {
+        std::uint32_t count = 0;
+        archive.Field(key, count);
+        if (!archive.Ok())
+            return false;
+        for (std::uint32_t i = 0; i < count; ++i)
+        {
+            MaterialHandle material;
+            const bool read = context.Transcode != nullptr
+                ? ReadTranscodedRef(archive, key, AssetType::Material, material, context)
+                : ReadAssetTableRef(archive, key, material, &SceneAssetTable::AcquireMaterial, context);
+            if (!read)
+            {
+                if (context.Assets != nullptr)
+                    for (const MaterialHandle acquired : materials)
+                        context.Assets->ReleaseMaterial(acquired);
+                return false;
+            }
+            materials.push_back(material);
+        }
+    }
+    else if (archive.HasField(key))
     {
         std::size_t count = 0;
         archive.BeginArray(key, count);
@@ -377,6 +576,13 @@ bool SceneFieldCodec<MaterialSetHandle>::Load(IReadArchive& archive,
         return false;
     }
 
+    if (context.Transcode != nullptr)
+    {
+        value = MaterialSetHandle::FromToken(
+            context.Transcode->InternMaterialSet(std::move(materials)));
+        return archive.Ok();
+    }
+
     // The set takes ownership of each member; drop the load references the
     // resolve step took so the set is the sole owner.
     value = context.Assets->AcquireMaterialSet(materials);
@@ -397,8 +603,11 @@ bool SceneFieldCodec<TextureHandle>::Save(IWriteArchive& archive,
                                           TextureHandle value,
                                           SceneSerializationContext& context)
 {
-    if (!archive.IsText())
-        return RejectBinaryWrite(archive, key);
+    if (!value.IsValid())
+        return WriteNullRef(archive, key);
+
+    if (context.Transcode != nullptr)
+        return WriteTranscodedRef(archive, key, AssetType::Texture, value, context);
 
     if (!context.Assets)
     {
@@ -407,7 +616,7 @@ bool SceneFieldCodec<TextureHandle>::Save(IWriteArchive& archive,
         return false;
     }
 
-    return WriteTypedAssetPath(archive, key, context.Assets->GetPathForTexture(value), context);
+    return WriteAssetRef(archive, key, AssetType::Texture, context.Assets->GetPathForTexture(value), context);
 }
 
 bool SceneFieldCodec<TextureHandle>::Load(IReadArchive& archive,
@@ -415,8 +624,11 @@ bool SceneFieldCodec<TextureHandle>::Load(IReadArchive& archive,
                                           TextureHandle& value,
                                           SceneSerializationContext& context)
 {
+    if (context.Transcode != nullptr)
+        return ReadTranscodedRef(archive, key, AssetType::Texture, value, context);
+
     if (!archive.IsText())
-        return RejectBinaryRead(archive, key);
+        return ReadAssetTableRef(archive, key, value, &SceneAssetTable::AcquireTexture, context);
 
     std::string path;
     if (!ReadTypedAssetPath(archive, key, AssetType::Texture, path, context))
@@ -445,8 +657,11 @@ bool SceneFieldCodec<AudioClipHandle>::Save(IWriteArchive& archive,
                                             AudioClipHandle value,
                                             SceneSerializationContext& context)
 {
-    if (!archive.IsText())
-        return RejectBinaryWrite(archive, key);
+    if (!value.IsValid())
+        return WriteNullRef(archive, key);
+
+    if (context.Transcode != nullptr)
+        return WriteTranscodedRef(archive, key, AssetType::Audio, value, context);
 
     if (!context.Assets)
     {
@@ -455,7 +670,7 @@ bool SceneFieldCodec<AudioClipHandle>::Save(IWriteArchive& archive,
         return false;
     }
 
-    return WriteTypedAssetPath(archive, key, context.Assets->GetPathForAudioClip(value), context);
+    return WriteAssetRef(archive, key, AssetType::Audio, context.Assets->GetPathForAudioClip(value), context);
 }
 
 bool SceneFieldCodec<AudioClipHandle>::Load(IReadArchive& archive,
@@ -463,8 +678,11 @@ bool SceneFieldCodec<AudioClipHandle>::Load(IReadArchive& archive,
                                             AudioClipHandle& value,
                                             SceneSerializationContext& context)
 {
+    if (context.Transcode != nullptr)
+        return ReadTranscodedRef(archive, key, AssetType::Audio, value, context);
+
     if (!archive.IsText())
-        return RejectBinaryRead(archive, key);
+        return ReadAssetTableRef(archive, key, value, &SceneAssetTable::AcquireAudioClip, context);
 
     std::string path;
     if (!ReadTypedAssetPath(archive, key, AssetType::Audio, path, context))
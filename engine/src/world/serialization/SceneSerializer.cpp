@@ -7,6 +7,7 @@
 #include <core/serialization/Serialize.h>
 #include <world/ComponentManifest.h>
 #include <world/serialization/ComponentSerializerRegistry.h>
+#include <world/serialization/SceneAssetTable.h>
 #include <world/serialization/SceneFormat.h>
 #include <math/MathSchemas.h>
 #include <world/transform/TransformComponents.h>
@@ -14,7 +15,7 @@
 #include <algorithm>
 #include <cassert>
 #include <memory>
-#include <sstream>
+#include <span>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -197,47 +198,57 @@ namespace
                                   BinaryWriter& writer,
                                   SceneSerializationContext& context)
     {
-        // Buffer component data first so the entity count (unknown upfront) can be
-        // written before the payload, as required by the chunk format.
-        std::stringstream payload(std::ios::in | std::ios::out | std::ios::binary);
-        BinaryWriter payloadWriter(payload);
-
+        // The entity count is unknown until the entities are walked; reserve
+        // it and patch it afterwards rather than buffering the payload.
+        const std::streamoff countPos = writer.Tell();
         std::uint32_t count = 0;
+        if (countPos < 0 || !Serialize(writer, count))
+            return false;
+
         for (EntityId entity : entities)
         {
             if (!serializer.HasComponent(entity, registry))
                 continue;
 
-            if (!Serialize(payloadWriter, entity.Index))
+            if (!Serialize(writer, entity.Index))
                 return false;
 
-            BinaryWriteArchive archive(payloadWriter);
-            if (!serializer.Save(archive, entity, registry, context) || !archive.Ok())
+            // The record's payload size, patched once the payload is written.
+            const std::streamoff sizePos = writer.Tell();
+            std::uint32_t size = 0;
+            if (sizePos < 0 || !Serialize(writer, size))
                 return false;
 
-            ++count;
-        }
+            BinaryWriteArchive archive(writer);
+            if (!serializer.Save(archive, entity, registry, context) || !archive.Ok())
+                return false;
 
-        const std::string payloadBytes = payload.str();
-        if (!Serialize(writer, count))
-            return false;
+            const std::streamoff payloadPos = sizePos + static_cast<std::streamoff>(sizeof(size));
+            const std::streamoff endPos = writer.Tell();
+            if (endPos < payloadPos)
+                return false;
+            size = static_cast<std::uint32_t>(endPos - payloadPos);
+            if (!writer.WriteAt(sizePos, size))
+                return false;
 
-        if (!payloadBytes.empty()
-            && !writer.WriteBytes(payloadBytes.data(), static_cast<std::streamsize>(payloadBytes.size())))
-        {
-            return false;
+            ++count;
         }
 
-        return true;
+        return writer.WriteAt(countPos, count);
     }
 
     bool LoadComponentChunkBinary(IComponentSerializer& serializer,
                                   BinaryReader& reader,
+                                  std::uint32_t chunkVersion,
                                   std::uint32_t count,
                                   Registry& registry,
                                   const std::unordered_map<EntityIndex, EntityId>& remap,
                                   SceneSerializationContext& context)
     {
+        if (chunkVersion == 0 || chunkVersion > SceneComponentChunkVersion)
+            return false;
+        const bool framed = chunkVersion >= 2;
+
         for (std::uint32_t i = 0; i < count; ++i)
         {
             EntityIndex savedOwner = 0;
@@ -248,13 +259,57 @@ namespace
             if (!owner.IsValid())
                 return false;
 
+            std::uint32_t size = 0;
+            std::streamoff payloadPos = 0;
+            if (framed)
+            {
+                if (!Deserialize(reader, size))
+                    return false;
+                payloadPos = reader.Tell();
+            }
+
             BinaryReadArchive archive(reader);
             if (!serializer.Load(archive, owner, registry, context) || !archive.Ok())
                 return false;
+
+            // A decoder that disagrees with the frame about where the record
+            // ends would misread every record after it.
+            if (framed && reader.Tell() - payloadPos != static_cast<std::streamoff>(size))
+                return false;
         }
         return true;
     }
 
+    // Points the context at one scene's asset table for a binary save or load,
+    // then drops the references the table resolved and restores the caller's
+    // table on the way out.
+    class ScopedSceneAssetTable
+    {
+    public:
+        ScopedSceneAssetTable(SceneSerializationContext& context, SceneAssetTable& table)
+            : Context(context)
+            , Table(table)
+            , Previous(context.AssetTable)
+        {
+            Context.AssetTable = &Table;
+        }
+
+        ~ScopedSceneAssetTable()
+        {
+            if (Context.Assets != nullptr)
+                Table.ReleaseAll(*Context.Assets);
+            Context.AssetTable = Previous;
+        }
+
+        ScopedSceneAssetTable(const ScopedSceneAssetTable&) = delete;
+        ScopedSceneAssetTable& operator=(const ScopedSceneAssetTable&) = delete;
+
+    private:
+        SceneSerializationContext& Context;
+        SceneAssetTable& Table;
+        SceneAssetTable* Previous = nullptr;
+    };
+
     void RollbackLoadedEntities(const ComponentSerializerRegistry& serializers,
                                 Registry& registry,
                                 const std::vector<EntityId>& entities)
@@ -312,18 +367,47 @@ bool SaveSceneBinary(const Registry& registry,
         return false;
     }
 
+    // Component chunks are buffered: their handle fields fill the asset table,
+    // and the table has to precede them so a load can resolve it first.
+    SceneAssetTable assetTable;
+    ScopedSceneAssetTable scopedTable(context, assetTable);
+    GrowableWriter components;
+    BinaryWriter componentWriter(components);
+
     for (const auto& entry : serializers.Entries())
     {
         ChunkWriter chunk;
-        if (!chunk.Begin(writer, entry->BinaryChunkId(), SceneVersion)
-            || !SaveComponentChunkBinary(*entry, entities, registry, writer, context)
-            || !chunk.End(writer))
+        if (!chunk.Begin(componentWriter, entry->BinaryChunkId(), SceneComponentChunkVersion)
+            || !SaveComponentChunkBinary(*entry, entities, registry, componentWriter, context)
+            || !chunk.End(componentWriter))
         {
             SetError(error, "Failed to write component chunk.");
             return false;
         }
     }
 
+    // A scene without asset handles writes no table, so its bytes are what
+    // they were before handles could be written at all.
+    if (!assetTable.Empty())
+    {
+        ChunkWriter chunk;
+        if (!chunk.Begin(writer, SceneChunk::AssetTable, SceneAssetTableVersion)
+            || !assetTable.Write(writer)
+            || !chunk.End(writer))
+        {
+            SetError(error, "Failed to write asset table chunk.");
+            return false;
+        }
+    }
+
+    const std::span<const std::byte> componentBytes = components.Bytes();
+    if (!writer.WriteBytes(reinterpret_cast<const char*>(componentBytes.data()),
+                           static_cast<std::streamsize>(componentBytes.size())))
+    {
+        SetError(error, "Failed to write component chunk.");
+        return false;
+    }
+
     return true;
 }
 
@@ -355,13 +439,22 @@ bool LoadSceneBinary(BinaryReader& reader,
     std::vector<EntityId> loadedEntities;
     bool loadedRegistry = false;
 
+    SceneAssetTable assetTable;
+    ScopedSceneAssetTable scopedTable(context, assetTable);
+
     RegisterSerializedComponentStorage(serializers, registry);
 
-    while (true)
+    while (!reader.AtEnd())
     {
+        // A header that does not fit, or a chunk that claims more bytes than
+        // remain, is a truncated scene rather than its end.
         ChunkReader chunk;
         if (!chunk.ReadHeader(reader))
-            break;
+        {
+            RollbackLoadedEntities(serializers, registry, loadedEntities);
+            SetError(error, "Truncated scene chunk.");
+            return false;
+        }
 
         const ChunkHeader& chunkHeader = chunk.GetHeader();
         bool ok = true;
@@ -377,11 +470,20 @@ bool LoadSceneBinary(BinaryReader& reader,
             ok = Deserialize(reader, count)
                 && LoadHierarchyChunk(reader, count, registry, remap);
         }
+        else if (chunkHeader.Id == SceneChunk::AssetTable)
+        {
+            // The scene's one batched asset lookup. Without an AssetSystem the
+            // table stays unresolved and only a handle field that needs it fails.
+            ok = assetTable.Read(reader, chunkHeader.Version);
+            if (ok && context.Assets != nullptr)
+                assetTable.Resolve(*context.Assets);
+        }
         else if (IComponentSerializer* entry = FindByChunkMutable(serializers, chunkHeader.Id))
         {
             std::uint32_t count = 0;
             ok = Deserialize(reader, count)
-                && LoadComponentChunkBinary(*entry, reader, count, registry, remap, context);
+                && LoadComponentChunkBinary(*entry, reader, chunkHeader.Version, count,
+                                            registry, remap, context);
         }
 
         if (!ok)
@@ -595,3 +697,74 @@ bool LoadSceneJson(const JsonValue& root,
 
     return true;
 }
+
+namespace
+{
+    // A scene read for a transcode lives only in this scratch registry. Parent
+    // is registered so the hierarchy rides through it.
+    void PrepareTranscodeRegistry(Registry& scratch)
+    {
+        scratch.Components.RegisterComponent<Parent>();
+    }
+}
+
+bool TranscodeSceneJsonToBinary(const JsonValue& root,
+                                const ComponentSerializerRegistry& serializers,
+                                BinaryWriter& writer,
+                                LoggingProvider& logging,
+                                SceneSaveError* error)
+{
+    // LoadSceneJson skips a component it has no serializer for; a transcode
+    // that did the same would quietly drop it from the output.
+    if (const JsonValue* entities = root.Find("entities"); entities && entities->IsArray())
+    {
+        for (const JsonValue& entity : entities->AsArray())
+        {
+            const JsonValue* components = entity.IsObject() ? entity.Find("components") : nullptr;
+            if (components == nullptr || !components->IsObject())
+                continue;
+            for (const auto& [key, value] : components->AsObject())
+            {
+                if (FindByJsonKey(serializers, key) == nullptr)
+                {
+                    SetError(error, "Scene JSON component '" + key + "' has no serializer.");
+                    return false;
+                }
+            }
+        }
+    }
+
+    SceneRefTranscode refs;
+    SceneSerializationContext context(logging);
+    context.Transcode = &refs;
+
+    Registry scratch;
+    PrepareTranscodeRegistry(scratch);
+    SceneLoadError loadError;
+    if (!LoadSceneJson(root, scratch, serializers, context, &loadError))
+    {
+        SetError(error, std::move(loadError.Message));
+        return false;
+    }
+    return SaveSceneBinary(scratch, serializers, writer, context, error);
+}
+
+JsonValue TranscodeSceneBinaryToJson(BinaryReader& reader,
+                                     const ComponentSerializerRegistry& serializers,
+                                     LoggingProvider& logging,
+                                     SceneLoadError* error)
+{
+    SceneRefTranscode refs;
+    SceneSerializationContext context(logging);
+    context.Transcode = &refs;
+
+    Registry scratch;
+    PrepareTranscodeRegistry(scratch);
+    if (!LoadSceneBinary(reader, scratch, serializers, context, error))
+        return {};
+
+    JsonValue root = SaveSceneJson(scratch, serializers, context);
+    if (root.IsNull())
+        SetError(error, "Failed to write transcoded scene JSON.");
+    return root;
+}
@@ -7,11 +7,15 @@
 #include <world/RuntimeWorld.h>
 #include <world/serialization/ComponentSerializerRegistry.h>
 #include <world/serialization/SceneSerializationContext.h>
+#include <zone/ZoneChunkImage.h>
+#include <zone/ZoneDemand.h>
 #include <zone/ZonePackageImporter.h>
 
 #include <algorithm>
 #include <cassert>
 #include <memory>
+#include <optional>
+#include <stop_token>
 #include <utility>
 
 AsyncZoneLoader::AsyncZoneLoader(
@@ -71,12 +75,20 @@ AsyncTaskHandle AsyncZoneLoader::BeginLoad(
     assert(!IsLoading(zone)
            && "AsyncZoneLoader::BeginLoad: zone load is already in flight");
 
+    AsyncTaskPriorityCell priority = MakeAsyncTaskPriority(AsyncTaskPriority::Normal);
+    AsyncTaskDeadlineCell deadline = MakeAsyncTaskDeadline();
+    std::stop_source stop;
     AsyncTaskHandle handle = Tasks.Submit<std::unique_ptr<ZoneLoadPackage>>(
         // Work, on a task thread: package-local identity and owned CPU payloads
-        // need no synchronization with the live entity world.
-        [zone, build = std::move(build)]() mutable {
+        // need no synchronization with the live entity world. The sealed schema
+        // is read-only, so baking the chunk image here is what leaves the owner
+        // thread a memcpy per chunk. A load cancelled during the build skips
+        // the bake; the queue drops the package either way.
+        [zone, build = std::move(build), &schema = Schema, token = stop.get_token()]() mutable {
             auto package = std::make_unique<ZoneLoadPackage>(zone);
             build(*package);
+            if (!token.stop_requested())
+                (void)BakeZoneChunkImage(*package, schema);
             return package;
         },
         // Commit, on the owner thread at the drain point. A cancelled preload
@@ -97,83 +109,131 @@ AsyncTaskHandle AsyncZoneLoader::BeginLoad(
                      deferredPackage,
                      deferredFinalize,
                      assets]() mutable {
-                        ImportAndFinalize(
+                        StartImport(
                             zone,
                             std::move(*deferredPackage),
-                            *deferredFinalize,
+                            std::move(*deferredFinalize),
                             participation,
                             assets);
                     });
                 return;
             }
 
-            ImportAndFinalize(
+            StartImport(
                 zone,
                 std::move(package),
-                finalize,
+                std::move(finalize),
                 participation,
                 assets);
-        });
+        },
+        AsyncTaskOptions{ .Priority = priority,
+                          .SharedDeadline = deadline,
+                          .Stop = stop,
+                          .Label = "zone.build" });
 
-    InFlight.push_back(InFlightLoad{ zone, handle, std::move(assets) });
+    InFlight.push_back(InFlightLoad{
+        zone, handle, std::move(assets), std::move(priority), std::move(deadline), nullptr });
     return handle;
 }
 
-void AsyncZoneLoader::ImportAndFinalize(
+struct AsyncZoneLoader::ZoneImport
+{
+    ZoneId Zone;
+    std::unique_ptr<ZoneLoadPackage> Package;
+    FinalizeFn Finalize;
+    ZoneParticipation Participation;
+    std::shared_ptr<AssetPreload> Assets;
+    std::optional<ZonePackageImport> Rows;
+};
+
+void AsyncZoneLoader::StartImport(
     ZoneId zone,
     std::unique_ptr<ZoneLoadPackage> package,
-    FinalizeFn& finalize,
+    FinalizeFn finalize,
     ZoneParticipation participation,
-    const std::shared_ptr<AssetPreload>& assets)
+    std::shared_ptr<AssetPreload> assets)
 {
-    RemoveInFlight(zone);
-
-    ZoneImportError importError;
-    if (package == nullptr
-        || !ImportZonePackageHidden(
-            RuntimeWorldState,
-            Schema,
-            *package,
-            Serializers,
-            SceneContext,
-            &importError))
+    if (package == nullptr)
     {
-        RecordFailure(
-            zone,
-            ZoneLoadStage::Import,
-            package == nullptr ? "package was not produced"
-                               : std::move(importError.Message));
+        RemoveInFlight(zone);
+        RecordFailure(zone, ZoneLoadStage::Import, "package was not produced");
         if (assets)
             assets->ReleaseAll();
         return;
     }
 
+    auto import = std::make_shared<ZoneImport>();
+    import->Zone = zone;
+    import->Package = std::move(package);
+    import->Finalize = std::move(finalize);
+    import->Participation = participation;
+    import->Assets = std::move(assets);
+    import->Rows.emplace(RuntimeWorldState, Schema, *import->Package, Serializers, SceneContext);
+
+    // The first slice runs inside the commit that delivered the package, as
+    // the whole import once did; only a zone larger than a slice goes on.
+    if (StepImport(*import))
+        return;
+
+    auto it = std::find_if(
+        InFlight.begin(),
+        InFlight.end(),
+        [zone](const InFlightLoad& load) { return load.Zone == zone; });
+    assert(it != InFlight.end() && "AsyncZoneLoader: importing zone lost its in-flight record");
+    it->Import = import;
+    it->Handle = Tasks.SubmitCommitSlices(
+        [this, import] { return StepImport(*import); },
+        AsyncTaskOptions{ .Priority = it->Priority,
+                          .SharedDeadline = it->Deadline,
+                          .Label = "zone.import" });
+}
+
+bool AsyncZoneLoader::StepImport(ZoneImport& import)
+{
+    const ZoneId zone = import.Zone;
+    ZoneImportError importError;
+    switch (import.Rows->Step(std::max<std::size_t>(ImportSliceRows_, 1), &importError))
+    {
+    case ZonePackageImport::Status::Importing:
+        return false;
+    case ZonePackageImport::Status::Failed:
+        RemoveInFlight(zone);
+        RecordFailure(zone, ZoneLoadStage::Import, std::move(importError.Message));
+        if (import.Assets)
+            import.Assets->ReleaseAll();
+        return true;
+    case ZonePackageImport::Status::Imported:
+        break;
+    }
+
+    RemoveInFlight(zone);
+
     RuntimeZoneRecord* record = RuntimeWorldState.FindZone(zone);
     assert(record != nullptr
            && record->State == RuntimeZoneLoadState::Importing);
 
-    if (finalize && !finalize(RuntimeWorldState, *record))
+    if (import.Finalize && !import.Finalize(RuntimeWorldState, *record))
     {
         (void)RuntimeWorldState.CancelZoneImport(zone);
         RecordFailure(
             zone,
             ZoneLoadStage::Finalize,
             "finalize declined publication");
-        if (assets)
-            assets->ReleaseAll();
-        return;
+        if (import.Assets)
+            import.Assets->ReleaseAll();
+        return true;
     }
 
-    if (!RuntimeWorldState.PublishZone(zone, participation))
+    if (!RuntimeWorldState.PublishZone(zone, import.Participation))
     {
         (void)RuntimeWorldState.CancelZoneImport(zone);
         RecordFailure(
             zone,
             ZoneLoadStage::Publish,
             "publication rejected the imported partition");
-        if (assets)
-            assets->ReleaseAll();
-        return;
+        if (import.Assets)
+            import.Assets->ReleaseAll();
+        return true;
     }
 
     // A zone that loads after a previous refusal is healthy again; leaving the
@@ -182,14 +242,15 @@ void AsyncZoneLoader::ImportAndFinalize(
 
     // The preload's handles were scaffolding: published entities and backend
     // records hold their own references now.
-    if (assets)
-        assets->ReleaseAll();
+    if (import.Assets)
+        import.Assets->ReleaseAll();
 
     // Dormant preload is the genre-critical seamless path. Activation later is
     // the game's participation decision; only immediately participating loads
     // invalidate presentation history.
-    if (participation.Any())
+    if (import.Participation.Any())
         Runtime.MarkTemporalDiscontinuity(TemporalDiscontinuityReason::ZoneLoad);
+    return true;
 }
 
 bool AsyncZoneLoader::IsLoading(ZoneId zone) const
@@ -220,12 +281,62 @@ bool AsyncZoneLoader::CancelLoad(ZoneId zone)
         return false;
 
     if (!Tasks.Cancel(it->Handle))
-        return false; // build is mid-flight; retry once it finishes
+        return false;
 
+    // Cancelled between slices: the rest never runs, so the rows already
+    // built go with the hidden partition here.
+    if (it->Import)
+        it->Import->Rows->Cancel();
+    if (it->Assets)
+        it->Assets->Cancel();
     InFlight.erase(it);
     return true;
 }
 
+bool AsyncZoneLoader::SetLoadPriority(ZoneId zone, AsyncTaskPriority priority)
+{
+    for (const InFlightLoad& load : InFlight)
+    {
+        if (load.Zone != zone)
+            continue;
+        load.Priority->store(priority);
+        return true;
+    }
+    return false;
+}
+
+std::chrono::steady_clock::duration AsyncZoneLoader::LoadLeadTime(const ZoneDemandRecord& record)
+{
+    if (IsDemandedFor(record, ZoneDemandReason::Focus))
+        return FocusLeadTime;
+    const bool onlyPredicted = std::all_of(
+        record.Reasons.begin(),
+        record.Reasons.end(),
+        [](const ZoneDemandReasonRecord& reason) {
+            return reason.Reason == ZoneDemandReason::Predicted;
+        });
+    if (onlyPredicted && !record.Reasons.empty())
+        return PredictedLeadTime;
+    return NeighborLeadTime;
+}
+
+bool AsyncZoneLoader::SetLoadDeadline(ZoneId zone, std::chrono::steady_clock::time_point deadline)
+{
+    for (const InFlightLoad& load : InFlight)
+    {
+        if (load.Zone != zone)
+            continue;
+        if (deadline < load.Deadline->load())
+        {
+            load.Deadline->store(deadline);
+            if (load.Assets)
+                load.Assets->SetDeadline(deadline);
+        }
+        return true;
+    }
+    return false;
+}
+
 void AsyncZoneLoader::RecordFailure(
     ZoneId zone,
     ZoneLoadStage stage,
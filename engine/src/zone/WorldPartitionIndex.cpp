@@ -1,6 +1,34 @@
 #include <zone/WorldPartitionIndex.h>
 
 #include <algorithm>
+#include <array>
+
+namespace
+{
+// Zones per BVH leaf. Testing a handful of boxes is cheaper than descending
+// another level for them.
+constexpr uint32_t kLeafZoneCount = 4;
+
+double BoundsVolume(const Aabb3d& bounds)
+{
+    const Vec3d extent = bounds.Extent();
+    return static_cast<double>(extent[0]) * static_cast<double>(extent[1])
+        * static_cast<double>(extent[2]);
+}
+} // namespace
+
+double ZoneBoundsDistanceSq(const Aabb3d& bounds, Vec3d point)
+{
+    const Vec3d closest{
+        std::clamp(point[0], bounds.Min[0], bounds.Max[0]),
+        std::clamp(point[1], bounds.Min[1], bounds.Max[1]),
+        std::clamp(point[2], bounds.Min[2], bounds.Max[2])
+    };
+    const Vec3d delta = closest - point;
+    return static_cast<double>(delta[0]) * delta[0]
+        + static_cast<double>(delta[1]) * delta[1]
+        + static_cast<double>(delta[2]) * delta[2];
+}
 
 WorldPartitionIndex WorldPartitionIndex::Build(const WorldPartitionManifest& manifest)
 {
@@ -14,6 +42,17 @@ WorldPartitionIndex WorldPartitionIndex::Build(const WorldPartitionManifest& man
                          index.ZoneIds_.end());
 
     const size_t zoneCount = index.ZoneIds_.size();
+    index.HeaderIndices_.assign(zoneCount, kNoZone);
+    index.Graphs_.assign(zoneCount, GraphId{});
+    for (uint32_t i = 0; i < manifest.Zones.size(); ++i)
+    {
+        const size_t slot = index.FindSlot(manifest.Zones[i].Id);
+        if (index.HeaderIndices_[slot] != kNoZone)
+            continue;
+        index.HeaderIndices_[slot] = i;
+        index.Graphs_[slot] = manifest.Zones[i].Graph;
+    }
+
     std::vector<std::vector<uint32_t>> outgoing(zoneCount);
     std::vector<std::vector<uint32_t>> incoming(zoneCount);
 
@@ -60,18 +99,13 @@ WorldPartitionIndex WorldPartitionIndex::Build(const WorldPartitionManifest& man
 
     index.DockOffsets_.reserve(zoneCount + 1);
     index.LinkOffsets_.reserve(zoneCount + 1);
-    for (uint64_t zoneValue : index.ZoneIds_)
+    for (size_t slot = 0; slot < zoneCount; ++slot)
     {
         index.DockOffsets_.push_back(static_cast<uint32_t>(index.Docks_.size()));
         index.LinkOffsets_.push_back(static_cast<uint32_t>(index.Links_.size()));
-        for (const ZoneHeader& zone : manifest.Zones)
-        {
-            if (zone.Id.Value != zoneValue)
-                continue;
-            index.Docks_.insert(index.Docks_.end(), zone.Docks.begin(), zone.Docks.end());
-            index.Links_.insert(index.Links_.end(), zone.Links.begin(), zone.Links.end());
-            break;
-        }
+        const ZoneHeader& zone = manifest.Zones[index.HeaderIndices_[slot]];
+        index.Docks_.insert(index.Docks_.end(), zone.Docks.begin(), zone.Docks.end());
+        index.Links_.insert(index.Links_.end(), zone.Links.begin(), zone.Links.end());
         std::sort(index.Docks_.begin() + index.DockOffsets_.back(), index.Docks_.end(),
                   [](const DockEndpoint& a, const DockEndpoint& b)
                   {
@@ -90,9 +124,67 @@ WorldPartitionIndex WorldPartitionIndex::Build(const WorldPartitionManifest& man
     index.DockOffsets_.push_back(static_cast<uint32_t>(index.Docks_.size()));
     index.LinkOffsets_.push_back(static_cast<uint32_t>(index.Links_.size()));
 
+    for (uint32_t i = 0; i < manifest.Zones.size(); ++i)
+    {
+        const ZoneHeader& zone = manifest.Zones[i];
+        if (zone.Bounds.IsValid())
+            index.SpatialZones_.push_back(
+                SpatialZone{ zone.Bounds, BoundsVolume(zone.Bounds), zone.Id.Value, i });
+    }
+    if (!index.SpatialZones_.empty())
+        index.BuildSpatialRange(0, static_cast<uint32_t>(index.SpatialZones_.size()));
+
     return index;
 }
 
+uint32_t WorldPartitionIndex::BuildSpatialRange(uint32_t start, uint32_t count)
+{
+    const uint32_t nodeIndex = static_cast<uint32_t>(SpatialNodes_.size());
+    SpatialNodes_.push_back(SpatialNode{});
+
+    Aabb3d bounds = Aabb3d::Empty();
+    Aabb3d centers = Aabb3d::Empty();
+    for (uint32_t i = start; i < start + count; ++i)
+    {
+        bounds.ExpandToInclude(SpatialZones_[i].Bounds);
+        centers.ExpandToInclude(SpatialZones_[i].Bounds.Center());
+    }
+
+    if (count <= kLeafZoneCount)
+    {
+        SpatialNodes_[nodeIndex].Bounds = bounds;
+        SpatialNodes_[nodeIndex].Start = start;
+        SpatialNodes_[nodeIndex].Count = count;
+        return nodeIndex;
+    }
+
+    // Split along the widest center axis at the median. Zone sizes vary by
+    // orders of magnitude (a room beside a field cell), which a uniform grid
+    // handles badly and a median split does not notice.
+    const Vec3d extent = centers.Extent();
+    int axis = 0;
+    if (extent[1] > extent[axis])
+        axis = 1;
+    if (extent[2] > extent[axis])
+        axis = 2;
+
+    const uint32_t mid = count / 2;
+    std::nth_element(
+        SpatialZones_.begin() + start, SpatialZones_.begin() + start + mid,
+        SpatialZones_.begin() + start + count,
+        [axis](const SpatialZone& a, const SpatialZone& b)
+        {
+            return a.Bounds.Center()[axis] < b.Bounds.Center()[axis];
+        });
+
+    const uint32_t left = BuildSpatialRange(start, mid);
+    const uint32_t right = BuildSpatialRange(start + mid, count - mid);
+    SpatialNodes_[nodeIndex].Bounds = bounds;
+    SpatialNodes_[nodeIndex].Left = left;
+    SpatialNodes_[nodeIndex].Right = right;
+    return nodeIndex;
+}
+
 size_t WorldPartitionIndex::FindSlot(ZoneId zone) const
 {
     const auto it = std::lower_bound(ZoneIds_.begin(), ZoneIds_.end(), zone.Value);
@@ -141,3 +233,117 @@ bool WorldPartitionIndex::ContainsZone(ZoneId zone) const
 {
     return FindSlot(zone) != ZoneIds_.size();
 }
+
+uint32_t WorldPartitionIndex::HeaderIndexOf(ZoneId zone) const
+{
+    const size_t slot = FindSlot(zone);
+    return slot == ZoneIds_.size() ? kNoZone : HeaderIndices_[slot];
+}
+
+GraphId WorldPartitionIndex::GraphOf(ZoneId zone) const
+{
+    const size_t slot = FindSlot(zone);
+    return slot == ZoneIds_.size() ? GraphId{} : Graphs_[slot];
+}
+
+void WorldPartitionIndex::ZonesWithin(Vec3d point, double radius,
+                                      std::vector<uint32_t>& out) const
+{
+    if (SpatialNodes_.empty() || radius < 0.0)
+        return;
+
+    const double radiusSq = radius * radius;
+    std::array<uint32_t, 64> stack{};
+    uint32_t depth = 0;
+    stack[depth++] = 0;
+    while (depth > 0)
+    {
+        const SpatialNode& node = SpatialNodes_[stack[--depth]];
+        if (ZoneBoundsDistanceSq(node.Bounds, point) > radiusSq)
+            continue;
+        if (node.Count == 0)
+        {
+            stack[depth++] = node.Left;
+            stack[depth++] = node.Right;
+            continue;
+        }
+        for (uint32_t i = node.Start; i < node.Start + node.Count; ++i)
+            if (ZoneBoundsDistanceSq(SpatialZones_[i].Bounds, point) <= radiusSq)
+                out.push_back(SpatialZones_[i].Header);
+    }
+}
+
+void WorldPartitionIndex::ZonesContaining(Vec3d point, std::vector<uint32_t>& out) const
+{
+    if (SpatialNodes_.empty())
+        return;
+
+    std::array<uint32_t, 64> stack{};
+    uint32_t depth = 0;
+    stack[depth++] = 0;
+    while (depth > 0)
+    {
+        const SpatialNode& node = SpatialNodes_[stack[--depth]];
+        if (!node.Bounds.Contains(point))
+            continue;
+        if (node.Count == 0)
+        {
+            stack[depth++] = node.Left;
+            stack[depth++] = node.Right;
+            continue;
+        }
+        for (uint32_t i = node.Start; i < node.Start + node.Count; ++i)
+            if (SpatialZones_[i].Bounds.Contains(point))
+                out.push_back(SpatialZones_[i].Header);
+    }
+}
+
+uint32_t WorldPartitionIndex::NearestZone(Vec3d point) const
+{
+    if (SpatialNodes_.empty())
+        return kNoZone;
+
+    const SpatialZone* best = nullptr;
+    double bestDistanceSq = 0.0;
+    const auto better = [&](const SpatialZone& zone, double distanceSq)
+    {
+        if (best == nullptr || distanceSq != bestDistanceSq)
+            return best == nullptr || distanceSq < bestDistanceSq;
+        if (zone.Volume != best->Volume)
+            return zone.Volume < best->Volume;
+        if (zone.Id != best->Id)
+            return zone.Id < best->Id;
+        return zone.Header < best->Header;
+    };
+
+    // Branch and bound, nearer child first. A subtree is skipped only when
+    // it is strictly farther than the best so far, so distance ties still
+    // reach the volume and id rules.
+    std::array<uint32_t, 64> stack{};
+    uint32_t depth = 0;
+    stack[depth++] = 0;
+    while (depth > 0)
+    {
+        const SpatialNode& node = SpatialNodes_[stack[--depth]];
+        if (best != nullptr && ZoneBoundsDistanceSq(node.Bounds, point) > bestDistanceSq)
+            continue;
+        if (node.Count == 0)
+        {
+            const bool leftFirst = ZoneBoundsDistanceSq(SpatialNodes_[node.Left].Bounds, point)
+                <= ZoneBoundsDistanceSq(SpatialNodes_[node.Right].Bounds, point);
+            stack[depth++] = leftFirst ? node.Right : node.Left;
+            stack[depth++] = leftFirst ? node.Left : node.Right;
+            continue;
+        }
+        for (uint32_t i = node.Start; i < node.Start + node.Count; ++i)
+        {
+            const double distanceSq = ZoneBoundsDistanceSq(SpatialZones_[i].Bounds, point);
+            if (better(SpatialZones_[i], distanceSq))
+            {
+                best = &SpatialZones_[i];
+                bestDistanceSq = distanceSq;
+            }
+        }
+    }
+    return best->Header;
+}
@@ -1,11 +1,13 @@
 #include <zone/WorldPartitionRuntime.h>
 
+#include <assets/runtime/AssetPreloader.h>
 #include <world/RuntimeWorld.h>
 #include <zone/WorldPartitionIds.h>
 #include <zone/WorldPartitionValidation.h>
 
 #include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <limits>
 #include <utility>
 
@@ -24,6 +26,25 @@ void AddRuntimeReason(ZoneDemandRecord& record, ZoneDemandReasonRecord reason)
         record.Reasons.push_back(std::move(reason));
 }
 
+// The focus zone first, then what something asked for by name and the
+// neighbor the focus is heading into, then the other neighbors and the zones
+// only predicted. Applies to a load's build and its asset preload alike.
+AsyncTaskPriority LoadPriority(const ZoneDemandRecord& record)
+{
+    if (IsDemandedFor(record, ZoneDemandReason::Focus))
+        return AsyncTaskPriority::High;
+    if (IsDemandedFor(record, ZoneDemandReason::ExplicitPin)
+        || IsDemandedFor(record, ZoneDemandReason::Gameplay)
+        || IsDemandedFor(record, ZoneDemandReason::TraversalGrace)
+        || (IsDemandedFor(record, ZoneDemandReason::Predicted) && record.Desired.Any()))
+        return AsyncTaskPriority::Normal;
+    return AsyncTaskPriority::Low;
+}
+
+// Weight of the newest focus-motion sample in the velocity estimate. One frame
+// of a blocked or clamped step moves the estimate, it does not replace it.
+constexpr float kFocusVelocitySmoothing = 0.5f;
+
 } // namespace
 
 WorldPartitionRuntime::WorldPartitionRuntime(ZoneLoadRecipeFn recipe,
@@ -73,8 +94,17 @@ bool WorldPartitionRuntime::LoadManifest(WorldPartitionManifest manifest, std::s
     FocusCapsuleRadius_ = 0.0f;
     FocusCapsuleCylinderHalfHeight_ = 0.0f;
     LateTraversalCount_ = 0;
+    VisiblePopCount_ = 0;
+    AwaitingVisible_.clear();
     TraversalGrace_ = {};
+    FocusVelocity_ = {};
+    HasMotionSample_ = false;
+    HistoryFocus_ = {};
+    TraversalHistory_.clear();
     Pins_.clear();
+    FocusRanks_.clear();
+    FocusRanksZone_ = ZoneId{};
+    FocusRanksHopCount_ = -1;
 
     // Reloading a manifest invalidates every outstanding lease without allowing
     // an old token to alias a newly allocated slot in the same runtime object.
@@ -94,6 +124,7 @@ bool WorldPartitionRuntime::LoadManifest(WorldPartitionManifest manifest, std::s
 
     PendingDestroys_.clear();
     Issued_.clear();
+    IssuedPreloads_.clear();
     Lingering_.clear();
     Records_.clear();
     return true;
@@ -107,10 +138,8 @@ const WorldPartitionManifest& WorldPartitionRuntime::Manifest() const
 
 const ZoneHeader* WorldPartitionRuntime::FindHeader(ZoneId zone) const
 {
-    for (const ZoneHeader& header : Manifest_.Zones)
-        if (header.Id == zone)
-            return &header;
-    return nullptr;
+    const uint32_t header = Index_.HeaderIndexOf(zone);
+    return header == WorldPartitionIndex::kNoZone ? nullptr : &Manifest_.Zones[header];
 }
 
 void WorldPartitionRuntime::SetFocus(Vec3d position)
@@ -119,7 +148,7 @@ void WorldPartitionRuntime::SetFocus(Vec3d position)
         return;
     if (!Focus_.IsValid())
     {
-        Focus_ = ResolveFocusZone(Manifest_, position, {});
+        Focus_ = ResolveFocusZone(Manifest_, Index_, position, {});
         FocusPosition_ = position;
         DockSweepPosition_ = position;
         HasFocusPosition_ = true;
@@ -143,7 +172,7 @@ void WorldPartitionRuntime::RelocateFocus(Vec3d position)
 {
     if (!HasManifest_)
         return;
-    Focus_ = ResolveFocusZone(Manifest_, position, {});
+    Focus_ = ResolveFocusZone(Manifest_, Index_, position, {});
     FocusPosition_ = position;
     DockSweepPosition_ = position;
     HasFocusPosition_ = true;
@@ -151,6 +180,10 @@ void WorldPartitionRuntime::RelocateFocus(Vec3d position)
     SuppressedDock_ = {};
     LastTraversal_ = {};
     TraversalGrace_ = {};
+    // A teleport is neither motion nor a route taken.
+    FocusVelocity_ = {};
+    HasMotionSample_ = false;
+    HistoryFocus_ = Focus_;
 }
 
 void WorldPartitionRuntime::SetFocus(ZoneId zone)
@@ -161,6 +194,8 @@ void WorldPartitionRuntime::SetFocus(ZoneId zone)
     LastTraversal_ = {};
     TraversalGrace_ = {};
     HasPendingFocusPosition_ = false;
+    FocusVelocity_ = {};
+    HasMotionSample_ = false;
     if (const ZoneHeader* header = FindHeader(zone); header != nullptr
         && header->Bounds.IsValid())
     {
@@ -195,14 +230,14 @@ const ZoneHeader* WorldPartitionRuntime::FindZone(ZoneId zone) const
 
 std::optional<ZoneId> WorldPartitionRuntime::ZoneAt(Vec3d position) const
 {
-    const ZoneContainmentResult result = ::ResolveZoneAt(Manifest_, position, {});
+    const ZoneContainmentResult result = ::ResolveZoneAt(Manifest_, Index_, position, {});
     return result.Chosen.IsValid() ? std::optional<ZoneId>{ result.Chosen } : std::nullopt;
 }
 
 ZoneContainmentResult WorldPartitionRuntime::ResolveZoneAt(
     Vec3d position, ZoneId preferred) const
 {
-    return ::ResolveZoneAt(Manifest_, position, preferred);
+    return ::ResolveZoneAt(Manifest_, Index_, position, preferred);
 }
 
 void WorldPartitionRuntime::PinZone(ZoneId zone, ZoneParticipation minimum)
@@ -379,13 +414,24 @@ void WorldPartitionRuntime::Update(double deltaSeconds, AsyncZoneLoader& loader,
             TraversalGrace_ = { LastTraversal_.From, 0.0 };
     }
 
+    if (HasManifest_ && Focus_.IsValid())
+        RecordFocusMotion(deltaSeconds);
+
     std::vector<ZoneDemandRecord> demand;
-    std::vector<ZoneHopRank> ranks;
+    std::span<const ZoneHopRank> ranks;
     if (HasManifest_ && Focus_.IsValid())
     {
         const WorldPartitionStreamingConfig resolved =
             ResolveGraphStreamingConfig(Manifest_, Focus_, Config_);
-        ranks = ComputeZoneHopRanks(Manifest_, Index_, Focus_, resolved.HopCount);
+        // Graph ranks change only when the focus changes zone; moving within
+        // one zone re-runs only the spatial part of the demand.
+        if (FocusRanksZone_ != Focus_ || FocusRanksHopCount_ != resolved.HopCount)
+        {
+            FocusRanks_ = ComputeZoneHopRanks(Manifest_, Index_, Focus_, resolved.HopCount);
+            FocusRanksZone_ = Focus_;
+            FocusRanksHopCount_ = resolved.HopCount;
+        }
+        ranks = FocusRanks_;
 
         // Leases use the existing pin-shaped pure demand input, but remain
         // independently tokenized in the runtime. Duplicate entries are safe:
@@ -396,8 +442,31 @@ void WorldPartitionRuntime::Update(double deltaSeconds, AsyncZoneLoader& loader,
             if (lease.Alive)
                 effectivePins.push_back(ZonePin{ lease.Zone, lease.Minimum });
 
-        demand = ComputeZoneDemand(Manifest_, Index_, Focus_, effectivePins, resolved,
-                                   HasFocusPosition_ ? &FocusPosition_ : nullptr);
+        demand = ComputeZoneDemandFromRanks(Manifest_, Index_, Focus_, ranks, effectivePins,
+                                            resolved,
+                                            HasFocusPosition_ ? &FocusPosition_ : nullptr);
+
+        // Predicted zones outside the demand set load dormant; ones already in
+        // it only gain the reason, which moves their load ahead of their peers.
+        if (HasFocusPosition_)
+        {
+            for (ZoneDemandRecord& predicted : PredictZoneDemand(
+                     Index_, Focus_, FocusPosition_, FocusVelocity_, TraversalHistory_,
+                     resolved))
+            {
+                ZoneDemandRecord* existing = nullptr;
+                for (ZoneDemandRecord& record : demand)
+                    if (record.Zone == predicted.Zone)
+                        existing = &record;
+                if (existing == nullptr)
+                {
+                    demand.push_back(std::move(predicted));
+                    continue;
+                }
+                for (ZoneDemandReasonRecord& reason : predicted.Reasons)
+                    AddRuntimeReason(*existing, std::move(reason));
+            }
+        }
     }
 
     if (TraversalGrace_.Zone.IsValid())
@@ -469,20 +538,35 @@ void WorldPartitionRuntime::Update(double deltaSeconds, AsyncZoneLoader& loader,
                   const int32_t hopB = rankB ? rankB->Hop : std::numeric_limits<int32_t>::max();
                   if (hopA != hopB)
                       return hopA < hopB;
+                  const bool predictedA = IsDemandedFor(*a, ZoneDemandReason::Predicted);
+                  const bool predictedB = IsDemandedFor(*b, ZoneDemandReason::Predicted);
+                  if (predictedA != predictedB)
+                      return predictedA;
                   const double costA = rankA ? rankA->Cost : 0.0;
                   const double costB = rankB ? rankB->Cost : 0.0;
                   if (costA != costB)
                       return costA < costB;
                   return a->Zone.Value < b->Zone.Value;
               });
+    // Deadlines count from the update that first wants the zone; a load
+    // wanted more urgently later is moved up, never back.
+    const auto now = std::chrono::steady_clock::now();
     for (const ZoneDemandRecord* record : toLoad)
     {
         const ZoneHeader* header = FindHeader(record->Zone);
         if (header == nullptr)
             continue;
         ZoneLoadRecipe recipe = Recipe_(*header);
+        const AsyncTaskPriority priority = LoadPriority(*record);
+        if (recipe.Preload)
+        {
+            recipe.Preload->SetPriority(priority);
+            IssuedPreloads_.push_back(IssuedPreload{ record->Zone, recipe.Preload });
+        }
         loader.BeginLoad(record->Zone, std::move(recipe.Build), std::move(recipe.Finalize),
                          ZoneParticipation{}, std::move(recipe.Preload));
+        (void)loader.SetLoadPriority(record->Zone, priority);
+        (void)loader.SetLoadDeadline(record->Zone, now + AsyncZoneLoader::LoadLeadTime(*record));
         Issued_.push_back(record->Zone);
     }
 
@@ -503,12 +587,31 @@ void WorldPartitionRuntime::Update(double deltaSeconds, AsyncZoneLoader& loader,
     {
         if (!loader.IsLoading(zone))
             continue;
-        if (findDemand(zone) == nullptr && loader.CancelLoad(zone))
+        const ZoneDemandRecord* record = findDemand(zone);
+        if (record == nullptr && loader.CancelLoad(zone))
             continue;
+        if (record != nullptr)
+        {
+            (void)loader.SetLoadPriority(zone, LoadPriority(*record));
+            (void)loader.SetLoadDeadline(zone, now + AsyncZoneLoader::LoadLeadTime(*record));
+        }
         stillPending.push_back(zone);
     }
     Issued_ = std::move(stillPending);
 
+    // A neighbor that became the focus overtakes its former peers; assets
+    // already staged or committing are unaffected.
+    std::erase_if(IssuedPreloads_, [&](const IssuedPreload& issued)
+    {
+        std::shared_ptr<AssetPreload> preload = issued.Preload.lock();
+        if (!preload || preload->IsComplete()
+            || std::find(Issued_.begin(), Issued_.end(), issued.Zone) == Issued_.end())
+            return true;
+        if (const ZoneDemandRecord* record = findDemand(issued.Zone))
+            preload->SetPriority(LoadPriority(*record));
+        return false;
+    });
+
     std::erase_if(PendingDestroys_,
                   [&](ZoneId zone) { return !world.IsZoneResident(zone); });
 
@@ -553,6 +656,7 @@ void WorldPartitionRuntime::Update(double deltaSeconds, AsyncZoneLoader& loader,
     }
     Lingering_ = std::move(lingering);
 
+    CountVisiblePops(demand, world);
     Records_ = std::move(demand);
     for (ZoneId zone : lingerRecords)
     {
@@ -577,3 +681,47 @@ void WorldPartitionRuntime::Update(double deltaSeconds, AsyncZoneLoader& loader,
               [](const ZoneDemandRecord& a, const ZoneDemandRecord& b)
               { return a.Zone.Value < b.Zone.Value; });
 }
+
+void WorldPartitionRuntime::RecordFocusMotion(double deltaSeconds)
+{
+    if (HistoryFocus_.IsValid() && HistoryFocus_ != Focus_)
+    {
+        auto it = std::find_if(TraversalHistory_.begin(), TraversalHistory_.end(),
+                               [&](const ZoneTraversalCount& count)
+                               { return count.From == HistoryFocus_ && count.To == Focus_; });
+        if (it == TraversalHistory_.end())
+            TraversalHistory_.push_back(ZoneTraversalCount{ HistoryFocus_, Focus_, 1 });
+        else
+            ++it->Count;
+    }
+    HistoryFocus_ = Focus_;
+
+    if (!HasFocusPosition_)
+        return;
+    if (HasMotionSample_ && deltaSeconds > 0.0)
+    {
+        const Vec3d sample =
+            (FocusPosition_ - MotionSample_) * static_cast<float>(1.0 / deltaSeconds);
+        FocusVelocity_ = FocusVelocity_ + (sample - FocusVelocity_) * kFocusVelocitySmoothing;
+    }
+    MotionSample_ = FocusPosition_;
+    HasMotionSample_ = true;
+}
+
+void WorldPartitionRuntime::CountVisiblePops(std::span<const ZoneDemandRecord> demand,
+                                             const RuntimeWorld& world)
+{
+    std::vector<ZoneId> awaiting;
+    for (const ZoneDemandRecord& record : demand)
+    {
+        if (!record.Desired.Visible)
+            continue;
+        const bool waited = std::find(AwaitingVisible_.begin(), AwaitingVisible_.end(),
+                                      record.Zone) != AwaitingVisible_.end();
+        if (!world.IsZoneResident(record.Zone))
+            awaiting.push_back(record.Zone);
+        else if (waited)
+            ++VisiblePopCount_;
+    }
+    AwaitingVisible_ = std::move(awaiting);
+}
@@ -0,0 +1,151 @@
+#include <zone/ZoneChunkImage.h>
+
+#include <ecs/WorldComponentSchema.h>
+#include <world/identity/PersistentIdComponent.h>
+#include <world/transform/TransformComponents.h>
+#include <zone/ZoneLoadPackage.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace
+{
+struct BakedValue
+{
+    ComponentTypeId Type;
+    std::span<const std::byte> Bytes;
+};
+
+template <typename T>
+std::span<const std::byte> BytesOf(const T& value)
+{
+    return { reinterpret_cast<const std::byte*>(&value), sizeof(T) };
+}
+
+// Mirrors the per-entity importer's identity check (PersistentIdentityAgrees),
+// so an entity the importer would reject is left for it to reject.
+bool PersistentIdentityAgrees(const ZonePackageEntity& entity,
+                              const std::vector<BakedValue>& values)
+{
+    PersistentEntityId component;
+    const ComponentTypeId idType = ResolveComponentTypeId<PersistentIdComponent>();
+    for (const BakedValue& value : values)
+    {
+        if (value.Type != idType)
+            continue;
+        PersistentIdComponent decoded;
+        std::memcpy(&decoded, value.Bytes.data(), sizeof(decoded));
+        component = decoded.Id;
+    }
+    return component == entity.PersistentId;
+}
+} // namespace
+
+std::size_t BakeZoneChunkImage(ZoneLoadPackage& package, const WorldComponentSchema& schema)
+{
+    const ComponentTypeId localType = ResolveComponentTypeId<LocalTransform>();
+    const ComponentTypeId worldType = ResolveComponentTypeId<WorldTransform>();
+    const ComponentTypeId parentType = ResolveComponentTypeId<Parent>();
+    const bool bakeTransforms = schema.Contains(localType) && schema.Contains(worldType);
+    const bool bakeParents = schema.Contains(parentType);
+
+    std::vector<bool> parented(package.EntityCount(), false);
+    for (const ZonePackageParent& relation : package.Parents())
+        if (package.ContainsEntity(relation.Child))
+            parented[relation.Child.Value] = true;
+
+    // Derived values need storage that outlives the entity's pass; one slot
+    // each is enough because an entity's values are appended before the next.
+    const Parent unwiredParent{};
+    WorldTransform derivedWorld{};
+
+    ZoneChunkImage image;
+    std::map<std::vector<ComponentTypeId>, std::size_t> blockBySet;
+    std::vector<BakedValue> values;
+    std::vector<ComponentTypeId> set;
+    std::size_t baked = 0;
+
+    const std::span<const ZonePackageEntity> entities = package.Entities();
+    for (std::size_t index = 0; index < entities.size(); ++index)
+    {
+        const ZonePackageEntity& entity = entities[index];
+        if (entity.InChunkImage)
+            continue;
+
+        values.clear();
+        bool bakeable = true;
+        for (const ZonePackageComponent& component : entity.Components)
+        {
+            const WorldComponentSchema::Entry* entry = schema.Find(component.Type);
+            // Derived and hierarchy columns are the importer's to write; an
+            // entity that authors them itself keeps the per-entity path.
+            if (!component.HasRuntimeBytes() || entry == nullptr
+                || entry->Size != component.RuntimeBytes.size()
+                || component.Type == worldType || component.Type == parentType)
+            {
+                bakeable = false;
+                break;
+            }
+            values.push_back(BakedValue{ component.Type, component.RuntimeBytes });
+        }
+        if (!bakeable || !PersistentIdentityAgrees(entity, values))
+            continue;
+
+        if (bakeTransforms)
+        {
+            const auto local = std::find_if(values.begin(), values.end(),
+                [localType](const BakedValue& value) { return value.Type == localType; });
+            if (local != values.end())
+            {
+                LocalTransform decoded;
+                std::memcpy(&decoded, local->Bytes.data(), sizeof(decoded));
+                derivedWorld = WorldTransform{ decoded.Value };
+                values.push_back(BakedValue{ worldType, BytesOf(derivedWorld) });
+            }
+        }
+        if (bakeParents && parented[index])
+            values.push_back(BakedValue{ parentType, BytesOf(unwiredParent) });
+
+        std::sort(values.begin(), values.end(),
+            [](const BakedValue& a, const BakedValue& b) { return a.Type < b.Type; });
+        set.clear();
+        for (const BakedValue& value : values)
+            set.push_back(value.Type);
+
+        auto [found, inserted] = blockBySet.try_emplace(set, image.Blocks.size());
+        if (inserted)
+        {
+            ZoneChunkImageBlock& block = image.Blocks.emplace_back();
+            for (const BakedValue& value : values)
+            {
+                if (value.Bytes.empty())
+                    block.Tags.push_back(value.Type);
+                else
+                    block.Columns.push_back(ZoneChunkImageColumn{ value.Type, value.Bytes.size(), {} });
+            }
+        }
+
+        // Columns were created from a sorted set, so the entity's sorted values
+        // walk them in step.
+        ZoneChunkImageBlock& block = image.Blocks[found->second];
+        std::size_t column = 0;
+        for (const BakedValue& value : values)
+        {
+            if (value.Bytes.empty())
+                continue;
+            std::vector<std::byte>& bytes = block.Columns[column++].Bytes;
+            bytes.insert(bytes.end(), value.Bytes.begin(), value.Bytes.end());
+        }
+        block.Rows.push_back(ZoneLocalEntityId{ static_cast<std::uint32_t>(index) });
+        ++baked;
+    }
+
+    if (baked == 0)
+        return 0;
+    return package.AdoptChunkImage(std::move(image)) ? baked : 0;
+}
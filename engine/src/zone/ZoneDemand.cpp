@@ -3,29 +3,20 @@
 #include <algorithm>
 #include <cmath>
 #include <limits>
+#include <optional>
 #include <string_view>
+#include <unordered_map>
 #include <utility>
 
 namespace
 {
 
-bool ZoneExists(const WorldPartitionManifest& manifest, ZoneId zone)
+const ZoneHeader* FindZoneHeader(const WorldPartitionManifest& manifest,
+                                 const WorldPartitionIndex& index,
+                                 ZoneId zone)
 {
-    for (const ZoneHeader& header : manifest.Zones)
-        if (header.Id == zone)
-            return true;
-    return false;
-}
-
-// Existence and graph in one pass, for callers that want both. Asking through
-// ZoneExists and GraphOf separately walks the zone list twice for one answer,
-// which the hop-rank BFS does once per edge it considers.
-const ZoneHeader* FindZoneHeader(const WorldPartitionManifest& manifest, ZoneId zone)
-{
-    for (const ZoneHeader& header : manifest.Zones)
-        if (header.Id == zone)
-            return &header;
-    return nullptr;
+    const uint32_t header = index.HeaderIndexOf(zone);
+    return header == WorldPartitionIndex::kNoZone ? nullptr : &manifest.Zones[header];
 }
 
 ZoneHopRank* FindRank(std::vector<ZoneHopRank>& ranks, ZoneId zone)
@@ -36,12 +27,26 @@ ZoneHopRank* FindRank(std::vector<ZoneHopRank>& ranks, ZoneId zone)
     return nullptr;
 }
 
-GraphId GraphOf(const WorldPartitionManifest& manifest, ZoneId zone)
+// Graph overrides over base for a graph already known. The public resolve
+// finds the focus zone's graph first; policy code here has it from the index.
+WorldPartitionStreamingConfig ResolveStreamingConfigForGraph(
+    const WorldPartitionManifest& manifest, GraphId graphId,
+    const WorldPartitionStreamingConfig& base)
 {
-    for (const ZoneHeader& header : manifest.Zones)
-        if (header.Id == zone)
-            return header.Graph;
-    return {};
+    WorldPartitionStreamingConfig resolved = base;
+    for (const GraphRecord& graph : manifest.Graphs)
+    {
+        if (graph.Id != graphId)
+            continue;
+        if (graph.Streaming.HopCount)
+            resolved.HopCount = *graph.Streaming.HopCount;
+        if (graph.Streaming.Radius)
+            resolved.Radius = *graph.Streaming.Radius;
+        if (graph.Streaming.ResidentZoneCap)
+            resolved.ResidentZoneCap = *graph.Streaming.ResidentZoneCap;
+        break;
+    }
+    return resolved;
 }
 
 bool EndpointAllowsOutgoing(DockSide side, uint32_t directions)
@@ -65,43 +70,17 @@ double BoundsVolume(const Aabb3d& bounds)
         * static_cast<double>(extent[2]);
 }
 
-} // namespace
-
-WorldPartitionStreamingConfig
-ResolveGraphStreamingConfig(const WorldPartitionManifest& manifest, ZoneId focus,
-                             const WorldPartitionStreamingConfig& base)
-{
-    WorldPartitionStreamingConfig resolved = base;
-    if (!focus.IsValid())
-        return resolved;
-
-    GraphId focusGraph;
-    for (const ZoneHeader& header : manifest.Zones)
-        if (header.Id == focus)
-            focusGraph = header.Graph;
-
-    for (const GraphRecord& graph : manifest.Graphs)
-    {
-        if (graph.Id != focusGraph)
-            continue;
-        if (graph.Streaming.HopCount)
-            resolved.HopCount = *graph.Streaming.HopCount;
-        if (graph.Streaming.Radius)
-            resolved.Radius = *graph.Streaming.Radius;
-        if (graph.Streaming.ResidentZoneCap)
-            resolved.ResidentZoneCap = *graph.Streaming.ResidentZoneCap;
-        break;
-    }
-    return resolved;
-}
-
-ZoneContainmentResult ResolveZoneAt(const WorldPartitionManifest& manifest,
-                                    Vec3d position, ZoneId preferred)
+// Containment half of ResolveZoneAt over the headers (ascending positions in
+// manifest.Zones) whose bounds hold the position. Chosen stays invalid when
+// there are none; the caller falls back to nearest.
+ZoneContainmentResult ChooseContainingZone(const WorldPartitionManifest& manifest,
+                                           std::span<const uint32_t> containing,
+                                           ZoneId preferred)
 {
     ZoneContainmentResult result;
-    for (const ZoneHeader& header : manifest.Zones)
-        if (header.Bounds.Contains(position))
-            result.Candidates.push_back(header.Id);
+    result.Candidates.reserve(containing.size());
+    for (const uint32_t header : containing)
+        result.Candidates.push_back(manifest.Zones[header].Id);
     std::sort(result.Candidates.begin(), result.Candidates.end(),
               [](ZoneId a, ZoneId b) { return a.Value < b.Value; });
     result.Ambiguous = result.Candidates.size() > 1;
@@ -114,40 +93,111 @@ ZoneContainmentResult ResolveZoneAt(const WorldPartitionManifest& manifest,
     }
 
     const ZoneHeader* best = nullptr;
-    for (const ZoneHeader& header : manifest.Zones)
+    for (const uint32_t index : containing)
     {
-        if (!header.Bounds.Contains(position))
-            continue;
+        const ZoneHeader& header = manifest.Zones[index];
         if (best == nullptr || BoundsVolume(header.Bounds) < BoundsVolume(best->Bounds)
             || (BoundsVolume(header.Bounds) == BoundsVolume(best->Bounds)
                 && header.Id.Value < best->Id.Value))
             best = &header;
     }
     if (best != nullptr)
-    {
         result.Chosen = best->Id;
-        return result;
+    return result;
+}
+
+// Prediction tuning. A trajectory hit always outranks history alone, and a
+// zone's history speaks only once it has seen a few departures.
+constexpr size_t kMaxPredictedZones = 3;
+constexpr int32_t kPredictedSteps = 2;
+constexpr double kPredictMinSpeed = 0.1;
+// Lateral slack per unit travelled before the plane, so a focus that is still
+// turning toward a dock already predicts it.
+constexpr double kPredictAimSlack = 0.25;
+constexpr uint32_t kPredictMinDepartures = 3;
+constexpr double kPredictHistoryShare = 0.5;
+
+struct PredictedDockHit
+{
+    const DockEndpoint* Dock = nullptr;
+    double Seconds = 0.0;
+};
+
+// The first outgoing dock of `zone` whose plane the ray from `origin` reaches
+// within `limitSeconds` of the prediction's start, skipping the way back.
+std::optional<PredictedDockHit> FirstPredictedDockHit(
+    const WorldPartitionIndex& index, ZoneId zone, ZoneId cameFrom,
+    Vec3d origin, Vec3d velocity, double startSeconds, double limitSeconds)
+{
+    const double speed = velocity.Magnitude();
+    std::optional<PredictedDockHit> best;
+    for (const DockEndpoint& dock : index.DocksFrom(zone))
+    {
+        if (!EndpointAllowsOutgoing(dock.Side, dock.Directions) || dock.OtherZone == cameFrom)
+            continue;
+        const double normalSpeed = velocity.Dot(dock.Normal);
+        if (normalSpeed <= 1e-6)
+            continue;
+        // At or past the plane already: the crossing is this frame's, or it is
+        // being held back for residency.
+        const double side = (origin - dock.Origin).Dot(dock.Normal);
+        const double toPlane = side >= 0.0 ? 0.0 : -side / normalSpeed;
+        const double seconds = startSeconds + toPlane;
+        if (seconds > limitSeconds)
+            continue;
+
+        const Vec3d local = origin + velocity * static_cast<float>(toPlane) - dock.Origin;
+        const double slack = kPredictAimSlack * speed * seconds;
+        if (std::abs(local.Dot(dock.Right)) > dock.HalfExtents.X + slack
+            || std::abs(local.Dot(dock.Up)) > dock.HalfExtents.Y + slack)
+            continue;
+        if (!best || seconds < best->Seconds
+            || (seconds == best->Seconds && dock.Id.Value < best->Dock->Id.Value))
+            best = PredictedDockHit{ &dock, seconds };
     }
+    return best;
+}
+
+} // namespace
+
+WorldPartitionStreamingConfig
+ResolveGraphStreamingConfig(const WorldPartitionManifest& manifest, ZoneId focus,
+                             const WorldPartitionStreamingConfig& base)
+{
+    if (!focus.IsValid())
+        return base;
+
+    GraphId focusGraph;
+    for (const ZoneHeader& header : manifest.Zones)
+        if (header.Id == focus)
+            focusGraph = header.Graph;
+    return ResolveStreamingConfigForGraph(manifest, focusGraph, base);
+}
+
+ZoneContainmentResult ResolveZoneAt(const WorldPartitionManifest& manifest,
+                                    Vec3d position, ZoneId preferred)
+{
+    std::vector<uint32_t> containing;
+    for (uint32_t i = 0; i < manifest.Zones.size(); ++i)
+        if (manifest.Zones[i].Bounds.Contains(position))
+            containing.push_back(i);
+    ZoneContainmentResult result = ChooseContainingZone(manifest, containing, preferred);
+    if (!containing.empty())
+        return result;
 
     // Inside no zone: the nearest bounds wins (ties: smaller volume, then
     // id). Derived bounds hug authored geometry, so a pawn standing on a
     // floor slab or airborne is routinely outside every box; keeping the
     // previous focus would freeze streaming on whatever zone was entered
     // last. Previous survives only when no zone has valid bounds.
+    const ZoneHeader* best = nullptr;
     double bestDistanceSq = 0.0;
     double bestVolume = 0.0;
     for (const ZoneHeader& header : manifest.Zones)
     {
         if (!header.Bounds.IsValid())
             continue;
-        Vec3d closest;
-        for (int axis = 0; axis < 3; ++axis)
-            closest[axis] = std::clamp(position[axis], header.Bounds.Min[axis],
-                                       header.Bounds.Max[axis]);
-        const Vec3d delta = closest - position;
-        const double distanceSq = static_cast<double>(delta[0]) * delta[0]
-            + static_cast<double>(delta[1]) * delta[1]
-            + static_cast<double>(delta[2]) * delta[2];
+        const double distanceSq = ZoneBoundsDistanceSq(header.Bounds, position);
         const double volume = BoundsVolume(header.Bounds);
         const bool better = best == nullptr || distanceSq < bestDistanceSq
             || (distanceSq == bestDistanceSq
@@ -164,21 +214,45 @@ ZoneContainmentResult ResolveZoneAt(const WorldPartitionManifest& manifest,
     return result;
 }
 
+ZoneContainmentResult ResolveZoneAt(const WorldPartitionManifest& manifest,
+                                    const WorldPartitionIndex& index,
+                                    Vec3d position, ZoneId preferred)
+{
+    std::vector<uint32_t> containing;
+    index.ZonesContaining(position, containing);
+    std::sort(containing.begin(), containing.end());
+    ZoneContainmentResult result = ChooseContainingZone(manifest, containing, preferred);
+    if (!containing.empty())
+        return result;
+
+    const uint32_t nearest = index.NearestZone(position);
+    result.Chosen = nearest != WorldPartitionIndex::kNoZone ? manifest.Zones[nearest].Id
+                                                            : preferred;
+    return result;
+}
+
 ZoneId ResolveFocusZone(const WorldPartitionManifest& manifest, Vec3d position,
                         ZoneId previous)
 {
     return ResolveZoneAt(manifest, position, previous).Chosen;
 }
 
+ZoneId ResolveFocusZone(const WorldPartitionManifest& manifest,
+                        const WorldPartitionIndex& index,
+                        Vec3d position, ZoneId previous)
+{
+    return ResolveZoneAt(manifest, index, position, previous).Chosen;
+}
+
 std::vector<ZoneHopRank> ComputeZoneHopRanks(const WorldPartitionManifest& manifest,
                                              const WorldPartitionIndex& index,
                                              ZoneId focus,
                                              int32_t hopCount)
 {
-    if (!focus.IsValid() || !ZoneExists(manifest, focus))
+    if (!focus.IsValid() || !index.ContainsZone(focus))
         return {};
 
-    const GraphId focusGraph = GraphOf(manifest, focus);
+    const GraphId focusGraph = index.GraphOf(focus);
 
     std::vector<ZoneHopRank> ranks;
     ranks.push_back(ZoneHopRank{ focus, 0, 0.0,
@@ -211,10 +285,10 @@ std::vector<ZoneHopRank> ComputeZoneHopRanks(const WorldPartitionManifest& manif
         // The frontier zone's graph is the same for every edge leaving it, and
         // a high-degree zone leaves a lot of them; resolving it per edge made
         // the BFS cost the zone count times the degree.
-        const GraphId currentGraph = GraphOf(manifest, current.Zone);
+        const GraphId currentGraph = index.GraphOf(current.Zone);
         const auto consider = [&](ZoneId destination, uint64_t endpointId)
         {
-            const ZoneHeader* destinationHeader = FindZoneHeader(manifest, destination);
+            const ZoneHeader* destinationHeader = FindZoneHeader(manifest, index, destination);
             if (destinationHeader == nullptr)
                 return;
             const GraphId destinationGraph = destinationHeader->Graph;
@@ -230,7 +304,8 @@ std::vector<ZoneHopRank> ComputeZoneHopRanks(const WorldPartitionManifest& manif
                 WorldPartitionStreamingConfig destinationBase;
                 destinationBase.HopCount = hopCount;
                 farRemaining = std::max(
-                    0, ResolveGraphStreamingConfig(manifest, destination, destinationBase).HopCount);
+                    0, ResolveStreamingConfigForGraph(manifest, destinationGraph, destinationBase)
+                           .HopCount);
             }
             const int32_t farHop = current.Hop + 1;
 
@@ -273,6 +348,23 @@ std::vector<ZoneDemandRecord> ComputeZoneDemand(const WorldPartitionManifest& ma
                                                 std::span<const ZonePin> pins,
                                                 const WorldPartitionStreamingConfig& config,
                                                 const Vec3d* focusPosition)
+{
+    const WorldPartitionStreamingConfig focusConfig =
+        ResolveStreamingConfigForGraph(manifest, index.GraphOf(focus), config);
+    const std::vector<ZoneHopRank> ranks =
+        ComputeZoneHopRanks(manifest, index, focus, focusConfig.HopCount);
+    return ComputeZoneDemandFromRanks(manifest, index, focus, ranks, pins, config,
+                                      focusPosition);
+}
+
+std::vector<ZoneDemandRecord> ComputeZoneDemandFromRanks(
+    const WorldPartitionManifest& manifest,
+    const WorldPartitionIndex& index,
+    ZoneId focus,
+    std::span<const ZoneHopRank> ranks,
+    std::span<const ZonePin> pins,
+    const WorldPartitionStreamingConfig& config,
+    const Vec3d* focusPosition)
 {
     struct DemandEntry
     {
@@ -283,18 +375,20 @@ std::vector<ZoneDemandRecord> ComputeZoneDemand(const WorldPartitionManifest& ma
     };
 
     // The caller decides what "no focus yet" means; the policy does not guess.
-    const WorldPartitionStreamingConfig focusConfig =
-        ResolveGraphStreamingConfig(manifest, focus, config);
-    const std::vector<ZoneHopRank> ranks =
-        ComputeZoneHopRanks(manifest, index, focus, focusConfig.HopCount);
     if (ranks.empty())
         return {};
+    const WorldPartitionStreamingConfig focusConfig =
+        ResolveStreamingConfigForGraph(manifest, index.GraphOf(focus), config);
 
     const ZoneParticipation preload{ .Visible = config.NeighborVisible,
                                      .Physics = config.NeighborPhysics };
 
     std::vector<DemandEntry> entries;
     entries.reserve(ranks.size());
+    // Radius demand can add far more entries than the graph does, so entries
+    // are found by zone through a map rather than a scan.
+    std::unordered_map<uint64_t, size_t> entrySlots;
+    entrySlots.reserve(ranks.size());
     for (const ZoneHopRank& rank : ranks)
     {
         DemandEntry entry;
@@ -311,15 +405,19 @@ std::vector<ZoneDemandRecord> ComputeZoneDemand(const WorldPartitionManifest& ma
             AddReason(entry.Reasons, { rank.Reason, rank.SourceZone,
                                        rank.SourceEndpoint, rank.Hop, {} });
         }
+        entrySlots.emplace(rank.Zone.Value, entries.size());
         entries.push_back(entry);
     }
 
     const auto find = [&](ZoneId zone) -> DemandEntry*
     {
-        for (DemandEntry& entry : entries)
-            if (entry.Rank.Zone == zone)
-                return &entry;
-        return nullptr;
+        const auto it = entrySlots.find(zone.Value);
+        return it == entrySlots.end() ? nullptr : &entries[it->second];
+    };
+    const auto append = [&](DemandEntry entry)
+    {
+        entrySlots.emplace(entry.Rank.Zone.Value, entries.size());
+        entries.push_back(std::move(entry));
     };
 
     // Proximity demand: zones whose bounds' closest point lies within Radius
@@ -337,47 +435,38 @@ std::vector<ZoneDemandRecord> ComputeZoneDemand(const WorldPartitionManifest& ma
     };
     std::vector<SpatialSeed> spatialSeeds;
     if (focusPosition != nullptr)
-        spatialSeeds.push_back({ GraphOf(manifest, focus), focus, *focusPosition, focusConfig });
+        spatialSeeds.push_back({ index.GraphOf(focus), focus, *focusPosition, focusConfig });
     if (focusPosition != nullptr)
     {
         for (const ZoneHopRank& rank : ranks)
         {
-            const GraphId graph = GraphOf(manifest, rank.Zone);
+            const GraphId graph = index.GraphOf(rank.Zone);
             if (std::any_of(spatialSeeds.begin(), spatialSeeds.end(),
                             [&](const SpatialSeed& seed) { return seed.Graph == graph; }))
                 continue;
-            for (const ZoneHeader& header : manifest.Zones)
-            {
-                if (header.Id == rank.Zone && header.Bounds.IsValid())
-                {
-                    spatialSeeds.push_back({ graph, rank.Zone, header.Bounds.Center(),
-                        ResolveGraphStreamingConfig(manifest, rank.Zone, config) });
-                    break;
-                }
-            }
+            const ZoneHeader* header = FindZoneHeader(manifest, index, rank.Zone);
+            if (header != nullptr && header->Bounds.IsValid())
+                spatialSeeds.push_back({ graph, rank.Zone, header->Bounds.Center(),
+                    ResolveStreamingConfigForGraph(manifest, graph, config) });
         }
     }
 
+    // The BVH narrows each seed to the zones near it; hits are taken in
+    // manifest order so the entries come out as the full scan produced them.
+    std::vector<uint32_t> nearby;
     for (const SpatialSeed& seed : spatialSeeds)
     {
         if (seed.Config.Radius <= 0.0)
             continue;
-        for (const ZoneHeader& header : manifest.Zones)
+        nearby.clear();
+        index.ZonesWithin(seed.Position, seed.Config.Radius, nearby);
+        std::sort(nearby.begin(), nearby.end());
+        for (const uint32_t nearbyHeader : nearby)
         {
-            if (header.Id == seed.Zone || header.Graph != seed.Graph
-                || !header.Bounds.IsValid())
-                continue;
-            const Vec3d closest{
-                std::clamp(seed.Position[0], header.Bounds.Min[0], header.Bounds.Max[0]),
-                std::clamp(seed.Position[1], header.Bounds.Min[1], header.Bounds.Max[1]),
-                std::clamp(seed.Position[2], header.Bounds.Min[2], header.Bounds.Max[2])
-            };
-            const Vec3d delta = closest - seed.Position;
-            const double distanceSq = static_cast<double>(delta[0]) * delta[0]
-                + static_cast<double>(delta[1]) * delta[1]
-                + static_cast<double>(delta[2]) * delta[2];
-            if (distanceSq > seed.Config.Radius * seed.Config.Radius)
+            const ZoneHeader& header = manifest.Zones[nearbyHeader];
+            if (header.Id == seed.Zone || header.Graph != seed.Graph)
                 continue;
+            const double distanceSq = ZoneBoundsDistanceSq(header.Bounds, seed.Position);
             if (DemandEntry* existing = find(header.Id))
             {
                 existing->Desired.Visible |= preload.Visible;
@@ -397,7 +486,7 @@ std::vector<ZoneDemandRecord> ComputeZoneDemand(const WorldPartitionManifest& ma
             AddReason(entry.Reasons,
                       { ZoneDemandReason::SpatialRadius, seed.Zone, 0,
                         entry.Rank.Hop, std::sqrt(distanceSq) });
-            entries.push_back(entry);
+            append(std::move(entry));
         }
     }
 
@@ -406,7 +495,7 @@ std::vector<ZoneDemandRecord> ComputeZoneDemand(const WorldPartitionManifest& ma
     // broken content; the policy stays total.
     for (const ZonePin& pin : pins)
     {
-        if (!pin.Zone.IsValid() || !ZoneExists(manifest, pin.Zone))
+        if (!pin.Zone.IsValid() || !index.ContainsZone(pin.Zone))
             continue;
         DemandEntry* existing = find(pin.Zone);
         if (existing == nullptr)
@@ -421,7 +510,7 @@ std::vector<ZoneDemandRecord> ComputeZoneDemand(const WorldPartitionManifest& ma
                       { ZoneDemandReason::ExplicitPin, pin.Zone, 0,
                         std::numeric_limits<int32_t>::max(), {} });
             entry.Pinned = true;
-            entries.push_back(entry);
+            append(std::move(entry));
             continue;
         }
         existing->Desired.Visible |= pin.Minimum.Visible;
@@ -442,7 +531,7 @@ std::vector<ZoneDemandRecord> ComputeZoneDemand(const WorldPartitionManifest& ma
     std::vector<GraphId> demandedGraphs;
     for (const DemandEntry& entry : entries)
     {
-        const GraphId graph = GraphOf(manifest, entry.Rank.Zone);
+        const GraphId graph = index.GraphOf(entry.Rank.Zone);
         if (std::find(demandedGraphs.begin(), demandedGraphs.end(), graph) == demandedGraphs.end())
             demandedGraphs.push_back(graph);
     }
@@ -452,19 +541,17 @@ std::vector<ZoneDemandRecord> ComputeZoneDemand(const WorldPartitionManifest& ma
         std::size_t remaining = 0;
         for (std::size_t i = 0; i < entries.size(); ++i)
         {
-            if (GraphOf(manifest, entries[i].Rank.Zone) != graph)
+            if (index.GraphOf(entries[i].Rank.Zone) != graph)
                 continue;
-            if (!graphSeed.IsValid())
-                graphSeed = entries[i].Rank.Zone;
             ++remaining;
         }
-        const int32_t cap = ResolveGraphStreamingConfig(manifest, graphSeed, config)
+        const int32_t cap = ResolveStreamingConfigForGraph(manifest, graph, config)
                                 .ResidentZoneCap;
         if (remaining <= static_cast<std::size_t>(cap))
             continue;
         std::vector<size_t> evictable;
         for (size_t i = 0; i < entries.size(); ++i)
-            if (GraphOf(manifest, entries[i].Rank.Zone) == graph
+            if (index.GraphOf(entries[i].Rank.Zone) == graph
                 && entries[i].Rank.Zone != focus && !entries[i].Pinned)
                 evictable.push_back(i);
         std::sort(evictable.begin(), evictable.end(),
@@ -522,6 +609,7 @@ std::string DescribeZoneDemandReasons(const ZoneDemandRecord& record)
         { ZoneDemandReason::ExplicitPin,     "pin" },
         { ZoneDemandReason::Gameplay,        "gameplay" },
         { ZoneDemandReason::TraversalGrace,  "traversal grace" },
+        { ZoneDemandReason::Predicted,       "predicted" },
         { ZoneDemandReason::Linger,          "linger" },
     };
 
@@ -536,3 +624,109 @@ std::string DescribeZoneDemandReasons(const ZoneDemandRecord& record)
     }
     return text;
 }
+
+std::vector<ZoneDemandRecord> PredictZoneDemand(const WorldPartitionIndex& index,
+                                                ZoneId focus,
+                                                Vec3d position,
+                                                Vec3d velocity,
+                                                std::span<const ZoneTraversalCount> history,
+                                                const WorldPartitionStreamingConfig& config)
+{
+    if (config.PredictSeconds <= 0.0 || !focus.IsValid() || !index.ContainsZone(focus))
+        return {};
+
+    struct Candidate
+    {
+        ZoneId Zone;
+        double Score = 0.0;
+        std::vector<ZoneDemandReasonRecord> Reasons;
+    };
+    std::vector<Candidate> candidates;
+    const auto offer = [&](ZoneId zone, double score, ZoneDemandReasonRecord reason)
+    {
+        if (zone == focus)
+            return;
+        for (Candidate& candidate : candidates)
+        {
+            if (candidate.Zone != zone)
+                continue;
+            candidate.Score = std::max(candidate.Score, score);
+            AddReason(candidate.Reasons, std::move(reason));
+            return;
+        }
+        candidates.push_back(Candidate{ zone, score, { std::move(reason) } });
+    };
+
+    if (velocity.Magnitude() >= kPredictMinSpeed)
+    {
+        ZoneId zone = focus;
+        ZoneId cameFrom;
+        Vec3d origin = position;
+        double elapsed = 0.0;
+        for (int32_t step = 1; step <= kPredictedSteps; ++step)
+        {
+            const std::optional<PredictedDockHit> hit = FirstPredictedDockHit(
+                index, zone, cameFrom, origin, velocity, elapsed, config.PredictSeconds);
+            if (!hit)
+                break;
+            const ZoneId next = hit->Dock->OtherZone;
+            offer(next, 2.0 - hit->Seconds / config.PredictSeconds,
+                  { ZoneDemandReason::Predicted, zone, hit->Dock->Id.Value, step,
+                    hit->Seconds });
+            origin = origin + velocity * static_cast<float>(hit->Seconds - elapsed);
+            elapsed = hit->Seconds;
+            cameFrom = zone;
+            zone = next;
+            if (zone == focus)
+                break;
+        }
+    }
+
+    uint32_t departures = 0;
+    for (const ZoneTraversalCount& count : history)
+        if (count.From == focus)
+            departures += count.Count;
+    if (departures >= kPredictMinDepartures)
+    {
+        const auto share = [&](ZoneId to)
+        {
+            uint32_t taken = 0;
+            for (const ZoneTraversalCount& count : history)
+                if (count.From == focus && count.To == to)
+                    taken += count.Count;
+            return static_cast<double>(taken) / static_cast<double>(departures);
+        };
+        const auto offerByHistory = [&](ZoneId to, uint64_t endpoint, uint32_t directions,
+                                        DockSide side)
+        {
+            if (!EndpointAllowsOutgoing(side, directions))
+                return;
+            const double taken = share(to);
+            if (taken >= kPredictHistoryShare)
+                offer(to, taken, { ZoneDemandReason::Predicted, focus, endpoint, 1, {} });
+        };
+        for (const DockEndpoint& dock : index.DocksFrom(focus))
+            offerByHistory(dock.OtherZone, dock.Id.Value, dock.Directions, dock.Side);
+        for (const LinkEndpoint& link : index.LinksFrom(focus))
+            offerByHistory(link.OtherZone, link.Id.Value, link.Directions, link.Side);
+    }
+
+    std::sort(candidates.begin(), candidates.end(),
+              [](const Candidate& a, const Candidate& b)
+              {
+                  if (a.Score != b.Score)
+                      return a.Score > b.Score;
+                  return a.Zone.Value < b.Zone.Value;
+              });
+    if (candidates.size() > kMaxPredictedZones)
+        candidates.resize(kMaxPredictedZones);
+    std::sort(candidates.begin(), candidates.end(),
+              [](const Candidate& a, const Candidate& b)
+              { return a.Zone.Value < b.Zone.Value; });
+
+    std::vector<ZoneDemandRecord> records;
+    records.reserve(candidates.size());
+    for (Candidate& candidate : candidates)
+        records.push_back(ZoneDemandRecord{ candidate.Zone, {}, std::move(candidate.Reasons) });
+    return records;
+}
@@ -0,0 +1,126 @@
+#include <zone/ZoneDetachCapture.h>
+
+#include <ecs/DetachedPartition.h>
+#include <ecs/World.h>
+#include <world/identity/PersistentIdComponent.h>
+
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <unordered_set>
+#include <vector>
+
+namespace
+{
+std::uint32_t FindColumn(const DetachedArchetype& block, ComponentId id)
+{
+    if (id == InvalidComponentId)
+        return UINT32_MAX;
+    for (std::uint32_t col = 0; col < block.Columns.size(); ++col)
+        if (block.Columns[col].Id == id)
+            return col;
+    return UINT32_MAX;
+}
+
+const ZoneComponentRecord* FindRecord(const ZoneComponentRecords& records,
+                                      std::uint64_t id,
+                                      ComponentTypeId type)
+{
+    const auto it = records.find(id);
+    if (it == records.end())
+        return nullptr;
+    for (const ZoneComponentRecord& record : it->second)
+        if (record.Type == type)
+            return &record;
+    return nullptr;
+}
+
+struct TrackedColumn
+{
+    ComponentTypeId Type;
+    std::uint32_t Column = UINT32_MAX;
+    std::size_t Stride = 0;
+};
+}
+
+ZoneDetachColumns ResolveZoneDetachColumns(const World& world, const ZoneStateStore& store)
+{
+    ZoneDetachColumns columns;
+    if (world.IsRegistered<PersistentIdComponent>())
+        columns.PersistentId = world.GetComponentId<PersistentIdComponent>();
+    for (const ComponentTypeId type : store.TrackedComponents())
+    {
+        const ComponentId id = world.GetComponentIdByType(type);
+        if (id != InvalidComponentId)
+            columns.Components.push_back({ type, id });
+    }
+    return columns;
+}
+
+ZoneDetachCapture CaptureZoneDetach(
+    const ZoneStateBaseline& baseline,
+    const DetachedPartition& detached,
+    const ZoneDetachColumns& columns)
+{
+    ZoneDetachCapture capture;
+    capture.HasBaseline = !baseline.Authored.empty();
+    if (!capture.HasBaseline)
+        return capture;
+
+    std::unordered_set<std::uint64_t> live;
+    live.reserve(baseline.Authored.size());
+    std::vector<TrackedColumn> tracked;
+
+    for (const DetachedArchetype& block : detached.Archetypes)
+    {
+        const std::uint32_t idColumn = FindColumn(block, columns.PersistentId);
+        if (idColumn == UINT32_MAX)
+            continue;
+
+        tracked.clear();
+        for (const ZoneDetachColumns::Tracked& component : columns.Components)
+        {
+            const std::uint32_t col = FindColumn(block, component.Id);
+            if (col != UINT32_MAX)
+                tracked.push_back({ component.Type, col, block.Columns[col].Stride });
+        }
+
+        for (const auto& chunk : block.Chunks)
+        {
+            const std::span<const PersistentIdComponent> ids =
+                chunk->ColumnSpan<PersistentIdComponent>(idColumn);
+            for (std::uint32_t row = 0; row < chunk->RowCount; ++row)
+            {
+                const std::uint64_t id = ids[row].Id.Value;
+                if (!ids[row].Id.IsValid() || !baseline.Authored.contains(id))
+                    continue;
+                live.insert(id);
+
+                for (const TrackedColumn& column : tracked)
+                {
+                    // A component the cooked scene did not author on this
+                    // entity has no value to deviate from.
+                    const ZoneComponentRecord* authored =
+                        FindRecord(baseline.AuthoredComponents, id, column.Type);
+                    if (authored == nullptr)
+                        continue;
+
+                    const std::byte* value = reinterpret_cast<const std::byte*>(
+                        chunk->ColumnData(column.Column) + row * column.Stride);
+                    const bool matches = authored->Bytes.size() == column.Stride
+                        && std::memcmp(authored->Bytes.data(), value, column.Stride) == 0;
+                    if (!matches)
+                        capture.Modified[id].push_back(
+                            ZoneComponentRecord{ column.Type, { value, value + column.Stride } });
+                    else if (baseline.Recorded.contains(id))
+                        capture.Modified[id].push_back(ZoneComponentRecord{ column.Type, {} });
+                }
+            }
+        }
+    }
+
+    for (const std::uint64_t authored : baseline.Authored)
+        if (!live.contains(authored))
+            capture.Destroyed.insert(authored);
+    return capture;
+}
@@ -1,18 +1,26 @@
 #include <zone/ZonePackageImporter.h>
 
+#include <core/serialization/BinaryArchive.h>
+#include <core/serialization/BinaryReader.h>
 #include <core/serialization/JsonArchive.h>
+#include <core/serialization/SpanReader.h>
 #include <ecs/WorldComponentSchema.h>
 #include <world/RuntimeWorld.h>
 #include <world/identity/PersistentIdComponent.h>
 #include <world/serialization/ComponentSerializerRegistry.h>
+#include <world/serialization/SceneAssetTable.h>
 #include <world/serialization/SceneSerializationContext.h>
 #include <world/transform/DerivedTransform.h>
 #include <world/transform/TransformComponents.h>
 #include <zone/ZoneLoadPackage.h>
 #include <zone/ZoneStateStore.h>
 
+#include <algorithm>
+#include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
@@ -100,6 +108,32 @@ bool BuildEntitySignature(
     return true;
 }
 
+// A SerializedBinary record decodes through the package's own asset table, set
+// on the context for the one call: the table is the import's, the context is
+// the caller's and may be shared.
+bool DecodeBinaryComponent(
+    IComponentSerializer& serializer,
+    std::span<const std::byte> record,
+    World& world,
+    EntityId entity,
+    SceneSerializationContext& sceneContext,
+    SceneAssetTable& assetTable)
+{
+    SpanReader span(record);
+    BinaryReader reader(span);
+    BinaryReadArchive archive(reader);
+
+    SceneAssetTable* const previous = sceneContext.AssetTable;
+    sceneContext.AssetTable = &assetTable;
+    const bool loaded = serializer.LoadIntoWorld(archive, entity, world, sceneContext)
+        && archive.Ok();
+    sceneContext.AssetTable = previous;
+
+    // A record the decoder did not consume to its end was written by another
+    // layout of the component.
+    return loaded && reader.AtEnd();
+}
+
 bool ImportComponent(
     World& world,
     EntityId entity,
@@ -107,6 +141,7 @@ bool ImportComponent(
     const ZonePackageComponent& component,
     const ComponentSerializerRegistry* serializers,
     SceneSerializationContext* sceneContext,
+    SceneAssetTable& assetTable,
     std::string& failure)
 {
     const WorldComponentSchema::Entry* entry = schema.Find(component.Type);
@@ -117,7 +152,7 @@ bool ImportComponent(
         return false;
     }
 
-    if (component.SerializedJson.has_value())
+    if (!component.HasRuntimeBytes())
     {
         if (serializers == nullptr || sceneContext == nullptr)
         {
@@ -135,13 +170,28 @@ bool ImportComponent(
             return false;
         }
 
-        JsonReadArchive archive(*component.SerializedJson);
-        if (!serializer->LoadIntoWorld(
-                archive,
-                entity,
+        bool decoded = false;
+        if (component.SerializedBinary.has_value())
+        {
+            decoded = DecodeBinaryComponent(
+                *serializer,
+                *component.SerializedBinary,
                 world,
-                *sceneContext)
-            || !archive.Ok())
+                entity,
+                *sceneContext,
+                assetTable);
+        }
+        else
+        {
+            JsonReadArchive archive(*component.SerializedJson);
+            decoded = serializer->LoadIntoWorld(
+                          archive,
+                          entity,
+                          world,
+                          *sceneContext)
+                && archive.Ok();
+        }
+        if (!decoded)
         {
             failure = "Package serialized component decode failed.";
             return false;
@@ -167,114 +217,430 @@ bool ImportComponent(
     return true;
 }
 
-bool ImportPackageIntoPartitionImpl(
-    World& world,
-    const WorldComponentSchema& schema,
-    const ZoneLoadPackage& package,
-    StoragePartitionId partition,
-    const ComponentSerializerRegistry* serializers,
-    SceneSerializationContext* sceneContext,
-    ZoneImportError* error)
+// Writes rows [firstRow, firstRow + count) of one chunk column from the kept
+// image rows starting at keptIndex. Runs of consecutive image rows copy as one
+// memcpy; with nothing suppressed that is the whole chunk run.
+void CopyImageRows(
+    std::byte* destination,
+    const ZoneChunkImageColumn& column,
+    const std::vector<std::uint32_t>& kept,
+    std::size_t keptIndex,
+    std::uint32_t count)
 {
-    std::vector<EntityId> entities;
-    entities.reserve(package.EntityCount());
+    const std::size_t stride = column.Stride;
+    std::uint32_t done = 0;
+    while (done < count)
+    {
+        const std::uint32_t first = kept[keptIndex + done];
+        std::uint32_t run = 1;
+        while (done + run < count && kept[keptIndex + done + run] == first + run)
+            ++run;
+        std::memcpy(destination + static_cast<std::size_t>(done) * stride,
+                    column.Bytes.data() + static_cast<std::size_t>(first) * stride,
+                    static_cast<std::size_t>(run) * stride);
+        done += run;
+    }
+}
 
-    const auto fail = [&](std::string message)
+// One package's rows going into one partition, at most a step's budget of
+// them at a time. The stages run in the order the one-shot import always ran
+// them: the chunk image, a run of rows per chunk, then the remaining entities
+// a row each, parent wiring, and the zone state baseline. A failing stage
+// destroys every entity this import created and leaves the import failed.
+class PackageRowImport
+{
+public:
+    using Status = ZonePackageImport::Status;
+
+    PackageRowImport(
+        World& world,
+        const WorldComponentSchema& schema,
+        const ZoneLoadPackage& package,
+        StoragePartitionId partition,
+        const ComponentSerializerRegistry* serializers,
+        SceneSerializationContext* sceneContext)
+        : World_(world)
+        , Schema_(schema)
+        , Package_(package)
+        , Partition_(partition)
+        , Serializers_(serializers)
+        , SceneContext_(sceneContext)
+        // The zone state overlay: entities recorded destroyed in a prior
+        // residency are not re-created. Worlds without the store (editor
+        // documents, plain test worlds) import the cooked scene verbatim.
+        , ZoneState_(world.TryGetResource<ZoneStateStore>())
+        , Entities_(package.EntityCount())
     {
-        for (auto it = entities.rbegin(); it != entities.rend(); ++it)
-            if (it->IsValid() && world.IsAlive(*it))
-                world.DestroyEntity(*it);
-        SetError(error, std::move(message));
-        return false;
+    }
+
+    ~PackageRowImport() { ReleaseAssetTable(); }
+
+    PackageRowImport(const PackageRowImport&) = delete;
+    PackageRowImport& operator=(const PackageRowImport&) = delete;
+
+    [[nodiscard]] Status Step(std::size_t maxRows, ZoneImportError* error);
+    [[nodiscard]] std::size_t ImportedRows() const { return ImportedRows_; }
+
+private:
+    enum class Stage : std::uint8_t
+    {
+        Prepare,
+        ChunkImage,
+        Entities,
+        Parents,
+        Authored,
+        Tracked,
+        Done,
+        Failed,
     };
 
-    // The zone state overlay: entities recorded destroyed in a prior residency
-    // are not re-created. Worlds without the store (editor documents, plain
-    // test worlds) import the cooked scene verbatim.
-    const ZoneStateStore* zoneState = world.TryGetResource<ZoneStateStore>();
+    [[nodiscard]] bool IsSuppressed(const ZonePackageEntity& packageEntity) const
+    {
+        return ZoneState_ != nullptr && packageEntity.PersistentId.IsValid()
+            && ZoneState_->IsRecordedDestroyed(Package_.Zone(), packageEntity.PersistentId);
+    }
+
+    bool Prepare(std::string& failure);
+    bool ResolveAssetTable(std::string& failure);
+    void ReleaseAssetTable();
+    bool BeginBlock(const ZoneChunkImageBlock& block, std::string& failure);
+    bool ImportChunkImage(std::size_t& budget, std::string& failure);
+    bool ImportEntities(std::size_t& budget, std::string& failure);
+    void WireParents();
+    void RecordAuthored(std::size_t& budget);
+    void ApplyTrackedComponentState(std::size_t& budget);
+    void DestroyCreated();
+
+    World& World_;
+    const WorldComponentSchema& Schema_;
+    const ZoneLoadPackage& Package_;
+    StoragePartitionId Partition_;
+    const ComponentSerializerRegistry* Serializers_;
+    SceneSerializationContext* SceneContext_;
+    ZoneStateStore* ZoneState_;
+    Stage Stage_ = Stage::Prepare;
+
+    // Positionally aligned with the package's local ids. Slots stay invalid
+    // for suppressed entities, so parent relations that touch them drop.
+    std::vector<EntityId> Entities_;
+    std::vector<bool> Parented_;
+    bool WorldHasTransforms_ = false;
+
+    // The package's AssetRefs, resolved once in Prepare and held until the
+    // import ends so a handle shared by many binary records loads once.
+    SceneAssetTable AssetTable_;
+    std::size_t ImportedRows_ = 0;
+
+    // The chunk image block in progress: its resolved layout, the image rows
+    // that survive suppression, and how many of those already have rows.
+    std::size_t Block_ = 0;
+    bool BlockReady_ = false;
+    ArchetypeSignature Signature_;
+    std::vector<ComponentId> ColumnIds_;
+    std::vector<std::uint32_t> Kept_;
+    std::size_t KeptDone_ = 0;
+    std::vector<EntityId> Created_;
+
+    // The next package entity for the per-row and baseline stages.
+    std::size_t Next_ = 0;
+    bool AuthoredBegun_ = false;
+    std::vector<std::pair<ComponentTypeId, ComponentId>> Tracked_;
+};
+
+PackageRowImport::Status PackageRowImport::Step(std::size_t maxRows, ZoneImportError* error)
+{
+    if (Stage_ == Stage::Failed)
+        return Status::Failed;
+
+    // A step always builds at least one row, so a caller looping on Importing
+    // finishes.
+    std::size_t budget = std::max<std::size_t>(maxRows, 1);
+    std::string failure;
+    while (Stage_ != Stage::Done)
+    {
+        if (budget == 0)
+            return Status::Importing;
+
+        bool ok = true;
+        switch (Stage_)
+        {
+        case Stage::Prepare:
+            ok = Prepare(failure);
+            break;
+        case Stage::ChunkImage:
+            ok = ImportChunkImage(budget, failure);
+            break;
+        case Stage::Entities:
+            ok = ImportEntities(budget, failure);
+            break;
+        case Stage::Parents:
+            WireParents();
+            break;
+        case Stage::Authored:
+            RecordAuthored(budget);
+            break;
+        case Stage::Tracked:
+            ApplyTrackedComponentState(budget);
+            break;
+        case Stage::Done:
+        case Stage::Failed:
+            break;
+        }
 
+        if (!ok)
+        {
+            DestroyCreated();
+            ReleaseAssetTable();
+            Stage_ = Stage::Failed;
+            SetError(error, std::move(failure));
+            return Status::Failed;
+        }
+    }
+
+    // Every field holds its own reference by now.
+    ReleaseAssetTable();
+    if (error != nullptr)
+        error->Message.clear();
+    return Status::Imported;
+}
+
+bool PackageRowImport::Prepare(std::string& failure)
+{
     // Which entities are parented has to be known before any row is built, so
     // Parent joins the initial signature instead of costing a later archetype
     // transition per child.
-    std::vector<bool> parented(package.EntityCount(), false);
-    for (const ZonePackageParent& relation : package.Parents())
+    Parented_.assign(Package_.EntityCount(), false);
+    for (const ZonePackageParent& relation : Package_.Parents())
     {
-        if (!package.ContainsEntity(relation.Child)
-            || !package.ContainsEntity(relation.Parent))
+        if (!Package_.ContainsEntity(relation.Child)
+            || !Package_.ContainsEntity(relation.Parent))
         {
-            return fail("Package hierarchy references an unknown entity.");
+            failure = "Package hierarchy references an unknown entity.";
+            return false;
         }
-        parented[relation.Child.Value] = true;
+        Parented_[relation.Child.Value] = true;
     }
 
     // Resolved once: per entity these are two hash lookups that cannot change
     // mid-import, because component registration is sealed before any entity
     // exists.
-    const bool worldHasTransforms =
-        world.IsRegistered<LocalTransform>() && world.IsRegistered<WorldTransform>();
+    WorldHasTransforms_ =
+        World_.IsRegistered<LocalTransform>() && World_.IsRegistered<WorldTransform>();
 
+    if (!ResolveAssetTable(failure))
+        return false;
+
+    // Baked entities first: their rows arrive a chunk at a time with their
+    // derived and Parent columns already in place.
+    Stage_ = Stage::ChunkImage;
+    return true;
+}
+
+bool PackageRowImport::ResolveAssetTable(std::string& failure)
+{
+    const std::span<const ZonePackageAssetRef> refs = Package_.AssetRefs();
+    if (refs.empty())
+        return true;
+
+    // Binary handle fields index the table in package order, so interning has
+    // to reproduce that order exactly; a repeated entry would shift it.
+    for (std::size_t index = 0; index < refs.size(); ++index)
+    {
+        if (AssetTable_.Intern(refs[index].Type, refs[index].Path, refs[index].Id) != index)
+        {
+            failure = "Package asset table repeats an entry.";
+            return false;
+        }
+    }
+
+    // Without an AssetSystem the table stays unresolved and only a handle
+    // field that needs it fails, as in LoadSceneBinary.
+    if (SceneContext_ != nullptr && SceneContext_->Assets != nullptr)
+        AssetTable_.Resolve(*SceneContext_->Assets);
+    return true;
+}
+
+void PackageRowImport::ReleaseAssetTable()
+{
+    if (SceneContext_ != nullptr && SceneContext_->Assets != nullptr)
+        AssetTable_.ReleaseAll(*SceneContext_->Assets);
+}
+
+bool PackageRowImport::BeginBlock(const ZoneChunkImageBlock& block, std::string& failure)
+{
+    Signature_.reset();
+    ColumnIds_.clear();
+    for (const ZoneChunkImageColumn& column : block.Columns)
+    {
+        const WorldComponentSchema::Entry* entry = Schema_.Find(column.Type);
+        const ComponentId id = World_.GetComponentIdByType(column.Type);
+        if (entry == nullptr || id == InvalidComponentId)
+        {
+            failure = "Package chunk image column is not registered in the "
+                      "destination world.";
+            return false;
+        }
+        if (column.Stride == 0 || entry->Size != column.Stride
+            || column.Bytes.size() != column.Stride * block.Rows.size())
+        {
+            failure = "Package chunk image column does not match the "
+                      "runtime schema.";
+            return false;
+        }
+        Signature_.set(id);
+        ColumnIds_.push_back(id);
+    }
+    for (const ComponentTypeId tag : block.Tags)
+    {
+        const ComponentId id = World_.GetComponentIdByType(tag);
+        if (Schema_.Find(tag) == nullptr || id == InvalidComponentId)
+        {
+            failure = "Package chunk image tag is not registered in the "
+                      "destination world.";
+            return false;
+        }
+        Signature_.set(id);
+    }
+
+    // Entities recorded destroyed are left out of the copy rather than
+    // created and destroyed.
+    const std::span<const ZonePackageEntity> packageEntities = Package_.Entities();
+    Kept_.clear();
+    for (std::uint32_t row = 0; row < block.Rows.size(); ++row)
+        if (!IsSuppressed(packageEntities[block.Rows[row].Value]))
+            Kept_.push_back(row);
+    KeptDone_ = 0;
+    BlockReady_ = true;
+    return true;
+}
+
+// The memcpy half of the import: every block of the package's chunk image
+// becomes rows at its final signature, a chunk at a time. A budget that ends
+// inside a block leaves the rest of its kept rows to the next step, which
+// fills the partly used chunk first.
+bool PackageRowImport::ImportChunkImage(std::size_t& budget, std::string& failure)
+{
+    const auto& blocks = Package_.ChunkImage().Blocks;
+    while (Block_ < blocks.size())
+    {
+        const ZoneChunkImageBlock& block = blocks[Block_];
+        if (!BlockReady_ && !BeginBlock(block, failure))
+            return false;
+        if (KeptDone_ == Kept_.size())
+        {
+            ++Block_;
+            BlockReady_ = false;
+            continue;
+        }
+        if (budget == 0)
+            return true;
+
+        const std::size_t base = KeptDone_;
+        const std::size_t count = std::min(budget, Kept_.size() - base);
+        Created_.assign(count, EntityId{});
+        World_.CreateEntitiesWithSignature(
+            Partition_,
+            Signature_,
+            Created_,
+            [&](Chunk& chunk, std::uint32_t firstRow, std::size_t firstCreated, std::uint32_t rows)
+            {
+                for (std::size_t c = 0; c < block.Columns.size(); ++c)
+                {
+                    const std::uint32_t col = chunk.FindColumn(ColumnIds_[c]);
+                    assert(col != UINT32_MAX && chunk.Columns[col].Stride == block.Columns[c].Stride);
+                    CopyImageRows(
+                        reinterpret_cast<std::byte*>(chunk.ColumnData(col))
+                            + static_cast<std::size_t>(firstRow) * block.Columns[c].Stride,
+                        block.Columns[c],
+                        Kept_,
+                        base + firstCreated,
+                        rows);
+                }
+            });
+
+        for (std::size_t i = 0; i < count; ++i)
+            Entities_[block.Rows[Kept_[base + i]].Value] = Created_[i];
+        KeptDone_ += count;
+        ImportedRows_ += count;
+        budget -= count;
+    }
+
+    Stage_ = Stage::Entities;
+    return true;
+}
+
+bool PackageRowImport::ImportEntities(std::size_t& budget, std::string& failure)
+{
+    const std::span<const ZonePackageEntity> packageEntities = Package_.Entities();
     ArchetypeSignature signature;
-    std::size_t packageIndex = 0;
-    for (const ZonePackageEntity& packageEntity : package.Entities())
+    while (Next_ < packageEntities.size())
     {
-        if (zoneState != nullptr && packageEntity.PersistentId.IsValid()
-            && zoneState->IsRecordedDestroyed(package.Zone(), packageEntity.PersistentId))
+        const ZonePackageEntity& packageEntity = packageEntities[Next_];
+        if (packageEntity.InChunkImage || IsSuppressed(packageEntity))
         {
-            // The slot stays positionally aligned with the package's local
-            // ids; parent relations that touch it are dropped below.
-            entities.push_back(EntityId{});
-            ++packageIndex;
+            ++Next_;
             continue;
         }
+        if (budget == 0)
+            return true;
 
-        std::string failure;
         if (!BuildEntitySignature(
-                world,
-                schema,
+                World_,
+                Schema_,
                 packageEntity,
-                parented[packageIndex],
+                Parented_[Next_],
                 signature,
                 failure))
         {
-            return fail(std::move(failure));
+            return false;
         }
-        ++packageIndex;
 
         // One row at its final archetype, then every column written in place.
         // Growing the entity component by component would migrate its row once
         // per component, each migration copying the columns added before it.
         const EntityId entity =
-            world.CreateEntityWithSignature(partition, signature);
-        entities.push_back(entity);
+            World_.CreateEntityWithSignature(Partition_, signature);
+        Entities_[Next_++] = entity;
+        ++ImportedRows_;
+        --budget;
 
         for (const ZonePackageComponent& component : packageEntity.Components)
         {
             if (!ImportComponent(
-                    world,
+                    World_,
                     entity,
-                    schema,
+                    Schema_,
                     component,
-                    serializers,
-                    sceneContext,
+                    Serializers_,
+                    SceneContext_,
+                    AssetTable_,
                     failure))
             {
-                return fail(std::move(failure));
+                return false;
             }
         }
 
-        SeedDerivedTransform(world, entity, worldHasTransforms);
+        SeedDerivedTransform(World_, entity, WorldHasTransforms_);
 
-        if (!PersistentIdentityAgrees(world, entity, packageEntity.PersistentId))
+        if (!PersistentIdentityAgrees(World_, entity, packageEntity.PersistentId))
         {
-            return fail("Package entity identity metadata disagrees with its "
-                        "persistent_id component.");
+            failure = "Package entity identity metadata disagrees with its "
+                      "persistent_id component.";
+            return false;
         }
     }
 
-    for (const ZonePackageParent& relation : package.Parents())
+    Next_ = 0;
+    Stage_ = Stage::Parents;
+    return true;
+}
+
+void PackageRowImport::WireParents()
+{
+    for (const ZonePackageParent& relation : Package_.Parents())
     {
-        const EntityId child = entities[relation.Child.Value];
-        const EntityId parent = entities[relation.Parent.Value];
+        const EntityId child = Entities_[relation.Child.Value];
+        const EntityId parent = Entities_[relation.Parent.Value];
         // A suppressed end leaves the relation unwired: the child imports
         // unparented, matching how destruction leaves a live orphan rather
         // than cascading.
@@ -282,86 +648,253 @@ bool ImportPackageIntoPartitionImpl(
             continue;
         // Pre-created by BuildEntitySignature whenever Parent is registered;
         // the add is the path for a world that registered it later.
-        if (!world.IsRegistered<Parent>()
-            || !world.InitializeComponent<Parent>(child, Parent{ parent }))
+        if (!World_.IsRegistered<Parent>()
+            || !World_.InitializeComponent<Parent>(child, Parent{ parent }))
+        {
+            World_.AddComponent<Parent>(child, Parent{ parent });
+        }
+    }
+    Stage_ = Stage::Authored;
+}
+
+// Successful import records what the cooked scene authored, so the detach
+// capture can diff live state against it, then lays the recorded values over
+// the rows it just built. The set goes in one id per budget unit: a large
+// zone's insertions are a frame's worth on their own.
+void PackageRowImport::RecordAuthored(std::size_t& budget)
+{
+    if (ZoneState_ == nullptr)
+    {
+        Stage_ = Stage::Done;
+        return;
+    }
+
+    const std::span<const ZonePackageEntity> packageEntities = Package_.Entities();
+    if (!AuthoredBegun_)
+    {
+        const std::size_t authored = static_cast<std::size_t>(std::count_if(
+            packageEntities.begin(), packageEntities.end(),
+            [](const ZonePackageEntity& packageEntity) { return packageEntity.PersistentId.IsValid(); }));
+        if (authored == 0)
         {
-            world.AddComponent<Parent>(child, Parent{ parent });
+            Stage_ = Stage::Done;
+            return;
         }
+        ZoneState_->BeginAuthoredSet(Package_.Zone(), authored);
+        AuthoredBegun_ = true;
     }
 
-    // Successful import records what the cooked scene authored, so the detach
-    // capture can diff live state against it.
-    if (auto* mutableState = world.TryGetResource<ZoneStateStore>())
+    while (Next_ < packageEntities.size())
     {
-        std::vector<PersistentEntityId> authored;
-        authored.reserve(package.EntityCount());
-        for (const ZonePackageEntity& packageEntity : package.Entities())
-            if (packageEntity.PersistentId.IsValid())
-                authored.push_back(packageEntity.PersistentId);
-        if (!authored.empty())
-            mutableState->RecordAuthoredSet(package.Zone(), authored);
+        if (budget == 0)
+            return;
+        ZoneState_->AddAuthored(Package_.Zone(), { &packageEntities[Next_].PersistentId, 1 });
+        ++Next_;
+        --budget;
     }
 
-    if (error != nullptr)
-        error->Message.clear();
-    return true;
+    Next_ = 0;
+    Stage_ = Stage::Done;
+    for (const ComponentTypeId type : ZoneState_->TrackedComponents())
+    {
+        const ComponentId id = World_.GetComponentIdByType(type);
+        if (id != InvalidComponentId)
+            Tracked_.emplace_back(type, id);
+    }
+    if (!Tracked_.empty())
+        Stage_ = Stage::Tracked;
 }
 
-bool ImportZonePackageImpl(
-    RuntimeWorld& runtime,
+// Tracked components (ZoneStateStore::TrackComponent): each authored value goes
+// into the baseline first, then the value recorded in an earlier residency, if
+// any, overwrites it in place. The row is already at its final signature, so
+// the overlay is a write, never a migration. A recorded component the recooked
+// entity no longer carries is skipped rather than added.
+void PackageRowImport::ApplyTrackedComponentState(std::size_t& budget)
+{
+    const std::span<const ZonePackageEntity> packageEntities = Package_.Entities();
+    while (Next_ < packageEntities.size())
+    {
+        const EntityId entity = Entities_[Next_];
+        const PersistentEntityId persistentId = packageEntities[Next_].PersistentId;
+        if (!entity.IsValid() || !persistentId.IsValid())
+        {
+            ++Next_;
+            continue;
+        }
+        if (budget == 0)
+            return;
+        ++Next_;
+        --budget;
+
+        const World::EntityChunkLocation location = World_.LocateEntity(entity);
+        for (const auto& [type, id] : Tracked_)
+        {
+            const std::uint32_t col = location.ChunkPtr->FindColumn(id);
+            if (col == UINT32_MAX)
+                continue;
+            const std::size_t stride = location.ChunkPtr->Columns[col].Stride;
+            ZoneState_->RecordAuthoredComponent(
+                Package_.Zone(),
+                persistentId,
+                type,
+                { reinterpret_cast<const std::byte*>(location.ChunkPtr->ColumnData(col))
+                      + static_cast<std::size_t>(location.Row) * stride,
+                  stride });
+        }
+
+        for (const ZoneComponentRecord& record :
+             ZoneState_->RecordedComponents(Package_.Zone(), persistentId))
+        {
+            (void)Schema_.SetComponentBytes(World_, entity, record.Type, record.Bytes);
+        }
+    }
+    Stage_ = Stage::Done;
+}
+
+void PackageRowImport::DestroyCreated()
+{
+    for (auto it = Entities_.rbegin(); it != Entities_.rend(); ++it)
+        if (it->IsValid() && World_.IsAlive(*it))
+            World_.DestroyEntity(*it);
+}
+
+bool ImportPackageIntoPartitionImpl(
+    World& world,
     const WorldComponentSchema& schema,
     const ZoneLoadPackage& package,
+    StoragePartitionId partition,
     const ComponentSerializerRegistry* serializers,
     SceneSerializationContext* sceneContext,
+    ZoneImportError* error)
+{
+    PackageRowImport rows(world, schema, package, partition, serializers, sceneContext);
+    return rows.Step(ZonePackageImport::NoLimit, error)
+        == ZonePackageImport::Status::Imported;
+}
+
+bool ImportZonePackageImpl(
+    RuntimeWorld& runtime,
+    ZonePackageImport& import,
+    ZoneId zone,
     bool publish,
     ZoneParticipation participation,
     ZoneImportError* error)
 {
-    if (!package.Zone().IsValid())
+    if (import.Step(ZonePackageImport::NoLimit, error)
+        != ZonePackageImport::Status::Imported)
     {
-        SetError(error, "Zone package has an invalid ZoneId.");
         return false;
     }
-    if (runtime.FindZone(package.Zone()) != nullptr)
+
+    if (publish
+        && !runtime.PublishZone(zone, participation))
     {
+        const bool cancelled = runtime.CancelZoneImport(zone);
+        (void)cancelled;
         SetError(
             error,
-            "Zone package targets an already loaded or importing zone.");
+            "Zone package could not publish its hidden import partition.");
         return false;
     }
 
-    RuntimeZoneRecord& importing =
-        runtime.BeginZoneImport(package.Zone());
-    if (!ImportPackageIntoPartitionImpl(
-            runtime.Entities(),
-            schema,
-            package,
+    if (error != nullptr)
+        error->Message.clear();
+    return true;
+}
+} // namespace
+
+struct ZonePackageImport::State : PackageRowImport
+{
+    using PackageRowImport::PackageRowImport;
+};
+
+ZonePackageImport::ZonePackageImport(
+    RuntimeWorld& runtime,
+    const WorldComponentSchema& schema,
+    const ZoneLoadPackage& package)
+    : Runtime_(runtime)
+    , Schema_(schema)
+    , Package_(package)
+{
+}
+
+ZonePackageImport::ZonePackageImport(
+    RuntimeWorld& runtime,
+    const WorldComponentSchema& schema,
+    const ZoneLoadPackage& package,
+    const ComponentSerializerRegistry& serializers,
+    SceneSerializationContext& sceneContext)
+    : Runtime_(runtime)
+    , Schema_(schema)
+    , Package_(package)
+    , Serializers_(&serializers)
+    , SceneContext_(&sceneContext)
+{
+}
+
+ZonePackageImport::~ZonePackageImport() = default;
+
+ZonePackageImport::Status ZonePackageImport::Step(
+    std::size_t maxRows,
+    ZoneImportError* error)
+{
+    if (Status_ != Status::Importing)
+        return Status_;
+
+    if (S_ == nullptr)
+    {
+        if (!Package_.Zone().IsValid())
+        {
+            SetError(error, "Zone package has an invalid ZoneId.");
+            Status_ = Status::Failed;
+            return Status_;
+        }
+        if (Runtime_.FindZone(Package_.Zone()) != nullptr)
+        {
+            SetError(
+                error,
+                "Zone package targets an already loaded or importing zone.");
+            Status_ = Status::Failed;
+            return Status_;
+        }
+
+        RuntimeZoneRecord& importing =
+            Runtime_.BeginZoneImport(Package_.Zone());
+        S_ = std::make_unique<State>(
+            Runtime_.Entities(),
+            Schema_,
+            Package_,
             importing.Partition,
-            serializers,
-            sceneContext,
-            error))
+            Serializers_,
+            SceneContext_);
+    }
+
+    Status_ = S_->Step(maxRows, error);
+    if (Status_ == Status::Failed)
     {
-        const bool cancelled = runtime.CancelZoneImport(package.Zone());
+        const bool cancelled = Runtime_.CancelZoneImport(Package_.Zone());
         (void)cancelled;
-        return false;
     }
+    return Status_;
+}
 
-    if (publish
-        && !runtime.PublishZone(package.Zone(), participation))
+void ZonePackageImport::Cancel()
+{
+    if (Status_ != Status::Importing)
+        return;
+    if (S_ != nullptr)
     {
-        const bool cancelled = runtime.CancelZoneImport(package.Zone());
+        const bool cancelled = Runtime_.CancelZoneImport(Package_.Zone());
         (void)cancelled;
-        SetError(
-            error,
-            "Zone package could not publish its hidden import partition.");
-        return false;
     }
+    Status_ = Status::Failed;
+}
 
-    if (error != nullptr)
-        error->Message.clear();
-    return true;
+std::size_t ZonePackageImport::ImportedRows() const
+{
+    return S_ != nullptr ? S_->ImportedRows() : 0;
 }
-} // namespace
 
 bool ImportPackageIntoPartition(
     World& world,
@@ -405,12 +938,11 @@ bool ImportZonePackageHidden(
     const ZoneLoadPackage& package,
     ZoneImportError* error)
 {
+    ZonePackageImport import(runtime, schema, package);
     return ImportZonePackageImpl(
         runtime,
-        schema,
-        package,
-        nullptr,
-        nullptr,
+        import,
+        package.Zone(),
         false,
         ZoneParticipation{},
         error);
@@ -424,12 +956,11 @@ bool ImportZonePackageHidden(
     SceneSerializationContext& sceneContext,
     ZoneImportError* error)
 {
+    ZonePackageImport import(runtime, schema, package, serializers, sceneContext);
     return ImportZonePackageImpl(
         runtime,
-        schema,
-        package,
-        &serializers,
-        &sceneContext,
+        import,
+        package.Zone(),
         false,
         ZoneParticipation{},
         error);
@@ -442,12 +973,11 @@ bool ImportZonePackage(
     ZoneParticipation participation,
     ZoneImportError* error)
 {
+    ZonePackageImport import(runtime, schema, package);
     return ImportZonePackageImpl(
         runtime,
-        schema,
-        package,
-        nullptr,
-        nullptr,
+        import,
+        package.Zone(),
         true,
         participation,
         error);
@@ -462,12 +992,11 @@ bool ImportZonePackage(
     ZoneParticipation participation,
     ZoneImportError* error)
 {
+    ZonePackageImport import(runtime, schema, package, serializers, sceneContext);
     return ImportZonePackageImpl(
         runtime,
-        schema,
-        package,
-        &serializers,
-        &sceneContext,
+        import,
+        package.Zone(),
         true,
         participation,
         error);
@@ -1,12 +1,20 @@
 #include <zone/ZonePackageSceneLoader.h>
 
 #include <core/identity/Id.h>
+#include <core/serialization/BinaryArchive.h>
+#include <core/serialization/BinaryFormat.h>
+#include <core/serialization/BinaryReader.h>
+#include <core/serialization/Serialize.h>
+#include <core/serialization/SpanReader.h>
 #include <world/serialization/ComponentSerializerRegistry.h>
+#include <world/serialization/SceneAssetTable.h>
 #include <world/serialization/SceneFormat.h>
 #include <zone/ZoneLoadPackage.h>
 
 #include <cstddef>
+#include <cstring>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -17,8 +25,120 @@ void SetError(SceneLoadError* error, std::string message)
     if (error != nullptr)
         error->Message = std::move(message);
 }
+
+// The binary form of the JSON builder's identity lift: the persistent_id
+// record is a single string field. Undecodable ids leave the metadata unset
+// for the strict codec to reject at import, as on the JSON path.
+void LiftPersistentIdRecord(
+    std::span<const std::byte> record,
+    ZoneLoadPackage& package,
+    ZoneLocalEntityId entity)
+{
+    SpanReader span(record);
+    BinaryReader reader(span);
+    BinaryReadArchive archive(reader);
+    std::string text;
+    archive.Field("id", text);
+    if (!archive.Ok())
+        return;
+    if (const auto parsed = PersistentEntityIdFromString(text))
+        (void)package.SetPersistentId(entity, *parsed);
+}
+
+bool ReadBinaryRegistry(
+    BinaryReader& reader,
+    ZoneLoadPackage& package,
+    std::unordered_map<EntityIndex, ZoneLocalEntityId>& entities)
+{
+    std::uint32_t count = 0;
+    if (!Deserialize(reader, count))
+        return false;
+
+    entities.reserve(count);
+    for (std::uint32_t i = 0; i < count; ++i)
+    {
+        EntityIndex savedIndex = 0;
+        std::uint32_t savedGeneration = 0;
+        if (!Deserialize(reader, savedIndex)
+            || !Deserialize(reader, savedGeneration)
+            || !entities.emplace(savedIndex, package.CreateEntity()).second)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ReadBinaryComponentChunk(
+    BinaryReader& reader,
+    std::span<const std::byte> bytes,
+    const IComponentSerializer& serializer,
+    const std::unordered_map<EntityIndex, ZoneLocalEntityId>& entities,
+    ZoneLoadPackage& package,
+    std::string& failure)
+{
+    std::uint32_t count = 0;
+    if (!Deserialize(reader, count))
+    {
+        failure = "Scene binary component chunk is truncated.";
+        return false;
+    }
+
+    const bool liftsIdentity = serializer.JsonKey() == "persistent_id";
+    for (std::uint32_t i = 0; i < count; ++i)
+    {
+        EntityIndex savedOwner = 0;
+        std::uint32_t size = 0;
+        if (!Deserialize(reader, savedOwner) || !Deserialize(reader, size))
+        {
+            failure = "Scene binary component chunk is truncated.";
+            return false;
+        }
+
+        const std::streamoff position = reader.Tell();
+        if (position < 0 || static_cast<std::size_t>(position) > bytes.size()
+            || size > bytes.size() - static_cast<std::size_t>(position))
+        {
+            failure = "Scene binary component record overruns the scene.";
+            return false;
+        }
+
+        const auto owner = entities.find(savedOwner);
+        if (owner == entities.end())
+        {
+            failure = "Scene binary component references an unknown entity.";
+            return false;
+        }
+
+        const std::span<const std::byte> record =
+            bytes.subspan(static_cast<std::size_t>(position), size);
+        if (!package.AddSerializedBinary(owner->second, serializer.TypeId(), record))
+        {
+            failure = "Scene binary contains a duplicate component on one entity.";
+            return false;
+        }
+        if (liftsIdentity)
+            LiftPersistentIdRecord(record, package, owner->second);
+
+        if (!reader.Seek(position + static_cast<std::streamoff>(size)))
+        {
+            failure = "Scene binary component record overruns the scene.";
+            return false;
+        }
+    }
+    return true;
+}
 } // namespace
 
+bool IsBinaryScene(std::span<const std::byte> bytes)
+{
+    std::uint32_t magic = 0;
+    if (bytes.size() < sizeof(magic))
+        return false;
+    std::memcpy(&magic, bytes.data(), sizeof(magic));
+    return magic == SceneMagic;
+}
+
 bool BuildZonePackageFromSceneJson(
     const JsonValue& root,
     const ComponentSerializerRegistry& serializers,
@@ -157,3 +277,141 @@ bool BuildZonePackageFromSceneJson(
         error->Message.clear();
     return true;
 }
+
+bool BuildZonePackageFromSceneBinary(
+    std::span<const std::byte> bytes,
+    const ComponentSerializerRegistry& serializers,
+    ZoneLoadPackage& package,
+    SceneLoadError* error)
+{
+    if (!package.Zone().IsValid())
+    {
+        SetError(error, "Zone package builder requires a valid ZoneId.");
+        return false;
+    }
+
+    SpanReader span(bytes);
+    BinaryReader reader(span);
+    BinaryHeader header;
+    if (!ReadBinaryHeader(reader, header)
+        || !ValidateBinaryHeader(header, SceneMagic, SceneVersion))
+    {
+        SetError(error, "Scene binary has an invalid header.");
+        return false;
+    }
+
+    ZoneLoadPackage built(package.Zone());
+    std::unordered_map<EntityIndex, ZoneLocalEntityId> entities;
+    std::vector<std::pair<EntityIndex, EntityIndex>> hierarchy;
+    bool readRegistry = false;
+
+    while (!reader.AtEnd())
+    {
+        ChunkReader chunk;
+        if (!chunk.ReadHeader(reader))
+        {
+            SetError(error, "Scene binary has a truncated chunk.");
+            return false;
+        }
+
+        const ChunkHeader& chunkHeader = chunk.GetHeader();
+        if (chunkHeader.Id == SceneChunk::Registry)
+        {
+            if (readRegistry || !ReadBinaryRegistry(reader, built, entities))
+            {
+                SetError(error, "Scene binary has an invalid entity registry.");
+                return false;
+            }
+            readRegistry = true;
+        }
+        else if (chunkHeader.Id == SceneChunk::Hierarchy)
+        {
+            std::uint32_t count = 0;
+            bool ok = Deserialize(reader, count);
+            for (std::uint32_t i = 0; ok && i < count; ++i)
+            {
+                EntityIndex child = 0;
+                EntityIndex parent = 0;
+                ok = Deserialize(reader, child) && Deserialize(reader, parent);
+                hierarchy.emplace_back(child, parent);
+            }
+            if (!ok)
+            {
+                SetError(error, "Scene binary hierarchy is truncated.");
+                return false;
+            }
+        }
+        else if (chunkHeader.Id == SceneChunk::AssetTable)
+        {
+            SceneAssetTable table;
+            if (!table.Read(reader, chunkHeader.Version))
+            {
+                SetError(error, "Scene binary asset table is invalid.");
+                return false;
+            }
+            std::vector<ZonePackageAssetRef> refs;
+            refs.reserve(table.Entries().size());
+            for (const SceneAssetTable::Entry& entry : table.Entries())
+                refs.push_back(ZonePackageAssetRef{ entry.Type, entry.Path, entry.Id });
+            built.SetAssetRefs(std::move(refs));
+        }
+        else if (const IComponentSerializer* serializer =
+                     serializers.FindByChunkId(chunkHeader.Id))
+        {
+            // Records are split by their frames, so an unframed chunk cannot
+            // be carried without decoding it here.
+            if (chunkHeader.Version < 2 || chunkHeader.Version > SceneComponentChunkVersion)
+            {
+                SetError(error, "Scene binary component chunk has an unsupported version; "
+                                "re-save the scene.");
+                return false;
+            }
+            if (!readRegistry)
+            {
+                SetError(error, "Scene binary component chunk precedes its entity registry.");
+                return false;
+            }
+
+            std::string failure;
+            if (!ReadBinaryComponentChunk(reader, bytes, *serializer, entities, built, failure))
+            {
+                SetError(error, std::move(failure));
+                return false;
+            }
+        }
+
+        // Unknown chunks are skipped, as LoadSceneBinary does.
+        if (!chunk.Skip(reader))
+        {
+            SetError(error, "Scene binary chunk overruns its declared size.");
+            return false;
+        }
+    }
+
+    if (!readRegistry)
+    {
+        SetError(error, "Scene binary is missing its entity registry.");
+        return false;
+    }
+
+    for (const auto& [childIndex, parentIndex] : hierarchy)
+    {
+        const auto child = entities.find(childIndex);
+        const auto parent = entities.find(parentIndex);
+        if (child == entities.end() || parent == entities.end())
+        {
+            SetError(error, "Scene binary hierarchy references an unknown entity.");
+            return false;
+        }
+        if (!built.SetParent(child->second, parent->second))
+        {
+            SetError(error, "Scene binary hierarchy contains an invalid parent relation.");
+            return false;
+        }
+    }
+
+    package = std::move(built);
+    if (error != nullptr)
+        error->Message.clear();
+    return true;
+}
@@ -8,6 +8,7 @@
 
 #include <app/DefaultRenderPipeline.h>
 #include <app/Engine.h>
+#include <app/EngineConsoleBuiltins.h>
 #include <audio/AudioClipCache.h>
 #include <audio/AudioService.h>
 #include <audio/AudioSourceComponent.h>
@@ -211,6 +212,10 @@ void CubeDemoGame::OnStart(GameStartupContext&)
         graphics.Samplers);
     RuntimeAssets& runtimeAssets = RuntimeAssetState();
 
+    // Released meshes and textures stay warm under the asset.warm_cache.*
+    // budget, so walking back into a zone just left does not reload it.
+    EngineConsoleBuiltins::RegisterAssetCVars(engine.Console().Registry(), runtimeAssets.Assets);
+
     // The demo's own controls. Registered as a procedural profile so the camera
     // works without shipping input assets in the demo's generated content.
     {
@@ -358,8 +363,8 @@ void CubeDemoGame::OnStart(GameStartupContext&)
             ZoneLoadPackage& package)
         {
             *parsed = ParseDemoSceneFile(
-                "cube_demo_scene.cooked.json");
-            if (!parsed->Json)
+                "cube_demo_scene.cooked.sscn");
+            if (!parsed->Ok())
                 *parsed = ParseDemoSceneFile("cube_demo_scene.json");
 
             SceneLoadError loadError;
@@ -554,6 +559,8 @@ void CubeDemoGame::OnShutdown(GameShutdownContext&)
     Reloader.reset();
     Watcher.reset();
 #endif
+    // The warm-cache cvars call into Assets.
+    engine.Console().Registry().UnregisterOwner("assets");
     Assets.reset();
 }
 
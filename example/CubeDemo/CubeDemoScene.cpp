@@ -11,16 +11,19 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <format>
 #include <fstream>
+#include <span>
 #include <sstream>
+#include <utility>
 #include <vector>
 
 DemoSceneParse ParseDemoSceneFile(std::string_view scenePath)
 {
     DemoSceneParse result;
 
-    std::ifstream file{ std::string(scenePath) };
+    std::ifstream file{ std::string(scenePath), std::ios::binary };
     if (!file.is_open())
     {
         result.Error = std::format(
@@ -31,9 +34,19 @@ DemoSceneParse ParseDemoSceneFile(std::string_view scenePath)
 
     std::ostringstream buffer;
     buffer << file.rdbuf();
+    const std::string contents = std::move(buffer).str();
+
+    // The generator cooks the scene to binary; the authored fallback is JSON.
+    const std::span<const std::byte> bytes =
+        std::as_bytes(std::span(contents.data(), contents.size()));
+    if (IsBinaryScene(bytes))
+    {
+        result.Binary.assign(bytes.begin(), bytes.end());
+        return result;
+    }
 
     JsonParseError parseError;
-    result.Json = JsonParse(buffer.str(), &parseError);
+    result.Json = JsonParse(contents, &parseError);
     if (!result.Json)
     {
         result.Error = std::format(
@@ -50,13 +63,22 @@ bool BuildDemoScenePackage(
     const ComponentSerializerRegistry& serializers,
     SceneLoadError* error)
 {
-    if (!parsed.Json)
+    if (!parsed.Ok())
     {
         if (error != nullptr)
             error->Message = parsed.Error;
         return false;
     }
 
+    if (!parsed.Binary.empty())
+    {
+        return BuildZonePackageFromSceneBinary(
+            parsed.Binary,
+            serializers,
+            package,
+            error);
+    }
+
     return BuildZonePackageFromSceneJson(
         *parsed.Json,
         serializers,
@@ -73,7 +95,7 @@ bool FinalizeDemoScene(
     FreeCamera& freeCamera)
 {
     Logger& log = logging.GetLogger<DemoScene>();
-    if (!parsed.Json)
+    if (!parsed.Ok())
     {
         log.Error("CubeDemo: {}", parsed.Error);
         return false;
@@ -5,9 +5,11 @@
 #include <core/json/JsonValue.h>
 #include <ecs/EntityId.h>
 
+#include <cstddef>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <vector>
 
 class ComponentSerializerRegistry;
 class LoggingProvider;
@@ -23,10 +25,14 @@ struct DemoScene
     EntityId CenterCubeChild;
 };
 
+// The scene file as read: Binary holds a cooked scene, Json an authored one.
 struct DemoSceneParse
 {
     std::optional<JsonValue> Json;
+    std::vector<std::byte> Binary;
     std::string Error;
+
+    [[nodiscard]] bool Ok() const { return Json.has_value() || !Binary.empty(); }
 };
 
 DemoSceneParse ParseDemoSceneFile(std::string_view scenePath);
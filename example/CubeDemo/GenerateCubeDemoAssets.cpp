@@ -12,8 +12,8 @@
 //      path gets a stable id at first sight; renames keep theirs via the
 //      map's content hashes. The map at <assets-root>/asset_ids.json is the
 //      committed identity record — this tool only appends and rehashes.
-//   4. Emits the cooked scene, <scene-stem>.cooked.json: the authored scene
-//      with every known asset ref stamped {"id", "path"} so the runtime
+//   4. Emits the cooked scene, <scene-stem>.cooked.sscn: the authored scene
+//      in binary form, every known asset ref carrying its id so the runtime
 //      resolves by id with the path as fallback. The authored scene is
 //      never modified — it stays the editor's round-trip format.
 //
@@ -28,6 +28,9 @@
 #include <core/logging/ConsoleLogSink.h>
 #include <core/logging/LoggingProvider.h>
 #include <render/static_mesh/StaticMeshPrimitives.h>
+#include <world/serialization/ComponentSerializerRegistry.h>
+#include <world/serialization/SceneFormat.h>
+#include <world/serialization/SceneSerializer.h>
 
 #include <cstdio>
 #include <filesystem>
@@ -101,8 +104,8 @@ int main(int argc, char** argv)
     if (!serializer.WriteToFile(meshPath, StaticMeshPrimitives::BuildCube(1.0f)))
         return 1;
 
-    // Manifest, id map, and stamped cooked scene: the shared cook-scene output
-    // (one level of .smat indirection, stable ids, id-stamped scene). The demo's
+    // Manifest, id map, and binary cooked scene: the shared cook-scene output
+    // (one level of .smat indirection, stable ids, id-carrying refs). The demo's
     // asset:// mapping is the flat root/x; it has no Generated refs of its own.
     std::optional<JsonValue> sceneJson = ParseJsonFile(scenePath);
     if (!sceneJson)
@@ -114,11 +117,16 @@ int main(int argc, char** argv)
 
     std::filesystem::path cookedScenePath = scenePath;
     cookedScenePath.replace_extension();
-    cookedScenePath += ".cooked.json";
+    cookedScenePath += CookedSceneSuffix;
+
+    // The demo scene holds engine components only.
+    ComponentSerializerRegistry serializers;
+    RegisterEngineSceneSerializers(serializers);
 
     std::string cookError;
     const bool cooked = WriteCookedScene(
         *sceneJson,
+        serializers,
         /*extraRefs*/ {},
         [&outRoot](std::string_view assetPath) { return PhysicalPathFor(outRoot, assetPath); },
         outRoot / kAssetIdMapFileName,
@@ -7,6 +7,7 @@
 
 #include <app/DefaultRenderPipeline.h>
 #include <app/Engine.h>
+#include <app/EngineConsoleBuiltins.h>
 #include <app/GameModule.h>
 #include <audio/AudioSourceComponent.h>
 #include <camera/CameraRegistration.h>
@@ -30,6 +31,7 @@
 #include <render/ZoneLightmapComponent.h>
 #include <world/RuntimeWorld.h>
 #include <world/serialization/ComponentSerializerRegistry.h>
+#include <world/serialization/SceneFormat.h>
 #include <world/serialization/SceneSerializer.h>
 #include <world/transform/TransformComponents.h>
 #include <zone/ZoneLoadPackage.h>
@@ -39,11 +41,13 @@
 
 #include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <cstdio>
 #include <fstream>
 #include <memory>
 #include <optional>
+#include <span>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -67,7 +71,7 @@ void BuildScenePackage(
     const std::string& path,
     const ComponentSerializerRegistry& serializers)
 {
-    std::ifstream file(path);
+    std::ifstream file(path, std::ios::binary);
     if (!file.is_open())
     {
         result.Error = "could not open scene file '" + path + "'";
@@ -76,23 +80,42 @@ void BuildScenePackage(
 
     std::ostringstream buffer;
     buffer << file.rdbuf();
-    JsonParseError parseError;
-    const std::optional<JsonValue> json =
-        JsonParse(buffer.str(), &parseError);
-    if (!json)
-    {
-        result.Error = "scene JSON parse error at "
-            + std::to_string(parseError.Position)
-            + ": " + parseError.Message;
-        return;
-    }
+    const std::string contents = std::move(buffer).str();
 
+    // Cooked scenes are binary; a hand-written or older cooked scene is JSON
+    // text under the same name.
+    const std::span<const std::byte> bytes =
+        std::as_bytes(std::span(contents.data(), contents.size()));
     SceneLoadError loadError;
-    if (!BuildZonePackageFromSceneJson(
+    bool built = false;
+    if (IsBinaryScene(bytes))
+    {
+        built = BuildZonePackageFromSceneBinary(
+            bytes,
+            serializers,
+            package,
+            &loadError);
+    }
+    else
+    {
+        JsonParseError parseError;
+        const std::optional<JsonValue> json =
+            JsonParse(contents, &parseError);
+        if (!json)
+        {
+            result.Error = "scene JSON parse error at "
+                + std::to_string(parseError.Position)
+                + ": " + parseError.Message;
+            return;
+        }
+        built = BuildZonePackageFromSceneJson(
             *json,
             serializers,
             package,
-            &loadError))
+            &loadError);
+    }
+
+    if (!built)
     {
         result.Error = loadError.Message;
         return;
@@ -233,6 +256,10 @@ void SceneViewerGame::OnStart(GameStartupContext&)
         graphics.Samplers);
     RuntimeAssets& runtimeAssets = RuntimeAssetState();
 
+    // Released meshes and textures stay warm under the asset.warm_cache.*
+    // budget, so walking back into a zone just left does not reload it.
+    EngineConsoleBuiltins::RegisterAssetCVars(engine.Console().Registry(), runtimeAssets.Assets);
+
     // Mount: authored assets, then the cooked overlay (cooked wins), then the
     // cooked index. The index adds artifacts the physical scan cannot key,
     // notably cooked textures (asset://...png serving cooked .stex bytes);
@@ -386,7 +413,7 @@ ConsoleResult SceneViewerGame::LoadMap(
     const std::string base =
         std::string(kCookedScanRoot) + "/"
         + std::string(mapName);
-    const std::string scenePath = base + ".cooked.json";
+    const std::string scenePath = base + std::string(CookedSceneSuffix);
     const std::string manifestPath = base + ".manifest.json";
 
     std::shared_ptr<AssetPreload> preload;
@@ -551,6 +578,8 @@ void SceneViewerGame::OnShutdown(GameShutdownContext&)
     // runs at process exit after the device is gone), is what keeps a clean
     // window close from freeing GPU handles into dead graphics services.
     Preloader.reset();
+    // The warm-cache cvars call into Assets.
+    engine.Console().Registry().UnregisterOwner("assets");
     Assets.reset();
 }
 
@@ -0,0 +1,70 @@
+#!/usr/bin/env bash
+# Records the resident memory of staging a zone's textures and meshes by running
+# AssetViewBench.Generate: the anonymous memory a preload pins before its drain
+# and the process high-water mark, under the old copying read contract and the
+# ReadView contract, from loose files and from a mapped .spak; and the high-water
+# mark of LoadMaterialFromFile over a set of .smat files, through the old
+# ifstream read and through ReadView.
+#
+# Linux only (it reads /proc/self/status). Built through the profile preset and
+# pinned to the performance cores for the same reasons as bench_streaming.sh.
+# Compare two runs with bench_streaming_compare.py.
+#
+# Usage:
+#   bench_asset_views.sh [out-json]
+#     out-json  where to write the run (default build-profile/bench/asset_views.json;
+#               a .csv is written beside it)
+#
+# Environment:
+#   SENCHA_ASSET_VIEW_TEXTURES  1024x1024 RGBA textures staged (default 32)
+#   SENCHA_ASSET_VIEW_MESHES    48k-vertex meshes staged (default 16)
+#   SENCHA_ASSET_VIEW_MATERIALS .smat files loaded (default 4096)
+#   SENCHA_BENCH_CPUS           taskset CPU list, empty to disable pinning
+#   SENCHA_SKIP_BUILD           set to reuse an existing build-profile binary
+set -euo pipefail
+
+repo=$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)
+out=$(realpath -m "${1:-$repo/build-profile/bench/asset_views.json}")
+mkdir -p "$(dirname "$out")"
+
+binary="$repo/build-profile/test/runtime_tests"
+
+if [ -z "${SENCHA_SKIP_BUILD:-}" ]; then
+    echo "building profile preset (release codegen + symbols)"
+    cmake --preset profile >/dev/null
+    cmake --build --preset profile --target runtime_tests --parallel
+fi
+
+if [ ! -x "$binary" ]; then
+    echo "error: $binary not found; run without SENCHA_SKIP_BUILD" >&2
+    exit 1
+fi
+
+default_cpus=""
+if [ -r /sys/devices/cpu_core/cpus ]; then
+    default_cpus=$(cat /sys/devices/cpu_core/cpus)
+fi
+bench_cpus="${SENCHA_BENCH_CPUS-$default_cpus}"
+pin=()
+if [ -n "$bench_cpus" ] && command -v taskset >/dev/null 2>&1; then
+    pin=(taskset -c "$bench_cpus")
+    echo "pinned to CPUs $bench_cpus"
+fi
+
+echo "recording -> $out"
+SENCHA_ASSET_VIEW_BENCH_OUT="$out" \
+    "${pin[@]}" "$binary" --gtest_filter='AssetViewBench.Generate'
+
+echo
+echo "recorded metrics:"
+python3 - "$out" <<'PY'
+import json, sys
+with open(sys.argv[1]) as handle:
+    payload = json.load(handle)
+print(f"  build: {payload['build']}")
+width = max(len(m["name"]) for m in payload["metrics"])
+for metric in payload["metrics"]:
+    value = metric["value"]
+    shown = f"{value:.2f}"
+    print(f"  {metric['name']:<{width}}  {shown} {metric['unit']}")
+PY
@@ -0,0 +1,65 @@
+#!/usr/bin/env bash
+# Records cooked zone load cost at 10k and 50k entities by running
+# CookedZoneLoadBench.Generate: the same zone streamed in through
+# AsyncZoneLoader from the stamped JSON a cook used to write and from the
+# binary scene it writes now, each file dispatched on IsBinaryScene.
+#
+# Built through the profile preset like bench_streaming.sh and pinned the same
+# way. Compare two runs with bench_streaming_compare.py.
+#
+# Usage:
+#   bench_cooked_zone_load.sh [out-json]
+#     out-json  where to write the run (default build-profile/bench/cooked_zone_load.json;
+#               a .csv is written beside it)
+#
+# Environment:
+#   SENCHA_COOKED_ZONE_LOAD_REPS  timed repetitions per measurement (default 3)
+#   SENCHA_BENCH_CPUS             taskset CPU list, empty to disable pinning
+#   SENCHA_SKIP_BUILD             set to reuse an existing build-profile binary
+set -euo pipefail
+
+repo=$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)
+out=$(realpath -m "${1:-$repo/build-profile/bench/cooked_zone_load.json}")
+mkdir -p "$(dirname "$out")"
+
+binary="$repo/build-profile/test/runtime_tests"
+
+if [ -z "${SENCHA_SKIP_BUILD:-}" ]; then
+    echo "building profile preset (release codegen + symbols)"
+    cmake --preset profile >/dev/null
+    cmake --build --preset profile --target runtime_tests --parallel
+fi
+
+if [ ! -x "$binary" ]; then
+    echo "error: $binary not found; run without SENCHA_SKIP_BUILD" >&2
+    exit 1
+fi
+
+default_cpus=""
+if [ -r /sys/devices/cpu_core/cpus ]; then
+    default_cpus=$(cat /sys/devices/cpu_core/cpus)
+fi
+bench_cpus="${SENCHA_BENCH_CPUS-$default_cpus}"
+pin=()
+if [ -n "$bench_cpus" ] && command -v taskset >/dev/null 2>&1; then
+    pin=(taskset -c "$bench_cpus")
+    echo "pinned to CPUs $bench_cpus"
+fi
+
+echo "recording -> $out"
+SENCHA_COOKED_ZONE_LOAD_BENCH_OUT="$out" \
+    "${pin[@]}" "$binary" --gtest_filter='CookedZoneLoadBench.Generate'
+
+echo
+echo "recorded metrics:"
+python3 - "$out" <<'PY'
+import json, sys
+with open(sys.argv[1]) as handle:
+    payload = json.load(handle)
+print(f"  build: {payload['build']}")
+width = max(len(m["name"]) for m in payload["metrics"])
+for metric in payload["metrics"]:
+    value = metric["value"]
+    shown = f"{value:.0f}" if metric["unit"] == "count" else f"{value:.2f}"
+    print(f"  {metric['name']:<{width}}  {shown} {metric['unit']}")
+PY
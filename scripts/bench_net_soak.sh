@@ -0,0 +1,66 @@
+#!/usr/bin/env bash
+# Records a dedicated-server soak of the net stack by running NetSoakBench.Generate:
+# per-phase authority CPU per tick, wire bytes per peer, and input latency, for
+# a handful of client and entity counts on a clean and an impaired network.
+#
+# The CI gate is NetSoakBounds, which asserts the counted figures; this records
+# the timings beside them. Built through the profile preset and pinned to the
+# performance cores for the same reasons as bench_streaming.sh. Compare two
+# runs with bench_streaming_compare.py.
+#
+# Usage:
+#   bench_net_soak.sh [out-json]
+#     out-json  where to write the run (default build-profile/bench/net_soak.json;
+#               a .csv is written beside it)
+#
+# Environment:
+#   SENCHA_NET_SOAK_TICKS  ticks per scenario (default 1800)
+#   SENCHA_BENCH_CPUS      taskset CPU list, empty to disable pinning
+#   SENCHA_SKIP_BUILD      set to reuse an existing build-profile binary
+set -euo pipefail
+
+repo=$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)
+out=$(realpath -m "${1:-$repo/build-profile/bench/net_soak.json}")
+mkdir -p "$(dirname "$out")"
+
+binary="$repo/build-profile/test/runtime_tests"
+
+if [ -z "${SENCHA_SKIP_BUILD:-}" ]; then
+    echo "building profile preset (release codegen + symbols)"
+    cmake --preset profile >/dev/null
+    cmake --build --preset profile --target runtime_tests --parallel
+fi
+
+if [ ! -x "$binary" ]; then
+    echo "error: $binary not found; run without SENCHA_SKIP_BUILD" >&2
+    exit 1
+fi
+
+default_cpus=""
+if [ -r /sys/devices/cpu_core/cpus ]; then
+    default_cpus=$(cat /sys/devices/cpu_core/cpus)
+fi
+bench_cpus="${SENCHA_BENCH_CPUS-$default_cpus}"
+pin=()
+if [ -n "$bench_cpus" ] && command -v taskset >/dev/null 2>&1; then
+    pin=(taskset -c "$bench_cpus")
+    echo "pinned to CPUs $bench_cpus"
+fi
+
+echo "recording -> $out"
+SENCHA_NET_SOAK_BENCH_OUT="$out" \
+    "${pin[@]}" "$binary" --gtest_filter='NetSoakBench.Generate'
+
+echo
+echo "recorded metrics:"
+python3 - "$out" <<'PY'
+import json, sys
+with open(sys.argv[1]) as handle:
+    payload = json.load(handle)
+print(f"  build: {payload['build']}")
+width = max(len(m["name"]) for m in payload["metrics"])
+for metric in payload["metrics"]:
+    value = metric["value"]
+    shown = f"{value:.4f}" if metric["unit"] == "ms" else f"{value:.0f}"
+    print(f"  {metric['name']:<{width}}  {shown} {metric['unit']}")
+PY
@@ -0,0 +1,65 @@
+#!/usr/bin/env bash
+# Records preload wall time for a 500-asset manifest by running
+# PreloadLanesBench.Generate: one AssetPreloader pass from Begin to the last
+# commit, on the single task thread the engine used to default to and on split
+# I/O and compute pools of 1, 2, 4 and 8 compute threads. The task queue's
+# latency tracing is on, so each configuration also records per-asset queue
+# and service percentiles and the share finished past the preload deadline.
+#
+# Built through the profile preset like bench_streaming.sh. Pinning is off by
+# default here -- the point is to use more cores -- and SENCHA_BENCH_CPUS
+# restricts the run to a CPU list when wanted. Compare two runs with
+# bench_streaming_compare.py.
+#
+# Usage:
+#   bench_preload_lanes.sh [out-json]
+#     out-json  where to write the run (default build-profile/bench/preload_lanes.json;
+#               a .csv is written beside it)
+#
+# Environment:
+#   SENCHA_PRELOAD_LANES_REPS  repetitions per configuration (default 5)
+#   SENCHA_BENCH_CPUS          taskset CPU list, empty or unset for no pinning
+#   SENCHA_SKIP_BUILD          set to reuse an existing build-profile binary
+set -euo pipefail
+
+repo=$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)
+out=$(realpath -m "${1:-$repo/build-profile/bench/preload_lanes.json}")
+mkdir -p "$(dirname "$out")"
+
+binary="$repo/build-profile/test/runtime_tests"
+
+if [ -z "${SENCHA_SKIP_BUILD:-}" ]; then
+    echo "building profile preset (release codegen + symbols)"
+    cmake --preset profile >/dev/null
+    cmake --build --preset profile --target runtime_tests --parallel
+fi
+
+if [ ! -x "$binary" ]; then
+    echo "error: $binary not found; run without SENCHA_SKIP_BUILD" >&2
+    exit 1
+fi
+
+bench_cpus="${SENCHA_BENCH_CPUS:-}"
+pin=()
+if [ -n "$bench_cpus" ] && command -v taskset >/dev/null 2>&1; then
+    pin=(taskset -c "$bench_cpus")
+    echo "pinned to CPUs $bench_cpus"
+fi
+
+echo "recording -> $out"
+SENCHA_PRELOAD_LANES_BENCH_OUT="$out" \
+    "${pin[@]}" "$binary" --gtest_filter='PreloadLanesBench.Generate'
+
+echo
+echo "recorded metrics:"
+python3 - "$out" <<'PY'
+import json, sys
+with open(sys.argv[1]) as handle:
+    payload = json.load(handle)
+print(f"  build: {payload['build']}")
+width = max(len(m["name"]) for m in payload["metrics"])
+for metric in payload["metrics"]:
+    value = metric["value"]
+    shown = f"{value:.4f}" if metric["unit"] in ("ms", "%") else f"{value:.0f}"
+    print(f"  {metric['name']:<{width}}  {shown} {metric['unit']}")
+PY
@@ -10,6 +10,8 @@ Tolerances differ by unit because the quantities differ in kind:
   count   counted work (row migrations, chunk census, cache rebuilds); machine
           independent, so any increase is a regression and any decrease is an
           improvement worth reporting. No tolerance.
+  mib_s   throughput, noisy like wall clock but better when higher; the
+          tolerance applies to a drop.
 
 Millisecond metrics are also reported drift-normalized, when both runs carry
 control_memory_stream_ms. That control touches no engine code, so the ratio
@@ -126,6 +128,8 @@ def main():
         print(line)
 
         judged = normalized if normalized is not None else ratio
+        if unit == "mib_s" and judged is not None:
+            judged = -judged
 
         if unit == "count":
             if after > before:
@@ -133,7 +137,7 @@ def main():
         elif name == control:
             pass  # reported above; the control is the yardstick, not a result
         elif judged is not None and judged > args.tolerance:
-            detail = f"{before:.4f} -> {after:.4f} ms ({judged:+.1%}"
+            detail = f"{before:.4f} -> {after:.4f} {unit} ({judged:+.1%}"
             detail += " normalized)" if normalized is not None else ")"
             regressions.append(f"{name}: {detail} > {args.tolerance:.0%}")
         elif before == 0 and after > 0:
@@ -8,8 +8,13 @@ cooked mesh entity: every clone references assets the source scene already
 resolved, which is what keeps the result loadable without a second cook.
 
 Usage:
-  gen_caster_scale_scene.py --source <cooked.json> --out-dir <dir>
+  gen_caster_scale_scene.py --source <cooked.sscn> --out-dir <dir>
                             --name <stem> --casters N [--shadow-lights M]
+
+The source must be JSON text. The cook writes binary scenes, so clone from a
+scene these generators wrote, or from one read back through
+ReadCookedSceneJson. The output is JSON text under the cooked-scene name;
+loaders tell the two forms apart by their bytes.
 """
 import argparse
 import copy
@@ -90,13 +95,13 @@ def main():
         scene["hierarchy"] = []
 
     os.makedirs(args.out_dir, exist_ok=True)
-    out_scene = os.path.join(args.out_dir, args.name + ".cooked.json")
+    out_scene = os.path.join(args.out_dir, args.name + ".cooked.sscn")
     with open(out_scene, "w") as handle:
         json.dump(scene, handle, indent=1)
 
     # The manifest and the cell meshes are referenced by the clones, so the
     # sidecars travel with the scene under its new name.
-    source_stem = args.source[: -len(".cooked.json")]
+    source_stem = args.source[: -len(".cooked.sscn")]
     for suffix in (".manifest.json", ".collision.json"):
         src = source_stem + suffix
         if os.path.exists(src):
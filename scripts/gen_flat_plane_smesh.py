@@ -1,5 +1,5 @@
 #!/usr/bin/env python3
-"""Emit a flat NxN-subdivided floor plane as a v3 .smesh (SMSH container).
+"""Emit a flat NxN-subdivided floor plane as a v8 .smesh (SMSH container).
 
 A controlled-tessellation floor for the baked-direct Phase 0 spike: the same
 plane at different subdivision counts shows how per-vertex-interpolated direct
@@ -13,10 +13,10 @@ Usage: gen_flat_plane_smesh.py <size_world_units> <subdivisions> <out.smesh>
 import struct
 import sys
 
-SMESH_VERSION = 5
+SMESH_VERSION = 8
 VERTEX_STRIDE = 52   # 48-byte base + two unorm16 lightmap UVs (neutral zero)
 HEADER_SIZE = 88
-SECTION_SIZE = 48
+SECTION_SIZE = 56
 
 
 def build(size, subdiv):
@@ -66,9 +66,10 @@ def write(path, size, subdiv):
         HEADER_SIZE, section_table_off, vertex_data_off, index_data_off,
     )
     section = struct.pack(
-        "<6I6f",
+        "<6I6f2I",
         0, icount, 0, vcount, 0, 0,
         -half, 0.0, -half, half, 0.0, half,
+        0, 0,                      # MeshletCount, Reserved0
     )
     body = bytearray()
     for vtx in verts:
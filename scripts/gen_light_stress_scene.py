@@ -7,7 +7,7 @@ The mesh/material are an existing cooked asset (reused so the scene loads with
 no new cook), referenced by global asset:// path. Lights are small-range accent
 lights whose pools overlap on the floor (the many-small-lights regime).
 
-Usage: gen_light_stress_scene.py <N> <out.cooked.json>
+Usage: gen_light_stress_scene.py <N> <out.cooked.sscn>
 """
 
 import json
@@ -6,7 +6,7 @@ per-fragment light loop against per-vertex-interpolated direct light; the
 coarse-vs-fine planes show how badly interpolation smears on sparse geometry.
 
 Reads the two plane .smesh assets generated by gen_flat_plane_smesh.py.
-Usage: gen_phase0_spike_scene.py <out.cooked.json>
+Usage: gen_phase0_spike_scene.py <out.cooked.sscn>
 """
 
 import json
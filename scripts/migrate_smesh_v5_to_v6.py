@@ -0,0 +1,48 @@
+#!/usr/bin/env python3
+"""Migrate v5 .smesh files to v6 in place. v6 only added an optional
+quantized layout (a header flag); a v5 file is a valid unquantized v6 file
+once its version says so, so only the version field changes. Static and
+skinned meshes alike.
+
+Usage: migrate_smesh_v5_to_v6.py <file.smesh> [<file.smesh> ...]
+"""
+
+import struct
+import sys
+
+FLAG_QUANTIZED = 1 << 2
+
+
+def migrate(path):
+    with open(path, "rb") as f:
+        data = bytearray(f.read())
+    if data[0:4] != b"SMSH":
+        raise SystemExit(f"{path}: not a .smesh")
+    version = struct.unpack_from("<I", data, 4)[0]
+    if version == 6:
+        print(f"{path}: already v6, skipped")
+        return
+    if version != 5:
+        raise SystemExit(f"{path}: unexpected version {version}")
+    flags = struct.unpack_from("<I", data, 8)[0]
+    if flags & FLAG_QUANTIZED:
+        raise SystemExit(f"{path}: v5 file with bit 2 set, refusing to guess")
+
+    struct.pack_into("<I", data, 4, 6)  # Version -> 6
+
+    with open(path, "wb") as f:
+        f.write(data)
+    print(f"{path}: v5 -> v6")
+
+
+def main():
+    if len(sys.argv) < 2:
+        print(__doc__)
+        return 1
+    for p in sys.argv[1:]:
+        migrate(p)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
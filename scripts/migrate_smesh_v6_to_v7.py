@@ -0,0 +1,56 @@
+#!/usr/bin/env python3
+"""Migrate v6 .smesh files to v7 in place. v7 turned the section record's
+reserved field into LodCount and added an LOD table that is empty when every
+count is zero. A v6 file wrote the field as zero, so it is a LOD-free v7
+file once its version says so: only the version field changes. Static and
+skinned meshes alike.
+
+Usage: migrate_smesh_v6_to_v7.py <file.smesh> [<file.smesh> ...]
+"""
+
+import struct
+import sys
+
+SECTION_COUNT_OFFSET = 32
+SECTION_TABLE_OFFSET_OFFSET = 76
+SECTION_RECORD_SIZE = 48
+SECTION_LOD_COUNT_OFFSET = 20
+
+
+def migrate(path):
+    with open(path, "rb") as f:
+        data = bytearray(f.read())
+    if data[0:4] != b"SMSH":
+        raise SystemExit(f"{path}: not a .smesh")
+    version = struct.unpack_from("<I", data, 4)[0]
+    if version == 7:
+        print(f"{path}: already v7, skipped")
+        return
+    if version != 6:
+        raise SystemExit(f"{path}: unexpected version {version}")
+    section_count = struct.unpack_from("<I", data, SECTION_COUNT_OFFSET)[0]
+    table = struct.unpack_from("<I", data, SECTION_TABLE_OFFSET_OFFSET)[0]
+    for i in range(section_count):
+        reserved = struct.unpack_from(
+            "<I", data, table + i * SECTION_RECORD_SIZE + SECTION_LOD_COUNT_OFFSET)[0]
+        if reserved != 0:
+            raise SystemExit(f"{path}: v6 section {i} has a nonzero reserved field, refusing to guess")
+
+    struct.pack_into("<I", data, 4, 7)  # Version -> 7
+
+    with open(path, "wb") as f:
+        f.write(data)
+    print(f"{path}: v6 -> v7")
+
+
+def main():
+    if len(sys.argv) < 2:
+        print(__doc__)
+        return 1
+    for p in sys.argv[1:]:
+        migrate(p)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
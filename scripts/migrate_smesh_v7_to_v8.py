@@ -0,0 +1,74 @@
+#!/usr/bin/env python3
+"""Migrate v7 .smesh files to v8 in place. v8 widened the section record
+from 48 to 56 bytes (MeshletCount and a reserved word) and added a meshlet
+table after the LOD table that is empty when every count is zero. Each
+record gains eight zero bytes, and every offset past the section table moves
+by eight bytes per section. Static and skinned meshes alike.
+
+Usage: migrate_smesh_v7_to_v8.py <file.smesh> [<file.smesh> ...]
+"""
+
+import struct
+import sys
+
+SKINNING_DATA_OFFSET_OFFSET = 16
+SKELETON_PATH_OFFSET_OFFSET = 20
+SECTION_COUNT_OFFSET = 32
+SECTION_TABLE_OFFSET_OFFSET = 76
+VERTEX_DATA_OFFSET_OFFSET = 80
+INDEX_DATA_OFFSET_OFFSET = 84
+V7_SECTION_RECORD_SIZE = 48
+RECORD_GROWTH = 8
+
+
+def migrate(path):
+    with open(path, "rb") as f:
+        data = bytearray(f.read())
+    if data[0:4] != b"SMSH":
+        raise SystemExit(f"{path}: not a .smesh")
+    version = struct.unpack_from("<I", data, 4)[0]
+    if version == 8:
+        print(f"{path}: already v8, skipped")
+        return
+    if version != 7:
+        raise SystemExit(f"{path}: unexpected version {version}")
+    section_count = struct.unpack_from("<I", data, SECTION_COUNT_OFFSET)[0]
+    table = struct.unpack_from("<I", data, SECTION_TABLE_OFFSET_OFFSET)[0]
+    table_end = table + section_count * V7_SECTION_RECORD_SIZE
+    if table_end > len(data):
+        raise SystemExit(f"{path}: section table runs past the end of the file")
+
+    shift = section_count * RECORD_GROWTH
+    for field in (VERTEX_DATA_OFFSET_OFFSET, INDEX_DATA_OFFSET_OFFSET):
+        value = struct.unpack_from("<I", data, field)[0]
+        struct.pack_into("<I", data, field, value + shift)
+    # Zero means absent for the skinning blocks.
+    for field in (SKINNING_DATA_OFFSET_OFFSET, SKELETON_PATH_OFFSET_OFFSET):
+        value = struct.unpack_from("<I", data, field)[0]
+        if value != 0:
+            struct.pack_into("<I", data, field, value + shift)
+    struct.pack_into("<I", data, 4, 8)  # Version -> 8
+
+    widened = bytearray()
+    for i in range(section_count):
+        start = table + i * V7_SECTION_RECORD_SIZE
+        widened += data[start:start + V7_SECTION_RECORD_SIZE]
+        widened += bytes(RECORD_GROWTH)
+    data[table:table_end] = widened
+
+    with open(path, "wb") as f:
+        f.write(data)
+    print(f"{path}: v7 -> v8")
+
+
+def main():
+    if len(sys.argv) < 2:
+        print(__doc__)
+        return 1
+    for p in sys.argv[1:]:
+        migrate(p)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
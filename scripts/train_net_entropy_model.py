@@ -0,0 +1,111 @@
+#!/usr/bin/env python3
+"""Train the snapshot entropy model from captured snapshot streams.
+
+Reads one or more captures a host wrote with `net.snapshotCapture` set in
+engine.json, counts byte frequencies across every snapshot in them, and writes
+the 512-byte table `net.entropyModel` loads: 256 little-endian u16 frequencies
+summing to 4096, none zero.
+
+The scaling mirrors NetEntropyModel::FromCounts step for step, so the table is
+byte-identical to the one NetEntropyTrainer builds from the same snapshots, and
+so is the model hash both ends compare.
+
+Capture format (NetEntropyModelFile.h): "SNCP", u32 version 1, then per
+snapshot a u16 length and that many bytes, all little-endian. A torn final
+record ends the read, as it does in the engine.
+
+Usage:
+  train_net_entropy_model.py --out net/snapshots.model host_a.sncap host_b.sncap
+"""
+
+import argparse
+import math
+import struct
+import sys
+
+SCALE_BITS = 12
+SCALE = 1 << SCALE_BITS
+CAPTURE_MAGIC = b"SNCP"
+CAPTURE_VERSION = 1
+
+
+def read_capture(path, counts):
+    with open(path, "rb") as f:
+        data = f.read()
+    if len(data) < 8 or data[:4] != CAPTURE_MAGIC:
+        raise ValueError(f"{path}: not a snapshot capture")
+    (version,) = struct.unpack_from("<I", data, 4)
+    if version != CAPTURE_VERSION:
+        raise ValueError(f"{path}: capture version {version}, expected {CAPTURE_VERSION}")
+
+    snapshots = 0
+    at = 8
+    while at + 2 <= len(data):
+        (length,) = struct.unpack_from("<H", data, at)
+        at += 2
+        if at + length > len(data):
+            break
+        for byte in data[at:at + length]:
+            counts[byte] += 1
+        at += length
+        snapshots += 1
+    return snapshots
+
+
+def from_counts(counts):
+    total = sum(counts)
+    if total == 0:
+        return [SCALE // 256] * 256
+
+    freqs = [max(1, int(c * SCALE / total + 0.5)) for c in counts]
+    total_freq = sum(freqs)
+    while total_freq != SCALE:
+        # First of the most frequent, as the engine's scan picks it.
+        largest = max(range(256), key=lambda s: (freqs[s], -s))
+        if total_freq > SCALE:
+            freqs[largest] -= 1
+            total_freq -= 1
+        else:
+            freqs[largest] += 1
+            total_freq += 1
+    return freqs
+
+
+def coded_bits_per_byte(counts, freqs):
+    total = sum(counts)
+    if total == 0:
+        return 8.0
+    bits = sum(c * (SCALE_BITS - math.log2(f)) for c, f in zip(counts, freqs) if c)
+    return bits / total
+
+
+def main():
+    ap = argparse.ArgumentParser()
+    ap.add_argument("--out", required=True, help="model table to write")
+    ap.add_argument("captures", nargs="+")
+    args = ap.parse_args()
+
+    counts = [0] * 256
+    snapshots = 0
+    for path in args.captures:
+        try:
+            snapshots += read_capture(path, counts)
+        except (OSError, ValueError) as e:
+            print(f"error: {e}", file=sys.stderr)
+            return 1
+    if snapshots == 0:
+        print("error: the captures hold no snapshots", file=sys.stderr)
+        return 1
+
+    freqs = from_counts(counts)
+    with open(args.out, "wb") as f:
+        f.write(struct.pack("<256H", *freqs))
+
+    print(f"{snapshots} snapshots, {sum(counts)} bytes -> {args.out}")
+    print(f"estimated {coded_bits_per_byte(counts, freqs):.3f} bits/byte "
+          f"against the training set (8.000 raw)")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
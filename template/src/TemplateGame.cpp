@@ -6,6 +6,7 @@
 #include <abilities/AbilityKit.h>
 #include <app/DefaultRenderPipeline.h>
 #include <app/Engine.h>
+#include <app/EngineConsoleBuiltins.h>
 #ifdef SENCHA_ENABLE_DEBUG_UI
 #include <debug/MovementStatePanel.h>
 #endif
@@ -21,7 +22,9 @@
 #include <controller/LookOrientation.h>
 #include <core/assets/AssetIdMap.h>
 #include <core/assets/AssetManifest.h>
+#include <core/assets/AssetPackSource.h>
 #include <core/assets/AssetRegistry.h>
+#include <core/assets/AssetRegistryIndex.h>
 #include <core/config/EngineConfig.h>
 #include <core/console/ConsoleService.h>
 #include <core/json/JsonParser.h>
@@ -61,6 +64,7 @@
 #include <render/ZoneLightmapComponent.h>
 #include <world/RuntimeWorld.h>
 #include <world/serialization/ComponentSerializerRegistry.h>
+#include <world/serialization/SceneFormat.h>
 #include <world/serialization/SceneSerializer.h>
 #include <world/transform/TransformComponents.h>
 #include <world/transform/TransformHistory.h>
@@ -75,11 +79,14 @@
 #include <array>
 #include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <cstdio>
+#include <filesystem>
 #include <fstream>
 #include <memory>
 #include <optional>
+#include <span>
 #include <sstream>
 #include <string>
 #include <unordered_map>
@@ -90,6 +97,7 @@ namespace
 {
 constexpr std::string_view kAuthoredRoot = "assets";
 constexpr std::string_view kCookedScanRoot = "assets/.cooked";
+constexpr std::string_view kAssetPackPath = "assets.spak";
 constexpr std::string_view kPlayerMovementProfilePath =
     "asset://data/player_movement.sdata";
 constexpr std::string_view kPlayerAvatarPath =
@@ -106,11 +114,11 @@ struct SceneBuildResult
     std::string Error;
 };
 
-std::optional<JsonValue> ParseSceneFile(
+std::optional<std::string> ReadSceneFile(
     const std::string& path,
     std::string& error)
 {
-    std::ifstream file(path);
+    std::ifstream file(path, std::ios::binary);
     if (!file.is_open())
     {
         error = "could not open scene file '" + path + "'";
@@ -119,10 +127,15 @@ std::optional<JsonValue> ParseSceneFile(
 
     std::ostringstream buffer;
     buffer << file.rdbuf();
+    return std::move(buffer).str();
+}
 
+std::optional<JsonValue> ParseSceneText(
+    const std::string& text,
+    std::string& error)
+{
     JsonParseError parseError;
-    std::optional<JsonValue> json =
-        JsonParse(buffer.str(), &parseError);
+    std::optional<JsonValue> json = JsonParse(text, &parseError);
     if (!json)
     {
         error = "scene JSON parse error at "
@@ -138,21 +151,47 @@ void BuildScenePackage(
     const std::string& scenePath,
     const ComponentSerializerRegistry& serializers)
 {
-    std::string parseError;
-    const std::optional<JsonValue> json =
-        ParseSceneFile(scenePath, parseError);
-    if (!json)
+    std::string readError;
+    const std::optional<std::string> contents =
+        ReadSceneFile(scenePath, readError);
+    if (!contents)
     {
-        result.Error = std::move(parseError);
+        result.Error = std::move(readError);
         return;
     }
 
+    // The cook writes binary scenes; authored scenes and the test fixtures
+    // are JSON text. Both keep the .json name, so the bytes decide.
+    const std::span<const std::byte> bytes =
+        std::as_bytes(std::span(contents->data(), contents->size()));
     SceneLoadError loadError;
-    if (!BuildZonePackageFromSceneJson(
+    bool built = false;
+    if (IsBinaryScene(bytes))
+    {
+        built = BuildZonePackageFromSceneBinary(
+            bytes,
+            serializers,
+            package,
+            &loadError);
+    }
+    else
+    {
+        std::string parseError;
+        const std::optional<JsonValue> json =
+            ParseSceneText(*contents, parseError);
+        if (!json)
+        {
+            result.Error = std::move(parseError);
+            return;
+        }
+        built = BuildZonePackageFromSceneJson(
             *json,
             serializers,
             package,
-            &loadError))
+            &loadError);
+    }
+
+    if (!built)
     {
         result.Error = loadError.Message;
         return;
@@ -409,6 +448,57 @@ void ConfigureRuntimeResources(
     RegisterControllerComponents(world);
 }
 
+// Serves the registry from the cook's .sreg for the authored root, when there
+// is one, in place of walking it. A debug build walks anyway to compare, and
+// falls back to the walk when the index has gone stale: a file added since
+// the last cook should not go missing in development.
+bool MountRegistryIndex(
+    RuntimeAssets& assets,
+    LoggingProvider& logging)
+{
+    Logger& log = logging.GetLogger<TemplateGame>();
+    const std::string indexPath = AssetRegistryIndexPath(kAuthoredRoot);
+    if (!std::filesystem::exists(indexPath))
+        return false;
+
+    std::string error;
+    if (!assets.RegistryIndex.Open(indexPath, kAuthoredRoot, &error))
+    {
+        log.Warn("TemplateGame: ignoring {}: {}", indexPath, error);
+        return false;
+    }
+
+#ifndef NDEBUG
+    const AssetRegistryIndexCheck check = CheckAssetRegistryIndex(
+        assets.RegistryIndex,
+        assets.Assets.Kinds(),
+        logging);
+    if (!check.Matches())
+    {
+        const std::string& first = !check.Missing.empty() ? check.Missing.front()
+            : !check.Stale.empty() ? check.Stale.front()
+            : check.Extra.front();
+        log.Warn(
+            "TemplateGame: {} is stale ({} missing, {} changed, {} gone; first '{}'); "
+            "walking the assets instead",
+            indexPath,
+            check.Missing.size(),
+            check.Stale.size(),
+            check.Extra.size(),
+            first);
+        assets.RegistryIndex.Close();
+        return false;
+    }
+#endif
+
+    assets.Registry.MountIndex(&assets.RegistryIndex);
+    log.Info(
+        "TemplateGame: mounted {} ({} assets)",
+        indexPath,
+        assets.RegistryIndex.Entries().size());
+    return true;
+}
+
 struct WorldPartitionUpdateSystem
 {
     WorldPartitionUpdateSystem(
@@ -532,6 +622,8 @@ struct HotReloadPollSystem
 
 struct CharacterInputSystem
 {
+    static constexpr bool Resimulated = true;
+
     void FixedLogic(FixedLogicContext& ctx)
     {
         World& world = ctx.Entities;
@@ -610,7 +702,9 @@ struct CharacterInputSystem
                     wish = wish * (1.0f / std::sqrt(squared));
 
                 intents[index].WishDir = wish;
-                if (jump && activations != nullptr)
+                // A jump activates once, on the tick it was pressed; a replay
+                // rebuilds the intent but must not queue the ability again.
+                if (jump && activations != nullptr && !ctx.Resimulating)
                 {
                     activations->Pending.push_back(
                         { view.Entity(index), defs->Jump });
@@ -852,6 +946,10 @@ void TemplateGame::OnStart(GameStartupContext&)
         graphics.Samplers);
     RuntimeAssets& runtimeAssets = RuntimeAssetState();
 
+    // Released meshes and textures stay warm under the asset.warm_cache.*
+    // budget, so walking back into a zone just left does not reload it.
+    EngineConsoleBuiltins::RegisterAssetCVars(engine.Console().Registry(), runtimeAssets.Assets);
+
     // This game's own data subtypes, registered into the registries it owns and
     // unregistered in OnShutdown while the module is still mapped: the registry
     // holds function pointers into this module.
@@ -883,35 +981,61 @@ void TemplateGame::OnStart(GameStartupContext&)
             log.Info("TemplateGame: built a replicated player pawn");
         });
 
-    ScanAssetsDirectory(
-        std::string(kAuthoredRoot),
-        runtimeAssets.Registry,
-        runtimeAssets.Assets.Kinds());
-    ScanAssetsDirectory(
-        std::string(kCookedScanRoot),
-        runtimeAssets.Registry,
-        runtimeAssets.Assets.Kinds());
-    RegisterCookedAssets(
-        std::string(kAuthoredRoot),
-        runtimeAssets.Registry);
-
-    AssetIdMap idMap;
-    std::string idMapError;
-    const std::string idMapPath =
-        std::string(kAuthoredRoot) + "/"
-        + std::string(kAssetIdMapFileName);
-    if (AssetIdMap::LoadFromFile(
-            idMapPath,
-            idMap,
-            &idMapError))
+    // A shipping build carries its assets in one pack: register from its
+    // table of contents instead of walking directories, and read through it.
+    // Without one, the loose authored and cooked trees, registered from the
+    // cook's index of them when it has written one, and walked otherwise.
+    std::string packError;
+    if (std::filesystem::exists(kAssetPackPath)
+        && runtimeAssets.Pack.Open(kAssetPackPath, &packError))
     {
-        ApplyAssetIds(idMap, runtimeAssets.Registry);
+        runtimeAssets.Assets.MountSource(&runtimeAssets.Pack);
+        const int packed = RegisterPackedAssets(runtimeAssets.Pack, runtimeAssets.Registry);
+        logging.GetLogger<TemplateGame>().Info(
+            "TemplateGame: mounted {} ({} assets)", kAssetPackPath, packed);
     }
-    else
+    else if (!packError.empty())
     {
         logging.GetLogger<TemplateGame>().Warn(
-            "TemplateGame: no asset id map ({}); refs resolve by path only",
-            idMapError);
+            "TemplateGame: ignoring {}: {}", kAssetPackPath, packError);
+    }
+    if (!runtimeAssets.Pack.IsOpen()
+        && !MountRegistryIndex(runtimeAssets, logging))
+    {
+        ScanAssetsDirectory(
+            std::string(kAuthoredRoot),
+            runtimeAssets.Registry,
+            runtimeAssets.Assets.Kinds());
+        ScanAssetsDirectory(
+            std::string(kCookedScanRoot),
+            runtimeAssets.Registry,
+            runtimeAssets.Assets.Kinds());
+        RegisterCookedAssets(
+            std::string(kAuthoredRoot),
+            runtimeAssets.Registry);
+    }
+
+    // A mounted index already carries the ids the cook applied.
+    if (runtimeAssets.Registry.MountedIndex() == nullptr)
+    {
+        AssetIdMap idMap;
+        std::string idMapError;
+        const std::string idMapPath =
+            std::string(kAuthoredRoot) + "/"
+            + std::string(kAssetIdMapFileName);
+        if (AssetIdMap::LoadFromFile(
+                idMapPath,
+                idMap,
+                &idMapError))
+        {
+            ApplyAssetIds(idMap, runtimeAssets.Registry);
+        }
+        else
+        {
+            logging.GetLogger<TemplateGame>().Warn(
+                "TemplateGame: no asset id map ({}); refs resolve by path only",
+                idMapError);
+        }
     }
 
     ConfigureRuntimeResources(engine, runtimeAssets);
@@ -1123,7 +1247,7 @@ ConsoleResult TemplateGame::LoadMap(std::string_view mapName)
     const std::string base =
         std::string(kCookedScanRoot) + "/"
         + std::string(mapName);
-    const std::string scenePath = base + ".cooked.json";
+    const std::string scenePath = base + std::string(CookedSceneSuffix);
     const std::string manifestPath = base + ".manifest.json";
     const std::string collisionSidecar =
         base + ".collision.json";
@@ -1152,9 +1276,10 @@ ConsoleResult TemplateGame::LoadMap(std::string_view mapName)
     auto buildResult = std::make_shared<SceneBuildResult>();
     const ComponentSerializerRegistry* serializers = &engine.SceneSerializers();
     auto probes = std::make_shared<ProbeVolumeFile>();
+    auto collision = std::make_shared<RestoredZoneCollision>();
     ZoneLoader->BeginLoad(
         kPlayZone,
-        [buildResult, probes, serializers, scenePath](
+        [buildResult, probes, collision, serializers, scenePath, collisionSidecar](
             ZoneLoadPackage& package)
         {
             BuildScenePackage(
@@ -1163,8 +1288,11 @@ ConsoleResult TemplateGame::LoadMap(std::string_view mapName)
                 scenePath,
                 *serializers);
             (void)ReadZoneProbeFile(scenePath, *probes);
+            *collision = RestoreZoneCollision(
+                collisionSidecar,
+                std::string(kCookedScanRoot));
         },
-        [this, buildResult, probes, collisionSidecar, &logging](
+        [this, buildResult, probes, collision, &logging](
             RuntimeWorld& runtime,
             RuntimeZoneRecord& zone)
         {
@@ -1178,11 +1306,10 @@ ConsoleResult TemplateGame::LoadMap(std::string_view mapName)
 
             if (PhysicsShapes != nullptr)
             {
-                LoadZoneCollision(
+                InstallZoneCollision(
                     runtime.Entities(),
                     *PhysicsShapes,
-                    collisionSidecar,
-                    std::string(kCookedScanRoot),
+                    std::move(*collision),
                     zone.Partition);
             }
 
@@ -1290,19 +1417,19 @@ ConsoleResult TemplateGame::LoadWorld(std::string_view worldName)
             auto buildResult =
                 std::make_shared<SceneBuildResult>();
             auto probes = std::make_shared<ProbeVolumeFile>();
+            auto collision = std::make_shared<RestoredZoneCollision>();
 
             ZoneLoadRecipe recipe;
             // Warm the zone's assets (meshes, materials, the lightmap atlas)
             // before attach, the same manifest convention as the map path:
-            // the manifest sits beside the cooked scene (.cooked.json ->
+            // the manifest sits beside the cooked scene (.cooked.sscn ->
             // .manifest.json). Missing manifest = resolve-on-attach fallback.
             {
                 std::string assetManifestPath = scenePath;
-                constexpr std::string_view cookedSuffix = ".cooked.json";
-                if (assetManifestPath.ends_with(cookedSuffix))
+                if (assetManifestPath.ends_with(CookedSceneSuffix))
                 {
                     assetManifestPath.resize(
-                        assetManifestPath.size() - cookedSuffix.size());
+                        assetManifestPath.size() - CookedSceneSuffix.size());
                     assetManifestPath += ".manifest.json";
                     AssetManifest assetManifest;
                     if (Preloader.has_value()
@@ -1313,8 +1440,10 @@ ConsoleResult TemplateGame::LoadWorld(std::string_view worldName)
                     }
                 }
             }
+            // Collision shapes restore here too, off the owner thread; the
+            // finalize only installs them.
             recipe.Build =
-                [buildResult, probes, scenePath, serializers](
+                [buildResult, probes, collision, scenePath, collisionPath, serializers](
                     ZoneLoadPackage& package)
                 {
                     BuildScenePackage(
@@ -1323,14 +1452,17 @@ ConsoleResult TemplateGame::LoadWorld(std::string_view worldName)
                         scenePath,
                         *serializers);
                     (void)ReadZoneProbeFile(scenePath, *probes);
+                    *collision = RestoreZoneCollision(
+                        collisionPath,
+                        std::string(kCookedScanRoot));
                 };
             recipe.Finalize =
                 [this,
                  buildResult,
                  probes,
+                 collision,
                  loggingPtr,
-                 assetSystem,
-                 collisionPath](
+                 assetSystem](
                     RuntimeWorld& runtime,
                     RuntimeZoneRecord& zone)
                 {
@@ -1344,11 +1476,10 @@ ConsoleResult TemplateGame::LoadWorld(std::string_view worldName)
                     }
                     if (PhysicsShapes != nullptr)
                     {
-                        LoadZoneCollision(
+                        InstallZoneCollision(
                             runtime.Entities(),
                             *PhysicsShapes,
-                            collisionPath,
-                            std::string(kCookedScanRoot),
+                            std::move(*collision),
                             zone.Partition);
                     }
                     if (DefaultRenderPipeline* pipeline =
@@ -1368,6 +1499,7 @@ ConsoleResult TemplateGame::LoadWorld(std::string_view worldName)
             .NeighborVisible = runtimeConfig.StreamingNeighborVisible,
             .NeighborPhysics = runtimeConfig.StreamingNeighborPhysics,
             .Radius = runtimeConfig.StreamingRadius,
+            .PredictSeconds = runtimeConfig.StreamingPredictSeconds,
         });
 
     std::string loadError;
@@ -1735,6 +1867,7 @@ void TemplateGame::OnShutdown(GameShutdownContext&)
     // handles above and precedes the cache going away.
     if (Assets.has_value())
         UnregisterPlayerAvatarData(Assets->DataTypes, Assets->DataSchemas);
+    GetEngine().Console().Registry().UnregisterOwner("assets");
     Assets.reset();
 }
 
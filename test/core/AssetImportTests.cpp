@@ -130,7 +130,15 @@ namespace
             return result;
         }
 
+        std::vector<ImportResult> ImportBatch(std::span<const ImportInput> inputs,
+                                              ICookOutputWriter& output) override
+        {
+            BatchSizes.push_back(inputs.size());
+            return IAssetImporter::ImportBatch(inputs, output);
+        }
+
         int ImportCount = 0;
+        std::vector<std::size_t> BatchSizes;
         std::string LastMeta;
         std::optional<std::string> FailWith;
         bool EscapeCookedDir = false;
@@ -413,6 +421,36 @@ TEST(ImportOnDemand, ImporterErrorFailsThatSourceOnly)
     EXPECT_FALSE(registry.Contains("asset://meshes/bad.smesh"));
 }
 
+TEST(ImportOnDemand, StaleSourcesReachTheImporterAsOneBatch)
+{
+    TempAssetRoot root;
+    root.WriteFile("meshes/rock.src", "rock source bytes");
+    root.WriteFile("meshes/tree.src", "tree source bytes");
+    root.WriteFile("meshes/bush.src", "bush source bytes");
+
+    FakeImporter importer;
+    AssetImporterRegistry importers;
+    ASSERT_TRUE(importers.Register(importer));
+    LoggingProvider logging;
+    {
+        AssetRegistry registry(logging);
+        ASSERT_TRUE(ImportAssetsOnDemand(root.PathString(), importers, registry, logging));
+    }
+    EXPECT_EQ(importer.BatchSizes, std::vector<std::size_t>{ 3 });
+
+    // Only the edited source rides the next batch; the fresh ones still register.
+    root.WriteFile("meshes/tree.src", "tree source bytes, edited");
+    AssetRegistry registry(logging);
+    ImportOnDemandStats stats;
+    ASSERT_TRUE(ImportAssetsOnDemand(root.PathString(), importers, registry, logging, &stats));
+    EXPECT_EQ(importer.BatchSizes, (std::vector<std::size_t>{ 3, 1 }));
+    EXPECT_EQ(stats.Imported, 1u);
+    EXPECT_EQ(stats.CookedFresh, 2u);
+    EXPECT_TRUE(registry.Contains("asset://meshes/rock.smesh"));
+    EXPECT_TRUE(registry.Contains("asset://meshes/tree.smesh"));
+    EXPECT_TRUE(registry.Contains("asset://meshes/bush.smesh"));
+}
+
 TEST(ImportOnDemand, ArtifactOutsideCookedDirIsRejected)
 {
     TempAssetRoot root;
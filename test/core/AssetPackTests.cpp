@@ -0,0 +1,360 @@
+#include <assets/cook/AssetPackBuilder.h>
+#include <core/assets/AssetPackCodec.h>
+#include <core/assets/AssetPackSource.h>
+#include <core/assets/AssetRegistry.h>
+#include <core/hash/ContentHash.h>
+#include <core/logging/LoggingProvider.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    namespace fs = std::filesystem;
+
+    class MemoryAssetSource final : public IAssetSource
+    {
+    public:
+        bool ReadBytes(std::string_view filePath, std::vector<std::byte>& out) override
+        {
+            auto it = Files.find(std::string(filePath));
+            if (it == Files.end())
+                return false;
+            out = it->second;
+            return true;
+        }
+
+        void Add(std::string_view path, std::vector<std::byte> bytes)
+        {
+            Files[std::string(path)] = std::move(bytes);
+        }
+
+    private:
+        std::map<std::string, std::vector<std::byte>> Files;
+    };
+
+    std::vector<std::byte> Repetitive(std::size_t size)
+    {
+        std::vector<std::byte> bytes(size);
+        for (std::size_t i = 0; i < size; ++i)
+            bytes[i] = static_cast<std::byte>((i / 7) % 5);
+        return bytes;
+    }
+
+    std::vector<std::byte> Noise(std::size_t size, uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        std::vector<std::byte> bytes(size);
+        for (std::byte& b : bytes)
+            b = static_cast<std::byte>(rng() & 0xFF);
+        return bytes;
+    }
+
+    std::vector<std::byte> RoundTrip(const std::vector<std::byte>& input)
+    {
+        std::vector<std::byte> compressed;
+        SpakCompress(input, compressed);
+        std::vector<std::byte> output(input.size());
+        EXPECT_TRUE(SpakDecompress(compressed, output));
+        return output;
+    }
+
+    class AssetPackTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            Root = fs::temp_directory_path()
+                / ("sencha_spak_" + std::to_string(reinterpret_cast<std::uintptr_t>(this)));
+            fs::remove_all(Root);
+            fs::create_directories(Root);
+            PackPath = Root / "assets.spak";
+        }
+        void TearDown() override { std::error_code ec; fs::remove_all(Root, ec); }
+
+        fs::path Root;
+        fs::path PackPath;
+    };
+}
+
+TEST(AssetPackCodec, RoundTripsRunsNoiseAndEmpty)
+{
+    for (const std::vector<std::byte>& input : {
+             std::vector<std::byte>{},
+             std::vector<std::byte>(3, std::byte{ 9 }),
+             std::vector<std::byte>(100000, std::byte{ 0 }),
+             Repetitive(70000),
+             Noise(5000, 1) })
+    {
+        EXPECT_EQ(RoundTrip(input), input);
+    }
+}
+
+TEST(AssetPackCodec, CompressesRepetitiveInput)
+{
+    std::vector<std::byte> compressed;
+    SpakCompress(Repetitive(64 * 1024), compressed);
+    EXPECT_LT(compressed.size(), 64u * 1024u / 10u);
+}
+
+TEST(AssetPackCodec, RejectsMalformedInput)
+{
+    const std::vector<std::byte> input = Repetitive(4096);
+    std::vector<std::byte> compressed;
+    SpakCompress(input, compressed);
+
+    std::vector<std::byte> output(input.size());
+    const std::span<const std::byte> truncated(compressed.data(), compressed.size() / 2);
+    EXPECT_FALSE(SpakDecompress(truncated, output));
+
+    std::vector<std::byte> shortOutput(input.size() - 1);
+    EXPECT_FALSE(SpakDecompress(compressed, shortOutput));
+
+    std::vector<std::byte> longOutput(input.size() + 1);
+    EXPECT_FALSE(SpakDecompress(compressed, longOutput));
+
+    // A match whose offset reaches before the first byte written.
+    const std::vector<std::byte> backwards = {
+        std::byte{ 0x10 }, std::byte{ 'a' }, std::byte{ 0x05 }, std::byte{ 0x00 },
+    };
+    std::vector<std::byte> small(16);
+    EXPECT_FALSE(SpakDecompress(backwards, small));
+}
+
+TEST_F(AssetPackTest, ReadsAndViewsEveryEntry)
+{
+    const std::vector<std::byte> mesh = Repetitive(20000);
+    const std::vector<std::byte> texture = Noise(3000, 7);
+
+    AssetPackWriter writer;
+    ASSERT_TRUE(writer.Open(PackPath));
+    ASSERT_TRUE(writer.Add("asset://meshes/cube.smesh", AssetType::StaticMesh, mesh));
+    ASSERT_TRUE(writer.Add("asset://textures/noise.stex", AssetType::Texture, texture));
+    ASSERT_TRUE(writer.Finish());
+    EXPECT_EQ(writer.Stats().Entries, 2u);
+    EXPECT_EQ(writer.Stats().Compressed, 1u);
+
+    AssetPackSource pack;
+    std::string error;
+    ASSERT_TRUE(pack.Open(PackPath.string(), &error)) << error;
+    EXPECT_EQ(pack.Entries().size(), 2u);
+
+    std::vector<std::byte> bytes;
+    ASSERT_TRUE(pack.ReadBytes("asset://meshes/cube.smesh", bytes));
+    EXPECT_EQ(bytes, mesh);
+    ASSERT_TRUE(pack.ReadBytes("asset://textures/noise.stex", bytes));
+    EXPECT_EQ(bytes, texture);
+    EXPECT_FALSE(pack.ReadBytes("asset://textures/missing.stex", bytes));
+
+    // Noise does not compress, so it is stored raw and viewed in place, on
+    // the pack's alignment; the compressed mesh is decoded into a buffer.
+    AssetBytes view;
+    ASSERT_TRUE(pack.ReadView("asset://textures/noise.stex", view));
+    ASSERT_EQ(view.size(), texture.size());
+    EXPECT_TRUE(std::equal(view.Bytes().begin(), view.Bytes().end(), texture.begin()));
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(view.data()) % kSpakDefaultAlignment, 0u);
+
+    AssetBytes decoded;
+    ASSERT_TRUE(pack.ReadView("asset://meshes/cube.smesh", decoded));
+    EXPECT_TRUE(std::equal(decoded.Bytes().begin(), decoded.Bytes().end(), mesh.begin(),
+                           mesh.end()));
+
+    const SpakEntry* entry = pack.Find("asset://textures/noise.stex");
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->Type, AssetType::Texture);
+    EXPECT_EQ(entry->ContentHash, HashBytes64(std::span<const std::byte>(texture)));
+
+    // A view holds the mapping, not the source: it outlives Close.
+    pack.Close();
+    EXPECT_TRUE(std::equal(view.Bytes().begin(), view.Bytes().end(), texture.begin()));
+}
+
+TEST_F(AssetPackTest, MissingPathsGoToTheFallback)
+{
+    AssetPackWriter writer;
+    ASSERT_TRUE(writer.Open(PackPath));
+    ASSERT_TRUE(writer.Add("asset://a.smesh", AssetType::StaticMesh, Noise(100, 2)));
+    ASSERT_TRUE(writer.Finish());
+
+    MemoryAssetSource loose;
+    loose.Add("assets/b.smesh", Noise(50, 3));
+
+    AssetPackSource pack(&loose);
+    ASSERT_TRUE(pack.Open(PackPath.string()));
+
+    std::vector<std::byte> bytes;
+    ASSERT_TRUE(pack.ReadBytes("assets/b.smesh", bytes));
+    EXPECT_EQ(bytes, Noise(50, 3));
+    ASSERT_TRUE(pack.ReadBytes("asset://a.smesh", bytes));
+    EXPECT_EQ(bytes, Noise(100, 2));
+
+    // Only the pack can place its bytes for read ordering.
+    EXPECT_EQ(pack.ReadOrder("asset://a.smesh"), pack.Find("asset://a.smesh")->DataOffset);
+    EXPECT_NE(pack.ReadOrder("asset://a.smesh"), 0u);
+    EXPECT_EQ(pack.ReadOrder("assets/b.smesh"), 0u);
+    EXPECT_EQ(loose.ReadOrder("assets/b.smesh"), 0u);
+}
+
+TEST_F(AssetPackTest, RejectsDuplicatePaths)
+{
+    AssetPackWriter writer;
+    ASSERT_TRUE(writer.Open(PackPath));
+    ASSERT_TRUE(writer.Add("asset://a.smesh", AssetType::StaticMesh, Noise(10, 1)));
+    ASSERT_TRUE(writer.Add("asset://a.smesh", AssetType::StaticMesh, Noise(10, 2)));
+    EXPECT_FALSE(writer.Finish());
+}
+
+TEST_F(AssetPackTest, BuildsFromRegistryAndRegistersFromToc)
+{
+    LoggingProvider logging;
+    AssetRegistry source(logging);
+    MemoryAssetSource loose;
+    for (int i = 0; i < 40; ++i)
+    {
+        const std::string path = "asset://meshes/m" + std::to_string(i) + ".smesh";
+        const std::string file = "assets/meshes/m" + std::to_string(i) + ".smesh";
+        loose.Add(file, Noise(64 + i * 13, static_cast<uint32_t>(i)));
+        ASSERT_TRUE(source.Register(AssetRecord{
+            .Type = AssetType::StaticMesh,
+            .SourceKind = AssetSourceKind::File,
+            .Path = path,
+            .FilePath = file,
+        }));
+    }
+    ASSERT_TRUE(source.Register(AssetRecord{
+        .Type = AssetType::Material,
+        .SourceKind = AssetSourceKind::Procedural,
+        .Path = "asset://materials/default.smat",
+    }));
+
+    AssetPackBuildStats stats;
+    std::string error;
+    ASSERT_TRUE(BuildAssetPack(source, loose, PackPath, {}, &stats, &error)) << error;
+    EXPECT_EQ(stats.Entries, 40u);
+    EXPECT_EQ(stats.Skipped, 1u);
+
+    AssetPackSource pack;
+    ASSERT_TRUE(pack.Open(PackPath.string(), &error)) << error;
+
+    AssetRegistry registry(logging);
+    EXPECT_EQ(RegisterPackedAssets(pack, registry), 40);
+    EXPECT_EQ(RegisterPackedAssets(pack, registry), 0);
+
+    const AssetRecord* record = registry.FindByPath("asset://meshes/m17.smesh");
+    ASSERT_NE(record, nullptr);
+    EXPECT_EQ(record->Type, AssetType::StaticMesh);
+    EXPECT_TRUE(record->FilePath.empty());
+
+    // Registered from the pack, read through the pack: the bytes the loose
+    // source held, found by virtual path.
+    std::vector<std::byte> bytes;
+    ASSERT_TRUE(ReadAssetBytes(pack, *record, bytes));
+    EXPECT_EQ(bytes, Noise(64 + 17 * 13, 17));
+    EXPECT_EQ(record->ContentHash, HashBytes64(std::span<const std::byte>(bytes)));
+}
+
+TEST_F(AssetPackTest, DamagedPacksFailToOpen)
+{
+    AssetPackWriter writer;
+    ASSERT_TRUE(writer.Open(PackPath));
+    ASSERT_TRUE(writer.Add("asset://a.smesh", AssetType::StaticMesh, Noise(500, 4)));
+    ASSERT_TRUE(writer.Add("asset://b.smesh", AssetType::StaticMesh, Noise(500, 5)));
+    ASSERT_TRUE(writer.Finish());
+
+    std::vector<char> file(fs::file_size(PackPath));
+    {
+        std::ifstream in(PackPath, std::ios::binary);
+        in.read(file.data(), static_cast<std::streamsize>(file.size()));
+    }
+    const auto writeVariant = [&](const std::vector<char>& bytes) {
+        std::ofstream out(PackPath, std::ios::binary | std::ios::trunc);
+        out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    };
+
+    AssetPackSource pack;
+    std::string error;
+
+    writeVariant(std::vector<char>(file.begin(), file.end() - 20));
+    EXPECT_FALSE(pack.Open(PackPath.string(), &error));
+    EXPECT_FALSE(pack.IsOpen());
+
+    std::vector<char> badMagic = file;
+    badMagic[0] = 'X';
+    writeVariant(badMagic);
+    EXPECT_FALSE(pack.Open(PackPath.string(), &error));
+
+    // Point the first entry past the end of the file.
+    SpakFileHeader header;
+    std::memcpy(&header, file.data(), sizeof(header));
+    std::vector<char> badRange = file;
+    SpakEntry entry;
+    std::memcpy(&entry, badRange.data() + header.TocOffset, sizeof(entry));
+    entry.DataOffset = file.size();
+    std::memcpy(badRange.data() + header.TocOffset, &entry, sizeof(entry));
+    writeVariant(badRange);
+    EXPECT_FALSE(pack.Open(PackPath.string(), &error));
+
+    EXPECT_FALSE(pack.Open((Root / "absent.spak").string(), &error));
+}
+
+TEST_F(AssetPackTest, CompressedEntriesClaimingImpossibleSizesFailToOpen)
+{
+    AssetPackWriter writer;
+    ASSERT_TRUE(writer.Open(PackPath));
+    ASSERT_TRUE(writer.Add("asset://a.smesh", AssetType::StaticMesh, Repetitive(4000)));
+    ASSERT_TRUE(writer.Finish());
+
+    std::vector<char> file(fs::file_size(PackPath));
+    {
+        std::ifstream in(PackPath, std::ios::binary);
+        in.read(file.data(), static_cast<std::streamsize>(file.size()));
+    }
+    SpakFileHeader header;
+    std::memcpy(&header, file.data(), sizeof(header));
+    SpakEntry original;
+    std::memcpy(&original, file.data() + header.TocOffset, sizeof(original));
+    ASSERT_NE(original.Flags & kSpakEntryCompressed, 0);
+
+    const auto openWithSize = [&](std::uint64_t size, std::string* error) {
+        std::vector<char> bytes = file;
+        SpakEntry entry = original;
+        entry.Size = size;
+        std::memcpy(bytes.data() + header.TocOffset, &entry, sizeof(entry));
+        {
+            std::ofstream out(PackPath, std::ios::binary | std::ios::trunc);
+            out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        }
+        AssetPackSource pack;
+        return pack.Open(PackPath.string(), error);
+    };
+
+    // Open is the gate: a Size that got past it would be resized to by the
+    // first read, before the decoder could object.
+    std::string error;
+    EXPECT_FALSE(openWithSize(~0ull, &error));
+    EXPECT_NE(error.find("impossible decoded size"), std::string::npos);
+    EXPECT_FALSE(openWithSize(kSpakMaxDecodedEntryBytes + 1, &error));
+    EXPECT_FALSE(openWithSize(original.StoredSize * kSpakMaxExpansion + 1, &error));
+
+    // Within both bounds the pack opens, and the wrong size is the decoder's
+    // to catch.
+    ASSERT_TRUE(openWithSize(original.Size + 1, &error));
+    AssetPackSource pack;
+    ASSERT_TRUE(pack.Open(PackPath.string(), &error));
+    std::vector<std::byte> out;
+    EXPECT_FALSE(pack.ReadBytes("asset://a.smesh", out));
+
+    ASSERT_TRUE(openWithSize(original.Size, &error));
+    ASSERT_TRUE(pack.Open(PackPath.string(), &error));
+    ASSERT_TRUE(pack.ReadBytes("asset://a.smesh", out));
+    EXPECT_EQ(out, Repetitive(4000));
+}
@@ -0,0 +1,262 @@
+#include <assets/cook/AssetRegistryIndexBuilder.h>
+#include <core/assets/AssetKindRegistry.h>
+#include <core/assets/AssetRegistry.h>
+#include <core/assets/AssetRegistryIndex.h>
+#include <core/logging/LoggingProvider.h>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    namespace fs = std::filesystem;
+
+    constexpr std::string_view kCookedIndex = R"({
+        "sources": [
+            { "artifacts": [
+                { "path": "asset://textures/rock.png",
+                  "file": ".cooked/textures/rock.stex",
+                  "type": "Texture" } ] } ]
+    })";
+
+    // An assets root holding each way a record gets registered: an authored
+    // file, cooked files keyed by location, and a cooked artifact also keyed
+    // by the virtual path index.json gives it.
+    class AssetRegistryIndexTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            std::random_device rd;
+            Root = fs::temp_directory_path() / ("sencha_sreg_" + std::to_string(rd()));
+            fs::create_directories(Root);
+            WriteFile("materials/rock.smat", "{}");
+            WriteFile(".cooked/meshes/rock.smesh", "mesh bytes");
+            WriteFile(".cooked/textures/rock.stex", "texture bytes");
+            WriteFile(".cooked/index.json", kCookedIndex);
+        }
+
+        void TearDown() override
+        {
+            std::error_code ec;
+            fs::remove_all(Root, ec);
+        }
+
+        void WriteFile(std::string_view relPath, std::string_view contents) const
+        {
+            const fs::path full = Root / relPath;
+            fs::create_directories(full.parent_path());
+            std::ofstream file(full, std::ios::binary | std::ios::trunc);
+            file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+        }
+
+        // What a player without an index registers, plus the id map's pass.
+        void Walk(AssetRegistry& registry) const
+        {
+            ScanAssetsDirectory(RootString(), registry, BuiltinAssetKindRegistry());
+            ScanAssetsDirectory((Root / ".cooked").generic_string(), registry,
+                                BuiltinAssetKindRegistry());
+            RegisterCookedAssets(RootString(), registry);
+            registry.AssignId("asset://materials/rock.smat", AssetId{ 0x51 });
+        }
+
+        void WriteIndexOfWalk() const
+        {
+            AssetRegistry walked(Logging);
+            Walk(walked);
+            std::string error;
+            ASSERT_TRUE(WriteAssetRegistryIndex(walked, RootString(), IndexPath(), nullptr, &error))
+                << error;
+        }
+
+        [[nodiscard]] std::string RootString() const { return Root.generic_string(); }
+        [[nodiscard]] std::string IndexPath() const { return AssetRegistryIndexPath(RootString()); }
+
+        fs::path Root;
+        mutable LoggingProvider Logging;
+    };
+}
+
+TEST_F(AssetRegistryIndexTest, MountedIndexResolvesWhatTheWalkRegistered)
+{
+    AssetRegistry walked(Logging);
+    Walk(walked);
+    AssetRegistryIndexBuildStats stats;
+    std::string error;
+    ASSERT_TRUE(WriteAssetRegistryIndex(walked, RootString(), IndexPath(), &stats, &error)) << error;
+    EXPECT_EQ(stats.Entries, 4u);
+    EXPECT_EQ(stats.WithIds, 1u);
+
+    AssetRegistryIndex index;
+    ASSERT_TRUE(index.Open(IndexPath(), RootString(), &error)) << error;
+    AssetRegistry registry(Logging);
+    registry.MountIndex(&index);
+
+    for (const auto& [path, expected] : walked.Records())
+    {
+        ASSERT_TRUE(registry.Contains(path)) << path;
+        const AssetRecord* record = registry.FindByPath(path);
+        ASSERT_NE(record, nullptr) << path;
+        EXPECT_EQ(record->Type, expected.Type);
+        EXPECT_EQ(record->SourceKind, expected.SourceKind);
+        EXPECT_EQ(record->FilePath, expected.FilePath);
+        EXPECT_EQ(record->ContentHash, expected.ContentHash);
+        EXPECT_EQ(record->Id, expected.Id);
+    }
+    EXPECT_FALSE(registry.Contains("asset://materials/missing.smat"));
+    EXPECT_EQ(registry.FindByPath("asset://materials/missing.smat"), nullptr);
+    EXPECT_EQ(registry.Records().size(), walked.Records().size());
+}
+
+TEST_F(AssetRegistryIndexTest, IdsResolveWithoutAnyPathLookup)
+{
+    WriteIndexOfWalk();
+    AssetRegistryIndex index;
+    ASSERT_TRUE(index.Open(IndexPath(), RootString()));
+    AssetRegistry registry(Logging);
+    registry.MountIndex(&index);
+
+    const AssetRecord* record = registry.FindById(AssetId{ 0x51 });
+    ASSERT_NE(record, nullptr);
+    EXPECT_EQ(record->Path, "asset://materials/rock.smat");
+    EXPECT_EQ(registry.FindById(AssetId{ 0x52 }), nullptr);
+
+    // Applying the id map again restates what the index holds.
+    EXPECT_TRUE(registry.AssignId("asset://textures/rock.png", AssetId{ 0x60 }));
+    EXPECT_TRUE(registry.AssignId("asset://materials/rock.smat", AssetId{ 0x51 }));
+    EXPECT_FALSE(registry.AssignId("asset://materials/rock.smat", AssetId{ 0x53 }));
+    EXPECT_EQ(registry.FindById(AssetId{ 0x60 })->Path, "asset://textures/rock.png");
+}
+
+TEST_F(AssetRegistryIndexTest, IndexedPathsCountAsRegistered)
+{
+    WriteIndexOfWalk();
+    AssetRegistryIndex index;
+    ASSERT_TRUE(index.Open(IndexPath(), RootString()));
+    AssetRegistry registry(Logging);
+    registry.MountIndex(&index);
+
+    AssetRecord duplicate;
+    duplicate.Type = AssetType::Material;
+    duplicate.SourceKind = AssetSourceKind::File;
+    duplicate.Path = "asset://materials/rock.smat";
+    duplicate.FilePath = "elsewhere/rock.smat";
+    EXPECT_FALSE(registry.Register(duplicate));
+    EXPECT_EQ(registry.FindByPath(duplicate.Path)->FilePath,
+              (Root / "materials/rock.smat").generic_string());
+
+    // The scan over a mounted index registers nothing new.
+    ScanAssetsDirectory(RootString(), registry, BuiltinAssetKindRegistry());
+    EXPECT_EQ(registry.Records().size(), 4u);
+
+    EXPECT_TRUE(registry.Unregister(duplicate.Path));
+    EXPECT_FALSE(registry.Contains(duplicate.Path));
+    EXPECT_EQ(registry.FindByPath(duplicate.Path), nullptr);
+    EXPECT_EQ(registry.FindById(AssetId{ 0x51 }), nullptr);
+    EXPECT_FALSE(registry.Unregister(duplicate.Path));
+
+    // Registered again directly, it is an ordinary record.
+    EXPECT_TRUE(registry.Register(duplicate));
+    EXPECT_EQ(registry.FindByPath(duplicate.Path)->FilePath, "elsewhere/rock.smat");
+    EXPECT_TRUE(registry.Unregister(duplicate.Path));
+}
+
+TEST_F(AssetRegistryIndexTest, WriterKeepsOnlyFilesUnderItsRoot)
+{
+    AssetRegistry registry(Logging);
+    Walk(registry);
+
+    AssetRecord procedural;
+    procedural.Type = AssetType::StaticMesh;
+    procedural.SourceKind = AssetSourceKind::Procedural;
+    procedural.Path = "asset://procedural/cube";
+    ASSERT_TRUE(registry.Register(procedural));
+
+    AssetRecord foreign;
+    foreign.Type = AssetType::Material;
+    foreign.SourceKind = AssetSourceKind::File;
+    foreign.Path = "asset://other/stone.smat";
+    foreign.FilePath = (Root.parent_path() / "other_root/stone.smat").generic_string();
+    ASSERT_TRUE(registry.Register(foreign));
+
+    AssetRegistryIndexBuildStats stats;
+    ASSERT_TRUE(WriteAssetRegistryIndex(registry, RootString(), IndexPath(), &stats));
+    EXPECT_EQ(stats.Entries, 4u);
+    EXPECT_EQ(stats.Skipped, 2u);
+
+    AssetRegistryIndex index;
+    ASSERT_TRUE(index.Open(IndexPath(), RootString()));
+    EXPECT_EQ(index.Find(procedural.Path), nullptr);
+    EXPECT_EQ(index.Find(foreign.Path), nullptr);
+    const SregEntry* texture = index.Find("asset://textures/rock.png");
+    ASSERT_NE(texture, nullptr);
+    EXPECT_EQ(index.FileOf(*texture), ".cooked/textures/rock.stex");
+}
+
+TEST_F(AssetRegistryIndexTest, DamagedIndexFailsToOpen)
+{
+    WriteIndexOfWalk();
+    std::vector<char> bytes;
+    {
+        std::ifstream file(IndexPath(), std::ios::binary);
+        bytes.assign(std::istreambuf_iterator<char>(file), {});
+    }
+    ASSERT_GT(bytes.size(), sizeof(SregFileHeader) + 2 * sizeof(SregEntry));
+
+    const auto openWith = [&](const std::vector<char>& contents)
+    {
+        const fs::path damaged = Root / "damaged.sreg";
+        std::ofstream(damaged, std::ios::binary | std::ios::trunc)
+            .write(contents.data(), static_cast<std::streamsize>(contents.size()));
+        AssetRegistryIndex index;
+        std::string error;
+        const bool opened = index.Open(damaged.generic_string(), RootString(), &error);
+        EXPECT_EQ(opened, error.empty());
+        return opened;
+    };
+
+    EXPECT_TRUE(openWith(bytes));
+
+    std::vector<char> truncated(bytes.begin(), bytes.begin() + sizeof(SregFileHeader) + 8);
+    EXPECT_FALSE(openWith(truncated));
+
+    std::vector<char> wrongMagic = bytes;
+    wrongMagic[0] = 'X';
+    EXPECT_FALSE(openWith(wrongMagic));
+
+    // Swapping the first two entries unsorts the table.
+    std::vector<char> unsorted = bytes;
+    char* first = unsorted.data() + sizeof(SregFileHeader);
+    std::vector<char> scratch(first, first + sizeof(SregEntry));
+    std::memcpy(first, first + sizeof(SregEntry), sizeof(SregEntry));
+    std::memcpy(first + sizeof(SregEntry), scratch.data(), sizeof(SregEntry));
+    EXPECT_FALSE(openWith(unsorted));
+}
+
+TEST_F(AssetRegistryIndexTest, CheckAgainstTheWalkFindsWhatChangedSinceTheCook)
+{
+    WriteIndexOfWalk();
+    AssetRegistryIndex index;
+    ASSERT_TRUE(index.Open(IndexPath(), RootString()));
+
+    AssetRegistryIndexCheck check =
+        CheckAssetRegistryIndex(index, BuiltinAssetKindRegistry(), Logging);
+    EXPECT_TRUE(check.Matches());
+    EXPECT_EQ(check.Walked, 4u);
+
+    WriteFile("materials/new.smat", "{}");
+    WriteFile("materials/rock.smat", "{ \"edited\": true }");
+    fs::remove(Root / ".cooked/meshes/rock.smesh");
+
+    check = CheckAssetRegistryIndex(index, BuiltinAssetKindRegistry(), Logging);
+    EXPECT_FALSE(check.Matches());
+    EXPECT_EQ(check.Missing, std::vector<std::string>{ "asset://materials/new.smat" });
+    EXPECT_EQ(check.Stale, std::vector<std::string>{ "asset://materials/rock.smat" });
+    EXPECT_EQ(check.Extra, std::vector<std::string>{ "asset://meshes/rock.smesh" });
+}
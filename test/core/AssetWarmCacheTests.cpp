@@ -0,0 +1,270 @@
+#include <gtest/gtest.h>
+
+#include <core/assets/AssetCache.h>
+#include <core/handle/Handle.h>
+#include <render/MaterialCache.h>
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    using FakeAssetHandle = Handle<struct FakeAssetHandleTag>;
+
+    struct FakeAssetEntry
+    {
+        std::string Name;
+        AssetFootprint Footprint;
+        uint32_t Generation = 0;
+        uint32_t RefCount = 0;
+        std::string PathKey;
+        bool Alive = false;
+    };
+
+    // The smallest cache that opts into parking: each entry declares its own
+    // footprint, and every free is logged by name so a test can tell parked
+    // from freed without a device.
+    class FakeAssetCache final
+        : public AssetCache<FakeAssetCache, FakeAssetHandle, FakeAssetEntry, AssetType::Audio>
+    {
+    public:
+        explicit FakeAssetCache(std::vector<std::string>& freed)
+            : Freed(&freed)
+        {
+            ReserveNullSlot();
+        }
+
+        ~FakeAssetCache() override
+        {
+            FreeAllEntries();
+        }
+
+        [[nodiscard]] FakeAssetHandle Add(std::string_view path,
+                                          std::uint64_t cpuBytes,
+                                          std::uint64_t gpuBytes)
+        {
+            FakeAssetEntry entry;
+            entry.Name = std::string(path);
+            entry.Footprint = { .CpuBytes = cpuBytes, .GpuBytes = gpuBytes };
+            entry.Alive = true;
+            return AllocNamedHandle(path, std::move(entry));
+        }
+
+        [[nodiscard]] std::uint32_t RefCountOf(FakeAssetHandle handle) const
+        {
+            const FakeAssetEntry* entry = Resolve(handle);
+            return entry ? entry->RefCount : 0;
+        }
+
+    private:
+        friend class AssetCache<FakeAssetCache, FakeAssetHandle, FakeAssetEntry, AssetType::Audio>;
+
+        void OnFree(FakeAssetEntry& entry)
+        {
+            Freed->push_back(entry.Name);
+            entry.Alive = false;
+        }
+
+        bool IsEntryLive(const FakeAssetEntry& entry) const { return entry.Alive; }
+
+        AssetFootprint WarmFootprint(const FakeAssetEntry& entry) const { return entry.Footprint; }
+
+        std::vector<std::string>* Freed = nullptr;
+    };
+}
+
+TEST(AssetWarmCache, ReleaseFreesWhileTheBudgetIsZero)
+{
+    std::vector<std::string> freed;
+    FakeAssetCache cache(freed);
+
+    const FakeAssetHandle handle = cache.Add("asset://a", 10, 0);
+    cache.Release(handle);
+
+    EXPECT_FALSE(cache.IsResident("asset://a"));
+    ASSERT_EQ(freed.size(), 1u);
+    EXPECT_EQ(cache.GetWarmCacheStats().ParkedEntries, 0u);
+    EXPECT_EQ(cache.GetWarmCacheStats().Evictions, 0u);
+}
+
+TEST(AssetWarmCache, ReleasedEntryParksAndAcquireTakesItBack)
+{
+    std::vector<std::string> freed;
+    FakeAssetCache cache(freed);
+    cache.SetWarmCacheBudget({ .CpuBytes = 100, .GpuBytes = 100 });
+
+    const FakeAssetHandle handle = cache.Add("asset://a", 10, 20);
+    cache.Release(handle);
+
+    EXPECT_TRUE(freed.empty());
+    EXPECT_TRUE(cache.IsResident("asset://a"));
+    AssetWarmCacheStats stats = cache.GetWarmCacheStats();
+    EXPECT_EQ(stats.Misses, 1u);
+    EXPECT_EQ(stats.ParkedEntries, 1u);
+    EXPECT_EQ(stats.ParkedCpuBytes, 10u);
+    EXPECT_EQ(stats.ParkedGpuBytes, 20u);
+
+    const FakeAssetHandle again = cache.Acquire("asset://a");
+    EXPECT_EQ(again, handle);
+    EXPECT_EQ(cache.RefCountOf(again), 1u);
+    stats = cache.GetWarmCacheStats();
+    EXPECT_EQ(stats.Hits, 1u);
+    EXPECT_EQ(stats.ParkedEntries, 0u);
+    EXPECT_EQ(stats.ParkedCpuBytes, 0u);
+
+    cache.Release(again);
+}
+
+TEST(AssetWarmCache, LeasesRetainsAndAttachesAllTakeParkedEntriesBack)
+{
+    std::vector<std::string> freed;
+    FakeAssetCache cache(freed);
+    cache.SetWarmCacheBudget({ .CpuBytes = 100, .GpuBytes = 0 });
+
+    const FakeAssetHandle handle = cache.Add("asset://a", 10, 0);
+    cache.Release(handle);
+    {
+        AssetLease lease = cache.TryAcquireLease("asset://a");
+        ASSERT_TRUE(lease.IsValid());
+        EXPECT_EQ(cache.GetWarmCacheStats().ParkedEntries, 0u);
+    }
+    EXPECT_EQ(cache.GetWarmCacheStats().ParkedEntries, 1u);
+
+    cache.Retain(handle);
+    EXPECT_EQ(cache.GetWarmCacheStats().ParkedEntries, 0u);
+    cache.Release(handle);
+
+    {
+        Owned<FakeAssetHandle> owned(&cache, handle);
+        EXPECT_EQ(cache.RefCountOf(handle), 1u);
+    }
+
+    EXPECT_EQ(cache.GetWarmCacheStats().Hits, 3u);
+    EXPECT_TRUE(freed.empty());
+}
+
+TEST(AssetWarmCache, OldestReleasedEntryIsEvictedFirst)
+{
+    std::vector<std::string> freed;
+    FakeAssetCache cache(freed);
+    cache.SetWarmCacheBudget({ .CpuBytes = 20, .GpuBytes = 0 });
+
+    const FakeAssetHandle a = cache.Add("asset://a", 10, 0);
+    const FakeAssetHandle b = cache.Add("asset://b", 10, 0);
+    const FakeAssetHandle c = cache.Add("asset://c", 10, 0);
+    cache.Release(a);
+    cache.Release(b);
+
+    // Taking b back and releasing it again makes a the older of the two.
+    cache.Release(cache.Acquire("asset://b"));
+    cache.Release(c);
+
+    ASSERT_EQ(freed.size(), 1u);
+    EXPECT_EQ(freed[0], "asset://a");
+    EXPECT_TRUE(cache.IsResident("asset://b"));
+    EXPECT_TRUE(cache.IsResident("asset://c"));
+    EXPECT_EQ(cache.GetWarmCacheStats().Evictions, 1u);
+    EXPECT_EQ(cache.GetWarmCacheStats().ParkedCpuBytes, 20u);
+}
+
+TEST(AssetWarmCache, GpuPressurePassesOverEntriesHoldingNoGpuBytes)
+{
+    std::vector<std::string> freed;
+    FakeAssetCache cache(freed);
+    cache.SetWarmCacheBudget({ .CpuBytes = 100, .GpuBytes = 50 });
+
+    cache.Release(cache.Add("asset://clip", 40, 0));
+    cache.Release(cache.Add("asset://mesh", 0, 30));
+    cache.Release(cache.Add("asset://texture", 0, 30));
+
+    ASSERT_EQ(freed.size(), 1u);
+    EXPECT_EQ(freed[0], "asset://mesh");
+    EXPECT_TRUE(cache.IsResident("asset://clip"));
+    EXPECT_EQ(cache.GetWarmCacheStats().ParkedGpuBytes, 30u);
+}
+
+TEST(AssetWarmCache, EntryLargerThanTheBudgetFreesOnRelease)
+{
+    std::vector<std::string> freed;
+    FakeAssetCache cache(freed);
+    cache.SetWarmCacheBudget({ .CpuBytes = 100, .GpuBytes = 100 });
+
+    cache.Release(cache.Add("asset://small", 10, 10));
+    cache.Release(cache.Add("asset://huge", 10, 500));
+
+    ASSERT_EQ(freed.size(), 1u);
+    EXPECT_EQ(freed[0], "asset://huge");
+    EXPECT_TRUE(cache.IsResident("asset://small"));
+    EXPECT_EQ(cache.GetWarmCacheStats().Evictions, 1u);
+}
+
+TEST(AssetWarmCache, LoweringTheBudgetEvictsAndZeroDrainsEverything)
+{
+    std::vector<std::string> freed;
+    FakeAssetCache cache(freed);
+    cache.SetWarmCacheBudget({ .CpuBytes = 100, .GpuBytes = 0 });
+
+    cache.Release(cache.Add("asset://a", 30, 0));
+    cache.Release(cache.Add("asset://b", 30, 0));
+    cache.Release(cache.Add("asset://empty", 0, 0));
+
+    cache.SetWarmCacheBudget({ .CpuBytes = 40, .GpuBytes = 0 });
+    ASSERT_EQ(freed.size(), 1u);
+    EXPECT_EQ(freed[0], "asset://a");
+
+    cache.SetWarmCacheBudget({});
+    EXPECT_EQ(freed.size(), 3u);
+    EXPECT_EQ(cache.GetWarmCacheStats().ParkedEntries, 0u);
+    EXPECT_FALSE(cache.IsResident("asset://empty"));
+
+    // Parking is off now.
+    cache.Release(cache.Add("asset://c", 1, 0));
+    EXPECT_EQ(freed.size(), 4u);
+}
+
+TEST(AssetWarmCache, FreedSlotIsReusedWithoutDisturbingTheParkedList)
+{
+    std::vector<std::string> freed;
+    FakeAssetCache cache(freed);
+    cache.SetWarmCacheBudget({ .CpuBytes = 10, .GpuBytes = 0 });
+
+    cache.Release(cache.Add("asset://a", 10, 0));
+    cache.Release(cache.Add("asset://b", 10, 0));
+    ASSERT_EQ(freed.size(), 1u);
+
+    const FakeAssetHandle c = cache.Add("asset://c", 10, 0);
+    EXPECT_TRUE(cache.IsResident("asset://b"));
+    cache.Release(c);
+    EXPECT_FALSE(cache.IsResident("asset://b"));
+    EXPECT_TRUE(cache.IsResident("asset://c"));
+    EXPECT_EQ(cache.GetWarmCacheStats().ParkedEntries, 1u);
+}
+
+TEST(AssetWarmCache, DestructionFreesParkedEntries)
+{
+    std::vector<std::string> freed;
+    {
+        FakeAssetCache cache(freed);
+        cache.SetWarmCacheBudget({ .CpuBytes = 100, .GpuBytes = 0 });
+        cache.Release(cache.Add("asset://a", 10, 0));
+        EXPECT_TRUE(freed.empty());
+    }
+    ASSERT_EQ(freed.size(), 1u);
+    EXPECT_EQ(freed[0], "asset://a");
+}
+
+TEST(AssetWarmCache, CacheWithoutAFootprintNeverParks)
+{
+    MaterialCache materials;
+    materials.SetWarmCacheBudget({ .CpuBytes = 1024 * 1024, .GpuBytes = 1024 * 1024 });
+
+    const MaterialHandle handle = materials.Register("asset://materials/a.smat", Material{});
+    ASSERT_TRUE(handle.IsValid());
+    materials.Release(handle);
+
+    EXPECT_FALSE(materials.Find("asset://materials/a.smat").IsValid());
+    EXPECT_EQ(materials.GetWarmCacheStats().ParkedEntries, 0u);
+}
@@ -159,3 +159,39 @@ TEST(EngineConfig, RejectsInvalidWindowGraphicsApi)
 
     std::filesystem::remove(path);
 }
+
+TEST(EngineConfig, LoadsTheNetSessionModelAndCapturePaths)
+{
+    const std::filesystem::path path = WriteTempConfig(R"({
+        "net": {
+            "entropyModel": "net/snapshots.model",
+            "snapshotCapture": "captures/host.sncap"
+        }
+    })");
+
+    std::optional<EngineConfig> loaded = LoadEngineConfig(path.string().c_str());
+
+    ASSERT_TRUE(loaded);
+    EXPECT_EQ(loaded->Net.EntropyModelPath, "net/snapshots.model");
+    EXPECT_EQ(loaded->Net.SnapshotCapturePath, "captures/host.sncap");
+    EXPECT_TRUE(EngineConfig{}.Net.EntropyModelPath.empty());
+
+    std::filesystem::remove(path);
+}
+
+TEST(EngineConfig, RejectsANonStringEntropyModel)
+{
+    const std::filesystem::path path = WriteTempConfig(R"({
+        "net": {
+            "entropyModel": 7
+        }
+    })");
+
+    EngineConfigError error;
+    std::optional<EngineConfig> loaded = LoadEngineConfig(path.string().c_str(), &error);
+
+    EXPECT_FALSE(loaded);
+    EXPECT_NE(error.Message.find("entropyModel"), std::string::npos);
+
+    std::filesystem::remove(path);
+}
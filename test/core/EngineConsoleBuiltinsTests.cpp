@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 
 #include <app/EngineConsoleBuiltins.h>
+#include <assets/runtime/AssetSystem.h>
+#include <audio/AudioClipCache.h>
 #include <core/console/ConsoleRegistry.h>
 #include <core/console/ConsoleService.h>
 #include <core/json/JsonParser.h>
@@ -55,6 +57,10 @@ TEST(EngineConsoleBuiltins, RegistersExpectedEngineCVars)
     EXPECT_NE(registry.FindCVar("render.shadow.max_point"), nullptr);
     EXPECT_NE(registry.FindCVar("render.shadow.max_views_per_frame"), nullptr);
     EXPECT_NE(registry.FindCVar("render.shadow.min_invalidated_views_per_frame"), nullptr);
+    EXPECT_NE(registry.FindCVar("render.texture.budget_mib"), nullptr);
+    EXPECT_NE(registry.FindCVar("render.texture.upload_mib_per_frame"), nullptr);
+    EXPECT_NE(registry.FindCVar("render.mesh_lod.pixel_error"), nullptr);
+    EXPECT_NE(registry.FindCVar("render.mesh_lod.hysteresis"), nullptr);
 }
 
 TEST(EngineConsoleBuiltins, ShadowBudgetsReadCVarsAndDefaultWithoutARegistry)
@@ -88,6 +94,84 @@ TEST(EngineConsoleBuiltins, ShadowBudgetsReadCVarsAndDefaultWithoutARegistry)
     EXPECT_EQ(budgets.MinInvalidatedViewsPerFrame, 2u);
 }
 
+TEST(EngineConsoleBuiltins, TextureBudgetsReadCVarsInMebibytes)
+{
+    const TextureStreamingBudgets defaults =
+        EngineConsoleBuiltins::ReadTextureStreamingBudgets(nullptr);
+    EXPECT_EQ(defaults.ResidentBytes, 512ull * 1024 * 1024);
+    EXPECT_EQ(defaults.UploadBytesPerFrame, 16ull * 1024 * 1024);
+
+    ConsoleRegistry registry;
+    RuntimeFrameLoop loop;
+    EngineRuntimeConfig runtime;
+    EngineConsoleBuiltins::RegisterRuntimeCVars(registry, loop, runtime);
+
+    EXPECT_TRUE(registry.SetCVar("render.texture.budget_mib", 64.0, { "test" },
+                                 ConsolePhase::EngineReady).Succeeded());
+    EXPECT_TRUE(registry.SetCVar("render.texture.upload_mib_per_frame", 0.0, { "test" },
+                                 ConsolePhase::EngineReady).Succeeded());
+
+    const TextureStreamingBudgets budgets =
+        EngineConsoleBuiltins::ReadTextureStreamingBudgets(&registry);
+    EXPECT_EQ(budgets.ResidentBytes, 64ull * 1024 * 1024);
+    EXPECT_EQ(budgets.UploadBytesPerFrame, 0u);
+}
+
+TEST(EngineConsoleBuiltins, MeshLodPolicyReadsCVars)
+{
+    const MeshLodPolicy defaults = EngineConsoleBuiltins::ReadMeshLodPolicy(nullptr);
+    EXPECT_EQ(defaults.PixelError, 1.0f);
+    EXPECT_EQ(defaults.Hysteresis, 0.25f);
+
+    ConsoleRegistry registry;
+    RuntimeFrameLoop loop;
+    EngineRuntimeConfig runtime;
+    EngineConsoleBuiltins::RegisterRuntimeCVars(registry, loop, runtime);
+
+    EXPECT_TRUE(registry.SetCVar("render.mesh_lod.pixel_error", 0.0, { "test" },
+                                 ConsolePhase::EngineReady).Succeeded());
+    EXPECT_TRUE(registry.SetCVar("render.mesh_lod.hysteresis", 0.5, { "test" },
+                                 ConsolePhase::EngineReady).Succeeded());
+
+    const MeshLodPolicy policy = EngineConsoleBuiltins::ReadMeshLodPolicy(&registry);
+    EXPECT_EQ(policy.PixelError, 0.0f);
+    EXPECT_EQ(policy.Hysteresis, 0.5f);
+}
+
+TEST(EngineConsoleBuiltins, AssetWarmCacheCVarsApplyToEveryKindAsTheyChange)
+{
+    const AssetWarmCacheBudget defaults = EngineConsoleBuiltins::ReadAssetWarmCacheBudget(nullptr);
+    EXPECT_EQ(defaults.CpuBytes, 64ull * 1024 * 1024);
+    EXPECT_EQ(defaults.GpuBytes, 256ull * 1024 * 1024);
+
+    LoggingProvider logging;
+    AssetRegistry assetRegistry(logging);
+    AudioClipCache clips(logging);
+    AssetSystem assets(logging, assetRegistry, nullptr, nullptr, nullptr, &clips);
+
+    ConsoleRegistry registry;
+    EngineConsoleBuiltins::RegisterAssetCVars(registry, assets);
+    EXPECT_EQ(assets.GetWarmCacheBudget().CpuBytes, defaults.CpuBytes);
+
+    EXPECT_TRUE(registry.SetCVar("asset.warm_cache.cpu_mib", 8.0, { "test" },
+                                 ConsolePhase::EngineReady).Succeeded());
+    EXPECT_TRUE(registry.SetCVar("asset.warm_cache.gpu_mib", 0.0, { "test" },
+                                 ConsolePhase::EngineReady).Succeeded());
+    EXPECT_EQ(assets.GetWarmCacheBudget().CpuBytes, 8ull * 1024 * 1024);
+    EXPECT_EQ(assets.GetWarmCacheBudget().GpuBytes, 0u);
+
+    // The budget reached the cache: a released clip parks.
+    AudioClip clip;
+    clip.SampleRate = 22050;
+    clip.ChannelCount = 1;
+    clip.Samples = { 1, 2, 3, 4 };
+    clips.Release(clips.Register("asset://audio/warm.sclip", std::move(clip)));
+    EXPECT_EQ(assets.GetWarmCacheStats(AssetType::Audio).ParkedEntries, 1u);
+
+    registry.UnregisterOwner("assets");
+    EXPECT_EQ(registry.FindCVar("asset.warm_cache.cpu_mib"), nullptr);
+}
+
 TEST(EngineConsoleBuiltins, ProfileModeCVarWritesThePendingModeAndIgnoresUnknowns)
 {
     ConsoleRegistry registry;
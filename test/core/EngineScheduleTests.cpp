@@ -74,6 +74,26 @@ struct FixedC
     }
 };
 
+struct ReplayedFixed
+{
+    static constexpr bool Resimulated = true;
+
+    void FixedLogic(FixedLogicContext&)
+    {
+        CallLog.push_back("Replayed::FixedLogic");
+    }
+};
+
+struct DeclinedFixed
+{
+    static constexpr bool Resimulated = false;
+
+    void FixedLogic(FixedLogicContext&)
+    {
+        CallLog.push_back("Declined::FixedLogic");
+    }
+};
+
 struct MultiPhase
 {
     int PreSimulateCount = 0;
@@ -242,3 +262,34 @@ TEST_F(EngineScheduleTest, RuntimeWorldBuildsDomainPartitionView)
 
     harness.EndView();
 }
+
+TEST_F(EngineScheduleTest, ResimulatedTickRunsOnlySystemsThatOptIn)
+{
+    ScheduleHarness harness;
+    harness.RuntimeWorldState.AttachZone(
+        ZoneId{ 1 },
+        ZoneParticipation{ .Visible = true, .Logic = true });
+    harness.Schedule.Register<FixedC>();
+    harness.Schedule.Register<ReplayedFixed>();
+    harness.Schedule.Register<DeclinedFixed>();
+    harness.Schedule.Init();
+
+    const FrameZoneView& view = harness.BuildView();
+    FixedLogicContext fixed{
+        .Config = harness.Config,
+        .Runtime = harness.Runtime,
+        .Time = {},
+        .Entities = *view.Entities,
+        .Partitions = view.Logic,
+    };
+    harness.Schedule.RunFixedLogic(fixed);
+    EXPECT_EQ(CallLog, (std::vector<std::string>{
+        "C::FixedLogic", "Replayed::FixedLogic", "Declined::FixedLogic" }));
+
+    CallLog.clear();
+    fixed.Resimulating = true;
+    harness.Schedule.RunFixedLogic(fixed);
+    harness.EndView();
+
+    EXPECT_EQ(CallLog, (std::vector<std::string>{ "Replayed::FixedLogic" }));
+}
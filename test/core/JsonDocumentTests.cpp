@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+#include <core/json/JsonDocument.h>
+#include <core/json/JsonParser.h>
+
+#include <string>
+
+// --- Values ------------------------------------------------------------------
+
+TEST(JsonDocument, ReadsNestedValues)
+{
+	const std::string text = R"({
+		"name": "Jump",
+		"actions": [ {"key": 32}, {"key": 27, "held": true} ],
+		"none": null
+	})";
+	auto document = JsonDocument::Parse(text);
+	ASSERT_TRUE(document.has_value());
+
+	const JsonNode root = document->Root();
+	ASSERT_TRUE(root.IsObject());
+	EXPECT_EQ(root.Size(), 3u);
+	EXPECT_EQ(root.KeyAt(1), "actions");
+	EXPECT_EQ(root.Find("name").AsString(), "Jump");
+	EXPECT_TRUE(root.Find("none").IsNull());
+
+	const JsonNode actions = root.Find("actions");
+	ASSERT_TRUE(actions.IsArray());
+	ASSERT_EQ(actions.Size(), 2u);
+	EXPECT_DOUBLE_EQ(actions[0].Find("key").AsNumber(), 32.0);
+	EXPECT_TRUE(actions[1].Find("held").AsBool());
+}
+
+TEST(JsonDocument, MissingLookupsChainToInvalid)
+{
+	auto document = JsonDocument::Parse(R"({"a": [1]})");
+	ASSERT_TRUE(document.has_value());
+
+	const JsonNode missing = document->Root().Find("b").Find("c")[3];
+	EXPECT_FALSE(missing);
+	EXPECT_FALSE(missing.IsNull());
+	EXPECT_EQ(missing.Size(), 0u);
+	EXPECT_EQ(missing.AsString(), "");
+	EXPECT_FALSE(document->Root().Find("a")[1].IsValid());
+}
+
+// --- Strings -----------------------------------------------------------------
+
+TEST(JsonDocument, ViewsPlainStringsAndDecodesEscapedOnes)
+{
+	const std::string text = R"({"plain": "abc", "tab\tkey": "line\nbreak", "u": "\u00e9"})";
+	auto document = JsonDocument::Parse(text);
+	ASSERT_TRUE(document.has_value());
+
+	const JsonNode root = document->Root();
+	const std::string_view plain = root.Find("plain").AsString();
+	EXPECT_EQ(plain, "abc");
+	EXPECT_GE(plain.data(), text.data());
+	EXPECT_LT(plain.data(), text.data() + text.size());
+
+	EXPECT_EQ(root.Find("tab\tkey").AsString(), "line\nbreak");
+	EXPECT_EQ(root.Find("u").AsString(), "\xC3\xA9");
+}
+
+TEST(JsonDocument, DecodedStringsSurviveAMove)
+{
+	const std::string text = R"(["a\"b"])";
+	auto parsed = JsonDocument::Parse(text);
+	ASSERT_TRUE(parsed.has_value());
+
+	const JsonDocument moved = std::move(*parsed);
+	EXPECT_EQ(moved.Root()[0].AsString(), "a\"b");
+}
+
+// --- Large objects -----------------------------------------------------------
+
+TEST(JsonDocument, HashedObjectsFindEveryMember)
+{
+	std::string text = "{";
+	constexpr int kMembers = 200;
+	for (int i = 0; i < kMembers; ++i)
+		text += "\"key" + std::to_string(i) + "\": " + std::to_string(i) + ", ";
+	text += "\"key7\": -1}";
+
+	auto document = JsonDocument::Parse(text);
+	ASSERT_TRUE(document.has_value());
+	const JsonNode root = document->Root();
+	ASSERT_EQ(root.Size(), static_cast<std::size_t>(kMembers + 1));
+	for (int i = 0; i < kMembers; ++i)
+		EXPECT_DOUBLE_EQ(root.Find("key" + std::to_string(i)).AsNumber(), i);
+	EXPECT_FALSE(root.Find("key200"));
+	EXPECT_FALSE(root.Find(""));
+	// A repeated key resolves to its first member, as JsonValue::Find does.
+	EXPECT_DOUBLE_EQ(root.Find("key7").AsNumber(), 7.0);
+	EXPECT_DOUBLE_EQ(root[kMembers].AsNumber(), -1.0);
+}
+
+TEST(JsonDocument, MatchesJsonParse)
+{
+	const std::string text = R"({"zones": [
+		{"id": "z1", "bounds": {"min": [0, 0, 0], "max": [64, 8, 64]}, "streamed": true},
+		{"id": "z2", "bounds": {"min": [64, 0, 0], "max": [128, 8, 64]}, "streamed": false}
+	]})";
+	auto value = JsonParse(text);
+	auto document = JsonDocument::Parse(text);
+	ASSERT_TRUE(value.has_value());
+	ASSERT_TRUE(document.has_value());
+
+	const JsonValue& zones = *value->Find("zones");
+	const JsonNode zoneNodes = document->Root().Find("zones");
+	ASSERT_EQ(zoneNodes.Size(), zones.Size());
+	for (std::size_t i = 0; i < zones.Size(); ++i)
+	{
+		const JsonValue& zone = zones.AsArray()[i];
+		const JsonNode node = zoneNodes[i];
+		EXPECT_EQ(node.Find("id").AsString(), zone.Find("id")->AsString());
+		EXPECT_EQ(node.Find("streamed").AsBool(), zone.Find("streamed")->AsBool());
+		const JsonValue& max = *zone.Find("bounds")->Find("max");
+		for (std::size_t axis = 0; axis < 3; ++axis)
+			EXPECT_DOUBLE_EQ(node.Find("bounds").Find("max")[axis].AsNumber(), max.AsArray()[axis].AsNumber());
+	}
+}
+
+TEST(JsonDocument, DeepNestingIsFlat)
+{
+	constexpr std::size_t kDepth = 100000;
+	const std::string text = std::string(kDepth, '[') + std::string(kDepth, ']');
+	auto document = JsonDocument::Parse(text);
+	ASSERT_TRUE(document.has_value());
+	EXPECT_EQ(document->NodeCount(), kDepth);
+}
+
+// --- Errors ------------------------------------------------------------------
+
+TEST(JsonDocument, ReportsParseErrors)
+{
+	JsonParseError error;
+	EXPECT_FALSE(JsonDocument::Parse(R"({"a": [1, 2,]})", &error).has_value());
+	EXPECT_EQ(error.Message, "Unexpected character: ]");
+	EXPECT_EQ(error.Position, 12u);
+}
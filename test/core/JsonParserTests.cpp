@@ -2,6 +2,8 @@
 #include <core/json/JsonValue.h>
 #include <core/json/JsonParser.h>
 
+#include <string>
+
 // --- Primitives --------------------------------------------------------------
 
 TEST(JsonParser, ParseNull)
@@ -71,6 +73,19 @@ TEST(JsonParser, ParseStringWithUnicodeEscape)
 	EXPECT_EQ(result->AsString(), "A");
 }
 
+TEST(JsonParser, ParseLongStringsAcrossScanWidth)
+{
+	// Quotes and escapes on either side of each sixteen-byte scan step.
+	const std::string plain(37, 'x');
+	auto result = JsonParse("\"" + plain + "\"");
+	ASSERT_TRUE(result.has_value());
+	EXPECT_EQ(result->AsString(), plain);
+
+	result = JsonParse(R"("0123456789abcde\"0123456789abcdef\n0123456789abcdef")");
+	ASSERT_TRUE(result.has_value());
+	EXPECT_EQ(result->AsString(), "0123456789abcde\"0123456789abcdef\n0123456789abcdef");
+}
+
 // --- Arrays ------------------------------------------------------------------
 
 TEST(JsonParser, ParseEmptyArray)
@@ -161,6 +176,15 @@ TEST(JsonParser, ParseNestedStructure)
 	EXPECT_DOUBLE_EQ(count->AsNumber(), 2.0);
 }
 
+TEST(JsonParser, DuplicateKeysKeepEveryMemberInOrder)
+{
+	auto result = JsonParse(R"({"a": 1, "b": 2, "a": 3})");
+	ASSERT_TRUE(result.has_value());
+	ASSERT_EQ(result->Size(), 3u);
+	EXPECT_EQ(result->AsObject()[2].first, "a");
+	EXPECT_DOUBLE_EQ(result->Find("a")->AsNumber(), 1.0);
+}
+
 // --- Whitespace handling -----------------------------------------------------
 
 TEST(JsonParser, HandlesLeadingAndTrailingWhitespace)
@@ -208,3 +232,28 @@ TEST(JsonParser, ErrorReportsPosition)
 	EXPECT_FALSE(result.has_value());
 	EXPECT_GT(error.Position, 0u);
 }
+
+TEST(JsonParser, ErrorMessagesNameTheFault)
+{
+	JsonParseError error;
+	EXPECT_FALSE(JsonParse(R"({"a" 1})", &error).has_value());
+	EXPECT_EQ(error.Message, "Expected ':' after object key");
+	EXPECT_EQ(error.Position, 5u);
+
+	EXPECT_FALSE(JsonParse(R"([1 2])", &error).has_value());
+	EXPECT_EQ(error.Message, "Expected ',' or ']' in array");
+	EXPECT_EQ(error.Position, 3u);
+
+	EXPECT_FALSE(JsonParse(R"({"a": 1,})", &error).has_value());
+	EXPECT_EQ(error.Message, "Expected string key in object");
+
+	EXPECT_FALSE(JsonParse(R"("bad \q")", &error).has_value());
+	EXPECT_EQ(error.Message, "Invalid escape: \\q");
+
+	EXPECT_FALSE(JsonParse(R"("\u00G1")", &error).has_value());
+	EXPECT_EQ(error.Message, "Invalid \\u escape");
+
+	EXPECT_FALSE(JsonParse("{} {}", &error).has_value());
+	EXPECT_EQ(error.Message, "Unexpected trailing content");
+	EXPECT_EQ(error.Position, 3u);
+}
@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+#include <core/json/JsonReader.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+std::vector<JsonToken> Tokens(std::string_view text)
+{
+	JsonReader reader(text);
+	std::vector<JsonToken> tokens;
+	while (true)
+	{
+		const JsonToken token = reader.Next();
+		tokens.push_back(token);
+		if (token == JsonToken::End || token == JsonToken::Error)
+			return tokens;
+	}
+}
+
+} // anonymous namespace
+
+// --- Tokens ------------------------------------------------------------------
+
+TEST(JsonReader, TokenizesNestedDocument)
+{
+	const std::vector<JsonToken> expected = {
+		JsonToken::BeginObject,
+		JsonToken::Key, JsonToken::BeginArray,
+		JsonToken::Number, JsonToken::String, JsonToken::Bool, JsonToken::Null,
+		JsonToken::EndArray,
+		JsonToken::Key, JsonToken::BeginObject, JsonToken::EndObject,
+		JsonToken::EndObject,
+		JsonToken::End,
+	};
+	EXPECT_EQ(Tokens(R"({ "list": [1, "two", false, null], "empty": {} })"), expected);
+}
+
+TEST(JsonReader, ReportsValuesAndDepth)
+{
+	JsonReader reader(R"({"name": "Jump", "scale": -2.5e1, "on": true})");
+	ASSERT_EQ(reader.Next(), JsonToken::BeginObject);
+	EXPECT_EQ(reader.Depth(), 1u);
+
+	ASSERT_EQ(reader.Next(), JsonToken::Key);
+	EXPECT_EQ(reader.String(), "name");
+	ASSERT_EQ(reader.Next(), JsonToken::String);
+	EXPECT_EQ(reader.String(), "Jump");
+
+	ASSERT_EQ(reader.Next(), JsonToken::Key);
+	ASSERT_EQ(reader.Next(), JsonToken::Number);
+	EXPECT_DOUBLE_EQ(reader.Number(), -25.0);
+
+	ASSERT_EQ(reader.Next(), JsonToken::Key);
+	ASSERT_EQ(reader.Next(), JsonToken::Bool);
+	EXPECT_TRUE(reader.Bool());
+
+	ASSERT_EQ(reader.Next(), JsonToken::EndObject);
+	EXPECT_EQ(reader.Depth(), 0u);
+	EXPECT_EQ(reader.Next(), JsonToken::End);
+	EXPECT_EQ(reader.Next(), JsonToken::End);
+}
+
+// --- Strings -----------------------------------------------------------------
+
+TEST(JsonReader, PlainStringsAreViewsIntoTheInput)
+{
+	const std::string text = R"(["plain", "esc\"aped"])";
+	JsonReader reader(text);
+	ASSERT_EQ(reader.Next(), JsonToken::BeginArray);
+
+	ASSERT_EQ(reader.Next(), JsonToken::String);
+	EXPECT_TRUE(reader.StringInInput());
+	EXPECT_EQ(reader.String().data(), text.data() + 2);
+
+	ASSERT_EQ(reader.Next(), JsonToken::String);
+	EXPECT_FALSE(reader.StringInInput());
+	EXPECT_EQ(reader.String(), "esc\"aped");
+}
+
+// --- Skipping ----------------------------------------------------------------
+
+TEST(JsonReader, SkipContainerResumesAfterTheClose)
+{
+	JsonReader reader(R"({"skip": {"a": [1, {"b": "]}"}], "c": {}}, "keep": 3})");
+	ASSERT_EQ(reader.Next(), JsonToken::BeginObject);
+	ASSERT_EQ(reader.Next(), JsonToken::Key);
+	ASSERT_EQ(reader.Next(), JsonToken::BeginObject);
+	ASSERT_TRUE(reader.SkipContainer());
+	EXPECT_EQ(reader.Depth(), 1u);
+
+	ASSERT_EQ(reader.Next(), JsonToken::Key);
+	EXPECT_EQ(reader.String(), "keep");
+	ASSERT_EQ(reader.Next(), JsonToken::Number);
+	EXPECT_DOUBLE_EQ(reader.Number(), 3.0);
+}
+
+TEST(JsonReader, DeepNestingUsesNoCallStack)
+{
+	constexpr std::size_t kDepth = 200000;
+	const std::string text = std::string(kDepth, '[') + std::string(kDepth, ']');
+	JsonReader reader(text);
+	std::size_t deepest = 0;
+	JsonToken token;
+	while ((token = reader.Next()) != JsonToken::End)
+	{
+		ASSERT_NE(token, JsonToken::Error);
+		deepest = std::max(deepest, reader.Depth());
+	}
+	EXPECT_EQ(deepest, kDepth);
+}
+
+// --- Errors ------------------------------------------------------------------
+
+TEST(JsonReader, FirstErrorSticks)
+{
+	JsonReader reader("[1, }");
+	ASSERT_EQ(reader.Next(), JsonToken::BeginArray);
+	ASSERT_EQ(reader.Next(), JsonToken::Number);
+	EXPECT_EQ(reader.Next(), JsonToken::Error);
+	EXPECT_TRUE(reader.Failed());
+	EXPECT_EQ(reader.Error().Message, "Unexpected character: }");
+	EXPECT_EQ(reader.Error().Position, 4u);
+	EXPECT_EQ(reader.Next(), JsonToken::Error);
+	EXPECT_EQ(reader.Error().Position, 4u);
+}
+
+TEST(JsonReader, RejectsUnclosedContainers)
+{
+	EXPECT_EQ(Tokens("[1, 2").back(), JsonToken::Error);
+	EXPECT_EQ(Tokens(R"({"a": 1)").back(), JsonToken::Error);
+	EXPECT_EQ(Tokens(R"({"a")").back(), JsonToken::Error);
+}
@@ -12,8 +12,11 @@
 #include <assets/cook/BlendCook.h>
 #include <assets/cook/MeshCook.h>
 #include <assets/static_mesh/MeshLoader.h>
+#include <assets/static_mesh/StaticMeshFormat.h>
 #include <core/logging/LoggingProvider.h>
 
+#include <algorithm>
+#include <array>
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
@@ -359,6 +362,76 @@ TEST(MeshCook, ImportIsDeterministic)
     EXPECT_EQ(first.Files, second.Files);
 }
 
+TEST(MeshCook, CookedMeshIsQuantizedAndDecodesWithinTolerance)
+{
+    const std::string gltf = QuadGltf(kQuadMeshNoTangents);
+    std::vector<ImportedGltfMesh> imported;
+    std::string error;
+    ASSERT_TRUE(ImportGltfMeshes(AsBytes(gltf), imported, &error)) << error;
+    ASSERT_EQ(imported.size(), 1u);
+    const MeshGeometry& source = imported[0].Geometry;
+
+    GltfMeshImporter importer;
+    MemoryCookOutputWriter output;
+    ASSERT_TRUE(importer.Import(ImportInput{ "m/q.gltf", AsBytes(gltf) }, output).IsValid());
+    const std::vector<std::byte>& bytes = output.Files.at(".cooked/m/q.gltf.smesh");
+
+    SmeshFileHeader header{};
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    EXPECT_NE(header.Flags & kSmeshFlagQuantized, 0u);
+    EXPECT_EQ(header.IndexFormat, SmeshIndexFormat::UInt16);
+
+    LoggingProvider logging;
+    MeshLoader loader(logging);
+    MeshGeometry loaded;
+    ASSERT_TRUE(loader.LoadFromBytes(bytes, loaded));
+    ASSERT_EQ(loaded.Vertices.size(), source.Vertices.size());
+    ASSERT_EQ(loaded.Indices.size(), source.Indices.size());
+
+    // The cook reorders vertices and triangles: match each decoded vertex
+    // to the source vertex it came from, then compare the triangles.
+    std::vector<uint32_t> sourceOf(loaded.Vertices.size());
+    for (size_t vertex = 0; vertex < loaded.Vertices.size(); ++vertex)
+    {
+        const StaticMeshVertex& actual = loaded.Vertices[vertex];
+        size_t nearest = 0;
+        for (size_t candidate = 1; candidate < source.Vertices.size(); ++candidate)
+        {
+            if (Vec3d::Distance(source.Vertices[candidate].Position, actual.Position)
+                < Vec3d::Distance(source.Vertices[nearest].Position, actual.Position))
+            {
+                nearest = candidate;
+            }
+        }
+        const StaticMeshVertex& expected = source.Vertices[nearest];
+        sourceOf[vertex] = static_cast<uint32_t>(nearest);
+        EXPECT_LE(Vec3d::Distance(actual.Position, expected.Position), 1.0f / 65535.0f);
+        EXPECT_GT(actual.Normal.Dot(expected.Normal), 0.9999f);
+        EXPECT_GT(Vec3d(actual.Tangent.X, actual.Tangent.Y, actual.Tangent.Z)
+                      .Dot(Vec3d(expected.Tangent.X, expected.Tangent.Y, expected.Tangent.Z)),
+                  0.9999f);
+        EXPECT_EQ(actual.Tangent.W, expected.Tangent.W);
+        EXPECT_NEAR(actual.Uv0.X, expected.Uv0.X, 1.0f / 2048.0f);
+        EXPECT_NEAR(actual.Uv0.Y, expected.Uv0.Y, 1.0f / 2048.0f);
+    }
+
+    const auto triangles = [](const std::vector<uint32_t>& indices, const std::vector<uint32_t>* remap)
+    {
+        std::vector<std::array<uint32_t, 3>> out;
+        for (size_t corner = 0; corner + 2 < indices.size(); corner += 3)
+        {
+            std::array<uint32_t, 3> triangle;
+            for (int k = 0; k < 3; ++k)
+                triangle[k] = remap != nullptr ? (*remap)[indices[corner + k]] : indices[corner + k];
+            std::rotate(triangle.begin(), std::min_element(triangle.begin(), triangle.end()), triangle.end());
+            out.push_back(triangle);
+        }
+        std::sort(out.begin(), out.end());
+        return out;
+    };
+    EXPECT_EQ(triangles(loaded.Indices, &sourceOf), triangles(source.Indices, nullptr));
+}
+
 // -- Format version gate --------------------------------------------------------
 
 TEST(MeshCook, LoaderRejectsVersionOneSmesh)
@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+
+#ifdef SENCHA_ENABLE_COOK
+
+#include <assets/cook/MeshOptimize.h>
+#include <render/static_mesh/MeshValidation.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <vector>
+
+namespace
+{
+    // A cells x cells sheet with its triangles shuffled: what a cook gets
+    // from an exporter that wrote faces in no useful order.
+    MeshGeometry MakeShuffledGrid(uint32_t cells, uint32_t seed)
+    {
+        MeshGeometry mesh;
+        for (uint32_t y = 0; y <= cells; ++y)
+        {
+            for (uint32_t x = 0; x <= cells; ++x)
+            {
+                StaticMeshVertex vertex;
+                vertex.Position = Vec3d(static_cast<float>(x), 0.0f, static_cast<float>(y));
+                vertex.Normal = Vec3d(0.0f, 1.0f, 0.0f);
+                vertex.Tangent = Vec4(1.0f, 0.0f, 0.0f, 1.0f);
+                mesh.Vertices.push_back(vertex);
+            }
+        }
+
+        std::vector<std::array<uint32_t, 3>> triangles;
+        for (uint32_t y = 0; y < cells; ++y)
+        {
+            for (uint32_t x = 0; x < cells; ++x)
+            {
+                const uint32_t corner = y * (cells + 1) + x;
+                triangles.push_back({ corner, corner + cells + 1, corner + 1 });
+                triangles.push_back({ corner + 1, corner + cells + 1, corner + cells + 2 });
+            }
+        }
+        std::mt19937 rng(seed);
+        std::shuffle(triangles.begin(), triangles.end(), rng);
+        for (const std::array<uint32_t, 3>& triangle : triangles)
+            mesh.Indices.insert(mesh.Indices.end(), triangle.begin(), triangle.end());
+
+        mesh.Sections.push_back({
+            .IndexOffset = 0,
+            .IndexCount = static_cast<uint32_t>(mesh.Indices.size()),
+            .VertexOffset = 0,
+            .VertexCount = static_cast<uint32_t>(mesh.Vertices.size()),
+            .MaterialSlot = 0,
+        });
+        return mesh;
+    }
+
+    // Triangles by the positions of their corners, each rotated to start at
+    // its smallest corner so winding is kept but the starting corner is not.
+    std::vector<std::array<float, 9>> TriangleSet(const MeshGeometry& mesh)
+    {
+        std::vector<std::array<float, 9>> set;
+        for (size_t triangle = 0; triangle + 2 < mesh.Indices.size(); triangle += 3)
+        {
+            std::array<std::array<float, 3>, 3> corners;
+            for (int corner = 0; corner < 3; ++corner)
+            {
+                const Vec3d& p = mesh.Vertices[mesh.Indices[triangle + corner]].Position;
+                corners[corner] = { p.X, p.Y, p.Z };
+            }
+            std::rotate(corners.begin(), std::min_element(corners.begin(), corners.end()), corners.end());
+            std::array<float, 9> flat;
+            for (int corner = 0; corner < 3; ++corner)
+                std::copy(corners[corner].begin(), corners[corner].end(), flat.begin() + corner * 3);
+            set.push_back(flat);
+        }
+        std::sort(set.begin(), set.end());
+        return set;
+    }
+}
+
+TEST(MeshOptimize, CacheOrderCutsVertexShaderWorkOfAShuffledGrid)
+{
+    MeshGeometry mesh = MakeShuffledGrid(48, 7);
+    const std::vector<std::array<float, 9>> before = TriangleSet(mesh);
+
+    const MeshOptimizeStats stats = OptimizeMeshForGpu(mesh);
+    EXPECT_GT(stats.AcmrBefore, 2.0);
+    EXPECT_LT(stats.AcmrAfter, 0.9);
+    EXPECT_DOUBLE_EQ(stats.AcmrAfter, ComputeVertexCacheAcmr(mesh.Indices));
+
+    EXPECT_TRUE(ValidateMeshGeometry(mesh).IsValid());
+    EXPECT_EQ(TriangleSet(mesh), before);
+}
+
+TEST(MeshOptimize, VerticesAreNumberedInFirstUseOrder)
+{
+    MeshGeometry mesh = MakeShuffledGrid(16, 3);
+    const MeshOptimizeStats stats = OptimizeMeshForGpu(mesh);
+    ASSERT_TRUE(stats.FetchReordered);
+
+    uint32_t next = 0;
+    std::vector<bool> seen(mesh.Vertices.size(), false);
+    for (uint32_t index : mesh.Indices)
+    {
+        if (seen[index])
+            continue;
+        EXPECT_EQ(index, next);
+        seen[index] = true;
+        ++next;
+    }
+}
+
+TEST(MeshOptimize, SkinningInfluencesFollowTheirVertices)
+{
+    MeshGeometry mesh = MakeShuffledGrid(12, 11);
+    MeshSkinning skinning;
+    skinning.JointCount = 1;
+    std::map<std::pair<float, float>, uint16_t> tagAt;
+    for (size_t vertex = 0; vertex < mesh.Vertices.size(); ++vertex)
+    {
+        MeshSkinInfluence influence;
+        influence.Joints[1] = static_cast<uint16_t>(vertex);
+        influence.Weights[0] = 255;
+        skinning.Influences.push_back(influence);
+        tagAt[{ mesh.Vertices[vertex].Position.X, mesh.Vertices[vertex].Position.Z }] =
+            static_cast<uint16_t>(vertex);
+    }
+
+    OptimizeMeshForGpu(mesh, &skinning);
+    ASSERT_EQ(skinning.Influences.size(), mesh.Vertices.size());
+    for (size_t vertex = 0; vertex < mesh.Vertices.size(); ++vertex)
+    {
+        const Vec3d& position = mesh.Vertices[vertex].Position;
+        EXPECT_EQ(skinning.Influences[vertex].Joints[1], (tagAt[{ position.X, position.Z }]));
+    }
+}
+
+TEST(MeshOptimize, SectionsKeepTheirRanges)
+{
+    // Two sections over one shared vertex range: triangles reorder within
+    // each section, but renumbering for one would break the other.
+    MeshGeometry mesh = MakeShuffledGrid(8, 5);
+    const uint32_t half = static_cast<uint32_t>(mesh.Indices.size() / 6) * 3;
+    mesh.Sections[0].IndexCount = half;
+    mesh.Sections.push_back({
+        .IndexOffset = half,
+        .IndexCount = static_cast<uint32_t>(mesh.Indices.size()) - half,
+        .VertexOffset = 0,
+        .VertexCount = static_cast<uint32_t>(mesh.Vertices.size()),
+        .MaterialSlot = 1,
+    });
+
+    MeshGeometry firstOnly = mesh;
+    firstOnly.Indices.resize(half);
+    const std::vector<std::array<float, 9>> firstBefore = TriangleSet(firstOnly);
+
+    const MeshOptimizeStats stats = OptimizeMeshForGpu(mesh);
+    EXPECT_FALSE(stats.FetchReordered);
+    EXPECT_TRUE(ValidateMeshGeometry(mesh).IsValid());
+
+    firstOnly = mesh;
+    firstOnly.Indices.resize(half);
+    EXPECT_EQ(TriangleSet(firstOnly), firstBefore);
+}
+
+#endif // SENCHA_ENABLE_COOK
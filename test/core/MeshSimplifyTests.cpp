@@ -0,0 +1,209 @@
+#include <gtest/gtest.h>
+
+#ifdef SENCHA_ENABLE_COOK
+
+#include <assets/cook/MeshSimplify.h>
+#include <render/static_mesh/MeshValidation.h>
+#include <render/static_mesh/StaticMeshPrimitives.h>
+
+#include <cmath>
+#include <cstdint>
+#include <set>
+#include <vector>
+
+namespace
+{
+    // A cells x cells sheet over [0, cells] in XZ, lifted by `height`.
+    // Vertices in column `seamColumn` are duplicated (one copy per side), as
+    // a UV seam would split them; pass cells + 1 for no seam.
+    template <typename THeight>
+    MeshGeometry MakeSheet(uint32_t cells, uint32_t seamColumn, THeight height)
+    {
+        MeshGeometry mesh;
+        const uint32_t row = cells + 1;
+        const auto addVertex = [&](uint32_t x, uint32_t y)
+        {
+            StaticMeshVertex vertex;
+            vertex.Position = Vec3d(static_cast<float>(x), height(float(x), float(y)), static_cast<float>(y));
+            vertex.Normal = Vec3d(0.0f, 1.0f, 0.0f);
+            vertex.Tangent = Vec4(1.0f, 0.0f, 0.0f, 1.0f);
+            mesh.Vertices.push_back(vertex);
+        };
+        for (uint32_t y = 0; y <= cells; ++y)
+        {
+            for (uint32_t x = 0; x <= cells; ++x)
+                addVertex(x, y);
+        }
+        // The right-hand copy of the seam column.
+        const uint32_t seamBase = static_cast<uint32_t>(mesh.Vertices.size());
+        if (seamColumn <= cells)
+        {
+            for (uint32_t y = 0; y <= cells; ++y)
+                addVertex(seamColumn, y);
+        }
+        const auto at = [&](uint32_t x, uint32_t y, bool right)
+        {
+            return x == seamColumn && right ? seamBase + y : y * row + x;
+        };
+        for (uint32_t y = 0; y < cells; ++y)
+        {
+            for (uint32_t x = 0; x < cells; ++x)
+            {
+                const bool right = x >= seamColumn;
+                mesh.Indices.insert(mesh.Indices.end(), { at(x, y, right), at(x, y + 1, right), at(x + 1, y, right),
+                                                          at(x + 1, y, right), at(x, y + 1, right),
+                                                          at(x + 1, y + 1, right) });
+            }
+        }
+        mesh.Sections.push_back({
+            .IndexOffset = 0,
+            .IndexCount = static_cast<uint32_t>(mesh.Indices.size()),
+            .VertexOffset = 0,
+            .VertexCount = static_cast<uint32_t>(mesh.Vertices.size()),
+            .MaterialSlot = 0,
+        });
+        RecomputeMeshBounds(mesh);
+        return mesh;
+    }
+
+    float Flat(float, float) { return 0.0f; }
+
+    float Bumpy(float x, float y) { return 0.5f * std::sin(x * 0.4f) * std::cos(y * 0.3f); }
+
+    double SignedAreaY(const MeshGeometry& mesh, std::span<const uint32_t> indices)
+    {
+        double area = 0.0;
+        for (std::size_t corner = 0; corner + 2 < indices.size(); corner += 3)
+        {
+            const Vec3d& a = mesh.Vertices[indices[corner]].Position;
+            const Vec3d& b = mesh.Vertices[indices[corner + 1]].Position;
+            const Vec3d& c = mesh.Vertices[indices[corner + 2]].Position;
+            area += 0.5 * (b - a).Cross(c - a).Y;
+        }
+        return area;
+    }
+}
+
+TEST(MeshSimplify, FlatSheetCollapsesFarWithoutErrorOrFlips)
+{
+    const MeshGeometry mesh = MakeSheet(16, 17, Flat);
+    float error = -1.0f;
+    const std::vector<uint32_t> simplified = SimplifyTriangles(mesh.Vertices, mesh.Indices, 0, 1e-3f, &error);
+
+    // Everything on the plane and its straight borders is free to go; the
+    // corners hold the outline.
+    EXPECT_LE(simplified.size(), 8u * 3u);
+    EXPECT_GE(simplified.size(), 2u * 3u);
+    EXPECT_LT(error, 1e-3f);
+    // Same winding, same covered area: nothing folded over.
+    EXPECT_NEAR(SignedAreaY(mesh, simplified), SignedAreaY(mesh, mesh.Indices), 1e-3);
+}
+
+TEST(MeshSimplify, ErrorBudgetBoundsTheCollapse)
+{
+    const MeshGeometry mesh = MakeSheet(24, 25, Bumpy);
+    float tight = -1.0f;
+    const std::vector<uint32_t> fine = SimplifyTriangles(mesh.Vertices, mesh.Indices, 0, 0.01f, &tight);
+    float loose = -1.0f;
+    const std::vector<uint32_t> coarse = SimplifyTriangles(mesh.Vertices, mesh.Indices, 0, 0.2f, &loose);
+
+    EXPECT_LE(tight, 0.01f);
+    EXPECT_LE(loose, 0.2f);
+    EXPECT_LT(fine.size(), mesh.Indices.size());
+    EXPECT_LT(coarse.size(), fine.size());
+}
+
+TEST(MeshSimplify, SeamVerticesStayReferenced)
+{
+    const MeshGeometry mesh = MakeSheet(16, 8, Flat);
+    const std::vector<uint32_t> simplified = SimplifyTriangles(mesh.Vertices, mesh.Indices, 0, 1e-3f);
+    const std::set<uint32_t> used(simplified.begin(), simplified.end());
+
+    // Both copies of every seam vertex survive, so the split in the
+    // attributes stays exactly where it was.
+    for (uint32_t y = 0; y <= 16; ++y)
+    {
+        EXPECT_TRUE(used.contains(y * 17 + 8)) << y;
+        EXPECT_TRUE(used.contains(17u * 17u + y)) << y;
+    }
+}
+
+TEST(MeshLodGeneration, ChainsValidateAndCoarsenWithRisingError)
+{
+    MeshGeometry mesh = MakeSheet(32, 33, Bumpy);
+    const MeshLodSettings settings{ .MaxLods = 4, .MaxRelativeError = 0.05f };
+    const uint32_t built = GenerateMeshLods(mesh, settings);
+    ASSERT_GT(built, 1u);
+    ASSERT_EQ(mesh.Sections[0].Lods.size(), built);
+    EXPECT_TRUE(ValidateMeshGeometry(mesh).IsValid());
+
+    const float budget = 0.05f * ComputeMeshSectionBounds(mesh, mesh.Sections[0]).Size().Magnitude();
+    uint32_t previousCount = mesh.Sections[0].IndexCount;
+    float previousError = 0.0f;
+    for (const StaticMeshLod& lod : mesh.Sections[0].Lods)
+    {
+        EXPECT_LE(static_cast<double>(lod.IndexCount), previousCount * (1.0 - settings.MinReduction));
+        EXPECT_GE(lod.Error, previousError);
+        EXPECT_LE(lod.Error, budget);
+        previousCount = lod.IndexCount;
+        previousError = lod.Error;
+    }
+
+    // A second run leaves existing chains alone.
+    const std::size_t indexCount = mesh.Indices.size();
+    EXPECT_EQ(GenerateMeshLods(mesh, settings), 0u);
+    EXPECT_EQ(mesh.Indices.size(), indexCount);
+}
+
+TEST(MeshLodGeneration, PositionsSharedBetweenSectionsArePinned)
+{
+    // The seam column's two copies belong to two sections: every level of
+    // both must keep the shared edge, or sections at different levels crack.
+    MeshGeometry mesh = MakeSheet(16, 8, Flat);
+    const uint32_t half = mesh.Sections[0].IndexCount / 2;
+    mesh.Sections.clear();
+    // Rows alternate left and right halves; regroup the triangles per side.
+    std::vector<uint32_t> left;
+    std::vector<uint32_t> right;
+    for (uint32_t corner = 0; corner < mesh.Indices.size(); corner += 3)
+    {
+        const float x = (mesh.Vertices[mesh.Indices[corner]].Position.X
+                         + mesh.Vertices[mesh.Indices[corner + 1]].Position.X
+                         + mesh.Vertices[mesh.Indices[corner + 2]].Position.X) / 3.0f;
+        std::vector<uint32_t>& side = x < 8.0f ? left : right;
+        side.insert(side.end(), mesh.Indices.begin() + corner, mesh.Indices.begin() + corner + 3);
+    }
+    ASSERT_EQ(left.size(), half);
+    mesh.Indices = left;
+    mesh.Indices.insert(mesh.Indices.end(), right.begin(), right.end());
+    const uint32_t vertexCount = static_cast<uint32_t>(mesh.Vertices.size());
+    mesh.Sections.push_back({ .IndexOffset = 0, .IndexCount = half, .VertexOffset = 0, .VertexCount = vertexCount });
+    mesh.Sections.push_back(
+        { .IndexOffset = half, .IndexCount = half, .VertexOffset = 0, .VertexCount = vertexCount, .MaterialSlot = 1 });
+    RecomputeMeshBounds(mesh);
+
+    ASSERT_GT(GenerateMeshLods(mesh), 0u);
+    for (const StaticMeshSection& section : mesh.Sections)
+    {
+        for (const StaticMeshLod& lod : section.Lods)
+        {
+            std::set<float> seamRows;
+            for (uint32_t index = lod.IndexOffset; index < lod.IndexOffset + lod.IndexCount; ++index)
+            {
+                const Vec3d& position = mesh.Vertices[mesh.Indices[index]].Position;
+                if (position.X == 8.0f)
+                    seamRows.insert(position.Z);
+            }
+            EXPECT_EQ(seamRows.size(), 17u);
+        }
+    }
+}
+
+TEST(MeshLodGeneration, SmallSectionsGetNoChain)
+{
+    MeshGeometry cube = StaticMeshPrimitives::BuildCube(1.0f);
+    EXPECT_EQ(GenerateMeshLods(cube), 0u);
+    EXPECT_TRUE(cube.Sections[0].Lods.empty());
+}
+
+#endif // SENCHA_ENABLE_COOK
@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+
+#ifdef SENCHA_ENABLE_COOK
+
+#include <assets/cook/MeshletBuild.h>
+#include <render/static_mesh/MeshValidation.h>
+#include <render/static_mesh/StaticMeshPrimitives.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <set>
+#include <vector>
+
+namespace
+{
+    // A cells x cells sheet over [0, cells] in XZ, wound to face +Y and
+    // lifted into a dome so its normals fan out.
+    MeshGeometry MakeDome(uint32_t cells)
+    {
+        MeshGeometry mesh;
+        const uint32_t row = cells + 1;
+        const float half = 0.5f * static_cast<float>(cells);
+        for (uint32_t y = 0; y <= cells; ++y)
+        {
+            for (uint32_t x = 0; x <= cells; ++x)
+            {
+                const float dx = (static_cast<float>(x) - half) / half;
+                const float dy = (static_cast<float>(y) - half) / half;
+                StaticMeshVertex vertex;
+                vertex.Position = Vec3d(static_cast<float>(x), half * (1.0f - 0.5f * (dx * dx + dy * dy)),
+                                        static_cast<float>(y));
+                vertex.Normal = Vec3d(0.0f, 1.0f, 0.0f);
+                vertex.Tangent = Vec4(1.0f, 0.0f, 0.0f, 1.0f);
+                mesh.Vertices.push_back(vertex);
+            }
+        }
+        for (uint32_t y = 0; y < cells; ++y)
+        {
+            for (uint32_t x = 0; x < cells; ++x)
+            {
+                const uint32_t corner = y * row + x;
+                mesh.Indices.insert(mesh.Indices.end(), { corner, corner + row, corner + 1,
+                                                          corner + 1, corner + row, corner + row + 1 });
+            }
+        }
+        mesh.Sections.push_back({
+            .IndexOffset = 0,
+            .IndexCount = static_cast<uint32_t>(mesh.Indices.size()),
+            .VertexOffset = 0,
+            .VertexCount = static_cast<uint32_t>(mesh.Vertices.size()),
+            .MaterialSlot = 0,
+        });
+        RecomputeMeshBounds(mesh);
+        return mesh;
+    }
+
+    std::multiset<std::array<uint32_t, 3>> Triangles(const MeshGeometry& mesh, uint32_t offset, uint32_t count)
+    {
+        std::multiset<std::array<uint32_t, 3>> triangles;
+        for (uint32_t corner = offset; corner < offset + count; corner += 3)
+            triangles.insert({ mesh.Indices[corner], mesh.Indices[corner + 1], mesh.Indices[corner + 2] });
+        return triangles;
+    }
+
+    Vec3d GeometricNormal(const MeshGeometry& mesh, uint32_t corner)
+    {
+        const Vec3d& a = mesh.Vertices[mesh.Indices[corner]].Position;
+        const Vec3d& b = mesh.Vertices[mesh.Indices[corner + 1]].Position;
+        const Vec3d& c = mesh.Vertices[mesh.Indices[corner + 2]].Position;
+        return (b - a).Cross(c - a).Normalized();
+    }
+}
+
+TEST(MeshletBuild, MeshletsRespectLimitsAndTileTheSection)
+{
+    MeshGeometry mesh = MakeDome(24);
+    const MeshletLimits limits{ .MaxVertices = 32, .MaxTriangles = 40 };
+    const uint32_t built = BuildMeshlets(mesh, limits);
+
+    const StaticMeshSection& section = mesh.Sections[0];
+    ASSERT_EQ(built, section.Meshlets.size());
+    // 1152 triangles at no more than 40 each, and not badly fragmented.
+    EXPECT_GE(built, 29u);
+    EXPECT_LE(built, 60u);
+    EXPECT_TRUE(ValidateMeshGeometry(mesh).IsValid());
+
+    for (const StaticMeshMeshlet& meshlet : section.Meshlets)
+    {
+        EXPECT_LE(meshlet.IndexCount / 3, limits.MaxTriangles);
+        const std::set<uint32_t> vertices(mesh.Indices.begin() + meshlet.IndexOffset,
+                                          mesh.Indices.begin() + meshlet.IndexOffset + meshlet.IndexCount);
+        EXPECT_LE(vertices.size(), limits.MaxVertices);
+    }
+}
+
+TEST(MeshletBuild, OnlyTheTriangleOrderChanges)
+{
+    MeshGeometry mesh = MakeDome(16);
+    const MeshGeometry source = mesh;
+    BuildMeshlets(mesh);
+
+    EXPECT_EQ(mesh.Vertices.size(), source.Vertices.size());
+    ASSERT_EQ(mesh.Indices.size(), source.Indices.size());
+    const StaticMeshSection& section = mesh.Sections[0];
+    EXPECT_EQ(Triangles(mesh, section.IndexOffset, section.IndexCount),
+              Triangles(source, section.IndexOffset, section.IndexCount));
+}
+
+TEST(MeshletBuild, BoundsHoldEveryVertexAndConesEveryNormal)
+{
+    MeshGeometry mesh = MakeDome(24);
+    BuildMeshlets(mesh);
+
+    uint32_t withCone = 0;
+    for (const StaticMeshMeshlet& meshlet : mesh.Sections[0].Meshlets)
+    {
+        for (uint32_t corner = meshlet.IndexOffset; corner < meshlet.IndexOffset + meshlet.IndexCount; ++corner)
+        {
+            const Vec3d& position = mesh.Vertices[mesh.Indices[corner]].Position;
+            EXPECT_LE(Vec3d::Distance(position, meshlet.Center), meshlet.Radius * 1.0001f + 1e-5f);
+        }
+        if (meshlet.ConeCutoff <= 0.0f)
+            continue;
+        ++withCone;
+        for (uint32_t corner = meshlet.IndexOffset; corner < meshlet.IndexOffset + meshlet.IndexCount; corner += 3)
+            EXPECT_GE(GeometricNormal(mesh, corner).Dot(meshlet.ConeAxis), meshlet.ConeCutoff - 1e-5f);
+    }
+    // A dome gently curved over each meshlet: every one gets a usable cone.
+    EXPECT_EQ(withCone, mesh.Sections[0].Meshlets.size());
+}
+
+TEST(MeshletBuild, SeamsDoNotSplitMeshlets)
+{
+    // The cube's faces share no vertices, only positions: twelve triangles
+    // over 24 vertices fit one meshlet when positions connect them.
+    MeshGeometry cube = StaticMeshPrimitives::BuildCube(2.0f);
+    ASSERT_EQ(cube.Sections.size(), 1u);
+    EXPECT_EQ(BuildMeshlets(cube), 1u);
+    const StaticMeshMeshlet& meshlet = cube.Sections[0].Meshlets[0];
+    EXPECT_EQ(meshlet.IndexCount, cube.Sections[0].IndexCount);
+    // Faces point every way: no cone.
+    EXPECT_LE(meshlet.ConeCutoff, 0.0f);
+    EXPECT_TRUE(ValidateMeshGeometry(cube).IsValid());
+}
+
+TEST(MeshletBuild, LodRangesAndExistingMeshletsAreLeftAlone)
+{
+    MeshGeometry mesh = MakeDome(8);
+    const uint32_t baseCount = mesh.Sections[0].IndexCount;
+    mesh.Indices.insert(mesh.Indices.end(), mesh.Indices.begin(), mesh.Indices.begin() + 30);
+    mesh.Sections[0].Lods.push_back({ .IndexOffset = baseCount, .IndexCount = 30, .Error = 0.5f });
+    const std::vector<uint32_t> lod(mesh.Indices.begin() + baseCount, mesh.Indices.end());
+
+    ASSERT_GT(BuildMeshlets(mesh), 0u);
+    EXPECT_TRUE(std::equal(lod.begin(), lod.end(), mesh.Indices.begin() + baseCount));
+
+    const std::vector<uint32_t> clustered = mesh.Indices;
+    const std::size_t meshletCount = mesh.Sections[0].Meshlets.size();
+    EXPECT_EQ(BuildMeshlets(mesh), 0u);
+    EXPECT_EQ(mesh.Indices, clustered);
+    EXPECT_EQ(mesh.Sections[0].Meshlets.size(), meshletCount);
+}
+
+#endif // SENCHA_ENABLE_COOK
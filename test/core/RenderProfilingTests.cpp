@@ -124,8 +124,16 @@ namespace
         record.Stats.ScratchAllocFailures = static_cast<std::uint32_t>(frame);
         record.Stats.PassesSkipped = static_cast<std::uint32_t>(frame);
         record.Stats.InstancesDropped = static_cast<std::uint32_t>(frame * 3);
+        record.Stats.LodReducedItems = static_cast<std::uint32_t>(frame * 5);
+        record.Stats.FullDetailTriangles = static_cast<std::uint32_t>(frame * 300);
+        record.Stats.MeshletsTested = static_cast<std::uint32_t>(frame * 40);
+        record.Stats.MeshletsCulled = static_cast<std::uint32_t>(frame * 25);
         record.Stats.ShadowCastersTested = static_cast<std::uint32_t>(frame * 100);
         record.Stats.ShadowCastersVisible = static_cast<std::uint32_t>(frame * 4);
+        record.Stats.TextureResidentBytes = frame * 4096;
+        record.Stats.TextureMipsRequested = static_cast<std::uint32_t>(frame * 12);
+        record.Stats.TextureMipsResident = static_cast<std::uint32_t>(frame * 8);
+        record.Stats.TextureStreamLatencyUs = frame * 2500;
         record.Timing.RawDtSeconds = 0.016;
         record.Timing.GpuScopes[0] = GpuScopeSpan{ .Milliseconds = 1.5f, .Valid = true };
         record.Timing.CpuScopes.Add(CpuScope::Extraction, 0.25);
@@ -180,7 +188,7 @@ TEST(RenderCapture, JsonEnvelopeCarriesSchemaCvarsAndUnitKeyedFrames)
     ASSERT_TRUE(parsed.has_value()) << error.Message;
     const JsonValue& root = *parsed;
     ASSERT_NE(root.Find("schema_version"), nullptr);
-    EXPECT_EQ(root.Find("schema_version")->AsNumber(), 4.0);
+    EXPECT_EQ(root.Find("schema_version")->AsNumber(), 7.0);
     EXPECT_EQ(root.Find("frame_count")->AsNumber(), 3.0);
     ASSERT_NE(root.Find("cvars"), nullptr);
     ASSERT_NE(root.Find("cvars")->Find("render.profile.mode"), nullptr);
@@ -239,6 +247,63 @@ TEST(RenderCapture, FramesCarryTheWorkDroppedAndTheBudgetItWasDroppedAgainst)
     EXPECT_EQ(frame.Find("shadow_casters_visible_count")->AsNumber(), 4.0);
 }
 
+TEST(RenderCapture, FramesCarryLodReductionAgainstFullDetail)
+{
+    RenderCapture capture;
+    capture.Start(0);
+    const RenderCapture::FrameRecord record = MakeRecord(2);
+    capture.Append(record.Timing, record.Stats);
+
+    const std::optional<JsonValue> parsed = JsonParse(capture.SerializeJson({}));
+    ASSERT_TRUE(parsed.has_value());
+    const JsonValue& frame = parsed->Find("frames")->AsArray().front();
+
+    ASSERT_NE(frame.Find("lod_reduced_items_count"), nullptr);
+    EXPECT_EQ(frame.Find("lod_reduced_items_count")->AsNumber(), 10.0);
+    ASSERT_NE(frame.Find("full_detail_triangles_count"), nullptr);
+    EXPECT_EQ(frame.Find("full_detail_triangles_count")->AsNumber(), 600.0);
+}
+
+TEST(RenderCapture, FramesCarryMeshletCullingCounts)
+{
+    RenderCapture capture;
+    capture.Start(0);
+    const RenderCapture::FrameRecord record = MakeRecord(2);
+    capture.Append(record.Timing, record.Stats);
+
+    const std::optional<JsonValue> parsed = JsonParse(capture.SerializeJson({}));
+    ASSERT_TRUE(parsed.has_value());
+    const JsonValue& frame = parsed->Find("frames")->AsArray().front();
+
+    ASSERT_NE(frame.Find("meshlets_tested_count"), nullptr);
+    EXPECT_EQ(frame.Find("meshlets_tested_count")->AsNumber(), 80.0);
+    ASSERT_NE(frame.Find("meshlets_culled_count"), nullptr);
+    EXPECT_EQ(frame.Find("meshlets_culled_count")->AsNumber(), 50.0);
+    ASSERT_NE(frame.Find("shadow_meshlets_culled_count"), nullptr);
+}
+
+TEST(RenderCapture, FramesCarryTextureResidencyAgainstItsDemand)
+{
+    RenderCapture capture;
+    capture.Start(0);
+    const RenderCapture::FrameRecord record = MakeRecord(2);
+    capture.Append(record.Timing, record.Stats);
+
+    const std::optional<JsonValue> parsed = JsonParse(capture.SerializeJson({}));
+    ASSERT_TRUE(parsed.has_value());
+    const JsonValue& frame = parsed->Find("frames")->AsArray().front();
+
+    ASSERT_NE(frame.Find("texture_resident_bytes"), nullptr);
+    EXPECT_EQ(frame.Find("texture_resident_bytes")->AsNumber(), 8192.0);
+    ASSERT_NE(frame.Find("texture_mips_requested_count"), nullptr);
+    EXPECT_EQ(frame.Find("texture_mips_requested_count")->AsNumber(), 24.0);
+    ASSERT_NE(frame.Find("texture_mips_resident_count"), nullptr);
+    EXPECT_EQ(frame.Find("texture_mips_resident_count")->AsNumber(), 16.0);
+    // Latency is carried in microseconds and serialized in milliseconds.
+    ASSERT_NE(frame.Find("texture_stream_latency_ms"), nullptr);
+    EXPECT_NEAR(frame.Find("texture_stream_latency_ms")->AsNumber(), 5.0, 1.0e-9);
+}
+
 TEST(RenderCapture, CsvHasOneHeaderAndOneRowPerFrame)
 {
     RenderCapture capture;
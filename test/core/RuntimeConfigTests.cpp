@@ -33,6 +33,7 @@ TEST(RuntimeConfig, EmptyObjectYieldsDefaults)
     EXPECT_DOUBLE_EQ(config->MaxFrameWallDeltaSeconds, 0.25);
     EXPECT_EQ(config->JobWorkerCount, -1);
     EXPECT_EQ(config->AsyncTaskThreadCount, 1);
+    EXPECT_EQ(config->AsyncIoThreadCount, 1);
     EXPECT_FALSE(config->ExitOnEscape);
     EXPECT_FALSE(config->TogglePauseOnF1);
 }
@@ -73,13 +74,15 @@ TEST(RuntimeConfig, ReadsCamelCaseFields)
         "fixedTickRate": 120.0,
         "asyncCommitBudgetMs": 0.0,
         "jobWorkerCount": 4,
-        "asyncTaskThreadCount": 3
+        "asyncTaskThreadCount": 3,
+        "asyncIoThreadCount": 0
     })");
     ASSERT_TRUE(config.has_value());
     EXPECT_DOUBLE_EQ(config->FixedTickRate, 120.0);
     EXPECT_DOUBLE_EQ(config->AsyncCommitBudgetMs, 0.0);
     EXPECT_EQ(config->JobWorkerCount, 4);
     EXPECT_EQ(config->AsyncTaskThreadCount, 3);
+    EXPECT_EQ(config->AsyncIoThreadCount, 0);
 }
 
 TEST(RuntimeConfig, ReadsSnakeCaseFields)
@@ -87,11 +90,13 @@ TEST(RuntimeConfig, ReadsSnakeCaseFields)
     auto config = Parse(R"({
         "job_worker_count": 0,
         "async_task_thread_count": 2,
+        "async_io_thread_count": 2,
         "async_commit_budget_ms": 5.5
     })");
     ASSERT_TRUE(config.has_value());
     EXPECT_EQ(config->JobWorkerCount, 0);
     EXPECT_EQ(config->AsyncTaskThreadCount, 2);
+    EXPECT_EQ(config->AsyncIoThreadCount, 2);
     EXPECT_DOUBLE_EQ(config->AsyncCommitBudgetMs, 5.5);
 }
 
@@ -141,6 +146,15 @@ TEST(RuntimeConfig, RejectsZeroAsyncTaskThreads)
     EXPECT_NE(error.Message.find("asyncTaskThreadCount"), std::string::npos);
 }
 
+TEST(RuntimeConfig, RejectsNegativeAsyncIoThreads)
+{
+    // Zero is allowed (reads share the task threads); negative is not.
+    RuntimeConfigError error;
+    EXPECT_TRUE(Parse(R"({"asyncIoThreadCount": 0})").has_value());
+    EXPECT_FALSE(Parse(R"({"asyncIoThreadCount": -1})", &error).has_value());
+    EXPECT_NE(error.Message.find("asyncIoThreadCount"), std::string::npos);
+}
+
 TEST(RuntimeConfig, RejectsWrongFieldTypes)
 {
     EXPECT_FALSE(Parse(R"({"fixedTickRate": "fast"})").has_value());
@@ -203,3 +217,18 @@ TEST(RuntimeConfig, StreamingPreloadFieldsParseAndValidate)
     EXPECT_FALSE(Parse(R"({"streaming_radius": -1.0})", &error).has_value());
     EXPECT_NE(error.Message.find("streamingRadius"), std::string::npos);
 }
+
+TEST(RuntimeConfig, StreamingPredictSecondsParsesAndValidates)
+{
+    const auto defaults = Parse(R"({})");
+    ASSERT_TRUE(defaults.has_value());
+    EXPECT_DOUBLE_EQ(defaults->StreamingPredictSeconds, 0.0);
+
+    const auto parsed = Parse(R"({"streaming_predict_seconds": 1.5})");
+    ASSERT_TRUE(parsed.has_value());
+    EXPECT_DOUBLE_EQ(parsed->StreamingPredictSeconds, 1.5);
+
+    RuntimeConfigError error;
+    EXPECT_FALSE(Parse(R"({"streamingPredictSeconds": -0.5})", &error).has_value());
+    EXPECT_NE(error.Message.find("streamingPredictSeconds"), std::string::npos);
+}
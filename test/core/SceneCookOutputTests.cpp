@@ -2,8 +2,8 @@
 
 #include <core/assets/AssetIdMap.h>
 #include <core/assets/AssetManifest.h>
-#include <core/json/JsonParser.h>
 #include <core/json/JsonValue.h>
+#include <world/serialization/SceneSerializer.h>
 
 #include <gtest/gtest.h>
 
@@ -12,6 +12,7 @@
 #include <filesystem>
 #include <fstream>
 #include <functional>
+#include <optional>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -31,6 +32,7 @@ namespace
                    + "_" + std::to_string(reinterpret_cast<std::uintptr_t>(this)));
             fs::remove_all(Root);
             fs::create_directories(Root);
+            RegisterEngineSceneSerializers(Serializers);
         }
 
         void TearDown() override
@@ -57,23 +59,21 @@ namespace
             return [this](std::string_view p) { return Physical(p); };
         }
 
-        [[nodiscard]] JsonValue ReadJson(const fs::path& p) const
-        {
-            std::ifstream f(p);
-            std::ostringstream buf;
-            buf << f.rdbuf();
-            return *JsonParse(buf.str());
-        }
-
         fs::path Root;
+        ComponentSerializerRegistry Serializers;
     };
 
-    // Minimal cooked scene referencing one mesh and one material.
+    // Minimal cooked scene referencing one mesh and one material. The cook
+    // encodes it as binary, so the StaticMesh carries every field without a
+    // default.
     JsonValue SceneWith(const std::string& mesh, const std::string& material)
     {
         JsonValue::Object staticMesh{
             { "mesh", JsonValue(mesh) },
             { "materials", JsonValue(JsonValue::Array{ JsonValue(material) }) },
+            { "visible", JsonValue(true) },
+            { "layer_mask", JsonValue(4294967295.0) },
+            { "section_mask", JsonValue(4294967295.0) },
         };
         JsonValue::Object components{ { "StaticMesh", JsonValue(std::move(staticMesh)) } };
         JsonValue::Object entity{ { "components", JsonValue(std::move(components)) } };
@@ -98,8 +98,8 @@ TEST_F(SceneCookOutputTest, ManifestCoversSceneRefsSmatIndirectionAndExtraRefs)
     const std::vector<std::string> extraRefs = { "asset://materials/brick.smat" };
 
     std::string error;
-    ASSERT_TRUE(WriteCookedScene(scene, extraRefs, Resolver(),
-        Root / "asset_ids.json", Root / "scene.manifest.json", Root / "scene.cooked.json",
+    ASSERT_TRUE(WriteCookedScene(scene, Serializers, extraRefs, Resolver(),
+        Root / "asset_ids.json", Root / "scene.manifest.json", Root / "scene.cooked.sscn",
         &error)) << error;
 
     AssetManifest manifest;
@@ -127,21 +127,34 @@ TEST_F(SceneCookOutputTest, CookedSceneStampsKnownRefs)
 
     const JsonValue scene = SceneWith("asset://meshes/cell.smesh", "asset://materials/gray.smat");
     std::string error;
-    ASSERT_TRUE(WriteCookedScene(scene, {}, Resolver(),
-        Root / "asset_ids.json", Root / "scene.manifest.json", Root / "scene.cooked.json",
+    ASSERT_TRUE(WriteCookedScene(scene, Serializers, {}, Resolver(),
+        Root / "asset_ids.json", Root / "scene.manifest.json", Root / "scene.cooked.sscn",
         &error)) << error;
 
-    const JsonValue cooked = ReadJson(Root / "scene.cooked.json");
-    const JsonValue& staticMesh =
-        cooked.AsObject().at(1).second  // "entities"
-            .AsArray().at(0)
-            .AsObject().at(0).second     // "components"
-            .AsObject().at(0).second;    // "StaticMesh"
-
-    // The mesh ref is stamped from a bare string to {"id","path"}.
-    const JsonValue& mesh = staticMesh.AsObject().at(0).second; // "mesh"
-    ASSERT_TRUE(mesh.IsObject());
-    EXPECT_TRUE(mesh.AsObject().at(0).first == "id" || mesh.AsObject().at(1).first == "id");
+    // The scene on disk is binary; reading it back yields the JSON it encodes.
+    std::ifstream file(Root / "scene.cooked.sscn", std::ios::binary);
+    EXPECT_NE(file.get(), '{');
+
+    std::string readError;
+    const std::optional<JsonValue> cooked =
+        ReadCookedSceneJson(Root / "scene.cooked.sscn", Serializers, &readError);
+    ASSERT_TRUE(cooked.has_value()) << readError;
+    const JsonValue* entities = cooked->Find("entities");
+    ASSERT_NE(entities, nullptr);
+    ASSERT_EQ(entities->AsArray().size(), 1u);
+    const JsonValue* components = entities->AsArray().at(0).Find("components");
+    ASSERT_NE(components, nullptr);
+    const JsonValue* staticMesh = components->Find("StaticMesh");
+    ASSERT_NE(staticMesh, nullptr);
+
+    // The mesh ref is stamped from a bare string to {"id","path"} and keeps
+    // the stamp through the binary scene's asset table.
+    const JsonValue* mesh = staticMesh->Find("mesh");
+    ASSERT_NE(mesh, nullptr);
+    ASSERT_TRUE(mesh->IsObject());
+    ASSERT_NE(mesh->Find("id"), nullptr);
+    ASSERT_NE(mesh->Find("path"), nullptr);
+    EXPECT_EQ(mesh->Find("path")->AsString(), "asset://meshes/cell.smesh");
 }
 
 TEST_F(SceneCookOutputTest, IdsAreStableAcrossRecook)
@@ -152,8 +165,8 @@ TEST_F(SceneCookOutputTest, IdsAreStableAcrossRecook)
 
     const auto cook = [&] {
         std::string error;
-        return WriteCookedScene(scene, {}, Resolver(),
-            Root / "asset_ids.json", Root / "scene.manifest.json", Root / "scene.cooked.json",
+        return WriteCookedScene(scene, Serializers, {}, Resolver(),
+            Root / "asset_ids.json", Root / "scene.manifest.json", Root / "scene.cooked.sscn",
             &error);
     };
 
@@ -169,3 +182,21 @@ TEST_F(SceneCookOutputTest, IdsAreStableAcrossRecook)
               second.FindId("asset://meshes/cell.smesh"));
     EXPECT_TRUE(first.FindId("asset://meshes/cell.smesh").IsValid());
 }
+
+TEST_F(SceneCookOutputTest, ComponentWithoutSerializerFailsTheCook)
+{
+    WriteFile("asset://meshes/cell.smesh", "smesh-bytes");
+    WriteFile("asset://materials/gray.smat", R"({})");
+
+    // The binary form has nowhere to put a component it cannot encode; the cook
+    // reports it instead of writing a scene that silently lost it.
+    JsonValue scene = SceneWith("asset://meshes/cell.smesh", "asset://materials/gray.smat");
+    scene.Find("entities")->AsArray().at(0).Find("components")->AsObject().emplace_back(
+        "NotAComponent", JsonValue(JsonValue::Object{}));
+
+    std::string error;
+    EXPECT_FALSE(WriteCookedScene(scene, Serializers, {}, Resolver(),
+        Root / "asset_ids.json", Root / "scene.manifest.json", Root / "scene.cooked.sscn",
+        &error));
+    EXPECT_NE(error.find("NotAComponent"), std::string::npos) << error;
+}
@@ -2,6 +2,8 @@
 
 #include <array>
 #include <cstdint>
+#include <cstring>
+#include <span>
 #include <sstream>
 #include <string>
 #include <string_view>
@@ -15,6 +17,8 @@
 #include <core/json/JsonValue.h>
 #include <core/serialization/BinaryReader.h>
 #include <core/serialization/BinaryWriter.h>
+#include <core/serialization/GrowableWriter.h>
+#include <core/serialization/SpanReader.h>
 #include <core/serialization/Serialize.h>
 #include <core/serialization/BinaryFormat.h>
 #include <math/MathSchemas.h>
@@ -654,6 +658,110 @@ TEST(SerializationTests, ChunkReaderSkipsUnknownChunk)
     EXPECT_FLOAT_EQ(readValue, value);
 }
 
+//=============================================================================
+// Phase 3b â€” Memory sources: SpanReader / GrowableWriter
+//=============================================================================
+
+TEST(SerializationTests, MemoryWriterAndReaderRoundTripRecord)
+{
+    GrowableWriter memory;
+    BinaryWriter writer(memory);
+
+    const PlayerRecord record{ .Health = 99, .X = 10.5f, .Y = -2.25f };
+    ASSERT_TRUE(Serialize(writer, record));
+    ASSERT_TRUE(Serialize(writer, std::string("memory")));
+
+    const std::vector<std::byte> bytes = memory.Take();
+    EXPECT_TRUE(memory.Empty());
+
+    SpanReader span(bytes);
+    BinaryReader reader(span);
+    PlayerRecord readRecord{};
+    std::string readText;
+    ASSERT_TRUE(Deserialize(reader, readRecord));
+    ASSERT_TRUE(Deserialize(reader, readText));
+    EXPECT_EQ(readRecord.Health, record.Health);
+    EXPECT_FLOAT_EQ(readRecord.X, record.X);
+    EXPECT_FLOAT_EQ(readRecord.Y, record.Y);
+    EXPECT_EQ(readText, "memory");
+    EXPECT_TRUE(reader.AtEnd());
+}
+
+TEST(SerializationTests, MemoryReaderFailsOnTruncatedInput)
+{
+    const std::array<std::byte, 3> bytes{};
+    SpanReader span(bytes);
+    BinaryReader reader(span);
+
+    std::uint32_t value = 0;
+    EXPECT_FALSE(reader.Read(value));
+    EXPECT_FALSE(span.Ok());
+    EXPECT_EQ(span.Position(), 0u);
+}
+
+TEST(SerializationTests, ReadArrayCopiesAndRejectsOversizedCount)
+{
+    GrowableWriter memory;
+    const std::vector<std::uint32_t> values{ 1, 2, 3, 4, 5 };
+    memory.WriteArray(std::span<const std::uint32_t>(values));
+
+    SpanReader span(memory.Bytes());
+    std::vector<std::uint32_t> tooMany;
+    EXPECT_FALSE(span.ReadArray(tooMany, values.size() + 1));
+    EXPECT_TRUE(tooMany.empty());
+
+    SpanReader fresh(memory.Bytes());
+    BinaryReader reader(fresh);
+    std::vector<std::uint32_t> readValues;
+    ASSERT_TRUE(reader.ReadArray(readValues, values.size()));
+    EXPECT_EQ(readValues, values);
+}
+
+TEST(SerializationTests, MemoryMatchesStreamBytes)
+{
+    auto stream = MakeBinaryStream();
+    BinaryWriter streamWriter(stream);
+    GrowableWriter memory;
+    BinaryWriter memoryWriter(memory);
+
+    for (BinaryWriter* writer : { &streamWriter, &memoryWriter })
+    {
+        ChunkWriter chunk;
+        ASSERT_TRUE(chunk.Begin(*writer, 5, 2));
+        ASSERT_TRUE(Serialize(*writer, std::string("chunk payload")));
+        ASSERT_TRUE(chunk.End(*writer));
+    }
+
+    const std::string streamBytes = stream.str();
+    ASSERT_EQ(streamBytes.size(), memory.Size());
+    EXPECT_EQ(std::memcmp(streamBytes.data(), memory.Bytes().data(), memory.Size()), 0);
+}
+
+TEST(SerializationTests, MemoryChunkReaderSkipsAndRejectsOversizedChunk)
+{
+    GrowableWriter memory;
+    BinaryWriter writer(memory);
+
+    ChunkWriter unknownChunk;
+    ASSERT_TRUE(unknownChunk.Begin(writer, 99, 1));
+    ASSERT_TRUE(writer.Write(std::uint64_t{ 0xDEADBEEF }));
+    ASSERT_TRUE(unknownChunk.End(writer));
+    ASSERT_TRUE(WriteChunkHeader(writer, ChunkHeader{ 1, 1, 64 }));
+    ASSERT_TRUE(writer.Write(42.5f));
+
+    SpanReader span(memory.Bytes());
+    BinaryReader reader(span);
+
+    ChunkReader firstChunk;
+    ASSERT_TRUE(firstChunk.ReadHeader(reader));
+    EXPECT_EQ(firstChunk.GetHeader().Size, sizeof(std::uint64_t));
+    ASSERT_TRUE(firstChunk.Skip(reader));
+
+    // The second header claims 64 payload bytes and only 4 follow.
+    ChunkReader secondChunk;
+    EXPECT_FALSE(secondChunk.ReadHeader(reader));
+}
+
 //=============================================================================
 // Phase 4 â€” Identity types round-trip
 //=============================================================================
@@ -10,6 +10,7 @@
 
 #ifdef SENCHA_ENABLE_COOK
 #include <assets/cook/ImportOnDemand.h>
+#include <assets/cook/TextureBlockCache.h>
 #include <assets/cook/TextureCook.h>
 #include <assets/cook/TextureImportSettings.h>
 #include <core/assets/AssetRegistry.h>
@@ -18,6 +19,9 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <cstdint>
 #include <filesystem>
 #include <fstream>
@@ -87,6 +91,30 @@ namespace
             }
         return image;
     }
+
+    Image MakeNoiseImage(uint32_t width, uint32_t height, uint32_t seed)
+    {
+        Image image = MakeImage(width, height);
+        std::mt19937 rng(seed);
+        for (uint8_t& byte : image.Pixels)
+            byte = static_cast<uint8_t>(rng());
+        return image;
+    }
+
+    // Peak-to-peak of channel 0 along row 0 of `level`.
+    int RowContrast(const TextureData& texture, uint32_t level)
+    {
+        const TextureMipLevel& mip = texture.Mips[level];
+        const uint8_t* row = texture.Blob.data() + mip.Offset;
+        int lo = 255;
+        int hi = 0;
+        for (uint32_t x = 0; x < mip.Width; ++x)
+        {
+            lo = std::min<int>(lo, row[x * 4]);
+            hi = std::max<int>(hi, row[x * 4]);
+        }
+        return hi - lo;
+    }
 #endif
 } // namespace
 
@@ -349,6 +377,204 @@ TEST(TextureCook, Bc7BlocksDecodeBackToTheSourceColor)
     }
 }
 
+TEST(TextureCook, KaiserMipsKeepDetailTheBoxBlurs)
+{
+    // Vertical bars with an 8-texel period, phased so mip 1's texels land
+    // on the crests. Halving to a 4-texel period is well inside what a mip
+    // can hold: the Kaiser kernel passes it almost untouched, the 2x2 box
+    // flattens it by ~8%.
+    Image bars = MakeImage(64, 64, PixelFormat::RGBA8);
+    for (uint32_t y = 0; y < 64; ++y)
+        for (uint32_t x = 0; x < 64; ++x)
+        {
+            uint8_t* p = bars.Pixels.data() + (uint64_t(y) * 64 + x) * 4;
+            p[0] = p[1] = p[2] = static_cast<uint8_t>(
+                127.5f + 100.0f * std::cos(2.0f * 3.14159265f * (static_cast<float>(x) - 0.5f) / 8.0f));
+        }
+
+    TextureData box;
+    TextureData kaiser;
+    ASSERT_TRUE(BuildTextureMipChainRgba8(bars, TextureUsage::LinearData, box));
+    ASSERT_TRUE(BuildTextureMipChainRgba8(bars, TextureUsage::LinearData, kaiser, nullptr, nullptr,
+                                          TextureMipKernel::Kaiser));
+    ASSERT_EQ(kaiser.Mips.size(), box.Mips.size());
+    EXPECT_GT(RowContrast(kaiser, 1), RowContrast(box, 1) + 10);
+    EXPECT_GE(RowContrast(kaiser, 1), 190);
+}
+
+TEST(TextureCook, KaiserMipsKeepFlatColorsAndNormalsExact)
+{
+    Image flat = MakeImage(24, 12, PixelFormat::RGBA8);
+    for (uint32_t i = 0; i < 24 * 12; ++i)
+    {
+        uint8_t* p = flat.Pixels.data() + i * 4;
+        p[0] = 200; p[1] = 90; p[2] = 30; p[3] = 128;
+    }
+    for (const TextureUsage usage : { TextureUsage::BaseColor, TextureUsage::LinearData })
+    {
+        TextureData cooked;
+        ASSERT_TRUE(BuildTextureMipChainRgba8(flat, usage, cooked, nullptr, nullptr,
+                                              TextureMipKernel::Kaiser));
+        for (const TextureMipLevel& mip : cooked.Mips)
+        {
+            const uint8_t* p = cooked.Blob.data() + mip.Offset;
+            EXPECT_NEAR(p[0], 200, 1);
+            EXPECT_NEAR(p[1], 90, 1);
+            EXPECT_NEAR(p[2], 30, 1);
+            EXPECT_NEAR(p[3], 128, 1);
+        }
+    }
+
+    // Normal maps renormalize under the Kaiser kernel as under the box.
+    // Checked away from the edges, where the clamp skews the kernel.
+    Image normals = MakeImage(32, 32, PixelFormat::RGBA8);
+    for (uint32_t i = 0; i < 32 * 32; ++i)
+    {
+        uint8_t* p = normals.Pixels.data() + i * 4;
+        p[0] = (i % 2 == 0) ? 218 : 37;
+        p[1] = 128;
+        p[2] = 218;
+    }
+    TextureData cooked;
+    ASSERT_TRUE(BuildTextureMipChainRgba8(normals, TextureUsage::Normal, cooked, nullptr, nullptr,
+                                          TextureMipKernel::Kaiser));
+    const uint8_t* centre = cooked.Blob.data() + cooked.Mips[1].Offset + (8 * 16 + 8) * 4;
+    EXPECT_NEAR(centre[0], 128, 2);
+    EXPECT_GE(centre[2], 250);
+}
+
+TEST(TextureCook, BatchMatchesCookingEachImageAlone)
+{
+    const Image images[] = { MakeNoiseImage(64, 48, 1), MakeNoiseImage(16, 16, 2),
+                             MakeNoiseImage(5, 3, 3) };
+    const TextureCookParams params[] = {
+        { .Usage = TextureUsage::BaseColor, .MipKernel = TextureMipKernel::Kaiser },
+        { .Usage = TextureUsage::Normal },
+        { .Usage = TextureUsage::Orm, .Compress = false },
+    };
+
+    std::vector<TextureCookBatchEntry> batch;
+    for (uint32_t i = 0; i < 3; ++i)
+        batch.push_back({ .Source = &images[i], .Params = params[i] });
+    batch.push_back({ .Source = nullptr });
+
+    JobSystem pool(3);
+    TextureCookStats stats;
+    EXPECT_FALSE(CookTexturesBatch(batch, &pool, nullptr, &stats));
+    EXPECT_FALSE(batch[3].Error.empty());
+
+    uint64_t pixels = 0;
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        ASSERT_TRUE(batch[i].Error.empty()) << batch[i].Error;
+        TextureData alone;
+        ASSERT_TRUE(CookImageToTexture(images[i], params[i], alone));
+        EXPECT_EQ(batch[i].Result.Format, alone.Format);
+        EXPECT_EQ(batch[i].Result.Mips.size(), alone.Mips.size());
+        EXPECT_EQ(batch[i].Result.Blob, alone.Blob);
+        for (const TextureMipLevel& mip : alone.Mips)
+            pixels += uint64_t(mip.Width) * mip.Height;
+    }
+    EXPECT_EQ(stats.Textures, 3u);
+    EXPECT_EQ(stats.Pixels, pixels);
+    // Blocks of the two compressed chains: 16x12 + 8x6 + 4x3 + 2x2 + 1 + 1 + 1,
+    // and 4x4 + 2x2 + 1 + 1 + 1.
+    EXPECT_EQ(stats.BlocksEncoded, 192u + 48u + 12u + 4u + 3u + 16u + 4u + 3u);
+    EXPECT_EQ(stats.BlocksFromCache, 0u);
+    EXPECT_GT(stats.MegapixelsPerSecond(), 0.0);
+}
+
+TEST(TextureCook, BlockCacheSkipsBlocksAnEditDidNotTouch)
+{
+    Image image = MakeNoiseImage(64, 64, 7);
+    const TextureCookParams params{ .Usage = TextureUsage::Orm };
+    TextureBlockCache cache;
+
+    TextureCookBatchEntry first{ .Source = &image, .Params = params };
+    TextureCookStats cold;
+    ASSERT_TRUE(CookTexturesBatch(std::span(&first, 1), nullptr, &cache, &cold));
+    // 16x16 + 8x8 + 4x4 + 2x2 + 1 + 1 + 1 blocks, every one new.
+    EXPECT_EQ(cold.BlocksEncoded, 343u);
+    EXPECT_EQ(cold.BlocksFromCache, 0u);
+
+    TextureCookBatchEntry again{ .Source = &image, .Params = params };
+    TextureCookStats warm;
+    ASSERT_TRUE(CookTexturesBatch(std::span(&again, 1), nullptr, &cache, &warm));
+    EXPECT_EQ(warm.BlocksEncoded, 0u);
+    EXPECT_EQ(warm.BlocksFromCache, 343u);
+    EXPECT_EQ(again.Result.Blob, first.Result.Blob);
+
+    // One texel edited: one block per level is new; the output is exactly
+    // what an uncached cook of the edited image produces.
+    image.Pixels[0] ^= 0x80;
+    TextureCookBatchEntry edited{ .Source = &image, .Params = params };
+    TextureCookStats editStats;
+    ASSERT_TRUE(CookTexturesBatch(std::span(&edited, 1), nullptr, &cache, &editStats));
+    EXPECT_LE(editStats.BlocksEncoded, 7u);
+    EXPECT_GE(editStats.BlocksFromCache, 336u);
+    TextureData uncached;
+    ASSERT_TRUE(CookImageToTexture(image, params, uncached));
+    EXPECT_EQ(edited.Result.Blob, uncached.Blob);
+
+    // BC5 encodes about as fast as it hashes: it never consults the cache.
+    const std::size_t cached = cache.Size();
+    TextureCookBatchEntry normal{ .Source = &image, .Params = { .Usage = TextureUsage::Normal } };
+    TextureCookStats normalStats;
+    ASSERT_TRUE(CookTexturesBatch(std::span(&normal, 1), nullptr, &cache, &normalStats));
+    EXPECT_EQ(normalStats.BlocksFromCache, 0u);
+    EXPECT_EQ(cache.Size(), cached);
+}
+
+TEST(TextureBlockCache, PersistsNewestEntriesUnderItsBound)
+{
+    const auto block = [](uint8_t fill)
+    {
+        std::array<uint8_t, TextureBlockCache::kBlockBytes> bytes{};
+        bytes.fill(fill);
+        return bytes;
+    };
+
+    TextureBlockCache cache(4);
+    for (uint8_t key = 1; key <= 6; ++key)
+        cache.Insert(key, block(key));
+    EXPECT_EQ(cache.Size(), 4u);
+    EXPECT_TRUE(cache.IsDirty());
+
+    std::array<uint8_t, TextureBlockCache::kBlockBytes> out{};
+    EXPECT_FALSE(cache.Find(1, out));
+    EXPECT_FALSE(cache.Find(2, out));
+    ASSERT_TRUE(cache.Find(3, out));
+    EXPECT_EQ(out, block(3));
+
+    const std::filesystem::path path =
+        std::filesystem::temp_directory_path() / "sencha_texture_block_cache_test.cache";
+    std::string error;
+    ASSERT_TRUE(cache.SaveToFile(path, &error)) << error;
+    EXPECT_FALSE(cache.IsDirty());
+
+    // A smaller cache keeps the newest of what was saved.
+    TextureBlockCache smaller(3);
+    ASSERT_TRUE(smaller.LoadFromFile(path, &error)) << error;
+    EXPECT_EQ(smaller.Size(), 3u);
+    EXPECT_FALSE(smaller.Find(3, out));
+    ASSERT_TRUE(smaller.Find(6, out));
+    EXPECT_EQ(out, block(6));
+
+    // Overwritten with garbage: an error, and an empty cache.
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file << "not a block cache";
+    }
+    EXPECT_FALSE(smaller.LoadFromFile(path, &error));
+    EXPECT_EQ(smaller.Size(), 0u);
+
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+    TextureBlockCache missing;
+    EXPECT_TRUE(missing.LoadFromFile(path, &error));
+    EXPECT_EQ(missing.Size(), 0u);
+}
+
 #endif // SENCHA_ENABLE_COOK
 
 // -- TextureAssetLoader sniffing ------------------------------------------------------
@@ -433,6 +659,41 @@ TEST(TextureAssetLoaderStex, CorruptStexFailsStagingWithError)
     EXPECT_NE(staging.Error.find("stex"), std::string::npos);
 }
 
+TEST(TextureAssetLoaderStex, StagedPixelsBorrowTheReadView)
+{
+    LoggingProvider logging;
+    TextureAssetLoader loader(logging, nullptr);
+
+    const TextureData fixture = MakeBlockCompressedFixture(TexturePixelFormat::BC7, 16);
+    std::vector<std::byte> bytes;
+    ASSERT_TRUE(WriteStexToBytes(fixture, bytes));
+
+    MemoryAssetSource source;
+    source.Add("asset://textures/dev/borrowed.stex", std::move(bytes));
+
+    AssetStaging staging = loader.LoadStaged(
+        MakeTextureRecord("asset://textures/dev/borrowed.stex"), source);
+    ASSERT_TRUE(staging.IsValid()) << staging.Error;
+
+    // No owned copy of the mip chain: the payload points into the bytes the
+    // source produced and keeps them alive itself.
+    const auto* texture = std::any_cast<TextureData>(&staging.Payload);
+    ASSERT_NE(texture, nullptr);
+    EXPECT_TRUE(texture->Blob.empty());
+    EXPECT_NE(texture->BlobOwner, nullptr);
+    ASSERT_EQ(texture->Pixels().size(), fixture.Blob.size());
+    EXPECT_TRUE(std::equal(texture->Pixels().begin(), texture->Pixels().end(),
+                           fixture.Blob.begin()));
+    EXPECT_TRUE(ValidateTextureData(*texture));
+
+    // The copying read still produces an owned blob, byte for byte the same.
+    std::vector<std::byte> again;
+    ASSERT_TRUE(WriteStexToBytes(*texture, again));
+    TextureData owned;
+    ASSERT_TRUE(LoadStexFromBytes(again, owned));
+    EXPECT_EQ(owned.Blob, fixture.Blob);
+}
+
 #ifdef SENCHA_ENABLE_COOK
 
 // -- PNG -> .stex, end to end through import-on-demand --------------------------------
@@ -578,12 +839,14 @@ TEST(TextureImportSettings, ParsesEveryField)
     TextureImportSettings settings;
     std::string error;
     ASSERT_TRUE(ParseTextureImportSettings(AsBytes(
-        R"({"version": 1, "usage": "normal", "filter": "nearest", "compress": false, "mips": false})"),
+        R"({"version": 1, "usage": "normal", "filter": "nearest", "compress": false, "mips": false,
+            "mip_filter": "kaiser"})"),
         settings, &error)) << error;
     EXPECT_EQ(settings.Usage, TextureUsage::Normal);
     EXPECT_EQ(settings.Filter, TextureFilter::Nearest);
     EXPECT_FALSE(settings.Compress);
     EXPECT_FALSE(settings.GenerateMips);
+    EXPECT_EQ(settings.MipKernel, TextureMipKernel::Kaiser);
 }
 
 TEST(TextureImportSettings, RejectsTyposInsteadOfDefaulting)
@@ -603,6 +866,7 @@ TEST(TextureImportSettings, SaveFileRoundTrips)
     settings.Filter = TextureFilter::Nearest;
     settings.Compress = false;
     settings.GenerateMips = false;
+    settings.MipKernel = TextureMipKernel::Kaiser;
 
     const std::filesystem::path path =
         std::filesystem::temp_directory_path() / "sencha_import_settings_roundtrip.meta";
@@ -304,3 +304,82 @@ TEST_F(WorldStoragePartitionTest, DestroyPartitionOnlyDestroysOwnedEntities)
     EXPECT_EQ(World_.GetEntityPartition(secondA), second);
     EXPECT_EQ(gPartitionRemoveCount, 2);
 }
+
+TEST_F(WorldStoragePartitionTest, DetachPartitionMovesSlabsOutWithTheirValues)
+{
+    const StoragePartitionId first{ 1 };
+    const StoragePartitionId second{ 2 };
+
+    const EntityId firstA = World_.CreateEntity(first);
+    const EntityId firstB = World_.CreateEntity(first);
+    const EntityId secondA = World_.CreateEntity(second);
+    World_.AddComponent<PartitionTracked>(firstA, { 1 });
+    World_.AddComponent<PartitionTracked>(firstB, { 2 });
+    World_.AddComponent<PartitionPosition>(firstB, { 5.0f, 6.0f });
+    World_.AddComponent<PartitionTracked>(secondA, { 3 });
+    const uint64_t before = World_.StructuralVersion(first);
+    const size_t chunksBefore = World_.ChunkCount();
+
+    const DetachedPartition detached = World_.DetachPartition(first);
+
+    EXPECT_FALSE(World_.IsAlive(firstA));
+    EXPECT_FALSE(World_.IsAlive(firstB));
+    EXPECT_TRUE(World_.IsAlive(secondA));
+    EXPECT_EQ(World_.TryGet<PartitionTracked>(secondA)->Value, 3);
+    EXPECT_EQ(gPartitionRemoveCount, 2);
+    EXPECT_GT(World_.StructuralVersion(first), before);
+
+    // Every slot the partition gave up holds an empty slab, so no chunk index
+    // the World hands out has moved.
+    EXPECT_EQ(World_.ChunkCount(), chunksBefore);
+    EXPECT_EQ(detached.Partition, first);
+    EXPECT_EQ(detached.RowCount(), 2u);
+    EXPECT_EQ(detached.ChunkCount(), 2u);
+
+    const ComponentId tracked = World_.GetComponentId<PartitionTracked>();
+    const ComponentId position = World_.GetComponentId<PartitionPosition>();
+    int trackedSum = 0;
+    int positions = 0;
+    for (const DetachedArchetype& block : detached.Archetypes)
+    {
+        for (const auto& chunk : block.Chunks)
+        {
+            // Read through the block's own column layout, not the archetype's.
+            EXPECT_EQ(chunk->Columns, block.Columns.data());
+            const uint32_t col = chunk->FindColumn(tracked);
+            ASSERT_NE(col, UINT32_MAX);
+            for (const PartitionTracked& value : chunk->ColumnSpan<PartitionTracked>(col))
+                trackedSum += value.Value;
+            const uint32_t positionCol = chunk->FindColumn(position);
+            if (positionCol == UINT32_MAX)
+                continue;
+            for (const PartitionPosition& value : chunk->ColumnSpan<PartitionPosition>(positionCol))
+            {
+                EXPECT_EQ(value.X, 5.0f);
+                ++positions;
+            }
+        }
+    }
+    EXPECT_EQ(trackedSum, 3);
+    EXPECT_EQ(positions, 1);
+}
+
+TEST_F(WorldStoragePartitionTest, DetachedSlotsAreReusedByLaterRows)
+{
+    const StoragePartitionId zone{ 1 };
+    for (int i = 0; i < 4; ++i)
+        World_.AddComponent<PartitionTracked>(World_.CreateEntity(zone), { i });
+    const size_t chunks = World_.ChunkCount();
+
+    (void)World_.DetachPartition(zone);
+    EXPECT_EQ(World_.EmptyChunkCount(), chunks);
+
+    // A new zone in the same partition lands in a recycled slot rather than
+    // growing the chunk list, and a stale claim on the detached slab would
+    // have written into memory the World no longer owns.
+    const EntityId entity = World_.CreateEntity(zone);
+    World_.AddComponent<PartitionTracked>(entity, { 9 });
+    EXPECT_EQ(World_.ChunkCount(), chunks);
+    EXPECT_EQ(World_.TryGet<PartitionTracked>(entity)->Value, 9);
+    EXPECT_EQ(World_.GetEntityPartition(entity), zone);
+}
@@ -85,6 +85,29 @@ TEST(RenderQueueSort, RunsMergeIdenticalDrawsAndSplitOnEveryFieldChange)
     EXPECT_EQ(runs[2].Count, 1u);
 }
 
+TEST(RenderQueueSort, LodLevelsOfOneSectionAreSeparateRuns)
+{
+    // Each level draws its own index range, so instances of one section at
+    // different LODs cannot share a draw; the key keeps each level together.
+    RenderQueue queue;
+    for (uint32_t i = 0; i < 4; ++i)
+    {
+        RenderQueueItem item = Item(1, 2, 0, float(i));
+        item.Lod = i % 2;
+        queue.AddOpaque(item);
+    }
+    queue.SortOpaque();
+
+    const auto& runs = queue.OpaqueRuns();
+    ASSERT_EQ(runs.size(), 2u);
+    EXPECT_EQ(runs[0].Count, 2u);
+    EXPECT_EQ(runs[1].Count, 2u);
+    const auto& items = queue.Opaque();
+    const auto& order = queue.OpaqueOrder();
+    EXPECT_EQ(items[order[0]].Lod, 0u);
+    EXPECT_EQ(items[order[2]].Lod, 1u);
+}
+
 TEST(RenderQueueSort, SlotAliasedMeshesNeverMerge)
 {
     // Mesh slots 20 bits apart alias in the sort key's truncated mesh field;
@@ -2,8 +2,13 @@
 
 #include <jobs/AsyncTaskQueue.h>
 
+#include <atomic>
 #include <chrono>
 #include <memory>
+#include <mutex>
+#include <set>
+#include <stop_token>
+#include <string>
 #include <thread>
 #include <vector>
 
@@ -255,6 +260,317 @@ TEST(AsyncTaskQueueZeroThread, CommitMaySubmitFollowUpTasks)
     EXPECT_TRUE(followUpCommitted);
 }
 
+TEST(AsyncTaskQueueZeroThread, StagedTaskReadsDecodesThenCommits)
+{
+    AsyncTaskQueue queue(0);
+    std::vector<std::string> order;
+
+    auto handle = queue.SubmitStaged<int, std::string>(
+        [&] { order.push_back("read"); return 21; },
+        [&](int bytes) { order.push_back("decode"); return std::to_string(bytes * 2); },
+        [&](std::string payload) { order.push_back("commit " + payload); });
+
+    // One pump runs both stages: PumpWork counts tasks, not stages.
+    EXPECT_EQ(queue.PumpWork(1), 1u);
+    EXPECT_EQ(queue.GetState(handle), AsyncTaskState::AwaitingCommit);
+    EXPECT_EQ(queue.DrainCompletions(), 1u);
+    EXPECT_EQ(order, (std::vector<std::string>{ "read", "decode", "commit 42" }));
+}
+
+TEST(AsyncTaskQueueZeroThread, HigherPriorityRunsFirstOldestFirstAmongEquals)
+{
+    AsyncTaskQueue queue(0);
+    std::vector<int> ran;
+    const auto submit = [&](int id, AsyncTaskPriority priority)
+    {
+        queue.Submit<int>([&ran, id] { ran.push_back(id); return id; }, [](int) {},
+                          MakeAsyncTaskPriority(priority));
+    };
+
+    submit(1, AsyncTaskPriority::Low);
+    submit(2, AsyncTaskPriority::Normal);
+    submit(3, AsyncTaskPriority::High);
+    submit(4, AsyncTaskPriority::Normal);
+    queue.SubmitStaged<int, int>([&ran] { ran.push_back(5); return 5; },
+                                 [](int bytes) { return bytes; }, [](int) {},
+                                 MakeAsyncTaskPriority(AsyncTaskPriority::High));
+
+    EXPECT_EQ(queue.PumpWork(), 5u);
+    EXPECT_EQ(ran, (std::vector<int>{ 3, 5, 2, 4, 1 }));
+}
+
+TEST(AsyncTaskQueueZeroThread, PriorityCellReordersWaitingTasks)
+{
+    AsyncTaskQueue queue(0);
+    std::vector<int> ran;
+    const AsyncTaskPriorityCell speculative = MakeAsyncTaskPriority(AsyncTaskPriority::Low);
+
+    queue.Submit<int>([&ran] { ran.push_back(1); return 1; }, [](int) {});
+    queue.Submit<int>([&ran] { ran.push_back(2); return 2; }, [](int) {}, speculative);
+    queue.Submit<int>([&ran] { ran.push_back(3); return 3; }, [](int) {}, speculative);
+
+    EXPECT_EQ(queue.PumpWork(1), 1u);
+    speculative->store(AsyncTaskPriority::High);
+    EXPECT_EQ(queue.PumpWork(), 2u);
+    EXPECT_EQ(ran, (std::vector<int>{ 1, 2, 3 }));
+
+    // And the other way: promoted work overtakes what was ahead of it.
+    ran.clear();
+    const AsyncTaskPriorityCell later = MakeAsyncTaskPriority(AsyncTaskPriority::Low);
+    queue.Submit<int>([&ran] { ran.push_back(4); return 4; }, [](int) {});
+    queue.Submit<int>([&ran] { ran.push_back(5); return 5; }, [](int) {}, later);
+    later->store(AsyncTaskPriority::High);
+    EXPECT_EQ(queue.PumpWork(), 2u);
+    EXPECT_EQ(ran, (std::vector<int>{ 5, 4 }));
+}
+
+TEST(AsyncTaskQueueZeroThread, CancelBeforePumpSkipsBothStages)
+{
+    AsyncTaskQueue queue(0);
+    bool readRan = false;
+
+    auto handle = queue.SubmitStaged<int, int>([&] { readRan = true; return 0; },
+                                               [](int bytes) { return bytes; }, [](int) {});
+    EXPECT_TRUE(queue.Cancel(handle));
+    EXPECT_EQ(queue.PumpWork(), 0u);
+    EXPECT_FALSE(readRan);
+    EXPECT_EQ(queue.GetState(handle), AsyncTaskState::Cancelled);
+}
+
+TEST(AsyncTaskQueueZeroThread, EarlierDeadlineRunsFirstAmongEqualPriority)
+{
+    AsyncTaskQueue queue(0);
+    std::vector<int> ran;
+    const auto now = std::chrono::steady_clock::now();
+    const auto submit = [&](int id, AsyncTaskOptions options)
+    {
+        queue.Submit<int>([&ran, id] { ran.push_back(id); return id; }, [](int) {},
+                          std::move(options));
+    };
+
+    submit(1, {});
+    submit(2, { .Deadline = now + std::chrono::seconds(2) });
+    submit(3, { .Deadline = now + std::chrono::seconds(1) });
+    submit(4, { .Priority = MakeAsyncTaskPriority(AsyncTaskPriority::High) });
+    submit(5, { .Priority = MakeAsyncTaskPriority(AsyncTaskPriority::Low),
+                .Deadline = now });
+
+    EXPECT_EQ(queue.PumpWork(), 5u);
+    EXPECT_EQ(ran, (std::vector<int>{ 4, 3, 2, 1, 5 }));
+}
+
+TEST(AsyncTaskQueueZeroThread, SharedDeadlineMovesEveryTaskThatHoldsIt)
+{
+    AsyncTaskQueue queue(0);
+    std::vector<int> ran;
+    const auto now = std::chrono::steady_clock::now();
+    const AsyncTaskDeadlineCell shared = MakeAsyncTaskDeadline();
+    const auto submit = [&](int id, AsyncTaskOptions options)
+    {
+        queue.Submit<int>([&ran, id] { ran.push_back(id); return id; }, [](int) {},
+                          std::move(options));
+    };
+
+    submit(1, { .Deadline = now + std::chrono::seconds(1) });
+    submit(2, { .SharedDeadline = shared });
+    submit(3, { .SharedDeadline = shared });
+    shared->store(now);
+
+    EXPECT_EQ(queue.PumpWork(), 3u);
+    EXPECT_EQ(ran, (std::vector<int>{ 2, 3, 1 }));
+}
+
+TEST(AsyncTaskQueueZeroThread, ReadsSweepUpThroughReadOrderAndWrap)
+{
+    AsyncTaskQueue queue(0);
+    std::vector<int> ran;
+    const auto submit = [&](int id, uint64_t readOrder)
+    {
+        queue.SubmitStaged<int, int>([&ran, id] { ran.push_back(id); return id; },
+                                     [](int bytes) { return bytes; }, [](int) {},
+                                     AsyncTaskOptions{ .ReadOrder = readOrder });
+    };
+
+    submit(1, 300);
+    submit(2, 100);
+    submit(3, 200);
+    EXPECT_EQ(queue.PumpWork(1), 1u);
+    EXPECT_EQ(ran, (std::vector<int>{ 2 }));
+
+    // Past the cursor first, then around to what lies behind it, lowest
+    // first; an unplaced read counts as the lowest of all.
+    submit(4, 50);
+    submit(5, 0);
+    submit(6, 150);
+    EXPECT_EQ(queue.PumpWork(), 5u);
+    EXPECT_EQ(ran, (std::vector<int>{ 2, 6, 3, 1, 5, 4 }));
+}
+
+TEST(AsyncTaskQueueZeroThread, CancelDuringReadSkipsTheDecode)
+{
+    AsyncTaskQueue queue(0);
+    bool decoded = false;
+    bool committed = false;
+    AsyncTaskHandle handle;
+
+    handle = queue.SubmitStaged<int, int>(
+        [&] {
+            EXPECT_EQ(queue.GetState(handle), AsyncTaskState::Running);
+            EXPECT_TRUE(queue.Cancel(handle));
+            return 0;
+        },
+        [&](int bytes) { decoded = true; return bytes; },
+        [&](int) { committed = true; },
+        AsyncTaskOptions{ .Stop = std::stop_source{} });
+
+    EXPECT_EQ(queue.PumpWork(), 1u);
+    EXPECT_EQ(queue.DrainCompletions(), 0u);
+    EXPECT_FALSE(decoded);
+    EXPECT_FALSE(committed);
+    EXPECT_EQ(queue.GetState(handle), AsyncTaskState::Cancelled);
+}
+
+TEST(AsyncTaskQueueZeroThread, RunningTaskWithoutAStopSourceStillCannotCancel)
+{
+    AsyncTaskQueue queue(0);
+    bool committed = false;
+    AsyncTaskHandle handle;
+
+    handle = queue.Submit<int>(
+        [&] {
+            EXPECT_FALSE(queue.Cancel(handle));
+            return 0;
+        },
+        [&](int) { committed = true; });
+
+    EXPECT_EQ(queue.PumpWork(), 1u);
+    EXPECT_EQ(queue.DrainCompletions(), 1u);
+    EXPECT_TRUE(committed);
+}
+
+TEST(AsyncTaskQueueZeroThread, LatencySamplesNameEachFinishedTask)
+{
+    AsyncTaskQueue queue(0);
+    queue.Submit<int>([] { return 0; }, [](int) {}, AsyncTaskOptions{ .Label = "untraced" });
+    EXPECT_EQ(queue.PumpWork(), 1u);
+    EXPECT_TRUE(queue.TakeLatencySamples().empty());
+
+    queue.SetLatencyTracing(true);
+    queue.Submit<int>([] { return 0; }, [](int) {},
+                      AsyncTaskOptions{ .Priority = MakeAsyncTaskPriority(AsyncTaskPriority::High),
+                                        .Label = "focus" });
+    queue.SubmitStaged<int, int>([] { return 0; }, [](int bytes) { return bytes; }, [](int) {},
+                                 AsyncTaskOptions{ .Deadline = std::chrono::steady_clock::now(),
+                                                   .Label = "late" });
+    EXPECT_EQ(queue.PumpWork(), 2u);
+
+    const std::vector<AsyncTaskLatency> samples = queue.TakeLatencySamples();
+    ASSERT_EQ(samples.size(), 2u);
+    EXPECT_STREQ(samples[0].Label, "focus");
+    EXPECT_EQ(samples[0].Priority, AsyncTaskPriority::High);
+    EXPECT_FALSE(samples[0].MissedDeadline);
+    EXPECT_STREQ(samples[1].Label, "late");
+    EXPECT_TRUE(samples[1].MissedDeadline);
+    for (const AsyncTaskLatency& sample : samples)
+    {
+        EXPECT_GE(sample.Queued.count(), 0);
+        EXPECT_GE(sample.Service.count(), 0);
+        EXPECT_FALSE(sample.Cancelled);
+    }
+    EXPECT_TRUE(queue.TakeLatencySamples().empty());
+}
+
+TEST(AsyncTaskQueueZeroThread, OtherCommitsRunBetweenSlices)
+{
+    AsyncTaskQueue queue(0);
+    std::vector<int> order;
+    queue.Submit<int>([] { return 0; }, [&](int) { order.push_back(0); });
+    EXPECT_EQ(queue.PumpWork(), 1u);
+
+    int slices = 0;
+    auto sliced = queue.SubmitCommitSlices([&] {
+        order.push_back(10 + slices);
+        if (slices == 0)
+        {
+            queue.Submit<int>([] { return 0; }, [&](int) { order.push_back(1); });
+            EXPECT_EQ(queue.PumpWork(), 1u);
+        }
+        return ++slices == 3;
+    });
+    EXPECT_EQ(queue.GetState(sliced), AsyncTaskState::AwaitingCommit);
+
+    // One turn per drain: the sliced commit waits behind the commit already
+    // queued, and after each slice behind whatever completed meanwhile. Only
+    // its last slice is the one the drain counts.
+    const AsyncDrainBudget oneTurn{ .MaxTime = std::chrono::steady_clock::duration::zero() };
+    EXPECT_EQ(queue.DrainCompletions(oneTurn), 1u);
+    EXPECT_EQ(queue.DrainCompletions(oneTurn), 0u);
+    EXPECT_EQ(queue.DrainCompletions(oneTurn), 1u);
+    EXPECT_EQ(queue.DrainCompletions(oneTurn), 0u);
+    EXPECT_EQ(queue.GetState(sliced), AsyncTaskState::AwaitingCommit);
+    EXPECT_EQ(queue.DrainCompletions(oneTurn), 1u);
+    EXPECT_TRUE(queue.IsComplete(sliced));
+    EXPECT_EQ(order, (std::vector<int>{ 0, 10, 1, 11, 12 }));
+
+    // Without a time budget every slice runs in one drain.
+    int more = 0;
+    queue.SubmitCommitSlices([&] { return ++more == 3; });
+    EXPECT_EQ(queue.DrainCompletions(), 1u);
+    EXPECT_EQ(more, 3);
+}
+
+TEST(AsyncTaskQueueZeroThread, HigherPrioritySlicesGoAheadOfLowerOnes)
+{
+    AsyncTaskQueue queue(0);
+    std::vector<char> order;
+    AsyncTaskPriorityCell speculative = MakeAsyncTaskPriority(AsyncTaskPriority::Low);
+    AsyncTaskPriorityCell focus = MakeAsyncTaskPriority(AsyncTaskPriority::Normal);
+
+    int low = 0;
+    int high = 0;
+    queue.SubmitCommitSlices([&] {
+        order.push_back('l');
+        return ++low == 2;
+    }, AsyncTaskOptions{ .Priority = speculative });
+    queue.SubmitCommitSlices([&] {
+        order.push_back('h');
+        return ++high == 2;
+    }, AsyncTaskOptions{ .Priority = focus });
+    EXPECT_EQ(queue.DrainCompletions(), 2u);
+    EXPECT_EQ(order, (std::vector<char>{ 'h', 'h', 'l', 'l' }));
+
+    // The cell is read at each requeue: raised between slices, the import
+    // that was speculative stays ahead of one submitted after it.
+    order.clear();
+    low = 0;
+    high = 0;
+    queue.SubmitCommitSlices([&] {
+        order.push_back('l');
+        speculative->store(AsyncTaskPriority::High);
+        return ++low == 2;
+    }, AsyncTaskOptions{ .Priority = speculative });
+    EXPECT_EQ(queue.DrainCompletions({ .MaxTime = std::chrono::steady_clock::duration::zero() }), 0u);
+    queue.SubmitCommitSlices([&] {
+        order.push_back('h');
+        return ++high == 2;
+    }, AsyncTaskOptions{ .Priority = focus });
+    EXPECT_EQ(queue.DrainCompletions(), 2u);
+    EXPECT_EQ(order, (std::vector<char>{ 'l', 'l', 'h', 'h' }));
+}
+
+TEST(AsyncTaskQueueZeroThread, CancelBetweenSlicesDropsTheRest)
+{
+    AsyncTaskQueue queue(0);
+    int slices = 0;
+    auto sliced = queue.SubmitCommitSlices([&] { return ++slices == 3; });
+
+    EXPECT_EQ(queue.DrainCompletions({ .MaxTime = std::chrono::steady_clock::duration::zero() }), 0u);
+    EXPECT_TRUE(queue.Cancel(sliced));
+    EXPECT_EQ(queue.DrainCompletions(), 0u);
+    EXPECT_EQ(slices, 1);
+    EXPECT_EQ(queue.GetState(sliced), AsyncTaskState::Cancelled);
+}
+
 //=============================================================================
 // Threaded mode: one smoke test for the request/poll shape (the same pattern
 // as the SwapchainRebuildWorker coverage) plus thread-identity checks.
@@ -322,6 +638,108 @@ TEST(AsyncTaskQueueThreaded, DestructorWithPendingAndUndrainedTasksDoesNotHang)
     EXPECT_FALSE(commitRan);
 }
 
+TEST(AsyncTaskQueueThreaded, StagedReadsRunOnTheIoPoolAndDecodesOnCompute)
+{
+    AsyncTaskQueue queue(2, 2);
+    EXPECT_EQ(queue.WorkerCount(), 2u);
+    EXPECT_EQ(queue.IoWorkerCount(), 2u);
+    constexpr int TaskCount = 64;
+
+    std::mutex mutex;
+    std::set<std::thread::id> readThreads;
+    std::set<std::thread::id> decodeThreads;
+    int sum = 0;
+    std::vector<AsyncTaskHandle> handles;
+    for (int i = 0; i < TaskCount; ++i)
+    {
+        handles.push_back(queue.SubmitStaged<int, int>(
+            [&, i] {
+                std::lock_guard lock(mutex);
+                readThreads.insert(std::this_thread::get_id());
+                return i;
+            },
+            [&](int bytes) {
+                std::lock_guard lock(mutex);
+                decodeThreads.insert(std::this_thread::get_id());
+                return bytes;
+            },
+            [&sum](int v) { sum += v; }));
+    }
+
+    for (const auto& handle : handles)
+    {
+        ASSERT_TRUE(DrainUntilComplete(queue, handle));
+    }
+    EXPECT_EQ(sum, TaskCount * (TaskCount - 1) / 2);
+
+    // Disjoint: no thread both read and decoded, and the owner did neither.
+    for (const std::thread::id id : readThreads)
+    {
+        EXPECT_EQ(decodeThreads.count(id), 0u);
+    }
+    EXPECT_EQ(readThreads.count(std::this_thread::get_id()), 0u);
+    EXPECT_EQ(decodeThreads.count(std::this_thread::get_id()), 0u);
+}
+
+TEST(AsyncTaskQueueThreaded, DestructorWithStagedTasksInFlightDoesNotHang)
+{
+    bool commitRan = false;
+    {
+        AsyncTaskQueue queue(1, 1);
+        for (int i = 0; i < 16; ++i)
+        {
+            queue.SubmitStaged<int, int>(
+                [] {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    return 0;
+                },
+                [](int bytes) { return bytes; },
+                [&](int) { commitRan = true; });
+        }
+        // No drain: destructor joins both pools mid-flight.
+    }
+    EXPECT_FALSE(commitRan);
+}
+
+TEST(AsyncTaskQueueThreaded, CancelStopsRunningWorkThatPollsItsToken)
+{
+    AsyncTaskQueue queue(1);
+    std::atomic<bool> started = false;
+    std::atomic<bool> sawStop = false;
+    bool committed = false;
+
+    std::stop_source stop;
+    auto handle = queue.Submit<int>(
+        [&, token = stop.get_token()] {
+            started = true;
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+            while (!token.stop_requested() && std::chrono::steady_clock::now() < deadline)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            sawStop = token.stop_requested();
+            return 0;
+        },
+        [&](int) { committed = true; },
+        AsyncTaskOptions{ .Stop = stop });
+
+    while (!started)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(queue.GetState(handle), AsyncTaskState::Running);
+    EXPECT_TRUE(queue.Cancel(handle));
+    EXPECT_EQ(queue.GetState(handle), AsyncTaskState::Cancelled);
+
+    // A sentinel behind it on the single worker: once it commits, the
+    // stopped task has returned and been dropped.
+    auto sentinel = queue.Submit<int>([] { return 0; }, [](int) {});
+    ASSERT_TRUE(DrainUntilComplete(queue, sentinel));
+    EXPECT_TRUE(sawStop);
+    EXPECT_FALSE(committed);
+    EXPECT_EQ(queue.GetState(handle), AsyncTaskState::Cancelled);
+}
+
 //=============================================================================
 // Contract death tests, matching the engine's assert-based pattern.
 //=============================================================================
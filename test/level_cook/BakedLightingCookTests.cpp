@@ -9,9 +9,12 @@
 #include "document/EditorDocument.h"
 #include "brush/BrushMesh.h"
 
+#include <assets/cook/SceneCookOutput.h>
 #include <assets/static_mesh/MeshLoader.h>
 #include <assets/texture/TextureLoader.h>
 #include <core/assets/AssetRef.h>
+#include <core/json/JsonStringify.h>
+#include <core/json/JsonValue.h>
 #include <core/logging/LoggingProvider.h>
 #include <ecs/World.h>
 #include <render/LightComponentTypes.h>
@@ -29,7 +32,7 @@
 #include <filesystem>
 #include <fstream>
 #include <iterator>
-#include <sstream>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -353,12 +356,20 @@ protected:
         return false;
     }
 
+    // The cooked scene is binary; its JSON form is what these checks search.
+    static std::string CookedSceneText(const fs::path& path)
+    {
+        std::string error;
+        const std::optional<JsonValue> json =
+            ReadCookedSceneJson(path, EditorSceneSerializers(), &error);
+        EXPECT_TRUE(json.has_value()) << error;
+        return json ? JsonStringify(*json) : std::string();
+    }
+
     bool CookedSceneNamesZoneLightmap()
     {
-        std::ifstream file(Root / ".cooked/levels/test.cooked.json");
-        std::ostringstream buffer;
-        buffer << file.rdbuf();
-        return buffer.str().find("ZoneLightmap") != std::string::npos;
+        return CookedSceneText(Root / ".cooked/levels/test.cooked.sscn").find("ZoneLightmap")
+            != std::string::npos;
     }
 
     fs::path Root;
@@ -423,10 +434,8 @@ TEST_F(BakedLightingCookTest, AoPlaneBakesBesideTheAtlas)
     EXPECT_LT(darkest, 200u);   // contact darkening near the wall base
     EXPECT_GT(fullyOpen, 0u);   // open floor and untouched fill stay white
 
-    std::ifstream scene(Root / ".cooked/levels/test.cooked.json");
-    std::ostringstream buffer;
-    buffer << scene.rdbuf();
-    EXPECT_NE(buffer.str().find("\"ao\""), std::string::npos);
+    EXPECT_NE(CookedSceneText(Root / ".cooked/levels/test.cooked.sscn").find("\"ao\""),
+              std::string::npos);
 }
 
 TEST_F(BakedLightingCookTest, AoDisabledCooksNoPlane)
@@ -441,10 +450,8 @@ TEST_F(BakedLightingCookTest, AoDisabledCooksNoPlane)
     EXPECT_TRUE(fs::exists(Root / ".cooked/levels/test/lightmap.stex"));
     EXPECT_FALSE(fs::exists(Root / ".cooked/levels/test/ao.stex"));
 
-    std::ifstream scene(Root / ".cooked/levels/test.cooked.json");
-    std::ostringstream buffer;
-    buffer << scene.rdbuf();
-    EXPECT_EQ(buffer.str().find("\"ao\""), std::string::npos);
+    EXPECT_EQ(CookedSceneText(Root / ".cooked/levels/test.cooked.sscn").find("\"ao\""),
+              std::string::npos);
 }
 
 TEST_F(BakedLightingCookTest, NoLightingProfileWithdrawsPublishedLighting)
@@ -464,10 +471,7 @@ TEST_F(BakedLightingCookTest, NoLightingProfileWithdrawsPublishedLighting)
     EXPECT_FALSE(fs::exists(Root / ".cooked/levels/test/lightmap.stex"));
     EXPECT_FALSE(fs::exists(Root / ".cooked/levels/test/ao.stex"));
 
-    std::ifstream scene(unlit.CookedScenePath);
-    std::ostringstream buffer;
-    buffer << scene.rdbuf();
-    EXPECT_EQ(buffer.str().find("ZoneLightmap"), std::string::npos);
+    EXPECT_EQ(CookedSceneText(unlit.CookedScenePath).find("ZoneLightmap"), std::string::npos);
 }
 
 // A structure-only recook that neither targets lighting nor withdraws it keeps
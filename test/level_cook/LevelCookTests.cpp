@@ -4,11 +4,11 @@
 
 #include <assets/cook/CookPrune.h>
 #include <assets/cook/CookedCache.h>
+#include <assets/cook/SceneCookOutput.h>
 #include <core/assets/AssetIdMap.h>
 #include <core/assets/AssetManifest.h>
 #include <core/assets/AssetKindRegistry.h>
 #include <core/assets/AssetRegistry.h>
-#include <core/json/JsonParser.h>
 #include <core/json/JsonValue.h>
 #include <core/logging/LoggingProvider.h>
 #include <jobs/AsyncTaskQueue.h>
@@ -18,7 +18,6 @@
 #include <cstdint>
 #include <filesystem>
 #include <fstream>
-#include <sstream>
 #include <string>
 #include <memory>
 #include <optional>
@@ -66,12 +65,13 @@ namespace
             return levelPath;
         }
 
-        [[nodiscard]] JsonValue ReadJson(const fs::path& p) const
+        // Cooked scenes are binary on disk; this reads one back as its JSON.
+        [[nodiscard]] JsonValue ReadCookedScene(const fs::path& p) const
         {
-            std::ifstream f(p);
-            std::ostringstream buf;
-            buf << f.rdbuf();
-            return *JsonParse(buf.str());
+            std::string error;
+            std::optional<JsonValue> json = ReadCookedSceneJson(p, EditorSceneSerializers(), &error);
+            EXPECT_TRUE(json.has_value()) << error;
+            return json.value_or(JsonValue{});
         }
 
         fs::path Root;
@@ -100,7 +100,7 @@ TEST_F(LevelCookTest, CooksPerCellMeshesAndScene)
 
     // The cooked scene is brush-free and carries a StaticMesh-per-cell with a
     // materials array (the per-cell, per-section binding).
-    const JsonValue cooked = ReadJson(result.CookedScenePath);
+    const JsonValue cooked = ReadCookedScene(result.CookedScenePath);
     const JsonValue* entities = cooked.Find("entities");
     ASSERT_NE(entities, nullptr);
     ASSERT_TRUE(entities->IsArray());
@@ -142,7 +142,7 @@ TEST_F(LevelCookTest, CooksLiveDocumentWithoutSavingOrMutatingIt)
 
     // The cooked scene drops brushes, emits one cell StaticMesh, and passes the
     // camera entity through.
-    const JsonValue cooked = ReadJson(result.CookedScenePath);
+    const JsonValue cooked = ReadCookedScene(result.CookedScenePath);
     const JsonValue* entities = cooked.Find("entities");
     ASSERT_NE(entities, nullptr);
     ASSERT_TRUE(entities->IsArray());
@@ -252,7 +252,7 @@ TEST_F(LevelCookTest, CookedSceneFullyResolvesAgainstScannedRegistry)
     // record carrying the id the cook assigned. This is the headless proof that a
     // host can find everything a cooked level points at (the registration gate),
     // independent of GPU-backed mesh/material residency.
-    const JsonValue cooked = ReadJson(Root / ".cooked/levels/test.cooked.json");
+    const JsonValue cooked = ReadCookedScene(Root / ".cooked/levels/test.cooked.sscn");
     const std::vector<std::string> refs = CollectAssetPaths(cooked);
     ASSERT_FALSE(refs.empty());
 
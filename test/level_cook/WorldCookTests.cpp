@@ -6,6 +6,7 @@
 #include "document/WorldDocument.h"
 #include "document/commands/MoveEntitiesToZoneCommand.h"
 
+#include <assets/cook/SceneCookOutput.h>
 #include <assets/probes/ProbeVolumeFormat.h>
 #include <core/json/JsonParser.h>
 #include <core/json/JsonStringify.h>
@@ -13,6 +14,7 @@
 #include <core/serialization/BinaryReader.h>
 #include <render/IrradianceVolumeComponent.h>
 #include <world/identity/PersistentIdComponent.h>
+#include <world/serialization/SceneFormat.h>
 #include <zone/WorldPartitionManifest.h>
 #include <zone/WorldConnectionComponents.h>
 
@@ -271,7 +273,7 @@ TEST_F(WorldCookTest, CookReflectsCrossZoneMove)
 
     const auto cookedEntityCount = [this](const std::string& sceneRef)
     {
-        const auto json = JsonParse(ReadFile(Root / sceneRef));
+        const auto json = ReadCookedSceneJson(Root / sceneRef, EditorSceneSerializers());
         EXPECT_TRUE(json.has_value());
         const JsonValue* entities = json->Find("entities");
         EXPECT_NE(entities, nullptr);
@@ -362,9 +364,8 @@ namespace
 double ProbeC0Sum(const std::filesystem::path& cookedScenePath)
 {
     std::string probePath = cookedScenePath.generic_string();
-    constexpr std::string_view cookedSuffix = ".cooked.json";
-    EXPECT_TRUE(probePath.ends_with(cookedSuffix));
-    probePath.resize(probePath.size() - cookedSuffix.size());
+    EXPECT_TRUE(probePath.ends_with(CookedSceneSuffix));
+    probePath.resize(probePath.size() - CookedSceneSuffix.size());
     probePath += "/probes.sprobe";
 
     std::ifstream stream(probePath, std::ios::binary);
@@ -644,7 +645,8 @@ TEST_F(WorldCookTest, CookedSceneCarriesAuthoredIdsAndGeneratedEntitiesCarryNone
 
     const WorldPartitionManifest manifest = ParseCookedManifest(cooked.CookedManifestPath);
     ASSERT_FALSE(manifest.Zones.empty());
-    const auto sceneJson = JsonParse(ReadFile(Root / manifest.Zones[0].CookedSceneRef));
+    const auto sceneJson =
+        ReadCookedSceneJson(Root / manifest.Zones[0].CookedSceneRef, EditorSceneSerializers());
     ASSERT_TRUE(sceneJson.has_value());
     const JsonValue* entities = sceneJson->Find("entities");
     ASSERT_NE(entities, nullptr);
@@ -0,0 +1,210 @@
+#include <gtest/gtest.h>
+
+#include <net/NetEntropyCoder.h>
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace
+{
+    // Mostly zeros with a scatter of small values, which is what a snapshot's
+    // masks and small deltas look like to a byte model.
+    std::vector<std::byte> SnapshotLike(std::size_t size, std::uint32_t seed)
+    {
+        std::vector<std::byte> out(size);
+        for (std::byte& value : out)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            const std::uint32_t roll = (seed >> 16) & 0xFF;
+            value = static_cast<std::byte>(roll < 160 ? 0 : roll < 224 ? (roll & 0x07) : roll);
+        }
+        return out;
+    }
+
+    NetEntropyModel Trained()
+    {
+        NetEntropyTrainer trainer;
+        for (std::uint32_t sample = 0; sample < 32; ++sample)
+            trainer.Observe(SnapshotLike(400, sample + 1));
+        return trainer.Build();
+    }
+
+    std::optional<std::vector<std::byte>> Encode(const NetEntropyModel& model,
+                                                 std::span<const std::byte> input)
+    {
+        std::vector<std::byte> out(input.size() * 2 + kNetEntropyHeaderBytes);
+        const std::optional<std::size_t> written = NetEntropyEncode(model, input, out);
+        if (!written)
+            return std::nullopt;
+        out.resize(*written);
+        return out;
+    }
+}
+
+TEST(NetEntropyCoder, RoundTripsExactly)
+{
+    const NetEntropyModel model = Trained();
+    for (std::size_t size : { std::size_t{ 0 }, std::size_t{ 1 }, std::size_t{ 17 },
+                              std::size_t{ 1200 } })
+    {
+        const std::vector<std::byte> input = SnapshotLike(size, 99);
+        const std::optional<std::vector<std::byte>> coded = Encode(model, input);
+        ASSERT_TRUE(coded.has_value()) << "size " << size;
+
+        std::vector<std::byte> decoded(size);
+        const std::optional<std::size_t> read = NetEntropyDecode(model, *coded, decoded);
+        ASSERT_TRUE(read.has_value()) << "size " << size;
+        EXPECT_EQ(*read, size);
+        EXPECT_EQ(decoded, input) << "size " << size;
+    }
+}
+
+// The point of a trained model: traffic shaped like the training shrinks.
+TEST(NetEntropyCoder, ATrainedModelShrinksTheTrafficItWasTrainedOn)
+{
+    const NetEntropyModel model = Trained();
+    const std::vector<std::byte> input = SnapshotLike(1000, 12345);
+    const std::optional<std::vector<std::byte>> coded = Encode(model, input);
+    ASSERT_TRUE(coded.has_value());
+    EXPECT_LT(coded->size(), input.size() * 3 / 4);
+}
+
+// Every symbol keeps a nonzero frequency, so a byte the training never saw is
+// expensive rather than unencodable.
+TEST(NetEntropyCoder, BytesTheModelNeverSawStillRoundTrip)
+{
+    NetEntropyTrainer trainer;
+    const std::array<std::byte, 64> zeros{};
+    trainer.Observe(zeros);
+    const NetEntropyModel model = trainer.Build();
+
+    std::vector<std::byte> input(256);
+    for (std::size_t i = 0; i < input.size(); ++i)
+        input[i] = static_cast<std::byte>(i);
+
+    const std::optional<std::vector<std::byte>> coded = Encode(model, input);
+    ASSERT_TRUE(coded.has_value());
+    std::vector<std::byte> decoded(input.size());
+    ASSERT_TRUE(NetEntropyDecode(model, *coded, decoded).has_value());
+    EXPECT_EQ(decoded, input);
+}
+
+TEST(NetEntropyCoder, EncodingIntoTooSmallABufferFails)
+{
+    const NetEntropyModel model;
+    const std::vector<std::byte> input = SnapshotLike(200, 7);
+    std::array<std::byte, 32> out{};
+    EXPECT_FALSE(NetEntropyEncode(model, input, out).has_value());
+}
+
+//=============================================================================
+// The shipped form
+//=============================================================================
+
+TEST(NetEntropyModel, SerializedModelsRoundTrip)
+{
+    const NetEntropyModel model = Trained();
+    const std::optional<NetEntropyModel> loaded = NetEntropyModel::Deserialize(model.Serialize());
+    ASSERT_TRUE(loaded.has_value());
+    EXPECT_EQ(loaded->Hash(), model.Hash());
+    for (std::uint32_t symbol = 0; symbol < 256; ++symbol)
+    {
+        EXPECT_EQ(loaded->Frequency(static_cast<std::uint8_t>(symbol)),
+                  model.Frequency(static_cast<std::uint8_t>(symbol)));
+    }
+}
+
+TEST(NetEntropyModel, TablesThatCannotDecodeEverythingAreRefused)
+{
+    std::vector<std::byte> bytes = NetEntropyModel().Serialize();
+
+    // A symbol with no slots.
+    std::vector<std::byte> zeroed = bytes;
+    zeroed[0] = std::byte{ 0 };
+    zeroed[1] = std::byte{ 0 };
+    EXPECT_FALSE(NetEntropyModel::Deserialize(zeroed).has_value());
+
+    // A table that does not sum to the scale.
+    std::vector<std::byte> overfull = bytes;
+    overfull[0] = static_cast<std::byte>(static_cast<std::uint8_t>(overfull[0]) + 1);
+    EXPECT_FALSE(NetEntropyModel::Deserialize(overfull).has_value());
+
+    bytes.pop_back();
+    EXPECT_FALSE(NetEntropyModel::Deserialize(bytes).has_value());
+}
+
+TEST(NetEntropyModel, DifferentTrainingGivesADifferentHash)
+{
+    EXPECT_NE(Trained().Hash(), NetEntropyModel().Hash());
+}
+
+//=============================================================================
+// Hostile input
+//=============================================================================
+
+TEST(NetEntropyCoderHostile, TruncatedStreamsAreRefused)
+{
+    const NetEntropyModel model = Trained();
+    const std::vector<std::byte> input = SnapshotLike(300, 5);
+    const std::optional<std::vector<std::byte>> coded = Encode(model, input);
+    ASSERT_TRUE(coded.has_value());
+
+    std::vector<std::byte> decoded(input.size());
+    for (std::size_t length = 0; length < coded->size(); ++length)
+    {
+        EXPECT_FALSE(NetEntropyDecode(model, std::span(*coded).subspan(0, length), decoded)
+                         .has_value())
+            << "accepted a stream truncated to " << length << " bytes";
+    }
+}
+
+TEST(NetEntropyCoderHostile, AClaimedLengthLargerThanTheOutputIsRefused)
+{
+    const NetEntropyModel model;
+    const std::vector<std::byte> input = SnapshotLike(100, 3);
+    const std::optional<std::vector<std::byte>> coded = Encode(model, input);
+    ASSERT_TRUE(coded.has_value());
+
+    std::vector<std::byte> decoded(input.size() - 1);
+    EXPECT_FALSE(NetEntropyDecode(model, *coded, decoded).has_value());
+}
+
+// Decoding against a model other than the one that encoded is caught by the
+// final-state check rather than returned as plausible bytes.
+TEST(NetEntropyCoderHostile, TheWrongModelIsCaught)
+{
+    const NetEntropyModel trained = Trained();
+    const NetEntropyModel flat;
+    const std::vector<std::byte> input = SnapshotLike(300, 11);
+    const std::optional<std::vector<std::byte>> coded = Encode(trained, input);
+    ASSERT_TRUE(coded.has_value());
+
+    std::vector<std::byte> decoded(input.size());
+    EXPECT_FALSE(NetEntropyDecode(flat, *coded, decoded).has_value());
+}
+
+TEST(NetEntropyCoderHostile, ArbitraryBytesFailOrStayInBounds)
+{
+    const NetEntropyModel model = Trained();
+    std::uint32_t seed = 0xBADC0DEu;
+    std::array<std::byte, 64> decoded{};
+
+    for (int trial = 0; trial < 4000; ++trial)
+    {
+        std::array<std::byte, 48> noise{};
+        for (std::byte& value : noise)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            value = static_cast<std::byte>((seed >> 16) & 0xFF);
+        }
+
+        const std::optional<std::size_t> read = NetEntropyDecode(model, noise, decoded);
+        if (read)
+        {
+            EXPECT_LE(*read, decoded.size()) << "trial " << trial;
+        }
+    }
+}
@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+
+#include <net/NetEntropyModelFile.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    namespace fs = std::filesystem;
+
+    fs::path TempPath(const char* name)
+    {
+        return fs::temp_directory_path() / name;
+    }
+
+    std::vector<std::byte> SnapshotLike(std::size_t size, std::uint32_t seed)
+    {
+        std::vector<std::byte> out(size);
+        for (std::byte& value : out)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            const std::uint32_t roll = (seed >> 16) & 0xFF;
+            value = static_cast<std::byte>(roll < 160 ? 0 : roll < 224 ? (roll & 0x07) : roll);
+        }
+        return out;
+    }
+
+    void WriteRaw(const fs::path& path, const std::vector<char>& bytes)
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    }
+}
+
+TEST(NetEntropyModelFile, ASavedModelLoadsWithTheSameHash)
+{
+    NetEntropyTrainer trainer;
+    trainer.Observe(SnapshotLike(600, 3));
+    const NetEntropyModel model = trainer.Build();
+
+    const fs::path path = TempPath("sencha_entropy_model_test.model");
+    ASSERT_TRUE(SaveNetEntropyModel(path, model));
+    EXPECT_EQ(fs::file_size(path), 512u);
+
+    const std::optional<NetEntropyModel> loaded = LoadNetEntropyModel(path);
+    ASSERT_TRUE(loaded);
+    EXPECT_EQ(loaded->Hash(), model.Hash());
+
+    fs::remove(path);
+}
+
+TEST(NetEntropyModelFile, FilesThatAreNotATableAreRefused)
+{
+    const fs::path path = TempPath("sencha_entropy_model_bad.model");
+    std::string error;
+
+    EXPECT_FALSE(LoadNetEntropyModel(TempPath("sencha_entropy_model_missing.model"), &error));
+    EXPECT_NE(error.find("cannot open"), std::string::npos);
+
+    // A valid table with one byte too many.
+    std::vector<char> bytes(513, 0);
+    for (std::size_t symbol = 0; symbol < 256; ++symbol)
+        bytes[symbol * 2] = 16;
+    WriteRaw(path, bytes);
+    EXPECT_FALSE(LoadNetEntropyModel(path, &error));
+    EXPECT_NE(error.find("512-byte"), std::string::npos);
+
+    // The right size, but symbol zero can never be coded.
+    bytes.resize(512);
+    bytes[0] = 0;
+    bytes[2] = 32;
+    WriteRaw(path, bytes);
+    EXPECT_FALSE(LoadNetEntropyModel(path, &error));
+    EXPECT_NE(error.find("cannot decode"), std::string::npos);
+
+    fs::remove(path);
+}
+
+TEST(NetSnapshotCapture, TrainingFromACaptureMatchesTrainingInMemory)
+{
+    const fs::path path = TempPath("sencha_snapshot_capture_test.sncap");
+    NetEntropyTrainer direct;
+    {
+        NetSnapshotCapture capture;
+        ASSERT_TRUE(capture.Open(path));
+        for (std::uint32_t sample = 0; sample < 24; ++sample)
+        {
+            const std::vector<std::byte> snapshot = SnapshotLike(100 + sample * 7, sample + 1);
+            capture.Append(snapshot);
+            direct.Observe(snapshot);
+        }
+        EXPECT_EQ(capture.SnapshotsWritten(), 24u);
+    }
+
+    NetEntropyTrainer replayed;
+    const std::optional<std::uint64_t> read = ReadNetSnapshotCapture(path, replayed);
+    ASSERT_TRUE(read);
+    EXPECT_EQ(*read, 24u);
+    EXPECT_EQ(replayed.SymbolsObserved(), direct.SymbolsObserved());
+    EXPECT_EQ(replayed.Build().Hash(), direct.Build().Hash());
+
+    fs::remove(path);
+}
+
+TEST(NetSnapshotCapture, ATornFinalRecordEndsTheRead)
+{
+    const fs::path path = TempPath("sencha_snapshot_capture_torn.sncap");
+    {
+        NetSnapshotCapture capture;
+        ASSERT_TRUE(capture.Open(path));
+        capture.Append(SnapshotLike(64, 1));
+        capture.Append(SnapshotLike(64, 2));
+    }
+    fs::resize_file(path, fs::file_size(path) - 10);
+
+    NetEntropyTrainer trainer;
+    const std::optional<std::uint64_t> read = ReadNetSnapshotCapture(path, trainer);
+    ASSERT_TRUE(read);
+    EXPECT_EQ(*read, 1u);
+    EXPECT_EQ(trainer.SymbolsObserved(), 64u);
+
+    fs::remove(path);
+}
+
+TEST(NetSnapshotCapture, AFileThatIsNotACaptureIsRefused)
+{
+    const fs::path path = TempPath("sencha_snapshot_capture_bad.sncap");
+    WriteRaw(path, { 'S', 'N', 'C', 'X', 1, 0, 0, 0 });
+
+    NetEntropyTrainer trainer;
+    EXPECT_FALSE(ReadNetSnapshotCapture(path, trainer));
+    EXPECT_EQ(trainer.SymbolsObserved(), 0u);
+
+    fs::remove(path);
+}
@@ -122,6 +122,49 @@ TEST(NetStats, PayloadKindsMapToTheirOwnBuckets)
               NetTrafficKind::Other);
 }
 
+TEST(NetStats, TransportCountersBecomeCallRates)
+{
+    NetStats stats;
+    double now = 0.0;
+    stats.Sample(now);
+
+    stats.RecordTransport(NetTransportCounters{
+        .ReceiveCalls = 10, .SendCalls = 5, .DatagramsReceived = 300, .DatagramsSent = 200 });
+    stats.RecordPumpSeconds(0.001);
+    stats.RecordPumpSeconds(0.003);
+    stats.RecordFlushSeconds(0.002);
+    Advance(stats, now, 1.0);
+
+    EXPECT_DOUBLE_EQ(stats.Transport().ReceiveCalls, 10.0);
+    EXPECT_DOUBLE_EQ(stats.Transport().SendCalls, 5.0);
+    EXPECT_DOUBLE_EQ(stats.Transport().DatagramsIn, 300.0);
+    EXPECT_DOUBLE_EQ(stats.Transport().DatagramsOut, 200.0);
+    EXPECT_NEAR(stats.Transport().PumpMilliseconds, 2.0, 1e-9);
+    EXPECT_NEAR(stats.Transport().PumpMillisecondsPeak, 3.0, 1e-9);
+    EXPECT_NEAR(stats.Transport().FlushMilliseconds, 2.0, 1e-9);
+
+    // Lifetime counters: only the growth since the last record is new.
+    stats.RecordTransport(NetTransportCounters{
+        .ReceiveCalls = 14, .SendCalls = 5, .DatagramsReceived = 300, .DatagramsSent = 200 });
+    Advance(stats, now, 1.0);
+    EXPECT_DOUBLE_EQ(stats.Transport().ReceiveCalls, 4.0);
+    EXPECT_DOUBLE_EQ(stats.Transport().SendCalls, 0.0);
+}
+
+TEST(NetStats, AReopenedTransportCountsFromZero)
+{
+    NetStats stats;
+    double now = 0.0;
+    stats.Sample(now);
+    stats.RecordTransport(NetTransportCounters{ .ReceiveCalls = 100 });
+    Advance(stats, now, 1.0);
+
+    stats.RecordTransport(NetTransportCounters{ .ReceiveCalls = 3 });
+    Advance(stats, now, 1.0);
+    EXPECT_DOUBLE_EQ(stats.Transport().ReceiveCalls, 3.0)
+        << "counters that went backwards read as a reopen, not a negative rate";
+}
+
 TEST(NetStats, ResetsWithTheSession)
 {
     NetStats stats;
@@ -202,3 +202,37 @@ TEST(NetTickEstimator, ResetsWithTheSession)
     EXPECT_EQ(clock.Offset(), 0);
     EXPECT_EQ(clock.SlackTicks(), 0u);
 }
+
+// Snapshots a tick apart arriving a tick apart are a connection with nothing
+// to absorb, whatever its latency.
+TEST(NetTickEstimator, MeasuresNoJitterOnAnEvenStream)
+{
+    NetTickEstimator clock;
+    for (std::uint64_t tick = 0; tick < 200; ++tick)
+        clock.Observe(1000 + tick, 40 + tick, RttForTicks(3), kTick);
+
+    EXPECT_DOUBLE_EQ(clock.JitterTicks(), 0.0);
+}
+
+TEST(NetTickEstimator, MeasuresJitterAsTheSwingBetweenArrivals)
+{
+    NetTickEstimator clock;
+    // Every other snapshot lands a tick late: each arrival is a tick off from
+    // where its predecessor put it.
+    for (std::uint64_t tick = 0; tick < 200; ++tick)
+        clock.Observe(1000 + tick, 40 + tick + (tick % 2), RttForTicks(3), kTick);
+
+    EXPECT_NEAR(clock.JitterTicks(), 1.0, 0.01);
+}
+
+// A step the estimate snaps across is a discontinuity, not a ragged
+// connection; counting it would hold the playout delay up for seconds after.
+TEST(NetTickEstimator, DoesNotCountADiscontinuityAsJitter)
+{
+    NetTickEstimator clock;
+    for (std::uint64_t tick = 0; tick < 50; ++tick)
+        clock.Observe(1000 + tick, 40 + tick, 0, kTick);
+    clock.Observe(1050, 400, 0, kTick);
+
+    EXPECT_DOUBLE_EQ(clock.JitterTicks(), 0.0);
+}
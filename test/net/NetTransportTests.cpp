@@ -258,6 +258,57 @@ TEST(UdpTransport, RoundTripsOverRealLoopback)
     EXPECT_EQ(received[0], "over the wire");
 }
 
+// The batched path: many queued datagrams leave in one flush and arrive in one
+// drain, in order, and the call counters show the batch rather than the count.
+TEST(UdpTransport, QueuedSendsLeaveInOneFlushInQueueOrder)
+{
+    UdpTransport host;
+    UdpTransport client;
+    ASSERT_TRUE(host.Open(0));
+    ASSERT_TRUE(client.Open(0));
+
+    constexpr int kCount = 40;
+    for (int index = 0; index < kCount; ++index)
+        ASSERT_TRUE(client.Queue(host.LocalAddress(), Bytes(std::to_string(index))));
+    EXPECT_EQ(client.Counters().SendCalls, 0u) << "queueing must not transmit";
+
+    client.FlushSends();
+    EXPECT_EQ(client.Counters().DatagramsSent, static_cast<std::uint64_t>(kCount));
+
+    std::vector<std::string> received;
+    for (int attempt = 0; attempt < 100 && received.size() < kCount; ++attempt)
+    {
+        for (std::string& text : DrainText(host))
+            received.push_back(std::move(text));
+    }
+    ASSERT_EQ(received.size(), static_cast<std::size_t>(kCount));
+    for (int index = 0; index < kCount; ++index)
+        EXPECT_EQ(received[index], std::to_string(index));
+
+    EXPECT_EQ(host.Counters().DatagramsReceived, static_cast<std::uint64_t>(kCount));
+#if defined(__linux__)
+    EXPECT_LT(client.Counters().SendCalls, static_cast<std::uint64_t>(kCount));
+    EXPECT_LT(host.Counters().ReceiveCalls, static_cast<std::uint64_t>(kCount));
+#endif
+}
+
+TEST(UdpTransport, CloseFlushesWhatWasQueued)
+{
+    UdpTransport host;
+    UdpTransport client;
+    ASSERT_TRUE(host.Open(0));
+    ASSERT_TRUE(client.Open(0));
+
+    ASSERT_TRUE(client.Queue(host.LocalAddress(), Bytes("goodbye")));
+    client.Close();
+
+    std::vector<std::string> received;
+    for (int attempt = 0; attempt < 100 && received.empty(); ++attempt)
+        received = DrainText(host);
+    ASSERT_EQ(received.size(), 1u) << "a disconnect notice queued on the way out was lost";
+    EXPECT_EQ(received[0], "goodbye");
+}
+
 TEST(UdpTransport, RefusesOversizedAndUnopenedSends)
 {
     UdpTransport transport;
@@ -267,6 +318,7 @@ TEST(UdpTransport, RefusesOversizedAndUnopenedSends)
     ASSERT_TRUE(transport.Open(0));
     const std::vector<std::byte> tooBig(kNetMaxDatagramBytes + 1, std::byte{ 0 });
     EXPECT_FALSE(transport.Send(NetAddressLoopback(1234), tooBig));
+    EXPECT_FALSE(transport.Queue(NetAddressLoopback(1234), tooBig));
 }
 
 TEST(UdpTransport, RefusesASecondBindOnTheSamePort)
@@ -0,0 +1,357 @@
+#include <gtest/gtest.h>
+
+#include <controller/LookOrientation.h>
+#include <ecs/World.h>
+#include <input/InputActionState.h>
+#include <math/MathSchemas.h>
+#include <net/NetReplicationComponents.h>
+#include <net/NetTickEstimator.h>
+#include <net/PredictionRuntime.h>
+#include <net/ReplicationLayout.h>
+#include <world/transform/TransformComponents.h>
+
+#include <cstdint>
+#include <span>
+
+//=============================================================================
+// A client's guess about its own pawn, and what happens when the authority
+// disagrees.
+//
+// The simulation here is one line -- the pawn moves by the tick's input -- so
+// every expected position is arithmetic, and a test that fails names exactly
+// which tick's input went missing or was replayed twice. The authority is the
+// test itself: it says where the pawn was at a tick, the way a snapshot would.
+//=============================================================================
+
+namespace
+{
+    constexpr InputActionId kMove{ 1 };
+    constexpr PeerId kSelf{ 1 };
+    constexpr double kTick = 1.0 / 60.0;
+
+    float PositionOf(const World& world, EntityId entity)
+    {
+        return world.TryGet<LocalTransform>(entity)->Value.Position.X;
+    }
+
+    // The whole simulation: the pawn moves along X by the tick's input.
+    void Move(World& world)
+    {
+        const float step = world.GetResource<InputActionState>().Tick().Axis(kMove);
+        world.ForEachComponent<LocalTransform>([&](EntityId, LocalTransform& local) {
+            local.Value.Position.X += step;
+        });
+    }
+
+    struct Client
+    {
+        World Entities;
+        ReplicationLayout Layout;
+        NetTickEstimator Clock;
+        PredictionRuntime Prediction;
+        EntityId Pawn;
+        std::uint64_t Tick = 0;
+        std::uint32_t Replayed = 0;
+        std::uint32_t Reseated = 0;
+
+        Client()
+        {
+            Entities.RegisterComponent<LocalTransform>();
+            Entities.RegisterComponent<LookOrientation>();
+            Entities.RegisterComponent<NetOwner>();
+            Entities.AddResource<InputActionState>().Configure(1);
+
+            Layout.Add<LocalTransform>();
+            Layout.Add<LookOrientation>();
+            Layout.Add<NetOwner>();
+            Layout.Seal();
+
+            // Same clock on both ends and no flight time: a command for local
+            // tick t is the authority's tick t, and its result is stamped t+1.
+            Clock.Observe(0, 0, 0, kTick);
+
+            Pawn = Entities.CreateEntity();
+            Entities.AddComponent<LocalTransform>(Pawn, LocalTransform{});
+            Entities.AddComponent<LookOrientation>(Pawn, LookOrientation{});
+            Entities.AddComponent<NetOwner>(Pawn, NetOwner{ .Peer = kSelf.Value });
+
+            Prediction.SetEnabled(true);
+        }
+
+        // One predicted tick on the player's own input.
+        void Step(float input)
+        {
+            InputActionState& actions = Entities.GetResource<InputActionState>();
+            actions.BeginTick(Tick)[0] = InputActionValue{ .X = input };
+            Move(Entities);
+            Prediction.Capture(Entities, Layout, kSelf, Tick, Clock);
+            ++Tick;
+        }
+
+        // A snapshot saying where the pawn was once `tick` had run.
+        void Hear(std::uint64_t stamp, float position)
+        {
+            Prediction.BeginAuthoritative(Entities, Layout);
+            Entities.TryGet<LocalTransform>(Pawn)->Value.Position.X = position;
+            Prediction.EndAuthoritative(Entities, Layout, kSelf, stamp, true);
+        }
+
+        void Reconcile()
+        {
+            Prediction.Reconcile(
+                Entities, Layout,
+                [this](std::uint64_t) {
+                    Move(Entities);
+                    ++Replayed;
+                },
+                [this](std::span<const EntityId> entities) {
+                    for (const EntityId entity : entities)
+                        Reseated += entity == Pawn ? 1u : 0u;
+                });
+        }
+
+        [[nodiscard]] float Position() const { return PositionOf(Entities, Pawn); }
+    };
+}
+
+TEST(PredictionRuntime, AnAgreeingSnapshotLeavesThePredictionInPlace)
+{
+    Client client;
+    for (int step = 0; step < 10; ++step)
+        client.Step(1.0f);
+    ASSERT_FLOAT_EQ(client.Position(), 10.0f);
+
+    // The authority ran the same four ticks on the same input.
+    client.Hear(4, 4.0f);
+    EXPECT_FLOAT_EQ(client.Position(), 4.0f);
+
+    client.Reconcile();
+    EXPECT_FLOAT_EQ(client.Position(), 10.0f);
+    EXPECT_EQ(client.Replayed, 0u);
+
+    const PredictionRuntime::Counters& stats = client.Prediction.Stats();
+    EXPECT_EQ(stats.Reconciled, 1u);
+    EXPECT_EQ(stats.Mispredicted, 0u);
+}
+
+TEST(PredictionRuntime, AMispredictionReplaysFromTheAuthoritysState)
+{
+    Client client;
+    for (int step = 0; step < 10; ++step)
+        client.Step(1.0f);
+
+    // Something the client could not see pushed the pawn two units back by
+    // the end of tick three.
+    client.Hear(4, 2.0f);
+    client.Reconcile();
+
+    // Six ticks replayed on top of the corrected state.
+    EXPECT_EQ(client.Replayed, 6u);
+    EXPECT_FLOAT_EQ(client.Position(), 8.0f);
+
+    const PredictionRuntime::Counters& stats = client.Prediction.Stats();
+    EXPECT_EQ(stats.Mispredicted, 1u);
+    EXPECT_EQ(stats.ResimulatedTicks, 6u);
+    EXPECT_EQ(stats.LastResimTicks, 6u);
+}
+
+// Each replayed tick sees the input it saw the first time, not whatever the
+// device says now and not the newest tick's record.
+TEST(PredictionRuntime, ReplayFeedsEachTickItsOwnRecordedInput)
+{
+    Client client;
+    for (int step = 0; step < 6; ++step)
+        client.Step(static_cast<float>(step));
+    // 0+1+2+3+4+5
+    ASSERT_FLOAT_EQ(client.Position(), 15.0f);
+
+    // Right by tick one; the replay then adds 2+3+4+5 onto the correction.
+    client.Hear(2, 100.0f);
+    client.Reconcile();
+    EXPECT_FLOAT_EQ(client.Position(), 114.0f);
+
+    // The live history a command is built from is untouched by the replay.
+    const InputActionState& live = client.Entities.GetResource<InputActionState>();
+    EXPECT_EQ(live.CurrentTick(), 5u);
+    EXPECT_FLOAT_EQ(live.Tick().Axis(kMove), 5.0f);
+}
+
+// The replay rewrites the ring, so the next snapshot checks against the
+// corrected run rather than the guess it replaced.
+TEST(PredictionRuntime, ACorrectionBecomesThePredictionLaterSnapshotsCheck)
+{
+    Client client;
+    for (int step = 0; step < 8; ++step)
+        client.Step(1.0f);
+
+    client.Hear(3, 0.0f);
+    client.Reconcile();
+    ASSERT_FLOAT_EQ(client.Position(), 5.0f);
+
+    client.Hear(5, 2.0f);
+    client.Reconcile();
+    EXPECT_EQ(client.Prediction.Stats().Mispredicted, 1u);
+    EXPECT_FLOAT_EQ(client.Position(), 5.0f);
+}
+
+// A snapshot is a delta against the last authoritative state. One that says
+// nothing about the pawn must leave it at that state for the comparison, not
+// at the prediction that had overwritten it.
+TEST(PredictionRuntime, ASnapshotLandsOnTheLastAuthoritativeState)
+{
+    Client client;
+    for (int step = 0; step < 4; ++step)
+        client.Step(1.0f);
+    client.Hear(2, 2.0f);
+    client.Reconcile();
+    ASSERT_FLOAT_EQ(client.Position(), 4.0f);
+
+    client.Step(0.0f);
+    client.Step(0.0f);
+
+    // The pawn did not move on the authority between ticks two and four, so
+    // the snapshot for four carries nothing about it.
+    client.Prediction.BeginAuthoritative(client.Entities, client.Layout);
+    EXPECT_FLOAT_EQ(client.Position(), 2.0f);
+    client.Prediction.EndAuthoritative(client.Entities, client.Layout, kSelf, 4, true);
+
+    // The prediction said four, the authority still says two.
+    client.Reconcile();
+    EXPECT_EQ(client.Prediction.Stats().Mispredicted, 1u);
+    EXPECT_FLOAT_EQ(client.Position(), 2.0f);
+}
+
+// Too long a window to replay is still the authority's word: the pawn takes
+// it rather than carrying on from a guess every later snapshot would refute.
+TEST(PredictionRuntime, AWindowOverBudgetSnapsToTheAuthority)
+{
+    Client client;
+    client.Prediction.SetResimBudget(3);
+    for (int step = 0; step < 10; ++step)
+        client.Step(1.0f);
+
+    client.Hear(4, 0.0f);
+    client.Reconcile();
+
+    EXPECT_EQ(client.Replayed, 0u);
+    EXPECT_FLOAT_EQ(client.Position(), 0.0f);
+    EXPECT_EQ(client.Reseated, 1u);
+    const PredictionRuntime::Counters& stats = client.Prediction.Stats();
+    EXPECT_EQ(stats.OverBudget, 1u);
+    EXPECT_EQ(stats.Snapped, 1u);
+}
+
+// With the round trip over budget for good, the pawn follows the authority
+// from snapshot to snapshot instead of drifting on its own guess.
+TEST(PredictionRuntime, AnOverBudgetRoundTripConvergesToTheAuthority)
+{
+    Client client;
+    client.Prediction.SetResimBudget(3);
+    for (int step = 0; step < 10; ++step)
+        client.Step(1.0f);
+
+    // Something holds the pawn at the origin on the authority; every snapshot
+    // says so, six ticks behind the client.
+    for (int frame = 0; frame < 20; ++frame)
+    {
+        client.Hear(client.Tick - 6, 0.0f);
+        client.Reconcile();
+        EXPECT_FLOAT_EQ(client.Position(), 0.0f) << "frame " << frame;
+        client.Step(1.0f);
+    }
+    EXPECT_EQ(client.Replayed, 0u);
+    EXPECT_EQ(client.Prediction.Stats().Snapped, 20u);
+
+    // Once a snapshot fits the budget again it replays as usual, from the
+    // authority's state rather than the prediction the snaps replaced.
+    client.Hear(client.Tick - 2, 0.0f);
+    client.Reconcile();
+    EXPECT_EQ(client.Replayed, 2u);
+    EXPECT_FLOAT_EQ(client.Position(), 2.0f);
+}
+
+// A snap is the newest record: a snapshot that then fails to decode puts the
+// authority's state back, not the prediction the snap threw away.
+TEST(PredictionRuntime, AFailedSnapshotAfterASnapKeepsTheAuthoritysState)
+{
+    Client client;
+    client.Prediction.SetResimBudget(3);
+    for (int step = 0; step < 10; ++step)
+        client.Step(1.0f);
+    client.Hear(4, 0.0f);
+    client.Reconcile();
+    ASSERT_FLOAT_EQ(client.Position(), 0.0f);
+
+    client.Prediction.BeginAuthoritative(client.Entities, client.Layout);
+    client.Entities.TryGet<LocalTransform>(client.Pawn)->Value.Position.X = 50.0f;
+    client.Prediction.EndAuthoritative(client.Entities, client.Layout, kSelf, 5, false);
+    EXPECT_FLOAT_EQ(client.Position(), 0.0f);
+}
+
+TEST(PredictionRuntime, ATickNoLongerHeldSnapsToTheAuthority)
+{
+    Client client;
+    for (std::size_t step = 0; step < PredictionRuntime::kCapacityTicks + 8; ++step)
+        client.Step(1.0f);
+
+    client.Hear(2, 0.0f);
+    client.Reconcile();
+
+    const PredictionRuntime::Counters& stats = client.Prediction.Stats();
+    EXPECT_EQ(stats.Unverified, 1u);
+    EXPECT_EQ(stats.Reconciled, 0u);
+    EXPECT_EQ(stats.Snapped, 1u);
+    EXPECT_EQ(client.Reseated, 1u);
+    EXPECT_FLOAT_EQ(client.Position(), 0.0f);
+}
+
+// Where the player is looking is this machine's; the authority never sends it
+// back to the owner, so it is neither a disagreement nor something to rewind.
+TEST(PredictionRuntime, OwnerLocalFieldsAreNeitherComparedNorRewound)
+{
+    Client client;
+    for (int step = 0; step < 4; ++step)
+        client.Step(1.0f);
+
+    client.Entities.TryGet<LookOrientation>(client.Pawn)->Yaw = 1.5f;
+    client.Hear(2, 2.0f);
+    client.Entities.TryGet<LookOrientation>(client.Pawn)->Yaw = 2.5f;
+    client.Reconcile();
+
+    EXPECT_EQ(client.Prediction.Stats().Mispredicted, 0u);
+    EXPECT_FLOAT_EQ(client.Entities.TryGet<LookOrientation>(client.Pawn)->Yaw, 2.5f);
+}
+
+TEST(PredictionRuntime, TheRingIsSizedOnceAndNeverGrows)
+{
+    Client client;
+    client.Step(1.0f);
+    const std::size_t bytes = client.Prediction.StorageBytes();
+    EXPECT_GT(bytes, 0u);
+
+    for (int step = 0; step < 500; ++step)
+    {
+        client.Step(1.0f);
+        if (step % 7 == 0)
+        {
+            client.Hear(client.Tick - 3, 0.0f);
+            client.Reconcile();
+        }
+    }
+    EXPECT_EQ(client.Prediction.StorageBytes(), bytes);
+    EXPECT_EQ(client.Prediction.RecordedTicks(), PredictionRuntime::kCapacityTicks);
+}
+
+TEST(PredictionRuntime, DisabledItRecordsAndChangesNothing)
+{
+    Client client;
+    client.Prediction.SetEnabled(false);
+    for (int step = 0; step < 4; ++step)
+        client.Step(1.0f);
+    client.Hear(2, 0.0f);
+    client.Reconcile();
+
+    EXPECT_EQ(client.Prediction.RecordedTicks(), 0u);
+    EXPECT_FLOAT_EQ(client.Position(), 0.0f);
+    EXPECT_EQ(client.Prediction.Stats().Reconciled, 0u);
+}
@@ -51,6 +51,18 @@ namespace
     {
         int Value = 0;
     };
+
+    // Smallest-three is a quaternion encoding; on a lone float it describes
+    // nothing the codec could rebuild.
+    struct MisplacedRotation
+    {
+        float Angle = 0.0f;
+    };
+
+    struct Oriented
+    {
+        Quatf Facing;
+    };
 }
 
 template <>
@@ -112,6 +124,26 @@ struct TypeSchema<DeeplyRanged>
     }
 };
 
+template <>
+struct TypeSchema<MisplacedRotation>
+{
+    static constexpr std::string_view Name = "test.MisplacedRotation";
+    static auto Fields()
+    {
+        return std::tuple{ MakeField("angle", &MisplacedRotation::Angle).QuantizeRotation(10) };
+    }
+};
+
+template <>
+struct TypeSchema<Oriented>
+{
+    static constexpr std::string_view Name = "test.Oriented";
+    static auto Fields()
+    {
+        return std::tuple{ MakeField("facing", &Oriented::Facing).QuantizeRotation(10) };
+    }
+};
+
 template <>
 struct TypeSchema<Hooked>
 {
@@ -236,6 +268,23 @@ TEST(ReplicationLayout, AFieldTheCodecCannotExpressIsRefusedByName)
         << "the failure must name the field, not just the component";
 }
 
+TEST(ReplicationLayout, ASmallestThreeRotationMustBeAQuaternion)
+{
+    ReplicationLayout accepted;
+    ASSERT_TRUE(accepted.Add<Oriented>());
+    const ReplicatedComponent* oriented =
+        accepted.Find(ResolveComponentTypeId<Oriented>());
+    ASSERT_NE(oriented, nullptr);
+    const ReplicatedField* facing = FindField(*oriented, "facing");
+    ASSERT_NE(facing, nullptr);
+    EXPECT_EQ(facing->Quantization.Kind, FieldQuantizationKind::SmallestThree);
+
+    ReplicationLayout refused;
+    EXPECT_FALSE(refused.Add<MisplacedRotation>());
+    EXPECT_EQ(refused.Error(), ReplicationLayoutError::InvalidQuantization);
+    EXPECT_NE(refused.ErrorDetail().find("angle"), std::string::npos);
+}
+
 TEST(ReplicationLayout, WireKeysArePositionalAndRoundTrip)
 {
     ReplicationLayout layout;
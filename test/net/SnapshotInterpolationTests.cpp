@@ -0,0 +1,186 @@
+#include <gtest/gtest.h>
+
+#include <ecs/World.h>
+#include <net/NetReplicationComponents.h>
+#include <net/NetTickEstimator.h>
+#include <net/ReplicationSnapshot.h>
+#include <net/SnapshotInterpolation.h>
+#include <world/transform/TransformComponents.h>
+#include <world/transform/TransformHistory.h>
+
+#include <cstdint>
+
+//=============================================================================
+// Drawing other players' entities between the snapshots that describe them.
+//
+// The clock here is the simplest one there is -- both machines count the same
+// ticks and nothing is in flight -- so the moment drawn is the local tick less
+// the playout delay, and every expected position is a line through the
+// snapshots either side of it.
+//=============================================================================
+
+namespace
+{
+    constexpr PeerId kSelf{ 1 };
+    constexpr double kTick = 1.0 / 60.0;
+
+    struct Client
+    {
+        World Entities;
+        ReplicationClientIdentity Identity;
+        NetTickEstimator Clock;
+        SnapshotInterpolation Interpolation;
+
+        Client()
+        {
+            Entities.RegisterComponent<LocalTransform>();
+            Entities.RegisterComponent<WorldTransformHistory>();
+            Entities.RegisterComponent<NetOwner>();
+            Entities.RegisterComponent<Parent>();
+            Clock.Observe(0, 0, 0, kTick);
+        }
+
+        EntityId Spawn(std::uint64_t id)
+        {
+            const EntityId entity = Entities.CreateEntity();
+            Entities.AddComponent<LocalTransform>(entity, LocalTransform{});
+            Identity.Bind(NetEntityId{ id }, entity);
+            return entity;
+        }
+
+        // A snapshot stamped `tick` that left `entity` at x.
+        void Hear(std::uint64_t tick, EntityId entity, float x)
+        {
+            Entities.TryGet<LocalTransform>(entity)->Value.Position.X = x;
+            Interpolation.Record(Entities, Identity, kSelf, tick);
+        }
+
+        [[nodiscard]] float Drawn(EntityId entity) const
+        {
+            const WorldTransformHistory* history = Entities.TryGet<WorldTransformHistory>(entity);
+            return history == nullptr ? -1.0f
+                                      : ResolvePresentationPose(*history, 0.5).Position.X;
+        }
+    };
+}
+
+TEST(SnapshotInterpolation, DrawsTheBlendOfTheSnapshotsEitherSideOfTheMoment)
+{
+    Client client;
+    const EntityId mover = client.Spawn(7);
+    client.Hear(10, mover, 0.0f);
+    client.Hear(11, mover, 1.0f);
+    client.Hear(12, mover, 2.0f);
+
+    // Halfway through local tick 12, drawn the minimum delay behind it.
+    client.Interpolation.Present(client.Entities, client.Clock, 12, 0.5, 1.0);
+    EXPECT_DOUBLE_EQ(client.Interpolation.RenderTick(),
+                     12.5 - SnapshotInterpolation::kMinDelayTicks);
+    EXPECT_FLOAT_EQ(client.Drawn(mover), 0.5f);
+    EXPECT_EQ(client.Interpolation.Stats().Interpolated, 1u);
+
+    // The simulation keeps what the snapshot said.
+    EXPECT_FLOAT_EQ(client.Entities.TryGet<LocalTransform>(mover)->Value.Position.X, 2.0f);
+}
+
+// A lost snapshot leaves the moment drawn past the newest one. The entity
+// carries on the way it was going, for a while, and then stops.
+TEST(SnapshotInterpolation, ExtrapolatesBrieflyPastTheNewestSnapshotThenHolds)
+{
+    Client client;
+    const EntityId mover = client.Spawn(7);
+    client.Hear(10, mover, 0.0f);
+    client.Hear(11, mover, 1.0f);
+
+    client.Interpolation.Present(client.Entities, client.Clock, 13, 0.0, 1.0);
+    EXPECT_FLOAT_EQ(client.Drawn(mover), 1.0f);
+
+    client.Interpolation.Present(client.Entities, client.Clock, 16, 0.0, 3.0);
+    EXPECT_FLOAT_EQ(client.Drawn(mover), 4.0f);
+    EXPECT_EQ(client.Interpolation.Stats().Extrapolated, 1u);
+
+    client.Interpolation.Present(client.Entities, client.Clock, 30, 0.0, 14.0);
+    EXPECT_FLOAT_EQ(client.Drawn(mover),
+                    1.0f + static_cast<float>(SnapshotInterpolation::kMaxExtrapolationTicks));
+    EXPECT_EQ(client.Interpolation.Stats().Held, 1u);
+}
+
+// More jitter means a longer delay, reached by running the drawn clock a
+// little slow rather than by stepping it back.
+TEST(SnapshotInterpolation, EasesTheDelayTowardWhatTheJitterAsksFor)
+{
+    Client client;
+    const EntityId mover = client.Spawn(7);
+    client.Hear(1, mover, 0.0f);
+
+    std::uint64_t local = 100;
+    client.Interpolation.Present(client.Entities, client.Clock, local, 0.0, 1.0);
+    EXPECT_DOUBLE_EQ(client.Interpolation.Stats().DelayTicks,
+                     SnapshotInterpolation::kMinDelayTicks);
+
+    // Every other snapshot a tick late, for long enough to be believed.
+    for (std::uint64_t tick = 0; tick < 200; ++tick)
+        client.Clock.Observe(tick, tick + (tick % 2), 0, kTick);
+    const std::int64_t offset = client.Clock.Offset();
+
+    double previous = client.Interpolation.RenderTick();
+    for (int frame = 0; frame < 60; ++frame)
+    {
+        ++local;
+        client.Interpolation.Present(client.Entities, client.Clock, local, 0.0, 1.0);
+        const double advanced = client.Interpolation.RenderTick() - previous;
+        ASSERT_GE(advanced, 0.9 - 1e-9) << "frame " << frame;
+        ASSERT_LE(advanced, 1.1 + 1e-9) << "frame " << frame;
+        previous = client.Interpolation.RenderTick();
+    }
+    ASSERT_EQ(client.Clock.Offset(), offset);
+
+    const SnapshotInterpolation::Counters& stats = client.Interpolation.Stats();
+    EXPECT_GT(stats.TargetDelayTicks, SnapshotInterpolation::kMinDelayTicks + 1.5);
+    EXPECT_NEAR(stats.DelayTicks, stats.TargetDelayTicks, 1e-9);
+}
+
+// This peer's own pawn is predicted or shown as applied, and a child's local
+// pose is not where it is drawn; neither is delayed on purpose.
+TEST(SnapshotInterpolation, LeavesOwnedAndParentedEntitiesToTheSimulation)
+{
+    Client client;
+    const EntityId pawn = client.Spawn(1);
+    client.Entities.AddComponent<NetOwner>(pawn, NetOwner{ .Peer = kSelf.Value });
+    const EntityId rider = client.Spawn(2);
+    client.Entities.AddComponent<Parent>(rider, Parent{ .Entity = pawn });
+    const EntityId other = client.Spawn(3);
+
+    client.Hear(10, other, 0.0f);
+
+    EXPECT_EQ(client.Interpolation.TrackedEntities(), 1u);
+    EXPECT_EQ(client.Entities.TryGet<WorldTransformHistory>(pawn), nullptr);
+    EXPECT_EQ(client.Entities.TryGet<WorldTransformHistory>(rider), nullptr);
+    EXPECT_NE(client.Entities.TryGet<WorldTransformHistory>(other), nullptr);
+}
+
+TEST(SnapshotInterpolation, ForgetsWhatTheAuthorityStoppedMentioning)
+{
+    Client client;
+    const EntityId mover = client.Spawn(7);
+    client.Hear(10, mover, 0.0f);
+    ASSERT_EQ(client.Interpolation.TrackedEntities(), 1u);
+
+    client.Identity.Unbind(NetEntityId{ 7 });
+    client.Interpolation.Record(client.Entities, client.Identity, kSelf, 11);
+    EXPECT_EQ(client.Interpolation.TrackedEntities(), 0u);
+}
+
+TEST(SnapshotInterpolation, IgnoresASnapshotNoNewerThanOneAlreadyKept)
+{
+    Client client;
+    const EntityId mover = client.Spawn(7);
+    client.Hear(12, mover, 2.0f);
+    client.Hear(11, mover, 9.0f);
+
+    EXPECT_EQ(client.Interpolation.Stats().Recorded, 1u);
+    EXPECT_EQ(client.Interpolation.Stats().Stale, 1u);
+
+    client.Interpolation.Present(client.Entities, client.Clock, 14, 0.0, 1.0);
+    EXPECT_FLOAT_EQ(client.Drawn(mover), 2.0f);
+}
@@ -10,6 +10,9 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <span>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include <assets/cook/CollisionShapeCook.h>
@@ -68,6 +71,46 @@ TEST(CollisionCook, BlobRoundTripsAndIsRaycastable)
     EXPECT_NEAR(hit.Normal.Y, 1.0f, 0.05f);
 }
 
+TEST(CollisionCook, BatchRestoredOffThreadIsAdoptedInOrder)
+{
+    const std::vector<std::byte> blob = BakeFloorBlob();
+    ASSERT_FALSE(blob.empty());
+
+    PhysicsWorld world;
+    CollisionShapeCache cache;
+    world.SetShapeCache(&cache);
+    ASSERT_TRUE(cache.LoadBlob(blob).IsValid());
+
+    // The restore touches no cache, so it can run where a zone build does.
+    CollisionShapeBatch batch;
+    std::thread restore([&]
+    {
+        EXPECT_TRUE(batch.Restore(blob));
+        EXPECT_FALSE(batch.Restore(std::span<const std::byte>{}));
+        EXPECT_TRUE(batch.Restore(blob));
+    });
+    restore.join();
+    ASSERT_EQ(batch.Count(), 2u);
+
+    const CollisionShapeHandle first = cache.Adopt(std::move(batch));
+    ASSERT_TRUE(first.IsValid());
+    EXPECT_EQ(first.Value, 2u);
+    EXPECT_TRUE(cache.Has(CollisionShapeHandle{ first.Value + 1 }));
+    EXPECT_EQ(cache.Count(), 3u);
+    EXPECT_FALSE(cache.Adopt(CollisionShapeBatch{}).IsValid());
+
+    BodyDesc desc;
+    desc.MeshShape = CollisionShapeHandle{ first.Value + 1 };
+    desc.Motion = BodyMotion::Static;
+    desc.Layer = CollisionLayer::Static;
+    ASSERT_TRUE(world.AddBody(desc).IsValid());
+
+    PhysicsQueries queries(world);
+    const RaycastHit hit = queries.Raycast(Vec3d(0.0f, 5.0f, 0.0f), Vec3d(0.0f, -1.0f, 0.0f), 10.0f);
+    ASSERT_TRUE(hit.Hit);
+    EXPECT_NEAR(hit.Point.Y, 0.0f, 0.05f);
+}
+
 TEST(CollisionCook, DynamicBodyRestsOnCookedFloorThroughScene)
 {
     const std::vector<std::byte> blob = BakeFloorBlob();
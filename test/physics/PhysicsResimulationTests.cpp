@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+
+#include <app/EngineSchedule.h>
+#include <app/GameContexts.h>
+#include <ecs/StoragePartitionSet.h>
+#include <ecs/World.h>
+#include <movement/MovementComponents.h>
+#include <physics/CharacterControllerSystem.h>
+#include <physics/PhysicsRegistration.h>
+#include <physics/PhysicsStepSystem.h>
+#include <physics/components/CharacterController.h>
+#include <physics/components/CharacterMoverLink.h>
+#include <physics/components/Collider.h>
+#include <physics/components/PhysicsBodyLink.h>
+#include <physics/components/RigidBody.h>
+#include <world/transform/TransformComponents.h>
+
+#include <span>
+
+//=============================================================================
+// Physics on a resimulated tick
+//
+// A client replaying ticks after a correction rewinds only what it predicts.
+// The physics scene is not rewound, so these pin down that a replayed tick
+// moves the predicted characters and nothing else.
+//=============================================================================
+
+namespace
+{
+constexpr double kFixedDt = 1.0 / 60.0;
+constexpr int kReplayedTicks = 8;
+
+const StoragePartitionSet& ActivePartitions()
+{
+    static const StoragePartitionSet partitions = []
+    {
+        StoragePartitionSet value;
+        value.Add(StoragePartitionId::Default());
+        return value;
+    }();
+    return partitions;
+}
+
+void SetUpPhysics(World& world)
+{
+    world.RegisterComponent<LocalTransform>();
+    RegisterPhysicsComponents(world);
+    world.RegisterComponent<MotionRequest>();
+    world.RegisterComponent<KinematicState>();
+    world.RegisterComponent<SupportState>();
+}
+
+EntityId SpawnAt(World& world, const Vec3d& position)
+{
+    Transform3f transform;
+    transform.Position = position;
+    const EntityId entity = world.CreateEntity();
+    world.AddComponent<LocalTransform>(entity, LocalTransform{ transform });
+    return entity;
+}
+
+EntityId SpawnCharacter(World& world, const Vec3d& position, const Vec3d& velocity)
+{
+    const EntityId entity = SpawnAt(world, position);
+    world.AddComponent<CharacterController>(entity, CharacterController{});
+    MotionRequest request;
+    request.Velocity = velocity;
+    world.AddComponent<MotionRequest>(entity, request);
+    world.AddComponent<KinematicState>(entity, KinematicState{});
+    world.AddComponent<SupportState>(entity, SupportState{});
+    return entity;
+}
+
+// Dispatches through the schedule, as the engine does, so a replayed tick runs
+// only the physics systems that opt in to resimulation.
+struct Rig
+{
+    EngineConfig Config;
+    RuntimeFrameLoop Runtime;
+    EngineSchedule Schedule;
+    World Entities;
+
+    Rig()
+    {
+        SetUpPhysics(Entities);
+        RegisterPhysics(Schedule);
+        Schedule.Init();
+    }
+
+    PhysicsStepSystem& Step() { return *Schedule.Get<PhysicsStepSystem>(); }
+
+    void Tick(bool resimulating, std::span<const EntityId> predicted = {})
+    {
+        PhysicsContext context{
+            .Config = Config,
+            .Runtime = Runtime,
+            .Time = FixedSimTime{ .DeltaSeconds = kFixedDt },
+            .Entities = Entities,
+            .Partitions = ActivePartitions(),
+            .Resimulating = resimulating,
+            .Predicted = predicted,
+        };
+        Schedule.RunPhysics(context);
+    }
+};
+} // namespace
+
+TEST(PhysicsResimulation, ReplayedTicksLeaveANonPredictedBodyWhereItWas)
+{
+    Rig rig;
+    const EntityId crate = SpawnAt(rig.Entities, Vec3d(0.0f, 20.0f, 0.0f));
+    rig.Entities.AddComponent<Collider>(
+        crate, Collider{ CollisionShape::MakeBox(Vec3d(0.5f, 0.5f, 0.5f)) });
+    rig.Entities.AddComponent<RigidBody>(
+        crate, RigidBody{ BodyMotion::Dynamic, 1.0f, Vec3d::Zero(), 1.0f });
+
+    // Falling, so any extra step shows up as extra distance.
+    for (int tick = 0; tick < 4; ++tick)
+        rig.Tick(false);
+    const PhysicsBodyLink* link = rig.Entities.TryGet<PhysicsBodyLink>(crate);
+    ASSERT_NE(link, nullptr);
+    const Vec3d before = rig.Entities.TryGet<LocalTransform>(crate)->Value.Position;
+    const Vec3d backendBefore = rig.Step().GetSimulation().GetBodyTransform(link->Body).Position;
+    ASSERT_LT(before.Y, 20.0f);
+
+    for (int tick = 0; tick < kReplayedTicks; ++tick)
+        rig.Tick(true);
+
+    const Vec3d after = rig.Entities.TryGet<LocalTransform>(crate)->Value.Position;
+    const Vec3d backendAfter = rig.Step().GetSimulation().GetBodyTransform(link->Body).Position;
+    EXPECT_EQ(after.Y, before.Y);
+    EXPECT_EQ(backendAfter.Y, backendBefore.Y);
+
+    // A real tick still moves it.
+    rig.Tick(false);
+    EXPECT_LT(rig.Entities.TryGet<LocalTransform>(crate)->Value.Position.Y, before.Y);
+}
+
+TEST(PhysicsResimulation, ReplayedTicksDriveOnlyThePredictedCharacterFromItsRestoredPose)
+{
+    Rig rig;
+    const Vec3d velocity(3.0f, 0.0f, 0.0f);
+    const EntityId pawn = SpawnCharacter(rig.Entities, Vec3d(0.0f, 0.0f, 0.0f), velocity);
+    const EntityId other = SpawnCharacter(rig.Entities, Vec3d(0.0f, 0.0f, 10.0f), velocity);
+
+    for (int tick = 0; tick < 4; ++tick)
+        rig.Tick(false);
+    ASSERT_TRUE(rig.Entities.HasComponent<CharacterMoverLink>(pawn));
+    ASSERT_TRUE(rig.Entities.HasComponent<CharacterMoverLink>(other));
+    const Vec3d otherBefore = rig.Entities.TryGet<LocalTransform>(other)->Value.Position;
+
+    // Rollback put the pawn back where the authority had it; its mover still
+    // stands at the prediction.
+    const Vec3d restored(-5.0f, 0.0f, 0.0f);
+    rig.Entities.TryGet<LocalTransform>(pawn)->Value.Position = restored;
+
+    const EntityId predicted[] = { pawn };
+    for (int tick = 0; tick < kReplayedTicks; ++tick)
+        rig.Tick(true, predicted);
+
+    const Vec3d pawnAfter = rig.Entities.TryGet<LocalTransform>(pawn)->Value.Position;
+    EXPECT_NEAR(pawnAfter.X, restored.X + velocity.X * kFixedDt * kReplayedTicks, 0.05f);
+
+    const Vec3d otherAfter = rig.Entities.TryGet<LocalTransform>(other)->Value.Position;
+    EXPECT_EQ(otherAfter.X, otherBefore.X);
+    EXPECT_EQ(otherAfter.Z, otherBefore.Z);
+}
@@ -6,6 +6,8 @@
 
 #include <physics/PhysicsWorld.h>
 
+#include <vector>
+
 namespace
 {
 PhysicsBodyId AddFloor(PhysicsWorld& world)
@@ -114,6 +116,69 @@ TEST(PhysicsWorld, BodyCountTracksAddRemove)
     EXPECT_EQ(world.BodyCount(), 0u);
 }
 
+TEST(PhysicsWorld, AddBodiesInsertsABatchAndDefersTheBroadPhaseRebuild)
+{
+    PhysicsWorldConfig config;
+    config.BroadPhaseOptimizeBatch = 4;
+    PhysicsWorld world(config);
+    EXPECT_FALSE(world.BroadPhaseOptimizePending());
+
+    std::vector<BodyDesc> descs(4);
+    descs[0].Shape = CollisionShape::MakeBox(Vec3d(50.0f, 0.5f, 50.0f));
+    descs[0].Motion = BodyMotion::Static;
+    descs[0].Layer = CollisionLayer::Static;
+    for (size_t index = 1; index < descs.size(); ++index)
+    {
+        descs[index].Shape = CollisionShape::MakeSphere(0.5f);
+        descs[index].Position = Vec3d(static_cast<float>(index) * 2.0f, 5.0f, 0.0f);
+        descs[index].Motion = BodyMotion::Dynamic;
+        descs[index].Layer = CollisionLayer::Moving;
+        descs[index].UserData = index;
+    }
+
+    std::vector<PhysicsBodyId> ids(descs.size());
+    EXPECT_EQ(world.AddBodies(descs, ids), descs.size());
+    EXPECT_EQ(world.BodyCount(), 4u);
+    EXPECT_TRUE(world.BroadPhaseOptimizePending());
+
+    // Ids line up with their descs whatever order the insertion sorted into.
+    for (size_t index = 1; index < ids.size(); ++index)
+    {
+        ASSERT_TRUE(ids[index].IsValid());
+        EXPECT_EQ(world.GetUserData(ids[index]), index);
+        EXPECT_TRUE(world.IsBodyActive(ids[index]));
+    }
+    EXPECT_FALSE(world.IsBodyActive(ids[0]));
+
+    world.OptimizeBroadPhase();
+    EXPECT_FALSE(world.BroadPhaseOptimizePending());
+
+    for (int i = 0; i < 240; ++i)
+        world.Step(kFixedDt);
+    EXPECT_NEAR(world.GetBodyTransform(ids[2]).Position.Y, 1.0f, 0.05f);
+}
+
+TEST(PhysicsWorld, SmallAddBodiesBatchLeavesNoRebuildPending)
+{
+    PhysicsWorldConfig config;
+    config.BroadPhaseOptimizeBatch = 4;
+    PhysicsWorld world(config);
+
+    std::vector<BodyDesc> descs(3);
+    for (size_t index = 0; index < descs.size(); ++index)
+    {
+        descs[index].Shape = CollisionShape::MakeSphere(0.5f);
+        descs[index].Position = Vec3d(static_cast<float>(index) * 2.0f, 5.0f, 0.0f);
+        descs[index].Motion = BodyMotion::Dynamic;
+        descs[index].Layer = CollisionLayer::Moving;
+    }
+
+    std::vector<PhysicsBodyId> ids(descs.size());
+    EXPECT_EQ(world.AddBodies(descs, ids), descs.size());
+    EXPECT_EQ(world.BodyCount(), 3u);
+    EXPECT_FALSE(world.BroadPhaseOptimizePending());
+}
+
 TEST(PhysicsWorld, CarriesUserDataForQueryMapping)
 {
     PhysicsWorld world;
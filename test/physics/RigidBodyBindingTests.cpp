@@ -12,6 +12,8 @@
 #include <physics/components/RigidBody.h>
 #include <world/transform/TransformComponents.h>
 
+#include <vector>
+
 namespace
 {
 constexpr float kFixedDt = 1.0f / 60.0f;
@@ -370,6 +372,96 @@ TEST(RigidBodyBinding, StepSystemOwnsSingleSimulationBinding)
     EXPECT_FALSE(world.HasResource<RigidBodyBinding>());
 }
 
+TEST(RigidBodyBinding, ZoneOfCollidersAttachesInOneBatch)
+{
+    PhysicsWorld physics;
+    World ecs;
+    SetUpPhysics(ecs);
+    RigidBodyBinding binding(physics);
+
+    std::vector<EntityId> boxes;
+    for (int index = 0; index < 64; ++index)
+    {
+        const EntityId box = SpawnAt(
+            ecs,
+            Vec3d(static_cast<float>(index % 8) * 2.0f,
+                  0.0f,
+                  static_cast<float>(index / 8) * 2.0f));
+        ecs.AddComponent<Collider>(
+            box,
+            Collider{ CollisionShape::MakeBox(
+                Vec3d(0.5f, 0.5f, 0.5f)) });
+        boxes.push_back(box);
+    }
+    const EntityId ball = SpawnAt(ecs, Vec3d(0.0f, 3.0f, 0.0f));
+    ecs.AddComponent<Collider>(
+        ball,
+        Collider{ CollisionShape::MakeSphere(0.5f) });
+    ecs.AddComponent<RigidBody>(
+        ball,
+        RigidBody{
+            BodyMotion::Dynamic,
+            1.0f,
+            Vec3d(0.0f, 2.0f, 0.0f),
+            1.0f,
+        });
+
+    binding.SyncToPhysics(ecs, ActivePartitions());
+    EXPECT_EQ(binding.AttachedLastSync(), 65u);
+    EXPECT_EQ(binding.BodyCount(), 65u);
+    EXPECT_EQ(physics.BodyCount(), 65u);
+    for (const EntityId box : boxes)
+    {
+        const PhysicsBodyLink* link = ecs.TryGet<PhysicsBodyLink>(box);
+        ASSERT_NE(link, nullptr);
+        EXPECT_EQ(UnpackEntity(physics.GetUserData(link->Body)), box);
+    }
+    // Velocity still reaches a body that came in with the batch.
+    const PhysicsBodyLink* ballLink = ecs.TryGet<PhysicsBodyLink>(ball);
+    ASSERT_NE(ballLink, nullptr);
+    EXPECT_NEAR(physics.GetLinearVelocity(ballLink->Body).Y, 2.0f, 1e-4f);
+
+    binding.SyncToPhysics(ecs, ActivePartitions());
+    EXPECT_EQ(binding.AttachedLastSync(), 0u);
+}
+
+TEST(RigidBodyBinding, StepSystemRebuildsTheBroadPhaseOnAFrameThatAttachedNothing)
+{
+    EngineConfig config;
+    RuntimeFrameLoop runtime;
+    PhysicsStepSystem step;
+
+    World world;
+    SetUpPhysics(world);
+    // A zone-attach-sized batch: a smaller one leaves no rebuild owed.
+    const uint32_t batch = PhysicsWorldConfig{}.BroadPhaseOptimizeBatch;
+    for (uint32_t index = 0; index < batch; ++index)
+    {
+        const EntityId box = SpawnAt(
+            world,
+            Vec3d(static_cast<float>(index) * 2.0f, 0.0f, 0.0f));
+        world.AddComponent<Collider>(
+            box,
+            Collider{ CollisionShape::MakeBox(
+                Vec3d(0.5f, 0.5f, 0.5f)) });
+    }
+
+    PhysicsContext context{
+        .Config = config,
+        .Runtime = runtime,
+        .Time = FixedSimTime{},
+        .Entities = world,
+        .Partitions = ActivePartitions(),
+    };
+    step.Physics(context);
+    EXPECT_EQ(step.GetRigidBodies().AttachedLastSync(), batch);
+    EXPECT_TRUE(step.GetSimulation().BroadPhaseOptimizePending());
+
+    step.Physics(context);
+    EXPECT_EQ(step.GetRigidBodies().AttachedLastSync(), 0u);
+    EXPECT_FALSE(step.GetSimulation().BroadPhaseOptimizePending());
+}
+
 TEST(RigidBodyBinding, AngularStateRoundTripsThroughComponents)
 {
     PhysicsWorld physics;
@@ -21,6 +21,7 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
 #include <filesystem>
 #include <fstream>
 #include <memory>
@@ -246,6 +247,29 @@ TEST(AssetManifest, CollectFindsNestedUniquePathsInOrder)
     EXPECT_EQ(paths[1], "asset://materials/dev/red.smat");
 }
 
+TEST(AssetManifest, CollectFromTextMatchesTheDomWalk)
+{
+    const std::string_view text = R"({
+        "asset://keys/are/not.refs": "asset://meshes/dev/cube.smesh",
+        "nested": { "b": ["asset:\/\/materials/dev/red.smat", "not a path"],
+                    "c": "asset://meshes/dev/cube.smesh" },
+        "n": 7
+    })";
+    const std::optional<JsonValue> json = JsonParse(text);
+    ASSERT_TRUE(json.has_value());
+
+    std::vector<std::string> paths;
+    std::string error;
+    ASSERT_TRUE(CollectAssetPathsFromText(text, paths, &error)) << error;
+    EXPECT_EQ(paths, CollectAssetPaths(*json));
+    ASSERT_EQ(paths.size(), 2u);
+    EXPECT_EQ(paths[1], "asset://materials/dev/red.smat");
+
+    EXPECT_FALSE(CollectAssetPathsFromText(R"(["asset://a/b.smesh", )", paths, &error));
+    EXPECT_FALSE(error.empty());
+    EXPECT_EQ(paths.size(), 2u);
+}
+
 TEST(AssetManifest, JsonRoundTrip)
 {
     AssetManifest manifest;
@@ -363,6 +387,38 @@ TEST(AssetPreload, MaterialsStreamToResidencyHeadless)
     EXPECT_FALSE(h.Materials.Find(blue.Path).IsValid());
 }
 
+TEST(AssetPreload, FocusPriorityStagesAheadOfSpeculativeNeighbors)
+{
+    PreloadHarness h;
+    TempMaterialAsset neighbor(h.Registry, "neighbor");
+    TempMaterialAsset focus(h.Registry, "focus");
+
+    const std::vector<std::string> neighborPaths{ neighbor.Path };
+    const std::vector<std::string> focusPaths{ focus.Path };
+    auto speculative = h.Preloader.Begin(neighborPaths, AsyncTaskPriority::Low);
+    auto focused = h.Preloader.Begin(focusPaths, AsyncTaskPriority::High);
+
+    EXPECT_EQ(h.Tasks.PumpWork(1), 1u);
+    EXPECT_EQ(h.Tasks.DrainCompletions(), 1u);
+    EXPECT_TRUE(focused->IsComplete());
+    EXPECT_FALSE(speculative->IsComplete());
+
+    // The neighbor becomes the focus: a later preload no longer overtakes it.
+    TempMaterialAsset next(h.Registry, "next");
+    const std::vector<std::string> nextPaths{ next.Path };
+    auto queued = h.Preloader.Begin(nextPaths);
+    speculative->SetPriority(AsyncTaskPriority::High);
+
+    EXPECT_EQ(h.Tasks.PumpWork(1), 1u);
+    EXPECT_EQ(h.Tasks.DrainCompletions(), 1u);
+    EXPECT_TRUE(speculative->IsComplete());
+    EXPECT_FALSE(queued->IsComplete());
+
+    (void)h.Tasks.PumpWork();
+    (void)h.Tasks.DrainCompletions();
+    EXPECT_TRUE(queued->IsComplete());
+}
+
 TEST(AssetPreload, IndependentRootsStageTogether)
 {
     PreloadHarness h;
@@ -507,6 +563,66 @@ TEST(AssetPreload, TwoPreloadsCoalesceOnOneLoad)
     EXPECT_FALSE(h.Materials.Find(shared.Path).IsValid());
 }
 
+TEST(AssetPreload, CancelStopsLoadsNoOtherPreloadWants)
+{
+    PreloadHarness h;
+    TempAudioClipAsset blip(h.Registry, "blip");
+
+    const std::vector<std::string> paths{ blip.Path };
+    auto preload = h.Preloader.Begin(paths);
+    preload->Cancel();
+
+    // The load still runs and commits, but as a stopped staging: nothing is
+    // decoded, and the bookkeeping finishes as a failure.
+    (void)h.Tasks.PumpWork();
+    (void)h.Tasks.DrainCompletions();
+    EXPECT_TRUE(preload->IsComplete());
+    EXPECT_EQ(preload->FailureCount(), 1u);
+    EXPECT_FALSE(h.AudioClips.Find(blip.Path).IsValid());
+}
+
+TEST(AssetPreload, CancelKeepsALoadAnotherPreloadShares)
+{
+    PreloadHarness h;
+    TempAudioClipAsset blip(h.Registry, "blip");
+
+    const std::vector<std::string> paths{ blip.Path };
+    auto first = h.Preloader.Begin(paths);
+    auto second = h.Preloader.Begin(paths);
+    first->Cancel();
+
+    (void)h.Tasks.PumpWork();
+    (void)h.Tasks.DrainCompletions();
+    EXPECT_TRUE(second->IsComplete());
+    EXPECT_EQ(second->FailureCount(), 0u);
+    EXPECT_EQ(second->HeldHandleCount(), 1u);
+    EXPECT_EQ(first->HeldHandleCount(), 0u);
+    EXPECT_TRUE(h.AudioClips.Find(blip.Path).IsValid());
+}
+
+TEST(AssetPreload, CancelStopsTheDependencyLoadsOfAWaitingCommit)
+{
+    PreloadHarness h;
+    TempSkeletonAsset skeleton(h.Registry, "rig");
+    TempAnimationClipAsset clip(h.Registry, "walk", skeleton.Path);
+
+    const std::vector<std::string> paths{ clip.Path };
+    auto preload = h.Preloader.Begin(paths);
+
+    // The clip stages and waits on its skeleton; cancelling now stops the
+    // skeleton load the clip's commit asked for.
+    EXPECT_EQ(h.Tasks.PumpWork(), 1u);
+    EXPECT_EQ(h.Tasks.DrainCompletions(), 1u);
+    preload->Cancel();
+
+    (void)h.Tasks.PumpWork();
+    (void)h.Tasks.DrainCompletions();
+    EXPECT_TRUE(preload->IsComplete());
+    EXPECT_EQ(preload->FailureCount(), 1u);
+    EXPECT_FALSE(h.Skeletons.Find(skeleton.Path).IsValid());
+    EXPECT_FALSE(h.AnimationClips.Find(clip.Path).IsValid());
+}
+
 TEST(AssetPreload, AlreadyResidentAssetsCompleteImmediately)
 {
     PreloadHarness h;
@@ -528,6 +644,43 @@ TEST(AssetPreload, AlreadyResidentAssetsCompleteImmediately)
     h.Assets.ReleaseMaterial(existing);
 }
 
+TEST(AssetPreload, ReleasedAssetsParkWarmAndAPreloadTakesThemBackWithoutALoad)
+{
+    PreloadHarness h;
+    h.Assets.SetWarmCacheBudget({ .CpuBytes = 1024 * 1024, .GpuBytes = 0 });
+    TempAudioClipAsset clip(h.Registry, "warm");
+
+    const std::vector<std::string> paths{ clip.Path };
+    auto first = h.Preloader.Begin(paths);
+    EXPECT_EQ(h.Tasks.PumpWork(), 1u);
+    EXPECT_EQ(h.Tasks.DrainCompletions(), 1u);
+    ASSERT_TRUE(first->IsComplete());
+    first->ReleaseAll();
+
+    // No references left, but the clip is parked rather than freed.
+    EXPECT_TRUE(h.Assets.IsResident(clip.Path, AssetType::Audio));
+    EXPECT_EQ(h.Assets.GetWarmCacheStats(AssetType::Audio).ParkedEntries, 1u);
+
+    // With the file gone, only the warm entry can satisfy the second preload.
+    std::error_code ec;
+    std::filesystem::remove(clip.File, ec);
+
+    auto second = h.Preloader.Begin(paths);
+    EXPECT_TRUE(second->IsComplete());
+    EXPECT_EQ(second->FailureCount(), 0u);
+    EXPECT_EQ(second->HeldHandleCount(), 1u);
+    EXPECT_EQ(h.Tasks.PumpWork(), 0u);
+
+    const AssetWarmCacheStats stats = h.Assets.GetWarmCacheStats(AssetType::Audio);
+    EXPECT_EQ(stats.Hits, 1u);
+    EXPECT_EQ(stats.Misses, 1u);
+    EXPECT_EQ(stats.ParkedEntries, 0u);
+
+    second->ReleaseAll();
+    h.Assets.SetWarmCacheBudget({});
+    EXPECT_FALSE(h.Assets.IsResident(clip.Path, AssetType::Audio));
+}
+
 TEST(AssetPreload, MissingRecordsAndFilesCountAsFailuresNotDeadlocks)
 {
     PreloadHarness h;
@@ -628,6 +781,48 @@ TEST(ZoneAssetGating, AttachDefersUntilDependencyChainCompletes)
               TemporalDiscontinuityReason::ZoneLoad);
 }
 
+TEST(ZoneAssetGating, LoadDeadlineReachesTheZonesAssetLoads)
+{
+    ZoneHarness h;
+    TempMaterialAsset farMaterial(h.Registry, "far");
+    TempMaterialAsset nearMaterial(h.Registry, "near");
+
+    const std::vector<std::string> farPaths{ farMaterial.Path };
+    const std::vector<std::string> nearPaths{ nearMaterial.Path };
+    auto farPreload = h.Preloader.Begin(farPaths);
+    auto nearPreload = h.Preloader.Begin(nearPaths);
+
+    const ZoneId farZone{ 7 };
+    const ZoneId nearZone{ 8 };
+    (void)h.Loader.BeginLoad(farZone, [](ZoneLoadPackage&) {}, AsyncZoneLoader::FinalizeFn{},
+                             ZoneParticipation{ .Logic = true }, farPreload);
+    (void)h.Loader.BeginLoad(nearZone, [](ZoneLoadPackage&) {}, AsyncZoneLoader::FinalizeFn{},
+                             ZoneParticipation{ .Logic = true }, nearPreload);
+
+    // Equal priorities: the zone wanted sooner has its build and its assets
+    // taken first, though both were submitted last.
+    const auto now = std::chrono::steady_clock::now();
+    EXPECT_TRUE(h.Loader.SetLoadDeadline(nearZone, now + AsyncZoneLoader::FocusLeadTime));
+    EXPECT_EQ(nearPreload->GetDeadline(), now + AsyncZoneLoader::FocusLeadTime);
+    EXPECT_TRUE(h.Loader.SetLoadDeadline(farZone, now + AsyncZoneLoader::NeighborLeadTime));
+
+    // A later deadline never replaces an earlier one.
+    EXPECT_TRUE(h.Loader.SetLoadDeadline(nearZone, now + AsyncZoneLoader::PredictedLeadTime));
+    EXPECT_EQ(nearPreload->GetDeadline(), now + AsyncZoneLoader::FocusLeadTime);
+    EXPECT_FALSE(h.Loader.SetLoadDeadline(ZoneId{ 99 }, now));
+
+    EXPECT_EQ(h.Tasks.PumpWork(2), 2u);
+    (void)h.Tasks.DrainCompletions();
+    EXPECT_TRUE(h.World.IsZoneResident(nearZone));
+    EXPECT_TRUE(nearPreload->IsComplete());
+    EXPECT_FALSE(h.World.IsZoneResident(farZone));
+    EXPECT_FALSE(farPreload->IsComplete());
+
+    (void)h.Tasks.PumpWork();
+    (void)h.Tasks.DrainCompletions();
+    EXPECT_TRUE(h.World.IsZoneResident(farZone));
+}
+
 TEST(ZoneAssetGating, CompletePreloadAttachesInline)
 {
     ZoneHarness h;
@@ -704,3 +899,44 @@ TEST(AssetPreload, ThreadedSmoke)
     EXPECT_EQ(preload->HeldHandleCount(), 1u);
     preload->ReleaseAll();
 }
+
+TEST(AssetPreload, ThreadedSplitPoolsStageEveryAsset)
+{
+    using namespace std::chrono;
+    using namespace std::chrono_literals;
+
+    LoggingProvider logging;
+    AsyncTaskQueue tasks(2, 1);
+    AssetRegistry registry(logging);
+    MaterialCache materials;
+    AudioClipCache audioClips(logging);
+    AssetSystem assets(logging, registry, nullptr, &materials, nullptr, &audioClips);
+    AssetPreloader preloader(logging, registry, assets, tasks);
+
+    std::vector<std::unique_ptr<TempMaterialAsset>> materialAssets;
+    std::vector<std::unique_ptr<TempAudioClipAsset>> clipAssets;
+    std::vector<std::string> paths;
+    for (int i = 0; i < 24; ++i)
+    {
+        materialAssets.push_back(
+            std::make_unique<TempMaterialAsset>(registry, "split_" + std::to_string(i)));
+        clipAssets.push_back(
+            std::make_unique<TempAudioClipAsset>(registry, "split_" + std::to_string(i)));
+        paths.push_back(materialAssets.back()->Path);
+        paths.push_back(clipAssets.back()->Path);
+    }
+
+    auto preload = preloader.Begin(paths);
+
+    const auto deadline = steady_clock::now() + 10s;
+    while (!preload->IsComplete() && steady_clock::now() < deadline)
+    {
+        (void)tasks.DrainCompletions();
+        std::this_thread::sleep_for(1ms);
+    }
+
+    EXPECT_TRUE(preload->IsComplete());
+    EXPECT_EQ(preload->FailureCount(), 0u);
+    EXPECT_EQ(preload->HeldHandleCount(), paths.size());
+    preload->ReleaseAll();
+}
@@ -0,0 +1,421 @@
+// Evidence generator: resident memory of staging a zone's worth of textures and
+// meshes, under the copying read contract and the view contract that replaced
+// it (IAssetSource::ReadView). A preload holds every staged payload until the
+// owner thread drains it, so what a payload pins is what the preload's peak is
+// made of.
+//
+// Skipped unless SENCHA_ASSET_VIEW_BENCH_OUT names the output path (a .json is
+// written there and a .csv beside it), and on platforms without /proc. Run it
+// through scripts/bench_asset_views.sh; compare two runs with
+// scripts/bench_streaming_compare.py.
+//
+// Scenarios, over the same assets:
+//   loose_copy  the old contract, emulated: ReadBytes into a vector, .stex
+//               pixels copied into an owned blob, the vector dropped
+//   loose_view  the staged loaders against loose files: a pooled buffer the
+//               payload borrows
+//   pack_view   the staged loaders against a mapped .spak: raw entries the
+//               payload borrows from the mapping
+//
+// and, over a set of .smat files, LoadMaterialFromFile before and after it
+// moved onto ReadView:
+//   material_stream  the old path, emulated: ifstream into an ostringstream,
+//                    the string copied out of it and parsed
+//   material_view    LoadMaterialFromFile: a pooled ReadView buffer parsed in
+//                    place
+//
+// Per scenario:
+//   *_held_anon_mib   anonymous memory pinned once everything is staged and
+//                     before the drain: what the preload holds
+//   *_peak_rss_mib    the process high-water mark across stage and drain,
+//                     mapped pages included, above where the scenario began
+//   *_stage_ms        staging wall time for the whole set
+//
+// The material scenarios hold only the parsed descriptions, so they record
+// *_peak_rss_mib and *_stage_ms.
+//
+// The drain stands in for the GPU commit with a copy into one reused staging
+// buffer, which is what an upload does to the bytes.
+
+#include <gtest/gtest.h>
+
+#include "BenchRecorder.h"
+
+#include <assets/cook/AssetPackBuilder.h>
+#include <assets/material/MaterialLoader.h>
+#include <assets/static_mesh/MeshLoader.h>
+#include <assets/static_mesh/MeshSerializer.h>
+#include <assets/static_mesh/StaticMeshAssetLoader.h>
+#include <assets/texture/TextureAssetLoader.h>
+#include <assets/texture/TextureLoader.h>
+#include <assets/texture/TextureSerializer.h>
+#include <core/assets/AssetPackSource.h>
+#include <core/assets/AssetSource.h>
+#include <core/json/JsonParser.h>
+#include <core/json/JsonValue.h>
+#include <core/logging/LoggingProvider.h>
+#include <render/TextureData.h>
+#include <render/static_mesh/MeshValidation.h>
+#include <render/static_mesh/StaticMeshPrimitives.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+namespace fs = std::filesystem;
+
+Bench::Recorder Recorder;
+
+// A field of /proc/self/status, in KiB. Zero where there is no such file.
+double StatusKiB(const char* field)
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    const std::size_t length = std::strlen(field);
+    while (std::getline(status, line))
+    {
+        if (line.compare(0, length, field) == 0 && line.size() > length && line[length] == ':')
+            return std::atof(line.c_str() + length + 1);
+    }
+    return 0.0;
+}
+
+// Writing 5 to clear_refs resets VmHWM to the current RSS (Linux 4.0+), so
+// each scenario's peak is its own.
+void ResetPeakResident()
+{
+    std::ofstream("/proc/self/clear_refs") << "5";
+}
+
+double ToMiB(double kib)
+{
+    return kib / 1024.0;
+}
+
+TextureData MakeTexture(uint32_t size, uint32_t seed)
+{
+    TextureData texture;
+    texture.Format = TexturePixelFormat::RGBA8_SRGB;
+    texture.Usage = TextureUsage::BaseColor;
+    texture.Width = size;
+    texture.Height = size;
+
+    uint64_t offset = 0;
+    for (uint32_t w = size, h = size, level = 0; level < FullMipChainLength(size, size); ++level)
+    {
+        const uint64_t bytes = TextureMipByteSize(texture.Format, w, h);
+        texture.Mips.push_back(TextureMipLevel{ w, h, offset, bytes });
+        offset += bytes;
+        w = w > 1 ? w / 2 : 1;
+        h = h > 1 ? h / 2 : 1;
+    }
+    texture.Blob.resize(offset);
+    for (uint64_t i = 0; i < offset; ++i)
+        texture.Blob[i] = static_cast<uint8_t>(i * 131 + seed);
+    return texture;
+}
+
+// Copies of a cube laid out in a row, as one section: enough vertices that a
+// mesh weighs something, through the real serializer and validation.
+MeshGeometry MakeMesh(int copies)
+{
+    const MeshGeometry cube = StaticMeshPrimitives::BuildCube();
+    MeshGeometry mesh;
+    for (int copy = 0; copy < copies; ++copy)
+    {
+        const uint32_t base = static_cast<uint32_t>(mesh.Vertices.size());
+        for (StaticMeshVertex vertex : cube.Vertices)
+        {
+            vertex.Position.X += 2.0f * static_cast<float>(copy);
+            mesh.Vertices.push_back(vertex);
+        }
+        for (uint32_t index : cube.Indices)
+            mesh.Indices.push_back(base + index);
+    }
+
+    mesh.LocalBounds = ComputeMeshBounds(mesh.Vertices);
+
+    StaticMeshSection section;
+    section.IndexCount = static_cast<uint32_t>(mesh.Indices.size());
+    section.VertexCount = static_cast<uint32_t>(mesh.Vertices.size());
+    section.LocalBounds = mesh.LocalBounds;
+    mesh.Sections.push_back(section);
+    return mesh;
+}
+
+struct BenchAssets
+{
+    fs::path Root;
+    fs::path PackPath;
+    std::vector<AssetRecord> Loose;
+    std::vector<AssetRecord> Packed;
+};
+
+void WriteFile(const fs::path& path, const std::vector<std::byte>& bytes)
+{
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+}
+
+bool PrepareAssets(LoggingProvider& logging, int textures, uint32_t textureSize, int meshes,
+                   BenchAssets& out)
+{
+    out.Root = fs::temp_directory_path() / "sencha_asset_view_bench";
+    fs::remove_all(out.Root);
+    fs::create_directories(out.Root);
+    out.PackPath = out.Root / "zone.spak";
+
+    // Stored raw: BC and RGBA payloads are what a shipping pack leaves
+    // uncompressed, and raw entries are what the mapping can lend.
+    AssetPackBuildOptions options;
+    options.Compress = false;
+    AssetPackWriter writer(options);
+    if (!writer.Open(out.PackPath))
+        return false;
+
+    const auto add = [&](AssetType type, const std::string& name, const std::vector<std::byte>& bytes) {
+        const fs::path file = out.Root / name;
+        WriteFile(file, bytes);
+        const std::string path = "asset://bench/" + name;
+        out.Loose.push_back(AssetRecord{ .Type = type, .SourceKind = AssetSourceKind::File,
+                                         .Path = path, .FilePath = file.generic_string() });
+        out.Packed.push_back(AssetRecord{ .Type = type, .SourceKind = AssetSourceKind::File,
+                                          .Path = path });
+        return writer.Add(path, type, bytes);
+    };
+
+    std::vector<std::byte> bytes;
+    for (int i = 0; i < textures; ++i)
+    {
+        if (!WriteStexToBytes(MakeTexture(textureSize, static_cast<uint32_t>(i)), bytes)
+            || !add(AssetType::Texture, "t" + std::to_string(i) + ".stex", bytes))
+        {
+            return false;
+        }
+    }
+
+    MeshSerializer serializer(logging);
+    const MeshGeometry mesh = MakeMesh(2000);
+    for (int i = 0; i < meshes; ++i)
+    {
+        if (!serializer.WriteToBytes(mesh, bytes)
+            || !add(AssetType::StaticMesh, "m" + std::to_string(i) + ".smesh", bytes))
+        {
+            return false;
+        }
+    }
+    return writer.Finish();
+}
+
+enum class Contract
+{
+    Copy,
+    View,
+};
+
+void MeasureStaging(LoggingProvider& logging, const std::string& label, Contract contract,
+                    IAssetSource& source, const std::vector<AssetRecord>& records)
+{
+    TextureAssetLoader textureLoader(logging, nullptr);
+    StaticMeshAssetLoader meshLoader(logging, nullptr);
+    MeshLoader fileLoader(logging);
+
+    ResetPeakResident();
+    const double startAnon = StatusKiB("RssAnon");
+    const double startResident = StatusKiB("VmRSS");
+
+    std::vector<TextureData> textures;
+    std::vector<MeshGeometry> meshes;
+    const Bench::Clock::time_point stageStart = Bench::Clock::now();
+    for (const AssetRecord& record : records)
+    {
+        if (contract == Contract::Copy)
+        {
+            std::vector<std::byte> bytes;
+            ASSERT_TRUE(ReadAssetBytes(source, record, bytes));
+            if (record.Type == AssetType::Texture)
+            {
+                ASSERT_TRUE(LoadStexFromBytes(bytes, textures.emplace_back()));
+            }
+            else
+            {
+                ASSERT_TRUE(fileLoader.LoadFromBytes(bytes, meshes.emplace_back()));
+            }
+            continue;
+        }
+
+        if (record.Type == AssetType::Texture)
+        {
+            AssetStaging staged = textureLoader.LoadStaged(record, source);
+            ASSERT_TRUE(staged.IsValid()) << staged.Error;
+            textures.push_back(std::move(*std::any_cast<TextureData>(&staged.Payload)));
+        }
+        else
+        {
+            AssetStaging staged = meshLoader.LoadStaged(record, source);
+            ASSERT_TRUE(staged.IsValid()) << staged.Error;
+            meshes.push_back(std::move(*std::any_cast<MeshGeometry>(&staged.Payload)));
+        }
+    }
+    const double stageMs = Bench::MillisecondsSince(stageStart);
+    const double heldAnon = StatusKiB("RssAnon") - startAnon;
+
+    // The drain: every payload copied once into a reused staging buffer and
+    // released, as the commit's upload does.
+    std::vector<std::byte> staging;
+    uint64_t checksum = 0;
+    for (TextureData& texture : textures)
+    {
+        const std::span<const uint8_t> pixels = texture.Pixels();
+        staging.resize(std::max(staging.size(), pixels.size()));
+        std::memcpy(staging.data(), pixels.data(), pixels.size());
+        checksum += std::to_integer<uint64_t>(staging[pixels.size() / 2]);
+        texture = {};
+    }
+    for (MeshGeometry& mesh : meshes)
+    {
+        const std::size_t vertexBytes = mesh.Vertices.size() * sizeof(StaticMeshVertex);
+        staging.resize(std::max(staging.size(), vertexBytes));
+        std::memcpy(staging.data(), mesh.Vertices.data(), vertexBytes);
+        checksum += std::to_integer<uint64_t>(staging[vertexBytes / 2]);
+        mesh = {};
+    }
+    EXPECT_GT(checksum, 0u);
+
+    const double peakResident = StatusKiB("VmHWM") - startResident;
+    Recorder.Record(label + "_held_anon_mib", "mib", ToMiB(std::max(heldAnon, 0.0)));
+    Recorder.Record(label + "_peak_rss_mib", "mib", ToMiB(std::max(peakResident, 0.0)));
+    Recorder.Record(label + "_stage_ms", "ms", stageMs);
+}
+
+// Every material key the parser knows, with the texture slots filled: a
+// heavy-but-real .smat rather than the three-line dev materials.
+std::vector<fs::path> PrepareMaterials(const fs::path& root, int count)
+{
+    std::vector<fs::path> paths;
+    for (int i = 0; i < count; ++i)
+    {
+        const fs::path path = root / ("mat" + std::to_string(i) + ".smat");
+        std::ofstream out(path, std::ios::trunc);
+        out << "{\n"
+               "    \"version\": 2,\n"
+               "    \"shading\": \"standard_lit\",\n"
+               "    \"base_color_factor\": [1.0, 0.5, 0.25, 1.0],\n"
+               "    \"base_color_texture\": \"asset://bench/t" << i << "_albedo.png\",\n"
+               "    \"normal_texture\": \"asset://bench/t" << i << "_normal.png\",\n"
+               "    \"normal_scale\": 1.0,\n"
+               "    \"orm_texture\": \"asset://bench/t" << i << "_orm.png\",\n"
+               "    \"roughness_factor\": 0.6,\n"
+               "    \"metallic_factor\": 0.1,\n"
+               "    \"specular_factor\": 0.5,\n"
+               "    \"emissive_factor\": [0.0, 0.0, 0.0],\n"
+               "    \"emissive_texture\": \"asset://bench/t" << i << "_emissive.png\",\n"
+               "    \"emissive_strength\": 0.0,\n"
+               "    \"alpha_mode\": \"mask\",\n"
+               "    \"alpha_cutoff\": 0.5,\n"
+               "    \"double_sided\": false,\n"
+               "    \"receive_shadows\": true,\n"
+               "    \"cast_shadows\": true\n"
+               "}\n";
+        paths.push_back(path);
+    }
+    return paths;
+}
+
+// What LoadMaterialFromFile did before it read through IAssetSource.
+bool LoadMaterialThroughStream(const fs::path& path, MaterialDescription& out)
+{
+    std::ifstream file(path);
+    if (!file.is_open())
+        return false;
+    std::ostringstream buffer;
+    buffer << file.rdbuf();
+    const std::optional<JsonValue> root = JsonParse(buffer.str());
+    return root.has_value() && ParseMaterialJson(*root, out);
+}
+
+void MeasureMaterials(const std::string& label, Contract contract, const std::vector<fs::path>& paths)
+{
+    ResetPeakResident();
+    const double startResident = StatusKiB("VmRSS");
+
+    std::vector<MaterialDescription> materials;
+    materials.reserve(paths.size());
+    const Bench::Clock::time_point start = Bench::Clock::now();
+    for (const fs::path& path : paths)
+    {
+        MaterialDescription& desc = materials.emplace_back();
+        if (contract == Contract::Copy)
+        {
+            ASSERT_TRUE(LoadMaterialThroughStream(path, desc)) << path;
+        }
+        else
+        {
+            MaterialParseError error;
+            ASSERT_TRUE(LoadMaterialFromFile(path.generic_string(), desc, &error)) << error.Message;
+        }
+    }
+    const double stageMs = Bench::MillisecondsSince(start);
+
+    const double peakResident = StatusKiB("VmHWM") - startResident;
+    Recorder.Record(label + "_peak_rss_mib", "mib", ToMiB(std::max(peakResident, 0.0)));
+    Recorder.Record(label + "_stage_ms", "ms", stageMs);
+}
+}
+
+TEST(AssetViewBench, Generate)
+{
+    const char* outEnv = std::getenv("SENCHA_ASSET_VIEW_BENCH_OUT");
+    if (outEnv == nullptr)
+    {
+        GTEST_SKIP() << "set SENCHA_ASSET_VIEW_BENCH_OUT to record the asset view "
+                        "bench (use scripts/bench_asset_views.sh)";
+    }
+    if (!fs::exists("/proc/self/status"))
+        GTEST_SKIP() << "resident memory is read from /proc";
+
+    const fs::path jsonPath(outEnv);
+    if (jsonPath.has_parent_path() && !jsonPath.parent_path().empty())
+        fs::create_directories(jsonPath.parent_path());
+
+    Recorder.Clear();
+    LoggingProvider logging;
+
+    const int textures = Bench::RepsFromEnvironment("SENCHA_ASSET_VIEW_TEXTURES", 32);
+    const int meshes = Bench::RepsFromEnvironment("SENCHA_ASSET_VIEW_MESHES", 16);
+    BenchAssets assets;
+    ASSERT_TRUE(PrepareAssets(logging, textures, 1024, meshes, assets));
+
+    FileAssetSource files;
+    AssetPackSource pack;
+    std::string error;
+    ASSERT_TRUE(pack.Open(assets.PackPath.string(), &error)) << error;
+
+    // The copy first: the pool the view contract draws from starts empty.
+    MeasureStaging(logging, "loose_copy", Contract::Copy, files, assets.Loose);
+    MeasureStaging(logging, "pack_view", Contract::View, pack, assets.Packed);
+    MeasureStaging(logging, "loose_view", Contract::View, files, assets.Loose);
+
+    const int materialCount = Bench::RepsFromEnvironment("SENCHA_ASSET_VIEW_MATERIALS", 4096);
+    const std::vector<fs::path> materials = PrepareMaterials(assets.Root, materialCount);
+    MeasureMaterials("material_stream", Contract::Copy, materials);
+    MeasureMaterials("material_view", Contract::View, materials);
+
+    pack.Close();
+    std::error_code ec;
+    fs::remove_all(assets.Root, ec);
+
+    ASSERT_TRUE(Recorder.WriteJson(jsonPath));
+    fs::path csvPath = jsonPath;
+    csvPath.replace_extension(".csv");
+    ASSERT_TRUE(Recorder.WriteCsv(csvPath));
+}
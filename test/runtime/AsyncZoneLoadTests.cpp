@@ -8,10 +8,12 @@
 #include <world/serialization/ComponentSerializerRegistry.h>
 #include <world/serialization/SceneSerializationContext.h>
 #include <zone/AsyncZoneLoader.h>
+#include <zone/ZoneDemand.h>
 #include <zone/ZoneLoadPackage.h>
 
 #include <chrono>
 #include <thread>
+#include <vector>
 
 struct ZoneLoadMarker
 {
@@ -304,6 +306,201 @@ TEST(AsyncZoneLoad, CancelAfterWorkDropsTheImport)
     EXPECT_FALSE(loader.IsLoading(zone));
 }
 
+// A zero drain budget allows one turn per drain: the build's commit with its
+// first import slice, then one slice a drain. The zone stays hidden, and
+// loading, until the last.
+TEST(AsyncZoneLoad, LargeImportSpreadsOverBudgetedDrains)
+{
+    AsyncTaskQueue tasks(0);
+    const WorldComponentSchema schema = MakeSchema();
+    RuntimeWorld world(schema);
+    ComponentSerializerRegistry serializers;
+    LoggingProvider logging;
+    SceneSerializationContext sceneContext(logging);
+    RuntimeFrameLoop runtime;
+    AsyncZoneLoader loader(
+        tasks,
+        world,
+        schema,
+        serializers,
+        sceneContext,
+        runtime);
+    loader.SetImportSliceRows(4);
+
+    const ZoneId zone{ 9 };
+    bool finalized = false;
+    auto handle = loader.BeginLoad(
+        zone,
+        [](ZoneLoadPackage& package) { BuildTestZone(package, 10); },
+        [&](RuntimeWorld&, RuntimeZoneRecord&) {
+            finalized = true;
+            return true;
+        },
+        ZoneParticipation{ .Logic = true });
+    EXPECT_EQ(tasks.PumpWork(), 1u);
+
+    const AsyncDrainBudget oneTurn{ .MaxTime = std::chrono::steady_clock::duration::zero() };
+    EXPECT_EQ(tasks.DrainCompletions(oneTurn), 1u);
+    EXPECT_TRUE(tasks.IsComplete(handle));
+    ASSERT_NE(world.FindZone(zone), nullptr);
+    EXPECT_EQ(world.FindZone(zone)->State, RuntimeZoneLoadState::Importing);
+    EXPECT_TRUE(loader.IsLoading(zone));
+    EXPECT_TRUE(world.PendingResidencyChanges().empty());
+
+    EXPECT_EQ(tasks.DrainCompletions(oneTurn), 0u);
+    EXPECT_FALSE(world.IsZoneResident(zone));
+    EXPECT_FALSE(finalized);
+    EXPECT_EQ(world.Entities().EntityCount(), 8u);
+
+    EXPECT_EQ(tasks.DrainCompletions(oneTurn), 1u);
+    EXPECT_TRUE(finalized);
+    EXPECT_FALSE(loader.IsLoading(zone));
+    ASSERT_TRUE(world.IsZoneResident(zone));
+    EXPECT_EQ(CountMarkers(world, zone), 10u);
+    EXPECT_EQ(world.PendingResidencyChanges().size(), 1u);
+}
+
+TEST(AsyncZoneLoad, CancelBetweenImportSlicesDestroysThePartialZone)
+{
+    AsyncTaskQueue tasks(0);
+    const WorldComponentSchema schema = MakeSchema();
+    RuntimeWorld world(schema);
+    ComponentSerializerRegistry serializers;
+    LoggingProvider logging;
+    SceneSerializationContext sceneContext(logging);
+    RuntimeFrameLoop runtime;
+    AsyncZoneLoader loader(
+        tasks,
+        world,
+        schema,
+        serializers,
+        sceneContext,
+        runtime);
+    loader.SetImportSliceRows(4);
+
+    const ZoneId zone{ 10 };
+    const auto build = [](ZoneLoadPackage& package) { BuildTestZone(package, 10); };
+    loader.BeginLoad(zone, build);
+    EXPECT_EQ(tasks.PumpWork(), 1u);
+    EXPECT_EQ(tasks.DrainCompletions(
+                  AsyncDrainBudget{ .MaxTime = std::chrono::steady_clock::duration::zero() }),
+              1u);
+    ASSERT_NE(world.FindZone(zone), nullptr);
+
+    EXPECT_TRUE(loader.CancelLoad(zone));
+    EXPECT_FALSE(loader.IsLoading(zone));
+    EXPECT_EQ(world.FindZone(zone), nullptr);
+    EXPECT_EQ(world.Entities().EntityCount(), 0u);
+    EXPECT_EQ(tasks.DrainCompletions(), 0u);
+    EXPECT_EQ(loader.FindFailure(zone), nullptr);
+
+    // The zone is free to load again, whole.
+    loader.BeginLoad(zone, build);
+    EXPECT_EQ(tasks.PumpWork(), 1u);
+    EXPECT_EQ(tasks.DrainCompletions(), 2u);
+    ASSERT_TRUE(world.IsZoneResident(zone));
+    EXPECT_EQ(CountMarkers(world, zone), 10u);
+}
+
+// A large import does not hold the completion queue: another zone's build
+// commits between its slices, and the import carries its load's priority, so
+// the lowered speculative import waits for the needed one to publish.
+TEST(AsyncZoneLoad, ImportSlicesLetOtherCommitsRunAndKeepTheLoadPriority)
+{
+    AsyncTaskQueue tasks(0);
+    const WorldComponentSchema schema = MakeSchema();
+    RuntimeWorld world(schema);
+    ComponentSerializerRegistry serializers;
+    LoggingProvider logging;
+    SceneSerializationContext sceneContext(logging);
+    RuntimeFrameLoop runtime;
+    AsyncZoneLoader loader(
+        tasks,
+        world,
+        schema,
+        serializers,
+        sceneContext,
+        runtime);
+    loader.SetImportSliceRows(4);
+
+    const ZoneId needed{ 11 };
+    const ZoneId speculative{ 12 };
+    const auto build = [](ZoneLoadPackage& package) { BuildTestZone(package, 10); };
+    loader.BeginLoad(needed, build);
+    loader.BeginLoad(speculative, build);
+    EXPECT_TRUE(loader.SetLoadPriority(speculative, AsyncTaskPriority::Low));
+    EXPECT_EQ(tasks.PumpWork(), 2u);
+
+    const AsyncDrainBudget oneTurn{ .MaxTime = std::chrono::steady_clock::duration::zero() };
+    EXPECT_EQ(tasks.DrainCompletions(oneTurn), 1u);
+    ASSERT_NE(world.FindZone(needed), nullptr);
+    EXPECT_EQ(world.FindZone(speculative), nullptr);
+
+    // The speculative build's commit runs before the needed import's next slice.
+    EXPECT_EQ(tasks.DrainCompletions(oneTurn), 1u);
+    ASSERT_NE(world.FindZone(speculative), nullptr);
+    EXPECT_FALSE(world.IsZoneResident(needed));
+
+    EXPECT_EQ(tasks.DrainCompletions(oneTurn), 0u);
+    EXPECT_EQ(tasks.DrainCompletions(oneTurn), 1u);
+    EXPECT_TRUE(world.IsZoneResident(needed));
+    EXPECT_FALSE(world.IsZoneResident(speculative));
+
+    EXPECT_EQ(tasks.DrainCompletions(), 1u);
+    EXPECT_TRUE(world.IsZoneResident(speculative));
+    EXPECT_EQ(CountMarkers(world, speculative), 10u);
+}
+
+// The streaming policy lowers speculative loads; a lowered build waits behind
+// one submitted after it.
+TEST(AsyncZoneLoad, SetLoadPriorityReordersWaitingBuilds)
+{
+    AsyncTaskQueue tasks(0);
+    const WorldComponentSchema schema = MakeSchema();
+    RuntimeWorld world(schema);
+    ComponentSerializerRegistry serializers;
+    LoggingProvider logging;
+    SceneSerializationContext sceneContext(logging);
+    RuntimeFrameLoop runtime;
+    AsyncZoneLoader loader(
+        tasks,
+        world,
+        schema,
+        serializers,
+        sceneContext,
+        runtime);
+
+    const ZoneId speculative{ 6 };
+    const ZoneId needed{ 7 };
+    std::vector<ZoneId> built;
+    loader.BeginLoad(speculative, [&](ZoneLoadPackage&) { built.push_back(speculative); });
+    loader.BeginLoad(needed, [&](ZoneLoadPackage&) { built.push_back(needed); });
+
+    EXPECT_TRUE(loader.SetLoadPriority(speculative, AsyncTaskPriority::Low));
+    EXPECT_FALSE(loader.SetLoadPriority(ZoneId{ 99 }, AsyncTaskPriority::Low));
+    EXPECT_EQ(tasks.PumpWork(1), 1u);
+    ASSERT_EQ(built.size(), 1u);
+    EXPECT_EQ(built[0], needed);
+
+    EXPECT_EQ(tasks.PumpWork(), 1u);
+    tasks.DrainCompletions();
+    EXPECT_FALSE(loader.IsLoading(speculative));
+    EXPECT_FALSE(loader.SetLoadPriority(speculative, AsyncTaskPriority::High));
+}
+
+TEST(AsyncZoneLoad, LeadTimeFollowsTheMostUrgentDemandReason)
+{
+    ZoneDemandRecord record{ .Zone = ZoneId{ 3 } };
+    record.Reasons.push_back({ .Reason = ZoneDemandReason::Predicted });
+    EXPECT_EQ(AsyncZoneLoader::LoadLeadTime(record), AsyncZoneLoader::PredictedLeadTime);
+
+    record.Reasons.push_back({ .Reason = ZoneDemandReason::SameGraphHop });
+    EXPECT_EQ(AsyncZoneLoader::LoadLeadTime(record), AsyncZoneLoader::NeighborLeadTime);
+
+    record.Reasons.push_back({ .Reason = ZoneDemandReason::Focus });
+    EXPECT_EQ(AsyncZoneLoader::LoadLeadTime(record), AsyncZoneLoader::FocusLeadTime);
+}
+
 TEST(AsyncZoneLoad, ReloadAfterFinalDetachUsesFreshPartitionContent)
 {
     AsyncTaskQueue tasks(0);
@@ -0,0 +1,314 @@
+// Evidence generator: one cooked zone loaded through AsyncZoneLoader from each
+// form a cook can leave on disk, the stamped JSON the cook used to write and
+// the binary scene it writes now.
+//
+// Skipped unless SENCHA_COOKED_ZONE_LOAD_BENCH_OUT names the output path (a
+// .json is written there and a .csv beside it). Run it through
+// scripts/bench_cooked_zone_load.sh; compare two runs with
+// scripts/bench_streaming_compare.py.
+//
+// Both files come from the same assembled scene by WriteCookedScene's own
+// steps: StampAssetRefIds, then either JsonStringify or
+// TranscodeSceneJsonToBinary. The build callback reads the file and dispatches
+// on IsBinaryScene the way the game's BuildScenePackage does, so the load is
+// the streaming path end to end: file read and package build on the task, then
+// the sliced import and publication on the owner thread. Every entity has a
+// LocalTransform and a material handle drawn from a shared set; materials are
+// procedural, so resolution costs a lookup, not asset I/O.
+//
+// Per entity count (n10k, n50k):
+//   build_json_*_ms     median: file read, JsonParse and package build
+//   build_binary_*_ms   median: file read and package build
+//   load_json_*_ms      median: BeginLoad until the zone is resident
+//   load_binary_*_ms    the same for the binary file
+//   json_*_kib          size of the JSON file
+//   binary_*_kib        size of the binary file
+//   entities_*          entities in the zone (count)
+//   materials_*         distinct materials the zone references (count)
+
+#include <gtest/gtest.h>
+
+#include "BenchRecorder.h"
+
+#include <assets/runtime/AssetSystem.h>
+#include <core/assets/AssetIdMap.h>
+#include <core/assets/AssetRegistry.h>
+#include <core/json/JsonParser.h>
+#include <core/json/JsonStringify.h>
+#include <core/logging/LoggingProvider.h>
+#include <core/serialization/BinaryWriter.h>
+#include <ecs/WorldComponentSchema.h>
+#include <jobs/AsyncTaskQueue.h>
+#include <math/MathSchemas.h>
+#include <render/MaterialCache.h>
+#include <runtime/RuntimeFrameLoop.h>
+#include <world/RuntimeWorld.h>
+#include <world/registry/Registry.h>
+#include <world/serialization/ComponentSerializer.h>
+#include <world/serialization/ComponentSerializerRegistry.h>
+#include <world/serialization/SceneSerializationContext.h>
+#include <world/serialization/SceneSerializer.h>
+#include <world/transform/TransformComponents.h>
+#include <zone/AsyncZoneLoader.h>
+#include <zone/ZoneLoadPackage.h>
+#include <zone/ZonePackageSceneLoader.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <span>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+struct CookedZoneBenchMaterial
+{
+    MaterialHandle Material;
+};
+
+SENCHA_DECLARE_COMPONENT_TYPE(CookedZoneBenchMaterial, "test.cooked_zone_bench_material");
+
+template <>
+struct TypeSchema<CookedZoneBenchMaterial>
+{
+    static constexpr std::string_view Name = "cooked_zone_bench_material";
+    static constexpr std::uint32_t SceneChunkId = MakeFourCC('C', 'Z', 'B', 'M');
+
+    static auto Fields()
+    {
+        return std::tuple{
+            MakeField("material", &CookedZoneBenchMaterial::Material),
+        };
+    }
+};
+
+namespace
+{
+namespace fs = std::filesystem;
+
+Bench::Recorder Recorder;
+
+constexpr int kMaterials = 256;
+
+struct BenchAssets
+{
+    LoggingProvider Logging;
+    AssetRegistry Registry{ Logging };
+    MaterialCache Materials;
+    AssetSystem Assets{ Logging, Registry, nullptr, &Materials };
+    std::vector<MaterialHandle> Handles;
+};
+
+ComponentSerializerRegistry BenchSerializers()
+{
+    ComponentSerializerRegistry serializers;
+    RegisterComponent<LocalTransform>(serializers);
+    EXPECT_EQ(serializers.Register(std::make_unique<ComponentSerializer<CookedZoneBenchMaterial>>()),
+              ComponentSerializerRegistry::RegisterResult::Added);
+    return serializers;
+}
+
+WorldComponentSchema BenchSchema()
+{
+    WorldComponentSchema schema;
+    schema.Add<LocalTransform>();
+    schema.Add<WorldTransform>();
+    schema.Add<CookedZoneBenchMaterial>();
+    schema.Seal();
+    return schema;
+}
+
+std::string ReadFile(const fs::path& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    std::ostringstream buffer;
+    buffer << file.rdbuf();
+    return std::move(buffer).str();
+}
+
+// Writes the scene as the cook would have (stamped JSON) and as it does
+// (binary), returning the two paths.
+std::pair<fs::path, fs::path> WriteCookedForms(const fs::path& dir,
+                                               const std::string& label,
+                                               int entities,
+                                               BenchAssets& assets,
+                                               const ComponentSerializerRegistry& serializers)
+{
+    Registry source;
+    source.Components.RegisterComponent<LocalTransform>();
+    source.Components.RegisterComponent<CookedZoneBenchMaterial>();
+    for (int i = 0; i < entities; ++i)
+    {
+        const EntityId entity = source.Components.CreateEntity();
+        source.Components.AddComponent(entity, LocalTransform{ Transform3f(
+            Vec3d(static_cast<float>(i % 100), 0.0f, static_cast<float>(i / 100)),
+            Quatf::Identity(),
+            Vec3d(1.0f, 1.0f, 1.0f)) });
+        source.Components.AddComponent(
+            entity, CookedZoneBenchMaterial{ .Material = assets.Handles[i % kMaterials] });
+    }
+
+    SceneSerializationContext context(assets.Logging, &assets.Assets);
+    const JsonValue assembled = SaveSceneJson(source, serializers, context);
+
+    AssetIdMap idMap;
+    for (int i = 0; i < kMaterials; ++i)
+        (void)idMap.EnsureId("asset://materials/bench/m" + std::to_string(i) + ".smat",
+                             static_cast<std::uint64_t>(i + 1));
+    (void)ApplyAssetIds(idMap, assets.Registry);
+    const JsonValue stamped = StampAssetRefIds(assembled, idMap);
+
+    const fs::path jsonPath = dir / (label + ".json.cooked.json");
+    std::ofstream(jsonPath, std::ios::binary | std::ios::trunc) << JsonStringify(stamped);
+
+    const fs::path binaryPath = dir / (label + ".binary.cooked.sscn");
+    std::ofstream binaryFile(binaryPath, std::ios::binary | std::ios::trunc);
+    BinaryWriter writer(binaryFile);
+    SceneSaveError error;
+    EXPECT_TRUE(TranscodeSceneJsonToBinary(stamped, serializers, writer, assets.Logging, &error))
+        << error.Message;
+
+    return { jsonPath, binaryPath };
+}
+
+struct LoadResult
+{
+    double BuildMs = 0.0;
+    double LoadMs = 0.0;
+};
+
+LoadResult LoadZone(const fs::path& path,
+                    const WorldComponentSchema& schema,
+                    const ComponentSerializerRegistry& serializers,
+                    BenchAssets& assets,
+                    int entities)
+{
+    AsyncTaskQueue tasks(0);
+    RuntimeWorld world(schema);
+    SceneSerializationContext sceneContext(assets.Logging, &assets.Assets);
+    RuntimeFrameLoop frameLoop;
+    AsyncZoneLoader loader(tasks, world, schema, serializers, sceneContext, frameLoop);
+
+    const ZoneId zone{ 0x600u };
+    LoadResult result;
+    bool built = false;
+    std::string buildError;
+    const Bench::Clock::time_point start = Bench::Clock::now();
+    loader.BeginLoad(zone, [&](ZoneLoadPackage& package)
+    {
+        const Bench::Clock::time_point buildStart = Bench::Clock::now();
+        const std::string contents = ReadFile(path);
+        const std::span<const std::byte> bytes =
+            std::as_bytes(std::span(contents.data(), contents.size()));
+        SceneLoadError error;
+        if (IsBinaryScene(bytes))
+        {
+            built = BuildZonePackageFromSceneBinary(bytes, serializers, package, &error);
+        }
+        else
+        {
+            const std::optional<JsonValue> json = JsonParse(contents);
+            built = json.has_value()
+                && BuildZonePackageFromSceneJson(*json, serializers, package, &error);
+        }
+        buildError = error.Message;
+        result.BuildMs = Bench::MillisecondsSince(buildStart);
+    });
+    (void)tasks.PumpWork();
+
+    while (!world.IsZoneResident(zone) && loader.IsLoading(zone))
+    {
+        (void)tasks.DrainCompletions();
+        world.FlushLifecycleRequests();
+        (void)world.BeginResidencyProcessing();
+        world.FinalizeResidencyProcessing();
+    }
+    result.LoadMs = Bench::MillisecondsSince(start);
+
+    EXPECT_TRUE(built) << path.generic_string() << ": " << buildError;
+    EXPECT_TRUE(world.IsZoneResident(zone)) << path.generic_string();
+    EXPECT_EQ(world.Entities().GetAliveEntities().size(), static_cast<std::size_t>(entities));
+    return result;
+}
+
+void MeasureZone(const fs::path& dir, const std::string& label, int entities, int reps)
+{
+    const ComponentSerializerRegistry serializers = BenchSerializers();
+    const WorldComponentSchema schema = BenchSchema();
+
+    BenchAssets assets;
+    for (int i = 0; i < kMaterials; ++i)
+    {
+        assets.Handles.push_back(assets.Assets.RegisterProceduralMaterial(
+            "asset://materials/bench/m" + std::to_string(i) + ".smat",
+            Material{ .Pass = ShaderPassId::ForwardOpaque }));
+        ASSERT_TRUE(assets.Handles.back().IsValid());
+    }
+
+    const auto [jsonPath, binaryPath] = WriteCookedForms(dir, label, entities, assets, serializers);
+    const std::string binaryBytes = ReadFile(binaryPath);
+    ASSERT_TRUE(IsBinaryScene(std::as_bytes(std::span(binaryBytes.data(), binaryBytes.size()))));
+
+    std::vector<double> jsonBuilds;
+    std::vector<double> binaryBuilds;
+    std::vector<double> jsonLoads;
+    std::vector<double> binaryLoads;
+    // The first pass of each only warms the caches.
+    for (int rep = 0; rep <= reps; ++rep)
+    {
+        const LoadResult json = LoadZone(jsonPath, schema, serializers, assets, entities);
+        const LoadResult binary = LoadZone(binaryPath, schema, serializers, assets, entities);
+        if (rep == 0)
+            continue;
+        jsonBuilds.push_back(json.BuildMs);
+        jsonLoads.push_back(json.LoadMs);
+        binaryBuilds.push_back(binary.BuildMs);
+        binaryLoads.push_back(binary.LoadMs);
+    }
+
+    Recorder.Record("entities_" + label, "count", static_cast<double>(entities));
+    Recorder.Record("materials_" + label, "count", static_cast<double>(kMaterials));
+    Recorder.Record("build_json_" + label + "_ms", "ms", Bench::Median(jsonBuilds));
+    Recorder.Record("build_binary_" + label + "_ms", "ms", Bench::Median(binaryBuilds));
+    Recorder.Record("load_json_" + label + "_ms", "ms", Bench::Median(jsonLoads));
+    Recorder.Record("load_binary_" + label + "_ms", "ms", Bench::Median(binaryLoads));
+    Recorder.Record("json_" + label + "_kib", "kib",
+                    static_cast<double>(fs::file_size(jsonPath)) / 1024.0);
+    Recorder.Record("binary_" + label + "_kib", "kib",
+                    static_cast<double>(fs::file_size(binaryPath)) / 1024.0);
+}
+}
+
+TEST(CookedZoneLoadBench, Generate)
+{
+    const char* outEnv = std::getenv("SENCHA_COOKED_ZONE_LOAD_BENCH_OUT");
+    if (outEnv == nullptr)
+    {
+        GTEST_SKIP() << "set SENCHA_COOKED_ZONE_LOAD_BENCH_OUT to record the cooked "
+                        "zone load bench (use scripts/bench_cooked_zone_load.sh)";
+    }
+
+    const fs::path jsonPath(outEnv);
+    if (jsonPath.has_parent_path() && !jsonPath.parent_path().empty())
+        fs::create_directories(jsonPath.parent_path());
+
+    const fs::path scratch = fs::temp_directory_path() / "sencha_cooked_zone_load_bench";
+    fs::remove_all(scratch);
+    fs::create_directories(scratch);
+
+    Recorder.Clear();
+    const int reps = Bench::RepsFromEnvironment("SENCHA_COOKED_ZONE_LOAD_REPS", 3);
+    MeasureZone(scratch, "n10k", 10000, reps);
+    MeasureZone(scratch, "n50k", 50000, reps);
+    fs::remove_all(scratch);
+
+    ASSERT_TRUE(Recorder.WriteJson(jsonPath));
+    fs::path csvPath = jsonPath;
+    csvPath.replace_extension(".csv");
+    ASSERT_TRUE(Recorder.WriteCsv(csvPath));
+}
@@ -0,0 +1,225 @@
+// Evidence generator: what reading a large JSON document costs through each of
+// the three front ends over JsonReader — the JsonValue DOM, the arena-backed
+// JsonDocument, and the reader walked directly.
+//
+// Skipped unless SENCHA_JSON_PARSE_BENCH_OUT names the output path (a .json is
+// written there and a .csv beside it). Run it through
+// scripts/bench_json_parse.sh; compare two runs with
+// scripts/bench_streaming_compare.py.
+//
+// The input is a synthetic world manifest about 20 MB long, pretty-printed
+// the way the cook writes one: an array of zone records (id, bounds, scene
+// ref, neighbours, an escaped display name) and a zone-id index object with a
+// member per zone.
+//
+// Metrics:
+//   manifest_bytes            size of the document (count)
+//   manifest_nodes            values in it (count)
+//   dom_parse_ms              median JsonParse
+//   document_parse_ms         median JsonDocument::Parse
+//   reader_scan_ms            median walk of every token through JsonReader
+//   collect_paths_dom_ms      median JsonParse then CollectAssetPaths
+//   collect_paths_text_ms     median CollectAssetPathsFromText
+//   index_lookup_dom_ms       median of kLookups JsonValue::Find on the index
+//   index_lookup_document_ms  median of the same lookups on the hashed node
+//   control_memory_stream_ms  the compare script's drift yardstick
+
+#include <gtest/gtest.h>
+
+#include "BenchRecorder.h"
+
+#include <core/assets/AssetManifest.h>
+#include <core/json/JsonDocument.h>
+#include <core/json/JsonParser.h>
+#include <core/json/JsonReader.h>
+#include <core/json/JsonStringify.h>
+
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace
+{
+namespace fs = std::filesystem;
+
+Bench::Recorder Recorder;
+
+constexpr int kZones = 40000;
+constexpr int kLookups = 2000;
+
+std::string ZoneKey(int zone)
+{
+    return "zone_" + std::to_string(zone);
+}
+
+JsonValue Vec3(double x, double y, double z)
+{
+    return JsonValue(JsonValue::Array{ JsonValue(x), JsonValue(y), JsonValue(z) });
+}
+
+std::string BuildManifest()
+{
+    JsonValue::Array zones;
+    JsonValue::Object index;
+    zones.reserve(kZones);
+    index.reserve(kZones);
+    for (int zone = 0; zone < kZones; ++zone)
+    {
+        const double x = (zone % 200) * 64.0;
+        const double z = (zone / 200) * 64.0;
+
+        JsonValue::Object bounds;
+        bounds.emplace_back("min", Vec3(x, -16.0, z));
+        bounds.emplace_back("max", Vec3(x + 64.0, 48.5, z + 64.0));
+
+        JsonValue::Array neighbours;
+        for (const int offset : { -200, -1, 1, 200 })
+            if (zone + offset >= 0 && zone + offset < kZones)
+                neighbours.emplace_back(ZoneKey(zone + offset));
+
+        JsonValue::Object record;
+        record.emplace_back("id", JsonValue(ZoneKey(zone)));
+        record.emplace_back("name", JsonValue("Sector \"" + std::to_string(zone) + "\"\tstreamed"));
+        record.emplace_back("scene", JsonValue("asset://zones/" + ZoneKey(zone) + ".sscene"));
+        record.emplace_back("bounds", JsonValue(std::move(bounds)));
+        record.emplace_back("neighbours", JsonValue(std::move(neighbours)));
+        record.emplace_back("streamed", JsonValue(zone % 3 != 0));
+        record.emplace_back("priority", JsonValue(static_cast<double>(zone % 7) * 0.125));
+        zones.emplace_back(std::move(record));
+
+        index.emplace_back(ZoneKey(zone), JsonValue(static_cast<double>(zone)));
+    }
+
+    JsonValue::Object root;
+    root.emplace_back("version", JsonValue(3));
+    root.emplace_back("zones", JsonValue(std::move(zones)));
+    root.emplace_back("index", JsonValue(std::move(index)));
+    return JsonStringify(JsonValue(std::move(root)), /*pretty*/ true);
+}
+
+template<typename Body>
+double MedianOf(int reps, Body&& body)
+{
+    std::vector<double> samples;
+    // The first pass only warms the allocator and caches.
+    for (int rep = 0; rep <= reps; ++rep)
+    {
+        const Bench::Clock::time_point start = Bench::Clock::now();
+        body();
+        const double elapsed = Bench::MillisecondsSince(start);
+        if (rep > 0)
+            samples.push_back(elapsed);
+    }
+    return Bench::Median(samples);
+}
+
+void MeasureParse(const std::string& text, int reps)
+{
+    Recorder.Record("manifest_bytes", "count", static_cast<double>(text.size()));
+
+    Recorder.Record("dom_parse_ms", "ms", MedianOf(reps, [&] {
+        const std::optional<JsonValue> value = JsonParse(text);
+        ASSERT_TRUE(value.has_value());
+    }));
+
+    std::size_t nodes = 0;
+    Recorder.Record("document_parse_ms", "ms", MedianOf(reps, [&] {
+        const std::optional<JsonDocument> document = JsonDocument::Parse(text);
+        ASSERT_TRUE(document.has_value());
+        nodes = document->NodeCount();
+    }));
+    Recorder.Record("manifest_nodes", "count", static_cast<double>(nodes));
+
+    Recorder.Record("reader_scan_ms", "ms", MedianOf(reps, [&] {
+        JsonReader reader(text);
+        std::size_t tokens = 0;
+        JsonToken token;
+        while ((token = reader.Next()) != JsonToken::End)
+        {
+            ASSERT_NE(token, JsonToken::Error);
+            ++tokens;
+        }
+        EXPECT_GT(tokens, nodes);
+    }));
+
+    Recorder.Record("collect_paths_dom_ms", "ms", MedianOf(reps, [&] {
+        const std::optional<JsonValue> value = JsonParse(text);
+        ASSERT_TRUE(value.has_value());
+        EXPECT_EQ(CollectAssetPaths(*value).size(), static_cast<std::size_t>(kZones));
+    }));
+
+    Recorder.Record("collect_paths_text_ms", "ms", MedianOf(reps, [&] {
+        std::vector<std::string> paths;
+        ASSERT_TRUE(CollectAssetPathsFromText(text, paths));
+        EXPECT_EQ(paths.size(), static_cast<std::size_t>(kZones));
+    }));
+}
+
+void MeasureLookup(const std::string& text, int reps)
+{
+    std::vector<std::string> keys;
+    keys.reserve(kLookups);
+    for (int lookup = 0; lookup < kLookups; ++lookup)
+        keys.push_back(ZoneKey((lookup * 7919) % kZones));
+
+    const std::optional<JsonValue> value = JsonParse(text);
+    const std::optional<JsonDocument> document = JsonDocument::Parse(text);
+    ASSERT_TRUE(value.has_value());
+    ASSERT_TRUE(document.has_value());
+    const JsonValue& valueIndex = *value->Find("index");
+    const JsonNode documentIndex = document->Root().Find("index");
+
+    double sum = 0.0;
+    Recorder.Record("index_lookup_dom_ms", "ms", MedianOf(reps, [&] {
+        for (const std::string& key : keys)
+            sum += valueIndex.Find(key)->AsNumber();
+    }));
+    Recorder.Record("index_lookup_document_ms", "ms", MedianOf(reps, [&] {
+        for (const std::string& key : keys)
+            sum -= documentIndex.Find(key).AsNumber();
+    }));
+    EXPECT_EQ(sum, 0.0);
+}
+
+// Touches no engine code, so a change in it is a change in the machine, not
+// the build.
+void MeasureControl(int reps)
+{
+    constexpr std::size_t kBytes = 20u * 1024u * 1024u;
+    std::vector<unsigned char> buffer(kBytes, 1);
+    Recorder.Record("control_memory_stream_ms", "ms", MedianOf(reps, [&] {
+        unsigned long long sum = 0;
+        for (std::size_t index = 0; index < kBytes; index += 64)
+            sum += buffer[index];
+        if (sum == 0)
+            std::abort();
+    }));
+}
+}
+
+TEST(JsonParseBench, Generate)
+{
+    const char* outEnv = std::getenv("SENCHA_JSON_PARSE_BENCH_OUT");
+    if (outEnv == nullptr)
+    {
+        GTEST_SKIP() << "set SENCHA_JSON_PARSE_BENCH_OUT to record the JSON parse "
+                        "bench (use scripts/bench_json_parse.sh)";
+    }
+
+    const fs::path jsonPath(outEnv);
+    if (jsonPath.has_parent_path() && !jsonPath.parent_path().empty())
+        fs::create_directories(jsonPath.parent_path());
+
+    Recorder.Clear();
+    const int reps = Bench::RepsFromEnvironment("SENCHA_JSON_PARSE_REPS", 5);
+    const std::string manifest = BuildManifest();
+    MeasureControl(reps);
+    MeasureParse(manifest, reps);
+    MeasureLookup(manifest, reps);
+
+    ASSERT_TRUE(Recorder.WriteJson(jsonPath));
+    fs::path csvPath = jsonPath;
+    csvPath.replace_extension(".csv");
+    ASSERT_TRUE(Recorder.WriteCsv(csvPath));
+}
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+
+#include <render/static_mesh/MeshletCulling.h>
+
+#include <vector>
+
+namespace
+{
+    // A camera at the origin looking down -Z.
+    const Mat4 kView = Mat4::MakeLookAt(Vec3d(0.0f, 0.0f, 0.0f), Vec3d(0.0f, 0.0f, -1.0f),
+                                        Vec3d(0.0f, 1.0f, 0.0f));
+    const Mat4 kPerspective = Mat4::MakePerspective(1.2f, 1.0f, 0.1f, 100.0f);
+    const Mat4 kOrthographic = Mat4::MakeOrthographic(-20.0f, 20.0f, -20.0f, 20.0f, 0.1f, 100.0f);
+
+    StaticMeshMeshlet MakeMeshlet(Vec3d center, Vec3d axis = Vec3d(0.0f, 0.0f, 1.0f), float cutoff = 0.9f)
+    {
+        return StaticMeshMeshlet{
+            .IndexOffset = 0,
+            .IndexCount = 3,
+            .Center = center,
+            .Radius = 1.0f,
+            .ConeAxis = axis,
+            .ConeCutoff = cutoff,
+        };
+    }
+}
+
+TEST(MeshletCulling, FrustumRejectsMeshletsOutsideTheView)
+{
+    const MeshletCullView view = MakeMeshletCullView(kPerspective * kView, Mat4::Identity());
+    EXPECT_FALSE(view.CullBackfaces);
+
+    EXPECT_TRUE(IsMeshletVisible(MakeMeshlet(Vec3d(0.0f, 0.0f, -10.0f)), view));
+    EXPECT_FALSE(IsMeshletVisible(MakeMeshlet(Vec3d(0.0f, 0.0f, 10.0f)), view));
+    EXPECT_FALSE(IsMeshletVisible(MakeMeshlet(Vec3d(50.0f, 0.0f, -10.0f)), view));
+    EXPECT_FALSE(IsMeshletVisible(MakeMeshlet(Vec3d(0.0f, 0.0f, -200.0f)), view));
+    // A sphere straddling a plane stays.
+    EXPECT_TRUE(IsMeshletVisible(MakeMeshlet(Vec3d(0.0f, 0.0f, 0.5f)), view));
+}
+
+TEST(MeshletCulling, WorldMatrixCarriesTheTestIntoLocalSpace)
+{
+    const StaticMeshMeshlet meshlet = MakeMeshlet(Vec3d(0.0f, 0.0f, 0.0f));
+    const Mat4 inFront = Mat4::MakeTranslation(0.0f, 0.0f, -10.0f);
+    const Mat4 behind = Mat4::MakeTranslation(0.0f, 0.0f, 10.0f);
+
+    EXPECT_TRUE(IsMeshletVisible(meshlet, MakeMeshletCullView(kView, kPerspective, inFront)));
+    EXPECT_FALSE(IsMeshletVisible(meshlet, MakeMeshletCullView(kView, kPerspective, behind)));
+
+    // Turned half a revolution, a cone that faced the camera faces away.
+    const Mat4 turned = inFront * Mat4::MakeRotationY(3.14159265f);
+    EXPECT_FALSE(IsMeshletVisible(meshlet, MakeMeshletCullView(kView, kPerspective, turned)));
+}
+
+TEST(MeshletCulling, BackfaceConeRejectsOnlyMeshletsWhollyFacingAway)
+{
+    const MeshletCullView view = MakeMeshletCullView(kView, kPerspective, Mat4::Identity());
+    ASSERT_TRUE(view.CullBackfaces);
+    EXPECT_FALSE(view.Orthographic);
+    const Vec3d ahead(0.0f, 0.0f, -10.0f);
+
+    // Facing the camera, and facing away.
+    EXPECT_TRUE(IsMeshletVisible(MakeMeshlet(ahead, Vec3d(0.0f, 0.0f, 1.0f)), view));
+    EXPECT_FALSE(IsMeshletVisible(MakeMeshlet(ahead, Vec3d(0.0f, 0.0f, -1.0f)), view));
+    // Edge-on: some triangles may face the eye.
+    EXPECT_TRUE(IsMeshletVisible(MakeMeshlet(ahead, Vec3d(1.0f, 0.0f, 0.0f)), view));
+    // Facing away, but spread too wide to promise every triangle does.
+    EXPECT_TRUE(IsMeshletVisible(MakeMeshlet(ahead, Vec3d(0.0f, 0.0f, -1.0f), 0.05f), view));
+    // No cone at all.
+    EXPECT_TRUE(IsMeshletVisible(MakeMeshlet(ahead, Vec3d(0.0f, 0.0f, -1.0f), -1.0f), view));
+
+    // Close enough that the sphere subtends most of the view: the eye sees
+    // some of it from the side, so the cone no longer proves anything.
+    EXPECT_TRUE(IsMeshletVisible(MakeMeshlet(Vec3d(0.0f, 0.0f, -1.1f), Vec3d(0.0f, 0.0f, -1.0f)), view));
+}
+
+TEST(MeshletCulling, OrthographicViewsTestAgainstTheViewDirection)
+{
+    const MeshletCullView view = MakeMeshletCullView(kView, kOrthographic, Mat4::Identity());
+    ASSERT_TRUE(view.CullBackfaces);
+    EXPECT_TRUE(view.Orthographic);
+
+    // Off to the side, a perspective eye would see this meshlet's cone at an
+    // angle; an orthographic one looks straight down -Z at it.
+    const Vec3d aside(15.0f, 0.0f, -10.0f);
+    EXPECT_FALSE(IsMeshletVisible(MakeMeshlet(aside, Vec3d(0.0f, 0.0f, -1.0f)), view));
+    EXPECT_TRUE(IsMeshletVisible(MakeMeshlet(aside, Vec3d(0.0f, 0.0f, 1.0f)), view));
+}
+
+TEST(MeshletCulling, MirroringTransformsKeepBackFaces)
+{
+    const Mat4 mirrored = Mat4::MakeTranslation(0.0f, 0.0f, -10.0f) * Mat4::MakeScale(-1.0f, 1.0f, 1.0f);
+    const MeshletCullView view = MakeMeshletCullView(kView, kPerspective, mirrored);
+    EXPECT_FALSE(view.CullBackfaces);
+    EXPECT_TRUE(IsMeshletVisible(MakeMeshlet(Vec3d(0.0f, 0.0f, 0.0f), Vec3d(0.0f, 0.0f, -1.0f)), view));
+}
+
+TEST(MeshletCulling, SurvivorsMergeIntoContiguousRanges)
+{
+    const MeshletCullView view = MakeMeshletCullView(kPerspective * kView, Mat4::Identity());
+    std::vector<StaticMeshMeshlet> meshlets;
+    const Vec3d centers[] = { Vec3d(0.0f, 0.0f, -10.0f), Vec3d(1.0f, 0.0f, -10.0f),
+                              Vec3d(0.0f, 0.0f, 10.0f), Vec3d(2.0f, 0.0f, -10.0f),
+                              Vec3d(3.0f, 0.0f, -10.0f) };
+    for (uint32_t i = 0; i < 5; ++i)
+    {
+        StaticMeshMeshlet meshlet = MakeMeshlet(centers[i]);
+        meshlet.IndexOffset = 30 + i * 6;
+        meshlet.IndexCount = 6;
+        meshlets.push_back(meshlet);
+    }
+
+    std::vector<MeshIndexRange> ranges = { { .IndexOffset = 0, .IndexCount = 30 } };
+    EXPECT_EQ(CullMeshlets(meshlets, view, ranges), 1u);
+    // What was already in the list is left as it was.
+    ASSERT_EQ(ranges.size(), 3u);
+    EXPECT_EQ(ranges[0].IndexOffset, 0u);
+    EXPECT_EQ(ranges[0].IndexCount, 30u);
+    EXPECT_EQ(ranges[1].IndexOffset, 30u);
+    EXPECT_EQ(ranges[1].IndexCount, 12u);
+    EXPECT_EQ(ranges[2].IndexOffset, 48u);
+    EXPECT_EQ(ranges[2].IndexCount, 12u);
+}
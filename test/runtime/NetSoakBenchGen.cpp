@@ -0,0 +1,123 @@
+// Evidence generator: a dedicated-server soak of the net stack. The companion
+// to NetSoakBoundsTests.cpp -- the counted budgets that must hold on every
+// machine are asserted there; the per-phase CPU time that depends on this
+// machine and this build is recorded here, beside the same counted figures so
+// one run carries both.
+//
+// Skipped unless SENCHA_NET_SOAK_BENCH_OUT names the output path (a .json is
+// written there and a .csv beside it). Run it through scripts/bench_net_soak.sh,
+// which builds the profile preset and pins a core; compare two runs with
+// scripts/bench_streaming_compare.py, which applies the same schema-1 rules.
+//
+// Scenarios, each at SENCHA_NET_SOAK_TICKS ticks (default 1800, thirty seconds):
+//   c{N}_m{M}           N clients, M movers, clean network
+//   c{N}_m{M}_impaired  the same with 5% loss and 5% reordering per client
+//
+// Per scenario:
+//   *_feed_ms / _sim_ms / _encode_ms / _send_ms
+//                      median authority CPU per tick in each phase: pump and
+//                      command feed, simulation, snapshot encode and queue,
+//                      channel flush
+//   *_tick_p99_ms      99th percentile of the four together
+//   *_bytes_per_peer_tick   wire bytes per peer per tick, all channels
+//   *_latency_p50_ticks / _p99_ticks   input-to-apply latency
+//   *_over_budget      snapshots that did not fit one datagram
+
+#include <gtest/gtest.h>
+
+#include "BenchRecorder.h"
+#include "NetSoakFixture.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace
+{
+namespace fs = std::filesystem;
+
+Bench::Recorder Recorder;
+
+void MeasureSoak(int clients, int movers, bool impaired, int ticks)
+{
+    NetSoak::Config config;
+    config.Clients = clients;
+    config.Movers = movers;
+    config.Ticks = ticks;
+    config.TimePhases = true;
+    if (impaired)
+    {
+        config.Impairment.LossPercent = 5;
+        config.Impairment.ReorderPercent = 5;
+        config.Impairment.Seed = 42;
+    }
+
+    NetSoak::Harness harness(config);
+    ASSERT_TRUE(harness.IsStarted());
+    NetSoak::Result result = harness.Run();
+    ASSERT_EQ(result.ClientsAdmitted, clients);
+
+    const std::string label = "c" + std::to_string(clients) + "_m" + std::to_string(movers)
+                            + (impaired ? "_impaired" : "");
+
+    NetSoak::PhaseSamples& phases = result.Phases;
+    std::vector<double> totals(phases.CommandFeed.size());
+    for (std::size_t tick = 0; tick < totals.size(); ++tick)
+    {
+        totals[tick] = phases.CommandFeed[tick] + phases.Simulation[tick]
+                     + phases.SnapshotEncode[tick] + phases.ChannelSend[tick];
+    }
+
+    Recorder.Record(label + "_feed_ms", "ms", Bench::Median(phases.CommandFeed));
+    Recorder.Record(label + "_sim_ms", "ms", Bench::Median(phases.Simulation));
+    Recorder.Record(label + "_encode_ms", "ms", Bench::Median(phases.SnapshotEncode));
+    Recorder.Record(label + "_send_ms", "ms", Bench::Median(phases.ChannelSend));
+    Recorder.Record(label + "_tick_p99_ms", "ms", Bench::Percentile(totals, 0.99));
+
+    // Counted, and therefore exact between runs of one build: the compare
+    // script treats any growth as a regression.
+    Recorder.Record(label + "_bytes_per_peer_tick", "count",
+                    std::round(result.BytesPerPeerPerTick()));
+    Recorder.Record(label + "_latency_p50_ticks", "count",
+                    Bench::Percentile(result.LatencyTicks, 0.50));
+    Recorder.Record(label + "_latency_p99_ticks", "count",
+                    Bench::Percentile(result.LatencyTicks, 0.99));
+    Recorder.Record(label + "_over_budget", "count",
+                    static_cast<double>(result.SnapshotsOverBudget));
+    Recorder.Record(label + "_starved_ticks", "count",
+                    static_cast<double>(result.StarvedTicks));
+}
+}
+
+TEST(NetSoakBench, Generate)
+{
+    const char* outEnv = std::getenv("SENCHA_NET_SOAK_BENCH_OUT");
+    if (outEnv == nullptr)
+    {
+        GTEST_SKIP() << "set SENCHA_NET_SOAK_BENCH_OUT to record the net soak "
+                        "bench (use scripts/bench_net_soak.sh)";
+    }
+
+    const fs::path jsonPath(outEnv);
+    if (jsonPath.has_parent_path() && !jsonPath.parent_path().empty())
+        fs::create_directories(jsonPath.parent_path());
+
+    Recorder.Clear();
+    const int ticks = Bench::RepsFromEnvironment("SENCHA_NET_SOAK_TICKS", 1800);
+
+    // Four is the co-op shape the session is tuned for and eight the most it is
+    // validated against. Entity counts stay under what one full-state snapshot
+    // can carry -- a join has to fit a single datagram, and past that the
+    // over-budget count is the only number left that means anything.
+    MeasureSoak(4, 8, false, ticks);
+    MeasureSoak(4, 16, false, ticks);
+    MeasureSoak(8, 8, false, ticks);
+    MeasureSoak(4, 16, true, ticks);
+
+    ASSERT_TRUE(Recorder.WriteJson(jsonPath));
+    fs::path csvPath = jsonPath;
+    csvPath.replace_extension(".csv");
+    ASSERT_TRUE(Recorder.WriteCsv(csvPath));
+}
@@ -0,0 +1,162 @@
+// Cost bounds for the net stack under a dedicated-server soak, asserted on
+// counted work so the results are identical on every machine and in every
+// build config. This is the regression gate CI runs; the wall-clock split by
+// phase lives in NetSoakBench.Generate, which records the same scenario.
+//
+// Each bound states a budget the current stack meets with headroom, and names
+// what a regression past it would mean. Tightening one is a deliberate act
+// backed by a recorded run, not a side effect of a change that happened to
+// shrink the number.
+
+#include <gtest/gtest.h>
+
+#include "NetSoakFixture.h"
+
+#include <filesystem>
+#include <format>
+#include <optional>
+#include <random>
+#include <string>
+
+namespace
+{
+NetSoak::Result RunSoak(const NetSoak::Config& config)
+{
+    NetSoak::Harness harness(config);
+    EXPECT_TRUE(harness.IsStarted());
+    return harness.Run();
+}
+
+// A capture file named for the running test plus a random token, so parallel
+// ctest processes (and reruns after a crash) never share one, removed when
+// the test ends however it ends.
+struct ScopedCaptureFile
+{
+    std::filesystem::path Path;
+
+    ScopedCaptureFile()
+    {
+        std::string caseName = "unknown";
+        if (const auto* info = testing::UnitTest::GetInstance()->current_test_info())
+            caseName = std::string(info->test_suite_name()) + "_" + info->name();
+
+        std::random_device entropy;
+        Path = std::filesystem::temp_directory_path()
+            / std::format("sencha_net_soak_{}_{:08x}{:08x}.sncap", caseName, entropy(), entropy());
+    }
+
+    ~ScopedCaptureFile()
+    {
+        std::error_code ec;
+        std::filesystem::remove(Path, ec);
+    }
+};
+}
+
+// Four clients, sixteen movers, ten seconds of ticks on a clean network: the
+// co-op shape the session is tuned for.
+TEST(NetSoakBounds, ACleanSessionHoldsItsBudgets)
+{
+    const NetSoak::Result result = RunSoak(NetSoak::Config{});
+
+    ASSERT_EQ(result.ClientsAdmitted, 4);
+
+    // Every peer gets a snapshot every tick. One that did not fit a datagram
+    // is state a client silently stops receiving.
+    EXPECT_EQ(result.SnapshotsOverBudget, 0u);
+    EXPECT_EQ(result.SnapshotsSent,
+              static_cast<std::uint64_t>(result.MeasuredTicks) * 4u);
+    EXPECT_EQ(result.SnapshotApplyFailures, 0u);
+    EXPECT_EQ(result.SnapshotsApplied, result.SnapshotsSent);
+
+    // Twenty entities changing every tick, at full float width, is a little
+    // under five hundred bytes per peer with framing and acks. Past the bound
+    // means the delta stopped being a delta or the channel started padding.
+    EXPECT_LT(result.BytesPerPeerPerTick(), 640.0);
+
+    // Input lands on the tick after it was sent, plus the buffer's one tick of
+    // slack. Anything more is latency every player pays on every input.
+    ASSERT_FALSE(result.LatencyTicks.empty());
+    std::vector<double> latency = result.LatencyTicks;
+    EXPECT_LE(Bench::Percentile(latency, 0.50), 2.0);
+    EXPECT_LE(Bench::Percentile(latency, 0.99), 2.0);
+    EXPECT_EQ(result.StarvedTicks, 0u);
+}
+
+// Loss and reordering on every client: the redundancy window has to cover the
+// gaps, and latency may spread but not run away.
+TEST(NetSoakBounds, AnImpairedSessionKeepsInputFlowing)
+{
+    NetSoak::Config config;
+    config.Impairment.LossPercent = 5;
+    config.Impairment.ReorderPercent = 5;
+    config.Impairment.Seed = 7;
+    const NetSoak::Result result = RunSoak(config);
+
+    ASSERT_EQ(result.ClientsAdmitted, 4);
+    EXPECT_EQ(result.SnapshotsOverBudget, 0u);
+    EXPECT_EQ(result.SnapshotApplyFailures, 0u);
+
+    ASSERT_FALSE(result.LatencyTicks.empty());
+    std::vector<double> latency = result.LatencyTicks;
+    EXPECT_LE(Bench::Percentile(latency, 0.99), 4.0);
+
+    // Three records per command cover any two consecutive losses, so a peer
+    // runs dry only when a datagram is held back past its tick. Allowed one
+    // tick in forty per peer, half the loss rate: a redundancy window that
+    // stopped working would starve on every lost datagram and exceed it.
+    EXPECT_LE(result.StarvedTicks,
+              static_cast<std::uint64_t>(result.MeasuredTicks) * 4u / 40u);
+}
+
+// The same ticks produce the same bytes. A soak whose counted results moved
+// between two identical runs could not gate anything.
+TEST(NetSoakBounds, CountedResultsAreDeterministic)
+{
+    NetSoak::Config config;
+    config.Ticks = 200;
+    config.Impairment.LossPercent = 3;
+    config.Impairment.Seed = 11;
+
+    const NetSoak::Result first = RunSoak(config);
+    const NetSoak::Result second = RunSoak(config);
+    EXPECT_EQ(first.HostBytesSent, second.HostBytesSent);
+    EXPECT_EQ(first.SnapshotsSent, second.SnapshotsSent);
+    EXPECT_EQ(first.CommandsFed, second.CommandsFed);
+    EXPECT_EQ(first.LatencyTicks, second.LatencyTicks);
+}
+
+// The model's whole lifecycle on the soak's traffic: capture what an authority
+// publishes, train from the capture file the way the trainer script does, and
+// run the same session again with both ends holding the result. Every coded
+// snapshot has to decode, and the wire has to shrink; a model that bought
+// nothing on the traffic it was trained on is not worth shipping.
+TEST(NetSoakBounds, AModelTrainedFromACapturedSessionShrinksIt)
+{
+    const ScopedCaptureFile captureFile;
+    const std::filesystem::path& capturePath = captureFile.Path;
+
+    NetSoak::Config config;
+    config.Ticks = 300;
+    NetSnapshotCapture capture;
+    ASSERT_TRUE(capture.Open(capturePath));
+    config.Capture = &capture;
+    const NetSoak::Result raw = RunSoak(config);
+    capture.Close();
+    config.Capture = nullptr;
+
+    NetEntropyTrainer trainer;
+    const std::optional<std::uint64_t> captured = ReadNetSnapshotCapture(capturePath, trainer);
+    ASSERT_TRUE(captured);
+    // Warmup ticks are captured too: a model is trained on whole sessions.
+    EXPECT_GE(*captured, raw.SnapshotsSent);
+    const NetEntropyModel model = trainer.Build();
+
+    config.EntropyModel = &model;
+    const NetSoak::Result coded = RunSoak(config);
+
+    ASSERT_EQ(coded.ClientsAdmitted, 4);
+    EXPECT_EQ(coded.SnapshotApplyFailures, 0u);
+    EXPECT_EQ(coded.SnapshotsApplied, raw.SnapshotsApplied);
+    EXPECT_LT(coded.BytesPerPeerPerTick(), raw.BytesPerPeerPerTick());
+}
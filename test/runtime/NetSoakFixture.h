@@ -0,0 +1,468 @@
+#pragma once
+
+// A dedicated-server soak in one process: an authority NetSession and N client
+// sessions on a LoopbackNetwork, each client sending one NetPlayerCommand per
+// tick against a world of M replicated movers. Shared by the bounds asserted in
+// NetSoakBoundsTests.cpp and the numbers recorded by NetSoakBench.Generate, so
+// the scenario CI gates on is the scenario the bench measures.
+//
+// Everything is stepped by hand on a simulated clock. The session, the command
+// buffers, and the replication writer see exactly the calls a headless host's
+// frame makes, in the order EngineFramePhases makes them, without a window, a
+// schedule, or a wall clock deciding when a tick runs -- which is what makes the
+// counted results (bytes, latency in ticks, starvation) identical on every
+// machine and the timed ones comparable between runs.
+//
+// Input-to-apply latency is measured without instrumenting the engine: each
+// client writes its command sequence number into the move action's X axis, and
+// the authority reads it back out of the peer's input source after the feed.
+// The difference between the tick a sequence number was sent and the tick it
+// was first fed is the latency that peer's input paid.
+
+#include "BenchRecorder.h"
+
+#include <ecs/World.h>
+#include <ecs/WorldComponentSchema.h>
+#include <input/InputActionRegistry.h>
+#include <input/InputActionSource.h>
+#include <input/InputActionState.h>
+#include <net/LoopbackTransport.h>
+#include <net/NetEntropyModelFile.h>
+#include <net/NetPlayerCommand.h>
+#include <net/NetReplicationComponents.h>
+#include <net/NetSession.h>
+#include <net/PeerCommandRuntime.h>
+#include <net/ReplicationRuntime.h>
+#include <net/SimulatedTransport.h>
+#include <world/RuntimeComponentSchema.h>
+#include <world/transform/TransformComponents.h>
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace NetSoak
+{
+inline constexpr InputActionId kMove{ 1 };
+inline constexpr std::size_t kActionCount = 1;
+inline constexpr double kTickSeconds = 1.0 / 60.0;
+// Records per command: the newest and two ticks of redundancy, which is what
+// keeps a lost datagram from costing input under the impaired scenario.
+inline constexpr std::uint8_t kCommandWindow = 3;
+
+struct Config
+{
+    int Clients = 4;
+    int Movers = 16;
+    int Ticks = 600;
+    // Ticks before anything is measured: the handshake and the first full-state
+    // snapshot are a join, not the steady state a soak is about.
+    int WarmupTicks = 30;
+    // Applied to what each client sends once it is admitted: the command path,
+    // which is the one input latency and starvation are measured on.
+    NetImpairment Impairment{};
+    // Wall-clock phase timing. Off for the bounds, which assert counted work
+    // only and need not pay for the clock reads.
+    bool TimePhases = false;
+    // Installed on the authority and every client, as CreateNetSession does
+    // from engine.json. Null sends snapshots raw.
+    const NetEntropyModel* EntropyModel = nullptr;
+    // Records what the authority publishes, for training a model.
+    NetSnapshotCapture* Capture = nullptr;
+};
+
+// Milliseconds per authority tick, one sample per measured tick.
+struct PhaseSamples
+{
+    std::vector<double> CommandFeed;
+    std::vector<double> Simulation;
+    std::vector<double> SnapshotEncode;
+    std::vector<double> ChannelSend;
+};
+
+struct Result
+{
+    int ClientsAdmitted = 0;
+    int MeasuredTicks = 0;
+    PhaseSamples Phases;
+    // Ticks between a client sending a command and the authority feeding it.
+    std::vector<double> LatencyTicks;
+    // Wire bytes the authority sent during measured ticks, all peers together.
+    std::uint64_t HostBytesSent = 0;
+    std::uint64_t SnapshotsSent = 0;
+    // Snapshots Publish wrote but that came back over one datagram's budget
+    // and were therefore never sent: the soak's capacity alarm.
+    std::uint64_t SnapshotsOverBudget = 0;
+    std::uint64_t SnapshotsApplied = 0;
+    std::uint64_t SnapshotApplyFailures = 0;
+    std::uint64_t CommandsFed = 0;
+    std::uint64_t StarvedTicks = 0;
+
+    [[nodiscard]] double BytesPerPeerPerTick() const
+    {
+        if (ClientsAdmitted == 0 || MeasuredTicks == 0)
+            return 0.0;
+        return static_cast<double>(HostBytesSent)
+             / (static_cast<double>(ClientsAdmitted) * MeasuredTicks);
+    }
+};
+
+inline NetIdentity SoakIdentity()
+{
+    return NetIdentity{
+        .ModuleFingerprint = 0x50A4,
+        .WorldIdentity = 0xB0B,
+        .FixedTickRateMilliHz = 60000,
+    };
+}
+
+// Both ends build their worlds from the engine's own schema, so they agree on
+// component identity the way two processes running one build would.
+struct StandaloneWorld
+{
+    WorldComponentSchema Schema;
+    ReplicationLayout Layout;
+    World Entities;
+
+    StandaloneWorld()
+    {
+        RegisterEngineRuntimeComponents(Schema);
+        Schema.Seal();
+        Schema.Apply(Entities);
+        RegisterEngineReplicatedComponents(Layout);
+        Layout.Seal();
+    }
+};
+
+// Counts what the authority puts on the wire. Bytes are the figure a server
+// operator pays for, and the transport is the only place every channel's
+// framing, acks, and keepalives are visible together.
+class CountingTransport final : public INetTransport
+{
+public:
+    explicit CountingTransport(INetTransport& inner) : Inner(inner) {}
+
+    [[nodiscard]] bool Open(std::uint16_t port) override { return Inner.Open(port); }
+    void Close() override { Inner.Close(); }
+    [[nodiscard]] bool IsOpen() const override { return Inner.IsOpen(); }
+    [[nodiscard]] NetAddress LocalAddress() const override { return Inner.LocalAddress(); }
+    [[nodiscard]] bool Send(const NetAddress& to,
+                            std::span<const std::byte> payload) override
+    {
+        BytesSent += payload.size();
+        return Inner.Send(to, payload);
+    }
+    [[nodiscard]] std::span<const NetDatagram> Receive() override { return Inner.Receive(); }
+    [[nodiscard]] NetTransportCounters Counters() const override { return Inner.Counters(); }
+
+    std::uint64_t BytesSent = 0;
+
+private:
+    INetTransport& Inner;
+};
+
+// Routes a client's traffic around the impairment until it is admitted. The
+// handshake has no resend -- a lost hello is a join that times out, which is
+// the session's business and not what a soak measures -- so impairment starts
+// once the client is in and the steady state is what absorbs it.
+class AdmissionGatedTransport final : public INetTransport
+{
+public:
+    AdmissionGatedTransport(INetTransport& direct, INetTransport& impaired)
+        : Direct(direct), Impaired(impaired)
+    {
+    }
+
+    [[nodiscard]] bool Open(std::uint16_t port) override { return Direct.Open(port); }
+    void Close() override { Direct.Close(); }
+    [[nodiscard]] bool IsOpen() const override { return Direct.IsOpen(); }
+    [[nodiscard]] NetAddress LocalAddress() const override { return Direct.LocalAddress(); }
+    [[nodiscard]] bool Send(const NetAddress& to,
+                            std::span<const std::byte> payload) override
+    {
+        return Admitted ? Impaired.Send(to, payload) : Direct.Send(to, payload);
+    }
+    [[nodiscard]] std::span<const NetDatagram> Receive() override { return Direct.Receive(); }
+
+    bool Admitted = false;
+
+private:
+    INetTransport& Direct;
+    INetTransport& Impaired;
+};
+
+struct Client
+{
+    explicit Client(LoopbackNetwork& network, const NetImpairment& impairment)
+        : Loopback(network), Impaired(Loopback, impairment),
+          Gate(Loopback, Impaired), Session(Gate)
+    {
+    }
+
+    LoopbackTransport Loopback;
+    SimulatedTransport Impaired;
+    AdmissionGatedTransport Gate;
+    NetSession Session;
+    ReplicationRuntime Replication;
+    StandaloneWorld Mirror;
+    // The tick each sequence number left on, indexed by sequence. Sequence
+    // numbers ride a float axis, so they stay exact well past any soak length.
+    std::vector<std::uint64_t> SentAtTick;
+    std::array<std::byte, kNetMaxPayloadBytes> Scratch{};
+
+    // One tick's command: the newest record and the redundancy window behind
+    // it, stamped one tick ahead so it lands before the tick it asks for.
+    void SendCommand(std::uint64_t tick)
+    {
+        const auto sequence = static_cast<std::uint32_t>(SentAtTick.size());
+        SentAtTick.push_back(tick);
+
+        NetPlayerCommand command;
+        const std::uint8_t window = static_cast<std::uint8_t>(
+            std::min<std::size_t>(kCommandWindow, SentAtTick.size()));
+        command.RecordCount = window;
+        for (std::uint8_t index = 0; index < window; ++index)
+        {
+            NetCommandRecord& record = command.Records[index];
+            record.Tick = tick + 1 - index;
+            record.ActionCount = kActionCount;
+            InputActionValue& move = record.Actions[InputActionRegistry::IndexOf(kMove)];
+            move.X = static_cast<float>(sequence - index);
+            move.Y = 1.0f;
+        }
+
+        Scratch[0] = static_cast<std::byte>(NetPayloadKind::Command);
+        NetBitWriter writer(std::span<std::byte>(Scratch).subspan(1));
+        if (NetEncodePlayerCommand(command, writer) == 0)
+            return;
+        (void)Session.Send(Session.LocalPeerId(), NetChannelKind::UnreliableSequenced,
+                           std::span<const std::byte>(Scratch).subspan(
+                               0, 1 + writer.BytesWritten()));
+    }
+};
+
+class Harness
+{
+public:
+    explicit Harness(const Config& config) : Settings(config)
+    {
+        InputActionState& local = Host.Entities.AddResource<InputActionState>();
+        local.Configure(kActionCount);
+
+        for (int index = 0; index < Settings.Movers; ++index)
+        {
+            const EntityId mover = Host.Entities.CreateEntity();
+            Host.Entities.AddComponent<NetReplicated>(mover);
+            Host.Entities.AddComponent<LocalTransform>(mover, LocalTransform{});
+            Movers.push_back(mover);
+        }
+
+        Replication.SetEntropyModel(Settings.EntropyModel);
+        Replication.SetSnapshotCapture(Settings.Capture);
+
+        Started = HostSession.Host(0, SoakIdentity());
+        HostSession.SetMaxPeers(static_cast<std::size_t>(Settings.Clients));
+        for (int index = 0; index < Settings.Clients; ++index)
+        {
+            NetImpairment impairment = Settings.Impairment;
+            impairment.Seed += static_cast<std::uint64_t>(index);
+            Clients.push_back(std::make_unique<Client>(Network, impairment));
+            Clients.back()->Replication.SetEntropyModel(Settings.EntropyModel);
+            Started = Clients.back()->Session.Connect(HostSession.LocalAddress(),
+                                                      SoakIdentity())
+                   && Started;
+        }
+    }
+
+    [[nodiscard]] bool IsStarted() const { return Started; }
+
+    Result Run()
+    {
+        Result result;
+        // Ticks count from one, as the simulation clock's do: a snapshot
+        // stamped zero is indistinguishable from no snapshot at all.
+        for (int step = 0; step < Settings.Ticks; ++step)
+        {
+            const bool measured = step >= Settings.WarmupTicks;
+            const auto tick = static_cast<std::uint64_t>(step) + 1;
+            StepAuthority(tick, measured, result);
+            StepClients(tick, measured, result);
+            if (measured)
+                ++result.MeasuredTicks;
+        }
+
+        for (const auto& client : Clients)
+        {
+            if (client->Session.IsConnected())
+                ++result.ClientsAdmitted;
+        }
+        for (const auto& [peer, pawn] : Pawns)
+        {
+            if (const NetPeerCommandBuffer* buffer = Commands.Peer(peer))
+                result.StarvedTicks += buffer->StarvedTicks();
+        }
+        return result;
+    }
+
+private:
+    // The authority's frame, in EngineFramePhases order: pump and feed,
+    // simulate, publish, flush.
+    void StepAuthority(std::uint64_t tick, bool measured, Result& result)
+    {
+        const double now = static_cast<double>(tick) * kTickSeconds;
+        World& world = Host.Entities;
+
+        // Keepalives and acks leave from Pump as well as Flush, so the tick's
+        // bytes are the transport's total across both.
+        const std::uint64_t bytesBefore = HostTransport.BytesSent;
+
+        Bench::Clock::time_point phase = Bench::Clock::now();
+        for (const NetSession::Delivery& delivery : HostSession.Pump(now))
+        {
+            if (!delivery.Payload.empty()
+                && static_cast<NetPayloadKind>(delivery.Payload[0]) == NetPayloadKind::Command)
+            {
+                (void)Commands.Receive(delivery.From, delivery.Payload);
+            }
+        }
+        for (const NetPeerEvent& event : HostSession.PeerEvents())
+        {
+            if (event.Kind == NetPeerEventKind::Joined)
+                SpawnPawn(event.Peer, event.Address);
+        }
+        Commands.Feed(world, tick);
+        const double feedMs = Lap(phase);
+
+        // The simulation: movers circle, pawns walk where their input says.
+        // Every mover changes every tick, which is the worst case for delta
+        // compression and the honest one for a soak.
+        const InputActionSources sources(world);
+        for (std::size_t index = 0; index < Movers.size(); ++index)
+        {
+            LocalTransform* transform = world.TryGet<LocalTransform>(Movers[index]);
+            const float angle = static_cast<float>(tick) * 0.02f + static_cast<float>(index);
+            transform->Value.Position = Vec3d(std::cos(angle) * 20.0f, 0.0f,
+                                              std::sin(angle) * 20.0f);
+        }
+        for (const auto& [peer, pawn] : Pawns)
+        {
+            const Vec2d move = sources.TickFor(pawn).Axis2(kMove);
+            if (move.Y == 0.0f)
+                continue;
+            ++result.CommandsFed;
+            LocalTransform* transform = world.TryGet<LocalTransform>(pawn);
+            transform->Value.Position.Z += move.Y * static_cast<float>(kTickSeconds);
+
+            // A sequence fed for the first time is an input applied.
+            const auto sequence = static_cast<std::int64_t>(move.X);
+            std::int64_t& newest = NewestFed[peer];
+            if (sequence > newest)
+            {
+                newest = sequence;
+                const auto found = ClientIndex.find(peer);
+                if (found == ClientIndex.end())
+                    continue;
+                const Client& client = *Clients[found->second];
+                if (measured && static_cast<std::size_t>(sequence) < client.SentAtTick.size())
+                {
+                    result.LatencyTicks.push_back(static_cast<double>(
+                        tick - client.SentAtTick[static_cast<std::size_t>(sequence)]));
+                }
+            }
+        }
+        const double simMs = Lap(phase);
+
+        const ReplicationRuntime::PublishStats published =
+            Replication.Publish(HostSession, world, Host.Layout, tick);
+        const double encodeMs = Lap(phase);
+
+        HostSession.Flush(now);
+        const double sendMs = Lap(phase);
+
+        if (!measured)
+            return;
+        result.SnapshotsSent += published.SnapshotsSent;
+        result.SnapshotsOverBudget += published.PeersServed - published.SnapshotsSent;
+        result.HostBytesSent += HostTransport.BytesSent - bytesBefore;
+        if (Settings.TimePhases)
+        {
+            result.Phases.CommandFeed.push_back(feedMs);
+            result.Phases.Simulation.push_back(simMs);
+            result.Phases.SnapshotEncode.push_back(encodeMs);
+            result.Phases.ChannelSend.push_back(sendMs);
+        }
+    }
+
+    void StepClients(std::uint64_t tick, bool measured, Result& result)
+    {
+        const double now = static_cast<double>(tick) * kTickSeconds;
+        for (const auto& client : Clients)
+        {
+            for (const NetSession::Delivery& delivery : client->Session.Pump(now))
+            {
+                const SnapshotApplyResult applied = client->Replication.Apply(
+                    delivery.Payload, client->Mirror.Entities, client->Mirror.Schema,
+                    client->Mirror.Layout);
+                if (!measured)
+                    continue;
+                if (applied.Ok() && applied.Tick != 0)
+                    ++result.SnapshotsApplied;  // zero: another kind, ignored
+                else if (!applied.Ok())
+                    ++result.SnapshotApplyFailures;
+            }
+            client->Gate.Admitted = client->Session.IsConnected();
+            if (client->Session.IsConnected())
+                client->SendCommand(tick);
+            client->Session.Flush(now);
+        }
+    }
+
+    void SpawnPawn(PeerId peer, const NetAddress& address)
+    {
+        World& world = Host.Entities;
+        const EntityId pawn = world.CreateEntity();
+        world.AddComponent<NetReplicated>(pawn);
+        world.AddComponent<NetOwner>(pawn, NetOwner{ .Peer = peer.Value });
+        world.AddComponent<LocalTransform>(pawn, LocalTransform{});
+        world.AddComponent<InputActionSourceRef>(
+            pawn, InputActionSourceRef{ .Source = peer.Value });
+        Pawns.emplace(peer, pawn);
+        NewestFed.emplace(peer, -1);
+
+        // Matched by address rather than by join order: under loss a later
+        // client can finish its handshake first.
+        for (std::size_t index = 0; index < Clients.size(); ++index)
+        {
+            if (Clients[index]->Session.LocalAddress() == address)
+                ClientIndex.emplace(peer, index);
+        }
+    }
+
+    [[nodiscard]] double Lap(Bench::Clock::time_point& phase) const
+    {
+        if (!Settings.TimePhases)
+            return 0.0;
+        const double elapsed = Bench::MillisecondsSince(phase);
+        phase = Bench::Clock::now();
+        return elapsed;
+    }
+
+    Config Settings;
+    LoopbackNetwork Network;
+    LoopbackTransport HostLoopback{ Network };
+    CountingTransport HostTransport{ HostLoopback };
+    NetSession HostSession{ HostTransport };
+    StandaloneWorld Host;
+    PeerCommandRuntime Commands;
+    ReplicationRuntime Replication;
+    std::vector<EntityId> Movers;
+    std::vector<std::unique_ptr<Client>> Clients;
+    std::unordered_map<PeerId, EntityId> Pawns;
+    std::unordered_map<PeerId, std::int64_t> NewestFed;
+    std::unordered_map<PeerId, std::size_t> ClientIndex;
+    bool Started = false;
+};
+}  // namespace NetSoak
@@ -0,0 +1,213 @@
+// Evidence generator: what attaching a zone's colliders costs the Physics
+// phase, now that RigidBodyBinding inserts a reconcile's new bodies as one
+// AddBodies batch and the broadphase rebuild waits for a frame that attached
+// nothing.
+//
+// Skipped unless SENCHA_PHYSICS_ATTACH_BENCH_OUT names the output path (a .json
+// is written there and a .csv beside it). Run it through
+// scripts/bench_physics_attach.sh; compare two runs with
+// scripts/bench_streaming_compare.py.
+//
+// Each zone is a grid of static box colliders, the shape of streamed level
+// collision, with one dynamic body in ten.
+//
+// Per body count (n1k, n10k):
+//   attach_single_*_ms   median: the bodies added one AddBody at a time, the
+//                        path the binding used to take
+//   attach_batch_*_ms    median: the same bodies through one AddBodies batch
+//   sync_attach_*_ms     median: RigidBodyBinding::SyncToPhysics attaching the
+//                        zone's collider entities, links included
+//   optimize_*_ms        median: the OptimizeBroadPhase the attach deferred
+//   step_*_ms            median: the first Step after the attach, before the
+//                        deferred rebuild
+//   control_memory_stream_ms  the compare script's drift yardstick
+
+#include <gtest/gtest.h>
+
+#include "BenchRecorder.h"
+
+#include <ecs/StoragePartitionSet.h>
+#include <ecs/World.h>
+#include <physics/PhysicsRegistration.h>
+#include <physics/PhysicsWorld.h>
+#include <physics/RigidBodyBinding.h>
+#include <physics/components/Collider.h>
+#include <physics/components/RigidBody.h>
+#include <world/transform/TransformComponents.h>
+
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace
+{
+namespace fs = std::filesystem;
+
+Bench::Recorder Recorder;
+
+constexpr float kFixedDt = 1.0f / 60.0f;
+
+PhysicsWorldConfig BenchConfig()
+{
+    PhysicsWorldConfig config;
+    config.MaxBodies = 16384;
+    return config;
+}
+
+Vec3d GridPosition(int index)
+{
+    return Vec3d(static_cast<float>(index % 100) * 2.0f,
+                 index % 10 == 0 ? 3.0f : 0.0f,
+                 static_cast<float>(index / 100) * 2.0f);
+}
+
+std::vector<BodyDesc> BenchBodies(int count)
+{
+    std::vector<BodyDesc> descs(static_cast<size_t>(count));
+    for (int index = 0; index < count; ++index)
+    {
+        BodyDesc& desc = descs[static_cast<size_t>(index)];
+        desc.Shape = CollisionShape::MakeBox(Vec3d(0.5f, 0.5f, 0.5f));
+        desc.Position = GridPosition(index);
+        desc.Motion = index % 10 == 0 ? BodyMotion::Dynamic : BodyMotion::Static;
+        desc.Layer = index % 10 == 0 ? CollisionLayer::Moving : CollisionLayer::Static;
+    }
+    return descs;
+}
+
+void SpawnZone(World& world, int count)
+{
+    for (int index = 0; index < count; ++index)
+    {
+        Transform3f transform;
+        transform.Position = GridPosition(index);
+        const EntityId entity = world.CreateEntity();
+        world.AddComponent<LocalTransform>(entity, LocalTransform{ transform });
+        world.AddComponent<Collider>(
+            entity,
+            Collider{ CollisionShape::MakeBox(Vec3d(0.5f, 0.5f, 0.5f)) });
+        if (index % 10 == 0)
+            world.AddComponent<RigidBody>(
+                entity,
+                RigidBody{ BodyMotion::Dynamic, 1.0f, Vec3d::Zero(), 1.0f });
+    }
+}
+
+void MeasureAttach(const std::string& label, int count, int reps)
+{
+    const std::vector<BodyDesc> descs = BenchBodies(count);
+    StoragePartitionSet partitions;
+    partitions.Add(StoragePartitionId::Default());
+
+    std::vector<double> singles;
+    std::vector<double> batches;
+    std::vector<double> syncs;
+    std::vector<double> optimizes;
+    std::vector<double> steps;
+
+    // The first pass of each only warms the allocator and caches.
+    for (int rep = 0; rep <= reps; ++rep)
+    {
+        {
+            PhysicsWorld physics(BenchConfig());
+            const Bench::Clock::time_point start = Bench::Clock::now();
+            for (const BodyDesc& desc : descs)
+                (void)physics.AddBody(desc);
+            const double elapsed = Bench::MillisecondsSince(start);
+            EXPECT_EQ(physics.BodyCount(), static_cast<uint32_t>(count));
+            if (rep > 0)
+                singles.push_back(elapsed);
+        }
+        {
+            PhysicsWorld physics(BenchConfig());
+            std::vector<PhysicsBodyId> ids(descs.size());
+            Bench::Clock::time_point start = Bench::Clock::now();
+            EXPECT_EQ(physics.AddBodies(descs, ids), descs.size());
+            const double batchMs = Bench::MillisecondsSince(start);
+
+            start = Bench::Clock::now();
+            physics.Step(kFixedDt);
+            const double stepMs = Bench::MillisecondsSince(start);
+
+            start = Bench::Clock::now();
+            physics.OptimizeBroadPhase();
+            const double optimizeMs = Bench::MillisecondsSince(start);
+            if (rep > 0)
+            {
+                batches.push_back(batchMs);
+                steps.push_back(stepMs);
+                optimizes.push_back(optimizeMs);
+            }
+        }
+        {
+            PhysicsWorld physics(BenchConfig());
+            World world;
+            world.RegisterComponent<LocalTransform>();
+            RegisterPhysicsComponents(world);
+            SpawnZone(world, count);
+            RigidBodyBinding binding(physics);
+
+            const Bench::Clock::time_point start = Bench::Clock::now();
+            binding.SyncToPhysics(world, partitions);
+            const double elapsed = Bench::MillisecondsSince(start);
+            EXPECT_EQ(binding.AttachedLastSync(), static_cast<size_t>(count));
+            if (rep > 0)
+                syncs.push_back(elapsed);
+        }
+    }
+
+    Recorder.Record("attach_single_" + label + "_ms", "ms", Bench::Median(singles));
+    Recorder.Record("attach_batch_" + label + "_ms", "ms", Bench::Median(batches));
+    Recorder.Record("sync_attach_" + label + "_ms", "ms", Bench::Median(syncs));
+    Recorder.Record("optimize_" + label + "_ms", "ms", Bench::Median(optimizes));
+    Recorder.Record("step_" + label + "_ms", "ms", Bench::Median(steps));
+}
+
+// Touches no engine code, so a change in it is a change in the machine, not
+// the build.
+void MeasureControl(int reps)
+{
+    constexpr std::size_t kBytes = 20u * 1024u * 1024u;
+    std::vector<unsigned char> buffer(kBytes, 1);
+    std::vector<double> samples;
+    for (int rep = 0; rep <= reps; ++rep)
+    {
+        const Bench::Clock::time_point start = Bench::Clock::now();
+        unsigned long long sum = 0;
+        for (std::size_t index = 0; index < kBytes; index += 64)
+            sum += buffer[index];
+        const double elapsed = Bench::MillisecondsSince(start);
+        if (sum == 0)
+            std::abort();
+        if (rep > 0)
+            samples.push_back(elapsed);
+    }
+    Recorder.Record("control_memory_stream_ms", "ms", Bench::Median(samples));
+}
+}
+
+TEST(PhysicsAttachBench, Generate)
+{
+    const char* outEnv = std::getenv("SENCHA_PHYSICS_ATTACH_BENCH_OUT");
+    if (outEnv == nullptr)
+    {
+        GTEST_SKIP() << "set SENCHA_PHYSICS_ATTACH_BENCH_OUT to record the physics "
+                        "attach bench (use scripts/bench_physics_attach.sh)";
+    }
+
+    const fs::path jsonPath(outEnv);
+    if (jsonPath.has_parent_path() && !jsonPath.parent_path().empty())
+        fs::create_directories(jsonPath.parent_path());
+
+    Recorder.Clear();
+    const int reps = Bench::RepsFromEnvironment("SENCHA_PHYSICS_ATTACH_REPS", 5);
+    MeasureControl(reps);
+    MeasureAttach("n1k", 1000, reps);
+    MeasureAttach("n10k", 10000, reps);
+
+    ASSERT_TRUE(Recorder.WriteJson(jsonPath));
+    fs::path csvPath = jsonPath;
+    csvPath.replace_extension(".csv");
+    ASSERT_TRUE(Recorder.WriteCsv(csvPath));
+}
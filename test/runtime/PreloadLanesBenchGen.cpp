@@ -0,0 +1,237 @@
+// Evidence generator: preload wall time for a 500-asset manifest as the async
+// lane widens. One AssetPreloader::Begin over the whole manifest, drained on
+// the owner thread until the last commit lands, against fresh caches each
+// repetition so nothing is resident when it starts.
+//
+// Skipped unless SENCHA_PRELOAD_LANES_BENCH_OUT names the output path (a .json
+// is written there and a .csv beside it). Run it through
+// scripts/bench_preload_lanes.sh; compare two runs with
+// scripts/bench_streaming_compare.py.
+//
+// The manifest is half cooked .sclip clips (bulk bytes, a cheap decode) and
+// half .smat materials (small files, a JSON parse), written to a temp
+// directory and read once before timing so every configuration sees a warm
+// page cache.
+//
+// Configurations:
+//   single_lane       one task thread and no I/O pool: the engine default
+//                     before the split, every read and decode in series
+//   w{N}              N compute threads plus an I/O pool of max(1, N/2), for
+//                     N in 1, 2, 4, 8
+//
+// Per configuration:
+//   preload_*_ms      median wall time from Begin to the last commit
+//   preload_*_queue_p50_ms / _p95_ms
+//                     per-asset wait from submit to a thread taking it, from
+//                     the queue's latency samples (AsyncTaskQueue tracing),
+//                     pooled over every repetition
+//   preload_*_service_p50_ms / _p95_ms
+//                     per-asset time from its read starting to its decode
+//                     finishing, pooled the same way
+//   preload_*_late_pct
+//                     share of assets finished past the preload's deadline,
+//                     kDeadline after Begin
+//   preload_assets    manifest size (count; a changed manifest is not the
+//                     same benchmark)
+
+#include <gtest/gtest.h>
+
+#include "BenchRecorder.h"
+
+#include <assets/audio_clip/AudioClipSerializer.h>
+#include <assets/runtime/AssetPreloader.h>
+#include <assets/runtime/AssetSystem.h>
+#include <audio/AudioClipCache.h>
+#include <core/assets/AssetRegistry.h>
+#include <core/logging/LoggingProvider.h>
+#include <jobs/AsyncTaskQueue.h>
+#include <render/MaterialCache.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+namespace fs = std::filesystem;
+
+Bench::Recorder Recorder;
+
+constexpr int kManifestSize = 500;
+
+// What the preload asks for: a neighbour zone's lead time.
+constexpr std::chrono::milliseconds kDeadline{ 500 };
+
+struct BenchManifest
+{
+    fs::path Root;
+    std::vector<AssetRecord> Records;
+    std::vector<std::string> Paths;
+};
+
+void WriteFile(const fs::path& path, const void* bytes, std::size_t size)
+{
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(static_cast<const char*>(bytes), static_cast<std::streamsize>(size));
+}
+
+bool PrepareManifest(BenchManifest& out)
+{
+    out.Root = fs::temp_directory_path() / "sencha_preload_lanes_bench";
+    fs::remove_all(out.Root);
+    fs::create_directories(out.Root);
+
+    // A second of mono 48 kHz: the size of a short effect.
+    AudioClip clip;
+    clip.SampleRate = 48000;
+    clip.ChannelCount = 1;
+    clip.Samples.resize(48000);
+    for (std::size_t i = 0; i < clip.Samples.size(); ++i)
+        clip.Samples[i] = static_cast<int16_t>((i * 37) & 0x7fff);
+    std::vector<std::byte> clipBytes;
+    if (!WriteSclipToBytes(clip, clipBytes))
+        return false;
+
+    for (int i = 0; i < kManifestSize; ++i)
+    {
+        const bool isClip = i % 2 == 0;
+        const std::string name = (isClip ? "clip_" : "material_") + std::to_string(i)
+                               + (isClip ? ".sclip" : ".smat");
+        const fs::path file = out.Root / name;
+        if (isClip)
+        {
+            WriteFile(file, clipBytes.data(), clipBytes.size());
+        }
+        else
+        {
+            const std::string material = R"({"version": 2, "base_color_factor": [)"
+                + std::to_string((i % 7) / 7.0) + R"(, 0.5, 0.25, 1], "roughness_factor": 0.5})";
+            WriteFile(file, material.data(), material.size());
+        }
+
+        AssetRecord record{ .Type = isClip ? AssetType::Audio : AssetType::Material,
+                            .SourceKind = AssetSourceKind::File,
+                            .Path = "asset://bench/" + name,
+                            .FilePath = file.generic_string() };
+        out.Paths.push_back(record.Path);
+        out.Records.push_back(std::move(record));
+    }
+    return true;
+}
+
+struct PreloadRun
+{
+    double WallMs = 0.0;
+    std::vector<AsyncTaskLatency> Samples;
+};
+
+double ToMilliseconds(std::chrono::steady_clock::duration duration)
+{
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+// One preload from Begin to its last commit, against caches that start empty.
+PreloadRun TimePreload(const BenchManifest& manifest, uint32_t workers, uint32_t ioWorkers)
+{
+    LoggingProvider logging;
+    AsyncTaskQueue tasks(workers, ioWorkers);
+    AssetRegistry registry(logging);
+    for (const AssetRecord& record : manifest.Records)
+        EXPECT_TRUE(registry.Register(record));
+    MaterialCache materials;
+    AudioClipCache audioClips(logging);
+    AssetSystem assets(logging, registry, nullptr, &materials, nullptr, &audioClips);
+    AssetPreloader preloader(logging, registry, assets, tasks);
+
+    tasks.SetLatencyTracing(true);
+    const Bench::Clock::time_point start = Bench::Clock::now();
+    auto preload = preloader.Begin(manifest.Paths);
+    preload->SetDeadline(start + kDeadline);
+    while (!preload->IsComplete())
+    {
+        if (tasks.DrainCompletions() == 0)
+            std::this_thread::yield();
+    }
+    PreloadRun run{ .WallMs = Bench::MillisecondsSince(start),
+                    .Samples = tasks.TakeLatencySamples() };
+
+    EXPECT_EQ(preload->FailureCount(), 0u);
+    preload->ReleaseAll();
+    return run;
+}
+
+void MeasureConfiguration(const BenchManifest& manifest, const std::string& label,
+                          uint32_t workers, uint32_t ioWorkers, int reps)
+{
+    std::vector<double> walls;
+    std::vector<double> queued;
+    std::vector<double> service;
+    std::size_t late = 0;
+    for (int rep = 0; rep < reps; ++rep)
+    {
+        PreloadRun run = TimePreload(manifest, workers, ioWorkers);
+        walls.push_back(run.WallMs);
+        for (const AsyncTaskLatency& sample : run.Samples)
+        {
+            queued.push_back(ToMilliseconds(sample.Queued));
+            service.push_back(ToMilliseconds(sample.Service));
+            if (sample.MissedDeadline)
+                ++late;
+        }
+    }
+    const std::string prefix = "preload_" + label;
+    Recorder.Record(prefix + "_ms", "ms", Bench::Median(walls));
+    if (queued.empty())
+        return;
+    Recorder.Record(prefix + "_queue_p50_ms", "ms", Bench::Percentile(queued, 0.5));
+    Recorder.Record(prefix + "_queue_p95_ms", "ms", Bench::Percentile(queued, 0.95));
+    Recorder.Record(prefix + "_service_p50_ms", "ms", Bench::Percentile(service, 0.5));
+    Recorder.Record(prefix + "_service_p95_ms", "ms", Bench::Percentile(service, 0.95));
+    Recorder.Record(prefix + "_late_pct", "%",
+                    100.0 * static_cast<double>(late) / static_cast<double>(queued.size()));
+}
+}
+
+TEST(PreloadLanesBench, Generate)
+{
+    const char* outEnv = std::getenv("SENCHA_PRELOAD_LANES_BENCH_OUT");
+    if (outEnv == nullptr)
+    {
+        GTEST_SKIP() << "set SENCHA_PRELOAD_LANES_BENCH_OUT to record the preload "
+                        "lanes bench (use scripts/bench_preload_lanes.sh)";
+    }
+
+    const fs::path jsonPath(outEnv);
+    if (jsonPath.has_parent_path() && !jsonPath.parent_path().empty())
+        fs::create_directories(jsonPath.parent_path());
+
+    Recorder.Clear();
+    const int reps = Bench::RepsFromEnvironment("SENCHA_PRELOAD_LANES_REPS", 5);
+
+    BenchManifest manifest;
+    ASSERT_TRUE(PrepareManifest(manifest));
+
+    // Untimed: pulls every file into the page cache.
+    (void)TimePreload(manifest, 1, 0);
+
+    Recorder.Record("preload_assets", "count", static_cast<double>(manifest.Paths.size()));
+    MeasureConfiguration(manifest, "single_lane", 1, 0, reps);
+    for (uint32_t workers : { 1u, 2u, 4u, 8u })
+    {
+        MeasureConfiguration(manifest, "w" + std::to_string(workers), workers,
+                             std::max(1u, workers / 2), reps);
+    }
+
+    std::error_code ec;
+    fs::remove_all(manifest.Root, ec);
+
+    ASSERT_TRUE(Recorder.WriteJson(jsonPath));
+    fs::path csvPath = jsonPath;
+    csvPath.replace_extension(".csv");
+    ASSERT_TRUE(Recorder.WriteCsv(csvPath));
+}
@@ -0,0 +1,224 @@
+// Evidence generator: startup registry cost at 10k and 50k assets, walking the
+// assets root against mapping the cook's .sreg index of it.
+//
+// Skipped unless SENCHA_REGISTRY_INDEX_BENCH_OUT names the output path (a .json
+// is written there and a .csv beside it). Run it through
+// scripts/bench_registry_index.sh; compare two runs with
+// scripts/bench_streaming_compare.py.
+//
+// Each root is a synthetic content tree shaped like a project's: authored
+// .smat materials, cooked .smesh meshes, and cooked .stex textures listed in
+// .cooked/index.json under their source .png paths, spread over a hundred
+// directories. Files are small, so the walk's hashing is as cheap as it gets;
+// a real tree makes the walk slower and leaves the index where it is. Every
+// timing runs against a warm page cache; a cold start adds the walk's I/O,
+// which the index does not do.
+//
+// Per asset count (n10k, n50k):
+//   walk_*_ms            median: both directory scans and RegisterCookedAssets
+//                        into an empty registry -- startup without an index
+//   index_mount_*_ms     median: AssetRegistryIndex::Open (map and validate)
+//                        and MountIndex -- startup with one
+//   index_resolve_*_ms   median: a mounted registry resolving a zone's worth
+//                        of paths (one in a hundred) for the first time
+//   index_write_*_ms     the cook writing the index from a walked registry
+//   index_check_*_ms     the debug path: the walk again, compared record by
+//                        record with the index
+//   index_*_kib          size of the index file
+//   assets_*             records in the tree (count; a changed tree is not the
+//                        same benchmark)
+
+#include <gtest/gtest.h>
+
+#include "BenchRecorder.h"
+
+#include <assets/cook/AssetRegistryIndexBuilder.h>
+#include <core/assets/AssetKindRegistry.h>
+#include <core/assets/AssetRegistry.h>
+#include <core/assets/AssetRegistryIndex.h>
+#include <core/logging/LoggingProvider.h>
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+namespace fs = std::filesystem;
+
+Bench::Recorder Recorder;
+
+constexpr int kDirectories = 100;
+
+void WriteFile(const fs::path& path, const std::string& contents)
+{
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+}
+
+// A tree of `count` records: two in five authored materials, and the rest
+// split between cooked meshes and cooked textures. A cooked texture registers
+// twice, by location and by its source path, as it does in a real tree.
+bool PrepareTree(const fs::path& root, int count, std::vector<std::string>& paths)
+{
+    fs::remove_all(root);
+    for (int dir = 0; dir < kDirectories; ++dir)
+    {
+        const std::string name = "d" + std::to_string(dir);
+        fs::create_directories(root / "materials" / name);
+        fs::create_directories(root / ".cooked" / "meshes" / name);
+        fs::create_directories(root / ".cooked" / "textures" / name);
+    }
+
+    std::string index = "{\n  \"version\": 7,\n  \"sources\": [\n";
+    bool firstSource = true;
+    const std::string filler(192, 'x');
+    for (int i = 0; static_cast<int>(paths.size()) < count; ++i)
+    {
+        const std::string dir = "d" + std::to_string(i % kDirectories) + "/";
+        const std::string stem = "a" + std::to_string(i);
+        switch (i % 5)
+        {
+        case 0:
+        case 1:
+            WriteFile(root / "materials" / (dir + stem + ".smat"), "{\"i\": " + std::to_string(i) + "}");
+            paths.push_back("asset://materials/" + dir + stem + ".smat");
+            break;
+        case 2:
+        case 3:
+            WriteFile(root / ".cooked" / "meshes" / (dir + stem + ".smesh"), filler + stem);
+            paths.push_back("asset://meshes/" + dir + stem + ".smesh");
+            break;
+        default:
+        {
+            const std::string file = ".cooked/textures/" + dir + stem + ".stex";
+            WriteFile(root / file, filler + stem);
+            paths.push_back("asset://textures/" + dir + stem + ".stex");
+            paths.push_back("asset://textures/" + dir + stem + ".png");
+            index += std::string(firstSource ? "" : ",\n")
+                + "    { \"source\": \"textures/" + dir + stem + ".png\", "
+                + "\"input_fingerprint\": \"00000000000000" + std::to_string(10 + i % 90) + "\", "
+                + "\"artifacts\": [ { \"path\": \"asset://textures/" + dir + stem + ".png\", "
+                + "\"file\": \"" + file + "\", \"type\": \"Texture\", "
+                + "\"hash\": \"0000000000000000\" } ] }";
+            firstSource = false;
+            break;
+        }
+        }
+    }
+    index += "\n  ]\n}\n";
+    WriteFile(root / ".cooked" / "index.json", index);
+    return fs::exists(root / ".cooked" / "index.json");
+}
+
+void Walk(const fs::path& root, AssetRegistry& registry)
+{
+    ScanAssetsDirectory(root.generic_string(), registry, BuiltinAssetKindRegistry());
+    ScanAssetsDirectory((root / ".cooked").generic_string(), registry, BuiltinAssetKindRegistry());
+    RegisterCookedAssets(root.generic_string(), registry);
+}
+
+void MeasureTree(const std::string& label, int count, int reps)
+{
+    const fs::path root = fs::temp_directory_path() / ("sencha_registry_index_bench_" + label);
+    std::vector<std::string> paths;
+    ASSERT_TRUE(PrepareTree(root, count, paths));
+    LoggingProvider logging;
+
+    std::vector<double> walks;
+    std::size_t walked = 0;
+    for (int rep = 0; rep <= reps; ++rep)
+    {
+        AssetRegistry registry(logging);
+        const Bench::Clock::time_point start = Bench::Clock::now();
+        Walk(root, registry);
+        const double elapsed = Bench::MillisecondsSince(start);
+        // The first pass only warms the page cache.
+        if (rep > 0)
+            walks.push_back(elapsed);
+        walked = registry.Records().size();
+    }
+
+    const std::string indexPath = AssetRegistryIndexPath(root.generic_string());
+    double writeMs = 0.0;
+    {
+        AssetRegistry registry(logging);
+        Walk(root, registry);
+        std::string error;
+        const Bench::Clock::time_point start = Bench::Clock::now();
+        ASSERT_TRUE(WriteAssetRegistryIndex(registry, root.generic_string(), indexPath,
+                                            nullptr, &error)) << error;
+        writeMs = Bench::MillisecondsSince(start);
+    }
+
+    std::vector<double> mounts;
+    std::vector<double> resolves;
+    for (int rep = 0; rep <= reps; ++rep)
+    {
+        AssetRegistryIndex index;
+        AssetRegistry registry(logging);
+        const Bench::Clock::time_point start = Bench::Clock::now();
+        ASSERT_TRUE(index.Open(indexPath, root.generic_string()));
+        registry.MountIndex(&index);
+        const double mountMs = Bench::MillisecondsSince(start);
+
+        const Bench::Clock::time_point resolveStart = Bench::Clock::now();
+        for (std::size_t i = 0; i < paths.size(); i += 100)
+            ASSERT_NE(registry.FindByPath(paths[i]), nullptr) << paths[i];
+        const double resolveMs = Bench::MillisecondsSince(resolveStart);
+        if (rep > 0)
+        {
+            mounts.push_back(mountMs);
+            resolves.push_back(resolveMs);
+        }
+    }
+
+    AssetRegistryIndex index;
+    ASSERT_TRUE(index.Open(indexPath, root.generic_string()));
+    const Bench::Clock::time_point checkStart = Bench::Clock::now();
+    const AssetRegistryIndexCheck check =
+        CheckAssetRegistryIndex(index, BuiltinAssetKindRegistry(), logging);
+    const double checkMs = Bench::MillisecondsSince(checkStart);
+    EXPECT_TRUE(check.Matches());
+    EXPECT_EQ(walked, paths.size());
+
+    Recorder.Record("assets_" + label, "count", static_cast<double>(walked));
+    Recorder.Record("walk_" + label + "_ms", "ms", Bench::Median(walks));
+    Recorder.Record("index_mount_" + label + "_ms", "ms", Bench::Median(mounts));
+    Recorder.Record("index_resolve_" + label + "_ms", "ms", Bench::Median(resolves));
+    Recorder.Record("index_write_" + label + "_ms", "ms", writeMs);
+    Recorder.Record("index_check_" + label + "_ms", "ms", checkMs);
+    Recorder.Record("index_" + label + "_kib", "kib",
+                    static_cast<double>(fs::file_size(indexPath)) / 1024.0);
+
+    index.Close();
+    std::error_code ec;
+    fs::remove_all(root, ec);
+}
+}
+
+TEST(RegistryIndexBench, Generate)
+{
+    const char* outEnv = std::getenv("SENCHA_REGISTRY_INDEX_BENCH_OUT");
+    if (outEnv == nullptr)
+    {
+        GTEST_SKIP() << "set SENCHA_REGISTRY_INDEX_BENCH_OUT to record the registry "
+                        "index bench (use scripts/bench_registry_index.sh)";
+    }
+
+    const fs::path jsonPath(outEnv);
+    if (jsonPath.has_parent_path() && !jsonPath.parent_path().empty())
+        fs::create_directories(jsonPath.parent_path());
+
+    Recorder.Clear();
+    const int reps = Bench::RepsFromEnvironment("SENCHA_REGISTRY_INDEX_REPS", 3);
+    MeasureTree("n10k", 10000, reps);
+    MeasureTree("n50k", 50000, reps);
+
+    ASSERT_TRUE(Recorder.WriteJson(jsonPath));
+    fs::path csvPath = jsonPath;
+    csvPath.replace_extension(".csv");
+    ASSERT_TRUE(Recorder.WriteCsv(csvPath));
+}
@@ -1,22 +1,31 @@
 // SceneFieldCodec<T> is the per-field hook the generic component serializer
 // calls for types whose scene form is not their in-memory form. Asset handles
-// are the case that exercises every branch: they serialize as a path, may carry
-// a stamped id, and must resolve back through the asset registry on load.
+// are the case that exercises every branch: they serialize as a path (an index
+// into the scene's asset table in binary), may carry a stamped id, and must
+// resolve back through the asset registry on load.
 
 #include <gtest/gtest.h>
 
 #include <assets/runtime/AssetSystem.h>
 #include <core/json/JsonParser.h>
 #include <core/logging/LoggingProvider.h>
+#include <core/serialization/BinaryArchive.h>
 #include <core/serialization/JsonArchive.h>
+#include <core/serialization/Serialize.h>
 #include <render/MaterialCache.h>
 #include <render/static_mesh/StaticMeshHandle.h>
 #include <world/registry/Registry.h>
+#include <world/serialization/SceneAssetTable.h>
 #include <world/serialization/SceneFieldCodec.h>
 #include <world/serialization/SceneSerializer.h>
 
+#include <algorithm>
+#include <optional>
+#include <sstream>
+#include <string>
 #include <string_view>
 #include <tuple>
+#include <vector>
 
 struct SceneCodecMaterialComponent
 {
@@ -309,3 +318,202 @@ TEST(SceneFieldCodec, StaticMeshHandleRejectsWrongLegacyObjectType)
     EXPECT_FALSE(SceneFieldCodec<StaticMeshHandle>::Load(archive, "", loaded, context));
     EXPECT_FALSE(archive.Ok());
 }
+
+TEST(SceneFieldCodec, BinarySceneRoundTripsHandlesThroughOneAssetTableEntry)
+{
+    ComponentSerializerRegistry serializers;
+    RegisterComponent<SceneCodecMaterialComponent>(serializers);
+
+    LoggingProvider logging;
+    AssetRegistry assetRegistry(logging);
+    MaterialCache materials;
+    AssetSystem assets(logging, assetRegistry, nullptr, &materials);
+    MaterialHandle red = assets.RegisterProceduralMaterial(
+        "asset://materials/dev/red.smat",
+        Material{ .Pass = ShaderPassId::ForwardOpaque, .BaseColor = Vec4(1.0f, 0.0f, 0.0f, 1.0f) });
+    MaterialHandle blue = assets.RegisterProceduralMaterial(
+        "asset://materials/dev/blue.smat",
+        Material{ .Pass = ShaderPassId::ForwardOpaque, .BaseColor = Vec4(0.0f, 0.0f, 1.0f, 1.0f) });
+
+    Registry source;
+    source.Components.RegisterComponent<SceneCodecMaterialComponent>();
+    for (MaterialHandle material : { red, red, blue, red })
+    {
+        EntityId entity = source.Components.CreateEntity();
+        source.Components.AddComponent(entity, SceneCodecMaterialComponent{ .Material = material });
+    }
+
+    SceneSerializationContext context(logging, &assets);
+    std::stringstream stream(std::ios::in | std::ios::out | std::ios::binary);
+    BinaryWriter writer(stream);
+    ASSERT_TRUE(SaveSceneBinary(source, serializers, writer, context));
+    EXPECT_EQ(context.AssetTable, nullptr);
+
+    // Four fields, two assets: each path is in the stream once.
+    const std::string bytes = stream.str();
+    const std::size_t first = bytes.find("asset://materials/dev/red.smat");
+    ASSERT_NE(first, std::string::npos);
+    EXPECT_EQ(bytes.find("asset://materials/dev/red.smat", first + 1), std::string::npos);
+
+    Registry loaded;
+    BinaryReader reader(stream);
+    ASSERT_TRUE(LoadSceneBinary(reader, loaded, serializers, context));
+    EXPECT_EQ(context.AssetTable, nullptr);
+
+    std::vector<MaterialHandle> loadedMaterials;
+    loaded.Components.ForEachComponent<SceneCodecMaterialComponent>(
+        [&](EntityId, const SceneCodecMaterialComponent& component)
+        {
+            loadedMaterials.push_back(component.Material);
+        });
+    ASSERT_EQ(loadedMaterials.size(), 4u);
+    EXPECT_EQ(std::count(loadedMaterials.begin(), loadedMaterials.end(), red), 3);
+    EXPECT_EQ(std::count(loadedMaterials.begin(), loadedMaterials.end(), blue), 1);
+}
+
+TEST(SceneFieldCodec, BinaryHandleFieldRequiresAnAssetTable)
+{
+    LoggingProvider logging;
+    AssetRegistry registry(logging);
+    MaterialCache materials;
+    AssetSystem assets(logging, registry, nullptr, &materials);
+    MaterialHandle handle = assets.RegisterProceduralMaterial(
+        "asset://materials/dev/red.smat",
+        Material{ .Pass = ShaderPassId::ForwardOpaque, .BaseColor = Vec4(1.0f, 0.0f, 0.0f, 1.0f) });
+
+    SceneSerializationContext context(logging, &assets);
+    std::stringstream stream(std::ios::in | std::ios::out | std::ios::binary);
+    BinaryWriter writer(stream);
+    BinaryWriteArchive archive(writer);
+    EXPECT_FALSE(SceneFieldCodec<MaterialHandle>::Save(archive, "material", handle, context));
+    EXPECT_FALSE(archive.Ok());
+}
+
+TEST(SceneFieldCodec, BinaryHandleFieldFailsOnAnUnresolvedTableEntry)
+{
+    LoggingProvider logging;
+    AssetRegistry registry(logging);
+    MaterialCache materials;
+    AssetSystem assets(logging, registry, nullptr, &materials);
+
+    // The entry names an asset this registry does not know, so the batched
+    // resolve leaves it empty and only the field that uses it fails.
+    SceneAssetTable table;
+    ASSERT_EQ(table.Intern(AssetType::Material, "asset://materials/dev/missing.smat"), 0u);
+    EXPECT_EQ(table.Resolve(assets), 1u);
+
+    SceneSerializationContext context(logging, &assets);
+    context.AssetTable = &table;
+
+    std::stringstream stream(std::ios::in | std::ios::out | std::ios::binary);
+    BinaryWriter writer(stream);
+    ASSERT_TRUE(Serialize(writer, std::uint32_t{ 0 }));
+    BinaryReader reader(stream);
+    BinaryReadArchive archive(reader);
+    MaterialHandle loaded;
+    EXPECT_FALSE(SceneFieldCodec<MaterialHandle>::Load(archive, "material", loaded, context));
+    EXPECT_FALSE(archive.Ok());
+    table.ReleaseAll(assets);
+}
+
+TEST(SceneFieldCodec, NullHandleIsNoRefInBothForms)
+{
+    LoggingProvider logging;
+    AssetRegistry registry(logging);
+    MaterialCache materials;
+    AssetSystem assets(logging, registry, nullptr, &materials);
+    SceneSerializationContext context(logging, &assets);
+
+    // Text leaves the key out, so the field's default applies on load.
+    JsonWriteArchive text;
+    text.BeginObject(std::string_view{});
+    ASSERT_TRUE(SceneFieldCodec<MaterialHandle>::Save(text, "material", MaterialHandle{}, context));
+    text.End();
+    const JsonValue json = text.TakeValue();
+    ASSERT_TRUE(json.IsObject());
+    EXPECT_EQ(json.Find("material"), nullptr);
+
+    // Binary keeps the slot and reads it back as a null handle, with nothing
+    // interned.
+    SceneAssetTable table;
+    context.AssetTable = &table;
+    std::stringstream stream(std::ios::in | std::ios::out | std::ios::binary);
+    BinaryWriter writer(stream);
+    BinaryWriteArchive out(writer);
+    ASSERT_TRUE(SceneFieldCodec<MaterialHandle>::Save(out, "material", MaterialHandle{}, context));
+    EXPECT_TRUE(table.Empty());
+
+    BinaryReader reader(stream);
+    BinaryReadArchive in(reader);
+    MaterialHandle loaded = MaterialHandle::FromToken(7);
+    ASSERT_TRUE(SceneFieldCodec<MaterialHandle>::Load(in, "material", loaded, context));
+    EXPECT_FALSE(loaded.IsValid());
+}
+
+TEST(SceneFieldCodec, TranscodeCarriesStampedRefsWithoutAnAssetSystem)
+{
+    ComponentSerializerRegistry serializers;
+    RegisterComponent<SceneCodecMaterialComponent>(serializers);
+
+    const std::optional<JsonValue> scene = JsonParse(R"({
+        "version": 1,
+        "entities": [
+            { "components": { "SceneCodecMaterial": {
+                "material": { "id": "00000000000000ab", "path": "asset://materials/dev/red.smat" } } } },
+            { "components": { "SceneCodecMaterial": {
+                "material": "asset://materials/dev/blue.smat" } } }
+        ]
+    })");
+    ASSERT_TRUE(scene.has_value());
+
+    // Nothing here could load a material: the refs pass through as refs.
+    LoggingProvider logging;
+    std::stringstream stream(std::ios::in | std::ios::out | std::ios::binary);
+    BinaryWriter writer(stream);
+    SceneSaveError saveError;
+    ASSERT_TRUE(TranscodeSceneJsonToBinary(*scene, serializers, writer, logging, &saveError))
+        << saveError.Message;
+
+    BinaryReader reader(stream);
+    SceneLoadError loadError;
+    const JsonValue back = TranscodeSceneBinaryToJson(reader, serializers, logging, &loadError);
+    ASSERT_FALSE(back.IsNull()) << loadError.Message;
+
+    const JsonValue* entities = back.Find("entities");
+    ASSERT_NE(entities, nullptr);
+    ASSERT_EQ(entities->AsArray().size(), 2u);
+    const auto materialOf = [&](std::size_t index) {
+        return entities->AsArray()[index].Find("components")
+            ->Find("SceneCodecMaterial")->Find("material");
+    };
+
+    const JsonValue* stamped = materialOf(0);
+    ASSERT_NE(stamped, nullptr);
+    ASSERT_TRUE(stamped->IsObject());
+    EXPECT_EQ(stamped->Find("id")->AsString(), "00000000000000ab");
+    EXPECT_EQ(stamped->Find("path")->AsString(), "asset://materials/dev/red.smat");
+
+    const JsonValue* plain = materialOf(1);
+    ASSERT_NE(plain, nullptr);
+    ASSERT_TRUE(plain->IsString());
+    EXPECT_EQ(plain->AsString(), "asset://materials/dev/blue.smat");
+}
+
+TEST(SceneFieldCodec, TranscodeRejectsAComponentWithoutASerializer)
+{
+    ComponentSerializerRegistry serializers;
+    RegisterComponent<SceneCodecMaterialComponent>(serializers);
+
+    const std::optional<JsonValue> scene = JsonParse(R"({
+        "version": 1,
+        "entities": [ { "components": { "Unregistered": {} } } ]
+    })");
+    ASSERT_TRUE(scene.has_value());
+
+    LoggingProvider logging;
+    std::stringstream stream(std::ios::in | std::ios::out | std::ios::binary);
+    BinaryWriter writer(stream);
+    SceneSaveError error;
+    EXPECT_FALSE(TranscodeSceneJsonToBinary(*scene, serializers, writer, logging, &error));
+    EXPECT_NE(error.Message.find("Unregistered"), std::string::npos) << error.Message;
+}
@@ -0,0 +1,207 @@
+// Evidence generator: the same scene loaded from JSON and from the binary
+// format, now that binary carries asset handles through a SceneAssetTable.
+//
+// Skipped unless SENCHA_SCENE_FORMAT_BENCH_OUT names the output path (a .json
+// is written there and a .csv beside it). Run it through
+// scripts/bench_scene_format.sh; compare two runs with
+// scripts/bench_streaming_compare.py.
+//
+// The scene is what a cooked zone is mostly made of: every entity a
+// LocalTransform and a material handle, the handles drawn from a small shared
+// set the way a level reuses its materials. Materials are procedural, so the
+// timings are the formats' cost and the handle resolution, not asset I/O.
+// Both loads start from bytes in memory.
+//
+// Per entity count (n10k, n50k):
+//   json_load_*_ms     median: JsonParse and LoadSceneJson, one path
+//                      resolution per handle field
+//   binary_load_*_ms   median: LoadSceneBinary, one resolution per table
+//                      entry and an index per field
+//   json_*_kib         size of the JSON text
+//   binary_*_kib       size of the binary scene
+//   entities_*         entities in the scene (count)
+//   materials_*        distinct materials the scene references (count)
+
+#include <gtest/gtest.h>
+
+#include "BenchRecorder.h"
+
+#include <assets/runtime/AssetSystem.h>
+#include <core/assets/AssetRegistry.h>
+#include <core/json/JsonParser.h>
+#include <core/json/JsonStringify.h>
+#include <core/logging/LoggingProvider.h>
+#include <core/serialization/GrowableWriter.h>
+#include <core/serialization/SpanReader.h>
+#include <math/MathSchemas.h>
+#include <render/MaterialCache.h>
+#include <world/registry/Registry.h>
+#include <world/serialization/SceneSerializer.h>
+#include <world/transform/TransformComponents.h>
+
+#include <cstdlib>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <vector>
+
+struct SceneFormatBenchMaterialComponent
+{
+    MaterialHandle Material;
+};
+
+template <>
+struct TypeSchema<SceneFormatBenchMaterialComponent>
+{
+    static constexpr std::string_view Name = "SceneFormatBenchMaterial";
+
+    static auto Fields()
+    {
+        return std::tuple{
+            MakeField("material", &SceneFormatBenchMaterialComponent::Material),
+        };
+    }
+};
+
+template <>
+struct ComponentStorageTraits<SceneFormatBenchMaterialComponent>
+{
+    static constexpr std::uint32_t BinaryChunkId = MakeFourCC('B', 'M', 'A', 'T');
+
+    static void Register(World& world)
+    {
+        if (!world.IsRegistered<SceneFormatBenchMaterialComponent>())
+            world.RegisterComponent<SceneFormatBenchMaterialComponent>();
+    }
+
+    static void Register(Registry& registry)
+    {
+        Register(registry.Components);
+    }
+
+    static bool Add(World& world, EntityId entity, SceneFormatBenchMaterialComponent component)
+    {
+        if (world.HasComponent<SceneFormatBenchMaterialComponent>(entity))
+            return false;
+        world.AddComponent(entity, component);
+        return true;
+    }
+
+    static bool Add(Registry& registry, EntityId entity, SceneFormatBenchMaterialComponent component)
+    {
+        return Add(registry.Components, entity, component);
+    }
+};
+
+namespace
+{
+namespace fs = std::filesystem;
+
+Bench::Recorder Recorder;
+
+constexpr int kMaterials = 256;
+
+void MeasureScene(const std::string& label, int entities, int reps)
+{
+    ComponentSerializerRegistry serializers;
+    RegisterComponent<LocalTransform>(serializers);
+    RegisterComponent<SceneFormatBenchMaterialComponent>(serializers);
+
+    LoggingProvider logging;
+    AssetRegistry assetRegistry(logging);
+    MaterialCache materialCache;
+    AssetSystem assets(logging, assetRegistry, nullptr, &materialCache);
+
+    std::vector<MaterialHandle> materials;
+    for (int i = 0; i < kMaterials; ++i)
+    {
+        materials.push_back(assets.RegisterProceduralMaterial(
+            "asset://materials/bench/m" + std::to_string(i) + ".smat",
+            Material{ .Pass = ShaderPassId::ForwardOpaque }));
+        ASSERT_TRUE(materials.back().IsValid());
+    }
+
+    Registry source;
+    source.Components.RegisterComponent<SceneFormatBenchMaterialComponent>();
+    source.Components.RegisterComponent<LocalTransform>();
+    for (int i = 0; i < entities; ++i)
+    {
+        const EntityId entity = source.Components.CreateEntity();
+        source.Components.AddComponent(entity, LocalTransform{ Transform3f(
+            Vec3d(static_cast<float>(i % 100), 0.0f, static_cast<float>(i / 100)),
+            Quatf::Identity(),
+            Vec3d(1.0f, 1.0f, 1.0f)) });
+        source.Components.AddComponent(
+            entity, SceneFormatBenchMaterialComponent{ .Material = materials[i % kMaterials] });
+    }
+
+    SceneSerializationContext context(logging, &assets);
+    const std::string jsonText = JsonStringify(SaveSceneJson(source, serializers, context));
+
+    GrowableWriter binaryWriter;
+    BinaryWriter writer(binaryWriter);
+    ASSERT_TRUE(SaveSceneBinary(source, serializers, writer, context));
+    const std::vector<std::byte> binaryBytes = binaryWriter.Take();
+
+    std::vector<double> jsonLoads;
+    std::vector<double> binaryLoads;
+    // The first pass of each only warms the caches.
+    for (int rep = 0; rep <= reps; ++rep)
+    {
+        {
+            Registry loaded;
+            SceneLoadError error;
+            const Bench::Clock::time_point start = Bench::Clock::now();
+            const std::optional<JsonValue> parsed = JsonParse(jsonText);
+            ASSERT_TRUE(parsed.has_value());
+            ASSERT_TRUE(LoadSceneJson(*parsed, loaded, serializers, context, &error)) << error.Message;
+            const double elapsed = Bench::MillisecondsSince(start);
+            if (rep > 0)
+                jsonLoads.push_back(elapsed);
+        }
+        {
+            Registry loaded;
+            SceneLoadError error;
+            SpanReader span(binaryBytes);
+            BinaryReader reader(span);
+            const Bench::Clock::time_point start = Bench::Clock::now();
+            ASSERT_TRUE(LoadSceneBinary(reader, loaded, serializers, context, &error)) << error.Message;
+            const double elapsed = Bench::MillisecondsSince(start);
+            if (rep > 0)
+                binaryLoads.push_back(elapsed);
+        }
+    }
+
+    Recorder.Record("entities_" + label, "count", static_cast<double>(entities));
+    Recorder.Record("materials_" + label, "count", static_cast<double>(kMaterials));
+    Recorder.Record("json_load_" + label + "_ms", "ms", Bench::Median(jsonLoads));
+    Recorder.Record("binary_load_" + label + "_ms", "ms", Bench::Median(binaryLoads));
+    Recorder.Record("json_" + label + "_kib", "kib", static_cast<double>(jsonText.size()) / 1024.0);
+    Recorder.Record("binary_" + label + "_kib", "kib", static_cast<double>(binaryBytes.size()) / 1024.0);
+}
+}
+
+TEST(SceneFormatBench, Generate)
+{
+    const char* outEnv = std::getenv("SENCHA_SCENE_FORMAT_BENCH_OUT");
+    if (outEnv == nullptr)
+    {
+        GTEST_SKIP() << "set SENCHA_SCENE_FORMAT_BENCH_OUT to record the scene "
+                        "format bench (use scripts/bench_scene_format.sh)";
+    }
+
+    const fs::path jsonPath(outEnv);
+    if (jsonPath.has_parent_path() && !jsonPath.parent_path().empty())
+        fs::create_directories(jsonPath.parent_path());
+
+    Recorder.Clear();
+    const int reps = Bench::RepsFromEnvironment("SENCHA_SCENE_FORMAT_REPS", 3);
+    MeasureScene("n10k", 10000, reps);
+    MeasureScene("n50k", 50000, reps);
+
+    ASSERT_TRUE(Recorder.WriteJson(jsonPath));
+    fs::path csvPath = jsonPath;
+    csvPath.replace_extension(".csv");
+    ASSERT_TRUE(Recorder.WriteCsv(csvPath));
+}
@@ -90,10 +90,10 @@ TEST(SceneSerializationGolden, BinaryPayloadIsUnchanged)
     ASSERT_TRUE(SaveSceneBinary(registry, serializers, writer, &error)) << error.Message;
 
     const std::string bytes = stream.str();
-    // Constant last moved by PersistentIdComponent joining the manifest: the
-    // binary form writes one chunk per registered serializer, so a new
-    // component appends an empty chunk even when no entity carries it.
-    EXPECT_EQ(HashOfString(bytes), 0xb474dcf75ae1ce7aULL)
+    // Constant last moved by component chunks going to version 2, which frames
+    // every record with its payload size. A new component also moves it: the
+    // binary form writes one chunk per registered serializer, empty or not.
+    EXPECT_EQ(HashOfString(bytes), 0xd974ad33547b128bULL)
         << "scene binary changed; if that was intended, update the constant."
         << " size=" << bytes.size();
 }
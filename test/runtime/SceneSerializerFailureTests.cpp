@@ -9,12 +9,15 @@
 #include <core/serialization/BinaryFormat.h>
 #include <core/serialization/BinaryReader.h>
 #include <core/serialization/BinaryWriter.h>
+#include <core/serialization/GrowableWriter.h>
 #include <core/serialization/Serialize.h>
+#include <core/serialization/SpanReader.h>
 #include <render/Camera.h>
 #include <world/registry/Registry.h>
 #include <world/serialization/SceneFormat.h>
 #include <world/serialization/SceneSerializer.h>
 
+#include <span>
 #include <sstream>
 
 namespace
@@ -170,3 +173,34 @@ TEST(SceneSerializerFailure, HandlesEmptyRegistry)
     ASSERT_TRUE(LoadSceneJson(json, jsonLoaded, serializers));
     EXPECT_EQ(jsonLoaded.Components.EntityCount(), 0u);
 }
+
+TEST(SceneSerializerFailure, BinaryRejectsTruncatedSceneInMemory)
+{
+    const ComponentSerializerRegistry serializers = MakeSerializers();
+    Registry source = MakeFailureRegistry();
+    const EntityId entity = source.Components.CreateEntity();
+    source.Components.AddComponent(entity, LocalTransform{});
+
+    GrowableWriter memory;
+    BinaryWriter writer(memory);
+    ASSERT_TRUE(SaveSceneBinary(source, serializers, writer));
+    const std::span<const std::byte> bytes = memory.Bytes();
+
+    {
+        SpanReader span(bytes);
+        BinaryReader reader(span);
+        Registry loaded;
+        ASSERT_TRUE(LoadSceneBinary(reader, loaded, serializers));
+        EXPECT_EQ(loaded.Components.CountComponents<LocalTransform>(), 1u);
+    }
+
+    // Cut into the last chunk: its header still reads, its payload does not
+    // fit, and the load fails instead of stopping early.
+    SpanReader span(bytes.first(bytes.size() - 4));
+    BinaryReader reader(span);
+    Registry loaded;
+    SceneLoadError error;
+    EXPECT_FALSE(LoadSceneBinary(reader, loaded, serializers, &error));
+    EXPECT_FALSE(error.Message.empty());
+    EXPECT_EQ(loaded.Components.EntityCount(), 0u);
+}
@@ -0,0 +1,266 @@
+// Evidence generator: binary serialization throughput through a std::iostream
+// and through the memory sources (GrowableWriter, SpanReader) that replaced
+// them on the in-memory paths.
+//
+// Skipped unless SENCHA_SERIALIZATION_BENCH_OUT names the output path (a .json
+// is written there and a .csv beside it). Run it through
+// scripts/bench_serialization.sh; compare two runs with
+// scripts/bench_streaming_compare.py.
+//
+// Every workload is written and read through BinaryWriter/BinaryReader, so the
+// two columns differ only in what sits underneath them.
+//
+//   records_*    a stream of small fixed-layout records, one Write/Read per
+//                field: the per-call cost a component payload pays
+//   array_*      one 16 MiB float column, ReadArray on the way back: a vertex
+//                or index block
+//   scene_*      SaveSceneBinary / LoadSceneBinary of a 20k-entity scene
+//
+// Per workload:
+//   <w>_{stream,memory}_write_mib_s   median serialize throughput
+//   <w>_{stream,memory}_read_mib_s    median deserialize throughput
+//   <w>_kib                           bytes per pass
+//   control_memory_stream_ms          median memcpy of the array workload's
+//                                     bytes; the compare script's drift yardstick
+
+#include <gtest/gtest.h>
+
+#include "BenchRecorder.h"
+
+#include <core/serialization/BinaryReader.h>
+#include <core/serialization/BinaryWriter.h>
+#include <core/serialization/GrowableWriter.h>
+#include <core/serialization/SpanReader.h>
+#include <math/MathSchemas.h>
+#include <world/registry/Registry.h>
+#include <world/serialization/SceneSerializer.h>
+#include <world/transform/TransformComponents.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <span>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+namespace fs = std::filesystem;
+
+Bench::Recorder Recorder;
+
+constexpr int kRecords = 500000;
+constexpr std::size_t kArrayFloats = 4u * 1024u * 1024u;
+constexpr int kSceneEntities = 20000;
+
+struct BenchRecord
+{
+    std::uint32_t Id = 0;
+    float X = 0.0f;
+    float Y = 0.0f;
+    float Z = 0.0f;
+    std::uint16_t Flags = 0;
+};
+
+double MibPerSecond(std::size_t bytes, double milliseconds)
+{
+    const double mib = static_cast<double>(bytes) / (1024.0 * 1024.0);
+    return milliseconds > 0.0 ? mib / (milliseconds / 1000.0) : 0.0;
+}
+
+bool WriteRecords(BinaryWriter& writer)
+{
+    for (int i = 0; i < kRecords; ++i)
+    {
+        const BenchRecord record{ static_cast<std::uint32_t>(i), 1.0f, 2.0f, 3.0f,
+                                  static_cast<std::uint16_t>(i & 0xFFFF) };
+        if (!writer.Write(record.Id) || !writer.Write(record.X) || !writer.Write(record.Y)
+            || !writer.Write(record.Z) || !writer.Write(record.Flags))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ReadRecords(BinaryReader& reader, std::uint64_t& checksum)
+{
+    for (int i = 0; i < kRecords; ++i)
+    {
+        BenchRecord record;
+        if (!reader.Read(record.Id) || !reader.Read(record.X) || !reader.Read(record.Y)
+            || !reader.Read(record.Z) || !reader.Read(record.Flags))
+        {
+            return false;
+        }
+        checksum += record.Id + record.Flags;
+    }
+    return true;
+}
+
+const std::vector<float>& ArrayPayload()
+{
+    static const std::vector<float> values = [] {
+        std::vector<float> v(kArrayFloats);
+        for (std::size_t i = 0; i < v.size(); ++i)
+            v[i] = static_cast<float>(i % 1024);
+        return v;
+    }();
+    return values;
+}
+
+bool WriteArray(BinaryWriter& writer)
+{
+    const std::vector<float>& values = ArrayPayload();
+    return writer.WriteBytes(reinterpret_cast<const char*>(values.data()),
+                             static_cast<std::streamsize>(values.size() * sizeof(float)));
+}
+
+bool ReadArray(BinaryReader& reader, std::uint64_t& checksum)
+{
+    std::vector<float> values;
+    if (!reader.ReadArray(values, kArrayFloats))
+        return false;
+    checksum += static_cast<std::uint64_t>(values.back());
+    return true;
+}
+
+struct SceneFixture
+{
+    ComponentSerializerRegistry Serializers;
+    Registry Source;
+
+    SceneFixture()
+    {
+        RegisterComponent<LocalTransform>(Serializers);
+        Source.Components.RegisterComponent<LocalTransform>();
+        for (int i = 0; i < kSceneEntities; ++i)
+        {
+            const EntityId entity = Source.Components.CreateEntity();
+            Source.Components.AddComponent(entity, LocalTransform{ Transform3f(
+                Vec3d(static_cast<float>(i % 100), 0.0f, static_cast<float>(i / 100)),
+                Quatf::Identity(),
+                Vec3d(1.0f, 1.0f, 1.0f)) });
+        }
+    }
+};
+
+// Times `write` and `read` through a stringstream and through the memory
+// sources and records all four throughputs under `label`.
+template <typename WriteFn, typename ReadFn>
+void MeasureWorkload(const std::string& label, int reps, WriteFn write, ReadFn read)
+{
+    std::vector<double> streamWrites;
+    std::vector<double> streamReads;
+    std::vector<double> memoryWrites;
+    std::vector<double> memoryReads;
+    std::size_t bytes = 0;
+    std::uint64_t checksum = 0;
+
+    // The first pass of each only warms the allocator and caches.
+    for (int rep = 0; rep <= reps; ++rep)
+    {
+        {
+            std::stringstream stream(std::ios::in | std::ios::out | std::ios::binary);
+            BinaryWriter writer(stream);
+            Bench::Clock::time_point start = Bench::Clock::now();
+            ASSERT_TRUE(write(writer));
+            const double writeMs = Bench::MillisecondsSince(start);
+
+            stream.seekg(0);
+            BinaryReader reader(stream);
+            start = Bench::Clock::now();
+            ASSERT_TRUE(read(reader, checksum));
+            const double readMs = Bench::MillisecondsSince(start);
+            if (rep > 0)
+            {
+                streamWrites.push_back(writeMs);
+                streamReads.push_back(readMs);
+            }
+        }
+        {
+            GrowableWriter memory;
+            BinaryWriter writer(memory);
+            Bench::Clock::time_point start = Bench::Clock::now();
+            ASSERT_TRUE(write(writer));
+            const double writeMs = Bench::MillisecondsSince(start);
+
+            SpanReader span(memory.Bytes());
+            BinaryReader reader(span);
+            start = Bench::Clock::now();
+            ASSERT_TRUE(read(reader, checksum));
+            const double readMs = Bench::MillisecondsSince(start);
+            if (rep > 0)
+            {
+                memoryWrites.push_back(writeMs);
+                memoryReads.push_back(readMs);
+            }
+            bytes = memory.Size();
+        }
+    }
+    EXPECT_NE(checksum, 0u);
+
+    Recorder.Record(label + "_stream_write_mib_s", "mib_s", MibPerSecond(bytes, Bench::Median(streamWrites)));
+    Recorder.Record(label + "_stream_read_mib_s", "mib_s", MibPerSecond(bytes, Bench::Median(streamReads)));
+    Recorder.Record(label + "_memory_write_mib_s", "mib_s", MibPerSecond(bytes, Bench::Median(memoryWrites)));
+    Recorder.Record(label + "_memory_read_mib_s", "mib_s", MibPerSecond(bytes, Bench::Median(memoryReads)));
+    Recorder.Record(label + "_kib", "kib", static_cast<double>(bytes) / 1024.0);
+}
+
+void MeasureControl(int reps)
+{
+    const std::vector<float>& values = ArrayPayload();
+    std::vector<float> copy(values.size());
+    std::vector<double> samples;
+    for (int rep = 0; rep <= reps; ++rep)
+    {
+        const Bench::Clock::time_point start = Bench::Clock::now();
+        std::memcpy(copy.data(), values.data(), values.size() * sizeof(float));
+        const double elapsed = Bench::MillisecondsSince(start);
+        if (rep > 0)
+            samples.push_back(elapsed);
+    }
+    EXPECT_EQ(copy.back(), values.back());
+    Recorder.Record("control_memory_stream_ms", "ms", Bench::Median(samples));
+}
+}
+
+TEST(SerializationBench, Generate)
+{
+    const char* outEnv = std::getenv("SENCHA_SERIALIZATION_BENCH_OUT");
+    if (outEnv == nullptr)
+    {
+        GTEST_SKIP() << "set SENCHA_SERIALIZATION_BENCH_OUT to record the serialization "
+                        "bench (use scripts/bench_serialization.sh)";
+    }
+
+    const fs::path jsonPath(outEnv);
+    if (jsonPath.has_parent_path() && !jsonPath.parent_path().empty())
+        fs::create_directories(jsonPath.parent_path());
+
+    Recorder.Clear();
+    const int reps = Bench::RepsFromEnvironment("SENCHA_SERIALIZATION_REPS", 5);
+
+    MeasureControl(reps);
+    MeasureWorkload("records", reps, WriteRecords, ReadRecords);
+    MeasureWorkload("array", reps, WriteArray, ReadArray);
+
+    SceneFixture scene;
+    MeasureWorkload(
+        "scene", reps,
+        [&](BinaryWriter& writer) { return SaveSceneBinary(scene.Source, scene.Serializers, writer); },
+        [&](BinaryReader& reader, std::uint64_t& checksum) {
+            Registry loaded;
+            if (!LoadSceneBinary(reader, loaded, scene.Serializers))
+                return false;
+            checksum += loaded.Components.EntityCount();
+            return true;
+        });
+
+    ASSERT_TRUE(Recorder.WriteJson(jsonPath));
+    fs::path csvPath = jsonPath;
+    csvPath.replace_extension(".csv");
+    ASSERT_TRUE(Recorder.WriteCsv(csvPath));
+}
@@ -1,12 +1,17 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
 #include <cstddef>
 #include <cstring>
+#include <stop_token>
 
 #include <assets/static_mesh/MeshLoader.h>
+#include <assets/static_mesh/MeshQuantization.h>
 #include <assets/static_mesh/MeshSerializer.h>
 #include <assets/static_mesh/StaticMeshFormat.h>
 #include <core/logging/LoggingProvider.h>
+#include <render/static_mesh/MeshLod.h>
 #include <render/static_mesh/StaticMeshPrimitives.h>
 #include <render/static_mesh/MeshValidation.h>
 
@@ -16,6 +21,74 @@ namespace
     {
         return StaticMeshPrimitives::BuildCube(2.0f);
     }
+
+    // A cells x cells unit-UV sheet, bumped so its normals vary.
+    MeshGeometry MakeGrid(uint32_t cells)
+    {
+        MeshGeometry mesh;
+        for (uint32_t y = 0; y <= cells; ++y)
+        {
+            for (uint32_t x = 0; x <= cells; ++x)
+            {
+                const float u = static_cast<float>(x) / cells;
+                const float v = static_cast<float>(y) / cells;
+                StaticMeshVertex vertex;
+                vertex.Position = Vec3d(u * 10.0f, 0.25f * std::sin(u * 9.0f) * std::cos(v * 7.0f), v * 10.0f);
+                vertex.Normal = Vec3d(-0.2f * std::cos(u * 9.0f), 1.0f, 0.1f * std::sin(v * 7.0f)).Normalized();
+                vertex.Uv0 = Vec2d(u, v);
+                vertex.Tangent = Vec4(1.0f, 0.0f, 0.0f, (x + y) % 2 == 0 ? 1.0f : -1.0f);
+                mesh.Vertices.push_back(vertex);
+            }
+        }
+        for (uint32_t y = 0; y < cells; ++y)
+        {
+            for (uint32_t x = 0; x < cells; ++x)
+            {
+                const uint32_t corner = y * (cells + 1) + x;
+                mesh.Indices.insert(mesh.Indices.end(), { corner, corner + cells + 1, corner + 1,
+                                                          corner + 1, corner + cells + 1, corner + cells + 2 });
+            }
+        }
+        mesh.Sections.push_back({
+            .IndexOffset = 0,
+            .IndexCount = static_cast<uint32_t>(mesh.Indices.size()),
+            .VertexOffset = 0,
+            .VertexCount = static_cast<uint32_t>(mesh.Vertices.size()),
+            .MaterialSlot = 0,
+        });
+        RecomputeMeshBounds(mesh);
+        return mesh;
+    }
+
+    // Appends a level drawing the first `triangles` triangles of section 0.
+    void AppendLod(MeshGeometry& mesh, uint32_t triangles, float error)
+    {
+        const StaticMeshSection& section = mesh.Sections[0];
+        const uint32_t offset = static_cast<uint32_t>(mesh.Indices.size());
+        for (uint32_t index = 0; index < triangles * 3; ++index)
+            mesh.Indices.push_back(mesh.Indices[section.IndexOffset + index]);
+        mesh.Sections[0].Lods.push_back({ .IndexOffset = offset, .IndexCount = triangles * 3, .Error = error });
+    }
+
+    // Cuts section 0's base range into meshlets of `triangles` triangles
+    // (the last takes the remainder), each bounded by the section's box.
+    void SliceMeshlets(MeshGeometry& mesh, uint32_t triangles)
+    {
+        StaticMeshSection& section = mesh.Sections[0];
+        const Vec3d center = section.LocalBounds.Center();
+        const float radius = 0.5f * (section.LocalBounds.Max - section.LocalBounds.Min).Magnitude();
+        for (uint32_t offset = 0; offset < section.IndexCount; offset += triangles * 3)
+        {
+            section.Meshlets.push_back({
+                .IndexOffset = section.IndexOffset + offset,
+                .IndexCount = std::min(triangles * 3, section.IndexCount - offset),
+                .Center = center,
+                .Radius = radius,
+                .ConeAxis = Vec3d(0.0f, 1.0f, 0.0f),
+                .ConeCutoff = 0.5f + 0.01f * static_cast<float>(section.Meshlets.size()),
+            });
+        }
+    }
 }
 
 TEST(StaticMeshValidation, CubeMeshValidates)
@@ -163,6 +236,25 @@ TEST(StaticMeshSerialization, RoundTripPreservesCountsAndBounds)
     EXPECT_EQ(loaded.LocalBounds, source.LocalBounds);
 }
 
+TEST(StaticMeshSerialization, StoppedLoadReturnsEmpty)
+{
+    LoggingProvider logging;
+    MeshSerializer serializer(logging);
+    MeshLoader loader(logging);
+
+    std::vector<std::byte> bytes;
+    ASSERT_TRUE(serializer.WriteToBytes(MakeValidMesh(), bytes));
+
+    std::stop_source stop;
+    stop.request_stop();
+
+    MeshGeometry loaded;
+    EXPECT_FALSE(loader.LoadFromBytes(bytes, loaded, stop.get_token()));
+    EXPECT_TRUE(loaded.Vertices.empty());
+    EXPECT_TRUE(loaded.Indices.empty());
+    EXPECT_TRUE(loaded.Sections.empty());
+}
+
 TEST(StaticMeshSerialization, BadMagicFails)
 {
     LoggingProvider logging;
@@ -177,7 +269,7 @@ TEST(StaticMeshSerialization, BadMagicFails)
     EXPECT_FALSE(loader.LoadFromBytes(bytes, loaded));
 }
 
-TEST(StaticMeshSerialization, WritesVersion5AndStride52)
+TEST(StaticMeshSerialization, WritesVersion8AndStride52)
 {
     LoggingProvider logging;
     MeshSerializer serializer(logging);
@@ -189,9 +281,11 @@ TEST(StaticMeshSerialization, WritesVersion5AndStride52)
     SmeshFileHeader header{};
     std::memcpy(&header, bytes.data(), sizeof(header));
     EXPECT_EQ(header.Version, kSmeshFormatVersion);
-    EXPECT_EQ(header.Version, 5u);
+    EXPECT_EQ(header.Version, 8u);
+    EXPECT_EQ(header.Flags & kSmeshFlagQuantized, 0u);
     EXPECT_EQ(header.VertexStride, sizeof(StaticMeshVertex));
     EXPECT_EQ(header.VertexStride, 52u);
+    EXPECT_EQ(header.IndexFormat, SmeshIndexFormat::UInt32);
 }
 
 TEST(StaticMeshSerialization, PreservesLightmapUvChannel)
@@ -225,19 +319,394 @@ TEST(StaticMeshSerialization, PreservesLightmapUvChannel)
 
 TEST(StaticMeshSerialization, RejectsPriorVersion)
 {
-    // One version is live at a time: a v4 file (the baked-direct vertex
-    // channel that the lightmap UVs replaced) must fail rather than load
-    // with reinterpreted channel bytes.
+    // One version is live at a time: a v7 file goes through
+    // migrate_smesh_v7_to_v8.py or a recook, never straight into the loader.
     LoggingProvider logging;
     MeshSerializer serializer(logging);
     MeshLoader loader(logging);
 
     std::vector<std::byte> bytes;
     ASSERT_TRUE(serializer.WriteToBytes(MakeValidMesh(), bytes));
-    const std::uint32_t priorVersion = 4;
+    const std::uint32_t priorVersion = 7;
     std::memcpy(bytes.data() + offsetof(SmeshFileHeader, Version),
                 &priorVersion, sizeof(priorVersion));
 
     MeshGeometry loaded;
     EXPECT_FALSE(loader.LoadFromBytes(bytes, loaded));
 }
+
+// -- Quantized layout (v6) ------------------------------------------------------
+
+TEST(StaticMeshQuantization, OctahedralDirectionsDecodeUnitLengthAndClose)
+{
+    const Vec3d directions[] = {
+        Vec3d(0.0f, 0.0f, 1.0f), Vec3d(0.0f, 0.0f, -1.0f), Vec3d(1.0f, 0.0f, 0.0f),
+        Vec3d(0.0f, -1.0f, 0.0f), Vec3d(0.6f, -0.48f, -0.64f), Vec3d(-0.577f, 0.577f, 0.577f),
+    };
+    for (const Vec3d& direction : directions)
+    {
+        int16_t encoded[2];
+        EncodeOctahedral(direction, encoded);
+        const Vec3d decoded = DecodeOctahedral(encoded);
+        EXPECT_NEAR(decoded.Magnitude(), 1.0f, 1e-5f);
+        EXPECT_GT(decoded.Dot(direction.Normalized()), 0.99999f);
+    }
+}
+
+TEST(StaticMeshSerialization, QuantizedLayoutDecodesWithinTolerance)
+{
+    LoggingProvider logging;
+    MeshSerializer serializer(logging);
+    MeshLoader loader(logging);
+
+    MeshGeometry source = MakeValidMesh();
+    for (std::size_t i = 0; i < source.Vertices.size(); ++i)
+        source.Vertices[i].LightmapU = static_cast<std::uint16_t>(0x0101u * i);
+
+    std::vector<std::byte> full;
+    std::vector<std::byte> quantized;
+    ASSERT_TRUE(serializer.WriteToBytes(source, full));
+    ASSERT_TRUE(serializer.WriteToBytes(source, quantized, SmeshVertexLayout::Quantized));
+    EXPECT_LT(quantized.size(), full.size());
+
+    SmeshFileHeader header{};
+    std::memcpy(&header, quantized.data(), sizeof(header));
+    EXPECT_NE(header.Flags & kSmeshFlagQuantized, 0u);
+    EXPECT_EQ(header.VertexStride, sizeof(SmeshQuantizedVertex));
+    EXPECT_EQ(header.IndexFormat, SmeshIndexFormat::UInt16);
+
+    MeshGeometry loaded;
+    ASSERT_TRUE(loader.LoadFromBytes(quantized, loaded));
+    ASSERT_EQ(loaded.Vertices.size(), source.Vertices.size());
+    EXPECT_EQ(loaded.Indices, source.Indices);
+    EXPECT_EQ(loaded.LocalBounds, source.LocalBounds);
+
+    // Half a step of a 2-unit box, with float slack.
+    const float positionTolerance = 2.0f / 65535.0f;
+    for (std::size_t i = 0; i < source.Vertices.size(); ++i)
+    {
+        const StaticMeshVertex& expected = source.Vertices[i];
+        const StaticMeshVertex& actual = loaded.Vertices[i];
+        EXPECT_LE(Vec3d::Distance(actual.Position, expected.Position), positionTolerance) << i;
+        EXPECT_GT(actual.Normal.Dot(expected.Normal), 0.9999f) << i;
+        EXPECT_NEAR(actual.Uv0.X, expected.Uv0.X, 1.0f / 2048.0f) << i;
+        EXPECT_NEAR(actual.Uv0.Y, expected.Uv0.Y, 1.0f / 2048.0f) << i;
+        EXPECT_EQ(actual.Tangent.W, expected.Tangent.W) << i;
+        EXPECT_EQ(actual.LightmapU, expected.LightmapU) << i;
+    }
+}
+
+TEST(StaticMeshSerialization, QuantizedLayoutIsLessThanHalfTheBytes)
+{
+    LoggingProvider logging;
+    MeshSerializer serializer(logging);
+    MeshLoader loader(logging);
+
+    const MeshGeometry source = MakeGrid(64);
+    std::vector<std::byte> full;
+    std::vector<std::byte> quantized;
+    ASSERT_TRUE(serializer.WriteToBytes(source, full));
+    ASSERT_TRUE(serializer.WriteToBytes(source, quantized, SmeshVertexLayout::Quantized));
+    EXPECT_LT(quantized.size() * 2, full.size());
+
+    MeshGeometry loaded;
+    ASSERT_TRUE(loader.LoadFromBytes(quantized, loaded));
+    ASSERT_EQ(loaded.Vertices.size(), source.Vertices.size());
+    const float positionTolerance = 10.0f / 65535.0f;
+    for (std::size_t i = 0; i < source.Vertices.size(); ++i)
+    {
+        EXPECT_LE(Vec3d::Distance(loaded.Vertices[i].Position, source.Vertices[i].Position),
+                  positionTolerance) << i;
+        EXPECT_GT(loaded.Vertices[i].Normal.Dot(source.Vertices[i].Normal), 0.9999f) << i;
+    }
+}
+
+TEST(StaticMeshSerialization, QuantizedLayoutKeepsFullVerticesForWideUvs)
+{
+    LoggingProvider logging;
+    MeshSerializer serializer(logging);
+    MeshLoader loader(logging);
+
+    // A tiling UV past the half-float limit would lose texels; the writer
+    // keeps the full layout rather than degrade it.
+    MeshGeometry source = MakeValidMesh();
+    source.Vertices[0].Uv0 = Vec2d(12.5f, 0.0f);
+
+    std::vector<std::byte> bytes;
+    ASSERT_TRUE(serializer.WriteToBytes(source, bytes, SmeshVertexLayout::Quantized));
+    SmeshFileHeader header{};
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    EXPECT_EQ(header.Flags & kSmeshFlagQuantized, 0u);
+    EXPECT_EQ(header.VertexStride, sizeof(StaticMeshVertex));
+
+    MeshGeometry loaded;
+    ASSERT_TRUE(loader.LoadFromBytes(bytes, loaded));
+    EXPECT_EQ(loaded.Vertices[0].Uv0, source.Vertices[0].Uv0);
+}
+
+TEST(StaticMeshSerialization, QuantizedIndicesAreSectionRelative)
+{
+    LoggingProvider logging;
+    MeshSerializer serializer(logging);
+    MeshLoader loader(logging);
+
+    // Two cubes, one per section, the second's vertices after the first's.
+    MeshGeometry source = MakeValidMesh();
+    const MeshGeometry second = StaticMeshPrimitives::BuildCube(0.5f);
+    const uint32_t vertexBase = static_cast<uint32_t>(source.Vertices.size());
+    const uint32_t indexBase = static_cast<uint32_t>(source.Indices.size());
+    source.Vertices.insert(source.Vertices.end(), second.Vertices.begin(), second.Vertices.end());
+    for (uint32_t index : second.Indices)
+        source.Indices.push_back(index + vertexBase);
+    source.Sections.push_back({
+        .IndexOffset = indexBase,
+        .IndexCount = static_cast<uint32_t>(second.Indices.size()),
+        .VertexOffset = vertexBase,
+        .VertexCount = static_cast<uint32_t>(second.Vertices.size()),
+        .MaterialSlot = 1,
+    });
+
+    std::vector<std::byte> bytes;
+    ASSERT_TRUE(serializer.WriteToBytes(source, bytes, SmeshVertexLayout::Quantized));
+    SmeshFileHeader header{};
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    ASSERT_EQ(header.IndexFormat, SmeshIndexFormat::UInt16);
+
+    uint16_t stored = 0;
+    std::memcpy(&stored, bytes.data() + header.IndexDataOffset + indexBase * sizeof(uint16_t),
+                sizeof(stored));
+    EXPECT_EQ(stored, second.Indices[0]);
+
+    MeshGeometry loaded;
+    ASSERT_TRUE(loader.LoadFromBytes(bytes, loaded));
+    EXPECT_EQ(loaded.Indices, source.Indices);
+}
+
+TEST(StaticMeshSerialization, QuantizedVertexOutsideEverySectionIsRejected)
+{
+    LoggingProvider logging;
+    MeshSerializer serializer(logging);
+    MeshLoader loader(logging);
+
+    std::vector<std::byte> bytes;
+    ASSERT_TRUE(serializer.WriteToBytes(MakeValidMesh(), bytes, SmeshVertexLayout::Quantized));
+    SmeshFileHeader header{};
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    ASSERT_NE(header.Flags & kSmeshFlagQuantized, 0u);
+
+    // Shrink the section's vertex range so its last vertex has no box.
+    SmeshSectionRecord record{};
+    std::memcpy(&record, bytes.data() + header.SectionTableOffset, sizeof(record));
+    --record.VertexCount;
+    std::memcpy(bytes.data() + header.SectionTableOffset, &record, sizeof(record));
+
+    MeshGeometry loaded;
+    EXPECT_FALSE(loader.LoadFromBytes(bytes, loaded));
+}
+
+// -- LOD chains (v7) ----------------------------------------------------------
+
+TEST(StaticMeshValidation, LodChainsAreChecked)
+{
+    MeshGeometry mesh = MakeGrid(4);
+    AppendLod(mesh, 16, 0.1f);
+    AppendLod(mesh, 8, 0.3f);
+    EXPECT_TRUE(ValidateMeshGeometry(mesh).IsValid());
+
+    MeshGeometry shrinking = mesh;
+    shrinking.Sections[0].Lods[1].Error = 0.05f;
+    EXPECT_FALSE(ValidateMeshGeometry(shrinking).IsValid());
+
+    MeshGeometry ragged = mesh;
+    --ragged.Sections[0].Lods[0].IndexCount;
+    EXPECT_FALSE(ValidateMeshGeometry(ragged).IsValid());
+
+    MeshGeometry outside = mesh;
+    outside.Sections[0].Lods[1].IndexOffset = static_cast<uint32_t>(outside.Indices.size());
+    EXPECT_FALSE(ValidateMeshGeometry(outside).IsValid());
+}
+
+TEST(StaticMeshSerialization, RoundTripPreservesLods)
+{
+    LoggingProvider logging;
+    MeshSerializer serializer(logging);
+    MeshLoader loader(logging);
+
+    MeshGeometry source = MakeGrid(4);
+    AppendLod(source, 16, 0.1f);
+    AppendLod(source, 8, 0.3f);
+
+    for (const SmeshVertexLayout layout : { SmeshVertexLayout::Full, SmeshVertexLayout::Quantized })
+    {
+        std::vector<std::byte> bytes;
+        ASSERT_TRUE(serializer.WriteToBytes(source, bytes, layout));
+
+        MeshGeometry loaded;
+        ASSERT_TRUE(loader.LoadFromBytes(bytes, loaded));
+        EXPECT_EQ(loaded.Indices, source.Indices);
+        ASSERT_EQ(loaded.Sections.size(), 1u);
+        ASSERT_EQ(loaded.Sections[0].Lods.size(), 2u);
+        for (std::size_t level = 0; level < 2; ++level)
+        {
+            EXPECT_EQ(loaded.Sections[0].Lods[level].IndexOffset, source.Sections[0].Lods[level].IndexOffset);
+            EXPECT_EQ(loaded.Sections[0].Lods[level].IndexCount, source.Sections[0].Lods[level].IndexCount);
+            EXPECT_EQ(loaded.Sections[0].Lods[level].Error, source.Sections[0].Lods[level].Error);
+        }
+    }
+}
+
+TEST(StaticMeshSerialization, LodRecordReservedMustBeZero)
+{
+    LoggingProvider logging;
+    MeshSerializer serializer(logging);
+    MeshLoader loader(logging);
+
+    MeshGeometry source = MakeGrid(4);
+    AppendLod(source, 16, 0.1f);
+    std::vector<std::byte> bytes;
+    ASSERT_TRUE(serializer.WriteToBytes(source, bytes));
+    SmeshFileHeader header{};
+    std::memcpy(&header, bytes.data(), sizeof(header));
+
+    // Unquantized: the LOD table directly follows the one section record.
+    const std::size_t lodRecord = header.SectionTableOffset + sizeof(SmeshSectionRecord);
+    const std::uint32_t reserved = 1;
+    std::memcpy(bytes.data() + lodRecord + offsetof(SmeshLodRecord, Reserved0), &reserved, sizeof(reserved));
+
+    MeshGeometry loaded;
+    EXPECT_FALSE(loader.LoadFromBytes(bytes, loaded));
+}
+
+// -- Meshlets (v8) -------------------------------------------------------------
+
+TEST(StaticMeshValidation, MeshletsMustTileTheBaseRange)
+{
+    MeshGeometry mesh = MakeGrid(4);
+    AppendLod(mesh, 8, 0.1f);
+    SliceMeshlets(mesh, 10);
+    ASSERT_EQ(mesh.Sections[0].Meshlets.size(), 4u);
+    EXPECT_TRUE(ValidateMeshGeometry(mesh).IsValid());
+
+    MeshGeometry gap = mesh;
+    gap.Sections[0].Meshlets.erase(gap.Sections[0].Meshlets.begin() + 1);
+    EXPECT_FALSE(ValidateMeshGeometry(gap).IsValid());
+
+    MeshGeometry shortfall = mesh;
+    shortfall.Sections[0].Meshlets.pop_back();
+    EXPECT_FALSE(ValidateMeshGeometry(shortfall).IsValid());
+
+    MeshGeometry ragged = mesh;
+    ragged.Sections[0].Meshlets[0].IndexCount -= 1;
+    ragged.Sections[0].Meshlets[1].IndexOffset -= 1;
+    ragged.Sections[0].Meshlets[1].IndexCount += 1;
+    EXPECT_FALSE(ValidateMeshGeometry(ragged).IsValid());
+
+    MeshGeometry unbounded = mesh;
+    unbounded.Sections[0].Meshlets[2].Radius = -1.0f;
+    EXPECT_FALSE(ValidateMeshGeometry(unbounded).IsValid());
+
+    MeshGeometry badCone = mesh;
+    badCone.Sections[0].Meshlets[3].ConeCutoff = std::nanf("");
+    EXPECT_FALSE(ValidateMeshGeometry(badCone).IsValid());
+}
+
+TEST(StaticMeshSerialization, RoundTripPreservesMeshlets)
+{
+    LoggingProvider logging;
+    MeshSerializer serializer(logging);
+    MeshLoader loader(logging);
+
+    MeshGeometry source = MakeGrid(4);
+    AppendLod(source, 8, 0.1f);
+    SliceMeshlets(source, 10);
+
+    for (const SmeshVertexLayout layout : { SmeshVertexLayout::Full, SmeshVertexLayout::Quantized })
+    {
+        std::vector<std::byte> bytes;
+        ASSERT_TRUE(serializer.WriteToBytes(source, bytes, layout));
+
+        MeshGeometry loaded;
+        ASSERT_TRUE(loader.LoadFromBytes(bytes, loaded));
+        EXPECT_EQ(loaded.Indices, source.Indices);
+        ASSERT_EQ(loaded.Sections.size(), 1u);
+        EXPECT_EQ(loaded.Sections[0].Lods.size(), 1u);
+        const std::vector<StaticMeshMeshlet>& expected = source.Sections[0].Meshlets;
+        const std::vector<StaticMeshMeshlet>& actual = loaded.Sections[0].Meshlets;
+        ASSERT_EQ(actual.size(), expected.size());
+        for (std::size_t i = 0; i < expected.size(); ++i)
+        {
+            EXPECT_EQ(actual[i].IndexOffset, expected[i].IndexOffset);
+            EXPECT_EQ(actual[i].IndexCount, expected[i].IndexCount);
+            EXPECT_EQ(actual[i].Center, expected[i].Center);
+            EXPECT_EQ(actual[i].Radius, expected[i].Radius);
+            EXPECT_EQ(actual[i].ConeAxis, expected[i].ConeAxis);
+            EXPECT_EQ(actual[i].ConeCutoff, expected[i].ConeCutoff);
+        }
+    }
+}
+
+TEST(StaticMeshSerialization, SectionRecordReservedMustBeZero)
+{
+    LoggingProvider logging;
+    MeshSerializer serializer(logging);
+    MeshLoader loader(logging);
+
+    std::vector<std::byte> bytes;
+    ASSERT_TRUE(serializer.WriteToBytes(MakeGrid(2), bytes));
+    SmeshFileHeader header{};
+    std::memcpy(&header, bytes.data(), sizeof(header));
+
+    const std::uint32_t reserved = 1;
+    std::memcpy(bytes.data() + header.SectionTableOffset + offsetof(SmeshSectionRecord, Reserved0),
+                &reserved, sizeof(reserved));
+
+    MeshGeometry loaded;
+    EXPECT_FALSE(loader.LoadFromBytes(bytes, loaded));
+}
+
+TEST(MeshLodSelection, MeshErrorsTakeTheWorstSectionPerLevel)
+{
+    std::vector<StaticMeshSection> sections(2);
+    sections[0].Lods = { { .IndexOffset = 0, .IndexCount = 3, .Error = 0.1f },
+                         { .IndexOffset = 0, .IndexCount = 3, .Error = 0.4f } };
+    sections[1].Lods = { { .IndexOffset = 0, .IndexCount = 3, .Error = 0.2f } };
+
+    // Section 1 stays at its coarsest (0.2) for level 2.
+    const std::vector<float> errors = ComputeMeshLodErrors(sections);
+    ASSERT_EQ(errors.size(), 3u);
+    EXPECT_EQ(errors[0], 0.0f);
+    EXPECT_EQ(errors[1], 0.2f);
+    EXPECT_EQ(errors[2], 0.4f);
+    EXPECT_EQ(ClampSectionLod(sections[1], 2), 1u);
+    EXPECT_EQ(ComputeMeshLodErrors({}).size(), 1u);
+}
+
+TEST(MeshLodSelection, PicksTheCoarsestLevelUnderThePixelBudget)
+{
+    const std::vector<float> errors = { 0.0f, 0.01f, 0.04f, 0.16f };
+    const MeshLodPolicy policy{ .PixelError = 1.0f, .Hysteresis = 0.25f };
+
+    EXPECT_EQ(SelectMeshLod(errors, 200.0f, kNoMeshLod, policy), 0u);
+    EXPECT_EQ(SelectMeshLod(errors, 20.0f, kNoMeshLod, policy), 2u);
+    EXPECT_EQ(SelectMeshLod(errors, 1.0f, kNoMeshLod, policy), 3u);
+
+    // Unknown projection or a zero budget draws full detail.
+    EXPECT_EQ(SelectMeshLod(errors, 0.0f, kNoMeshLod, policy), 0u);
+    EXPECT_EQ(SelectMeshLod(errors, 1.0f, kNoMeshLod, MeshLodPolicy{ .PixelError = 0.0f }), 0u);
+}
+
+TEST(MeshLodSelection, HysteresisHoldsALevelNearItsBoundary)
+{
+    const std::vector<float> errors = { 0.0f, 0.01f, 0.04f };
+    const MeshLodPolicy policy{ .PixelError = 1.0f, .Hysteresis = 0.25f };
+
+    // Level 2 projects to 0.9 px: fresh selection takes it, but an entity
+    // at level 1 waits until it clears 0.75 px.
+    EXPECT_EQ(SelectMeshLod(errors, 22.5f, kNoMeshLod, policy), 2u);
+    EXPECT_EQ(SelectMeshLod(errors, 22.5f, 1, policy), 1u);
+    EXPECT_EQ(SelectMeshLod(errors, 18.0f, 1, policy), 2u);
+
+    // Refining happens at the budget itself.
+    EXPECT_EQ(SelectMeshLod(errors, 22.5f, 2, policy), 2u);
+    EXPECT_EQ(SelectMeshLod(errors, 30.0f, 2, policy), 1u);
+}
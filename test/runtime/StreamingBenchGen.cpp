@@ -15,7 +15,8 @@
 //   iterate_*    does one partitioned World iterate as fast as N worlds did,
 //                and is a dormant partition actually free to skip?
 //   import_*     how long does the owner thread stall publishing a zone, and
-//                how many row migrations does it pay?
+//                how many row migrations does it pay? import_baked_* is the
+//                same zone through its chunk image.
 //   detach_*     how long does unload stall, and are chunk slabs returned?
 //   propagate_*  sweep cost with every local transform dirty, with none dirty,
 //                over a hierarchy, and for the first sweep after a zone attaches
@@ -39,6 +40,7 @@
 #include <world/transform/PropagationOrderCache.h>
 #include <world/transform/TransformComponents.h>
 #include <world/transform/TransformPropagation.h>
+#include <zone/ZoneChunkImage.h>
 #include <zone/ZoneLoadPackage.h>
 #include <zone/ZonePackageImporter.h>
 
@@ -185,6 +187,7 @@ void MeasureImportAndDetach(int entities, int reps)
 
     std::vector<double> importSamples;
     std::vector<double> detachSamples;
+    std::vector<double> bakedSamples;
     uint64_t importMigrations = 0;
     size_t chunksAfterImport = 0;
 
@@ -214,9 +217,25 @@ void MeasureImportAndDetach(int entities, int reps)
         (void)runtime.BeginResidencyProcessing();
         runtime.FinalizeResidencyProcessing();
         detachSamples.push_back(MillisecondsSince(detachStart));
+
+        // The same zone through its chunk image, baked off the clock as the
+        // loader's worker would.
+        RuntimeWorld bakedRuntime(schema);
+        ZoneLoadPackage baked = MakeZonePackage(ZoneId{ 7 }, entities);
+        (void)BakeZoneChunkImage(baked, schema);
+        const auto bakedStart = Clock::now();
+        ASSERT_TRUE(ImportZonePackage(
+            bakedRuntime,
+            schema,
+            baked,
+            ZoneParticipation{ .Visible = true },
+            &error))
+            << error.Message;
+        bakedSamples.push_back(MillisecondsSince(bakedStart));
     }
 
     Record("import_" + label + "_ms", "ms", Median(importSamples));
+    Record("import_baked_" + label + "_ms", "ms", Median(bakedSamples));
     Record("import_" + label + "_row_migrations", "count",
            static_cast<double>(importMigrations));
     Record("import_" + label + "_chunks", "count",
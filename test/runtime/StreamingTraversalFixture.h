@@ -84,7 +84,7 @@ inline std::string ChainManifestJson()
             R"({"id":"%016lx","name":"Zone%d","region":"00000000000000b1",)"
             R"("scene":"levels/z%d.level.json",)"
             R"("bounds":{"min":[%f,0,-8],"max":[%f,4,8]},)"
-            R"("cooked_scene":"levels/z%d.cooked.json",)"
+            R"("cooked_scene":"levels/z%d.cooked.sscn",)"
             R"("cooked_collision":"levels/z%d.collision.json",)"
             R"("content_hash":"%016lx"})",
             static_cast<unsigned long>(0xa0 + index),
@@ -0,0 +1,260 @@
+#include <gtest/gtest.h>
+
+#include <render/TextureResidency.h>
+
+#include <vector>
+
+namespace
+{
+    // A full RGBA8 chain for a square texture of `size` texels.
+    std::vector<TextureMipLevel> MakeChain(std::uint32_t size)
+    {
+        std::vector<TextureMipLevel> mips;
+        std::uint64_t offset = 0;
+        for (std::uint32_t extent = size;; extent /= 2)
+        {
+            const std::uint64_t bytes = TextureMipByteSize(TexturePixelFormat::RGBA8, extent, extent);
+            mips.push_back(TextureMipLevel{ .Width = extent, .Height = extent,
+                                            .Offset = offset, .ByteSize = bytes });
+            offset += bytes;
+            if (extent == 1)
+                break;
+        }
+        return mips;
+    }
+
+    std::uint64_t ChainBytesFrom(const std::vector<TextureMipLevel>& mips, std::uint32_t top)
+    {
+        std::uint64_t bytes = 0;
+        for (std::size_t level = top; level < mips.size(); ++level)
+            bytes += mips[level].ByteSize;
+        return bytes;
+    }
+
+    // Orthographic projection of one world unit per 2 / viewport pixels: with
+    // a scale of 2 and a 1024-pixel viewport, a unit diameter is 1024 pixels.
+    Mat4 UnitOrthographic()
+    {
+        Mat4 projection = Mat4::Identity();
+        projection[1][1] = -2.0f;
+        return projection;
+    }
+
+    const TextureStreamingBudgets kUnlimited{ .ResidentBytes = 0, .UploadBytesPerFrame = 0 };
+}
+
+TEST(TextureResidency, TailStartsAtTheFirstLevelThatFitsTheTailExtent)
+{
+    const std::vector<TextureMipLevel> large = MakeChain(1024);
+    EXPECT_EQ(TextureMipTailTopMip(large, 128), 3u);
+    EXPECT_EQ(TextureMipTailTopMip(large, 1024), 0u);
+
+    const std::vector<TextureMipLevel> small = MakeChain(64);
+    EXPECT_EQ(TextureMipTailTopMip(small, 128), 0u);
+}
+
+TEST(TextureResidency, DesiredLevelKeepsAtLeastOneTexelPerPixel)
+{
+    EXPECT_EQ(TextureDesiredTopMip(1024, 1024, 11, 2000.0f), 0u);
+    EXPECT_EQ(TextureDesiredTopMip(1024, 1024, 11, 1024.0f), 0u);
+    EXPECT_EQ(TextureDesiredTopMip(1024, 1024, 11, 600.0f), 0u);
+    EXPECT_EQ(TextureDesiredTopMip(1024, 1024, 11, 512.0f), 1u);
+    EXPECT_EQ(TextureDesiredTopMip(1024, 1024, 11, 100.0f), 3u);
+    EXPECT_EQ(TextureDesiredTopMip(1024, 1024, 11, 0.01f), 10u);
+    // Not on screen: the last level.
+    EXPECT_EQ(TextureDesiredTopMip(1024, 1024, 11, 0.0f), 10u);
+}
+
+TEST(TextureResidency, DemandKeepsTheLargestDrawAndClearsEachFrame)
+{
+    TextureStreamingDemand demand;
+    demand.BeginFrame(UnitOrthographic(), 1024.0f);
+    EXPECT_FLOAT_EQ(demand.ProjectedPixels(1.0f, 50.0f), 1024.0f);
+
+    demand.Note(3, 100.0f);
+    demand.Note(3, 400.0f);
+    demand.Note(3, 200.0f);
+    demand.Note(UINT32_MAX, 900.0f);
+    EXPECT_FLOAT_EQ(demand.ScreenPixels(3), 400.0f);
+    EXPECT_FLOAT_EQ(demand.ScreenPixels(7), 0.0f);
+    ASSERT_EQ(demand.NotedTextures().size(), 1u);
+
+    demand.BeginFrame(UnitOrthographic(), 1024.0f);
+    EXPECT_FLOAT_EQ(demand.ScreenPixels(3), 0.0f);
+    EXPECT_TRUE(demand.NotedTextures().empty());
+}
+
+TEST(TextureResidency, PerspectiveDemandHalvesWithDistance)
+{
+    Mat4 projection;
+    projection[1][1] = -1.0f;
+    projection[3][2] = -1.0f;
+
+    TextureStreamingDemand demand;
+    demand.BeginFrame(projection, 1000.0f);
+    EXPECT_FLOAT_EQ(demand.ProjectedPixels(2.0f, 10.0f), 100.0f);
+    EXPECT_FLOAT_EQ(demand.ProjectedPixels(2.0f, 20.0f), 50.0f);
+}
+
+TEST(TextureResidency, VisibleTexturePromotesToItsDesiredLevel)
+{
+    const std::vector<TextureMipLevel> chain = MakeChain(1024);
+    TextureResidency residency;
+    residency.Track(5, chain, 3, 3);
+
+    TextureStreamingDemand demand;
+    demand.BeginFrame(UnitOrthographic(), 1024.0f);
+    demand.Note(5, 512.0f);
+    residency.Update(demand, kUnlimited, 10.0);
+
+    ASSERT_EQ(residency.Changes().size(), 1u);
+    EXPECT_EQ(residency.Changes()[0].Texture, 5u);
+    EXPECT_EQ(residency.Changes()[0].FromTopMip, 3u);
+    EXPECT_EQ(residency.Changes()[0].ToTopMip, 1u);
+    EXPECT_EQ(residency.ResidentTopMip(5), 1u);
+
+    const TextureStreamingFrameStats& stats = residency.FrameStats();
+    EXPECT_EQ(stats.StreamedTextures, 1u);
+    EXPECT_EQ(stats.Promotions, 1u);
+    EXPECT_EQ(stats.RequestedMips, 10u);
+    EXPECT_EQ(stats.ResidentMips, 10u);
+    EXPECT_EQ(stats.PendingTextures, 0u);
+    EXPECT_EQ(stats.ResidentBytes, ChainBytesFrom(chain, 1));
+
+    // Nothing changes while the demand holds.
+    residency.Update(demand, kUnlimited, 20.0);
+    EXPECT_TRUE(residency.Changes().empty());
+}
+
+TEST(TextureResidency, UploadClampSpreadsPromotionsAcrossFrames)
+{
+    const std::vector<TextureMipLevel> chain = MakeChain(1024);
+    TextureResidency residency;
+    residency.Track(0, chain, 3, 3);
+    residency.Track(1, chain, 3, 3);
+
+    TextureStreamingDemand demand;
+    demand.BeginFrame(UnitOrthographic(), 1024.0f);
+    demand.Note(0, 1024.0f);
+    demand.Note(1, 1024.0f);
+
+    // Room for one full chain per frame: the first promotion always runs and
+    // the second only gets what still fits.
+    const TextureStreamingBudgets budgets{ .ResidentBytes = 0,
+                                           .UploadBytesPerFrame = ChainBytesFrom(chain, 0) };
+    residency.Update(demand, budgets, 0.0);
+    EXPECT_EQ(residency.ResidentTopMip(0), 0u);
+    EXPECT_EQ(residency.ResidentTopMip(1), 3u);
+    EXPECT_EQ(residency.FrameStats().PendingTextures, 1u);
+    EXPECT_LT(residency.FrameStats().ResidentMips, residency.FrameStats().RequestedMips);
+
+    residency.Update(demand, budgets, 16.0);
+    EXPECT_EQ(residency.ResidentTopMip(1), 0u);
+    EXPECT_EQ(residency.FrameStats().PendingTextures, 0u);
+    EXPECT_DOUBLE_EQ(residency.FrameStats().LastLatencyMs, 16.0);
+}
+
+TEST(TextureResidency, BudgetEvictsTopMipsOfTexturesNoLongerSeen)
+{
+    const std::vector<TextureMipLevel> chain = MakeChain(1024);
+    TextureResidency residency;
+    residency.Track(0, chain, 3, 3);
+    residency.Track(1, chain, 3, 3);
+
+    const TextureStreamingBudgets budgets{
+        .ResidentBytes = ChainBytesFrom(chain, 0) + ChainBytesFrom(chain, 3),
+        .UploadBytesPerFrame = 0,
+    };
+
+    TextureStreamingDemand demand;
+    demand.BeginFrame(UnitOrthographic(), 1024.0f);
+    demand.Note(0, 1024.0f);
+    residency.Update(demand, budgets, 0.0);
+    EXPECT_EQ(residency.ResidentTopMip(0), 0u);
+
+    // Texture 0 leaves the screen and texture 1 arrives: 0 has to give up its
+    // top levels for 1 to get its own.
+    demand.BeginFrame(UnitOrthographic(), 1024.0f);
+    demand.Note(1, 1024.0f);
+    residency.Update(demand, budgets, 16.0);
+
+    EXPECT_EQ(residency.ResidentTopMip(1), 0u);
+    EXPECT_EQ(residency.ResidentTopMip(0), 3u);
+    EXPECT_EQ(residency.FrameStats().Promotions, 1u);
+    EXPECT_EQ(residency.FrameStats().Evictions, 1u);
+    EXPECT_LE(residency.FrameStats().ResidentBytes, budgets.ResidentBytes);
+    ASSERT_EQ(residency.Changes().size(), 2u);
+}
+
+TEST(TextureResidency, PromotionThatDoesNotFitIsTrimmedToTheBudget)
+{
+    const std::vector<TextureMipLevel> chain = MakeChain(1024);
+    TextureResidency residency;
+    residency.Track(0, chain, 3, 3);
+
+    // Room for level 1 down but not level 0.
+    const TextureStreamingBudgets budgets{ .ResidentBytes = ChainBytesFrom(chain, 1),
+                                           .UploadBytesPerFrame = 0 };
+    TextureStreamingDemand demand;
+    demand.BeginFrame(UnitOrthographic(), 1024.0f);
+    demand.Note(0, 1024.0f);
+    residency.Update(demand, budgets, 0.0);
+
+    EXPECT_EQ(residency.ResidentTopMip(0), 1u);
+    EXPECT_EQ(residency.FrameStats().PendingTextures, 1u);
+}
+
+TEST(TextureResidency, LoweredBudgetShedsSurplusBeforePromoting)
+{
+    const std::vector<TextureMipLevel> chain = MakeChain(1024);
+    TextureResidency residency;
+    residency.Track(0, chain, 0, 3);
+
+    TextureStreamingDemand demand;
+    demand.BeginFrame(UnitOrthographic(), 1024.0f);
+    const TextureStreamingBudgets budgets{ .ResidentBytes = ChainBytesFrom(chain, 2),
+                                           .UploadBytesPerFrame = 0 };
+    residency.Update(demand, budgets, 0.0);
+
+    EXPECT_EQ(residency.ResidentTopMip(0), 2u);
+    EXPECT_EQ(residency.FrameStats().Evictions, 1u);
+    EXPECT_EQ(residency.FrameStats().ResidentBytes, ChainBytesFrom(chain, 2));
+}
+
+TEST(TextureResidency, FailedChangeRestoresThePreviousLevelAndRetries)
+{
+    const std::vector<TextureMipLevel> chain = MakeChain(1024);
+    TextureResidency residency;
+    residency.Track(0, chain, 3, 3);
+
+    TextureStreamingDemand demand;
+    demand.BeginFrame(UnitOrthographic(), 1024.0f);
+    demand.Note(0, 1024.0f);
+    residency.Update(demand, kUnlimited, 0.0);
+    ASSERT_EQ(residency.Changes().size(), 1u);
+
+    residency.MarkChangeFailed(0);
+    EXPECT_EQ(residency.ResidentTopMip(0), 3u);
+    EXPECT_EQ(residency.FrameStats().ResidentBytes, ChainBytesFrom(chain, 3));
+    EXPECT_EQ(residency.FrameStats().Promotions, 0u);
+    EXPECT_EQ(residency.FrameStats().PendingTextures, 1u);
+
+    residency.Update(demand, kUnlimited, 16.0);
+    EXPECT_EQ(residency.ResidentTopMip(0), 0u);
+    EXPECT_DOUBLE_EQ(residency.FrameStats().LastLatencyMs, 16.0);
+}
+
+TEST(TextureResidency, UntrackReleasesTheResidentBytes)
+{
+    const std::vector<TextureMipLevel> chain = MakeChain(256);
+    TextureResidency residency;
+    residency.Track(2, chain, 1, 1);
+    residency.Untrack(2);
+    EXPECT_FALSE(residency.IsTracked(2));
+
+    TextureStreamingDemand demand;
+    demand.BeginFrame(UnitOrthographic(), 1024.0f);
+    residency.Update(demand, kUnlimited, 0.0);
+    EXPECT_EQ(residency.FrameStats().StreamedTextures, 0u);
+    EXPECT_EQ(residency.FrameStats().ResidentBytes, 0u);
+}
@@ -9,6 +9,10 @@
 // whether the scan is quadratic — reading the code answers that — but whether
 // the absolute cost is worth changing the code over.
 //
+// The demand-update sweep is the per-frame question at a larger scale: a focus
+// walking across a grid of a hundred to ten thousand zones, resolved through
+// the index's bounds BVH, with hop ranks reused until the focus changes zone.
+//
 // Counted-work bounds that must hold on every machine live in
 // ZoneTopologyScalingTests.cpp. Only wall clock is recorded here.
 //
@@ -235,10 +239,9 @@ void MeasureDemandStages(const TopologySpec& spec, int reps)
         }));
     }
 
-    // Radius demand walks every zone's bounds rather than the focus
-    // neighbourhood, so it is the one demand shape whose cost is expected to
-    // track world size. Recorded separately so the graph-only number stays a
-    // clean read.
+    // Radius demand queries the bounds BVH around the focus position on top of
+    // the graph neighbourhood. Recorded separately so the graph-only number
+    // stays a clean read.
     WorldPartitionStreamingConfig radiusConfig = config;
     radiusConfig.Radius = spec.ZoneSpan * 1.5;
     const std::string radiusName =
@@ -253,6 +256,66 @@ void MeasureDemandStages(const TopologySpec& spec, int reps)
         }));
     }
 }
+// One frame of streaming policy as WorldPartitionRuntime::Update runs it, per
+// step of a focus walking corner to corner across the grid: resolve the focus
+// zone from the position, recompute hop ranks only when that zone changed, then
+// demand with a radius. Per-step milliseconds, averaged over the walk.
+void MeasureDemandUpdate(int zoneCount, int reps)
+{
+    const std::string resolveName =
+        MetricName("focus_resolve", TopologyShape::Grid, zoneCount);
+    const std::string updateName =
+        MetricName("demand_update", TopologyShape::Grid, zoneCount);
+    if (!Wanted(resolveName) && !Wanted(updateName))
+        return;
+
+    const TopologySpec spec{ .Shape = TopologyShape::Grid, .ZoneCount = zoneCount };
+    const WorldPartitionManifest manifest = BuildTopology(spec);
+    const WorldPartitionIndex index = WorldPartitionIndex::Build(manifest);
+
+    WorldPartitionStreamingConfig config;
+    config.HopCount = 1;
+    config.ResidentZoneCap = 16;
+    config.Radius = spec.ZoneSpan * 1.5;
+
+    constexpr int kSteps = 256;
+    std::vector<Vec3d> path;
+    path.reserve(kSteps);
+    const Vec3d from = StressZoneCenter(spec, 0);
+    const Vec3d to = StressZoneCenter(spec, zoneCount - 1);
+    for (int step = 0; step < kSteps; ++step)
+        path.push_back(from + (to - from) * (static_cast<float>(step) / kSteps));
+
+    if (Wanted(resolveName))
+    {
+        Record(resolveName, "ms", MeasureBatched(reps, kSteps, [&, step = 0]() mutable
+        {
+            const Vec3d& position = path[static_cast<std::size_t>(step++ % kSteps)];
+            return static_cast<std::size_t>(
+                ResolveFocusZone(manifest, index, position, {}).Value);
+        }));
+    }
+
+    if (Wanted(updateName))
+    {
+        ZoneId focus;
+        ZoneId ranksZone;
+        std::vector<ZoneHopRank> ranks;
+        Record(updateName, "ms", MeasureBatched(reps, kSteps, [&, step = 0]() mutable
+        {
+            const Vec3d& position = path[static_cast<std::size_t>(step++ % kSteps)];
+            focus = ResolveFocusZone(manifest, index, position, focus);
+            if (focus != ranksZone)
+            {
+                ranks = ComputeZoneHopRanks(manifest, index, focus, config.HopCount);
+                ranksZone = focus;
+            }
+            return ComputeZoneDemandFromRanks(manifest, index, focus, ranks, {}, config,
+                                              &position)
+                .size();
+        }));
+    }
+}
 }  // namespace
 
 TEST(TopologyBench, Generate)
@@ -294,6 +357,10 @@ TEST(TopologyBench, Generate)
         }
     }
 
+    const int updateReps = Bench::RepsFromEnvironment("SENCHA_TOPOLOGY_BENCH_REPS", 20);
+    for (int zoneCount : { 100, 1000, 10000 })
+        MeasureDemandUpdate(zoneCount, updateReps);
+
     ASSERT_TRUE(Recorder.WriteJson(jsonPath))
         << "cannot write " << jsonPath.generic_string();
     fs::path csvPath = jsonPath;
@@ -37,19 +37,19 @@ constexpr const char* kFixtureJson = R"({
     { "id": "00000000000000a1", "name": "Hub", "region": "00000000000000b1",
       "scene": "levels/hub.level.json",
       "bounds": { "min": [-8, 0, -8], "max": [8, 4, 8] },
-      "cooked_scene": "levels/hub.cooked.json",
+      "cooked_scene": "levels/hub.cooked.sscn",
       "cooked_collision": "levels/hub.collision.json",
       "content_hash": "00000000000000d1" },
     { "id": "00000000000000a2", "name": "Hallway", "region": "00000000000000b1",
       "scene": "levels/hallway.level.json",
       "bounds": { "min": [9, 0, -2], "max": [20, 4, 2] },
-      "cooked_scene": "levels/hallway.cooked.json",
+      "cooked_scene": "levels/hallway.cooked.sscn",
       "cooked_collision": "levels/hallway.collision.json",
       "content_hash": "00000000000000d2" },
     { "id": "00000000000000a3", "name": "Arena", "region": "00000000000000b1",
       "scene": "levels/arena.level.json",
       "bounds": { "min": [21, 0, -8], "max": [40, 8, 8] },
-      "cooked_scene": "levels/arena.cooked.json",
+      "cooked_scene": "levels/arena.cooked.sscn",
       "cooked_collision": "levels/arena.collision.json",
       "content_hash": "00000000000000d3" }
   ],
@@ -318,6 +318,67 @@ TEST_F(WorldPartitionRuntimeTest, CrossingRecordsTraversalGraceReason)
                             { return reason.Reason == ZoneDemandReason::TraversalGrace; }));
 }
 
+TEST_F(WorldPartitionRuntimeTest, PredictedZoneLoadsDormantAheadOfTheFocus)
+{
+    LoadFixture(WorldPartitionStreamingConfig{ .HopCount = 0, .PredictSeconds = 1.0 });
+    Partition.SetFocus(Vec3d{ 0, 1, 0 });
+    Step(0.1);
+    Step(0.1);
+    EXPECT_EQ(Zone(kHallway), nullptr);
+
+    // Ten units a second toward the hub's dock at 8.5: the hallway is 0.65s
+    // out, inside the horizon; the arena is a further 1.2s on, outside it.
+    Partition.SetFocus(Vec3d{ 2, 1, 0 });
+    Step(0.1);
+    EXPECT_GT(Partition.FocusVelocity().X, 0.0f);
+    ASSERT_NE(Zone(kHallway), nullptr);
+    EXPECT_FALSE(Zone(kHallway)->Participation.Any());
+    EXPECT_EQ(Zone(kArena), nullptr);
+
+    const ZoneDemandRecord* predicted = nullptr;
+    for (const ZoneDemandRecord& record : Partition.DemandRecords())
+        if (record.Zone == kHallway)
+            predicted = &record;
+    ASSERT_NE(predicted, nullptr);
+    EXPECT_FALSE(predicted->Desired.Any());
+    EXPECT_TRUE(IsDemandedFor(*predicted, ZoneDemandReason::Predicted));
+}
+
+TEST_F(WorldPartitionRuntimeTest, FocusChangesBuildTraversalHistoryButRelocationsDoNot)
+{
+    LoadFixture();
+    Partition.SetFocus(kHub);
+    Step();
+    Partition.SetFocus(kHallway);
+    Step();
+    Partition.SetFocus(kHub);
+    Step();
+    Partition.SetFocus(kHallway);
+    Step();
+    Partition.RelocateFocus(Vec3d{ 30, 1, 0 });
+    Step();
+    ASSERT_EQ(Partition.FocusZone(), kArena);
+
+    const std::vector<ZoneTraversalCount> history(Partition.TraversalHistory().begin(),
+                                                  Partition.TraversalHistory().end());
+    EXPECT_EQ(history, (std::vector<ZoneTraversalCount>{ { kHub, kHallway, 2 },
+                                                         { kHallway, kHub, 1 } }));
+}
+
+TEST_F(WorldPartitionRuntimeTest, VisiblePopsCountZonesThatArrivedAfterTheyWereWanted)
+{
+    LoadFixture();
+    Partition.SetFocus(kHub);
+    Step();
+    EXPECT_EQ(Partition.VisiblePopCount(), 0u);
+
+    // Hub and hallway were both wanted visible before either was resident.
+    Step();
+    EXPECT_EQ(Partition.VisiblePopCount(), 2u);
+    Step();
+    EXPECT_EQ(Partition.VisiblePopCount(), 2u);
+}
+
 TEST_F(WorldPartitionRuntimeTest, LingerExpiresThroughQueuedFinalDetach)
 {
     LoadFixture(WorldPartitionStreamingConfig{
@@ -541,7 +602,7 @@ TEST_F(WorldPartitionRuntimeTest, CoincidentZoneAabbsUseDeterministicAndPreferre
     EXPECT_EQ(Partition.ResolveZoneAt(Vec3d{}, kHallway).Chosen, kHallway);
 }
 
-TEST(WorldPartitionRuntimeThreaded, MidBuildCancellationRetriesThenDetaches)
+TEST(WorldPartitionRuntimeThreaded, MidBuildCancellationDropsTheBuild)
 {
     LoggingProvider logging;
     AsyncTaskQueue tasks(1);
@@ -607,30 +668,21 @@ TEST(WorldPartitionRuntimeThreaded, MidBuildCancellationRetriesThenDetaches)
         std::this_thread::sleep_for(std::chrono::milliseconds(1));
     }
 
+    // The build is executing, and the cancel lands anyway: the loader stops
+    // tracking it at once, and nothing lingers waiting for it to finish.
     partition.UnpinZone(kHallway);
     partition.Update(0.0, loader, runtimeWorld);
-    EXPECT_TRUE(loader.IsLoading(kHallway));
-
-    bool reportedLingering = false;
+    EXPECT_FALSE(loader.IsLoading(kHallway));
     for (const ZoneDemandRecord& record : partition.DemandRecords())
-    {
-        if (record.Zone == kHallway)
-            reportedLingering = IsDemandedFor(record, ZoneDemandReason::Linger);
-    }
-    EXPECT_TRUE(reportedLingering);
+        EXPECT_NE(record.Zone, kHallway);
 
+    // A sentinel behind the build on the single worker: once it commits, the
+    // cancelled build has returned and its package has been dropped.
     release = true;
-    while (loader.IsLoading(kHallway))
-    {
-        tasks.DrainCompletions();
-        ASSERT_LT(std::chrono::steady_clock::now(), deadline);
-        std::this_thread::sleep_for(std::chrono::milliseconds(1));
-    }
-
-    while (runtimeWorld.FindZone(kHallway) != nullptr)
+    const AsyncTaskHandle sentinel = tasks.Submit<int>([] { return 0; }, [](int) {});
+    while (!tasks.IsComplete(sentinel))
     {
         partition.Update(0.1, loader, runtimeWorld);
-        runtimeWorld.FlushLifecycleRequests();
         tasks.DrainCompletions();
         runtimeWorld.FlushLifecycleRequests();
         (void)runtimeWorld.BeginResidencyProcessing();
@@ -640,6 +692,7 @@ TEST(WorldPartitionRuntimeThreaded, MidBuildCancellationRetriesThenDetaches)
     }
 
     EXPECT_EQ(runtimeWorld.FindZone(kHallway), nullptr);
+    EXPECT_FALSE(loader.IsLoading(kHallway));
 }
 
 // Lease slots are recycled, so the generation is what stops an old token from
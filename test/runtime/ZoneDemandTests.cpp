@@ -2,6 +2,8 @@
 
 #include <zone/ZoneDemand.h>
 
+#include "ZoneDockFixture.h"
+
 #include <algorithm>
 #include <initializer_list>
 #include <vector>
@@ -471,3 +473,117 @@ TEST(ZoneDemand, CrossGraphDockSeedsDestinationGraphPolicy)
                                     && reason.SourceEndpoint == 0xd1;
                             }));
 }
+
+namespace
+{
+
+// Four zones along X joined by docks at x = 20, 40 and 60, each plane 16 wide
+// and 16 tall, plus a one-way link from the first zone to a fifth that has no
+// dock at all.
+WorldPartitionManifest DockRowManifest()
+{
+    WorldPartitionManifest manifest;
+    for (uint64_t i = 0; i < 4; ++i)
+    {
+        ZoneHeader zone = MakeZone(0xa1 + i);
+        const float minX = static_cast<float>(i) * 20.0f;
+        SetZoneBounds(zone, Aabb3d::FromMinMax(Vec3d{ minX, 0, -8 },
+                                               Vec3d{ minX + 20.0f, 4, 8 }));
+        manifest.Zones.push_back(zone);
+    }
+    manifest.Zones.push_back(MakeZone(0xa5));
+    for (uint64_t i = 0; i < 3; ++i)
+        AddFixtureDockPair(manifest, 0xd1 + i, ZoneId{ 0xa1 + i }, ZoneId{ 0xa2 + i },
+                           Vec3d{ static_cast<float>(i + 1) * 20.0f, 2, 0 });
+    SetEdges(manifest, { MakeEdge(0xc1, 0xa1, 0xa5) });
+    return manifest;
+}
+
+WorldPartitionStreamingConfig PredictFor(double seconds)
+{
+    WorldPartitionStreamingConfig config;
+    config.PredictSeconds = seconds;
+    return config;
+}
+
+} // namespace
+
+TEST(ZonePrediction, TrajectorySweepsThroughDocksWithinTheHorizon)
+{
+    const WorldPartitionManifest manifest = DockRowManifest();
+    const WorldPartitionIndex index = WorldPartitionIndex::Build(manifest);
+
+    // 20 units/s from x = 10: the first dock in 0.5s, the second in 1.5s, the
+    // third in 2.5s, past the horizon.
+    const auto records = PredictZoneDemand(index, ZoneId{ 0xa1 }, Vec3d{ 10, 2, 0 },
+                                           Vec3d{ 20, 0, 0 }, {}, PredictFor(1.5));
+    ASSERT_EQ(records.size(), 2u);
+    EXPECT_EQ(records[0].Zone, ZoneId{ 0xa2 });
+    EXPECT_EQ(records[1].Zone, ZoneId{ 0xa3 });
+    for (const ZoneDemandRecord& record : records)
+        EXPECT_FALSE(record.Desired.Any());
+
+    const ZoneDemandReasonRecord first{ ZoneDemandReason::Predicted, ZoneId{ 0xa1 }, 0xd1, 1,
+                                        0.5 };
+    const ZoneDemandReasonRecord second{ ZoneDemandReason::Predicted, ZoneId{ 0xa2 }, 0xd2, 2,
+                                         1.5 };
+    EXPECT_EQ(records[0].Reasons, std::vector<ZoneDemandReasonRecord>{ first });
+    EXPECT_EQ(records[1].Reasons, std::vector<ZoneDemandReasonRecord>{ second });
+    EXPECT_EQ(DescribeZoneDemandReasons(records[0]), "predicted");
+}
+
+TEST(ZonePrediction, NothingIsPredictedWithoutMotionTowardADock)
+{
+    const WorldPartitionManifest manifest = DockRowManifest();
+    const WorldPartitionIndex index = WorldPartitionIndex::Build(manifest);
+    const ZoneId focus{ 0xa2 };
+    const Vec3d position{ 30, 2, 0 };
+
+    EXPECT_TRUE(PredictZoneDemand(index, focus, position, Vec3d{}, {}, PredictFor(2.0)).empty());
+    EXPECT_TRUE(PredictZoneDemand(index, focus, position, Vec3d{ 0, 0, 20 }, {},
+                                  PredictFor(2.0)).empty());
+    // Aimed well wide of the dock: the plane is reached, the opening is not.
+    EXPECT_TRUE(PredictZoneDemand(index, focus, Vec3d{ 30, 2, 40 }, Vec3d{ 20, 0, 0 }, {},
+                                  PredictFor(2.0)).empty());
+    // No horizon, no prediction, however fast the focus moves.
+    EXPECT_TRUE(PredictZoneDemand(index, focus, position, Vec3d{ 100, 0, 0 }, {},
+                                  PredictFor(0.0)).empty());
+    EXPECT_TRUE(PredictZoneDemand(index, ZoneId{ 0xee }, position, Vec3d{ 20, 0, 0 }, {},
+                                  PredictFor(2.0)).empty());
+}
+
+TEST(ZonePrediction, TrajectoryNeverPredictsTheWayBackOrTheFocus)
+{
+    const WorldPartitionManifest manifest = DockRowManifest();
+    const WorldPartitionIndex index = WorldPartitionIndex::Build(manifest);
+
+    const auto records = PredictZoneDemand(index, ZoneId{ 0xa2 }, Vec3d{ 25, 2, 0 },
+                                           Vec3d{ -20, 0, 0 }, {}, PredictFor(5.0));
+    ASSERT_EQ(records.size(), 1u);
+    EXPECT_EQ(records[0].Zone, ZoneId{ 0xa1 });
+}
+
+TEST(ZonePrediction, HistoryPredictsTheUsualRouteIncludingLinks)
+{
+    const WorldPartitionManifest manifest = DockRowManifest();
+    const WorldPartitionIndex index = WorldPartitionIndex::Build(manifest);
+    const ZoneId focus{ 0xa1 };
+
+    const std::vector<ZoneTraversalCount> usual{
+        { focus, ZoneId{ 0xa5 }, 3 },
+        { focus, ZoneId{ 0xa2 }, 1 },
+        { ZoneId{ 0xa2 }, focus, 9 },
+    };
+    const auto records = PredictZoneDemand(index, focus, Vec3d{ 10, 2, 0 }, Vec3d{}, usual,
+                                           PredictFor(1.0));
+    ASSERT_EQ(records.size(), 1u);
+    EXPECT_EQ(records[0].Zone, ZoneId{ 0xa5 });
+    ASSERT_EQ(records[0].Reasons.size(), 1u);
+    EXPECT_EQ(records[0].Reasons[0].SourceEndpoint, 0xc1u);
+    EXPECT_FALSE(records[0].Reasons[0].Cost.has_value());
+
+    // Two departures are too few to call a habit.
+    const std::vector<ZoneTraversalCount> sparse{ { focus, ZoneId{ 0xa5 }, 2 } };
+    EXPECT_TRUE(PredictZoneDemand(index, focus, Vec3d{ 10, 2, 0 }, Vec3d{}, sparse,
+                                  PredictFor(1.0)).empty());
+}
@@ -0,0 +1,246 @@
+// Evidence generator: what detaching a large zone costs the owner thread, now
+// that the rows leave as whole chunk slabs and the ZoneStateStore diff runs on
+// the async lane.
+//
+// Skipped unless SENCHA_ZONE_DETACH_BENCH_OUT names the output path (a .json
+// is written there and a .csv beside it). Run it through
+// scripts/bench_zone_detach.sh; compare two runs with
+// scripts/bench_streaming_compare.py.
+//
+// Each zone is a baked package of identified entities carrying a transform and
+// one tracked component. Before detaching, one entity in a hundred is destroyed
+// and one in a hundred has its tracked value changed, so the capture records
+// real deviation rather than diffing an untouched zone.
+//
+// Per entity count (n10k, n50k):
+//   destroy_owner_*_ms   median: the path detach replaced — an identity query
+//                        and RecordDetachCapture, then DestroyPartition row by
+//                        row — all on the owner thread
+//   detach_owner_*_ms    median: FinalizeResidencyProcessing with a capture
+//                        lane; hooks, id release and the slab hand-off
+//   capture_worker_*_ms  median: CaptureZoneDetach on the lane, off the owner
+//   commit_owner_*_ms    median: the drain that lands the capture in the store
+//   entities_*           entities in the zone (count)
+//   control_memory_stream_ms  the compare script's drift yardstick
+
+#include <gtest/gtest.h>
+
+#include "BenchRecorder.h"
+
+#include <ecs/Query.h>
+#include <ecs/WorldComponentSchema.h>
+#include <jobs/AsyncTaskQueue.h>
+#include <world/RuntimeWorld.h>
+#include <world/identity/PersistentEntityIndex.h>
+#include <world/identity/PersistentIdComponent.h>
+#include <world/transform/TransformComponents.h>
+#include <zone/ZoneChunkImage.h>
+#include <zone/ZoneLoadPackage.h>
+#include <zone/ZonePackageImporter.h>
+#include <zone/ZoneStateStore.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+struct ZoneDetachBenchState
+{
+    float Health = 100.0f;
+    std::uint32_t Flags = 0;
+};
+
+SENCHA_DECLARE_COMPONENT_TYPE(ZoneDetachBenchState, "test.zone_detach_bench_state");
+
+namespace
+{
+namespace fs = std::filesystem;
+
+Bench::Recorder Recorder;
+
+const ZoneId kZone{ 900 };
+
+WorldComponentSchema BenchSchema()
+{
+    WorldComponentSchema schema;
+    schema.Add<PersistentIdComponent>();
+    schema.Add<LocalTransform>();
+    schema.Add<WorldTransform>();
+    schema.Add<ZoneDetachBenchState>();
+    schema.Seal();
+    return schema;
+}
+
+ZoneLoadPackage BenchPackage(const WorldComponentSchema& schema, int entities)
+{
+    ZoneLoadPackage package(kZone);
+    for (int i = 0; i < entities; ++i)
+    {
+        const PersistentEntityId id{ 0x1000u + static_cast<std::uint64_t>(i) };
+        const ZoneLocalEntityId local = package.CreateEntity();
+        EXPECT_TRUE(package.AddComponent<PersistentIdComponent>(local, { id }));
+        EXPECT_TRUE(package.AddComponent<LocalTransform>(local, LocalTransform{ Transform3f(
+            Vec3d(static_cast<float>(i % 100), 0.0f, static_cast<float>(i / 100)),
+            Quatf::Identity(),
+            Vec3d(1.0f, 1.0f, 1.0f)) }));
+        EXPECT_TRUE(package.AddComponent<ZoneDetachBenchState>(local, {}));
+        EXPECT_TRUE(package.SetPersistentId(local, id));
+    }
+    EXPECT_EQ(BakeZoneChunkImage(package, schema), static_cast<std::size_t>(entities));
+    return package;
+}
+
+ZoneParticipation LogicOnly()
+{
+    ZoneParticipation participation;
+    participation.Logic = true;
+    return participation;
+}
+
+// Imports the zone and plays it for a moment: one entity in a hundred is
+// destroyed and another has its tracked value changed.
+void ImportAndDisturb(RuntimeWorld& runtime,
+                      const WorldComponentSchema& schema,
+                      const ZoneLoadPackage& package,
+                      int entities)
+{
+    ZoneImportError error;
+    ASSERT_TRUE(ImportZonePackage(runtime, schema, package, LogicOnly(), &error)) << error.Message;
+    (void)runtime.BeginResidencyProcessing();
+    runtime.FinalizeResidencyProcessing();
+
+    World& world = runtime.Entities();
+    auto& index = world.GetResource<PersistentEntityIndex>();
+    for (int i = 0; i < entities; i += 100)
+    {
+        world.DestroyEntity(index.TryResolve(PersistentEntityId{ 0x1000u + static_cast<std::uint64_t>(i) }));
+        const EntityId changed =
+            index.TryResolve(PersistentEntityId{ 0x1000u + static_cast<std::uint64_t>(i + 1) });
+        world.TryGet<ZoneDetachBenchState>(changed)->Health = 50.0f;
+    }
+}
+
+void MeasureZone(const std::string& label, int entities, int reps)
+{
+    const WorldComponentSchema schema = BenchSchema();
+    const ZoneLoadPackage package = BenchPackage(schema, entities);
+
+    std::vector<double> destroys;
+    std::vector<double> detaches;
+    std::vector<double> captures;
+    std::vector<double> commits;
+
+    // The first pass of each only warms the allocator and caches.
+    for (int rep = 0; rep <= reps; ++rep)
+    {
+        {
+            RuntimeWorld runtime(schema);
+            runtime.Entities().GetResource<ZoneStateStore>().TrackComponent<ZoneDetachBenchState>();
+            ImportAndDisturb(runtime, schema, package, entities);
+            World& world = runtime.Entities();
+            const StoragePartitionId partition = runtime.FindZone(kZone)->Partition;
+
+            const Bench::Clock::time_point start = Bench::Clock::now();
+            std::vector<PersistentEntityId> live;
+            StoragePartitionSet detaching;
+            detaching.Add(partition);
+            Query<Read<PersistentIdComponent>> identified(world);
+            identified.ForEachChunkIn(detaching, [&](auto& view) {
+                for (const PersistentIdComponent& id : view.template Read<PersistentIdComponent>())
+                    live.push_back(id.Id);
+            });
+            world.GetResource<ZoneStateStore>().RecordDetachCapture(kZone, live);
+            (void)world.DestroyPartition(partition);
+            const double elapsed = Bench::MillisecondsSince(start);
+            if (rep > 0)
+                destroys.push_back(elapsed);
+        }
+        {
+            RuntimeWorld runtime(schema);
+            AsyncTaskQueue tasks(0);
+            runtime.SetDetachCaptureLane(&tasks);
+            runtime.Entities().GetResource<ZoneStateStore>().TrackComponent<ZoneDetachBenchState>();
+            ImportAndDisturb(runtime, schema, package, entities);
+            ASSERT_TRUE(runtime.RequestDetach(kZone));
+            runtime.FlushLifecycleRequests();
+
+            Bench::Clock::time_point start = Bench::Clock::now();
+            (void)runtime.BeginResidencyProcessing();
+            runtime.FinalizeResidencyProcessing();
+            const double detachMs = Bench::MillisecondsSince(start);
+
+            start = Bench::Clock::now();
+            ASSERT_EQ(tasks.PumpWork(), 1u);
+            const double captureMs = Bench::MillisecondsSince(start);
+
+            start = Bench::Clock::now();
+            (void)tasks.DrainCompletions();
+            const double commitMs = Bench::MillisecondsSince(start);
+
+            const ZoneStateStore& store = runtime.Entities().GetResource<ZoneStateStore>();
+            EXPECT_EQ(store.RecordedDestroyedCount(kZone), static_cast<std::size_t>((entities + 99) / 100));
+            EXPECT_EQ(store.RecordedModifiedCount(kZone), static_cast<std::size_t>((entities + 99) / 100));
+            if (rep > 0)
+            {
+                detaches.push_back(detachMs);
+                captures.push_back(captureMs);
+                commits.push_back(commitMs);
+            }
+        }
+    }
+
+    Recorder.Record("entities_" + label, "count", static_cast<double>(entities));
+    Recorder.Record("destroy_owner_" + label + "_ms", "ms", Bench::Median(destroys));
+    Recorder.Record("detach_owner_" + label + "_ms", "ms", Bench::Median(detaches));
+    Recorder.Record("capture_worker_" + label + "_ms", "ms", Bench::Median(captures));
+    Recorder.Record("commit_owner_" + label + "_ms", "ms", Bench::Median(commits));
+}
+
+// Touches no engine code, so a change in it is a change in the machine, not
+// the build.
+void MeasureControl(int reps)
+{
+    constexpr std::size_t kBytes = 20u * 1024u * 1024u;
+    std::vector<unsigned char> buffer(kBytes, 1);
+    std::vector<double> samples;
+    for (int rep = 0; rep <= reps; ++rep)
+    {
+        const Bench::Clock::time_point start = Bench::Clock::now();
+        unsigned long long sum = 0;
+        for (std::size_t index = 0; index < kBytes; index += 64)
+            sum += buffer[index];
+        const double elapsed = Bench::MillisecondsSince(start);
+        if (sum == 0)
+            std::abort();
+        if (rep > 0)
+            samples.push_back(elapsed);
+    }
+    Recorder.Record("control_memory_stream_ms", "ms", Bench::Median(samples));
+}
+}
+
+TEST(ZoneDetachBench, Generate)
+{
+    const char* outEnv = std::getenv("SENCHA_ZONE_DETACH_BENCH_OUT");
+    if (outEnv == nullptr)
+    {
+        GTEST_SKIP() << "set SENCHA_ZONE_DETACH_BENCH_OUT to record the zone "
+                        "detach bench (use scripts/bench_zone_detach.sh)";
+    }
+
+    const fs::path jsonPath(outEnv);
+    if (jsonPath.has_parent_path() && !jsonPath.parent_path().empty())
+        fs::create_directories(jsonPath.parent_path());
+
+    Recorder.Clear();
+    const int reps = Bench::RepsFromEnvironment("SENCHA_ZONE_DETACH_REPS", 5);
+    MeasureControl(reps);
+    MeasureZone("n10k", 10000, reps);
+    MeasureZone("n50k", 50000, reps);
+
+    ASSERT_TRUE(Recorder.WriteJson(jsonPath));
+    fs::path csvPath = jsonPath;
+    csvPath.replace_extension(".csv");
+    ASSERT_TRUE(Recorder.WriteCsv(csvPath));
+}
@@ -0,0 +1,212 @@
+// Evidence generator: the owner thread's worst streaming frame, before and
+// after zone imports were sliced. Large baked zones stream in one after
+// another while every frame drains the async lane under the engine's default
+// 2 ms AsyncCommitBudgetMs, once with each import whole (one slice as large as
+// the zone) and once in the loader's default slices.
+//
+// Skipped unless SENCHA_ZONE_IMPORT_SLICE_BENCH_OUT names the output path (a
+// .json is written there and a .csv beside it). Run it through
+// scripts/bench_zone_import_slicing.sh; compare two runs with
+// scripts/bench_streaming_compare.py.
+//
+// Per import mode (whole, sliced):
+//   drain_worst_*_ms     median over reps of the slowest DrainCompletions
+//                        frame while the zones streamed in
+//   drain_p50_*_ms       median drain frame over the same frames
+//   frames_*             frames from the first drain to the last zone
+//                        publishing (count)
+//   entities_per_zone    zone size (count)
+//   control_memory_stream_ms  the compare script's drift yardstick
+
+#include <gtest/gtest.h>
+
+#include "BenchRecorder.h"
+
+#include <core/logging/LoggingProvider.h>
+#include <ecs/WorldComponentSchema.h>
+#include <jobs/AsyncTaskQueue.h>
+#include <runtime/RuntimeFrameLoop.h>
+#include <world/RuntimeWorld.h>
+#include <world/identity/PersistentIdComponent.h>
+#include <world/serialization/ComponentSerializerRegistry.h>
+#include <world/serialization/SceneSerializationContext.h>
+#include <world/transform/TransformComponents.h>
+#include <zone/AsyncZoneLoader.h>
+#include <zone/ZoneLoadPackage.h>
+#include <zone/ZonePackageImporter.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+struct ZoneImportSliceBenchState
+{
+    float Health = 100.0f;
+    std::uint32_t Flags = 0;
+};
+
+SENCHA_DECLARE_COMPONENT_TYPE(ZoneImportSliceBenchState, "test.zone_import_slice_bench_state");
+
+namespace
+{
+namespace fs = std::filesystem;
+
+Bench::Recorder Recorder;
+
+constexpr int kZones = 4;
+constexpr int kEntitiesPerZone = 50000;
+constexpr std::chrono::microseconds kDrainBudget{ 2000 };
+
+WorldComponentSchema BenchSchema()
+{
+    WorldComponentSchema schema;
+    schema.Add<PersistentIdComponent>();
+    schema.Add<LocalTransform>();
+    schema.Add<WorldTransform>();
+    schema.Add<ZoneImportSliceBenchState>();
+    schema.Seal();
+    return schema;
+}
+
+void BuildZone(ZoneLoadPackage& package, int zone)
+{
+    for (int i = 0; i < kEntitiesPerZone; ++i)
+    {
+        const PersistentEntityId id{ (static_cast<std::uint64_t>(zone + 1) << 32)
+                                     + static_cast<std::uint64_t>(i) };
+        const ZoneLocalEntityId local = package.CreateEntity();
+        (void)package.AddComponent<PersistentIdComponent>(local, { id });
+        (void)package.AddComponent<LocalTransform>(local, LocalTransform{ Transform3f(
+            Vec3d(static_cast<float>(i % 100), 0.0f, static_cast<float>(i / 100)),
+            Quatf::Identity(),
+            Vec3d(1.0f, 1.0f, 1.0f)) });
+        (void)package.AddComponent<ZoneImportSliceBenchState>(local, {});
+        (void)package.SetPersistentId(local, id);
+    }
+}
+
+struct StreamResult
+{
+    double WorstMs = 0.0;
+    double MedianMs = 0.0;
+    int Frames = 0;
+};
+
+// Every zone is built up front, so each frame's cost is the drain alone: the
+// number the budget is meant to bound.
+StreamResult StreamZones(const WorldComponentSchema& schema, std::size_t sliceRows)
+{
+    LoggingProvider logging;
+    AsyncTaskQueue tasks(0);
+    RuntimeWorld world(schema);
+    ComponentSerializerRegistry serializers;
+    SceneSerializationContext sceneContext(logging);
+    RuntimeFrameLoop frameLoop;
+    AsyncZoneLoader loader(tasks, world, schema, serializers, sceneContext, frameLoop);
+    loader.SetImportSliceRows(sliceRows);
+
+    for (int zone = 0; zone < kZones; ++zone)
+        loader.BeginLoad(ZoneId{ 0x500u + static_cast<std::uint64_t>(zone) },
+                         [zone](ZoneLoadPackage& package) { BuildZone(package, zone); });
+    (void)tasks.PumpWork();
+
+    const AsyncDrainBudget budget{ .MaxTime = kDrainBudget };
+    std::vector<double> frames;
+    const auto allResident = [&]
+    {
+        for (int zone = 0; zone < kZones; ++zone)
+            if (!world.IsZoneResident(ZoneId{ 0x500u + static_cast<std::uint64_t>(zone) }))
+                return false;
+        return true;
+    };
+    while (!allResident())
+    {
+        const Bench::Clock::time_point start = Bench::Clock::now();
+        (void)tasks.DrainCompletions(budget);
+        world.FlushLifecycleRequests();
+        frames.push_back(Bench::MillisecondsSince(start));
+        (void)world.BeginResidencyProcessing();
+        world.FinalizeResidencyProcessing();
+    }
+
+    StreamResult result;
+    result.WorstMs = *std::max_element(frames.begin(), frames.end());
+    result.MedianMs = Bench::Median(frames);
+    result.Frames = static_cast<int>(frames.size());
+    return result;
+}
+
+void MeasureMode(const std::string& label, std::size_t sliceRows, int reps)
+{
+    const WorldComponentSchema schema = BenchSchema();
+    std::vector<double> worst;
+    std::vector<double> median;
+    int frames = 0;
+    // The first pass only warms the allocator and caches.
+    for (int rep = 0; rep <= reps; ++rep)
+    {
+        const StreamResult result = StreamZones(schema, sliceRows);
+        if (rep == 0)
+            continue;
+        worst.push_back(result.WorstMs);
+        median.push_back(result.MedianMs);
+        frames = result.Frames;
+    }
+
+    Recorder.Record("drain_worst_" + label + "_ms", "ms", Bench::Median(worst));
+    Recorder.Record("drain_p50_" + label + "_ms", "ms", Bench::Median(median));
+    Recorder.Record("frames_" + label, "count", static_cast<double>(frames));
+}
+
+// Touches no engine code, so a change in it is a change in the machine, not
+// the build.
+void MeasureControl(int reps)
+{
+    constexpr std::size_t kBytes = 20u * 1024u * 1024u;
+    std::vector<unsigned char> buffer(kBytes, 1);
+    std::vector<double> samples;
+    for (int rep = 0; rep <= reps; ++rep)
+    {
+        const Bench::Clock::time_point start = Bench::Clock::now();
+        unsigned long long sum = 0;
+        for (std::size_t index = 0; index < kBytes; index += 64)
+            sum += buffer[index];
+        const double elapsed = Bench::MillisecondsSince(start);
+        if (sum == 0)
+            std::abort();
+        if (rep > 0)
+            samples.push_back(elapsed);
+    }
+    Recorder.Record("control_memory_stream_ms", "ms", Bench::Median(samples));
+}
+}
+
+TEST(ZoneImportSliceBench, Generate)
+{
+    const char* outEnv = std::getenv("SENCHA_ZONE_IMPORT_SLICE_BENCH_OUT");
+    if (outEnv == nullptr)
+    {
+        GTEST_SKIP() << "set SENCHA_ZONE_IMPORT_SLICE_BENCH_OUT to record the zone "
+                        "import slicing bench (use scripts/bench_zone_import_slicing.sh)";
+    }
+
+    const fs::path jsonPath(outEnv);
+    if (jsonPath.has_parent_path() && !jsonPath.parent_path().empty())
+        fs::create_directories(jsonPath.parent_path());
+
+    Recorder.Clear();
+    const int reps = Bench::RepsFromEnvironment("SENCHA_ZONE_IMPORT_SLICE_REPS", 3);
+    MeasureControl(reps);
+    Recorder.Record("entities_per_zone", "count", static_cast<double>(kEntitiesPerZone));
+    MeasureMode("whole", ZonePackageImport::NoLimit, reps);
+    MeasureMode("sliced", AsyncZoneLoader::DefaultImportSliceRows, reps);
+
+    ASSERT_TRUE(Recorder.WriteJson(jsonPath));
+    fs::path csvPath = jsonPath;
+    csvPath.replace_extension(".csv");
+    ASSERT_TRUE(Recorder.WriteCsv(csvPath));
+}
@@ -42,7 +42,7 @@ std::string ManifestJson(std::uint64_t hubHash)
         R"({"id":"00000000000000a1","name":"Hub","region":"00000000000000b1",)"
         R"("scene":"levels/hub.level.json",)"
         R"("bounds":{"min":[-8,0,-8],"max":[8,4,8]},)"
-        R"("cooked_scene":"levels/hub.cooked.json",)"
+        R"("cooked_scene":"levels/hub.cooked.sscn",)"
         R"("cooked_collision":"levels/hub.collision.json",)"
         R"("content_hash":")" + [hubHash]
         {
@@ -54,7 +54,7 @@ std::string ManifestJson(std::uint64_t hubHash)
         R"({"id":"00000000000000a2","name":"Hallway","region":"00000000000000b1",)"
         R"("scene":"levels/hall.level.json",)"
         R"("bounds":{"min":[9,0,-2],"max":[20,4,2]},)"
-        R"("cooked_scene":"levels/hall.cooked.json",)"
+        R"("cooked_scene":"levels/hall.cooked.sscn",)"
         R"("cooked_collision":"levels/hall.collision.json",)"
         R"("content_hash":"00000000000000d2"})"
         R"(]})";
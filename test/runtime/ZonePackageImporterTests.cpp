@@ -1,11 +1,15 @@
 #include <ecs/WorldComponentSchema.h>
 #include <world/RuntimeWorld.h>
 #include <world/transform/TransformComponents.h>
+#include <zone/ZoneChunkImage.h>
 #include <zone/ZoneLoadPackage.h>
 #include <zone/ZonePackageImporter.h>
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <vector>
+
 struct PackageValue
 {
     int Value = 0;
@@ -250,3 +254,219 @@ TEST(ZonePackageImporter, PackageRejectsDuplicateComponentsAndParents)
     EXPECT_FALSE(package.SetParent(second, first));
     EXPECT_FALSE(package.SetParent(first, first));
 }
+
+namespace
+{
+// A root with two children, one carrying an OnAdd hook, plus a flat run of
+// `extra` unparented entities: enough archetypes and hierarchy to exercise
+// every column the importer writes.
+ZoneLoadPackage MakeMixedPackage(ZoneId zone, int extra)
+{
+    ZoneLoadPackage package(zone);
+    const ZoneLocalEntityId root = package.CreateEntity();
+    LocalTransform rootTransform;
+    rootTransform.Value.Position = Vec3d{ 1.0f, 2.0f, 3.0f };
+    EXPECT_TRUE(package.AddComponent(root, rootTransform));
+    EXPECT_TRUE(package.AddComponent(root, PackageValue{ 1 }));
+
+    for (int child = 0; child < 2; ++child)
+    {
+        const ZoneLocalEntityId entity = package.CreateEntity();
+        LocalTransform transform;
+        transform.Value.Position = Vec3d{ static_cast<float>(child), 0.0f, 0.0f };
+        EXPECT_TRUE(package.AddComponent(entity, transform));
+        EXPECT_TRUE(package.AddComponent(entity, PackageValue{ 10 + child }));
+        if (child == 1)
+        {
+            EXPECT_TRUE(package.AddComponent(entity, PackageOnAdd{ 7 }));
+        }
+        EXPECT_TRUE(package.SetParent(entity, root));
+    }
+
+    for (int index = 0; index < extra; ++index)
+    {
+        const ZoneLocalEntityId entity = package.CreateEntity();
+        EXPECT_TRUE(package.AddComponent(entity, PackageValue{ 100 + index }));
+    }
+    return package;
+}
+
+struct ImportedEntity
+{
+    int Value = 0;
+    bool HasWorldTransform = false;
+    int ParentValue = -1;
+
+    friend bool operator==(const ImportedEntity&, const ImportedEntity&) = default;
+    friend bool operator<(const ImportedEntity& a, const ImportedEntity& b)
+    {
+        return a.Value < b.Value;
+    }
+};
+
+std::vector<ImportedEntity> DescribePartition(const World& world, StoragePartitionId partition)
+{
+    std::vector<ImportedEntity> described;
+    for (EntityId entity : EntitiesInPartition(world, partition))
+    {
+        ImportedEntity item;
+        item.Value = world.TryGet<PackageValue>(entity)->Value;
+        item.HasWorldTransform = world.TryGet<WorldTransform>(entity) != nullptr;
+        if (const Parent* parent = world.TryGet<Parent>(entity))
+            item.ParentValue = world.TryGet<PackageValue>(parent->Entity)->Value;
+        described.push_back(item);
+    }
+    std::sort(described.begin(), described.end());
+    return described;
+}
+} // namespace
+
+TEST(ZonePackageImporter, BakedChunkImageImportsLikeThePerEntityPath)
+{
+    const WorldComponentSchema schema = MakePackageSchema();
+
+    const ZoneLoadPackage plain = MakeMixedPackage(ZoneId{ 60 }, 4);
+    ZoneLoadPackage baked = MakeMixedPackage(ZoneId{ 60 }, 4);
+    EXPECT_EQ(BakeZoneChunkImage(baked, schema), baked.EntityCount());
+    // Root, hooked child, plain child, and the flat run: four component sets.
+    EXPECT_EQ(baked.ChunkImage().Blocks.size(), 4u);
+    EXPECT_TRUE(baked.Entities()[0].InChunkImage);
+    EXPECT_TRUE(baked.Entities()[0].Components.empty());
+    // Baked entities are closed to further per-entity payload.
+    EXPECT_FALSE(baked.AddComponent(ZoneLocalEntityId{ 0 }, PackageOnAdd{}));
+
+    std::vector<ImportedEntity> expected;
+    for (const ZoneLoadPackage* package : { &plain, static_cast<const ZoneLoadPackage*>(&baked) })
+    {
+        RuntimeWorld runtime(schema);
+        PackageOnAddCalls = 0;
+        ZoneImportError error;
+        ASSERT_TRUE(ImportZonePackage(runtime, schema, *package, LogicOnly(), &error))
+            << error.Message;
+        EXPECT_EQ(PackageOnAddCalls, 1);
+
+        const RuntimeZoneRecord* zone = runtime.FindZone(ZoneId{ 60 });
+        ASSERT_NE(zone, nullptr);
+        const std::vector<ImportedEntity> described =
+            DescribePartition(runtime.Entities(), zone->Partition);
+        ASSERT_EQ(described.size(), 7u);
+        if (package == &plain)
+            expected = described;
+        else
+            EXPECT_EQ(described, expected);
+    }
+
+    EXPECT_EQ(expected[1].ParentValue, 1);
+    EXPECT_EQ(expected[2].ParentValue, 1);
+    EXPECT_TRUE(expected[0].HasWorldTransform);
+    EXPECT_FALSE(expected[3].HasWorldTransform);
+}
+
+TEST(ZonePackageImporter, BakedChunkImageFillsWholeChunksWithoutMigrations)
+{
+    const WorldComponentSchema schema = MakePackageSchema();
+    RuntimeWorld perEntity(schema);
+    RuntimeWorld chunked(schema);
+
+    constexpr int kEntities = 5000;
+    const ZoneLoadPackage plain = MakeMixedPackage(ZoneId{ 61 }, kEntities);
+    ZoneLoadPackage baked = MakeMixedPackage(ZoneId{ 61 }, kEntities);
+    ASSERT_EQ(BakeZoneChunkImage(baked, schema), baked.EntityCount());
+
+    ZoneImportError error;
+    ASSERT_TRUE(ImportZonePackage(perEntity, schema, plain, LogicOnly(), &error))
+        << error.Message;
+    ASSERT_TRUE(ImportZonePackage(chunked, schema, baked, LogicOnly(), &error))
+        << error.Message;
+
+    EXPECT_EQ(chunked.Entities().RowMigrationCount(), 0u);
+    EXPECT_EQ(chunked.Entities().ChunkCount(), perEntity.Entities().ChunkCount());
+    EXPECT_EQ(DescribePartition(chunked.Entities(), chunked.FindZone(ZoneId{ 61 })->Partition),
+              DescribePartition(perEntity.Entities(), perEntity.FindZone(ZoneId{ 61 })->Partition));
+}
+
+TEST(ZonePackageImporter, UnbakeableEntityStaysPerEntityAndRollsBackTheImage)
+{
+    const WorldComponentSchema schema = MakePackageSchema();
+    RuntimeWorld runtime(schema);
+
+    ZoneLoadPackage package = MakeMixedPackage(ZoneId{ 62 }, 8);
+    const ZoneLocalEntityId unknown = package.CreateEntity();
+    ASSERT_TRUE(package.AddComponent(unknown, PackageUnknown{ 1 }));
+
+    EXPECT_EQ(BakeZoneChunkImage(package, schema), package.EntityCount() - 1);
+    EXPECT_FALSE(package.Entities()[unknown.Value].InChunkImage);
+    // A second bake finds nothing new to take.
+    EXPECT_EQ(BakeZoneChunkImage(package, schema), 0u);
+
+    // The image imports first; the unknown component then fails the zone, and
+    // the rows the image created go with it.
+    ZoneImportError error;
+    EXPECT_FALSE(ImportZonePackage(runtime, schema, package, {}, &error));
+    EXPECT_FALSE(error.Message.empty());
+    EXPECT_EQ(runtime.FindZone(ZoneId{ 62 }), nullptr);
+    EXPECT_EQ(runtime.Entities().EntityCount(), 0u);
+}
+
+TEST(ZonePackageImporter, SlicedImportMatchesTheOneShotImportWhileHidden)
+{
+    const WorldComponentSchema schema = MakePackageSchema();
+
+    const ZoneLoadPackage plain = MakeMixedPackage(ZoneId{ 63 }, 40);
+    ZoneLoadPackage baked = MakeMixedPackage(ZoneId{ 63 }, 40);
+    ASSERT_EQ(BakeZoneChunkImage(baked, schema), baked.EntityCount());
+
+    for (const ZoneLoadPackage* package : { &plain, static_cast<const ZoneLoadPackage*>(&baked) })
+    {
+        RuntimeWorld oneShot(schema);
+        ZoneImportError error;
+        ASSERT_TRUE(ImportZonePackage(oneShot, schema, *package, LogicOnly(), &error))
+            << error.Message;
+
+        RuntimeWorld runtime(schema);
+        PackageOnAddCalls = 0;
+        ZonePackageImport import(runtime, schema, *package);
+        int steps = 0;
+        while (import.Step(5, &error) == ZonePackageImport::Status::Importing)
+        {
+            ++steps;
+            EXPECT_EQ(import.ImportedRows(), static_cast<std::size_t>(steps) * 5);
+            const RuntimeZoneRecord* zone = runtime.FindZone(ZoneId{ 63 });
+            ASSERT_NE(zone, nullptr);
+            EXPECT_EQ(zone->State, RuntimeZoneLoadState::Importing);
+            EXPECT_TRUE(runtime.PendingResidencyChanges().empty());
+        }
+        ASSERT_EQ(import.GetStatus(), ZonePackageImport::Status::Imported) << error.Message;
+        EXPECT_EQ(steps, 8);
+        EXPECT_EQ(import.ImportedRows(), 43u);
+        EXPECT_EQ(PackageOnAddCalls, 1);
+        ASSERT_TRUE(runtime.PublishZone(ZoneId{ 63 }, LogicOnly()));
+
+        EXPECT_EQ(runtime.Entities().ChunkCount(), oneShot.Entities().ChunkCount());
+        EXPECT_EQ(DescribePartition(runtime.Entities(), runtime.FindZone(ZoneId{ 63 })->Partition),
+                  DescribePartition(oneShot.Entities(), oneShot.FindZone(ZoneId{ 63 })->Partition));
+        if (package == &baked)
+        {
+            EXPECT_EQ(runtime.Entities().RowMigrationCount(), 0u);
+        }
+    }
+}
+
+TEST(ZonePackageImporter, CancelledSlicedImportLeavesNothingBehind)
+{
+    const WorldComponentSchema schema = MakePackageSchema();
+    RuntimeWorld runtime(schema);
+    ZoneLoadPackage package = MakeMixedPackage(ZoneId{ 64 }, 40);
+    ASSERT_EQ(BakeZoneChunkImage(package, schema), package.EntityCount());
+
+    ZonePackageImport import(runtime, schema, package);
+    EXPECT_EQ(import.Step(10), ZonePackageImport::Status::Importing);
+    EXPECT_EQ(import.Step(10), ZonePackageImport::Status::Importing);
+    EXPECT_EQ(runtime.Entities().EntityCount(), 20u);
+
+    import.Cancel();
+    EXPECT_EQ(import.GetStatus(), ZonePackageImport::Status::Failed);
+    EXPECT_EQ(import.Step(10), ZonePackageImport::Status::Failed);
+    EXPECT_EQ(runtime.FindZone(ZoneId{ 64 }), nullptr);
+    EXPECT_EQ(runtime.Entities().EntityCount(), 0u);
+}
@@ -1,5 +1,10 @@
+#include <assets/runtime/AssetSystem.h>
 #include <core/logging/LoggingProvider.h>
+#include <core/serialization/BinaryWriter.h>
+#include <core/serialization/GrowableWriter.h>
 #include <ecs/WorldComponentSchema.h>
+#include <render/MaterialCache.h>
+#include <world/registry/Registry.h>
 #include <world/RuntimeWorld.h>
 #include <world/serialization/ComponentSerializer.h>
 #include <world/serialization/ComponentSerializerRegistry.h>
@@ -13,7 +18,10 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <memory>
+#include <span>
+#include <vector>
 
 struct ScenePackageValue
 {
@@ -39,6 +47,30 @@ struct TypeSchema<ScenePackageValue>
     }
 };
 
+struct ScenePackageMaterial
+{
+    MaterialHandle Material;
+};
+
+SENCHA_DECLARE_COMPONENT_TYPE(
+    ScenePackageMaterial,
+    "test.scene_package_material");
+
+template <>
+struct TypeSchema<ScenePackageMaterial>
+{
+    static constexpr std::string_view Name = "scene_package_material";
+    static constexpr std::uint32_t SceneChunkId =
+        MakeFourCC('S', 'P', 'K', 'M');
+
+    static auto Fields()
+    {
+        return std::tuple{
+            MakeField("material", &ScenePackageMaterial::Material),
+        };
+    }
+};
+
 namespace
 {
 ComponentSerializerRegistry MakeSerializers()
@@ -91,6 +123,26 @@ JsonValue MakeSceneJson()
         { "hierarchy", JsonValue(std::move(hierarchy)) },
     });
 }
+
+// The binary twin of MakeSceneJson: the bytes SaveSceneBinary writes for the
+// same two entities and relation.
+std::vector<std::byte> MakeSceneBinary(const ComponentSerializerRegistry& serializers)
+{
+    Registry source;
+    source.Components.RegisterComponent<Parent>();
+    source.Components.RegisterComponent<ScenePackageValue>();
+    const EntityId root = source.Components.CreateEntity();
+    const EntityId child = source.Components.CreateEntity();
+    source.Components.AddComponent(root, ScenePackageValue{ 11 });
+    source.Components.AddComponent(child, ScenePackageValue{ 22 });
+    source.Components.AddComponent(child, Parent{ root });
+
+    GrowableWriter bytes;
+    BinaryWriter writer(bytes);
+    SceneSaveError error;
+    EXPECT_TRUE(SaveSceneBinary(source, serializers, writer, &error)) << error.Message;
+    return bytes.Take();
+}
 } // namespace
 
 TEST(ZonePackageSceneLoader, ParsesOnWorkerShapeAndDecodesOnOwnerThread)
@@ -205,3 +257,176 @@ TEST(ZonePackageSceneLoader, LiftsPersistentIdIntoPackageMetadata)
     EXPECT_EQ(package.Entities()[0].PersistentId, (PersistentEntityId{ 0xaa }));
     EXPECT_FALSE(package.Entities()[1].PersistentId.IsValid());
 }
+
+TEST(ZonePackageSceneLoader, BinarySceneSplitsIntoRecordsThatImportLikeJson)
+{
+    ComponentSerializerRegistry serializers = MakeSerializers();
+    const WorldComponentSchema schema = MakeSchema();
+    RuntimeWorld runtime(schema);
+
+    const std::vector<std::byte> bytes = MakeSceneBinary(serializers);
+    ASSERT_TRUE(IsBinaryScene(bytes));
+
+    ZoneLoadPackage package(ZoneId{ 42 });
+    SceneLoadError buildError;
+    ASSERT_TRUE(BuildZonePackageFromSceneBinary(bytes, serializers, package, &buildError))
+        << buildError.Message;
+    ASSERT_EQ(package.EntityCount(), 2u);
+    ASSERT_EQ(package.Parents().size(), 1u);
+    for (const ZonePackageEntity& entity : package.Entities())
+    {
+        ASSERT_EQ(entity.Components.size(), 1u);
+        EXPECT_TRUE(entity.Components[0].SerializedBinary.has_value());
+    }
+
+    LoggingProvider logging;
+    SceneSerializationContext context(logging);
+    ZoneImportError importError;
+    ASSERT_TRUE(ImportZonePackage(
+        runtime,
+        schema,
+        package,
+        serializers,
+        context,
+        ZoneParticipation{ .Logic = true },
+        &importError)) << importError.Message;
+
+    RuntimeZoneRecord* zone = runtime.FindZone(ZoneId{ 42 });
+    ASSERT_NE(zone, nullptr);
+    EntityId root;
+    EntityId child;
+    for (EntityId entity : runtime.Entities().GetAliveEntities())
+    {
+        if (runtime.Entities().GetEntityPartition(entity) != zone->Partition)
+            continue;
+        const ScenePackageValue* value =
+            runtime.Entities().TryGet<ScenePackageValue>(entity);
+        ASSERT_NE(value, nullptr);
+        if (value->Value == 11)
+            root = entity;
+        else if (value->Value == 22)
+            child = entity;
+    }
+    ASSERT_TRUE(root.IsValid());
+    ASSERT_TRUE(child.IsValid());
+    const Parent* parent = runtime.Entities().TryGet<Parent>(child);
+    ASSERT_NE(parent, nullptr);
+    EXPECT_EQ(parent->Entity, root);
+}
+
+TEST(ZonePackageSceneLoader, BinarySceneRejectsARecordOverrunningTheScene)
+{
+    ComponentSerializerRegistry serializers = MakeSerializers();
+    std::vector<std::byte> bytes = MakeSceneBinary(serializers);
+    EXPECT_FALSE(IsBinaryScene(std::span<const std::byte>(bytes).first(2)));
+
+    // The last record is the child's 4-byte value; cut into it.
+    bytes.resize(bytes.size() - 2);
+    ZoneLoadPackage package(ZoneId{ 43 });
+    SceneLoadError error;
+    EXPECT_FALSE(BuildZonePackageFromSceneBinary(bytes, serializers, package, &error));
+    EXPECT_FALSE(error.Message.empty());
+    EXPECT_TRUE(package.Empty());
+}
+
+TEST(ZonePackageSceneLoader, BinarySceneLiftsPersistentIdIntoPackageMetadata)
+{
+    ComponentSerializerRegistry serializers;
+    ASSERT_EQ(
+        serializers.Register(
+            std::make_unique<ComponentSerializer<PersistentIdComponent>>()),
+        ComponentSerializerRegistry::RegisterResult::Added);
+
+    Registry source;
+    source.Components.RegisterComponent<PersistentIdComponent>();
+    const EntityId authored = source.Components.CreateEntity();
+    (void)source.Components.CreateEntity();
+    source.Components.AddComponent(authored, PersistentIdComponent{ PersistentEntityId{ 0xaa } });
+
+    GrowableWriter bytes;
+    BinaryWriter writer(bytes);
+    ASSERT_TRUE(SaveSceneBinary(source, serializers, writer));
+
+    ZoneLoadPackage package(ZoneId{ 6 });
+    SceneLoadError error;
+    ASSERT_TRUE(BuildZonePackageFromSceneBinary(bytes.Bytes(), serializers, package, &error))
+        << error.Message;
+    ASSERT_EQ(package.EntityCount(), 2u);
+    EXPECT_EQ(package.Entities()[0].PersistentId, (PersistentEntityId{ 0xaa }));
+    EXPECT_FALSE(package.Entities()[1].PersistentId.IsValid());
+}
+
+TEST(ZonePackageSceneLoader, BinaryPackageResolvesHandlesThroughItsAssetTable)
+{
+    ComponentSerializerRegistry serializers;
+    ASSERT_EQ(
+        serializers.Register(
+            std::make_unique<ComponentSerializer<ScenePackageMaterial>>()),
+        ComponentSerializerRegistry::RegisterResult::Added);
+    WorldComponentSchema schema;
+    schema.Add<ScenePackageMaterial>();
+    schema.Seal();
+    RuntimeWorld runtime(schema);
+
+    LoggingProvider logging;
+    AssetRegistry assetRegistry(logging);
+    MaterialCache materials;
+    AssetSystem assets(logging, assetRegistry, nullptr, &materials);
+    const MaterialHandle red = assets.RegisterProceduralMaterial(
+        "asset://materials/dev/red.smat",
+        Material{ .Pass = ShaderPassId::ForwardOpaque });
+    const MaterialHandle blue = assets.RegisterProceduralMaterial(
+        "asset://materials/dev/blue.smat",
+        Material{ .Pass = ShaderPassId::ForwardOpaque });
+
+    Registry source;
+    source.Components.RegisterComponent<ScenePackageMaterial>();
+    for (const MaterialHandle material : { red, blue, red })
+        source.Components.AddComponent(
+            source.Components.CreateEntity(), ScenePackageMaterial{ material });
+
+    SceneSerializationContext context(logging, &assets);
+    GrowableWriter bytes;
+    BinaryWriter writer(bytes);
+    ASSERT_TRUE(SaveSceneBinary(source, serializers, writer, context));
+
+    ZoneLoadPackage package(ZoneId{ 44 });
+    SceneLoadError buildError;
+    ASSERT_TRUE(BuildZonePackageFromSceneBinary(bytes.Bytes(), serializers, package, &buildError))
+        << buildError.Message;
+    ASSERT_EQ(package.AssetRefs().size(), 2u);
+    EXPECT_EQ(package.AssetRefs()[0].Type, AssetType::Material);
+    EXPECT_EQ(package.AssetRefs()[0].Path, "asset://materials/dev/red.smat");
+
+    ZoneImportError importError;
+    ASSERT_TRUE(ImportZonePackage(
+        runtime,
+        schema,
+        package,
+        serializers,
+        context,
+        ZoneParticipation{ .Logic = true },
+        &importError)) << importError.Message;
+    EXPECT_EQ(context.AssetTable, nullptr);
+
+    std::vector<MaterialHandle> imported;
+    for (EntityId entity : runtime.Entities().GetAliveEntities())
+        if (const auto* component = runtime.Entities().TryGet<ScenePackageMaterial>(entity))
+            imported.push_back(component->Material);
+    ASSERT_EQ(imported.size(), 3u);
+    EXPECT_EQ(std::count(imported.begin(), imported.end(), red), 2);
+    EXPECT_EQ(std::count(imported.begin(), imported.end(), blue), 1);
+
+    // Without an AssetSystem the table cannot resolve, and the handle field
+    // fails the import rather than importing an empty handle.
+    RuntimeWorld unresolvedRuntime(schema);
+    SceneSerializationContext noAssets(logging);
+    EXPECT_FALSE(ImportZonePackage(
+        unresolvedRuntime,
+        schema,
+        package,
+        serializers,
+        noAssets,
+        ZoneParticipation{ .Logic = true },
+        &importError));
+}
@@ -0,0 +1,232 @@
+// Evidence generator: what predictive prefetch buys a fast-moving focus when
+// loads are slow. The focus sprints out along the traversal chain and back
+// while the async lane is throttled to one zone build every few frames, once
+// with prediction off and once with a horizon, and the runtime's own counters
+// say how often content arrived late.
+//
+// Skipped unless SENCHA_ZONE_PREFETCH_BENCH_OUT names the output path (a .json
+// is written there and a .csv beside it). Run it through
+// scripts/bench_zone_prefetch.sh; compare two runs with
+// scripts/bench_streaming_compare.py.
+//
+// Per predict horizon (p0 is prediction off, p1500 a 1.5s horizon):
+//   visible_pops_*       zones that became resident after they were wanted
+//                        visible (count)
+//   late_traversals_*    frames a dock crossing was held because the zone
+//                        ahead had no physics yet (count)
+//   loads_*              zone builds the lap paid for, wasted ones included
+//                        (count)
+//   update_owner_*_ms    median owner-thread WorldPartitionRuntime::Update
+//   control_memory_stream_ms  the compare script's drift yardstick
+
+#include <gtest/gtest.h>
+
+#include "BenchRecorder.h"
+#include "StreamingTraversalFixture.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace
+{
+namespace fs = std::filesystem;
+using namespace StreamingTraversal;
+
+Bench::Recorder Recorder;
+
+// Thirty units a second crosses a 20-unit zone in 40 frames; one build every
+// 24 frames keeps up with a focus that asks a zone ahead, not with one that
+// waits to be told.
+constexpr double kSprintSpeed = 30.0;
+constexpr double kFrameSeconds = 1.0 / 60.0;
+constexpr int kFramesPerBuild = 24;
+
+class PrefetchHarness
+{
+public:
+    explicit PrefetchHarness(double predictSeconds)
+        : Schema_(Schema())
+        , World_(Schema_)
+        , SceneContext_(Logging_)
+        , Loader_(Tasks_, World_, Schema_, Serializers_, SceneContext_, FrameLoop_)
+        , Partition_(MakeRecipe(), Config(predictSeconds))
+    {
+    }
+
+    bool LoadManifest()
+    {
+        const std::optional<JsonValue> json = JsonParse(ChainManifestJson());
+        if (!json.has_value())
+            return false;
+        std::string error;
+        std::optional<WorldPartitionManifest> manifest =
+            ReadWorldPartitionManifest(*json, &error);
+        if (!manifest.has_value())
+            return false;
+        for (int index = 0; index + 1 < kZoneCount; ++index)
+            AddFixtureDockPair(*manifest,
+                               static_cast<std::uint64_t>(0xc0 + index),
+                               ZoneAt(index), ZoneAt(index + 1),
+                               Vec3d{ static_cast<float>(index + 1)
+                                          * static_cast<float>(kZoneSpan),
+                                      2.0f, 0.0f });
+        return Partition_.LoadManifest(std::move(*manifest), &error);
+    }
+
+    // Streams the first zone in unthrottled so the lap starts settled.
+    void Settle(float x)
+    {
+        Partition_.SetFocus(Vec3d(x, 1.0f, 0.0f));
+        for (int frame = 0; frame < 8; ++frame)
+            Step(true);
+    }
+
+    // Out to the far end of the chain and back at sprint speed, one build
+    // allowed every kFramesPerBuild frames.
+    void Sprint(std::vector<double>& updates)
+    {
+        const double end = static_cast<double>(kZoneCount) * kZoneSpan - 1.0;
+        double x = 1.0;
+        double direction = 1.0;
+        for (int frame = 0; direction > 0.0 || x > 1.0; ++frame)
+        {
+            x += direction * kSprintSpeed * kFrameSeconds;
+            if (x >= end)
+                direction = -1.0;
+            Partition_.SetFocus(Vec3d(static_cast<float>(x), 1.0f, 0.0f));
+
+            const Bench::Clock::time_point start = Bench::Clock::now();
+            Partition_.Update(kFrameSeconds, Loader_, World_);
+            updates.push_back(Bench::MillisecondsSince(start));
+            Process(frame % kFramesPerBuild == 0);
+        }
+    }
+
+    [[nodiscard]] const WorldPartitionRuntime& Partition() const { return Partition_; }
+    [[nodiscard]] int Builds() const { return Builds_; }
+
+private:
+    static WorldPartitionStreamingConfig Config(double predictSeconds)
+    {
+        WorldPartitionStreamingConfig config;
+        config.HopCount = 1;
+        config.LingerSeconds = 0.0;
+        config.ResidentZoneCap = 6;
+        config.PredictSeconds = predictSeconds;
+        return config;
+    }
+
+    void Step(bool build)
+    {
+        Partition_.Update(kFrameSeconds, Loader_, World_);
+        Process(build);
+    }
+
+    void Process(bool build)
+    {
+        World_.FlushLifecycleRequests();
+        if (build)
+            (void)Tasks_.PumpWork(1);
+        (void)Tasks_.DrainCompletions();
+        World_.FlushLifecycleRequests();
+        (void)World_.BeginResidencyProcessing();
+        World_.FinalizeResidencyProcessing();
+    }
+
+    ZoneLoadRecipeFn MakeRecipe()
+    {
+        return [this](const ZoneHeader& header)
+        {
+            const int index = static_cast<int>(header.Id.Value - 0xa0);
+            ZoneLoadRecipe recipe;
+            recipe.Build = [this, index](ZoneLoadPackage& package)
+            {
+                ++Builds_;
+                BuildZoneContent(package, index);
+            };
+            return recipe;
+        };
+    }
+
+    LoggingProvider Logging_;
+    AsyncTaskQueue Tasks_{ 0 };
+    WorldComponentSchema Schema_;
+    RuntimeWorld World_;
+    ComponentSerializerRegistry Serializers_;
+    SceneSerializationContext SceneContext_;
+    RuntimeFrameLoop FrameLoop_;
+    AsyncZoneLoader Loader_;
+    WorldPartitionRuntime Partition_;
+    int Builds_ = 0;
+};
+
+void MeasureSprint(const std::string& label, double predictSeconds)
+{
+    PrefetchHarness harness(predictSeconds);
+    ASSERT_TRUE(harness.LoadManifest());
+    harness.Settle(1.0f);
+
+    const uint64_t popsBefore = harness.Partition().VisiblePopCount();
+    const uint64_t lateBefore = harness.Partition().LateTraversalCount();
+    const int buildsBefore = harness.Builds();
+    std::vector<double> updates;
+    harness.Sprint(updates);
+
+    Recorder.Record("visible_pops_" + label, "count",
+                    static_cast<double>(harness.Partition().VisiblePopCount() - popsBefore));
+    Recorder.Record("late_traversals_" + label, "count",
+                    static_cast<double>(harness.Partition().LateTraversalCount() - lateBefore));
+    Recorder.Record("loads_" + label, "count",
+                    static_cast<double>(harness.Builds() - buildsBefore));
+    Recorder.Record("update_owner_" + label + "_ms", "ms", Bench::Median(updates));
+}
+
+// Touches no engine code, so a change in it is a change in the machine, not
+// the build.
+void MeasureControl(int reps)
+{
+    constexpr std::size_t kBytes = 20u * 1024u * 1024u;
+    std::vector<unsigned char> buffer(kBytes, 1);
+    std::vector<double> samples;
+    for (int rep = 0; rep <= reps; ++rep)
+    {
+        const Bench::Clock::time_point start = Bench::Clock::now();
+        unsigned long long sum = 0;
+        for (std::size_t index = 0; index < kBytes; index += 64)
+            sum += buffer[index];
+        const double elapsed = Bench::MillisecondsSince(start);
+        if (sum == 0)
+            std::abort();
+        if (rep > 0)
+            samples.push_back(elapsed);
+    }
+    Recorder.Record("control_memory_stream_ms", "ms", Bench::Median(samples));
+}
+}
+
+TEST(ZonePrefetchBench, Generate)
+{
+    const char* outEnv = std::getenv("SENCHA_ZONE_PREFETCH_BENCH_OUT");
+    if (outEnv == nullptr)
+    {
+        GTEST_SKIP() << "set SENCHA_ZONE_PREFETCH_BENCH_OUT to record the zone "
+                        "prefetch bench (use scripts/bench_zone_prefetch.sh)";
+    }
+
+    const fs::path jsonPath(outEnv);
+    if (jsonPath.has_parent_path() && !jsonPath.parent_path().empty())
+        fs::create_directories(jsonPath.parent_path());
+
+    Recorder.Clear();
+    MeasureControl(Bench::RepsFromEnvironment("SENCHA_ZONE_PREFETCH_REPS", 5));
+    MeasureSprint("p0", 0.0);
+    MeasureSprint("p1500", 1.5);
+
+    ASSERT_TRUE(Recorder.WriteJson(jsonPath));
+    fs::path csvPath = jsonPath;
+    csvPath.replace_extension(".csv");
+    ASSERT_TRUE(Recorder.WriteCsv(csvPath));
+}
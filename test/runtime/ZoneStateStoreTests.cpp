@@ -3,12 +3,16 @@
 // diff mechanics are covered directly, then the full path — import, destroy,
 // detach-capture, re-import suppression — through RuntimeWorld and the real
 // package importer. RestreamedZoneMatchesAFreshAttach pins the complement: a
-// zone with no recorded deviation restreams verbatim.
+// zone with no recorded deviation restreams verbatim. The ZoneStateCapture
+// tests cover tracked component values and the capture's trip through the
+// async lane.
 
 #include <ecs/WorldComponentSchema.h>
+#include <jobs/AsyncTaskQueue.h>
 #include <world/RuntimeWorld.h>
 #include <world/identity/PersistentEntityIndex.h>
 #include <world/identity/PersistentIdComponent.h>
+#include <zone/ZoneChunkImage.h>
 #include <zone/ZoneLoadPackage.h>
 #include <zone/ZonePackageImporter.h>
 #include <zone/ZoneStateStore.h>
@@ -19,6 +23,13 @@
 #include <span>
 #include <vector>
 
+struct ZoneStateDoor
+{
+    int Openness = 0;
+};
+
+SENCHA_DECLARE_COMPONENT_TYPE(ZoneStateDoor, "test.zone_state_door");
+
 namespace
 {
 WorldComponentSchema IdentityOnlySchema()
@@ -29,6 +40,15 @@ WorldComponentSchema IdentityOnlySchema()
     return schema;
 }
 
+WorldComponentSchema DoorSchema()
+{
+    WorldComponentSchema schema;
+    schema.Add<PersistentIdComponent>();
+    schema.Add<ZoneStateDoor>();
+    schema.Seal();
+    return schema;
+}
+
 ZoneParticipation LogicOnly()
 {
     ZoneParticipation participation;
@@ -55,6 +75,33 @@ ZoneLoadPackage MakeIdentifiedPackage(ZoneId zone,
     return package;
 }
 
+ZoneLoadPackage MakeDoorPackage(ZoneId zone, std::span<const PersistentEntityId> ids)
+{
+    ZoneLoadPackage package(zone);
+    for (const PersistentEntityId id : ids)
+    {
+        const ZoneLocalEntityId local = package.CreateEntity();
+        EXPECT_TRUE(package.AddComponent<PersistentIdComponent>(local, { id }));
+        EXPECT_TRUE(package.AddComponent<ZoneStateDoor>(local, { 0 }));
+        EXPECT_TRUE(package.SetPersistentId(local, id));
+    }
+    return package;
+}
+
+void Detach(RuntimeWorld& runtime, ZoneId zone)
+{
+    ASSERT_TRUE(runtime.RequestDetach(zone));
+    runtime.FlushLifecycleRequests();
+    FinishResidency(runtime);
+}
+
+std::vector<std::byte> DoorBytes(int openness)
+{
+    const ZoneStateDoor door{ openness };
+    const auto* bytes = reinterpret_cast<const std::byte*>(&door);
+    return { bytes, bytes + sizeof(door) };
+}
+
 std::size_t AliveCount(const World& world)
 {
     return world.GetAliveEntities().size();
@@ -178,6 +225,51 @@ TEST(ZoneStateMemory, DestroyedEntityStaysDestroyedAcrossRestream)
     EXPECT_EQ(AliveCount(runtime.Entities()), 1u);
 }
 
+// The baked form imports a chunk at a time, so suppression cannot skip a row
+// build; it has to leave the destroyed entity's row out of the copy.
+TEST(ZoneStateMemory, BakedRestreamLeavesDestroyedRowsOutOfTheCopy)
+{
+    const WorldComponentSchema schema = IdentityOnlySchema();
+    RuntimeWorld runtime(schema);
+
+    const ZoneId zone{ 44 };
+    const std::array ids{ PersistentEntityId{ 0x500 }, PersistentEntityId{ 0x600 },
+                          PersistentEntityId{ 0x700 } };
+    const auto bakedPackage = [&] {
+        ZoneLoadPackage package = MakeIdentifiedPackage(zone, ids);
+        EXPECT_EQ(BakeZoneChunkImage(package, schema), ids.size());
+        return package;
+    };
+
+    ZoneImportError error;
+    ASSERT_TRUE(ImportZonePackage(runtime, schema, bakedPackage(), LogicOnly(), &error))
+        << error.Message;
+    FinishResidency(runtime);
+
+    auto* index = runtime.Entities().TryGetResource<PersistentEntityIndex>();
+    ASSERT_NE(index, nullptr);
+    for (const PersistentEntityId id : ids)
+        ASSERT_TRUE(index->TryResolve(id).IsValid());
+
+    runtime.Entities().DestroyEntity(index->TryResolve(ids[1]));
+    ASSERT_TRUE(runtime.RequestDetach(zone));
+    runtime.FlushLifecycleRequests();
+    FinishResidency(runtime);
+
+    ASSERT_TRUE(ImportZonePackage(runtime, schema, bakedPackage(), LogicOnly(), &error))
+        << error.Message;
+    FinishResidency(runtime);
+
+    EXPECT_FALSE(index->TryResolve(ids[1]).IsValid());
+    for (const PersistentEntityId id : { ids[0], ids[2] })
+    {
+        const EntityId entity = index->TryResolve(id);
+        ASSERT_TRUE(entity.IsValid());
+        EXPECT_EQ(runtime.Entities().TryGet<PersistentIdComponent>(entity)->Id, id);
+    }
+    EXPECT_EQ(AliveCount(runtime.Entities()), 2u);
+}
+
 TEST(ZoneStateMemory, UntouchedZoneRestreamsVerbatim)
 {
     const WorldComponentSchema schema = IdentityOnlySchema();
@@ -280,3 +372,160 @@ TEST(ZonePackageIdentity, UnidentifiedEntitiesImportNormally)
     FinishResidency(runtime);
     EXPECT_EQ(AliveCount(runtime.Entities()), 1u);
 }
+
+TEST(ZoneStateStore, CommitKeepsOnlyValuesThatStillDeviate)
+{
+    ZoneStateStore store;
+    const ZoneId zone{ 1 };
+    const ComponentTypeId door = ResolveComponentTypeId<ZoneStateDoor>();
+    const std::array authored{ PersistentEntityId{ 0xa }, PersistentEntityId{ 0xb } };
+
+    store.RecordAuthoredSet(zone, authored);
+    ZoneDetachCapture first;
+    first.HasBaseline = true;
+    first.Modified[0xa].push_back({ door, DoorBytes(3) });
+    first.Modified[0xb].push_back({ door, DoorBytes(4) });
+    store.CommitDetachCapture(zone, std::move(first));
+    ASSERT_EQ(store.RecordedModifiedCount(zone), 2u);
+    EXPECT_EQ(store.RecordedComponents(zone, PersistentEntityId{ 0xa })[0].Bytes, DoorBytes(3));
+
+    // A is back at its authored value and B is gone: neither keeps a record.
+    store.RecordAuthoredSet(zone, authored);
+    ZoneDetachCapture second;
+    second.HasBaseline = true;
+    second.Modified[0xa].push_back({ door, {} });
+    second.Destroyed.insert(0xb);
+    store.CommitDetachCapture(zone, std::move(second));
+
+    EXPECT_EQ(store.RecordedModifiedCount(zone), 0u);
+    EXPECT_TRUE(store.RecordedComponents(zone, PersistentEntityId{ 0xa }).empty());
+    EXPECT_TRUE(store.IsRecordedDestroyed(zone, PersistentEntityId{ 0xb }));
+}
+
+TEST(ZoneStateCapture, TrackedValueSurvivesRestream)
+{
+    const WorldComponentSchema schema = DoorSchema();
+    RuntimeWorld runtime(schema);
+    runtime.Entities().GetResource<ZoneStateStore>().TrackComponent<ZoneStateDoor>();
+
+    const ZoneId zone{ 61 };
+    const std::array ids{ PersistentEntityId{ 0x10 }, PersistentEntityId{ 0x20 } };
+    ZoneImportError error;
+    ASSERT_TRUE(ImportZonePackage(runtime, schema, MakeDoorPackage(zone, ids), LogicOnly(), &error))
+        << error.Message;
+    FinishResidency(runtime);
+
+    auto& index = runtime.Entities().GetResource<PersistentEntityIndex>();
+    runtime.Entities().TryGet<ZoneStateDoor>(index.TryResolve(ids[0]))->Openness = 7;
+    Detach(runtime, zone);
+
+    const ZoneStateStore& store = runtime.Entities().GetResource<ZoneStateStore>();
+    EXPECT_EQ(store.RecordedModifiedCount(zone), 1u)
+        << "only the door that moved deviates from the cooked scene";
+
+    ASSERT_TRUE(ImportZonePackage(runtime, schema, MakeDoorPackage(zone, ids), LogicOnly(), &error))
+        << error.Message;
+    FinishResidency(runtime);
+    EXPECT_EQ(runtime.Entities().TryGet<ZoneStateDoor>(index.TryResolve(ids[0]))->Openness, 7);
+    EXPECT_EQ(runtime.Entities().TryGet<ZoneStateDoor>(index.TryResolve(ids[1]))->Openness, 0);
+
+    // Closing the door again returns it to authored, and the record goes with it.
+    runtime.Entities().TryGet<ZoneStateDoor>(index.TryResolve(ids[0]))->Openness = 0;
+    Detach(runtime, zone);
+    EXPECT_EQ(store.RecordedModifiedCount(zone), 0u);
+}
+
+TEST(ZoneStateCapture, BakedImportOverlaysRecordedValues)
+{
+    const WorldComponentSchema schema = DoorSchema();
+    RuntimeWorld runtime(schema);
+    runtime.Entities().GetResource<ZoneStateStore>().TrackComponent<ZoneStateDoor>();
+
+    const ZoneId zone{ 62 };
+    const std::array ids{ PersistentEntityId{ 0x30 }, PersistentEntityId{ 0x40 } };
+    const auto bakedPackage = [&] {
+        ZoneLoadPackage package = MakeDoorPackage(zone, ids);
+        EXPECT_EQ(BakeZoneChunkImage(package, schema), ids.size());
+        return package;
+    };
+
+    ZoneImportError error;
+    ASSERT_TRUE(ImportZonePackage(runtime, schema, bakedPackage(), LogicOnly(), &error))
+        << error.Message;
+    FinishResidency(runtime);
+    auto& index = runtime.Entities().GetResource<PersistentEntityIndex>();
+    runtime.Entities().TryGet<ZoneStateDoor>(index.TryResolve(ids[1]))->Openness = 5;
+    Detach(runtime, zone);
+
+    ASSERT_TRUE(ImportZonePackage(runtime, schema, bakedPackage(), LogicOnly(), &error))
+        << error.Message;
+    FinishResidency(runtime);
+    EXPECT_EQ(runtime.Entities().TryGet<ZoneStateDoor>(index.TryResolve(ids[1]))->Openness, 5);
+}
+
+// With a lane the diff runs on a task thread and only the commit touches the
+// store; until then the zone reads as undisturbed.
+TEST(ZoneStateCapture, AsyncCaptureCommitsAtTheDrain)
+{
+    const WorldComponentSchema schema = IdentityOnlySchema();
+    RuntimeWorld runtime(schema);
+    AsyncTaskQueue tasks(0);
+    runtime.SetDetachCaptureLane(&tasks);
+
+    const ZoneId zone{ 63 };
+    const std::array ids{ PersistentEntityId{ 0x50 }, PersistentEntityId{ 0x60 } };
+    ZoneImportError error;
+    ASSERT_TRUE(ImportZonePackage(runtime, schema, MakeIdentifiedPackage(zone, ids), LogicOnly(), &error))
+        << error.Message;
+    FinishResidency(runtime);
+
+    auto& index = runtime.Entities().GetResource<PersistentEntityIndex>();
+    runtime.Entities().DestroyEntity(index.TryResolve(ids[0]));
+    Detach(runtime, zone);
+
+    const ZoneStateStore& store = runtime.Entities().GetResource<ZoneStateStore>();
+    EXPECT_EQ(AliveCount(runtime.Entities()), 0u);
+    EXPECT_EQ(runtime.PendingDetachCaptureCount(), 1u);
+    EXPECT_EQ(store.RecordedDestroyedCount(zone), 0u);
+
+    EXPECT_EQ(tasks.PumpWork(), 1u);
+    EXPECT_EQ(store.RecordedDestroyedCount(zone), 0u)
+        << "the worker computes the capture but does not commit it";
+    (void)tasks.DrainCompletions();
+
+    EXPECT_EQ(runtime.PendingDetachCaptureCount(), 0u);
+    EXPECT_TRUE(store.IsRecordedDestroyed(zone, ids[0]));
+}
+
+// A zone that streams back before its capture drained must still see it.
+TEST(ZoneStateCapture, ReimportCompletesAPendingCapture)
+{
+    const WorldComponentSchema schema = IdentityOnlySchema();
+    RuntimeWorld runtime(schema);
+    AsyncTaskQueue tasks(0);
+    runtime.SetDetachCaptureLane(&tasks);
+
+    const ZoneId zone{ 64 };
+    const std::array ids{ PersistentEntityId{ 0x70 }, PersistentEntityId{ 0x80 } };
+    ZoneImportError error;
+    ASSERT_TRUE(ImportZonePackage(runtime, schema, MakeIdentifiedPackage(zone, ids), LogicOnly(), &error))
+        << error.Message;
+    FinishResidency(runtime);
+
+    auto& index = runtime.Entities().GetResource<PersistentEntityIndex>();
+    runtime.Entities().DestroyEntity(index.TryResolve(ids[1]));
+    Detach(runtime, zone);
+    ASSERT_EQ(runtime.PendingDetachCaptureCount(), 1u);
+
+    ASSERT_TRUE(ImportZonePackage(runtime, schema, MakeIdentifiedPackage(zone, ids), LogicOnly(), &error))
+        << error.Message;
+    FinishResidency(runtime);
+    EXPECT_EQ(runtime.PendingDetachCaptureCount(), 0u);
+    EXPECT_FALSE(index.TryResolve(ids[1]).IsValid());
+    EXPECT_EQ(AliveCount(runtime.Entities()), 1u);
+
+    // The queued task finds its capture already committed and does nothing.
+    (void)tasks.PumpWork();
+    (void)tasks.DrainCompletions();
+    EXPECT_EQ(runtime.Entities().GetResource<ZoneStateStore>().RecordedDestroyedCount(zone), 1u);
+}
@@ -217,3 +217,130 @@ TEST(ZoneTopologyScaling, ManifestSurvivesWriteAndReadAtEveryScale)
         }
     }
 }
+
+namespace
+{
+// Probe positions for the bounds queries: every zone's centre and min corner
+// (a corner shared by up to four touching zones, so containment ties), plus
+// points beside, above and beyond the whole layout where nothing contains them.
+std::vector<Vec3d> ProbePositions(const TopologySpec& spec)
+{
+    std::vector<Vec3d> probes;
+    for (int i = 0; i < spec.ZoneCount; ++i)
+    {
+        const Aabb3d bounds = StressZoneBounds(spec, i);
+        probes.push_back(StressZoneCenter(spec, i));
+        probes.push_back(bounds.Min);
+        probes.push_back(Vec3d{ bounds.Min.X + 3.0f, bounds.Max.Y + 40.0f, bounds.Min.Z - 7.0f });
+    }
+    probes.push_back(Vec3d{ -500.0f, 5.0f, -500.0f });
+    probes.push_back(Vec3d{ 1.0e5f, -20.0f, 3.0f });
+    return probes;
+}
+
+bool SameDemand(const std::vector<ZoneDemandRecord>& a, const std::vector<ZoneDemandRecord>& b)
+{
+    return std::equal(a.begin(), a.end(), b.begin(), b.end(),
+                      [](const ZoneDemandRecord& x, const ZoneDemandRecord& y) {
+                          return x.Zone == y.Zone && x.Desired == y.Desired
+                              && x.Reasons == y.Reasons;
+                      });
+}
+}  // namespace
+
+// The bounds BVH is an acceleration structure and nothing more: every query
+// over it must return exactly what a scan of every header returns, including
+// the tie-breaks ResolveZoneAt documents and positions inside no zone at all.
+TEST(ZoneTopologyScaling, BoundsQueriesMatchAFullScanAtEveryScale)
+{
+    for (int zoneCount : kScales)
+    {
+        for (const TopologySpec& spec : ShapesAt(zoneCount))
+        {
+            const WorldPartitionManifest manifest = BuildTopology(spec);
+            const WorldPartitionIndex index = WorldPartitionIndex::Build(manifest);
+
+            std::vector<uint32_t> hits;
+            for (const Vec3d& probe : ProbePositions(spec))
+            {
+                for (double radius : { 0.0, 15.0, 45.0 })
+                {
+                    std::vector<uint32_t> expected;
+                    for (uint32_t i = 0; i < manifest.Zones.size(); ++i)
+                        if (ZoneBoundsDistanceSq(manifest.Zones[i].Bounds, probe)
+                            <= radius * radius)
+                            expected.push_back(i);
+
+                    hits.clear();
+                    index.ZonesWithin(probe, radius, hits);
+                    std::sort(hits.begin(), hits.end());
+                    EXPECT_EQ(hits, expected) << Describe(spec) << " radius " << radius;
+                }
+
+                const ZoneContainmentResult scanned = ResolveZoneAt(manifest, probe, {});
+                const ZoneContainmentResult indexed =
+                    ResolveZoneAt(manifest, index, probe, {});
+                EXPECT_EQ(indexed.Chosen, scanned.Chosen) << Describe(spec);
+                EXPECT_EQ(indexed.Candidates, scanned.Candidates) << Describe(spec);
+                EXPECT_EQ(indexed.Ambiguous, scanned.Ambiguous) << Describe(spec);
+
+                // A preferred zone keeps winning while it still contains the
+                // position, whichever path resolves it.
+                if (!scanned.Candidates.empty())
+                {
+                    const ZoneId preferred = scanned.Candidates.back();
+                    EXPECT_EQ(ResolveZoneAt(manifest, index, probe, preferred).Chosen,
+                              ResolveZoneAt(manifest, probe, preferred).Chosen)
+                        << Describe(spec);
+                }
+            }
+        }
+    }
+}
+
+// WorldPartitionRuntime reuses one focus's hop ranks for as long as the focus
+// stays in the same zone. Walking a focus across a grid that way must publish
+// the same demand, frame by frame, as recomputing everything each frame.
+TEST(ZoneTopologyScaling, DemandFromReusedRanksMatchesFullDemandAlongAWalk)
+{
+    WorldPartitionStreamingConfig config;
+    config.HopCount = 1;
+    config.ResidentZoneCap = 16;
+    config.Radius = 25.0;
+
+    for (int zoneCount : kScales)
+    {
+        const TopologySpec spec{ .Shape = TopologyShape::Grid, .ZoneCount = zoneCount };
+        const WorldPartitionManifest manifest = BuildTopology(spec);
+        const WorldPartitionIndex index = WorldPartitionIndex::Build(manifest);
+
+        const Vec3d from = StressZoneCenter(spec, 0);
+        const Vec3d to = StressZoneCenter(spec, zoneCount - 1);
+        ZoneId focus;
+        ZoneId ranksZone;
+        std::vector<ZoneHopRank> ranks;
+        std::size_t rankRebuilds = 0;
+        constexpr int kSteps = 64;
+        for (int step = 0; step <= kSteps; ++step)
+        {
+            const float t = static_cast<float>(step) / kSteps;
+            const Vec3d position = from + (to - from) * t;
+            focus = ResolveFocusZone(manifest, index, position, focus);
+            ASSERT_TRUE(focus.IsValid()) << Describe(spec);
+            if (focus != ranksZone)
+            {
+                ranks = ComputeZoneHopRanks(manifest, index, focus, config.HopCount);
+                ranksZone = focus;
+                ++rankRebuilds;
+            }
+
+            EXPECT_TRUE(SameDemand(
+                ComputeZoneDemandFromRanks(manifest, index, focus, ranks, {}, config,
+                                           &position),
+                ComputeZoneDemand(manifest, index, focus, {}, config, &position)))
+                << Describe(spec) << " step " << step;
+        }
+        // The walk must actually have changed zone, or the reuse went untested.
+        EXPECT_GT(rankRebuilds, 1u) << Describe(spec);
+    }
+}
@@ -263,7 +263,7 @@ inline void AddStressLinkPair(WorldPartitionManifest& manifest,
             .SceneRef = "levels/stress" + suffix + ".level.json",
             .Bounds = StressZoneBounds(spec, index),
             .BoundsOverridden = true,
-            .CookedSceneRef = "levels/stress" + suffix + ".cooked.json",
+            .CookedSceneRef = "levels/stress" + suffix + ".cooked.sscn",
             .CookedCollisionRef = "levels/stress" + suffix + ".collision.json",
             // Distinct per zone so failed-load suppression keys them apart.
             .CookedContentHash = 0xd000 + static_cast<std::uint64_t>(index),